@@ -26,7 +26,7 @@
 
 // Version number for shader translation API.
 // It is incremented every time the API changes.
-#define ANGLE_SH_VERSION 371
+#define ANGLE_SH_VERSION 372
 
 enum ShShaderSpec
 {
@@ -344,6 +344,11 @@ struct ShCompileOptions
     // Rewrite gl_DrawID as a uniform int
     uint64_t emulateGLDrawID : 1;
 
+    // Add the index of the draw in a multi-draw indirect command (the DrawIndex SPIR-V built-in) to
+    // the uniform that emulates gl_DrawID, so that a multi-draw call can be recorded as a single
+    // indirect draw.  Only has an effect on SPIR-V translation.
+    uint64_t addDrawIndexToGLDrawID : 1;
+
     // This flag initializes shared variables to 0.  It is to avoid ompute shaders being able to
     // read undefined values that could be coming from another webpage/application.
     uint64_t initSharedVariables : 1;
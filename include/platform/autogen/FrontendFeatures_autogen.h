@@ -63,6 +63,12 @@ struct FrontendFeatures : FeatureSetBase
         &members,
     };
 
+    FeatureInfo singleThreadedVertexConversion = {
+        "singleThreadedVertexConversion",
+        FeatureCategory::FrontendWorkarounds,
+        &members,
+    };
+
     FeatureInfo forceDepthAttachmentInitOnClear = {
         "forceDepthAttachmentInitOnClear",
         FeatureCategory::FrontendWorkarounds,
@@ -189,6 +195,24 @@ struct FrontendFeatures : FeatureSetBase
         &members,
     };
 
+    FeatureInfo useFastBlobCompression = {
+        "useFastBlobCompression",
+        FeatureCategory::FrontendFeatures,
+        &members,
+    };
+
+    FeatureInfo threadedCommandStream = {
+        "threadedCommandStream",
+        FeatureCategory::FrontendFeatures,
+        &members,
+    };
+
+    FeatureInfo exportPerformanceCounters = {
+        "exportPerformanceCounters",
+        FeatureCategory::FrontendFeatures,
+        &members,
+    };
+
 };
 
 inline FrontendFeatures::FrontendFeatures()  = default;
@@ -9,6 +9,7 @@
 #   NOTE: don't run this script directly. Run scripts/run_code_generation.py.
 
 import sys, os, pprint, json
+import re
 import fnmatch
 import registry_xml
 from registry_xml import apis, script_relative, strip_api_prefix, api_enums
@@ -288,6 +289,9 @@ enum class EntryPoint
 {entry_points_list}
 }};
 
+// The number of entry points, including Invalid.
+constexpr int kEntryPointCount = static_cast<int>(EntryPoint::{last_entry_point}) + 1;
+
 const char *GetEntryPointName(EntryPoint ep);
 }}  // namespace angle
 #endif  // COMMON_ENTRY_POINTS_ENUM_AUTOGEN_H_
@@ -348,6 +352,7 @@ TEMPLATE_ENTRY_POINT_DECL = """{angle_export}{return_type} {export_def} {name}({
 TEMPLATE_GLES_ENTRY_POINT_NO_RETURN = """\
 void GL_APIENTRY GL_{name}({params})
 {{
+    {command_stream}
     Context *context = {context_getter};
     {event_comment}EVENT(context, GL{name}, "context = %d{comma_if_needed}{format_params}", CID(context){comma_if_needed}{pass_params});
 
@@ -372,6 +377,7 @@ void GL_APIENTRY GL_{name}({params})
 TEMPLATE_GLES_CONTEXT_PRIVATE_ENTRY_POINT_NO_RETURN = """\
 void GL_APIENTRY GL_{name}({params})
 {{
+    {command_stream}
     Context *context = {context_getter};
     {event_comment}EVENT(context, GL{name}, "context = %d{comma_if_needed}{format_params}", CID(context){comma_if_needed}{pass_params});
 
@@ -395,6 +401,7 @@ void GL_APIENTRY GL_{name}({params})
 TEMPLATE_GLES_ENTRY_POINT_WITH_RETURN = """\
 {return_type} GL_APIENTRY GL_{name}({params})
 {{
+    {command_stream}
     Context *context = {context_getter};
     {event_comment}EVENT(context, GL{name}, "context = %d{comma_if_needed}{format_params}", CID(context){comma_if_needed}{pass_params});
 
@@ -426,6 +433,7 @@ TEMPLATE_GLES_ENTRY_POINT_WITH_RETURN = """\
 TEMPLATE_GLES_CONTEXT_PRIVATE_ENTRY_POINT_WITH_RETURN = """\
 {return_type} GL_APIENTRY GL_{name}({params})
 {{
+    {command_stream}
     Context *context = {context_getter};
     {event_comment}EVENT(context, GL{name}, "context = %d{comma_if_needed}{format_params}", CID(context){comma_if_needed}{pass_params});
 
@@ -1967,6 +1975,8 @@ def format_entry_point_def(api, command_node, cmd_name, proto, params, cmd_packe
             get_context_lock(api, cmd_name),
         "preamble":
             get_preamble(api, cmd_name, params),
+        "command_stream":
+            get_command_stream(cmd_name, return_type, params),
         "epilog":
             get_epilog(api, cmd_name),
     }
@@ -3101,12 +3111,62 @@ def get_prepare_swap_buffers_call(api, cmd_name, params):
 
 
 def get_preamble(api, cmd_name, params):
-    preamble = ""
+    # EGL calls may depend on the GL calls recorded before them.
+    preamble = "ANGLE_COMMAND_STREAM_SYNC();" if api == apis.EGL else ""
     preamble += get_prepare_swap_buffers_call(api, cmd_name, params)
     # TODO: others?
     return preamble
 
 
+# Types of GL parameters that are pointers without being spelled as one.
+POINTER_TYPEDEFS = [
+    "GLsync",
+    "GLeglImageOES",
+    "GLeglClientBufferEXT",
+    "GLDEBUGPROC",
+    "GLDEBUGPROCKHR",
+    "GLGETBLOBPROCANGLE",
+    "GLSETBLOBPROCANGLE",
+]
+
+# Calls that can't return before the calls recorded before them are executed.
+COMMAND_STREAM_SYNC_EXCEPTIONS = [
+    "glFinish",
+]
+
+# Calls that set the KHR_debug callback.
+COMMAND_STREAM_DEBUG_CALLBACK_CALLS = [
+    "glDebugMessageCallback",
+    "glDebugMessageCallbackKHR",
+]
+
+
+def is_command_stream_client_array_call(cmd_name):
+    # glVertexAttribPointer, glVertexAttribIPointer and the GLES1 glVertexPointer and the like.
+    return re.search(r"Pointer(OES)?$", cmd_name) is not None
+
+
+def get_command_stream(cmd_name, return_type, params):
+    # Calls that return nothing and take no pointers are recorded by the context's command stream,
+    # if any.  Their parameters are all scalars that can be copied.  Other calls wait for the
+    # recorded calls to be executed first.
+    param_types = [just_the_type(param) for param in params]
+    if cmd_name in COMMAND_STREAM_DEBUG_CALLBACK_CALLS:
+        return "ANGLE_COMMAND_STREAM_SYNC_DEBUG_CALLBACK(callback);"
+    if is_command_stream_client_array_call(cmd_name):
+        return "ANGLE_COMMAND_STREAM_SYNC_CLIENT_ARRAYS();"
+    if (return_type != "void" or cmd_name in COMMAND_STREAM_SYNC_EXCEPTIONS or
+            any("*" in param_type or "[" in param_type or param_type in POINTER_TYPEDEFS
+                for param_type in param_types)):
+        return "ANGLE_COMMAND_STREAM_SYNC();"
+
+    # Draws without indices may read the vertex attributes from client memory.
+    macro = ("ANGLE_COMMAND_STREAM_ENQUEUE_DRAW"
+             if cmd_name.startswith("glDrawArrays") else "ANGLE_COMMAND_STREAM_ENQUEUE")
+    return "%s(%s);" % (macro, ", ".join(["GL_" + strip_api_prefix(cmd_name)] +
+                                         [just_the_name(param) for param in params]))
+
+
 def get_unlocked_tail_call(api, cmd_name):
     # Only the following can generate tail calls:
     #
@@ -3665,7 +3725,8 @@ def main():
         script_name=os.path.basename(sys.argv[0]),
         data_source_name="gl.xml and gl_angle_ext.xml",
         lib="GL/GLES",
-        entry_points_list=",\n".join(["    " + enum for (enum, _) in all_enums]))
+        entry_points_list=",\n".join(["    " + enum for (enum, _) in all_enums]),
+        last_entry_point=all_enums[-1][0])
 
     entry_points_enum_header_path = path_to("common", "entry_points_enum_autogen.h")
     with open(entry_points_enum_header_path, "w") as out:
@@ -10,6 +10,10 @@
 
 #include "common/WorkerThread.h"
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
 #include "common/angleutils.h"
 #include "common/system_utils.h"
 
@@ -20,8 +24,10 @@
 #endif  // !defined(ANGLE_STD_ASYNC_WORKERS) && & !defined(ANGLE_ENABLE_WINDOWS_UWP)
 
 #if ANGLE_DELEGATE_WORKERS || ANGLE_STD_ASYNC_WORKERS
+#    include <atomic>
+#    include <deque>
 #    include <future>
-#    include <queue>
+#    include <random>
 #    include <thread>
 #endif  // ANGLE_DELEGATE_WORKERS || ANGLE_STD_ASYNC_WORKERS
 
@@ -60,16 +66,151 @@ bool AsyncWaitableEvent::isReady()
 WorkerThreadPool::WorkerThreadPool()  = default;
 WorkerThreadPool::~WorkerThreadPool() = default;
 
+// Runs a task on behalf of a WorkerTaskGroup, and lets the group know when it's done.
+class WorkerTaskGroup::Task final : public Closure
+{
+  public:
+    Task(std::shared_ptr<WorkerTaskGroup> &&group, const std::shared_ptr<Closure> &task)
+        : mGroup(std::move(group)), mTask(task)
+    {}
+
+    void operator()() override
+    {
+        (*mTask)();
+        // Release the task before notifying the group, similarly to the worker pools.
+        mTask.reset();
+        mGroup->onTaskDone();
+        mGroup.reset();
+    }
+
+  private:
+    std::shared_ptr<WorkerTaskGroup> mGroup;
+    std::shared_ptr<Closure> mTask;
+};
+
+WorkerTaskGroup::WorkerTaskGroup()  = default;
+WorkerTaskGroup::~WorkerTaskGroup() = default;
+
+void WorkerTaskGroup::post(WorkerThreadPool *pool,
+                           const std::shared_ptr<Closure> &task,
+                           WorkerTaskPriority priority)
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mPendingTaskCount++;
+    }
+    // The returned event is not needed; the group tracks completion itself.
+    pool->postWorkerTask(std::make_shared<Task>(shared_from_this(), task), priority);
+}
+
+void WorkerTaskGroup::onTaskDone()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    ASSERT(mPendingTaskCount > 0);
+    if (--mPendingTaskCount == 0)
+    {
+        mCondition.notify_all();
+    }
+}
+
+void WorkerTaskGroup::wait()
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+    mCondition.wait(lock, [this] { return mPendingTaskCount == 0; });
+}
+
+bool WorkerTaskGroup::isReady()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mPendingTaskCount == 0;
+}
+
+namespace
+{
+// The state shared by the caller of RunParallelJobs and its helper tasks.  Every participant takes
+// the next job until there are none left.  The caller only waits for the jobs to be done, not for
+// the helpers to run, so a helper that starts late finds no job and returns without touching the
+// caller's state.
+class ParallelJobs final : public Closure
+{
+  public:
+    ParallelJobs(size_t jobCount, const std::function<void(size_t)> &runJob)
+        : mJobCount(jobCount), mRunJob(runJob), mNextJob(0), mDoneJobCount(0)
+    {}
+
+    void operator()() override
+    {
+        for (size_t job = mNextJob++; job < mJobCount; job = mNextJob++)
+        {
+            mRunJob(job);
+            if (++mDoneJobCount == mJobCount)
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                mCondition.notify_all();
+            }
+        }
+    }
+
+    void waitForJobs()
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        mCondition.wait(lock, [this] { return mDoneJobCount == mJobCount; });
+    }
+
+  private:
+    const size_t mJobCount;
+    const std::function<void(size_t)> mRunJob;
+    std::atomic<size_t> mNextJob;
+    std::atomic<size_t> mDoneJobCount;
+
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+};
+}  // anonymous namespace
+
+void RunParallelJobs(WorkerThreadPool *pool,
+                     size_t jobCount,
+                     const std::function<void(size_t)> &runJob)
+{
+    size_t helperCount = 0;
+    if (pool != nullptr && pool->isAsync() && jobCount > 1)
+    {
+        const size_t threadCount = std::max(1u, std::thread::hardware_concurrency());
+        helperCount              = std::min(jobCount, threadCount) - 1;
+    }
+
+    if (helperCount == 0)
+    {
+        for (size_t job = 0; job < jobCount; ++job)
+        {
+            runJob(job);
+        }
+        return;
+    }
+
+    auto jobs = std::make_shared<ParallelJobs>(jobCount, runJob);
+    for (size_t helper = 0; helper < helperCount; ++helper)
+    {
+        // The returned events are not waited on; see ParallelJobs.
+        pool->postWorkerTask(jobs, WorkerTaskPriority::High);
+    }
+
+    (*jobs)();
+    jobs->waitForJobs();
+}
+
 class SingleThreadedWorkerPool final : public WorkerThreadPool
 {
   public:
-    std::shared_ptr<WaitableEvent> postWorkerTask(const std::shared_ptr<Closure> &task) override;
+    std::shared_ptr<WaitableEvent> postWorkerTask(const std::shared_ptr<Closure> &task,
+                                                  WorkerTaskPriority priority) override;
     bool isAsync() override;
 };
 
 // SingleThreadedWorkerPool implementation.
 std::shared_ptr<WaitableEvent> SingleThreadedWorkerPool::postWorkerTask(
-    const std::shared_ptr<Closure> &task)
+    const std::shared_ptr<Closure> &task,
+    WorkerTaskPriority priority)
 {
     // Thread safety: This function is thread-safe because the task is run on the calling thread
     // itself.
@@ -84,6 +225,11 @@ bool SingleThreadedWorkerPool::isAsync()
 
 #if ANGLE_STD_ASYNC_WORKERS
 
+// A work-stealing pool.  Every thread owns a queue per priority, and posted tasks are spread over
+// the threads' queues round-robin.  A thread looks for High priority work in its own queue, then
+// in a few randomly chosen other queues, before it looks for Low priority work the same way.  This
+// keeps threads from contending on a single lock, and a long background task only ever occupies
+// the thread that picked it up.
 class AsyncWorkerPool final : public WorkerThreadPool
 {
   public:
@@ -91,40 +237,75 @@ class AsyncWorkerPool final : public WorkerThreadPool
 
     ~AsyncWorkerPool() override;
 
-    std::shared_ptr<WaitableEvent> postWorkerTask(const std::shared_ptr<Closure> &task) override;
+    std::shared_ptr<WaitableEvent> postWorkerTask(const std::shared_ptr<Closure> &task,
+                                                  WorkerTaskPriority priority) override;
 
     bool isAsync() override;
 
   private:
-    void createThreads();
+    static constexpr size_t kPriorityCount = static_cast<size_t>(WorkerTaskPriority::EnumCount);
 
     using Task = std::pair<std::shared_ptr<AsyncWaitableEvent>, std::shared_ptr<Closure>>;
 
+    // Number of other threads' queues a thread looks at for each priority before it looks at them
+    // all.
+    static constexpr size_t kStealAttemptCount = 2;
+
+    struct ThreadQueue
+    {
+        std::mutex mutex;  // Protects access to |tasks|
+        std::array<std::deque<Task>, kPriorityCount> tasks;
+        // Size of |tasks|, read without the lock so that empty queues are skipped without locking
+        // them.
+        std::array<std::atomic<size_t>, kPriorityCount> taskCounts = {};
+    };
+
+    void createThreads();
+
+    // Takes the next task of the given priority from |queue|, if any.
+    bool takeTaskFromQueue(ThreadQueue *queue, size_t priority, Task *taskOut);
+    // Takes the next task for the given thread, stealing from the other threads if its own queue
+    // is empty.
+    bool takeTask(size_t threadIndex, std::minstd_rand *random, Task *taskOut);
+
     // Thread's main loop
-    void threadLoop();
-
-    bool mTerminated = false;
-    std::mutex mMutex;                 // Protects access to the fields in this class
-    std::condition_variable mCondVar;  // Signals when work is available in the queue
-    std::queue<Task> mTaskQueue;
-    std::deque<std::thread> mThreads;
-    size_t mDesiredThreadCount;
+    void threadLoop(size_t threadIndex);
+
+    std::vector<std::unique_ptr<ThreadQueue>> mQueues;
+    std::atomic<size_t> mNextQueue;
+    // Number of tasks posted but not yet taken by a thread.
+    std::atomic<size_t> mPendingTaskCount;
+    // Number of threads waiting on |mIdleCondVar|.
+    std::atomic<size_t> mIdleThreadCount;
+    std::atomic<bool> mTerminated;
+
+    std::mutex mIdleMutex;                 // Used with |mIdleCondVar|
+    std::condition_variable mIdleCondVar;  // Signals when work is available or on termination
+    std::once_flag mCreateThreadsOnce;
+    std::vector<std::thread> mThreads;
 };
 
 // AsyncWorkerPool implementation.
 
-AsyncWorkerPool::AsyncWorkerPool(size_t numThreads) : mDesiredThreadCount(numThreads)
+AsyncWorkerPool::AsyncWorkerPool(size_t numThreads)
+    : mNextQueue(0), mPendingTaskCount(0), mIdleThreadCount(0), mTerminated(false)
 {
     ASSERT(numThreads != 0);
+
+    mQueues.reserve(numThreads);
+    for (size_t i = 0; i < numThreads; ++i)
+    {
+        mQueues.push_back(std::make_unique<ThreadQueue>());
+    }
 }
 
 AsyncWorkerPool::~AsyncWorkerPool()
 {
     {
-        std::unique_lock<std::mutex> lock(mMutex);
+        std::unique_lock<std::mutex> lock(mIdleMutex);
         mTerminated = true;
     }
-    mCondVar.notify_all();
+    mIdleCondVar.notify_all();
     for (auto &thread : mThreads)
     {
         ASSERT(thread.get_id() != std::this_thread::get_id());
@@ -134,51 +315,133 @@ AsyncWorkerPool::~AsyncWorkerPool()
 
 void AsyncWorkerPool::createThreads()
 {
-    if (mDesiredThreadCount == mThreads.size())
-    {
-        return;
-    }
     ASSERT(mThreads.empty());
 
-    for (size_t i = 0; i < mDesiredThreadCount; ++i)
+    mThreads.reserve(mQueues.size());
+    for (size_t i = 0; i < mQueues.size(); ++i)
     {
-        mThreads.emplace_back(&AsyncWorkerPool::threadLoop, this);
+        mThreads.emplace_back(&AsyncWorkerPool::threadLoop, this, i);
     }
 }
 
-std::shared_ptr<WaitableEvent> AsyncWorkerPool::postWorkerTask(const std::shared_ptr<Closure> &task)
+std::shared_ptr<WaitableEvent> AsyncWorkerPool::postWorkerTask(const std::shared_ptr<Closure> &task,
+                                                               WorkerTaskPriority priority)
 {
-    // Thread safety: This function is thread-safe because access to |mTaskQueue| is protected by
-    // |mMutex|.
+    ASSERT(priority < WorkerTaskPriority::EnumCount);
+
+    // Thread safety: This function is thread-safe because access to each thread's queue is
+    // protected by its own mutex, and the rest of the state is atomic.
     auto waitable = std::make_shared<AsyncWaitableEvent>();
-    {
-        std::lock_guard<std::mutex> lock(mMutex);
 
-        // Lazily create the threads on first task
-        createThreads();
+    // Lazily create the threads on first task
+    std::call_once(mCreateThreadsOnce, &AsyncWorkerPool::createThreads, this);
+
+    // The count is incremented first so that it never underflows if the task is taken right away.
+    // A thread that sees the task counted before it's queued just looks for it again.
+    mPendingTaskCount++;
+
+    ThreadQueue &queue = *mQueues[mNextQueue.fetch_add(1, std::memory_order_relaxed) %
+                                  mQueues.size()];
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.tasks[static_cast<size_t>(priority)].emplace_back(waitable, task);
+        queue.taskCounts[static_cast<size_t>(priority)]++;
+    }
 
-        mTaskQueue.push(std::make_pair(waitable, task));
+    // Idle threads increment |mIdleThreadCount| before checking |mPendingTaskCount|, so either an
+    // idle thread sees this task, or this sees the idle thread.
+    if (mIdleThreadCount > 0)
+    {
+        std::lock_guard<std::mutex> lock(mIdleMutex);
+        mIdleCondVar.notify_one();
     }
-    mCondVar.notify_one();
     return waitable;
 }
 
-void AsyncWorkerPool::threadLoop()
+bool AsyncWorkerPool::takeTaskFromQueue(ThreadQueue *queue, size_t priority, Task *taskOut)
 {
-    angle::SetCurrentThreadName("ANGLE-Worker");
+    if (queue->taskCounts[priority] == 0)
+    {
+        return false;
+    }
 
-    while (true)
+    // Tasks are taken from the front of the queues, whether by their owner or a thief, so that
+    // tasks of the same priority run roughly in the order they were posted.
+    std::lock_guard<std::mutex> lock(queue->mutex);
+    std::deque<Task> &tasks = queue->tasks[priority];
+    if (tasks.empty())
     {
-        Task task;
+        return false;
+    }
+
+    *taskOut = std::move(tasks.front());
+    tasks.pop_front();
+    queue->taskCounts[priority]--;
+    mPendingTaskCount--;
+    return true;
+}
+
+bool AsyncWorkerPool::takeTask(size_t threadIndex, std::minstd_rand *random, Task *taskOut)
+{
+    if (mPendingTaskCount == 0)
+    {
+        return false;
+    }
+
+    const size_t queueCount = mQueues.size();
+
+    // Look at the thread's own queue, then at a few others chosen at random, so that threads
+    // looking for work don't all go through the queues in the same order.
+    for (size_t priority = 0; priority < kPriorityCount; ++priority)
+    {
+        if (takeTaskFromQueue(mQueues[threadIndex].get(), priority, taskOut))
+        {
+            return true;
+        }
+
+        for (size_t attempt = 0; queueCount > 1 && attempt < kStealAttemptCount; ++attempt)
+        {
+            const size_t victim = (threadIndex + 1 + (*random)() % (queueCount - 1)) % queueCount;
+            if (takeTaskFromQueue(mQueues[victim].get(), priority, taskOut))
+            {
+                return true;
+            }
+        }
+    }
+
+    // The random choices can miss the only queues that have work, so look at every queue before
+    // giving up.  Empty queues are skipped without taking their lock.
+    for (size_t priority = 0; priority < kPriorityCount; ++priority)
+    {
+        for (size_t offset = 1; offset < queueCount; ++offset)
         {
-            std::unique_lock<std::mutex> lock(mMutex);
-            mCondVar.wait(lock, [this] { return !mTaskQueue.empty() || mTerminated; });
-            if (mTerminated)
+            if (takeTaskFromQueue(mQueues[(threadIndex + offset) % queueCount].get(), priority,
+                                  taskOut))
             {
-                return;
+                return true;
             }
-            task = mTaskQueue.front();
-            mTaskQueue.pop();
+        }
+    }
+
+    return false;
+}
+
+void AsyncWorkerPool::threadLoop(size_t threadIndex)
+{
+    angle::SetCurrentThreadName("ANGLE-Worker");
+
+    std::minstd_rand random(static_cast<std::minstd_rand::result_type>(threadIndex + 1));
+
+    while (!mTerminated)
+    {
+        Task task;
+        if (!takeTask(threadIndex, &random, &task))
+        {
+            std::unique_lock<std::mutex> lock(mIdleMutex);
+            mIdleThreadCount++;
+            mIdleCondVar.wait(lock, [this] { return mPendingTaskCount > 0 || mTerminated; });
+            mIdleThreadCount--;
+            continue;
         }
 
         auto &waitable = task.first;
@@ -209,7 +472,8 @@ class DelegateWorkerPool final : public WorkerThreadPool
     DelegateWorkerPool(PlatformMethods *platform) : mPlatform(platform) {}
     ~DelegateWorkerPool() override = default;
 
-    std::shared_ptr<WaitableEvent> postWorkerTask(const std::shared_ptr<Closure> &task) override;
+    std::shared_ptr<WaitableEvent> postWorkerTask(const std::shared_ptr<Closure> &task,
+                                                  WorkerTaskPriority priority) override;
 
     bool isAsync() override;
 
@@ -248,8 +512,10 @@ class DelegateWorkerTask
 
 ANGLE_NO_SANITIZE_CFI_ICALL
 std::shared_ptr<WaitableEvent> DelegateWorkerPool::postWorkerTask(
-    const std::shared_ptr<Closure> &task)
+    const std::shared_ptr<Closure> &task,
+    WorkerTaskPriority priority)
 {
+    // The platform has no notion of priorities, so |priority| is ignored.
     if (mPlatform->postWorkerTask == nullptr)
     {
         // In the unexpected case where the platform methods have been changed during execution and
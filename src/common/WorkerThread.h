@@ -13,6 +13,8 @@
 
 #include <array>
 #include <condition_variable>
+#include <cstddef>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <vector>
@@ -100,6 +102,19 @@ class AsyncWaitableEvent final : public WaitableEvent
     std::condition_variable mCondition;
 };
 
+// Scheduling class of a worker task.  Pools that support priorities don't start a Low priority task
+// while a High priority one is waiting.
+enum class WorkerTaskPriority
+{
+    // Work that a context is likely to block on soon, such as shader compilation and program link.
+    High,
+    // Background work that is rarely waited on, such as compressing and storing caches.
+    Low,
+
+    InvalidEnum,
+    EnumCount = InvalidEnum,
+};
+
 // Request WorkerThreads from the WorkerThreadPool. Each pool can keep worker threads around so
 // we avoid the costly spin up and spin down time.
 class WorkerThreadPool : angle::NonCopyable
@@ -118,13 +133,55 @@ class WorkerThreadPool : angle::NonCopyable
 
     // Returns an event to wait on for the task to finish.  If the pool fails to create the task,
     // returns null.  This function is thread-safe.
-    virtual std::shared_ptr<WaitableEvent> postWorkerTask(const std::shared_ptr<Closure> &task) = 0;
+    std::shared_ptr<WaitableEvent> postWorkerTask(const std::shared_ptr<Closure> &task)
+    {
+        return postWorkerTask(task, WorkerTaskPriority::High);
+    }
+
+    // Same as above, with a scheduling class for the task.  Pools that can't prioritize tasks run
+    // them in the order they are posted.
+    virtual std::shared_ptr<WaitableEvent> postWorkerTask(const std::shared_ptr<Closure> &task,
+                                                          WorkerTaskPriority priority) = 0;
 
     virtual bool isAsync() = 0;
 
   private:
 };
 
+// A set of tasks that can be waited on as a unit.  Tasks can be added from any thread at any time,
+// including from tasks in the same group; the group is ready when every task posted so far has
+// finished.  Must be created with std::make_shared.
+class WorkerTaskGroup final : public WaitableEvent,
+                              public std::enable_shared_from_this<WorkerTaskGroup>
+{
+  public:
+    WorkerTaskGroup();
+    ~WorkerTaskGroup() override;
+
+    void post(WorkerThreadPool *pool,
+              const std::shared_ptr<Closure> &task,
+              WorkerTaskPriority priority);
+
+    void wait() override;
+    bool isReady() override;
+
+  private:
+    class Task;
+    void onTaskDone();
+
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    size_t mPendingTaskCount = 0;
+};
+
+// Runs |jobCount| jobs, in parallel if |pool| is asynchronous.  The calling thread takes jobs too,
+// and only waits for the jobs that helpers have started, so this returns as soon as every job is
+// done even if the pool is busy with other tasks, or if it's called from a pool thread.  |runJob|
+// may refer to the caller's stack, as it's not called after this returns.  |pool| may be null.
+void RunParallelJobs(WorkerThreadPool *pool,
+                     size_t jobCount,
+                     const std::function<void(size_t)> &runJob);
+
 }  // namespace angle
 
 #endif  // COMMON_WORKER_THREAD_H_
@@ -8,6 +8,8 @@
 
 #include <gtest/gtest.h>
 #include <array>
+#include <atomic>
+#include <thread>
 
 #include "common/WorkerThread.h"
 
@@ -16,6 +18,27 @@ using namespace angle;
 namespace
 {
 
+// Keeps a pool thread busy until released.
+class BlockingTask : public Closure
+{
+  public:
+    BlockingTask(std::atomic<size_t> *startedCount, std::atomic<bool> *released)
+        : mStartedCount(startedCount), mReleased(released)
+    {}
+    void operator()() override
+    {
+        (*mStartedCount)++;
+        while (!*mReleased)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+  private:
+    std::atomic<size_t> *mStartedCount;
+    std::atomic<bool> *mReleased;
+};
+
 // Tests simple worker pool application.
 TEST(WorkerPoolTest, SimpleTask)
 {
@@ -48,4 +71,219 @@ TEST(WorkerPoolTest, SimpleTask)
     }
 }
 
+// Tests that a task group is ready only once all its tasks, including ones posted by other tasks
+// in the group, have finished.
+TEST(WorkerPoolTest, TaskGroup)
+{
+    constexpr size_t kTaskCount = 64;
+
+    class CountingTask : public Closure
+    {
+      public:
+        CountingTask(std::atomic<size_t> *counter) : mCounter(counter) {}
+        void operator()() override { (*mCounter)++; }
+
+      private:
+        std::atomic<size_t> *mCounter;
+    };
+
+    class SpawningTask : public Closure
+    {
+      public:
+        SpawningTask(WorkerThreadPool *pool,
+                     std::shared_ptr<WorkerTaskGroup> group,
+                     std::atomic<size_t> *counter)
+            : mPool(pool), mGroup(group), mCounter(counter)
+        {}
+        void operator()() override
+        {
+            mGroup->post(mPool, std::make_shared<CountingTask>(mCounter), WorkerTaskPriority::Low);
+            (*mCounter)++;
+        }
+
+      private:
+        WorkerThreadPool *mPool;
+        std::shared_ptr<WorkerTaskGroup> mGroup;
+        std::atomic<size_t> *mCounter;
+    };
+
+    std::array<std::shared_ptr<WorkerThreadPool>, 2> pools = {
+        {WorkerThreadPool::Create(1, ANGLEPlatformCurrent()),
+         WorkerThreadPool::Create(0, ANGLEPlatformCurrent())}};
+    for (auto &pool : pools)
+    {
+        std::atomic<size_t> counter(0);
+        auto group = std::make_shared<WorkerTaskGroup>();
+        EXPECT_TRUE(group->isReady());
+
+        for (size_t i = 0; i < kTaskCount; ++i)
+        {
+            group->post(pool.get(), std::make_shared<SpawningTask>(pool.get(), group, &counter),
+                        WorkerTaskPriority::High);
+        }
+
+        group->wait();
+        EXPECT_TRUE(group->isReady());
+        EXPECT_EQ(2 * kTaskCount, counter);
+    }
+}
+
+// Tests that RunParallelJobs runs every job exactly once, with and without a pool.
+TEST(WorkerPoolTest, RunParallelJobs)
+{
+    constexpr size_t kJobCount = 1000;
+
+    std::array<std::shared_ptr<WorkerThreadPool>, 3> pools = {
+        {nullptr, WorkerThreadPool::Create(1, ANGLEPlatformCurrent()),
+         WorkerThreadPool::Create(0, ANGLEPlatformCurrent())}};
+    for (auto &pool : pools)
+    {
+        std::array<std::atomic<size_t>, kJobCount> runCounts = {};
+        RunParallelJobs(pool.get(), kJobCount, [&](size_t job) { runCounts[job]++; });
+
+        for (const std::atomic<size_t> &runCount : runCounts)
+        {
+            EXPECT_EQ(1u, runCount);
+        }
+    }
+}
+
+// Tests that RunParallelJobs returns once its jobs are done, without waiting for a busy pool to run
+// the helper tasks it posted, whether it's called from the application or from a pool thread.
+TEST(WorkerPoolTest, RunParallelJobsWithBusyPool)
+{
+    constexpr size_t kThreadCount = 2;
+    constexpr size_t kJobCount    = 100;
+
+    std::shared_ptr<WorkerThreadPool> pool =
+        WorkerThreadPool::Create(kThreadCount, ANGLEPlatformCurrent());
+    if (!pool->isAsync())
+    {
+        GTEST_SKIP() << "Test requires a multithreaded pool";
+    }
+
+    std::atomic<size_t> startedCount(0);
+    std::atomic<bool> released(false);
+    std::vector<std::shared_ptr<WaitableEvent>> waitables;
+    for (size_t i = 0; i < kThreadCount; ++i)
+    {
+        waitables.push_back(pool->postWorkerTask(
+            std::make_shared<BlockingTask>(&startedCount, &released), WorkerTaskPriority::High));
+    }
+    while (startedCount < kThreadCount)
+    {
+        std::this_thread::yield();
+    }
+
+    std::array<std::atomic<size_t>, kJobCount> runCounts = {};
+    RunParallelJobs(pool.get(), kJobCount, [&](size_t job) { runCounts[job]++; });
+    for (const std::atomic<size_t> &runCount : runCounts)
+    {
+        EXPECT_EQ(1u, runCount);
+    }
+
+    released = true;
+    WaitableEvent::WaitMany(&waitables);
+    waitables.clear();
+
+    // Call it from a pool thread while the other thread is blocked.
+    class NestedJobsTask : public Closure
+    {
+      public:
+        NestedJobsTask(WorkerThreadPool *pool, std::array<std::atomic<size_t>, kJobCount> *counts)
+            : mPool(pool), mCounts(counts)
+        {}
+        void operator()() override
+        {
+            RunParallelJobs(mPool, kJobCount, [this](size_t job) { (*mCounts)[job]++; });
+        }
+
+      private:
+        WorkerThreadPool *mPool;
+        std::array<std::atomic<size_t>, kJobCount> *mCounts;
+    };
+
+    startedCount = 0;
+    released     = false;
+    waitables.push_back(pool->postWorkerTask(
+        std::make_shared<BlockingTask>(&startedCount, &released), WorkerTaskPriority::High));
+    while (startedCount < 1)
+    {
+        std::this_thread::yield();
+    }
+
+    std::array<std::atomic<size_t>, kJobCount> nestedRunCounts = {};
+    pool->postWorkerTask(std::make_shared<NestedJobsTask>(pool.get(), &nestedRunCounts),
+                         WorkerTaskPriority::High)
+        ->wait();
+    for (const std::atomic<size_t> &runCount : nestedRunCounts)
+    {
+        EXPECT_EQ(1u, runCount);
+    }
+
+    released = true;
+    WaitableEvent::WaitMany(&waitables);
+}
+
+// Tests that High priority tasks are started before Low priority tasks posted earlier.
+TEST(WorkerPoolTest, HighPriorityFirst)
+{
+    constexpr size_t kThreadCount  = 2;
+    constexpr size_t kLowTaskCount = 32;
+
+    std::shared_ptr<WorkerThreadPool> pool =
+        WorkerThreadPool::Create(kThreadCount, ANGLEPlatformCurrent());
+    if (!pool->isAsync())
+    {
+        GTEST_SKIP() << "Test requires a multithreaded pool";
+    }
+
+    // Records the order in which tasks start.
+    class OrderedTask : public Closure
+    {
+      public:
+        OrderedTask(std::atomic<size_t> *nextIndex) : mNextIndex(nextIndex) {}
+        void operator()() override
+        {
+            index = (*mNextIndex)++;
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        size_t index = 0;
+
+      private:
+        std::atomic<size_t> *mNextIndex;
+    };
+
+    // Keep every thread busy, so that all the other tasks are queued up first.
+    std::atomic<size_t> startedCount(0);
+    std::atomic<bool> released(false);
+    std::vector<std::shared_ptr<WaitableEvent>> waitables;
+    for (size_t i = 0; i < kThreadCount; ++i)
+    {
+        waitables.push_back(pool->postWorkerTask(
+            std::make_shared<BlockingTask>(&startedCount, &released), WorkerTaskPriority::High));
+    }
+    while (startedCount < kThreadCount)
+    {
+        std::this_thread::yield();
+    }
+
+    std::atomic<size_t> nextIndex(0);
+    for (size_t i = 0; i < kLowTaskCount; ++i)
+    {
+        waitables.push_back(pool->postWorkerTask(std::make_shared<OrderedTask>(&nextIndex),
+                                                 WorkerTaskPriority::Low));
+    }
+    auto highTask = std::make_shared<OrderedTask>(&nextIndex);
+    waitables.push_back(pool->postWorkerTask(highTask, WorkerTaskPriority::High));
+
+    released = true;
+    WaitableEvent::WaitMany(&waitables);
+
+    // In FIFO order, the High priority task would be among the last to start.  Allow some slack for
+    // the threads being descheduled.
+    EXPECT_LT(highTask->index, kLowTaskCount / 2);
+}
+
 }  // anonymous namespace
@@ -161,7 +161,12 @@ struct PerfMonitorTriplet
     FN(bufferSuballocationCalls)                   \
     FN(dynamicBufferAllocations)                   \
     FN(framebufferCacheSize)                       \
-    FN(pendingSubmissionGarbageObjects)
+    FN(pendingSubmissionGarbageObjects)            \
+    FN(bufferBytesUploaded)                        \
+    FN(textureBytesUploaded)                       \
+    FN(redundantStateCommandsSkipped)              \
+    FN(vertexBytesConvertedOnCPU)                  \
+    FN(ghostedBufferBytesSkipped)
 
 #define ANGLE_DECLARE_PERF_COUNTER(COUNTER) uint64_t COUNTER;
 
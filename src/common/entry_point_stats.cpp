@@ -0,0 +1,121 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// entry_point_stats.cpp:
+//   Call counts and latency histograms of the GL and EGL entry points.
+//
+
+#include "common/entry_point_stats.h"
+
+#include <algorithm>
+#include <mutex>
+
+#include "common/debug.h"
+#include "common/mathutil.h"
+
+namespace angle
+{
+namespace priv
+{
+std::atomic<bool> gEntryPointStatsEnabled(false);
+}  // namespace priv
+
+namespace
+{
+struct EntryPointCounters
+{
+    std::atomic<uint64_t> callCount;
+    std::atomic<uint64_t> totalNs;
+    std::atomic<uint64_t> maxNs;
+    std::array<std::atomic<uint64_t>, kEntryPointLatencyBucketCount> latencyHistogram;
+};
+
+// Allocated when the stats are first enabled, and intentionally leaked so entry points called
+// during process exit can still record into it.  The enabled flag is checked with a relaxed load on
+// every call, so a thread may see it set before it sees the counters.
+std::atomic<EntryPointCounters *> gEntryPointCounters(nullptr);
+
+size_t GetLatencyBucket(uint64_t durationNs)
+{
+    if (durationNs == 0)
+    {
+        return 0;
+    }
+    return std::min<size_t>(gl::ScanReverse(durationNs) + 1, kEntryPointLatencyBucketCount - 1);
+}
+}  // anonymous namespace
+
+void EnableEntryPointStats()
+{
+    static std::once_flag sOnce;
+    std::call_once(sOnce, []() {
+        // Value-initialization zeroes the atomics.
+        gEntryPointCounters.store(new EntryPointCounters[kEntryPointCount](),
+                                  std::memory_order_release);
+        priv::gEntryPointStatsEnabled.store(true, std::memory_order_relaxed);
+    });
+}
+
+void RecordEntryPointCall(EntryPoint entryPoint, uint64_t durationNs)
+{
+    ASSERT(static_cast<int>(entryPoint) < kEntryPointCount);
+    EntryPointCounters *allCounters = gEntryPointCounters.load(std::memory_order_acquire);
+    if (allCounters == nullptr)
+    {
+        return;
+    }
+    EntryPointCounters &counters = allCounters[static_cast<size_t>(entryPoint)];
+
+    counters.callCount.fetch_add(1, std::memory_order_relaxed);
+    counters.totalNs.fetch_add(durationNs, std::memory_order_relaxed);
+    counters.latencyHistogram[GetLatencyBucket(durationNs)].fetch_add(1,
+                                                                      std::memory_order_relaxed);
+
+    uint64_t maxNs = counters.maxNs.load(std::memory_order_relaxed);
+    while (durationNs > maxNs &&
+           !counters.maxNs.compare_exchange_weak(maxNs, durationNs, std::memory_order_relaxed))
+    {
+    }
+}
+
+std::vector<EntryPointStats> GetEntryPointStats()
+{
+    std::vector<EntryPointStats> stats;
+    const EntryPointCounters *allCounters = gEntryPointCounters.load(std::memory_order_acquire);
+    if (allCounters == nullptr)
+    {
+        return stats;
+    }
+
+    for (int index = 0; index < kEntryPointCount; ++index)
+    {
+        const EntryPointCounters &counters = allCounters[index];
+        const uint64_t callCount           = counters.callCount.load(std::memory_order_relaxed);
+        if (callCount == 0)
+        {
+            continue;
+        }
+
+        EntryPointStats entry;
+        entry.entryPoint = static_cast<EntryPoint>(index);
+        entry.callCount  = callCount;
+        entry.totalNs    = counters.totalNs.load(std::memory_order_relaxed);
+        entry.maxNs      = counters.maxNs.load(std::memory_order_relaxed);
+        for (size_t bucket = 0; bucket < kEntryPointLatencyBucketCount; ++bucket)
+        {
+            entry.latencyHistogram[bucket] =
+                counters.latencyHistogram[bucket].load(std::memory_order_relaxed);
+        }
+        stats.push_back(entry);
+    }
+    return stats;
+}
+
+void ScopedEntryPointTimer::record()
+{
+    const std::chrono::nanoseconds duration = std::chrono::steady_clock::now() - mStart;
+    RecordEntryPointCall(mEntryPoint, static_cast<uint64_t>(duration.count()));
+}
+}  // namespace angle
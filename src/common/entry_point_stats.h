@@ -0,0 +1,85 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// entry_point_stats.h:
+//   Call counts and latency histograms of the GL and EGL entry points.
+//
+
+#ifndef COMMON_ENTRY_POINT_STATS_H_
+#define COMMON_ENTRY_POINT_STATS_H_
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <vector>
+
+#include "common/angleutils.h"
+#include "common/entry_points_enum_autogen.h"
+
+namespace angle
+{
+// Bucket |i| of a latency histogram counts the calls that took less than 2^i nanoseconds, and at
+// least 2^(i-1).  The last bucket also counts all the longer calls.
+constexpr size_t kEntryPointLatencyBucketCount = 36;
+
+struct EntryPointStats
+{
+    EntryPoint entryPoint;
+    uint64_t callCount;
+    uint64_t totalNs;
+    uint64_t maxNs;
+    std::array<uint64_t, kEntryPointLatencyBucketCount> latencyHistogram;
+};
+
+namespace priv
+{
+extern std::atomic<bool> gEntryPointStatsEnabled;
+}  // namespace priv
+
+// Stats are recorded from the moment they are enabled, by every thread.  They can't be disabled
+// again.
+void EnableEntryPointStats();
+ANGLE_INLINE bool AreEntryPointStatsEnabled()
+{
+    // Checked by every entry point.  The recording synchronizes with the enabling on its own.
+    return priv::gEntryPointStatsEnabled.load(std::memory_order_relaxed);
+}
+
+void RecordEntryPointCall(EntryPoint entryPoint, uint64_t durationNs);
+
+// Returns the stats of the entry points that were called at least once.  Calls made concurrently
+// may be partially included.
+std::vector<EntryPointStats> GetEntryPointStats();
+
+// Records the time spent in an entry point, if enabled.
+class [[nodiscard]] ScopedEntryPointTimer : angle::NonCopyable
+{
+  public:
+    ANGLE_INLINE explicit ScopedEntryPointTimer(EntryPoint entryPoint)
+        : mEntryPoint(entryPoint), mEnabled(AreEntryPointStatsEnabled())
+    {
+        if (ANGLE_UNLIKELY(mEnabled))
+        {
+            mStart = std::chrono::steady_clock::now();
+        }
+    }
+    ANGLE_INLINE ~ScopedEntryPointTimer()
+    {
+        if (ANGLE_UNLIKELY(mEnabled))
+        {
+            record();
+        }
+    }
+
+  private:
+    void record();
+
+    const EntryPoint mEntryPoint;
+    const bool mEnabled;
+    std::chrono::steady_clock::time_point mStart;
+};
+}  // namespace angle
+
+#endif  // COMMON_ENTRY_POINT_STATS_H_
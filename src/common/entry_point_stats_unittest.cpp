@@ -0,0 +1,104 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// entry_point_stats_unittest:
+//   Tests of the entry point call counts and latency histograms.
+//
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "common/entry_point_stats.h"
+
+using namespace angle;
+
+namespace
+{
+// The stats are global, so the tests only look at how they change.
+EntryPointStats GetStats(EntryPoint entryPoint)
+{
+    EntryPointStats result = {};
+    result.entryPoint      = entryPoint;
+    for (const EntryPointStats &stats : GetEntryPointStats())
+    {
+        if (stats.entryPoint == entryPoint)
+        {
+            result = stats;
+        }
+    }
+    return result;
+}
+
+// Tests that calls are counted and sorted into the right latency buckets.
+TEST(EntryPointStatsTest, Histogram)
+{
+    EnableEntryPointStats();
+    ASSERT_TRUE(AreEntryPointStatsEnabled());
+
+    const EntryPointStats before = GetStats(EntryPoint::GLBlendBarrier);
+
+    RecordEntryPointCall(EntryPoint::GLBlendBarrier, 0);
+    RecordEntryPointCall(EntryPoint::GLBlendBarrier, 1);
+    RecordEntryPointCall(EntryPoint::GLBlendBarrier, 1000);
+    RecordEntryPointCall(EntryPoint::GLBlendBarrier, 1023);
+    RecordEntryPointCall(EntryPoint::GLBlendBarrier, uint64_t(1) << 50);
+
+    const EntryPointStats after = GetStats(EntryPoint::GLBlendBarrier);
+    EXPECT_EQ(after.callCount - before.callCount, 5u);
+    EXPECT_EQ(after.totalNs - before.totalNs, 2024u + (uint64_t(1) << 50));
+    EXPECT_EQ(after.maxNs, uint64_t(1) << 50);
+    EXPECT_EQ(after.latencyHistogram[0] - before.latencyHistogram[0], 1u);
+    EXPECT_EQ(after.latencyHistogram[1] - before.latencyHistogram[1], 1u);
+    EXPECT_EQ(after.latencyHistogram[10] - before.latencyHistogram[10], 2u);
+    EXPECT_EQ(after.latencyHistogram[kEntryPointLatencyBucketCount - 1] -
+                  before.latencyHistogram[kEntryPointLatencyBucketCount - 1],
+              1u);
+}
+
+// Tests that the timer records the call into its entry point.
+TEST(EntryPointStatsTest, ScopedTimer)
+{
+    EnableEntryPointStats();
+
+    const EntryPointStats before = GetStats(EntryPoint::GLFinish);
+    {
+        ScopedEntryPointTimer timer(EntryPoint::GLFinish);
+    }
+    const EntryPointStats after = GetStats(EntryPoint::GLFinish);
+    EXPECT_EQ(after.callCount - before.callCount, 1u);
+}
+
+// Tests that calls made from multiple threads are all counted.
+TEST(EntryPointStatsTest, MultiThreaded)
+{
+    EnableEntryPointStats();
+
+    constexpr size_t kThreadCount = 4;
+    constexpr size_t kCallCount   = 10000;
+
+    const EntryPointStats before = GetStats(EntryPoint::GLFlush);
+
+    std::vector<std::thread> threads;
+    for (size_t threadIndex = 0; threadIndex < kThreadCount; ++threadIndex)
+    {
+        threads.emplace_back([threadIndex]() {
+            for (size_t call = 0; call < kCallCount; ++call)
+            {
+                RecordEntryPointCall(EntryPoint::GLFlush, threadIndex + 1);
+            }
+        });
+    }
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    const EntryPointStats after = GetStats(EntryPoint::GLFlush);
+    EXPECT_EQ(after.callCount - before.callCount, kThreadCount * kCallCount);
+    EXPECT_EQ(after.totalNs - before.totalNs, (1 + 2 + 3 + 4) * kCallCount);
+    EXPECT_GE(after.maxNs, kThreadCount);
+}
+}  // anonymous namespace
@@ -1086,6 +1086,9 @@ enum class EntryPoint
     GLWeightPointerOES
 };
 
+// The number of entry points, including Invalid.
+constexpr int kEntryPointCount = static_cast<int>(EntryPoint::GLWeightPointerOES) + 1;
+
 const char *GetEntryPointName(EntryPoint ep);
 }  // namespace angle
 #endif  // COMMON_ENTRY_POINTS_ENUM_AUTOGEN_H_
@@ -20,6 +20,7 @@
 #include <string>
 
 #include "common/angleutils.h"
+#include "common/entry_point_stats.h"
 #include "common/entry_points_enum_autogen.h"
 #include "common/platform.h"
 
@@ -215,10 +216,15 @@ std::ostream &FmtHex(std::ostream &os, T value)
 #define ERR() ANGLE_LOG(ERR)
 #define FATAL() ANGLE_LOG(FATAL)
 
+// Records the latency of an entry point when entry point stats are enabled.
+#define ANGLE_ENTRY_POINT_TIMER(entryPoint) \
+    angle::ScopedEntryPointTimer scopedEntryPointTimer(angle::EntryPoint::entryPoint)
+
 // A macro to log a performance event around a scope.
 #if defined(ANGLE_TRACE_ENABLED)
 #    if defined(_MSC_VER)
 #        define EVENT(context, entryPoint, message, ...)                                     \
+            ANGLE_ENTRY_POINT_TIMER(entryPoint);                                             \
             gl::ScopedPerfEventHelper scopedPerfEventHelper##__LINE__(                       \
                 context, angle::EntryPoint::entryPoint);                                     \
             do                                                                               \
@@ -232,6 +238,7 @@ std::ostream &FmtHex(std::ostream &os, T value)
             } while (0)
 #    else
 #        define EVENT(context, entryPoint, message, ...)                                          \
+            ANGLE_ENTRY_POINT_TIMER(entryPoint);                                                  \
             gl::ScopedPerfEventHelper scopedPerfEventHelper(context,                              \
                                                             angle::EntryPoint::entryPoint);       \
             do                                                                                    \
@@ -245,7 +252,7 @@ std::ostream &FmtHex(std::ostream &os, T value)
             } while (0)
 #    endif  // _MSC_VER
 #else
-#    define EVENT(message, ...) (void(0))
+#    define EVENT(context, entryPoint, message, ...) ANGLE_ENTRY_POINT_TIMER(entryPoint)
 #endif
 
 // Note that gSwallowStream is used instead of an arbitrary LOG() stream to avoid the creation of an
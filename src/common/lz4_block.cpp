@@ -0,0 +1,258 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// lz4_block.cpp: Implements the LZ4 block format encoder and decoder.
+//
+// A block is a series of sequences.  Each sequence is:
+//
+//   token | [literal length bytes] | literals | match offset | [match length bytes]
+//
+// The token's high nibble is the literal count and its low nibble the match length minus 4.  A
+// nibble of 15 is continued by bytes that are added to it, until one that is less than 255.  The
+// match offset is a little-endian 16-bit distance back into the decoded output.  The last sequence
+// only has literals.
+
+#include "common/lz4_block.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "common/debug.h"
+
+namespace angle
+{
+namespace
+{
+constexpr size_t kMinMatch = 4;
+// The last match must start at least this many bytes before the end of the input, and the last
+// bytes are always literals.  These limits are part of the format and let a decoder copy in
+// 8-byte chunks.
+constexpr size_t kMatchSearchLimit = 12;
+constexpr size_t kLastLiterals     = 5;
+constexpr size_t kMaxOffset        = 65535;
+constexpr uint32_t kHashBits       = 12;
+constexpr uint32_t kRunMask        = 15;
+
+ANGLE_INLINE uint32_t Read32(const uint8_t *ptr)
+{
+    uint32_t value;
+    memcpy(&value, ptr, sizeof(value));
+    return value;
+}
+
+ANGLE_INLINE uint32_t Hash(uint32_t sequence)
+{
+    return (sequence * 2654435761u) >> (32 - kHashBits);
+}
+
+ANGLE_INLINE uint8_t *WriteLength(uint8_t *out, size_t length)
+{
+    while (length >= 255)
+    {
+        *out++ = 255;
+        length -= 255;
+    }
+    *out++ = static_cast<uint8_t>(length);
+    return out;
+}
+
+ANGLE_INLINE uint8_t *WriteSequence(uint8_t *out,
+                                    const uint8_t *literals,
+                                    size_t literalCount,
+                                    size_t matchLength,
+                                    size_t offset)
+{
+    uint8_t *token = out++;
+    *token         = static_cast<uint8_t>(std::min<size_t>(literalCount, kRunMask) << 4);
+    if (literalCount >= kRunMask)
+    {
+        out = WriteLength(out, literalCount - kRunMask);
+    }
+    memcpy(out, literals, literalCount);
+    out += literalCount;
+
+    if (matchLength == 0)
+    {
+        return out;
+    }
+
+    ASSERT(matchLength >= kMinMatch && offset > 0 && offset <= kMaxOffset);
+    *out++ = static_cast<uint8_t>(offset);
+    *out++ = static_cast<uint8_t>(offset >> 8);
+
+    const size_t matchCode = matchLength - kMinMatch;
+    *token |= static_cast<uint8_t>(std::min<size_t>(matchCode, kRunMask));
+    if (matchCode >= kRunMask)
+    {
+        out = WriteLength(out, matchCode - kRunMask);
+    }
+    return out;
+}
+
+ANGLE_INLINE bool ReadLength(const uint8_t **in, const uint8_t *inEnd, size_t *length)
+{
+    uint8_t byte;
+    do
+    {
+        if (*in >= inEnd)
+        {
+            return false;
+        }
+        byte = *(*in)++;
+        *length += byte;
+    } while (byte == 255);
+    return true;
+}
+}  // anonymous namespace
+
+size_t LZ4BlockCompressBound(size_t inputSize)
+{
+    return inputSize + inputSize / 255 + 16;
+}
+
+size_t LZ4BlockCompress(const uint8_t *input, size_t inputSize, uint8_t *output)
+{
+    uint8_t *out = output;
+
+    if (inputSize < kMatchSearchLimit + 1)
+    {
+        return WriteSequence(out, input, inputSize, 0, 0) - output;
+    }
+
+    // Positions are stored relative to |input|.  Unset, stale or colliding entries are harmless,
+    // they just fail the match check.
+    uint32_t hashTable[1 << kHashBits] = {};
+
+    const uint8_t *const matchLimit = input + inputSize - kMatchSearchLimit;
+    const uint8_t *const matchEnd   = input + inputSize - kLastLiterals;
+    const uint8_t *literalStart     = input;
+    const uint8_t *in               = input + 1;
+
+    while (in < matchLimit)
+    {
+        const uint32_t sequence  = Read32(in);
+        const uint32_t hash      = Hash(sequence);
+        const uint8_t *candidate = input + hashTable[hash];
+        hashTable[hash]          = static_cast<uint32_t>(in - input);
+
+        if (candidate >= in || static_cast<size_t>(in - candidate) > kMaxOffset ||
+            Read32(candidate) != sequence)
+        {
+            // Skip ahead faster through data that doesn't compress.
+            in += 1 + ((in - literalStart) >> 6);
+            continue;
+        }
+
+        // Extend the match backwards into the pending literals, then forwards.
+        while (in > literalStart && candidate > input && in[-1] == candidate[-1])
+        {
+            --in;
+            --candidate;
+        }
+
+        const uint8_t *matchStart = in;
+        const size_t offset       = static_cast<size_t>(in - candidate);
+        in += kMinMatch;
+        candidate += kMinMatch;
+        while (in < matchEnd && *in == *candidate)
+        {
+            ++in;
+            ++candidate;
+        }
+
+        out = WriteSequence(out, literalStart, static_cast<size_t>(matchStart - literalStart),
+                            static_cast<size_t>(in - matchStart), offset);
+        literalStart = in;
+
+        // Seed the table with a position inside the match to help the next search.
+        if (in - 2 > input && in < matchLimit)
+        {
+            hashTable[Hash(Read32(in - 2))] = static_cast<uint32_t>(in - 2 - input);
+        }
+    }
+
+    out = WriteSequence(out, literalStart, static_cast<size_t>(input + inputSize - literalStart), 0,
+                        0);
+
+    ASSERT(static_cast<size_t>(out - output) <= LZ4BlockCompressBound(inputSize));
+    return static_cast<size_t>(out - output);
+}
+
+bool LZ4BlockDecompress(const uint8_t *input,
+                        size_t inputSize,
+                        uint8_t *output,
+                        size_t outputSize)
+{
+    const uint8_t *in          = input;
+    const uint8_t *const inEnd = input + inputSize;
+    uint8_t *out               = output;
+    uint8_t *const outEnd      = output + outputSize;
+
+    while (in < inEnd)
+    {
+        const uint8_t token = *in++;
+
+        size_t literalCount = token >> 4;
+        if (literalCount == kRunMask && !ReadLength(&in, inEnd, &literalCount))
+        {
+            return false;
+        }
+        if (literalCount > static_cast<size_t>(inEnd - in) ||
+            literalCount > static_cast<size_t>(outEnd - out))
+        {
+            return false;
+        }
+        memcpy(out, in, literalCount);
+        in += literalCount;
+        out += literalCount;
+
+        // The last sequence has no match.
+        if (in == inEnd)
+        {
+            break;
+        }
+
+        if (inEnd - in < 2)
+        {
+            return false;
+        }
+        const size_t offset = in[0] | (in[1] << 8);
+        in += 2;
+        if (offset == 0 || offset > static_cast<size_t>(out - output))
+        {
+            return false;
+        }
+
+        size_t matchLength = token & kRunMask;
+        if (matchLength == kRunMask && !ReadLength(&in, inEnd, &matchLength))
+        {
+            return false;
+        }
+        matchLength += kMinMatch;
+        if (matchLength > static_cast<size_t>(outEnd - out))
+        {
+            return false;
+        }
+
+        // Matches may overlap the bytes they produce (e.g. offset 1 repeats a byte), so copy
+        // forwards one byte at a time unless the source is far enough behind.
+        const uint8_t *match = out - offset;
+        if (offset >= matchLength)
+        {
+            memcpy(out, match, matchLength);
+            out += matchLength;
+        }
+        else
+        {
+            for (size_t i = 0; i < matchLength; ++i)
+            {
+                *out++ = *match++;
+            }
+        }
+    }
+
+    return out == outEnd;
+}
+}  // namespace angle
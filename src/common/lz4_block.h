@@ -0,0 +1,34 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// lz4_block.h: A small, dependency-free encoder and decoder for the LZ4 block format.  This trades
+//   compression ratio for speed; both directions are several times faster than deflate/inflate.
+//   The encoder is a greedy single-probe matcher, so its output is valid LZ4 but not byte-identical
+//   to the reference implementation.
+
+#ifndef COMMON_LZ4_BLOCK_H_
+#define COMMON_LZ4_BLOCK_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace angle
+{
+// Returns the largest possible size of an LZ4 block encoding |inputSize| bytes.
+size_t LZ4BlockCompressBound(size_t inputSize);
+
+// Encodes |inputSize| bytes from |input| into |output|, which must be at least
+// LZ4BlockCompressBound(inputSize) bytes.  Returns the number of bytes written.
+size_t LZ4BlockCompress(const uint8_t *input, size_t inputSize, uint8_t *output);
+
+// Decodes an LZ4 block into |output|.  Returns false if the block is malformed or would decode to
+// anything other than exactly |outputSize| bytes.  Never reads or writes out of bounds.
+bool LZ4BlockDecompress(const uint8_t *input,
+                        size_t inputSize,
+                        uint8_t *output,
+                        size_t outputSize);
+}  // namespace angle
+
+#endif  // COMMON_LZ4_BLOCK_H_
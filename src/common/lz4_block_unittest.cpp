@@ -0,0 +1,114 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// lz4_block_unittest.cpp: Unit tests for the LZ4 block encoder and decoder.
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "common/lz4_block.h"
+
+namespace angle
+{
+namespace
+{
+std::vector<uint8_t> RoundTrip(const std::vector<uint8_t> &input, size_t *compressedSizeOut)
+{
+    std::vector<uint8_t> compressed(LZ4BlockCompressBound(input.size()));
+    const size_t compressedSize = LZ4BlockCompress(input.data(), input.size(), compressed.data());
+    EXPECT_LE(compressedSize, compressed.size());
+    *compressedSizeOut = compressedSize;
+
+    std::vector<uint8_t> decompressed(input.size());
+    EXPECT_TRUE(
+        LZ4BlockDecompress(compressed.data(), compressedSize, decompressed.data(), input.size()));
+    return decompressed;
+}
+
+// Test that empty and tiny inputs round trip.
+TEST(LZ4Block, SmallInputs)
+{
+    for (size_t size = 0; size < 32; ++size)
+    {
+        std::vector<uint8_t> input(size);
+        for (size_t i = 0; i < size; ++i)
+        {
+            input[i] = static_cast<uint8_t>(i * 7);
+        }
+
+        size_t compressedSize = 0;
+        EXPECT_EQ(input, RoundTrip(input, &compressedSize));
+    }
+}
+
+// Test that repetitive data round trips and actually compresses, including overlapping matches
+// and long literal and match runs.
+TEST(LZ4Block, RepetitiveData)
+{
+    std::vector<uint8_t> input;
+    for (int i = 0; i < 300; ++i)
+    {
+        input.push_back(static_cast<uint8_t>(i));
+    }
+    input.insert(input.end(), 5000, 0xAB);
+    for (int repeat = 0; repeat < 100; ++repeat)
+    {
+        for (uint8_t i = 0; i < 37; ++i)
+        {
+            input.push_back(i);
+        }
+    }
+
+    size_t compressedSize = 0;
+    EXPECT_EQ(input, RoundTrip(input, &compressedSize));
+    EXPECT_LT(compressedSize, input.size() / 4);
+}
+
+// Test that incompressible data round trips within the bound.
+TEST(LZ4Block, RandomData)
+{
+    std::mt19937 rng(1234);
+    std::vector<uint8_t> input(200000);
+    for (uint8_t &byte : input)
+    {
+        byte = static_cast<uint8_t>(rng());
+    }
+
+    size_t compressedSize = 0;
+    EXPECT_EQ(input, RoundTrip(input, &compressedSize));
+    EXPECT_LE(compressedSize, LZ4BlockCompressBound(input.size()));
+}
+
+// Test that the decoder rejects truncated input and size mismatches.
+TEST(LZ4Block, RejectsMalformedInput)
+{
+    std::vector<uint8_t> input(4096);
+    for (size_t i = 0; i < input.size(); ++i)
+    {
+        input[i] = static_cast<uint8_t>(i % 61);
+    }
+
+    std::vector<uint8_t> compressed(LZ4BlockCompressBound(input.size()));
+    const size_t compressedSize = LZ4BlockCompress(input.data(), input.size(), compressed.data());
+
+    std::vector<uint8_t> output(input.size() + 1);
+    EXPECT_FALSE(
+        LZ4BlockDecompress(compressed.data(), compressedSize, output.data(), input.size() + 1));
+    EXPECT_FALSE(
+        LZ4BlockDecompress(compressed.data(), compressedSize, output.data(), input.size() - 1));
+    for (size_t truncated = 0; truncated < compressedSize; ++truncated)
+    {
+        EXPECT_FALSE(
+            LZ4BlockDecompress(compressed.data(), truncated, output.data(), input.size()));
+    }
+
+    // An offset reaching before the start of the output is invalid.
+    const uint8_t badOffset[] = {0x10, 'a', 0x05, 0x00, 0x50, 'a', 'b', 'c', 'd', 'e'};
+    EXPECT_FALSE(LZ4BlockDecompress(badOffset, sizeof(badOffset), output.data(), 10));
+}
+}  // anonymous namespace
+}  // namespace angle
@@ -41,6 +41,8 @@ bool PrependPathToEnvironmentVar(const char *variableName, const char *path);
 bool IsDirectory(const char *filename);
 bool IsFullPath(std::string dirName);
 bool CreateDirectories(const std::string &path);
+// Renames |from| to |to|, replacing |to| if it exists.
+bool RenameFileReplacingExisting(const std::string &from, const std::string &to);
 void MakeForwardSlashThePathSeparator(std::string &path);
 std::string GetRootDirectory();
 std::string ConcatenatePath(std::string first, std::string second);
@@ -223,6 +225,40 @@ class PageFaultHandler : angle::NonCopyable
 // Creates single instance page fault handler
 PageFaultHandler *CreatePageFaultHandler(PageFaultCallback callback);
 
+// A file mapped into the address space for shared reading and writing.  The file is created with
+// the requested size if it doesn't exist or is empty; an existing file keeps its size.  Writes to
+// the mapping are persisted by the OS; flush() can be used to force them out.  Alternatively, an
+// existing file can be mapped read-only with openReadOnly(), in which case the mapping must not be
+// written to.
+class MemoryMappedFile : angle::NonCopyable
+{
+  public:
+    MemoryMappedFile();
+    ~MemoryMappedFile();
+
+    [[nodiscard]] bool open(const std::string &path, size_t size);
+    [[nodiscard]] bool openReadOnly(const std::string &path);
+    void close();
+    bool flush();
+
+    // Takes or releases an exclusive advisory lock on the whole file.  The lock belongs to the open
+    // file, so it excludes other processes as well as other MemoryMappedFiles in this process.
+    void lock();
+    void unlock();
+
+    bool valid() const { return mData != nullptr; }
+    uint8_t *data() const { return mData; }
+    size_t size() const { return mSize; }
+
+  private:
+    uint8_t *mData = nullptr;
+    size_t mSize   = 0;
+
+    // Native file descriptor or HANDLE, and on Windows the file mapping HANDLE.
+    intptr_t mFileHandle    = -1;
+    intptr_t mMappingHandle = 0;
+};
+
 #ifdef ANGLE_PLATFORM_WINDOWS
 // Convert an UTF-16 wstring to an UTF-8 string.
 std::string Narrow(const std::wstring_view &utf16);
@@ -13,11 +13,15 @@
 #include <iostream>
 
 #include <dlfcn.h>
+#include <errno.h>
+#include <fcntl.h>
 #include <grp.h>
 #include <inttypes.h>
 #include <pwd.h>
 #include <signal.h>
+#include <stdio.h>
 #include <string.h>
+#include <sys/file.h>
 #include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
@@ -310,6 +314,11 @@ bool CreateDirectories(const std::string &path)
     return true;
 }
 
+bool RenameFileReplacingExisting(const std::string &from, const std::string &to)
+{
+    return rename(from.c_str(), to.c_str()) == 0;
+}
+
 void MakeForwardSlashThePathSeparator(std::string &path)
 {
     // Nothing to do here for *nix side
@@ -484,6 +493,121 @@ PageFaultHandler *CreatePageFaultHandler(PageFaultCallback callback)
     return gPosixPageFaultHandler;
 }
 
+MemoryMappedFile::MemoryMappedFile() = default;
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+    close();
+}
+
+bool MemoryMappedFile::open(const std::string &path, size_t size)
+{
+    close();
+
+    if (size == 0)
+    {
+        return false;
+    }
+
+    int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    // Lock while sizing the file, so that processes creating it at the same time agree on its size.
+    flock(fd, LOCK_EX);
+    struct stat fileStat;
+    bool sized = fstat(fd, &fileStat) == 0;
+    if (sized && fileStat.st_size > 0)
+    {
+        size = static_cast<size_t>(fileStat.st_size);
+    }
+    else if (sized)
+    {
+        sized = ftruncate(fd, size) == 0;
+    }
+    flock(fd, LOCK_UN);
+
+    void *mapping =
+        sized ? mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0) : MAP_FAILED;
+    if (mapping == MAP_FAILED)
+    {
+        ::close(fd);
+        return false;
+    }
+
+    mData       = static_cast<uint8_t *>(mapping);
+    mSize       = size;
+    mFileHandle = fd;
+    return true;
+}
+
+bool MemoryMappedFile::openReadOnly(const std::string &path)
+{
+    close();
+
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size <= 0)
+    {
+        ::close(fd);
+        return false;
+    }
+
+    size_t size   = static_cast<size_t>(fileStat.st_size);
+    void *mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (mapping == MAP_FAILED)
+    {
+        ::close(fd);
+        return false;
+    }
+
+    mData       = static_cast<uint8_t *>(mapping);
+    mSize       = size;
+    mFileHandle = fd;
+    return true;
+}
+
+void MemoryMappedFile::close()
+{
+    if (mData != nullptr)
+    {
+        munmap(mData, mSize);
+        mData = nullptr;
+        mSize = 0;
+    }
+    if (mFileHandle >= 0)
+    {
+        ::close(static_cast<int>(mFileHandle));
+        mFileHandle = -1;
+    }
+}
+
+bool MemoryMappedFile::flush()
+{
+    return mData != nullptr && msync(mData, mSize, MS_ASYNC) == 0;
+}
+
+void MemoryMappedFile::lock()
+{
+    ASSERT(mFileHandle >= 0);
+    while (flock(static_cast<int>(mFileHandle), LOCK_EX) != 0 && errno == EINTR)
+    {
+    }
+}
+
+void MemoryMappedFile::unlock()
+{
+    ASSERT(mFileHandle >= 0);
+    flock(static_cast<int>(mFileHandle), LOCK_UN);
+}
+
 uint64_t GetProcessMemoryUsageKB()
 {
     FILE *file = fopen("/proc/self/status", "r");
@@ -198,6 +198,12 @@ bool CreateDirectories(const std::string &path)
     return true;
 }
 
+bool RenameFileReplacingExisting(const std::string &from, const std::string &to)
+{
+    // Unlike rename(), this doesn't fail if |to| exists.
+    return MoveFileExW(Widen(from).c_str(), Widen(to).c_str(), MOVEFILE_REPLACE_EXISTING) == TRUE;
+}
+
 void MakeForwardSlashThePathSeparator(std::string &path)
 {
     std::replace(path.begin(), path.end(), '\\', '/');
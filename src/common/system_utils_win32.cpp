@@ -228,6 +228,155 @@ PageFaultHandler *CreatePageFaultHandler(PageFaultCallback callback)
     return gWin32PageFaultHandler;
 }
 
+MemoryMappedFile::MemoryMappedFile() = default;
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+    close();
+}
+
+bool MemoryMappedFile::open(const std::string &path, size_t size)
+{
+    close();
+
+    if (size == 0)
+    {
+        return false;
+    }
+
+    HANDLE file = CreateFileW(Widen(path).c_str(), GENERIC_READ | GENERIC_WRITE,
+                              FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_ALWAYS,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    // Lock while sizing the file, so that processes creating it at the same time agree on its size.
+    OVERLAPPED overlapped = {};
+    LockFileEx(file, LOCKFILE_EXCLUSIVE_LOCK, 0, MAXDWORD, MAXDWORD, &overlapped);
+    LARGE_INTEGER fileSize;
+    bool sized = GetFileSizeEx(file, &fileSize) == TRUE;
+    if (sized && fileSize.QuadPart > 0)
+    {
+        size = static_cast<size_t>(fileSize.QuadPart);
+    }
+    else if (sized)
+    {
+        fileSize.QuadPart = static_cast<LONGLONG>(size);
+        sized             = SetFilePointerEx(file, fileSize, nullptr, FILE_BEGIN) == TRUE &&
+                            SetEndOfFile(file) == TRUE;
+    }
+    UnlockFileEx(file, 0, MAXDWORD, MAXDWORD, &overlapped);
+    if (!sized)
+    {
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READWRITE, fileSize.HighPart,
+                                        fileSize.LowPart, nullptr);
+    if (mapping == nullptr)
+    {
+        CloseHandle(file);
+        return false;
+    }
+
+    void *view = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, size);
+    if (view == nullptr)
+    {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    mData          = static_cast<uint8_t *>(view);
+    mSize          = size;
+    mFileHandle    = reinterpret_cast<intptr_t>(file);
+    mMappingHandle = reinterpret_cast<intptr_t>(mapping);
+    return true;
+}
+
+bool MemoryMappedFile::openReadOnly(const std::string &path)
+{
+    close();
+
+    HANDLE file = CreateFileW(Widen(path).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart <= 0)
+    {
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr)
+    {
+        CloseHandle(file);
+        return false;
+    }
+
+    void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (view == nullptr)
+    {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    mData          = static_cast<uint8_t *>(view);
+    mSize          = static_cast<size_t>(fileSize.QuadPart);
+    mFileHandle    = reinterpret_cast<intptr_t>(file);
+    mMappingHandle = reinterpret_cast<intptr_t>(mapping);
+    return true;
+}
+
+void MemoryMappedFile::close()
+{
+    if (mData != nullptr)
+    {
+        UnmapViewOfFile(mData);
+        mData = nullptr;
+        mSize = 0;
+    }
+    if (mMappingHandle != 0)
+    {
+        CloseHandle(reinterpret_cast<HANDLE>(mMappingHandle));
+        mMappingHandle = 0;
+    }
+    if (mFileHandle != -1)
+    {
+        CloseHandle(reinterpret_cast<HANDLE>(mFileHandle));
+        mFileHandle = -1;
+    }
+}
+
+bool MemoryMappedFile::flush()
+{
+    return mData != nullptr && FlushViewOfFile(mData, 0) == TRUE;
+}
+
+void MemoryMappedFile::lock()
+{
+    ASSERT(mFileHandle != -1);
+    OVERLAPPED overlapped = {};
+    LockFileEx(reinterpret_cast<HANDLE>(mFileHandle), LOCKFILE_EXCLUSIVE_LOCK, 0, MAXDWORD,
+               MAXDWORD, &overlapped);
+}
+
+void MemoryMappedFile::unlock()
+{
+    ASSERT(mFileHandle != -1);
+    OVERLAPPED overlapped = {};
+    UnlockFileEx(reinterpret_cast<HANDLE>(mFileHandle), 0, MAXDWORD, MAXDWORD, &overlapped);
+}
+
 uint64_t GetProcessMemoryUsageKB()
 {
     PROCESS_MEMORY_COUNTERS_EX pmc;
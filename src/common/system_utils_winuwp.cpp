@@ -109,6 +109,36 @@ PageFaultHandler *CreatePageFaultHandler(PageFaultCallback callback)
     return new UwpPageFaultHandler(callback);
 }
 
+MemoryMappedFile::MemoryMappedFile() = default;
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+    close();
+}
+
+bool MemoryMappedFile::open(const std::string &path, size_t size)
+{
+    // Not available on UWP.
+    return false;
+}
+
+bool MemoryMappedFile::openReadOnly(const std::string &path)
+{
+    // Not available on UWP.
+    return false;
+}
+
+void MemoryMappedFile::close() {}
+
+bool MemoryMappedFile::flush()
+{
+    return false;
+}
+
+void MemoryMappedFile::lock() {}
+
+void MemoryMappedFile::unlock() {}
+
 uint64_t GetProcessMemoryUsageKB()
 {
     // Not available on UWP.
@@ -14,6 +14,14 @@
 
 #include <set>
 
+#if defined(_M_X64) || defined(__x86_64__)
+#    define ANGLE_INDEX_RANGE_SSE2 1
+#    include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#    define ANGLE_INDEX_RANGE_NEON 1
+#    include <arm_neon.h>
+#endif
+
 #if defined(ANGLE_ENABLE_WINDOWS_UWP)
 #    include <windows.applicationmodel.core.h>
 #    include <windows.graphics.display.h>
@@ -24,71 +32,256 @@
 namespace
 {
 
+// The min and max of a run of indices, and how many of them are the primitive restart index.
 template <class IndexType>
-gl::IndexRange ComputeTypedIndexRange(const IndexType *indices,
-                                      size_t count,
-                                      bool primitiveRestartEnabled,
-                                      GLuint primitiveRestartIndex)
+struct IndexScanResult
 {
-    ASSERT(count > 0);
+    IndexType minIndex;
+    IndexType maxIndex;
+    size_t restartCount;
+};
 
-    IndexType minIndex                = 0;
-    IndexType maxIndex                = 0;
-    size_t nonPrimitiveRestartIndices = 0;
+// Scans indices [begin, end) into |result|.  When primitive restart is enabled, the restart index
+// is excluded from the max.  It can't lower the min, since it's the largest value of the type.
+template <class IndexType>
+void ScanIndicesScalar(const IndexType *indices,
+                       size_t begin,
+                       size_t end,
+                       bool primitiveRestartEnabled,
+                       IndexScanResult<IndexType> *result)
+{
+    constexpr IndexType kRestartIndex = std::numeric_limits<IndexType>::max();
 
-    if (primitiveRestartEnabled)
+    for (size_t i = begin; i < end; i++)
     {
-        // Find the first non-primitive restart index to initialize the min and max values
-        size_t i = 0;
-        for (; i < count; i++)
+        const IndexType index = indices[i];
+        if (primitiveRestartEnabled && index == kRestartIndex)
         {
-            if (indices[i] != primitiveRestartIndex)
-            {
-                minIndex = indices[i];
-                maxIndex = indices[i];
-                nonPrimitiveRestartIndices++;
-                break;
-            }
+            result->restartCount++;
+            continue;
         }
+        result->minIndex = std::min(result->minIndex, index);
+        result->maxIndex = std::max(result->maxIndex, index);
+    }
+}
+
+#if defined(ANGLE_INDEX_RANGE_SSE2)
+// SSE2 only has unsigned min/max for bytes, and signed ones for shorts.  Wider indices are flipped
+// into the signed range so signed comparisons order them correctly.
+template <class IndexType>
+struct IndexScanSSE2;
+
+template <>
+struct IndexScanSSE2<GLubyte>
+{
+    static __m128i Bias() { return _mm_setzero_si128(); }
+    static __m128i Min(__m128i a, __m128i b) { return _mm_min_epu8(a, b); }
+    static __m128i Max(__m128i a, __m128i b) { return _mm_max_epu8(a, b); }
+    static __m128i Equal(__m128i a, __m128i b) { return _mm_cmpeq_epi8(a, b); }
+};
+
+template <>
+struct IndexScanSSE2<GLushort>
+{
+    static __m128i Bias() { return _mm_set1_epi16(static_cast<short>(0x8000)); }
+    static __m128i Min(__m128i a, __m128i b) { return _mm_min_epi16(a, b); }
+    static __m128i Max(__m128i a, __m128i b) { return _mm_max_epi16(a, b); }
+    static __m128i Equal(__m128i a, __m128i b) { return _mm_cmpeq_epi16(a, b); }
+};
+
+template <>
+struct IndexScanSSE2<GLuint>
+{
+    static __m128i Bias() { return _mm_set1_epi32(static_cast<int>(0x80000000)); }
+    static __m128i Min(__m128i a, __m128i b)
+    {
+        __m128i aGreater = _mm_cmpgt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(aGreater, b), _mm_andnot_si128(aGreater, a));
+    }
+    static __m128i Max(__m128i a, __m128i b)
+    {
+        __m128i aGreater = _mm_cmpgt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(aGreater, a), _mm_andnot_si128(aGreater, b));
+    }
+    static __m128i Equal(__m128i a, __m128i b) { return _mm_cmpeq_epi32(a, b); }
+};
+
+template <class IndexType>
+size_t ScanIndicesVector(const IndexType *indices,
+                         size_t count,
+                         bool primitiveRestartEnabled,
+                         IndexScanResult<IndexType> *result)
+{
+    using Ops                     = IndexScanSSE2<IndexType>;
+    constexpr size_t kLanes       = sizeof(__m128i) / sizeof(IndexType);
+    constexpr size_t kUnrollLanes = kLanes * 2;
 
-        // Loop over the rest of the indices
-        for (; i < count; i++)
+    if (count < kUnrollLanes)
+    {
+        return 0;
+    }
+
+    // Restart lanes are counted a byte at a time by summing their low bits with psadbw.
+    const __m128i bias        = Ops::Bias();
+    const __m128i allOnes     = _mm_set1_epi32(-1);
+    const __m128i byteOnes    = _mm_set1_epi8(1);
+    __m128i minIndex          = _mm_xor_si128(allOnes, bias);
+    __m128i maxIndex          = bias;
+    __m128i restartByteCounts = _mm_setzero_si128();
+
+    size_t i = 0;
+    for (; i + kUnrollLanes <= count; i += kUnrollLanes)
+    {
+        for (size_t half = 0; half < 2; ++half)
         {
-            if (indices[i] != primitiveRestartIndex)
+            __m128i index =
+                _mm_loadu_si128(reinterpret_cast<const __m128i *>(indices + i + half * kLanes));
+            minIndex = Ops::Min(minIndex, _mm_xor_si128(index, bias));
+
+            if (primitiveRestartEnabled)
             {
-                if (minIndex > indices[i])
-                {
-                    minIndex = indices[i];
-                }
-                if (maxIndex < indices[i])
-                {
-                    maxIndex = indices[i];
-                }
-                nonPrimitiveRestartIndices++;
+                __m128i isRestart = Ops::Equal(index, allOnes);
+                restartByteCounts = _mm_add_epi64(
+                    restartByteCounts,
+                    _mm_sad_epu8(_mm_and_si128(isRestart, byteOnes), _mm_setzero_si128()));
+                index = _mm_andnot_si128(isRestart, index);
             }
+            maxIndex = Ops::Max(maxIndex, _mm_xor_si128(index, bias));
         }
     }
-    else
+
+    IndexType minLanes[kLanes];
+    IndexType maxLanes[kLanes];
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(minLanes), _mm_xor_si128(minIndex, bias));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(maxLanes), _mm_xor_si128(maxIndex, bias));
+    for (size_t lane = 0; lane < kLanes; ++lane)
     {
-        minIndex                   = indices[0];
-        maxIndex                   = indices[0];
-        nonPrimitiveRestartIndices = count;
+        result->minIndex = std::min(result->minIndex, minLanes[lane]);
+        result->maxIndex = std::max(result->maxIndex, maxLanes[lane]);
+    }
+    restartByteCounts =
+        _mm_add_epi64(restartByteCounts, _mm_unpackhi_epi64(restartByteCounts, restartByteCounts));
+    const size_t restartByteCount = static_cast<size_t>(_mm_cvtsi128_si64(restartByteCounts));
+    result->restartCount += restartByteCount / sizeof(IndexType);
+
+    return i;
+}
+#endif  // defined(ANGLE_INDEX_RANGE_SSE2)
+
+#if defined(ANGLE_INDEX_RANGE_NEON)
+template <class IndexType>
+struct IndexScanNEON;
+
+template <>
+struct IndexScanNEON<GLubyte>
+{
+    using Vector = uint8x16_t;
+    static Vector Load(const GLubyte *indices) { return vld1q_u8(indices); }
+    static Vector Splat(GLubyte value) { return vdupq_n_u8(value); }
+    static Vector Min(Vector a, Vector b) { return vminq_u8(a, b); }
+    static Vector Max(Vector a, Vector b) { return vmaxq_u8(a, b); }
+    static Vector Equal(Vector a, Vector b) { return vceqq_u8(a, b); }
+    static Vector AndNot(Vector mask, Vector a) { return vbicq_u8(a, mask); }
+    static size_t CountSet(Vector mask) { return vaddvq_u8(vshrq_n_u8(mask, 7)); }
+    static GLubyte MinLane(Vector a) { return vminvq_u8(a); }
+    static GLubyte MaxLane(Vector a) { return vmaxvq_u8(a); }
+};
+
+template <>
+struct IndexScanNEON<GLushort>
+{
+    using Vector = uint16x8_t;
+    static Vector Load(const GLushort *indices) { return vld1q_u16(indices); }
+    static Vector Splat(GLushort value) { return vdupq_n_u16(value); }
+    static Vector Min(Vector a, Vector b) { return vminq_u16(a, b); }
+    static Vector Max(Vector a, Vector b) { return vmaxq_u16(a, b); }
+    static Vector Equal(Vector a, Vector b) { return vceqq_u16(a, b); }
+    static Vector AndNot(Vector mask, Vector a) { return vbicq_u16(a, mask); }
+    static size_t CountSet(Vector mask) { return vaddvq_u16(vshrq_n_u16(mask, 15)); }
+    static GLushort MinLane(Vector a) { return vminvq_u16(a); }
+    static GLushort MaxLane(Vector a) { return vmaxvq_u16(a); }
+};
+
+template <>
+struct IndexScanNEON<GLuint>
+{
+    using Vector = uint32x4_t;
+    static Vector Load(const GLuint *indices) { return vld1q_u32(indices); }
+    static Vector Splat(GLuint value) { return vdupq_n_u32(value); }
+    static Vector Min(Vector a, Vector b) { return vminq_u32(a, b); }
+    static Vector Max(Vector a, Vector b) { return vmaxq_u32(a, b); }
+    static Vector Equal(Vector a, Vector b) { return vceqq_u32(a, b); }
+    static Vector AndNot(Vector mask, Vector a) { return vbicq_u32(a, mask); }
+    static size_t CountSet(Vector mask) { return vaddvq_u32(vshrq_n_u32(mask, 31)); }
+    static GLuint MinLane(Vector a) { return vminvq_u32(a); }
+    static GLuint MaxLane(Vector a) { return vmaxvq_u32(a); }
+};
+
+template <class IndexType>
+size_t ScanIndicesVector(const IndexType *indices,
+                         size_t count,
+                         bool primitiveRestartEnabled,
+                         IndexScanResult<IndexType> *result)
+{
+    using Ops               = IndexScanNEON<IndexType>;
+    constexpr size_t kLanes = 16 / sizeof(IndexType);
 
-        for (size_t i = 1; i < count; i++)
+    if (count < kLanes)
+    {
+        return 0;
+    }
+
+    const typename Ops::Vector restartIndex = Ops::Splat(std::numeric_limits<IndexType>::max());
+    typename Ops::Vector minIndex           = restartIndex;
+    typename Ops::Vector maxIndex           = Ops::Splat(0);
+
+    size_t i = 0;
+    for (; i + kLanes <= count; i += kLanes)
+    {
+        typename Ops::Vector index = Ops::Load(indices + i);
+        minIndex                   = Ops::Min(minIndex, index);
+
+        if (primitiveRestartEnabled)
         {
-            if (minIndex > indices[i])
-            {
-                minIndex = indices[i];
-            }
-            if (maxIndex < indices[i])
-            {
-                maxIndex = indices[i];
-            }
+            typename Ops::Vector isRestart = Ops::Equal(index, restartIndex);
+            result->restartCount += Ops::CountSet(isRestart);
+            index = Ops::AndNot(isRestart, index);
         }
+        maxIndex = Ops::Max(maxIndex, index);
+    }
+
+    result->minIndex = std::min(result->minIndex, Ops::MinLane(minIndex));
+    result->maxIndex = std::max(result->maxIndex, Ops::MaxLane(maxIndex));
+
+    return i;
+}
+#endif  // defined(ANGLE_INDEX_RANGE_NEON)
+
+template <class IndexType>
+gl::IndexRange ComputeTypedIndexRange(const IndexType *indices,
+                                      size_t count,
+                                      bool primitiveRestartEnabled,
+                                      GLuint primitiveRestartIndex)
+{
+    ASSERT(count > 0);
+    ASSERT(primitiveRestartIndex == std::numeric_limits<IndexType>::max());
+
+    IndexScanResult<IndexType> result = {std::numeric_limits<IndexType>::max(), 0, 0};
+
+    size_t scanned = 0;
+#if defined(ANGLE_INDEX_RANGE_SSE2) || defined(ANGLE_INDEX_RANGE_NEON)
+    scanned = ScanIndicesVector(indices, count, primitiveRestartEnabled, &result);
+#endif
+    ScanIndicesScalar(indices, scanned, count, primitiveRestartEnabled, &result);
+
+    const size_t nonPrimitiveRestartIndices = count - result.restartCount;
+    if (nonPrimitiveRestartIndices == 0)
+    {
+        return gl::IndexRange(0, 0, 0);
     }
 
-    return gl::IndexRange(static_cast<size_t>(minIndex), static_cast<size_t>(maxIndex),
-                          nonPrimitiveRestartIndices);
+    return gl::IndexRange(static_cast<size_t>(result.minIndex),
+                          static_cast<size_t>(result.maxIndex), nonPrimitiveRestartIndices);
 }
 
 }  // anonymous namespace
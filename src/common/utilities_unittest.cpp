@@ -10,6 +10,8 @@
 
 #include "common/utilities.h"
 
+#include <random>
+
 namespace
 {
 
@@ -205,4 +207,87 @@ TEST(Utilities, ConstStrLen)
     EXPECT_EQ(3u, n2);
 }
 
+// Computes the index range one index at a time.
+template <typename IndexType>
+gl::IndexRange ReferenceIndexRange(const IndexType *indices, size_t count, bool primitiveRestart)
+{
+    const size_t restartIndex = std::numeric_limits<IndexType>::max();
+    size_t minIndex           = std::numeric_limits<size_t>::max();
+    size_t maxIndex           = 0;
+    size_t vertexCount        = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (primitiveRestart && indices[i] == restartIndex)
+        {
+            continue;
+        }
+        minIndex = std::min<size_t>(minIndex, indices[i]);
+        maxIndex = std::max<size_t>(maxIndex, indices[i]);
+        ++vertexCount;
+    }
+    return vertexCount == 0 ? gl::IndexRange(0, 0, 0)
+                            : gl::IndexRange(minIndex, maxIndex, vertexCount);
+}
+
+template <typename IndexType>
+void TestComputeIndexRange(gl::DrawElementsType type)
+{
+    std::mt19937 generator(static_cast<uint32_t>(sizeof(IndexType)));
+    std::vector<IndexType> indices(300);
+
+    // Restart indices are planted with increasing density, up to every index being one.
+    for (uint32_t restartPercent : {0u, 5u, 50u, 100u})
+    {
+        for (IndexType &index : indices)
+        {
+            index = generator() % 100 < restartPercent ? std::numeric_limits<IndexType>::max()
+                                                      : static_cast<IndexType>(generator());
+        }
+
+        // Vary the offset and count to cover unaligned starts and the scalar tails.
+        for (size_t offset = 0; offset < 4; ++offset)
+        {
+            for (size_t count = 1; count + offset <= indices.size(); count += 7)
+            {
+                for (bool primitiveRestart : {false, true})
+                {
+                    gl::IndexRange expected =
+                        ReferenceIndexRange(indices.data() + offset, count, primitiveRestart);
+                    gl::IndexRange actual = gl::ComputeIndexRange(type, indices.data() + offset,
+                                                                  count, primitiveRestart);
+                    EXPECT_EQ(expected.start, actual.start);
+                    EXPECT_EQ(expected.end, actual.end);
+                    EXPECT_EQ(expected.vertexIndexCount, actual.vertexIndexCount);
+                }
+            }
+        }
+    }
+}
+
+// Test the index range of unsigned byte, short and int indices against a simple scan.
+TEST(ComputeIndexRange, MatchesReference)
+{
+    TestComputeIndexRange<GLubyte>(gl::DrawElementsType::UnsignedByte);
+    TestComputeIndexRange<GLushort>(gl::DrawElementsType::UnsignedShort);
+    TestComputeIndexRange<GLuint>(gl::DrawElementsType::UnsignedInt);
+}
+
+// Test that the largest index counts as a vertex when primitive restart is disabled.
+TEST(ComputeIndexRange, MaxIndexWithoutRestart)
+{
+    std::vector<GLushort> indices(64, 0xFFFF);
+    indices[40]          = 3;
+    gl::IndexRange range = gl::ComputeIndexRange(gl::DrawElementsType::UnsignedShort,
+                                                 indices.data(), indices.size(), false);
+    EXPECT_EQ(3u, range.start);
+    EXPECT_EQ(0xFFFFu, range.end);
+    EXPECT_EQ(64u, range.vertexIndexCount);
+
+    range = gl::ComputeIndexRange(gl::DrawElementsType::UnsignedShort, indices.data(),
+                                  indices.size(), true);
+    EXPECT_EQ(3u, range.start);
+    EXPECT_EQ(3u, range.end);
+    EXPECT_EQ(1u, range.vertexIndexCount);
+}
+
 }  // anonymous namespace
@@ -44,7 +44,8 @@ class TokenLexer : public Lexer
         }
         else
         {
-            *token = *mIter++;
+            // Every token is read once, so it can be moved out.
+            *token = std::move(*mIter++);
         }
     }
 
@@ -209,7 +210,7 @@ void MacroExpander::getToken(Token *token)
 
     if (!mContextStack.empty())
     {
-        *token = mContextStack.back().get();
+        mContextStack.back().get(token);
     }
     else
     {
@@ -224,7 +225,11 @@ void MacroExpander::ungetToken(const Token &token)
     {
         MacroContext &context = mContextStack.back();
         context.unget();
-        ASSERT(context.replacements[context.index] == token);
+#if defined(ANGLE_ENABLE_ASSERTS)
+        Token expected;
+        context.read(context.index, &expected);
+        ASSERT(expected == token);
+#endif
     }
     else
     {
@@ -251,15 +256,15 @@ bool MacroExpander::pushMacro(std::shared_ptr<Macro> macro, const Token &identif
     ASSERT(identifier.type == Token::IDENTIFIER);
     ASSERT(identifier.text == macro->name);
 
-    std::vector<Token> replacements;
-    if (!expandMacro(*macro, identifier, &replacements))
+    MacroContext context(macro, identifier);
+    if (!expandMacro(*macro, identifier, &context))
         return false;
 
     // Macro is disabled for expansion until it is popped off the stack.
     macro->disabled = true;
 
-    mTotalTokensInContexts += replacements.size();
-    mContextStack.emplace_back(std::move(macro), std::move(replacements));
+    mTotalTokensInContexts += context.replacements().size();
+    mContextStack.push_back(std::move(context));
     return true;
 }
 
@@ -282,38 +287,34 @@ void MacroExpander::popMacro()
         context.macro->disabled = false;
     }
     context.macro->expansionCount--;
-    mTotalTokensInContexts -= context.replacements.size();
+    mTotalTokensInContexts -= context.replacements().size();
 }
 
 bool MacroExpander::expandMacro(const Macro &macro,
                                 const Token &identifier,
-                                std::vector<Token> *replacements)
+                                MacroContext *context)
 {
-    replacements->clear();
-
     // In the case of an object-like macro, the replacement list gets its location
     // from the identifier, but in the case of a function-like macro, the replacement
     // list gets its location from the closing parenthesis of the macro invocation.
     // This is tested by dEQP-GLES3.functional.shaders.preprocessor.predefined_macros.*
-    SourceLocation replacementLocation = identifier.location;
+    context->location = identifier.location;
     if (macro.type == Macro::kTypeObj)
     {
-        replacements->assign(macro.replacements.begin(), macro.replacements.end());
-
         if (macro.predefined)
         {
             const char kLine[] = "__LINE__";
             const char kFile[] = "__FILE__";
 
-            ASSERT(replacements->size() == 1);
-            Token &repl = replacements->front();
-            if (macro.name == kLine)
+            ASSERT(macro.replacements.size() == 1);
+            if (macro.name == kLine || macro.name == kFile)
             {
-                repl.text = ToString(identifier.location.line);
-            }
-            else if (macro.name == kFile)
-            {
-                repl.text = ToString(identifier.location.file);
+                context->useMacroReplacements = false;
+                context->expandedReplacements = macro.replacements;
+
+                Token &repl = context->expandedReplacements.front();
+                repl.text   = ToString(macro.name == kLine ? identifier.location.line
+                                                           : identifier.location.file);
             }
         }
     }
@@ -322,23 +323,11 @@ bool MacroExpander::expandMacro(const Macro &macro,
         ASSERT(macro.type == Macro::kTypeFunc);
         std::vector<MacroArg> args;
         args.reserve(macro.parameters.size());
-        if (!collectMacroArgs(macro, identifier, &args, &replacementLocation))
+        if (!collectMacroArgs(macro, identifier, &args, &context->location))
             return false;
 
-        replaceMacroParams(macro, args, replacements);
-    }
-
-    for (std::size_t i = 0; i < replacements->size(); ++i)
-    {
-        Token &repl = replacements->at(i);
-        if (i == 0)
-        {
-            // The first token in the replacement list inherits the padding
-            // properties of the identifier token.
-            repl.setAtStartOfLine(identifier.atStartOfLine());
-            repl.setHasLeadingSpace(identifier.hasLeadingSpace());
-        }
-        repl.location = replacementLocation;
+        context->useMacroReplacements = false;
+        replaceMacroParams(macro, args, &context->expandedReplacements);
     }
     return true;
 }
@@ -444,7 +433,8 @@ bool MacroExpander::collectMacroArgs(const Macro &macro,
         expander.lex(&token);
         while (token.type != Token::LAST)
         {
-            arg.push_back(token);
+            // lex() overwrites the whole token, so it can be moved from.
+            arg.push_back(std::move(token));
             expander.lex(&token);
             numTokens++;
             if (numTokens + mTotalTokensInContexts > kMaxContextTokens)
@@ -461,6 +451,7 @@ void MacroExpander::replaceMacroParams(const Macro &macro,
                                        const std::vector<MacroArg> &args,
                                        std::vector<Token> *replacements)
 {
+    replacements->reserve(macro.replacements.size());
     for (std::size_t i = 0; i < macro.replacements.size(); ++i)
     {
         if (!replacements->empty() &&
@@ -503,14 +494,34 @@ void MacroExpander::replaceMacroParams(const Macro &macro,
     }
 }
 
+MacroExpander::MacroContext::MacroContext(std::shared_ptr<Macro> macro, const Token &identifier)
+    : macro(std::move(macro)),
+      // The first token in the replacement list inherits the padding properties of the
+      // identifier token.
+      firstTokenFlags(identifier.flags & (Token::AT_START_OF_LINE | Token::HAS_LEADING_SPACE))
+{}
+
 bool MacroExpander::MacroContext::empty() const
 {
-    return index == replacements.size();
+    return index == replacements().size();
 }
 
-const Token &MacroExpander::MacroContext::get()
+void MacroExpander::MacroContext::get(Token *token)
 {
-    return replacements[index++];
+    read(index++, token);
+}
+
+void MacroExpander::MacroContext::read(std::size_t tokenIndex, Token *token) const
+{
+    // The callers read into the same token over and over, so copying the text reuses its buffer
+    // instead of allocating.
+    *token          = replacements()[tokenIndex];
+    token->location = location;
+    if (tokenIndex == 0)
+    {
+        token->setAtStartOfLine((firstTokenFlags & Token::AT_START_OF_LINE) != 0);
+        token->setHasLeadingSpace((firstTokenFlags & Token::HAS_LEADING_SPACE) != 0);
+    }
 }
 
 void MacroExpander::MacroContext::unget()
@@ -44,7 +44,8 @@ class MacroExpander : public Lexer
     bool pushMacro(std::shared_ptr<Macro> macro, const Token &identifier);
     void popMacro();
 
-    bool expandMacro(const Macro &macro, const Token &identifier, std::vector<Token> *replacements);
+    struct MacroContext;
+    bool expandMacro(const Macro &macro, const Token &identifier, MacroContext *context);
 
     typedef std::vector<Token> MacroArg;
     bool collectMacroArgs(const Macro &macro,
@@ -57,15 +58,26 @@ class MacroExpander : public Lexer
 
     struct MacroContext
     {
-        MacroContext(std::shared_ptr<Macro> macro, std::vector<Token> &&replacements)
-            : macro(std::move(macro)), replacements(std::move(replacements))
-        {}
+        MacroContext(std::shared_ptr<Macro> macro, const Token &identifier);
+
+        const std::vector<Token> &replacements() const
+        {
+            return useMacroReplacements ? macro->replacements : expandedReplacements;
+        }
         bool empty() const;
-        const Token &get();
+        void get(Token *token);
         void unget();
+        void read(std::size_t tokenIndex, Token *token) const;
 
         std::shared_ptr<Macro> macro;
-        std::vector<Token> replacements;
+        // Object-like macros are read straight from the replacement list of the macro, which the
+        // context keeps alive.  Other macros are expanded into |expandedReplacements| first.
+        bool useMacroReplacements = true;
+        std::vector<Token> expandedReplacements;
+        // The location and padding of the replacement tokens are applied as they are read, so the
+        // replacement list doesn't need to be copied to change them.
+        SourceLocation location;
+        unsigned int firstTokenFlags;
         std::size_t index = 0;
     };
 
@@ -6,6 +6,7 @@
 
 #include "compiler/translator/Compiler.h"
 
+#include <algorithm>
 #include <sstream>
 
 #include "angle_gl.h"
@@ -14,6 +15,7 @@
 #include "common/CompiledShaderState.h"
 #include "common/PackedEnums.h"
 #include "common/angle_version_info.h"
+#include "common/system_utils.h"
 
 #include "compiler/translator/CallDAG.h"
 #include "compiler/translator/CollectVariables.h"
@@ -375,7 +377,8 @@ TCompiler::TCompiler(sh::GLenum type, ShShaderSpec spec, ShShaderOutput output)
       mHasAnyPreciseType(false),
       mAdvancedBlendEquations(0),
       mUsesDerivatives(false),
-      mCompileOptions{}
+      mCompileOptions{},
+      mPassTimingEnabled(false)
 {}
 
 TCompiler::~TCompiler() {}
@@ -484,11 +487,14 @@ TIntermBlock *TCompiler::compileTreeImpl(const char *const shaderStrings[],
     TScopedSymbolTableLevel globalLevel(&mSymbolTable);
     ASSERT(mSymbolTable.atGlobalLevel());
 
-    // Parse shader.
-    if (PaParseStrings(numStrings - firstSource, &shaderStrings[firstSource], nullptr,
-                       &parseContext) != 0)
+    // Parse shader.  The preprocessor runs as the parser pulls tokens, so its time is included.
     {
-        return nullptr;
+        TScopedPassTiming timing(this, "PreprocessAndParse");
+        if (PaParseStrings(numStrings - firstSource, &shaderStrings[firstSource], nullptr,
+                           &parseContext) != 0)
+        {
+            return nullptr;
+        }
     }
 
     if (!postParseChecks(parseContext))
@@ -757,6 +763,33 @@ void TCompiler::enableValidateNoMoreTransformations()
     mValidateASTOptions.validateNoMoreTransformations = true;
 }
 
+void TCompiler::addPassTiming(const char *passName, double seconds)
+{
+    ASSERT(mPassTimingEnabled);
+
+    auto timing = std::find_if(mPassTimings.begin(), mPassTimings.end(),
+                               [passName](const PassTiming &t) { return t.name == passName; });
+    if (timing == mPassTimings.end())
+    {
+        timing = mPassTimings.insert(mPassTimings.end(), {passName, 0.0});
+    }
+    timing->seconds += seconds;
+}
+
+TScopedPassTiming::TScopedPassTiming(TCompiler *compiler, const char *passName)
+    : mCompiler(compiler),
+      mPassName(passName),
+      mStartTime(compiler->isPassTimingEnabled() ? angle::GetCurrentSystemTime() : 0)
+{}
+
+TScopedPassTiming::~TScopedPassTiming()
+{
+    if (mCompiler->isPassTimingEnabled())
+    {
+        mCompiler->addPassTiming(mPassName, angle::GetCurrentSystemTime() - mStartTime);
+    }
+}
+
 bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
                                     const TParseContext &parseContext,
                                     const ShCompileOptions &compileOptions)
@@ -766,14 +799,20 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     // Disallow expressions deemed too complex.
     // This needs to be checked before other functions that will traverse the AST
     // to prevent potential stack overflow crashes.
-    if (compileOptions.limitExpressionComplexity && !limitExpressionComplexity(root))
     {
-        return false;
+        TScopedPassTiming timing(this, "LimitExpressionComplexity");
+        if (compileOptions.limitExpressionComplexity && !limitExpressionComplexity(root))
+        {
+            return false;
+        }
     }
 
-    if (!validateAST(root))
     {
-        return false;
+        TScopedPassTiming timing(this, "ValidateAST");
+        if (!validateAST(root))
+        {
+            return false;
+        }
     }
 
     // For now, rewrite pixel local storage before collecting variables or any operations on images.
@@ -782,61 +821,81 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     //   Should this actually run after collecting variables?
     //   Do we need more introspection?
     //   Do we want to hide rewritten shader image uniforms from glGetActiveUniform?
-    if (hasPixelLocalStorageUniforms())
     {
-        ASSERT(
-            IsExtensionEnabled(mExtensionBehavior, TExtension::ANGLE_shader_pixel_local_storage));
-        if (!RewritePixelLocalStorage(this, root, getSymbolTable(), compileOptions,
-                                      getShaderVersion()))
+        TScopedPassTiming timing(this, "RewritePixelLocalStorage");
+        if (hasPixelLocalStorageUniforms())
         {
-            mDiagnostics.globalError("internal compiler error translating pixel local storage");
-            return false;
+            ASSERT(IsExtensionEnabled(mExtensionBehavior,
+                                      TExtension::ANGLE_shader_pixel_local_storage));
+            if (!RewritePixelLocalStorage(this, root, getSymbolTable(), compileOptions,
+                                          getShaderVersion()))
+            {
+                mDiagnostics.globalError("internal compiler error translating pixel local storage");
+                return false;
+            }
         }
     }
 
-    if (shouldRunLoopAndIndexingValidation(compileOptions) &&
-        !ValidateLimitations(root, mShaderType, &mSymbolTable, &mDiagnostics))
     {
-        return false;
+        TScopedPassTiming timing(this, "ValidateLimitations");
+        if (shouldRunLoopAndIndexingValidation(compileOptions) &&
+            !ValidateLimitations(root, mShaderType, &mSymbolTable, &mDiagnostics))
+        {
+            return false;
+        }
     }
 
-    if (!ValidateFragColorAndFragData(mShaderType, mShaderVersion, mSymbolTable, &mDiagnostics))
     {
-        return false;
+        TScopedPassTiming timing(this, "ValidateFragColorAndFragData");
+        if (!ValidateFragColorAndFragData(mShaderType, mShaderVersion, mSymbolTable, &mDiagnostics))
+        {
+            return false;
+        }
     }
 
     // Fold expressions that could not be folded before validation that was done as a part of
     // parsing.
-    if (!FoldExpressions(this, root, &mDiagnostics))
     {
-        return false;
+        TScopedPassTiming timing(this, "FoldExpressions");
+        if (!FoldExpressions(this, root, &mDiagnostics))
+        {
+            return false;
+        }
+        // Folding should only be able to generate warnings.
+        ASSERT(mDiagnostics.numErrors() == 0);
     }
-    // Folding should only be able to generate warnings.
-    ASSERT(mDiagnostics.numErrors() == 0);
 
     // gl_ClipDistance and gl_CullDistance built-in arrays have unique semantics.
     // They are pre-declared as unsized and must be sized by the shader either
     // redeclaring them or indexing them only with integral constant expressions.
     // The translator treats them as having the maximum allowed size and this pass
     // detects the actual sizes resizing the variables if needed.
-    if (parseContext.isExtensionEnabled(TExtension::ANGLE_clip_cull_distance) ||
-        parseContext.isExtensionEnabled(TExtension::EXT_clip_cull_distance) ||
-        parseContext.isExtensionEnabled(TExtension::APPLE_clip_distance))
     {
-        bool isClipDistanceUsed = false;
-        if (!ValidateClipCullDistance(this, root, &mDiagnostics,
-                                      mResources.MaxCombinedClipAndCullDistances,
-                                      &mClipDistanceSize, &mCullDistanceSize, &isClipDistanceUsed))
+        TScopedPassTiming timing(this, "ValidateClipCullDistance");
+        if (parseContext.isExtensionEnabled(TExtension::ANGLE_clip_cull_distance) ||
+            parseContext.isExtensionEnabled(TExtension::EXT_clip_cull_distance) ||
+            parseContext.isExtensionEnabled(TExtension::APPLE_clip_distance))
         {
-            return false;
+            bool isClipDistanceUsed = false;
+            if (!ValidateClipCullDistance(this, root, &mDiagnostics,
+                                          mResources.MaxCombinedClipAndCullDistances,
+                                          &mClipDistanceSize, &mCullDistanceSize,
+                                          &isClipDistanceUsed))
+            {
+                return false;
+            }
+            mMetadataFlags[MetadataFlags::HasClipDistance] = isClipDistanceUsed;
         }
-        mMetadataFlags[MetadataFlags::HasClipDistance] = isClipDistanceUsed;
     }
 
     // Validate no barrier() after return before prunning it in |PruneNoOps()| below.
-    if (mShaderType == GL_TESS_CONTROL_SHADER && !ValidateBarrierFunctionCall(root, &mDiagnostics))
     {
-        return false;
+        TScopedPassTiming timing(this, "ValidateBarrierFunctionCall");
+        if (mShaderType == GL_TESS_CONTROL_SHADER &&
+            !ValidateBarrierFunctionCall(root, &mDiagnostics))
+        {
+            return false;
+        }
     }
 
     // We prune no-ops to work around driver bugs and to keep AST processing and output simple.
@@ -847,11 +906,14 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     //      invalid ESSL.
     //   3. Any unreachable statement after a discard, return, break or continue.
     // After this empty declarations are not allowed in the AST.
-    if (!PruneNoOps(this, root, &mSymbolTable))
     {
-        return false;
+        TScopedPassTiming timing(this, "PruneNoOps");
+        if (!PruneNoOps(this, root, &mSymbolTable))
+        {
+            return false;
+        }
+        mValidateASTOptions.validateNoStatementsAfterBranch = true;
     }
-    mValidateASTOptions.validateNoStatementsAfterBranch = true;
 
     // We need to generate globals early if we have non constant initializers enabled
     bool initializeLocalsAndGlobals =
@@ -874,239 +936,325 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     // This is because MSL doesn't allow statically initialized non-const globals.
     bool forceDeferNonConstGlobalInitializers = getOutputType() == SH_MSL_METAL_OUTPUT;
 
-    if (enableNonConstantInitializers &&
-        !DeferGlobalInitializers(this, root, initializeLocalsAndGlobals, canUseLoopsToInitialize,
-                                 highPrecisionSupported, forceDeferNonConstGlobalInitializers,
-                                 &mSymbolTable))
     {
-        return false;
+        TScopedPassTiming timing(this, "DeferNonConstantGlobalInitializers");
+        if (enableNonConstantInitializers &&
+            !DeferGlobalInitializers(this, root, initializeLocalsAndGlobals,
+                                     canUseLoopsToInitialize, highPrecisionSupported,
+                                     forceDeferNonConstGlobalInitializers, &mSymbolTable))
+        {
+            return false;
+        }
     }
 
-    if (!SeparateStructFromFunctionDeclarations(*this, *root))
     {
-        return false;
+        TScopedPassTiming timing(this, "SeparateStructFromFunctionDeclarations");
+        if (!SeparateStructFromFunctionDeclarations(*this, *root))
+        {
+            return false;
+        }
     }
 
     // Create the function DAG and check there is no recursion
-    if (!initCallDag(root))
     {
-        return false;
+        TScopedPassTiming timing(this, "InitCallDag");
+        if (!initCallDag(root))
+        {
+            return false;
+        }
     }
 
-    if (compileOptions.limitCallStackDepth && !checkCallDepth())
     {
-        return false;
+        TScopedPassTiming timing(this, "CheckCallDepth");
+        if (compileOptions.limitCallStackDepth && !checkCallDepth())
+        {
+            return false;
+        }
     }
 
     // Checks which functions are used and if "main" exists
-    mFunctionMetadata.clear();
-    mFunctionMetadata.resize(mCallDag.size());
-    if (!tagUsedFunctions())
     {
-        return false;
+        TScopedPassTiming timing(this, "TagUsedFunctions");
+        mFunctionMetadata.clear();
+        mFunctionMetadata.resize(mCallDag.size());
+        if (!tagUsedFunctions())
+        {
+            return false;
+        }
     }
 
-    if (!pruneUnusedFunctions(root))
     {
-        return false;
+        TScopedPassTiming timing(this, "PruneUnusedFunctions");
+        if (!pruneUnusedFunctions(root))
+        {
+            return false;
+        }
     }
 
-    if (IsSpecWithFunctionBodyNewScope(mShaderSpec, mShaderVersion))
     {
-        if (!ReplaceShadowingVariables(this, root, &mSymbolTable))
+        TScopedPassTiming timing(this, "ReplaceShadowingVariables");
+        if (IsSpecWithFunctionBodyNewScope(mShaderSpec, mShaderVersion))
         {
-            return false;
+            if (!ReplaceShadowingVariables(this, root, &mSymbolTable))
+            {
+                return false;
+            }
         }
     }
 
-    if (mShaderVersion >= 310 && !ValidateVaryingLocations(root, &mDiagnostics, mShaderType))
     {
-        return false;
+        TScopedPassTiming timing(this, "ValidateVaryingLocations");
+        if (mShaderVersion >= 310 && !ValidateVaryingLocations(root, &mDiagnostics, mShaderType))
+        {
+            return false;
+        }
     }
 
     // anglebug.com/42265954: The ESSL spec has a bug with images as function arguments. The
     // recommended workaround is to inline functions that accept image arguments.
-    if (mShaderVersion >= 310 && !MonomorphizeUnsupportedFunctions(
-                                     this, root, &mSymbolTable,
-                                     UnsupportedFunctionArgsBitSet{UnsupportedFunctionArgs::Image}))
     {
-        return false;
+        TScopedPassTiming timing(this, "MonomorphizeUnsupportedFunctions");
+        if (mShaderVersion >= 310 &&
+            !MonomorphizeUnsupportedFunctions(
+                this, root, &mSymbolTable,
+                UnsupportedFunctionArgsBitSet{UnsupportedFunctionArgs::Image}))
+        {
+            return false;
+        }
     }
 
-    if (mShaderVersion >= 300 && mShaderType == GL_FRAGMENT_SHADER &&
-        !ValidateOutputs(root, getExtensionBehavior(), mResources, hasPixelLocalStorageUniforms(),
-                         IsWebGLBasedSpec(mShaderSpec), &mDiagnostics))
     {
-        return false;
+        TScopedPassTiming timing(this, "ValidateOutputs");
+        if (mShaderVersion >= 300 && mShaderType == GL_FRAGMENT_SHADER &&
+            !ValidateOutputs(root, getExtensionBehavior(), mResources,
+                             hasPixelLocalStorageUniforms(), IsWebGLBasedSpec(mShaderSpec),
+                             &mDiagnostics))
+        {
+            return false;
+        }
     }
 
     // Clamping uniform array bounds needs to happen after validateLimitations pass.
-    if (compileOptions.clampIndirectArrayBounds)
     {
-        if (!ClampIndirectIndices(this, root, &mSymbolTable))
+        TScopedPassTiming timing(this, "ClampIndirectIndices");
+        if (compileOptions.clampIndirectArrayBounds)
         {
-            return false;
+            if (!ClampIndirectIndices(this, root, &mSymbolTable))
+            {
+                return false;
+            }
         }
     }
 
-    if (compileOptions.initializeBuiltinsForInstancedMultiview &&
-        (parseContext.isExtensionEnabled(TExtension::OVR_multiview2) ||
-         parseContext.isExtensionEnabled(TExtension::OVR_multiview)) &&
-        getShaderType() != GL_COMPUTE_SHADER)
     {
-        if (!DeclareAndInitBuiltinsForInstancedMultiview(
-                this, root, mNumViews, mShaderType, compileOptions, mOutputType, &mSymbolTable))
+        TScopedPassTiming timing(this, "DeclareAndInitBuiltinsForInstancedMultiview");
+        if (compileOptions.initializeBuiltinsForInstancedMultiview &&
+            (parseContext.isExtensionEnabled(TExtension::OVR_multiview2) ||
+             parseContext.isExtensionEnabled(TExtension::OVR_multiview)) &&
+            getShaderType() != GL_COMPUTE_SHADER)
         {
-            return false;
+            if (!DeclareAndInitBuiltinsForInstancedMultiview(
+                    this, root, mNumViews, mShaderType, compileOptions, mOutputType, &mSymbolTable))
+            {
+                return false;
+            }
         }
     }
 
     // This pass might emit short circuits so keep it before the short circuit unfolding
-    if (compileOptions.rewriteDoWhileLoops)
     {
-        if (!RewriteDoWhile(this, root, &mSymbolTable))
+        TScopedPassTiming timing(this, "RewriteDoWhile");
+        if (compileOptions.rewriteDoWhileLoops)
         {
-            return false;
+            if (!RewriteDoWhile(this, root, &mSymbolTable))
+            {
+                return false;
+            }
         }
     }
 
-    if (compileOptions.addAndTrueToLoopCondition)
     {
-        if (!AddAndTrueToLoopCondition(this, root))
+        TScopedPassTiming timing(this, "AddAndTrueToLoopCondition");
+        if (compileOptions.addAndTrueToLoopCondition)
         {
-            return false;
+            if (!AddAndTrueToLoopCondition(this, root))
+            {
+                return false;
+            }
         }
     }
 
-    if (compileOptions.unfoldShortCircuit)
     {
-        if (!UnfoldShortCircuitAST(this, root))
+        TScopedPassTiming timing(this, "UnfoldShortCircuitAST");
+        if (compileOptions.unfoldShortCircuit)
         {
-            return false;
+            if (!UnfoldShortCircuitAST(this, root))
+            {
+                return false;
+            }
         }
     }
 
-    if (compileOptions.regenerateStructNames)
     {
-        if (!RegenerateStructNames(this, root, &mSymbolTable))
+        TScopedPassTiming timing(this, "RegenerateStructNames");
+        if (compileOptions.regenerateStructNames)
         {
-            return false;
+            if (!RegenerateStructNames(this, root, &mSymbolTable))
+            {
+                return false;
+            }
         }
     }
 
-    if (mShaderType == GL_VERTEX_SHADER &&
-        IsExtensionEnabled(mExtensionBehavior, TExtension::ANGLE_multi_draw))
     {
-        if (compileOptions.emulateGLDrawID)
+        TScopedPassTiming timing(this, "EmulateGLDrawID");
+        if (mShaderType == GL_VERTEX_SHADER &&
+            IsExtensionEnabled(mExtensionBehavior, TExtension::ANGLE_multi_draw))
         {
-            if (!EmulateGLDrawID(this, root, &mSymbolTable, &mUniforms))
+            if (compileOptions.emulateGLDrawID)
             {
-                return false;
+                const bool addDrawIndex =
+                    compileOptions.addDrawIndexToGLDrawID && IsOutputSPIRV(mOutputType);
+                if (!EmulateGLDrawID(this, root, &mSymbolTable, &mUniforms, addDrawIndex))
+                {
+                    return false;
+                }
             }
         }
     }
 
-    if (mShaderType == GL_VERTEX_SHADER &&
-        IsExtensionEnabled(mExtensionBehavior,
-                           TExtension::ANGLE_base_vertex_base_instance_shader_builtin))
     {
-        if (compileOptions.emulateGLBaseVertexBaseInstance)
+        TScopedPassTiming timing(this, "EmulateGLBaseVertexBaseInstance");
+        if (mShaderType == GL_VERTEX_SHADER &&
+            IsExtensionEnabled(mExtensionBehavior,
+                               TExtension::ANGLE_base_vertex_base_instance_shader_builtin))
         {
-            if (!EmulateGLBaseVertexBaseInstance(this, root, &mSymbolTable, &mUniforms,
-                                                 compileOptions.addBaseVertexToVertexID))
+            if (compileOptions.emulateGLBaseVertexBaseInstance)
             {
-                return false;
+                if (!EmulateGLBaseVertexBaseInstance(this, root, &mSymbolTable, &mUniforms,
+                                                     compileOptions.addBaseVertexToVertexID))
+                {
+                    return false;
+                }
             }
         }
     }
 
-    if (mShaderType == GL_FRAGMENT_SHADER && mShaderVersion == 100 && mResources.EXT_draw_buffers &&
-        mResources.MaxDrawBuffers > 1 &&
-        IsExtensionEnabled(mExtensionBehavior, TExtension::EXT_draw_buffers))
     {
-        if (!EmulateGLFragColorBroadcast(this, root, mResources.MaxDrawBuffers,
-                                         mResources.MaxDualSourceDrawBuffers, &mOutputVariables,
-                                         &mSymbolTable, mShaderVersion))
+        TScopedPassTiming timing(this, "EmulateGLFragColorBroadcast");
+        if (mShaderType == GL_FRAGMENT_SHADER && mShaderVersion == 100 &&
+            mResources.EXT_draw_buffers && mResources.MaxDrawBuffers > 1 &&
+            IsExtensionEnabled(mExtensionBehavior, TExtension::EXT_draw_buffers))
         {
-            return false;
+            if (!EmulateGLFragColorBroadcast(this, root, mResources.MaxDrawBuffers,
+                                             mResources.MaxDualSourceDrawBuffers, &mOutputVariables,
+                                             &mSymbolTable, mShaderVersion))
+            {
+                return false;
+            }
         }
     }
 
-    if (compileOptions.simplifyLoopConditions)
     {
-        if (!SimplifyLoopConditions(this, root, &getSymbolTable()))
+        TScopedPassTiming timing(this, "SimplifyLoopConditions");
+        if (compileOptions.simplifyLoopConditions)
         {
-            return false;
+            if (!SimplifyLoopConditions(this, root, &getSymbolTable()))
+            {
+                return false;
+            }
         }
-    }
-    else
-    {
-        // Split multi declarations and remove calls to array length().
-        // Note that SimplifyLoopConditions needs to be run before any other AST transformations
-        // that may need to generate new statements from loop conditions or loop expressions.
-        if (!SimplifyLoopConditions(this, root,
-                                    IntermNodePatternMatcher::kMultiDeclaration |
-                                        IntermNodePatternMatcher::kArrayLengthMethod,
-                                    &getSymbolTable()))
+        else
         {
-            return false;
+            // Split multi declarations and remove calls to array length().
+            // Note that SimplifyLoopConditions needs to be run before any other AST transformations
+            // that may need to generate new statements from loop conditions or loop expressions.
+            if (!SimplifyLoopConditions(this, root,
+                                        IntermNodePatternMatcher::kMultiDeclaration |
+                                            IntermNodePatternMatcher::kArrayLengthMethod,
+                                        &getSymbolTable()))
+            {
+                return false;
+            }
         }
     }
 
     // Note that separate declarations need to be run before other AST transformations that
     // generate new statements from expressions.
-    if (!SeparateDeclarations(*this, *root, mCompileOptions.separateCompoundStructDeclarations))
-    {
-        return false;
-    }
-
-    if (IsWebGLBasedSpec(mShaderSpec))
     {
-        // Remove infinite loops, they are not supposed to exist in shaders.
-        bool anyInfiniteLoops = false;
-        if (!PruneInfiniteLoops(this, root, &mSymbolTable, &anyInfiniteLoops))
+        TScopedPassTiming timing(this, "SeparateDeclarations");
+        if (!SeparateDeclarations(*this, *root, mCompileOptions.separateCompoundStructDeclarations))
         {
             return false;
         }
+    }
 
-        // If requested, reject shaders with infinite loops.  If not requested, the same loops are
-        // removed from the shader as a fallback.
-        if (anyInfiniteLoops && mCompileOptions.rejectWebglShadersWithUndefinedBehavior)
+    {
+        TScopedPassTiming timing(this, "PruneInfiniteLoops");
+        if (IsWebGLBasedSpec(mShaderSpec))
         {
-            mDiagnostics.globalError("Infinite loop detected in the shader");
-            return false;
+            // Remove infinite loops, they are not supposed to exist in shaders.
+            bool anyInfiniteLoops = false;
+            if (!PruneInfiniteLoops(this, root, &mSymbolTable, &anyInfiniteLoops))
+            {
+                return false;
+            }
+
+            // If requested, reject shaders with infinite loops.  If not requested, the same loops
+            // are removed from the shader as a fallback.
+            if (anyInfiniteLoops && mCompileOptions.rejectWebglShadersWithUndefinedBehavior)
+            {
+                mDiagnostics.globalError("Infinite loop detected in the shader");
+                return false;
+            }
         }
     }
 
-    if (compileOptions.rescopeGlobalVariables)
     {
-        if (!RescopeGlobalVariables(*this, *root))
+        TScopedPassTiming timing(this, "RescopeGlobalVariables");
+        if (compileOptions.rescopeGlobalVariables)
         {
-            return false;
+            if (!RescopeGlobalVariables(*this, *root))
+            {
+                return false;
+            }
         }
     }
 
     mValidateASTOptions.validateMultiDeclarations = true;
 
-    if (!SplitSequenceOperator(this, root, IntermNodePatternMatcher::kArrayLengthMethod,
-                               &getSymbolTable()))
     {
-        return false;
+        TScopedPassTiming timing(this, "SplitSequenceOperator");
+        if (!SplitSequenceOperator(this, root, IntermNodePatternMatcher::kArrayLengthMethod,
+                                   &getSymbolTable()))
+        {
+            return false;
+        }
     }
 
-    if (!RemoveArrayLengthMethod(this, root))
     {
-        return false;
+        TScopedPassTiming timing(this, "RemoveArrayLengthMethod");
+        if (!RemoveArrayLengthMethod(this, root))
+        {
+            return false;
+        }
     }
+
     // Fold the expressions again, because |RemoveArrayLengthMethod| can introduce new constants.
-    if (!FoldExpressions(this, root, &mDiagnostics))
     {
-        return false;
+        TScopedPassTiming timing(this, "FoldExpressionsAfterRemoveArrayLengthMethod");
+        if (!FoldExpressions(this, root, &mDiagnostics))
+        {
+            return false;
+        }
     }
 
-    if (!RemoveUnreferencedVariables(this, root, &mSymbolTable))
     {
-        return false;
+        TScopedPassTiming timing(this, "RemoveUnreferencedVariables");
+        if (!RemoveUnreferencedVariables(this, root, &mSymbolTable))
+        {
+            return false;
+        }
     }
 
     // In case the last case inside a switch statement is a certain type of no-op, GLSL compilers in
@@ -1115,102 +1263,139 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     // left switch statements that only contained an empty declaration inside the final case in an
     // invalid state. Relies on that PruneNoOps and RemoveUnreferencedVariables have already been
     // run.
-    if (!PruneEmptyCases(this, root))
     {
-        return false;
+        TScopedPassTiming timing(this, "PruneEmptyCases");
+        if (!PruneEmptyCases(this, root))
+        {
+            return false;
+        }
     }
 
     // Run after RemoveUnreferencedVariables, validate that the shader does not have excessively
     // large variables.
-    if (shouldLimitTypeSizes() && !ValidateTypeSizeLimitations(root, &mSymbolTable, &mDiagnostics))
     {
-        return false;
+        TScopedPassTiming timing(this, "ValidateTypeSizeLimitations");
+        if (shouldLimitTypeSizes() &&
+            !ValidateTypeSizeLimitations(root, &mSymbolTable, &mDiagnostics))
+        {
+            return false;
+        }
     }
 
     // Built-in function emulation needs to happen after validateLimitations pass.
-    GetGlobalPoolAllocator()->lock();
-    initBuiltInFunctionEmulator(&mBuiltInFunctionEmulator, compileOptions);
-    GetGlobalPoolAllocator()->unlock();
-    mBuiltInFunctionEmulator.markBuiltInFunctionsForEmulation(root);
+    {
+        TScopedPassTiming timing(this, "MarkBuiltInFunctionsForEmulation");
+        GetGlobalPoolAllocator()->lock();
+        initBuiltInFunctionEmulator(&mBuiltInFunctionEmulator, compileOptions);
+        GetGlobalPoolAllocator()->unlock();
+        mBuiltInFunctionEmulator.markBuiltInFunctionsForEmulation(root);
+    }
 
-    if (compileOptions.scalarizeVecAndMatConstructorArgs)
     {
-        if (!ScalarizeVecAndMatConstructorArgs(this, root, &mSymbolTable))
+        TScopedPassTiming timing(this, "ScalarizeVecAndMatConstructorArgs");
+        if (compileOptions.scalarizeVecAndMatConstructorArgs)
         {
-            return false;
+            if (!ScalarizeVecAndMatConstructorArgs(this, root, &mSymbolTable))
+            {
+                return false;
+            }
         }
     }
 
-    if (compileOptions.forceShaderPrecisionHighpToMediump)
     {
-        if (!ForceShaderPrecisionToMediump(root, &mSymbolTable, mShaderType))
+        TScopedPassTiming timing(this, "ForceShaderPrecisionToMediump");
+        if (compileOptions.forceShaderPrecisionHighpToMediump)
         {
-            return false;
+            if (!ForceShaderPrecisionToMediump(root, &mSymbolTable, mShaderType))
+            {
+                return false;
+            }
         }
     }
 
-    ASSERT(!mVariablesCollected);
-    CollectVariables(root, &mAttributes, &mOutputVariables, &mUniforms, &mInputVaryings,
-                     &mOutputVaryings, &mSharedVariables, &mUniformBlocks, &mShaderStorageBlocks,
-                     mResources.HashFunction, &mSymbolTable, mShaderType, mExtensionBehavior,
-                     mResources, mTessControlShaderOutputVertices);
-    collectInterfaceBlocks();
-    mVariablesCollected = true;
-    if (compileOptions.useUnusedStandardSharedBlocks)
     {
-        if (!useAllMembersInUnusedStandardAndSharedBlocks(root))
-        {
-            return false;
-        }
+        TScopedPassTiming timing(this, "CollectVariables");
+        ASSERT(!mVariablesCollected);
+        CollectVariables(root, &mAttributes, &mOutputVariables, &mUniforms, &mInputVaryings,
+                         &mOutputVaryings, &mSharedVariables, &mUniformBlocks,
+                         &mShaderStorageBlocks, mResources.HashFunction, &mSymbolTable, mShaderType,
+                         mExtensionBehavior, mResources, mTessControlShaderOutputVertices);
+        collectInterfaceBlocks();
+        mVariablesCollected = true;
     }
-    if (compileOptions.enforcePackingRestrictions)
+
     {
-        int maxUniformVectors = GetMaxUniformVectorsForShaderType(mShaderType, mResources);
-        if (mShaderType == GL_VERTEX_SHADER && compileOptions.emulateClipOrigin)
+        TScopedPassTiming timing(this, "UseAllMembersInUnusedStandardAndSharedBlocks");
+        if (compileOptions.useUnusedStandardSharedBlocks)
         {
-            --maxUniformVectors;
+            if (!useAllMembersInUnusedStandardAndSharedBlocks(root))
+            {
+                return false;
+            }
         }
-        // Returns true if, after applying the packing rules in the GLSL ES 1.00.17 spec
-        // Appendix A, section 7, the shader does not use too many uniforms.
-        if (!CheckVariablesInPackingLimits(maxUniformVectors, mUniforms))
+    }
+
+    {
+        TScopedPassTiming timing(this, "CheckVariablesInPackingLimits");
+        if (compileOptions.enforcePackingRestrictions)
         {
-            mDiagnostics.globalError("too many uniforms");
-            return false;
+            int maxUniformVectors = GetMaxUniformVectorsForShaderType(mShaderType, mResources);
+            if (mShaderType == GL_VERTEX_SHADER && compileOptions.emulateClipOrigin)
+            {
+                --maxUniformVectors;
+            }
+            // Returns true if, after applying the packing rules in the GLSL ES 1.00.17 spec
+            // Appendix A, section 7, the shader does not use too many uniforms.
+            if (!CheckVariablesInPackingLimits(maxUniformVectors, mUniforms))
+            {
+                mDiagnostics.globalError("too many uniforms");
+                return false;
+            }
         }
     }
-    bool needInitializeOutputVariables =
-        compileOptions.initOutputVariables && mShaderType != GL_COMPUTE_SHADER;
-    needInitializeOutputVariables |=
-        compileOptions.initFragmentOutputVariables && mShaderType == GL_FRAGMENT_SHADER;
-    if (needInitializeOutputVariables)
+
     {
-        if (!initializeOutputVariables(root))
+        TScopedPassTiming timing(this, "InitializeOutputVariables");
+        bool needInitializeOutputVariables =
+            compileOptions.initOutputVariables && mShaderType != GL_COMPUTE_SHADER;
+        needInitializeOutputVariables |=
+            compileOptions.initFragmentOutputVariables && mShaderType == GL_FRAGMENT_SHADER;
+        if (needInitializeOutputVariables)
         {
-            return false;
+            if (!initializeOutputVariables(root))
+            {
+                return false;
+            }
         }
     }
 
     // Removing invariant declarations must be done after collecting variables.
     // Otherwise, built-in invariant declarations don't apply.
-    if (RemoveInvariant(mShaderType, mShaderVersion, mOutputType, compileOptions))
     {
-        if (!RemoveInvariantDeclaration(this, root))
+        TScopedPassTiming timing(this, "RemoveInvariantDeclaration");
+        if (RemoveInvariant(mShaderType, mShaderVersion, mOutputType, compileOptions))
         {
-            return false;
+            if (!RemoveInvariantDeclaration(this, root))
+            {
+                return false;
+            }
         }
     }
 
     // gl_Position is always written in compatibility output mode.
     // It may have been already initialized among other output variables, in that case we don't
     // need to initialize it twice.
-    if (mShaderType == GL_VERTEX_SHADER && !mGLPositionInitialized &&
-        (compileOptions.initGLPosition || mOutputType == SH_GLSL_COMPATIBILITY_OUTPUT))
     {
-        if (!initializeGLPosition(root))
+        TScopedPassTiming timing(this, "InitializeGLPosition");
+        if (mShaderType == GL_VERTEX_SHADER && !mGLPositionInitialized &&
+            (compileOptions.initGLPosition || mOutputType == SH_GLSL_COMPATIBILITY_OUTPUT))
         {
-            return false;
+            if (!initializeGLPosition(root))
+            {
+                return false;
+            }
+            mGLPositionInitialized = true;
         }
-        mGLPositionInitialized = true;
     }
 
     // DeferGlobalInitializers needs to be run before other AST transformations that generate new
@@ -1220,75 +1405,96 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     // Exception: if EXT_shader_non_constant_global_initializers is enabled, we must generate global
     // initializers before we generate the DAG, since initializers may call functions which must not
     // be optimized out
-    if (!enableNonConstantInitializers &&
-        !DeferGlobalInitializers(this, root, initializeLocalsAndGlobals, canUseLoopsToInitialize,
-                                 highPrecisionSupported, forceDeferNonConstGlobalInitializers,
-                                 &mSymbolTable))
     {
-        return false;
+        TScopedPassTiming timing(this, "DeferGlobalInitializers");
+        if (!enableNonConstantInitializers &&
+            !DeferGlobalInitializers(this, root, initializeLocalsAndGlobals,
+                                     canUseLoopsToInitialize, highPrecisionSupported,
+                                     forceDeferNonConstGlobalInitializers, &mSymbolTable))
+        {
+            return false;
+        }
     }
 
-    if (initializeLocalsAndGlobals)
     {
-        // Initialize uninitialized local variables.
-        // In some cases initializing can generate extra statements in the parent block, such as
-        // when initializing nameless structs or initializing arrays in ESSL 1.00. In that case
-        // we need to first simplify loop conditions. We've already separated declarations
-        // earlier, which is also required. If we don't follow the Appendix A limitations, loop
-        // init statements can declare arrays or nameless structs and have multiple
-        // declarations.
-
-        if (!shouldRunLoopAndIndexingValidation(compileOptions))
+        TScopedPassTiming timing(this, "InitializeUninitializedLocals");
+        if (initializeLocalsAndGlobals)
         {
-            if (!SimplifyLoopConditions(this, root,
-                                        IntermNodePatternMatcher::kArrayDeclaration |
-                                            IntermNodePatternMatcher::kNamelessStructDeclaration,
-                                        &getSymbolTable()))
+            // Initialize uninitialized local variables.
+            // In some cases initializing can generate extra statements in the parent block, such as
+            // when initializing nameless structs or initializing arrays in ESSL 1.00. In that case
+            // we need to first simplify loop conditions. We've already separated declarations
+            // earlier, which is also required. If we don't follow the Appendix A limitations, loop
+            // init statements can declare arrays or nameless structs and have multiple
+            // declarations.
+
+            if (!shouldRunLoopAndIndexingValidation(compileOptions))
             {
-                return false;
+                if (!SimplifyLoopConditions(
+                        this, root,
+                        IntermNodePatternMatcher::kArrayDeclaration |
+                            IntermNodePatternMatcher::kNamelessStructDeclaration,
+                        &getSymbolTable()))
+                {
+                    return false;
+                }
             }
-        }
 
-        if (!InitializeUninitializedLocals(this, root, getShaderVersion(), canUseLoopsToInitialize,
-                                           highPrecisionSupported, &getSymbolTable()))
-        {
-            return false;
+            if (!InitializeUninitializedLocals(this, root, getShaderVersion(),
+                                               canUseLoopsToInitialize, highPrecisionSupported,
+                                               &getSymbolTable()))
+            {
+                return false;
+            }
         }
     }
 
-    if (getShaderType() == GL_VERTEX_SHADER && compileOptions.clampPointSize)
     {
-        if (!ClampPointSize(this, root, mResources.MinPointSize, mResources.MaxPointSize,
-                            &getSymbolTable()))
+        TScopedPassTiming timing(this, "ClampPointSize");
+        if (getShaderType() == GL_VERTEX_SHADER && compileOptions.clampPointSize)
         {
-            return false;
+            if (!ClampPointSize(this, root, mResources.MinPointSize, mResources.MaxPointSize,
+                                &getSymbolTable()))
+            {
+                return false;
+            }
         }
     }
 
-    if (getShaderType() == GL_FRAGMENT_SHADER && compileOptions.clampFragDepth)
     {
-        if (!ClampFragDepth(this, root, &getSymbolTable()))
+        TScopedPassTiming timing(this, "ClampFragDepth");
+        if (getShaderType() == GL_FRAGMENT_SHADER && compileOptions.clampFragDepth)
         {
-            return false;
+            if (!ClampFragDepth(this, root, &getSymbolTable()))
+            {
+                return false;
+            }
         }
     }
 
-    if (compileOptions.rewriteRepeatedAssignToSwizzled)
     {
-        if (!sh::RewriteRepeatedAssignToSwizzled(this, root))
+        TScopedPassTiming timing(this, "RewriteRepeatedAssignToSwizzled");
+        if (compileOptions.rewriteRepeatedAssignToSwizzled)
         {
-            return false;
+            if (!sh::RewriteRepeatedAssignToSwizzled(this, root))
+            {
+                return false;
+            }
         }
     }
 
-    if (compileOptions.removeDynamicIndexingOfSwizzledVector)
     {
-        if (!sh::RemoveDynamicIndexingOfSwizzledVector(this, root, &getSymbolTable(), nullptr))
+        TScopedPassTiming timing(this, "RemoveDynamicIndexingOfSwizzledVector");
+        if (compileOptions.removeDynamicIndexingOfSwizzledVector)
         {
-            return false;
+            if (!sh::RemoveDynamicIndexingOfSwizzledVector(this, root, &getSymbolTable(), nullptr))
+            {
+                return false;
+            }
         }
     }
 
+
     return true;
 }
 
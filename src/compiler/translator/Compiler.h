@@ -84,6 +84,13 @@ struct TFunctionMetadata
     bool used = false;
 };
 
+// Time spent in a pass of checkAndSimplifyAST, accumulated over all compiles.
+struct PassTiming
+{
+    std::string name;
+    double seconds;
+};
+
 //
 // The base class for the machine dependent compiler to derive from
 // for managing object code from the compile.
@@ -236,6 +243,14 @@ class TCompiler : public TShHandleBase
         return mShaderVersion == 100 && !IsWebGLBasedSpec(mShaderSpec);
     }
 
+    // Per-pass timing, for profiling the translator.  Timings are listed in the order the passes
+    // first ran.
+    void enablePassTiming() { mPassTimingEnabled = true; }
+    bool isPassTimingEnabled() const { return mPassTimingEnabled; }
+    const std::vector<PassTiming> &getPassTimings() const { return mPassTimings; }
+    // Adds |seconds| to the time spent in |passName|.  Passes are timed with TScopedPassTiming.
+    void addPassTiming(const char *passName, double seconds);
+
   protected:
     // Add emulated functions to the built-in function emulator.
     virtual void initBuiltInFunctionEmulator(BuiltInFunctionEmulator *emu,
@@ -396,6 +411,23 @@ class TCompiler : public TShHandleBase
     TPragma mPragma;
 
     ShCompileOptions mCompileOptions;
+
+    bool mPassTimingEnabled;
+    std::vector<PassTiming> mPassTimings;
+};
+
+// Attributes the time spent in its scope to a pass, if the compiler has pass timing enabled.
+// Timings are accumulated by name, so each pass must be given a unique one.
+class [[nodiscard]] TScopedPassTiming : angle::NonCopyable
+{
+  public:
+    TScopedPassTiming(TCompiler *compiler, const char *passName);
+    ~TScopedPassTiming();
+
+  private:
+    TCompiler *mCompiler;
+    const char *mPassName;
+    double mStartTime;
 };
 
 //
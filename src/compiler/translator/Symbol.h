@@ -179,7 +179,7 @@ class TStructure : public TSymbol, public TFieldListCollection
     bool atGlobalScope() const { return mAtGlobalScope; }
 
   private:
-    friend class TSymbolTable;
+    friend class TSymbolTableBase;
     // For creating built-in structs.
     TStructure(const TSymbolUniqueId &id,
                const ImmutableString &name,
@@ -234,7 +234,7 @@ class TInterfaceBlock : public TSymbol, public TFieldListCollection
     int blockBinding() const { return mBinding; }
 
   private:
-    friend class TSymbolTable;
+    friend class TSymbolTableBase;
     // For creating built-in interface blocks.
     TInterfaceBlock(const TSymbolUniqueId &id,
                     const ImmutableString &name,
@@ -13,9 +13,16 @@
 
 #include "compiler/translator/SymbolTable.h"
 
+#include <string.h>
+#include <algorithm>
+#include <mutex>
+
 #include "angle_gl.h"
+#include "common/SimpleMutex.h"
+#include "common/base/anglebase/no_destructor.h"
 #include "compiler/translator/ImmutableString.h"
 #include "compiler/translator/IntermNode.h"
+#include "compiler/translator/PoolAlloc.h"
 #include "compiler/translator/StaticType.h"
 #include "compiler/translator/util.h"
 
@@ -56,6 +63,118 @@ bool CheckExtension(uint32_t extensionIndex, const ShBuiltInResources &resources
     const int *resourcePtr = reinterpret_cast<const int *>(&resources);
     return resourcePtr[extensionIndex] > 0;
 }
+
+// Computes what types compute lazily, so that shared types are never modified.
+void RealizeFields(const TFieldListCollection *fieldList);
+
+void RealizeType(const TType &type)
+{
+    type.getMangledName();
+    if (type.getStruct())
+    {
+        RealizeFields(type.getStruct());
+    }
+    if (type.getInterfaceBlock())
+    {
+        RealizeFields(type.getInterfaceBlock());
+    }
+}
+
+void RealizeFields(const TFieldListCollection *fieldList)
+{
+    for (const TField *field : fieldList->fields())
+    {
+        RealizeType(*field->type());
+    }
+    fieldList->objectSize();
+    fieldList->deepestNesting();
+    fieldList->mangledFieldList();
+}
+
+// The built-in symbols that depend on the shader type, spec and resources.  They are allocated
+// from their own pool, and are never modified once created so they can be used by any number of
+// symbol tables and threads at the same time.
+class BuiltInSymbols : public TSymbolTableBase, angle::NonCopyable
+{
+  public:
+    BuiltInSymbols(sh::GLenum shaderType, ShShaderSpec spec, const ShBuiltInResources &resources)
+        : mShaderType(shaderType), mShaderSpec(spec), mResources(resources)
+    {
+        mAllocator.push();
+
+        angle::PoolAllocator *previousAllocator = GetGlobalPoolAllocator();
+        SetGlobalPoolAllocator(&mAllocator);
+
+        initializeBuiltInVariables(shaderType, spec, resources);
+
+        for (TSymbol *TSymbolTableBase::*member : kMemberVariables)
+        {
+            const TSymbol *symbol = this->*member;
+            if (symbol->isVariable())
+            {
+                RealizeType(static_cast<const TVariable *>(symbol)->getType());
+            }
+            else if (symbol->isStruct())
+            {
+                RealizeFields(static_cast<const TStructure *>(symbol));
+            }
+            else if (symbol->isInterfaceBlock())
+            {
+                RealizeFields(static_cast<const TInterfaceBlock *>(symbol));
+            }
+        }
+
+        SetGlobalPoolAllocator(previousAllocator);
+    }
+
+    ~BuiltInSymbols() { mAllocator.popAll(); }
+
+    bool matches(sh::GLenum shaderType,
+                 ShShaderSpec spec,
+                 const ShBuiltInResources &resources) const
+    {
+        // ShBuiltInResources is made comparable by InitBuiltInResources().
+        return mShaderType == shaderType && mShaderSpec == spec &&
+               memcmp(&mResources, &resources, sizeof(resources)) == 0;
+    }
+
+  private:
+    angle::PoolAllocator mAllocator;
+    sh::GLenum mShaderType;
+    ShShaderSpec mShaderSpec;
+    ShBuiltInResources mResources;
+};
+
+// Returns the built-in symbols for the given parameters, creating them if no symbol table
+// currently uses them.
+std::shared_ptr<const BuiltInSymbols> GetBuiltInSymbols(sh::GLenum shaderType,
+                                                        ShShaderSpec spec,
+                                                        const ShBuiltInResources &resources)
+{
+    static angle::base::NoDestructor<angle::SimpleMutex> mutex;
+    static angle::base::NoDestructor<std::vector<std::weak_ptr<const BuiltInSymbols>>> cache;
+
+    std::lock_guard<angle::SimpleMutex> lock(*mutex);
+
+    for (const std::weak_ptr<const BuiltInSymbols> &entry : *cache)
+    {
+        std::shared_ptr<const BuiltInSymbols> builtIns = entry.lock();
+        if (builtIns && builtIns->matches(shaderType, spec, resources))
+        {
+            return builtIns;
+        }
+    }
+
+    cache->erase(std::remove_if(cache->begin(), cache->end(),
+                                [](const std::weak_ptr<const BuiltInSymbols> &entry) {
+                                    return entry.expired();
+                                }),
+                 cache->end());
+
+    auto builtIns = std::make_shared<const BuiltInSymbols>(shaderType, spec, resources);
+    cache->push_back(builtIns);
+    return builtIns;
+}
 }  // namespace
 
 class TSymbolTable::TSymbolTableLevel
@@ -169,7 +288,8 @@ bool TSymbolTable::setGlInArraySize(unsigned int inputArraySize)
     {
         return mGlInVariableWithArraySize->getType().getOutermostArraySize() == inputArraySize;
     }
-    const TInterfaceBlock *glPerVertex = static_cast<const TInterfaceBlock *>(m_gl_PerVertex);
+    const TInterfaceBlock *glPerVertex =
+        static_cast<const TInterfaceBlock *>(mBuiltIns->m_gl_PerVertex);
     TType *glInType = new TType(glPerVertex, EvqPerVertexIn, TLayoutQualifier::Create());
     glInType->makeArray(inputArraySize);
     mGlInVariableWithArraySize =
@@ -185,12 +305,12 @@ TVariable *TSymbolTable::getGlInVariableWithArraySize() const
 
 const TVariable *TSymbolTable::gl_FragData() const
 {
-    return static_cast<const TVariable *>(m_gl_FragData);
+    return static_cast<const TVariable *>(mBuiltIns->m_gl_FragData);
 }
 
 const TVariable *TSymbolTable::gl_SecondaryFragDataEXT() const
 {
-    return static_cast<const TVariable *>(m_gl_SecondaryFragDataEXT);
+    return static_cast<const TVariable *>(mBuiltIns->m_gl_SecondaryFragDataEXT);
 }
 
 TSymbolTable::VariableMetadata *TSymbolTable::getOrCreateVariableMetadata(const TVariable &variable)
@@ -417,7 +537,7 @@ void TSymbolTable::initializeBuiltIns(sh::GLenum type,
 
     setDefaultPrecision(EbtAtomicCounter, EbpHigh);
 
-    initializeBuiltInVariables(type, spec, resources);
+    mBuiltIns = GetBuiltInSymbols(type, spec, resources);
     mUniqueIdCounter = kFirstUserDefinedSymbolId;
 }
 
@@ -14,6 +14,11 @@
 //   effort of creating and loading with the large numbers of built-in
 //   symbols.
 //
+// * The built-in symbols that depend on the resources are immutable once
+//   created, and shared by all symbol tables (of any thread) created with the
+//   same shader type, spec and resources.  Only user-defined symbols are
+//   allocated per compilation.
+//
 // * Name mangling will be used to give each function a unique name
 //   so that symbol table lookups are never ambiguous.  This allows
 //   a simpler symbol table structure.
@@ -195,7 +200,7 @@ constexpr UnmangledEntry::UnmangledEntry(const char *name,
                                    : static_cast<uint16_t>(esslVersion))
 {}
 
-class TSymbolTable : angle::NonCopyable, TSymbolTableBase
+class TSymbolTable : angle::NonCopyable
 {
   public:
     TSymbolTable();
@@ -299,10 +304,6 @@ class TSymbolTable : angle::NonCopyable, TSymbolTableBase
 
     void initSamplerDefaultPrecision(TBasicType samplerType);
 
-    void initializeBuiltInVariables(sh::GLenum shaderType,
-                                    ShShaderSpec spec,
-                                    const ShBuiltInResources &resources);
-
     VariableMetadata *getOrCreateVariableMetadata(const TVariable &variable);
 
     std::vector<std::unique_ptr<TSymbolTableLevel>> mTable;
@@ -322,6 +323,10 @@ class TSymbolTable : angle::NonCopyable, TSymbolTableBase
     ShShaderSpec mShaderSpec;
     ShBuiltInResources mResources;
 
+    // The built-ins that depend on the above, shared with the other symbol tables created with
+    // the same parameters.
+    std::shared_ptr<const TSymbolTableBase> mBuiltIns;
+
     // Indexed by unique id. Map instead of vector since the variables are fairly sparse.
     std::map<int, VariableMetadata> mVariableMetadata;
 
@@ -28721,9 +28721,9 @@ constexpr UnmangledEntry unmangled[] = {
 
 }  // namespace BuiltInArray
 
-void TSymbolTable::initializeBuiltInVariables(sh::GLenum shaderType,
-                                              ShShaderSpec spec,
-                                              const ShBuiltInResources &resources)
+void TSymbolTableBase::initializeBuiltInVariables(sh::GLenum shaderType,
+                                                  ShShaderSpec spec,
+                                                  const ShBuiltInResources &resources)
 {
     const TSourceLoc zeroSourceLoc             = {0, 0, 0, 0};
     TFieldList *fields_gl_DepthRangeParameters = new TFieldList();
@@ -30108,6 +30108,151 @@ void TSymbolTable::initializeBuiltInVariables(sh::GLenum shaderType,
                       type_gl_CullDistance);
 }
 
+TSymbol *TSymbolTableBase::*const TSymbolTableBase::kMemberVariables[kMemberVariableCount] = {
+    &TSymbolTableBase::m_gl_DepthRangeParameters,
+    &TSymbolTableBase::m_gl_DepthRange,
+    &TSymbolTableBase::m_gl_MaxVertexAttribs,
+    &TSymbolTableBase::m_gl_MaxVertexUniformVectors,
+    &TSymbolTableBase::m_gl_MaxVertexTextureImageUnits,
+    &TSymbolTableBase::m_gl_MaxCombinedTextureImageUnits,
+    &TSymbolTableBase::m_gl_MaxTextureImageUnits,
+    &TSymbolTableBase::m_gl_MaxFragmentUniformVectors,
+    &TSymbolTableBase::m_gl_MaxVaryingVectors,
+    &TSymbolTableBase::m_gl_MaxDrawBuffers,
+    &TSymbolTableBase::m_gl_MaxDualSourceDrawBuffersEXT,
+    &TSymbolTableBase::m_gl_MaxVertexOutputVectors,
+    &TSymbolTableBase::m_gl_MaxFragmentInputVectors,
+    &TSymbolTableBase::m_gl_MinProgramTexelOffset,
+    &TSymbolTableBase::m_gl_MaxProgramTexelOffset,
+    &TSymbolTableBase::m_gl_MaxImageUnits,
+    &TSymbolTableBase::m_gl_MaxVertexImageUniforms,
+    &TSymbolTableBase::m_gl_MaxFragmentImageUniforms,
+    &TSymbolTableBase::m_gl_MaxComputeImageUniforms,
+    &TSymbolTableBase::m_gl_MaxCombinedImageUniforms,
+    &TSymbolTableBase::m_gl_MaxCombinedShaderOutputResources,
+    &TSymbolTableBase::m_gl_MaxComputeWorkGroupCount,
+    &TSymbolTableBase::m_gl_MaxComputeWorkGroupSize,
+    &TSymbolTableBase::m_gl_MaxComputeUniformComponents,
+    &TSymbolTableBase::m_gl_MaxComputeTextureImageUnits,
+    &TSymbolTableBase::m_gl_MaxComputeAtomicCounters,
+    &TSymbolTableBase::m_gl_MaxComputeAtomicCounterBuffers,
+    &TSymbolTableBase::m_gl_MaxVertexAtomicCounters,
+    &TSymbolTableBase::m_gl_MaxFragmentAtomicCounters,
+    &TSymbolTableBase::m_gl_MaxCombinedAtomicCounters,
+    &TSymbolTableBase::m_gl_MaxAtomicCounterBindings,
+    &TSymbolTableBase::m_gl_MaxVertexAtomicCounterBuffers,
+    &TSymbolTableBase::m_gl_MaxFragmentAtomicCounterBuffers,
+    &TSymbolTableBase::m_gl_MaxCombinedAtomicCounterBuffers,
+    &TSymbolTableBase::m_gl_MaxAtomicCounterBufferSize,
+    &TSymbolTableBase::m_gl_MaxGeometryInputComponents,
+    &TSymbolTableBase::m_gl_MaxGeometryInputComponentsES3_2,
+    &TSymbolTableBase::m_gl_MaxGeometryOutputComponents,
+    &TSymbolTableBase::m_gl_MaxGeometryOutputComponentsES3_2,
+    &TSymbolTableBase::m_gl_MaxGeometryImageUniforms,
+    &TSymbolTableBase::m_gl_MaxGeometryImageUniformsES3_2,
+    &TSymbolTableBase::m_gl_MaxGeometryTextureImageUnits,
+    &TSymbolTableBase::m_gl_MaxGeometryTextureImageUnitsES3_2,
+    &TSymbolTableBase::m_gl_MaxGeometryOutputVertices,
+    &TSymbolTableBase::m_gl_MaxGeometryOutputVerticesES3_2,
+    &TSymbolTableBase::m_gl_MaxGeometryTotalOutputComponents,
+    &TSymbolTableBase::m_gl_MaxGeometryTotalOutputComponentsES3_2,
+    &TSymbolTableBase::m_gl_MaxGeometryUniformComponents,
+    &TSymbolTableBase::m_gl_MaxGeometryUniformComponentsES3_2,
+    &TSymbolTableBase::m_gl_MaxGeometryAtomicCounters,
+    &TSymbolTableBase::m_gl_MaxGeometryAtomicCountersES3_2,
+    &TSymbolTableBase::m_gl_MaxGeometryAtomicCounterBuffers,
+    &TSymbolTableBase::m_gl_MaxGeometryAtomicCounterBuffersES3_2,
+    &TSymbolTableBase::m_gl_MaxTessControlInputComponents,
+    &TSymbolTableBase::m_gl_MaxTessControlInputComponentsES3_2,
+    &TSymbolTableBase::m_gl_MaxTessControlOutputComponents,
+    &TSymbolTableBase::m_gl_MaxTessControlOutputComponentsES3_2,
+    &TSymbolTableBase::m_gl_MaxTessControlTextureImageUnits,
+    &TSymbolTableBase::m_gl_MaxTessControlTextureImageUnitsES3_2,
+    &TSymbolTableBase::m_gl_MaxTessControlUniformComponents,
+    &TSymbolTableBase::m_gl_MaxTessControlUniformComponentsES3_2,
+    &TSymbolTableBase::m_gl_MaxTessControlTotalOutputComponents,
+    &TSymbolTableBase::m_gl_MaxTessControlTotalOutputComponentsES3_2,
+    &TSymbolTableBase::m_gl_MaxTessControlImageUniforms,
+    &TSymbolTableBase::m_gl_MaxTessControlImageUniformsES3_2,
+    &TSymbolTableBase::m_gl_MaxTessControlAtomicCounters,
+    &TSymbolTableBase::m_gl_MaxTessControlAtomicCountersES3_2,
+    &TSymbolTableBase::m_gl_MaxTessControlAtomicCounterBuffers,
+    &TSymbolTableBase::m_gl_MaxTessControlAtomicCounterBuffersES3_2,
+    &TSymbolTableBase::m_gl_MaxTessPatchComponents,
+    &TSymbolTableBase::m_gl_MaxTessPatchComponentsES3_2,
+    &TSymbolTableBase::m_gl_MaxPatchVertices,
+    &TSymbolTableBase::m_gl_MaxPatchVerticesES3_2,
+    &TSymbolTableBase::m_gl_MaxTessGenLevel,
+    &TSymbolTableBase::m_gl_MaxTessGenLevelES3_2,
+    &TSymbolTableBase::m_gl_MaxTessEvaluationInputComponents,
+    &TSymbolTableBase::m_gl_MaxTessEvaluationInputComponentsES3_2,
+    &TSymbolTableBase::m_gl_MaxTessEvaluationOutputComponents,
+    &TSymbolTableBase::m_gl_MaxTessEvaluationOutputComponentsES3_2,
+    &TSymbolTableBase::m_gl_MaxTessEvaluationTextureImageUnits,
+    &TSymbolTableBase::m_gl_MaxTessEvaluationTextureImageUnitsES3_2,
+    &TSymbolTableBase::m_gl_MaxTessEvaluationUniformComponents,
+    &TSymbolTableBase::m_gl_MaxTessEvaluationUniformComponentsES3_2,
+    &TSymbolTableBase::m_gl_MaxTessEvaluationImageUniforms,
+    &TSymbolTableBase::m_gl_MaxTessEvaluationImageUniformsES3_2,
+    &TSymbolTableBase::m_gl_MaxTessEvaluationAtomicCounters,
+    &TSymbolTableBase::m_gl_MaxTessEvaluationAtomicCountersES3_2,
+    &TSymbolTableBase::m_gl_MaxTessEvaluationAtomicCounterBuffers,
+    &TSymbolTableBase::m_gl_MaxTessEvaluationAtomicCounterBuffersES3_2,
+    &TSymbolTableBase::m_gl_MaxSamples,
+    &TSymbolTableBase::m_gl_MaxSamplesES3_2,
+    &TSymbolTableBase::m_gl_MaxClipDistancesAPPLE,
+    &TSymbolTableBase::m_gl_MaxClipDistances,
+    &TSymbolTableBase::m_gl_MaxCullDistances,
+    &TSymbolTableBase::m_gl_MaxCombinedClipAndCullDistances,
+    &TSymbolTableBase::m_gl_FragData,
+    &TSymbolTableBase::m_gl_SecondaryFragDataEXT,
+    &TSymbolTableBase::m_gl_FragDepthEXT,
+    &TSymbolTableBase::m_gl_LastFragData,
+    &TSymbolTableBase::m_gl_LastFragDataNV,
+    &TSymbolTableBase::m_gl_SampleMaskIn,
+    &TSymbolTableBase::m_gl_SampleMaskInES3_2,
+    &TSymbolTableBase::m_gl_SampleMask,
+    &TSymbolTableBase::m_gl_SampleMaskES3_2,
+    &TSymbolTableBase::m_gl_ClipDistanceAPPLE,
+    &TSymbolTableBase::m_gl_PerVertex,
+    &TSymbolTableBase::m_gl_PerVertexES3_2,
+    &TSymbolTableBase::m_gl_in,
+    &TSymbolTableBase::m_gl_inES3_2,
+    &TSymbolTableBase::m_gl_PositionGS,
+    &TSymbolTableBase::m_gl_PositionGSES3_2,
+    &TSymbolTableBase::m_gl_TessLevelOuterTCS,
+    &TSymbolTableBase::m_gl_TessLevelOuterTCSES3_2,
+    &TSymbolTableBase::m_gl_TessLevelInnerTCS,
+    &TSymbolTableBase::m_gl_TessLevelInnerTCSES3_2,
+    &TSymbolTableBase::m_gl_PerVertexTCS,
+    &TSymbolTableBase::m_gl_PerVertexTCSES3_2,
+    &TSymbolTableBase::m_gl_inTCS,
+    &TSymbolTableBase::m_gl_inTCSES3_2,
+    &TSymbolTableBase::m_gl_outTCS,
+    &TSymbolTableBase::m_gl_outTCSES3_2,
+    &TSymbolTableBase::m_gl_BoundingBoxTCS,
+    &TSymbolTableBase::m_gl_BoundingBoxTCSES3_2,
+    &TSymbolTableBase::m_gl_PositionTCS,
+    &TSymbolTableBase::m_gl_PositionTCSES3_2,
+    &TSymbolTableBase::m_gl_BoundingBoxEXTTCS,
+    &TSymbolTableBase::m_gl_BoundingBoxEXTTCSES3_2,
+    &TSymbolTableBase::m_gl_BoundingBoxOESTCS,
+    &TSymbolTableBase::m_gl_BoundingBoxOESTCSES3_2,
+    &TSymbolTableBase::m_gl_TessLevelOuterTES,
+    &TSymbolTableBase::m_gl_TessLevelOuterTESES3_2,
+    &TSymbolTableBase::m_gl_TessLevelInnerTES,
+    &TSymbolTableBase::m_gl_TessLevelInnerTESES3_2,
+    &TSymbolTableBase::m_gl_PerVertexTES,
+    &TSymbolTableBase::m_gl_PerVertexTESES3_2,
+    &TSymbolTableBase::m_gl_inTES,
+    &TSymbolTableBase::m_gl_inTESES3_2,
+    &TSymbolTableBase::m_gl_outTES,
+    &TSymbolTableBase::m_gl_outTESES3_2,
+    &TSymbolTableBase::m_gl_PositionTES,
+    &TSymbolTableBase::m_gl_PositionTESES3_2,
+    &TSymbolTableBase::m_gl_ClipDistance,
+    &TSymbolTableBase::m_gl_CullDistance};
+
 namespace
 {
 uint16_t GetNextRuleIndex(uint32_t nameHash)
@@ -30134,7 +30279,8 @@ const TSymbol *TSymbolTable::findBuiltIn(const ImmutableString &name, int shader
     uint16_t startIndex = BuiltInArray::kMangledOffsets[nameHash];
     uint16_t nextIndex  = GetNextRuleIndex(nameHash);
 
-    return FindMangledBuiltIn(mShaderSpec, shaderVersion, mShaderType, mResources, *this,
+    ASSERT(mBuiltIns);
+    return FindMangledBuiltIn(mShaderSpec, shaderVersion, mShaderType, mResources, *mBuiltIns,
                               BuiltInArray::kRules, startIndex, nextIndex);
 }
 
@@ -18,7 +18,13 @@ namespace sh
 class TSymbolTableBase
 {
   public:
-    TSymbolTableBase()                                       = default;
+    TSymbolTableBase() = default;
+
+    // Creates the built-ins below for the given shader type, spec and resources.
+    void initializeBuiltInVariables(sh::GLenum shaderType,
+                                    ShShaderSpec spec,
+                                    const ShBuiltInResources &resources);
+
     TSymbol *m_gl_DepthRangeParameters                       = nullptr;
     TSymbol *m_gl_DepthRange                                 = nullptr;
     TSymbol *m_gl_MaxVertexAttribs                           = nullptr;
@@ -162,6 +168,10 @@ class TSymbolTableBase
     TSymbol *m_gl_PositionTESES3_2                           = nullptr;
     TSymbol *m_gl_ClipDistance                               = nullptr;
     TSymbol *m_gl_CullDistance                               = nullptr;
+
+    // All the members above.
+    static constexpr size_t kMemberVariableCount = 143;
+    static TSymbol *TSymbolTableBase::*const kMemberVariables[kMemberVariableCount];
 };
 
 }  // namespace sh
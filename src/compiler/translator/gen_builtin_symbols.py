@@ -224,7 +224,17 @@ class TSymbolTableBase
 {{
   public:
     TSymbolTableBase() = default;
+
+    // Creates the built-ins below for the given shader type, spec and resources.
+    void initializeBuiltInVariables(sh::GLenum shaderType,
+                                    ShShaderSpec spec,
+                                    const ShBuiltInResources &resources);
+
 {declare_member_variables}
+
+    // All the members above.
+    static constexpr size_t kMemberVariableCount = {member_variable_count};
+    static TSymbol *TSymbolTableBase::*const kMemberVariables[kMemberVariableCount];
 }};
 
 }}  // namespace sh
@@ -331,14 +341,18 @@ constexpr UnmangledEntry unmangled[] = {{
 
 }}
 
-void TSymbolTable::initializeBuiltInVariables(sh::GLenum shaderType,
-                                              ShShaderSpec spec,
-                                              const ShBuiltInResources &resources)
+void TSymbolTableBase::initializeBuiltInVariables(sh::GLenum shaderType,
+                                                  ShShaderSpec spec,
+                                                  const ShBuiltInResources &resources)
 {{
     const TSourceLoc zeroSourceLoc = {{0, 0, 0, 0}};
 {init_member_variables}
 }}
 
+TSymbol *TSymbolTableBase::*const TSymbolTableBase::kMemberVariables[kMemberVariableCount] = {{
+{member_variable_pointers}
+}};
+
 namespace
 {{
 uint16_t GetNextRuleIndex(uint32_t nameHash)
@@ -366,7 +380,8 @@ const TSymbol *TSymbolTable::findBuiltIn(const ImmutableString &name,
     uint16_t startIndex = BuiltInArray::kMangledOffsets[nameHash];
     uint16_t nextIndex = GetNextRuleIndex(nameHash);
 
-    return FindMangledBuiltIn(mShaderSpec, shaderVersion, mShaderType, mResources, *this, BuiltInArray::kRules, startIndex, nextIndex);
+    ASSERT(mBuiltIns);
+    return FindMangledBuiltIn(mShaderSpec, shaderVersion, mShaderType, mResources, *mBuiltIns, BuiltInArray::kRules, startIndex, nextIndex);
 }}
 
 bool TSymbolTable::isUnmangledBuiltInName(const ImmutableString &name,
@@ -1162,6 +1177,7 @@ class VariablesData:
         # Code for defining TVariables stored as members of TSymbolTable.
         self.declare_member_variables = []
         self.init_member_variables = []
+        self.member_variable_pointers = []
 
         # Declarations of static array sizes if any builtin TVariable is array.
         self.type_array_sizes_declarations = set()
@@ -1857,6 +1873,8 @@ return &k{name_with_suffix};
         template_declare_member_variable = 'TSymbol *m_{name_with_suffix} = nullptr;'
         variables.declare_member_variables.append(
             template_declare_member_variable.format(**template_args))
+        variables.member_variable_pointers.append(
+            '&TSymbolTableBase::m_{name_with_suffix}'.format(**template_args))
 
         obj = 'm_{name_with_suffix}'.format(**template_args)
 
@@ -2009,6 +2027,10 @@ def generate_files(args, functions_txt_filename, variables_json_filename,
             '\n'.join(variables.declare_member_variables),
         'init_member_variables':
             '\n'.join(variables.init_member_variables),
+        'member_variable_pointers':
+            ',\n'.join(variables.member_variable_pointers),
+        'member_variable_count':
+            len(variables.member_variable_pointers),
         'mangled_names_array':
             ',\n'.join(mangled_builtins.get_names()),
         'mangled_offsets_array':
@@ -443,6 +443,7 @@ spv::StorageClass GetStorageClass(const ShCompileOptions &compileOptions,
 
         case EvqVertexID:
         case EvqInstanceID:
+        case EvqDrawID:
         case EvqFragCoord:
         case EvqFrontFacing:
         case EvqPointCoord:
@@ -553,6 +554,13 @@ spirv::IdRef OutputSPIRVTraverser::getSymbolIdAndStorageClass(const TSymbol *sym
             name              = "gl_InstanceIndex";
             builtInDecoration = spv::BuiltInInstanceIndex;
             break;
+        case EvqDrawID:
+            // Only referenced when added to the emulated gl_DrawID.  DrawParameters is core in
+            // SPIR-V 1.3.
+            name              = "gl_DrawID";
+            builtInDecoration = spv::BuiltInDrawIndex;
+            mBuilder.addCapability(spv::CapabilityDrawParameters);
+            break;
 
         // Fragment shader built-ins
         case EvqFragCoord:
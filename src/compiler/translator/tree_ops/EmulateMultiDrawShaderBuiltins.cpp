@@ -4,7 +4,7 @@
 // found in the LICENSE file.
 //
 // EmulateGLDrawID is an AST traverser to convert the gl_DrawID builtin
-// to a uniform int
+// to a uniform int, optionally added to the index of the draw in an indirect draw
 //
 // EmulateGLBaseVertex is an AST traverser to convert the gl_BaseVertex builtin
 // to a uniform int
@@ -120,7 +120,8 @@ class FindGLBaseInstanceTraverser : public TIntermTraverser
 bool EmulateGLDrawID(TCompiler *compiler,
                      TIntermBlock *root,
                      TSymbolTable *symbolTable,
-                     std::vector<sh::ShaderVariable> *uniforms)
+                     std::vector<sh::ShaderVariable> *uniforms,
+                     bool addDrawIndex)
 {
     FindGLDrawIDTraverser traverser;
     root->traverse(&traverser);
@@ -130,7 +131,7 @@ bool EmulateGLDrawID(TCompiler *compiler,
         const TType *type = StaticType::Get<EbtInt, EbpHigh, EvqUniform, 1, 1>();
         const TVariable *drawID =
             new TVariable(symbolTable, kEmulatedGLDrawIDName, type, SymbolType::AngleInternal);
-        const TIntermSymbol *drawIDSymbol = new TIntermSymbol(drawID);
+        TIntermTyped *drawIDSymbol = new TIntermSymbol(drawID);
 
         // AngleInternal variables don't get collected
         ShaderVariable uniform;
@@ -148,6 +149,16 @@ bool EmulateGLDrawID(TCompiler *compiler,
         uniform.writeonly     = type->getMemoryQualifier().writeonly;
         uniforms->push_back(uniform);
 
+        // The uniform holds the index of the draw when the draws of a multi-draw call are issued
+        // one by one, and is zero otherwise.  In the latter case, the index comes from the
+        // built-in, which the SPIR-V output maps to DrawIndex, and which is in turn zero for
+        // draws that are not part of a multi-draw indirect command.
+        if (addDrawIndex)
+        {
+            drawIDSymbol =
+                new TIntermBinary(EOpAdd, drawIDSymbol, new TIntermSymbol(builtInVariable));
+        }
+
         DeclareGlobalVariable(root, drawID);
         if (!ReplaceVariableWithTyped(compiler, root, builtInVariable, drawIDSymbol))
         {
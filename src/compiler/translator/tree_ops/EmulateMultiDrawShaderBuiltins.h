@@ -32,7 +32,8 @@ class TSymbolTable;
 [[nodiscard]] bool EmulateGLDrawID(TCompiler *compiler,
                                    TIntermBlock *root,
                                    TSymbolTable *symbolTable,
-                                   std::vector<sh::ShaderVariable> *uniforms);
+                                   std::vector<sh::ShaderVariable> *uniforms,
+                                   bool addDrawIndex);
 
 [[nodiscard]] bool EmulateGLBaseVertexBaseInstance(TCompiler *compiler,
                                                    TIntermBlock *root,
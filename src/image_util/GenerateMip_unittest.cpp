@@ -0,0 +1,308 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// GenerateMip_unittest.cpp: Unit tests for the mip generation functions.
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "common/WorkerThread.h"
+#include "image_util/generatemip.h"
+#include "image_util/imageformats.h"
+#include "platform/PlatformMethods.h"
+
+using namespace angle;
+
+namespace
+{
+std::vector<uint8_t> MakeRandomData(size_t size, uint32_t seed)
+{
+    std::mt19937 generator(seed);
+    std::vector<uint8_t> data(size);
+    for (uint8_t &byte : data)
+    {
+        byte = static_cast<uint8_t>(generator());
+    }
+    return data;
+}
+
+// Filters a level with the formats' average() functions, in the same order as GenerateMip.
+template <typename T>
+void GenerateReferenceMip(size_t sourceWidth,
+                          size_t sourceHeight,
+                          size_t sourceDepth,
+                          const uint8_t *sourceData,
+                          size_t sourceRowPitch,
+                          size_t sourceDepthPitch,
+                          uint8_t *destData,
+                          size_t destRowPitch,
+                          size_t destDepthPitch)
+{
+    ASSERT(sourceWidth > 1 && sourceHeight > 1);
+
+    auto pixel = [&](size_t x, size_t y, size_t z) {
+        return reinterpret_cast<const T *>(sourceData + x * sizeof(T) + y * sourceRowPitch +
+                                           z * sourceDepthPitch);
+    };
+
+    for (size_t z = 0; z < std::max<size_t>(1, sourceDepth / 2); ++z)
+    {
+        for (size_t y = 0; y < sourceHeight / 2; ++y)
+        {
+            for (size_t x = 0; x < sourceWidth / 2; ++x)
+            {
+                T *dst = reinterpret_cast<T *>(destData + x * sizeof(T) + y * destRowPitch +
+                                               z * destDepthPitch);
+                T column0, column1;
+                if (sourceDepth > 1)
+                {
+                    T z00, z01, z10, z11;
+                    T::average(&z00, pixel(2 * x, 2 * y, 2 * z), pixel(2 * x, 2 * y, 2 * z + 1));
+                    T::average(&z01, pixel(2 * x, 2 * y + 1, 2 * z),
+                               pixel(2 * x, 2 * y + 1, 2 * z + 1));
+                    T::average(&z10, pixel(2 * x + 1, 2 * y, 2 * z),
+                               pixel(2 * x + 1, 2 * y, 2 * z + 1));
+                    T::average(&z11, pixel(2 * x + 1, 2 * y + 1, 2 * z),
+                               pixel(2 * x + 1, 2 * y + 1, 2 * z + 1));
+                    T::average(&column0, &z00, &z01);
+                    T::average(&column1, &z10, &z11);
+                }
+                else
+                {
+                    T::average(&column0, pixel(2 * x, 2 * y, 0), pixel(2 * x, 2 * y + 1, 0));
+                    T::average(&column1, pixel(2 * x + 1, 2 * y, 0),
+                               pixel(2 * x + 1, 2 * y + 1, 0));
+                }
+                T::average(dst, &column0, &column1);
+            }
+        }
+    }
+}
+
+// Checks that the vectorized GenerateMip matches average() for every row length, including the
+// scalar tails.
+template <typename T>
+void TestVectorizedMip(size_t depth)
+{
+    for (size_t width = 2; width < 40; ++width)
+    {
+        const size_t height           = 6;
+        const size_t sourceRowPitch   = width * sizeof(T) + 4;
+        const size_t sourceDepthPitch = sourceRowPitch * height;
+        const size_t destRowPitch     = (width / 2) * sizeof(T);
+        const size_t destDepthPitch   = destRowPitch * (height / 2);
+        const size_t destSize         = destDepthPitch * std::max<size_t>(1, depth / 2);
+
+        std::vector<uint8_t> source =
+            MakeRandomData(sourceDepthPitch * depth, static_cast<uint32_t>(width));
+        std::vector<uint8_t> expected(destSize);
+        std::vector<uint8_t> actual(destSize);
+
+        GenerateReferenceMip<T>(width, height, depth, source.data(), sourceRowPitch,
+                                sourceDepthPitch, expected.data(), destRowPitch, destDepthPitch);
+        GenerateMip<T>(width, height, depth, source.data(), sourceRowPitch, sourceDepthPitch,
+                       actual.data(), destRowPitch, destDepthPitch);
+
+        EXPECT_EQ(expected, actual) << "width " << width;
+    }
+}
+
+TEST(GenerateMip, RGBA8_XY)
+{
+    TestVectorizedMip<R8G8B8A8>(1);
+    TestVectorizedMip<B8G8R8A8>(1);
+}
+
+TEST(GenerateMip, RGBA8_XYZ)
+{
+    TestVectorizedMip<R8G8B8A8>(4);
+    TestVectorizedMip<B8G8R8A8>(5);
+}
+
+// The random data includes denormals, infinities and NaNs.
+TEST(GenerateMip, RGBA16F_XY)
+{
+    TestVectorizedMip<R16G16B16A16F>(1);
+}
+
+TEST(GenerateMip, RGBA16F_XYZ)
+{
+    TestVectorizedMip<R16G16B16A16F>(4);
+}
+
+// Averages every half with a spread of others.
+TEST(GenerateMip, RGBA16F_AllValues)
+{
+    constexpr size_t kWidth = 65536 / 4;
+    std::vector<uint8_t> source(kWidth * 2 * 8 * 2);
+    uint16_t *halves = reinterpret_cast<uint16_t *>(source.data());
+    for (uint32_t multiplier : {1u, 3u, 40503u})
+    {
+        for (size_t i = 0; i < 65536; ++i)
+        {
+            halves[i]         = static_cast<uint16_t>(i);
+            halves[i + 65536] = static_cast<uint16_t>(i * multiplier + 12345);
+        }
+
+        std::vector<uint8_t> expected(kWidth * 8);
+        std::vector<uint8_t> actual(kWidth * 8);
+        GenerateReferenceMip<R16G16B16A16F>(kWidth * 2, 2, 1, source.data(), kWidth * 2 * 8, 0,
+                                            expected.data(), kWidth * 8, 0);
+        GenerateMip<R16G16B16A16F>(kWidth * 2, 2, 1, source.data(), kWidth * 2 * 8, 0,
+                                   actual.data(), kWidth * 8, 0);
+        EXPECT_EQ(expected, actual) << "multiplier " << multiplier;
+    }
+}
+
+struct ChainLevel
+{
+    size_t width;
+    size_t height;
+    size_t depth;
+    std::vector<uint8_t> data;
+};
+
+// Generates a mip chain level by level with |generateMip|.
+std::vector<ChainLevel> GenerateChainLevelByLevel(GenerateMipFunction generateMip,
+                                                  size_t pixelBytes,
+                                                  const ChainLevel &source,
+                                                  size_t levelCount)
+{
+    std::vector<ChainLevel> levels;
+    const ChainLevel *previous = &source;
+    for (size_t level = 0; level < levelCount; ++level)
+    {
+        ChainLevel next;
+        next.width  = std::max<size_t>(1, previous->width / 2);
+        next.height = std::max<size_t>(1, previous->height / 2);
+        next.depth  = std::max<size_t>(1, previous->depth / 2);
+        next.data.resize(next.width * next.height * next.depth * pixelBytes);
+
+        generateMip(previous->width, previous->height, previous->depth, previous->data.data(),
+                    previous->width * pixelBytes, previous->width * previous->height * pixelBytes,
+                    next.data.data(), next.width * pixelBytes,
+                    next.width * next.height * pixelBytes);
+
+        levels.push_back(std::move(next));
+        previous = &levels.back();
+    }
+    return levels;
+}
+
+void TestMipChain(GenerateMipFunction generateMip,
+                  size_t pixelBytes,
+                  size_t width,
+                  size_t height,
+                  size_t depth,
+                  WorkerThreadPool *pool)
+{
+    ChainLevel source = {width, height, depth, MakeRandomData(width * height * depth * pixelBytes,
+                                                              static_cast<uint32_t>(height))};
+
+    size_t levelCount = 0;
+    for (size_t size = std::max({width, height, depth}); size > 1; size /= 2)
+    {
+        ++levelCount;
+    }
+
+    std::vector<ChainLevel> expected =
+        GenerateChainLevelByLevel(generateMip, pixelBytes, source, levelCount);
+
+    std::vector<ChainLevel> actual = expected;
+    std::vector<MipLevelData> levelData;
+    for (ChainLevel &level : actual)
+    {
+        std::fill(level.data.begin(), level.data.end(), 0);
+        levelData.push_back({level.data.data(), level.width * pixelBytes,
+                             level.width * level.height * pixelBytes});
+    }
+
+    GenerateMipChain(generateMip, pool, width, height, depth, source.data.data(),
+                     width * pixelBytes, width * height * pixelBytes, levelData.data(),
+                     levelData.size());
+
+    for (size_t level = 0; level < levelCount; ++level)
+    {
+        EXPECT_EQ(expected[level].data, actual[level].data)
+            << width << "x" << height << "x" << depth << " level " << level + 1;
+    }
+}
+
+// Tests GenerateMipChain against generating each level separately, for sizes that are split into
+// several bands and levels whose size isn't a power of two.
+TEST(GenerateMip, Chain)
+{
+    std::shared_ptr<WorkerThreadPool> pools[] = {
+        nullptr, WorkerThreadPool::Create(1, ANGLEPlatformCurrent()),
+        WorkerThreadPool::Create(0, ANGLEPlatformCurrent())};
+
+    for (const std::shared_ptr<WorkerThreadPool> &pool : pools)
+    {
+        TestMipChain(GenerateMip<R8G8B8A8>, 4, 8192, 100, 1, pool.get());
+        TestMipChain(GenerateMip<R8G8B8A8>, 4, 8191, 99, 1, pool.get());
+        TestMipChain(GenerateMip<R8G8B8A8>, 4, 3, 1021, 1, pool.get());
+        TestMipChain(GenerateMip<R8G8B8A8>, 4, 700, 1, 1, pool.get());
+        TestMipChain(GenerateMip<R8G8B8A8>, 4, 64, 64, 70, pool.get());
+        TestMipChain(GenerateMip<R8G8B8>, 3, 1023, 517, 1, pool.get());
+        TestMipChain(GenerateMip<R16G16B16A16F>, 8, 2049, 255, 1, pool.get());
+    }
+}
+
+// Tests that GenerateMipChain doesn't wait for tasks that are already queued on the pool, such as
+// shader compilation, by generating a chain while every pool thread is blocked.
+TEST(GenerateMip, ChainWithBusyPool)
+{
+    constexpr size_t kThreadCount = 2;
+
+    std::shared_ptr<WorkerThreadPool> pool =
+        WorkerThreadPool::Create(kThreadCount, ANGLEPlatformCurrent());
+    if (!pool->isAsync())
+    {
+        GTEST_SKIP() << "Test requires a multithreaded pool";
+    }
+
+    class BlockingTask : public Closure
+    {
+      public:
+        BlockingTask(std::atomic<size_t> *startedCount, std::atomic<bool> *released)
+            : mStartedCount(startedCount), mReleased(released)
+        {}
+        void operator()() override
+        {
+            (*mStartedCount)++;
+            while (!*mReleased)
+            {
+                std::this_thread::yield();
+            }
+        }
+
+      private:
+        std::atomic<size_t> *mStartedCount;
+        std::atomic<bool> *mReleased;
+    };
+
+    std::atomic<size_t> startedCount(0);
+    std::atomic<bool> released(false);
+    std::vector<std::shared_ptr<WaitableEvent>> waitables;
+    for (size_t i = 0; i < kThreadCount; ++i)
+    {
+        waitables.push_back(
+            pool->postWorkerTask(std::make_shared<BlockingTask>(&startedCount, &released)));
+    }
+    while (startedCount < kThreadCount)
+    {
+        std::this_thread::yield();
+    }
+
+    TestMipChain(GenerateMip<R8G8B8A8>, 4, 8192, 100, 1, pool.get());
+    TestMipChain(GenerateMip<R8G8B8A8>, 4, 64, 64, 70, pool.get());
+
+    released = true;
+    WaitableEvent::WaitMany(&waitables);
+}
+}  // anonymous namespace
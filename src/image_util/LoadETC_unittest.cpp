@@ -0,0 +1,183 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// LoadETC_unittest.cpp: Tests that decoding ETC and EAC images on a worker pool produces the same
+// result as decoding them on the calling thread.
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "common/WorkerThread.h"
+#include "image_util/loadimage.h"
+#include "platform/PlatformMethods.h"
+
+using namespace angle;
+
+namespace
+{
+using LoadFunction = void (*)(const ImageLoadContext &context,
+                              size_t width,
+                              size_t height,
+                              size_t depth,
+                              const uint8_t *input,
+                              size_t inputRowPitch,
+                              size_t inputDepthPitch,
+                              uint8_t *output,
+                              size_t outputRowPitch,
+                              size_t outputDepthPitch);
+
+struct LoadFormat
+{
+    const char *name;
+    LoadFunction load;
+    size_t inputBlockBytes;
+    // Either the size of an output pixel, or the size of an output block for the functions that
+    // transcode to BC formats.
+    size_t outputPixelBytes;
+    size_t outputBlockBytes;
+};
+
+constexpr LoadFormat kLoadFormats[] = {
+    {"ETC1RGB8ToRGBA8", LoadETC1RGB8ToRGBA8, 8, 4, 0},
+    {"ETC2RGB8ToRGBA8", LoadETC2RGB8ToRGBA8, 8, 4, 0},
+    {"ETC2RGB8A1ToRGBA8", LoadETC2RGB8A1ToRGBA8, 8, 4, 0},
+    {"ETC2RGBA8ToRGBA8", LoadETC2RGBA8ToRGBA8, 16, 4, 0},
+    {"EACR11ToR8", LoadEACR11ToR8, 8, 1, 0},
+    {"EACRG11SToRG8", LoadEACRG11SToRG8, 16, 2, 0},
+    {"EACR11SToR16F", LoadEACR11SToR16F, 8, 2, 0},
+    {"EACRG11ToRG16", LoadEACRG11ToRG16, 16, 4, 0},
+    {"ETC2RGB8ToBC1", LoadETC2RGB8ToBC1, 8, 0, 8},
+    {"ETC2RGBA8ToBC3", LoadETC2RGBA8ToBC3, 16, 0, 16},
+    {"EACRG11ToBC5", LoadEACRG11ToBC5, 16, 0, 16},
+};
+
+// Image sizes that are decoded in parallel, including sizes that aren't multiples of the block
+// size, and a 3D image whose jobs span several slices.
+struct ImageSize
+{
+    size_t width;
+    size_t height;
+    size_t depth;
+};
+constexpr ImageSize kImageSizes[] = {{1024, 256, 1}, {1030, 259, 1}, {600, 157, 3}};
+
+std::vector<uint8_t> Decode(const LoadFormat &format,
+                            const ImageSize &size,
+                            const std::vector<uint8_t> &input,
+                            const std::shared_ptr<WorkerThreadPool> &pool)
+{
+    const size_t blocksPerRow    = (size.width + 3) / 4;
+    const size_t blockRowCount   = (size.height + 3) / 4;
+    const size_t inputRowPitch   = blocksPerRow * format.inputBlockBytes;
+    const size_t inputDepthPitch = inputRowPitch * blockRowCount;
+
+    size_t outputRowPitch   = size.width * format.outputPixelBytes;
+    size_t outputDepthPitch = outputRowPitch * size.height;
+    if (format.outputBlockBytes != 0)
+    {
+        outputRowPitch   = blocksPerRow * format.outputBlockBytes;
+        outputDepthPitch = outputRowPitch * blockRowCount;
+    }
+
+    ImageLoadContext context;
+    context.multiThreadPool = pool;
+
+    std::vector<uint8_t> output(outputDepthPitch * size.depth, 0xCD);
+    format.load(context, size.width, size.height, size.depth, input.data(), inputRowPitch,
+                inputDepthPitch, output.data(), outputRowPitch, outputDepthPitch);
+    return output;
+}
+
+// Decodes random blocks of every format with and without |pool|, and expects the same output.
+void TestParallelMatchesInline(const std::shared_ptr<WorkerThreadPool> &pool)
+{
+    for (const LoadFormat &format : kLoadFormats)
+    {
+        for (const ImageSize &size : kImageSizes)
+        {
+            const size_t blockCount =
+                ((size.width + 3) / 4) * ((size.height + 3) / 4) * size.depth;
+
+            std::mt19937 generator(static_cast<uint32_t>(size.width + size.height));
+            std::vector<uint8_t> input(blockCount * format.inputBlockBytes);
+            for (uint8_t &byte : input)
+            {
+                byte = static_cast<uint8_t>(generator());
+            }
+
+            EXPECT_EQ(Decode(format, size, input, nullptr), Decode(format, size, input, pool))
+                << format.name << " " << size.width << "x" << size.height << "x" << size.depth;
+        }
+    }
+}
+
+// Tests that decoding in parallel produces the same result as decoding on the calling thread.
+TEST(LoadETC, ParallelMatchesInline)
+{
+    std::shared_ptr<WorkerThreadPool> pools[] = {
+        WorkerThreadPool::Create(1, ANGLEPlatformCurrent()),
+        WorkerThreadPool::Create(0, ANGLEPlatformCurrent())};
+
+    for (const std::shared_ptr<WorkerThreadPool> &pool : pools)
+    {
+        TestParallelMatchesInline(pool);
+    }
+}
+
+// Tests that decoding doesn't wait for tasks that are already queued on the pool, such as pipeline
+// creation, by decoding while every pool thread is blocked.
+TEST(LoadETC, ParallelWithBusyPool)
+{
+    constexpr size_t kThreadCount = 2;
+
+    std::shared_ptr<WorkerThreadPool> pool =
+        WorkerThreadPool::Create(kThreadCount, ANGLEPlatformCurrent());
+    if (!pool->isAsync())
+    {
+        GTEST_SKIP() << "Test requires a multithreaded pool";
+    }
+
+    class BlockingTask : public Closure
+    {
+      public:
+        BlockingTask(std::atomic<size_t> *startedCount, std::atomic<bool> *released)
+            : mStartedCount(startedCount), mReleased(released)
+        {}
+        void operator()() override
+        {
+            (*mStartedCount)++;
+            while (!*mReleased)
+            {
+                std::this_thread::yield();
+            }
+        }
+
+      private:
+        std::atomic<size_t> *mStartedCount;
+        std::atomic<bool> *mReleased;
+    };
+
+    std::atomic<size_t> startedCount(0);
+    std::atomic<bool> released(false);
+    std::vector<std::shared_ptr<WaitableEvent>> waitables;
+    for (size_t i = 0; i < kThreadCount; ++i)
+    {
+        waitables.push_back(
+            pool->postWorkerTask(std::make_shared<BlockingTask>(&startedCount, &released)));
+    }
+    while (startedCount < kThreadCount)
+    {
+        std::this_thread::yield();
+    }
+
+    TestParallelMatchesInline(pool);
+
+    released = true;
+    WaitableEvent::WaitMany(&waitables);
+}
+}  // anonymous namespace
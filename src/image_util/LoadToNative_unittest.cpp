@@ -6,10 +6,12 @@
 // LoadToNative_unittest.cpp: Unit tests for pixel loading functions.
 
 #include <gmock/gmock.h>
+#include <random>
 #include <vector>
 #include "common/debug.h"
 #include "common/mathutil.h"
 #include "image_util/loadimage.h"
+#include "image_util/loadimage_kernels.h"
 
 using namespace angle;
 using namespace testing;
@@ -500,4 +502,151 @@ TEST(LoadToNative3To4, LoadByteRGBToRGBAWithUnalignedWidthAndAlignment4)
         TestLoadByteRGBToRGBAForAllCases(context, alignment, 5, 5, 1, 0, 0, alignment);
     }
 }
-}  // namespace
\ No newline at end of file
+using priv::LoadImageKernelLevel;
+using priv::LoadImageKernels;
+
+// Runs a kernel of every available level on random rows of various widths and source and
+// destination offsets, and compares the results with the scalar kernel.  Also checks that nothing
+// is written past the end of the row.  |runKernel| is called with the kernels, source, dest and
+// width.
+template <typename RunKernel>
+void TestKernelAgainstScalar(RunKernel runKernel, size_t sourcePixelBytes, size_t destPixelBytes)
+{
+    constexpr size_t kMaxWidth     = 67;
+    constexpr size_t kMaxOffset    = 3;
+    constexpr uint8_t kGuardValue  = 0xCD;
+    const LoadImageKernels *scalar = priv::GetLoadImageKernels(LoadImageKernelLevel::Scalar);
+
+    std::mt19937 generator(12345);
+    std::vector<uint8_t> source(kMaxWidth * sourcePixelBytes + kMaxOffset);
+    for (uint8_t &byte : source)
+    {
+        byte = static_cast<uint8_t>(generator());
+    }
+
+    for (size_t level = 0; level < static_cast<size_t>(LoadImageKernelLevel::EnumCount); ++level)
+    {
+        const LoadImageKernels *kernels =
+            priv::GetLoadImageKernels(static_cast<LoadImageKernelLevel>(level));
+        if (kernels == nullptr)
+        {
+            continue;
+        }
+
+        for (size_t width = 0; width <= kMaxWidth; ++width)
+        {
+            for (size_t offset = 0; offset <= kMaxOffset; ++offset)
+            {
+                // The source is sized exactly, so that reading past the row is caught by ASan.
+                std::vector<uint8_t> row(source.begin() + offset,
+                                         source.begin() + offset + width * sourcePixelBytes);
+                std::vector<uint8_t> expected(width * destPixelBytes + offset + 16, kGuardValue);
+                std::vector<uint8_t> actual(expected.size(), kGuardValue);
+
+                runKernel(*scalar, row.data(), expected.data() + offset, width);
+                runKernel(*kernels, row.data(), actual.data() + offset, width);
+
+                ASSERT_EQ(expected, actual)
+                    << "level " << level << ", width " << width << ", offset " << offset;
+            }
+        }
+    }
+}
+
+void TestKernelAgainstScalar(void (*LoadImageKernels::*kernel)(const uint8_t *, uint8_t *, size_t),
+                             size_t sourcePixelBytes,
+                             size_t destPixelBytes)
+{
+    TestKernelAgainstScalar(
+        [kernel](const LoadImageKernels &kernels, const uint8_t *source, uint8_t *dest,
+                 size_t width) { (kernels.*kernel)(source, dest, width); },
+        sourcePixelBytes, destPixelBytes);
+}
+
+// Tests the RGB8 to RGBA8 kernels against the scalar implementation.
+TEST(LoadImageKernels, RGB8ToRGBA8)
+{
+    for (uint8_t fourthValue : {0x01, 0x7F, 0xFF})
+    {
+        TestKernelAgainstScalar(
+            [fourthValue](const LoadImageKernels &kernels, const uint8_t *source, uint8_t *dest,
+                          size_t width) { kernels.rgb8ToRGBA8(source, dest, width, fourthValue); },
+            3, 4);
+    }
+}
+
+// Tests the RGB8 to BGRX8 kernels against the scalar implementation.
+TEST(LoadImageKernels, RGB8ToBGRX8)
+{
+    TestKernelAgainstScalar(&LoadImageKernels::rgb8ToBGRX8, 3, 4);
+}
+
+// Tests the RGBA8 to BGRA8 kernels against the scalar implementation.
+TEST(LoadImageKernels, RGBA8ToBGRA8)
+{
+    TestKernelAgainstScalar(&LoadImageKernels::rgba8ToBGRA8, 4, 4);
+}
+
+// Tests the A8 to RGBA8 kernels against the scalar implementation.
+TEST(LoadImageKernels, A8ToRGBA8)
+{
+    TestKernelAgainstScalar(&LoadImageKernels::a8ToRGBA8, 1, 4);
+}
+
+// Tests the LA8 to RGBA8 kernels against the scalar implementation.
+TEST(LoadImageKernels, LA8ToRGBA8)
+{
+    TestKernelAgainstScalar(&LoadImageKernels::la8ToRGBA8, 2, 4);
+}
+
+// Tests the RGB16F to RG11B10F kernels against the scalar implementation.
+TEST(LoadImageKernels, RGB16FToRG11B10F)
+{
+    TestKernelAgainstScalar(&LoadImageKernels::rgb16FToRG11B10F, 6, 4);
+}
+
+// Tests the D24S8 to D32FS8X24 kernels against the scalar implementation.
+TEST(LoadImageKernels, D24S8ToD32FS8X24)
+{
+    TestKernelAgainstScalar(&LoadImageKernels::d24s8ToD32FS8X24, 4, 8);
+}
+
+// Tests that the RGB16F to RG11B10F kernels convert every half float value, including denormals,
+// infinities and NaNs, exactly like the reference conversion.
+TEST(LoadImageKernels, RGB16FToRG11B10FAllValues)
+{
+    constexpr size_t kValueCount = 0x10000;
+
+    // Every value is used once in each of the three channels.
+    std::vector<uint16_t> source(3 * kValueCount);
+    for (size_t i = 0; i < kValueCount; ++i)
+    {
+        source[3 * i + 0] = static_cast<uint16_t>(i);
+        source[3 * i + 1] = static_cast<uint16_t>(i + 1);
+        source[3 * i + 2] = static_cast<uint16_t>(i + 2);
+    }
+
+    for (size_t level = 0; level < static_cast<size_t>(LoadImageKernelLevel::EnumCount); ++level)
+    {
+        const LoadImageKernels *kernels =
+            priv::GetLoadImageKernels(static_cast<LoadImageKernelLevel>(level));
+        if (kernels == nullptr)
+        {
+            continue;
+        }
+
+        std::vector<uint32_t> dest(kValueCount);
+        kernels->rgb16FToRG11B10F(reinterpret_cast<const uint8_t *>(source.data()),
+                                  reinterpret_cast<uint8_t *>(dest.data()), kValueCount);
+
+        for (size_t i = 0; i < kValueCount; ++i)
+        {
+            const uint32_t expected =
+                (gl::float32ToFloat11(gl::float16ToFloat32(source[3 * i + 0])) << 0) |
+                (gl::float32ToFloat11(gl::float16ToFloat32(source[3 * i + 1])) << 11) |
+                (gl::float32ToFloat10(gl::float16ToFloat32(source[3 * i + 2])) << 22);
+            ASSERT_EQ(expected, dest[i]) << "level " << level << ", value " << i;
+        }
+    }
+}
+}  // namespace
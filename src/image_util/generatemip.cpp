@@ -0,0 +1,535 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// generatemip.cpp: Implements the vectorized mip row filters and GenerateMipChain.
+//   The vector filters use SSE2 on x86-64 and NEON on arm64, which are always available there.
+//   Other targets use the formats' average() functions.
+
+#include "image_util/generatemip.h"
+
+#include <string.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "common/WorkerThread.h"
+#include "common/debug.h"
+#include "common/mathutil.h"
+#include "image_util/imageformats.h"
+
+#if defined(_M_X64) || defined(__x86_64__)
+#    define ANGLE_GENERATEMIP_SSE2 1
+#    include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#    define ANGLE_GENERATEMIP_NEON 1
+#    include <arm_neon.h>
+#endif
+
+namespace angle
+{
+namespace
+{
+// A band of source rows and the rows it produces in the next levels should fit in the L2 cache.
+constexpr size_t kBandBytes = 256 * 1024;
+// Levels smaller than this are not worth splitting across threads.
+constexpr size_t kMinParallelBytes = 1024 * 1024;
+// The number of levels produced from each band of source rows in one pass.
+constexpr size_t kMaxLevelsPerPass = 4;
+
+// Scalar filters, also used for the end of the row by the vector filters.
+template <typename T>
+void GenerateMipRowScalar_XY(const uint8_t *sourceRow0,
+                             const uint8_t *sourceRow1,
+                             uint8_t *destRow,
+                             size_t destBegin,
+                             size_t destEnd)
+{
+    const T *src0 = reinterpret_cast<const T *>(sourceRow0);
+    const T *src1 = reinterpret_cast<const T *>(sourceRow1);
+    T *dst        = reinterpret_cast<T *>(destRow);
+
+    for (size_t x = destBegin; x < destEnd; x++)
+    {
+        T tmp0, tmp1;
+        T::average(&tmp0, &src0[x * 2], &src1[x * 2]);
+        T::average(&tmp1, &src0[x * 2 + 1], &src1[x * 2 + 1]);
+        T::average(&dst[x], &tmp0, &tmp1);
+    }
+}
+
+template <typename T>
+void GenerateMipRowScalar_XYZ(const uint8_t *sourceRow00,
+                              const uint8_t *sourceRow01,
+                              const uint8_t *sourceRow10,
+                              const uint8_t *sourceRow11,
+                              uint8_t *destRow,
+                              size_t destBegin,
+                              size_t destEnd)
+{
+    const T *src00 = reinterpret_cast<const T *>(sourceRow00);
+    const T *src01 = reinterpret_cast<const T *>(sourceRow01);
+    const T *src10 = reinterpret_cast<const T *>(sourceRow10);
+    const T *src11 = reinterpret_cast<const T *>(sourceRow11);
+    T *dst         = reinterpret_cast<T *>(destRow);
+
+    for (size_t x = destBegin; x < destEnd; x++)
+    {
+        T tmp0, tmp1, tmp2, tmp3, tmp4, tmp5;
+        T::average(&tmp0, &src00[x * 2], &src01[x * 2]);
+        T::average(&tmp1, &src10[x * 2], &src11[x * 2]);
+        T::average(&tmp2, &src00[x * 2 + 1], &src01[x * 2 + 1]);
+        T::average(&tmp3, &src10[x * 2 + 1], &src11[x * 2 + 1]);
+        T::average(&tmp4, &tmp0, &tmp1);
+        T::average(&tmp5, &tmp2, &tmp3);
+        T::average(&dst[x], &tmp4, &tmp5);
+    }
+}
+
+#if defined(ANGLE_GENERATEMIP_SSE2)
+ANGLE_INLINE __m128i Load128(const uint8_t *source)
+{
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(source));
+}
+
+ANGLE_INLINE void Store128(uint8_t *dest, __m128i value)
+{
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dest), value);
+}
+
+ANGLE_INLINE __m128i Select(__m128i mask, __m128i ifTrue, __m128i ifFalse)
+{
+    return _mm_or_si128(_mm_and_si128(mask, ifTrue), _mm_andnot_si128(mask, ifFalse));
+}
+
+// Per-byte (a + b) >> 1, like the 8-bit formats' average().  _mm_avg_epu8 rounds up instead.
+ANGLE_INLINE __m128i AverageBytes(__m128i a, __m128i b)
+{
+    const __m128i halfMask = _mm_set1_epi8(0x7F);
+    __m128i halfDiff       = _mm_and_si128(_mm_srli_epi16(_mm_xor_si128(a, b), 1), halfMask);
+    return _mm_add_epi8(_mm_and_si128(a, b), halfDiff);
+}
+
+// Averages pixels 2i and 2i+1 of the eight 32-bit pixels in |lo| and |hi|.
+ANGLE_INLINE __m128i AverageAdjacentPixels32(__m128i lo, __m128i hi)
+{
+    __m128 loF   = _mm_castsi128_ps(lo);
+    __m128 hiF   = _mm_castsi128_ps(hi);
+    __m128i even = _mm_castps_si128(_mm_shuffle_ps(loF, hiF, _MM_SHUFFLE(2, 0, 2, 0)));
+    __m128i odd  = _mm_castps_si128(_mm_shuffle_ps(loF, hiF, _MM_SHUFFLE(3, 1, 3, 1)));
+    return AverageBytes(even, odd);
+}
+
+// Exact conversion of four halves, zero-extended to 32 bits, to floats.
+ANGLE_INLINE __m128 HalfToFloat(__m128i half)
+{
+    const __m128i exponentMask = _mm_set1_epi32(0x7C00 << 13);
+    const __m128i rebias       = _mm_set1_epi32((127 - 15) << 23);
+    const __m128 denormMagic   = _mm_castsi128_ps(_mm_set1_epi32(113 << 23));
+
+    __m128i bits     = _mm_slli_epi32(_mm_and_si128(half, _mm_set1_epi32(0x7FFF)), 13);
+    __m128i exponent = _mm_and_si128(bits, exponentMask);
+    bits             = _mm_add_epi32(bits, rebias);
+
+    // Inf and NaN keep the maximum exponent.
+    __m128i infNaN = _mm_cmpeq_epi32(exponent, exponentMask);
+    bits           = _mm_add_epi32(bits, _mm_and_si128(infNaN, rebias));
+
+    // Denormals are renormalized by the float unit.
+    __m128i denorm = _mm_cmpeq_epi32(exponent, _mm_setzero_si128());
+    __m128 renormalized =
+        _mm_sub_ps(_mm_castsi128_ps(_mm_add_epi32(bits, _mm_set1_epi32(1 << 23))), denormMagic);
+    bits = Select(denorm, _mm_castps_si128(renormalized), bits);
+
+    __m128i sign = _mm_slli_epi32(_mm_and_si128(half, _mm_set1_epi32(0x8000)), 16);
+    return _mm_castsi128_ps(_mm_or_si128(bits, sign));
+}
+
+// Same as gl::float32ToFloat16, for four floats.  The halves are zero-extended to 32 bits.
+ANGLE_INLINE __m128i FloatToHalf(__m128 value)
+{
+    const __m128i one = _mm_set1_epi32(1);
+
+    __m128i bits = _mm_castps_si128(value);
+    __m128i sign = _mm_and_si128(_mm_srli_epi32(bits, 16), _mm_set1_epi32(0x8000));
+    __m128i abs  = _mm_and_si128(bits, _mm_set1_epi32(0x7FFFFFFF));
+
+    const __m128i normalBias = _mm_set1_epi32(static_cast<int>(0xC8000000 + 0x00000FFF));
+    __m128i normal           = _mm_add_epi32(abs, normalBias);
+    normal = _mm_srli_epi32(_mm_add_epi32(normal, _mm_and_si128(_mm_srli_epi32(abs, 13), one)), 13);
+
+    // gl::float32ToFloat16 truncates the denormal mantissa to 1.m * 2^(E - 113), i.e. floor(x *
+    // 2^37), before rounding it.  The float unit computes that exactly.
+    const __m128 denormScale = _mm_castsi128_ps(_mm_set1_epi32((127 + 37) << 23));
+    __m128i truncated = _mm_cvttps_epi32(_mm_mul_ps(_mm_castsi128_ps(abs), denormScale));
+    __m128i denorm    = _mm_add_epi32(truncated, _mm_set1_epi32(0x00000FFF));
+    denorm            = _mm_add_epi32(denorm, _mm_and_si128(_mm_srli_epi32(truncated, 13), one));
+    denorm            = _mm_srli_epi32(denorm, 13);
+
+    __m128i isDenorm = _mm_cmplt_epi32(abs, _mm_set1_epi32(0x38800000));
+    __m128i isInf    = _mm_cmpgt_epi32(abs, _mm_set1_epi32(0x47FFEFFF));
+    __m128i isNaN    = _mm_cmpgt_epi32(abs, _mm_set1_epi32(0x7F800000));
+
+    __m128i result = _mm_or_si128(sign, Select(isDenorm, denorm, normal));
+    result         = Select(isInf, _mm_or_si128(sign, _mm_set1_epi32(0x7C00)), result);
+    return Select(isNaN, _mm_set1_epi32(0x7FFF), result);
+}
+
+// Narrows four 32-bit values below 0x10000 in each of |lo| and |hi| to eight 16-bit values.
+ANGLE_INLINE __m128i Pack32To16(__m128i lo, __m128i hi)
+{
+    lo = _mm_srai_epi32(_mm_slli_epi32(lo, 16), 16);
+    hi = _mm_srai_epi32(_mm_slli_epi32(hi, 16), 16);
+    return _mm_packs_epi32(lo, hi);
+}
+
+// Same as gl::averageHalfFloat, for eight halves.
+ANGLE_INLINE __m128i AverageHalves(__m128i a, __m128i b)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128 half  = _mm_set1_ps(0.5f);
+
+    __m128 sumLo = _mm_add_ps(HalfToFloat(_mm_unpacklo_epi16(a, zero)),
+                              HalfToFloat(_mm_unpacklo_epi16(b, zero)));
+    __m128 sumHi = _mm_add_ps(HalfToFloat(_mm_unpackhi_epi16(a, zero)),
+                              HalfToFloat(_mm_unpackhi_epi16(b, zero)));
+    return Pack32To16(FloatToHalf(_mm_mul_ps(sumLo, half)), FloatToHalf(_mm_mul_ps(sumHi, half)));
+}
+
+// Averages pixels 2i and 2i+1 of the four 64-bit pixels in |lo| and |hi|.
+ANGLE_INLINE __m128i AverageAdjacentPixels64(__m128i lo, __m128i hi)
+{
+    return AverageHalves(_mm_unpacklo_epi64(lo, hi), _mm_unpackhi_epi64(lo, hi));
+}
+#endif  // defined(ANGLE_GENERATEMIP_SSE2)
+
+#if defined(ANGLE_GENERATEMIP_NEON)
+// Loads eight 32-bit pixels, with the even pixels in val[0] and the odd ones in val[1].
+ANGLE_INLINE uint8x16x2_t LoadPixelPairs32(const uint8_t *source)
+{
+    uint32x4x2_t pixels;
+    uint32_t words[8];
+    memcpy(words, source, sizeof(words));
+    pixels = vld2q_u32(words);
+    return {{vreinterpretq_u8_u32(pixels.val[0]), vreinterpretq_u8_u32(pixels.val[1])}};
+}
+
+ANGLE_INLINE uint32x4_t HalfToFloatBits(uint16x4_t half)
+{
+    return vreinterpretq_u32_f32(vcvt_f32_f16(vreinterpret_f16_u16(half)));
+}
+
+// Same as gl::float32ToFloat16, for four floats.  See the SSE2 version for the denormal case.
+ANGLE_INLINE uint16x4_t FloatToHalf(float32x4_t value)
+{
+    uint32x4_t bits = vreinterpretq_u32_f32(value);
+    uint32x4_t sign = vandq_u32(vshrq_n_u32(bits, 16), vdupq_n_u32(0x8000));
+    uint32x4_t abs  = vandq_u32(bits, vdupq_n_u32(0x7FFFFFFF));
+
+    uint32x4_t normal = vaddq_u32(abs, vdupq_n_u32(0xC8000000 + 0x00000FFF));
+    normal = vshrq_n_u32(vaddq_u32(normal, vandq_u32(vshrq_n_u32(abs, 13), vdupq_n_u32(1))), 13);
+
+    uint32x4_t truncated =
+        vcvtq_u32_f32(vmulq_f32(vreinterpretq_f32_u32(abs), vdupq_n_f32(137438953472.0f)));
+    uint32x4_t denorm = vaddq_u32(truncated, vdupq_n_u32(0x00000FFF));
+    denorm = vshrq_n_u32(vaddq_u32(denorm, vandq_u32(vshrq_n_u32(truncated, 13), vdupq_n_u32(1))),
+                         13);
+
+    uint32x4_t result = vorrq_u32(sign, vbslq_u32(vcltq_u32(abs, vdupq_n_u32(0x38800000)), denorm,
+                                                  normal));
+    result = vbslq_u32(vcgtq_u32(abs, vdupq_n_u32(0x47FFEFFF)),
+                       vorrq_u32(sign, vdupq_n_u32(0x7C00)), result);
+    result = vbslq_u32(vcgtq_u32(abs, vdupq_n_u32(0x7F800000)), vdupq_n_u32(0x7FFF), result);
+    return vmovn_u32(result);
+}
+
+// Same as gl::averageHalfFloat, for eight halves.
+ANGLE_INLINE uint16x8_t AverageHalves(uint16x8_t a, uint16x8_t b)
+{
+    float32x4_t sumLo = vaddq_f32(vreinterpretq_f32_u32(HalfToFloatBits(vget_low_u16(a))),
+                                  vreinterpretq_f32_u32(HalfToFloatBits(vget_low_u16(b))));
+    float32x4_t sumHi = vaddq_f32(vreinterpretq_f32_u32(HalfToFloatBits(vget_high_u16(a))),
+                                  vreinterpretq_f32_u32(HalfToFloatBits(vget_high_u16(b))));
+    return vcombine_u16(FloatToHalf(vmulq_n_f32(sumLo, 0.5f)),
+                        FloatToHalf(vmulq_n_f32(sumHi, 0.5f)));
+}
+
+// Averages pixels 2i and 2i+1 of the four 64-bit pixels in |lo| and |hi|.
+ANGLE_INLINE uint16x8_t AverageAdjacentPixels64(uint16x8_t lo, uint16x8_t hi)
+{
+    uint64x2_t lo64 = vreinterpretq_u64_u16(lo);
+    uint64x2_t hi64 = vreinterpretq_u64_u16(hi);
+    uint16x8_t even = vreinterpretq_u16_u64(vzip1q_u64(lo64, hi64));
+    uint16x8_t odd  = vreinterpretq_u16_u64(vzip2q_u64(lo64, hi64));
+    return AverageHalves(even, odd);
+}
+#endif  // defined(ANGLE_GENERATEMIP_NEON)
+
+struct Level
+{
+    size_t width;
+    size_t height;
+    size_t depth;
+    const uint8_t *sourceData;
+    uint8_t *destData;
+    size_t rowPitch;
+    size_t depthPitch;
+};
+
+// Generates levels [first + 1, first + passLevelCount] from level |first|.
+void GenerateMipPass(GenerateMipFunction generateMip,
+                     WorkerThreadPool *workerPool,
+                     const Level *levels,
+                     size_t first,
+                     size_t passLevelCount)
+{
+    const Level &source = levels[first];
+    const bool parallel = source.rowPitch * source.height * source.depth >= kMinParallelBytes;
+
+    if (source.depth > 1)
+    {
+        // Split 3D levels into groups of destination slices.
+        ASSERT(passLevelCount == 1);
+        const Level &dest          = levels[first + 1];
+        const size_t slicesPerBand = std::max<size_t>(1, kBandBytes / (2 * source.depthPitch));
+        const size_t bandCount     = (dest.depth + slicesPerBand - 1) / slicesPerBand;
+
+        RunParallelJobs(parallel ? workerPool : nullptr, bandCount, [&](size_t band) {
+            const size_t z0 = band * slicesPerBand;
+            const size_t z1 = std::min(z0 + slicesPerBand, dest.depth);
+            generateMip(source.width, source.height, 2 * (z1 - z0),
+                        source.sourceData + 2 * z0 * source.depthPitch, source.rowPitch,
+                        source.depthPitch, dest.destData + z0 * dest.depthPitch, dest.rowPitch,
+                        dest.depthPitch);
+        });
+        return;
+    }
+
+    if (source.height == 1)
+    {
+        ASSERT(passLevelCount == 1);
+        const Level &dest = levels[first + 1];
+        generateMip(source.width, source.height, 1, source.sourceData, source.rowPitch,
+                    source.depthPitch, dest.destData, dest.rowPitch, dest.depthPitch);
+        return;
+    }
+
+    // Split 2D levels into bands of source rows.  Band boundaries are multiples of
+    // 2^passLevelCount, so each band produces whole rows of every level in the pass.  Levels keep
+    // the same filter when they are generated in bands, since every band of a level taller than
+    // one row is at least two rows tall.
+    const size_t bandAlignment = size_t(1) << passLevelCount;
+    size_t rowsPerBand         = std::max<size_t>(1, kBandBytes / source.rowPitch);
+    rowsPerBand                = rx::roundUpPow2(rowsPerBand, bandAlignment);
+    const size_t bandCount     = (source.height + rowsPerBand - 1) / rowsPerBand;
+
+    RunParallelJobs(parallel ? workerPool : nullptr, bandCount, [&](size_t band) {
+        const size_t begin = band * rowsPerBand;
+        const size_t end   = std::min(begin + rowsPerBand, source.height);
+
+        for (size_t level = 1; level <= passLevelCount; ++level)
+        {
+            const Level &src  = levels[first + level - 1];
+            const Level &dest = levels[first + level];
+            const size_t y0   = begin >> level;
+            const size_t y1   = std::min(end >> level, dest.height);
+            if (y1 <= y0)
+            {
+                break;
+            }
+            generateMip(src.width, 2 * (y1 - y0), 1, src.sourceData + 2 * y0 * src.rowPitch,
+                        src.rowPitch, src.depthPitch, dest.destData + y0 * dest.rowPitch,
+                        dest.rowPitch, dest.depthPitch);
+        }
+    });
+}
+}  // anonymous namespace
+
+void GenerateMipChain(GenerateMipFunction generateMip,
+                      WorkerThreadPool *workerPool,
+                      size_t sourceWidth,
+                      size_t sourceHeight,
+                      size_t sourceDepth,
+                      const uint8_t *sourceData,
+                      size_t sourceRowPitch,
+                      size_t sourceDepthPitch,
+                      const MipLevelData *levels,
+                      size_t levelCount)
+{
+    std::vector<Level> chain(levelCount + 1);
+    chain[0] = {sourceWidth, sourceHeight,   sourceDepth,     sourceData,
+                nullptr,     sourceRowPitch, sourceDepthPitch};
+    for (size_t level = 1; level <= levelCount; ++level)
+    {
+        const Level &previous = chain[level - 1];
+        Level &current        = chain[level];
+        current.width         = std::max<size_t>(1, previous.width >> 1);
+        current.height        = std::max<size_t>(1, previous.height >> 1);
+        current.depth         = std::max<size_t>(1, previous.depth >> 1);
+        current.sourceData    = levels[level - 1].data;
+        current.destData      = levels[level - 1].data;
+        current.rowPitch      = levels[level - 1].rowPitch;
+        current.depthPitch    = levels[level - 1].depthPitch;
+    }
+
+    size_t first = 0;
+    while (first < levelCount)
+    {
+        // 2D levels taller than a row are generated several at a time.  Others one at a time.
+        size_t passLevelCount = 1;
+        if (chain[first].depth == 1)
+        {
+            while (passLevelCount < kMaxLevelsPerPass && first + passLevelCount < levelCount &&
+                   chain[first + passLevelCount].height > 1)
+            {
+                ++passLevelCount;
+            }
+        }
+
+        GenerateMipPass(generateMip, workerPool, chain.data(), first, passLevelCount);
+        first += passLevelCount;
+    }
+}
+
+namespace priv
+{
+void GenerateMipRow_XY_RGBA8(const uint8_t *sourceRow0,
+                             const uint8_t *sourceRow1,
+                             uint8_t *destRow,
+                             size_t destWidth)
+{
+    size_t x = 0;
+#if defined(ANGLE_GENERATEMIP_SSE2)
+    for (; x + 4 <= destWidth; x += 4)
+    {
+        __m128i lo = AverageBytes(Load128(sourceRow0 + 8 * x), Load128(sourceRow1 + 8 * x));
+        __m128i hi =
+            AverageBytes(Load128(sourceRow0 + 8 * x + 16), Load128(sourceRow1 + 8 * x + 16));
+        Store128(destRow + 4 * x, AverageAdjacentPixels32(lo, hi));
+    }
+#elif defined(ANGLE_GENERATEMIP_NEON)
+    for (; x + 4 <= destWidth; x += 4)
+    {
+        uint8x16x2_t row0 = LoadPixelPairs32(sourceRow0 + 8 * x);
+        uint8x16x2_t row1 = LoadPixelPairs32(sourceRow1 + 8 * x);
+        uint8x16_t even   = vhaddq_u8(row0.val[0], row1.val[0]);
+        uint8x16_t odd    = vhaddq_u8(row0.val[1], row1.val[1]);
+        vst1q_u8(destRow + 4 * x, vhaddq_u8(even, odd));
+    }
+#endif
+    GenerateMipRowScalar_XY<R8G8B8A8>(sourceRow0, sourceRow1, destRow, x, destWidth);
+}
+
+void GenerateMipRow_XYZ_RGBA8(const uint8_t *sourceRow00,
+                              const uint8_t *sourceRow01,
+                              const uint8_t *sourceRow10,
+                              const uint8_t *sourceRow11,
+                              uint8_t *destRow,
+                              size_t destWidth)
+{
+    size_t x = 0;
+#if defined(ANGLE_GENERATEMIP_SSE2)
+    for (; x + 4 <= destWidth; x += 4)
+    {
+        __m128i filtered[2];
+        for (size_t half = 0; half < 2; ++half)
+        {
+            const size_t offset = 8 * x + 16 * half;
+            __m128i y0 = AverageBytes(Load128(sourceRow00 + offset), Load128(sourceRow01 + offset));
+            __m128i y1 = AverageBytes(Load128(sourceRow10 + offset), Load128(sourceRow11 + offset));
+            filtered[half] = AverageBytes(y0, y1);
+        }
+        Store128(destRow + 4 * x, AverageAdjacentPixels32(filtered[0], filtered[1]));
+    }
+#elif defined(ANGLE_GENERATEMIP_NEON)
+    for (; x + 4 <= destWidth; x += 4)
+    {
+        uint8x16x2_t row00 = LoadPixelPairs32(sourceRow00 + 8 * x);
+        uint8x16x2_t row01 = LoadPixelPairs32(sourceRow01 + 8 * x);
+        uint8x16x2_t row10 = LoadPixelPairs32(sourceRow10 + 8 * x);
+        uint8x16x2_t row11 = LoadPixelPairs32(sourceRow11 + 8 * x);
+        uint8x16_t even    = vhaddq_u8(vhaddq_u8(row00.val[0], row01.val[0]),
+                                       vhaddq_u8(row10.val[0], row11.val[0]));
+        uint8x16_t odd     = vhaddq_u8(vhaddq_u8(row00.val[1], row01.val[1]),
+                                       vhaddq_u8(row10.val[1], row11.val[1]));
+        vst1q_u8(destRow + 4 * x, vhaddq_u8(even, odd));
+    }
+#endif
+    GenerateMipRowScalar_XYZ<R8G8B8A8>(sourceRow00, sourceRow01, sourceRow10, sourceRow11, destRow,
+                                       x, destWidth);
+}
+
+void GenerateMipRow_XY_RGBA16F(const uint8_t *sourceRow0,
+                               const uint8_t *sourceRow1,
+                               uint8_t *destRow,
+                               size_t destWidth)
+{
+    size_t x = 0;
+#if defined(ANGLE_GENERATEMIP_SSE2)
+    for (; x + 2 <= destWidth; x += 2)
+    {
+        __m128i lo = AverageHalves(Load128(sourceRow0 + 16 * x), Load128(sourceRow1 + 16 * x));
+        __m128i hi =
+            AverageHalves(Load128(sourceRow0 + 16 * x + 16), Load128(sourceRow1 + 16 * x + 16));
+        Store128(destRow + 8 * x, AverageAdjacentPixels64(lo, hi));
+    }
+#elif defined(ANGLE_GENERATEMIP_NEON)
+    for (; x + 2 <= destWidth; x += 2)
+    {
+        const uint16_t *row0 = reinterpret_cast<const uint16_t *>(sourceRow0) + 8 * x;
+        const uint16_t *row1 = reinterpret_cast<const uint16_t *>(sourceRow1) + 8 * x;
+        uint16x8_t lo        = AverageHalves(vld1q_u16(row0), vld1q_u16(row1));
+        uint16x8_t hi        = AverageHalves(vld1q_u16(row0 + 8), vld1q_u16(row1 + 8));
+        vst1q_u16(reinterpret_cast<uint16_t *>(destRow) + 4 * x, AverageAdjacentPixels64(lo, hi));
+    }
+#endif
+    GenerateMipRowScalar_XY<R16G16B16A16F>(sourceRow0, sourceRow1, destRow, x, destWidth);
+}
+
+void GenerateMipRow_XYZ_RGBA16F(const uint8_t *sourceRow00,
+                                const uint8_t *sourceRow01,
+                                const uint8_t *sourceRow10,
+                                const uint8_t *sourceRow11,
+                                uint8_t *destRow,
+                                size_t destWidth)
+{
+    size_t x = 0;
+#if defined(ANGLE_GENERATEMIP_SSE2)
+    for (; x + 2 <= destWidth; x += 2)
+    {
+        __m128i filtered[2];
+        for (size_t half = 0; half < 2; ++half)
+        {
+            const size_t offset = 16 * x + 16 * half;
+            __m128i y0 =
+                AverageHalves(Load128(sourceRow00 + offset), Load128(sourceRow01 + offset));
+            __m128i y1 =
+                AverageHalves(Load128(sourceRow10 + offset), Load128(sourceRow11 + offset));
+            filtered[half] = AverageHalves(y0, y1);
+        }
+        Store128(destRow + 8 * x, AverageAdjacentPixels64(filtered[0], filtered[1]));
+    }
+#elif defined(ANGLE_GENERATEMIP_NEON)
+    for (; x + 2 <= destWidth; x += 2)
+    {
+        uint16x8_t filtered[2];
+        for (size_t half = 0; half < 2; ++half)
+        {
+            const size_t offset   = 8 * x + 8 * half;
+            const uint16_t *row00 = reinterpret_cast<const uint16_t *>(sourceRow00) + offset;
+            const uint16_t *row01 = reinterpret_cast<const uint16_t *>(sourceRow01) + offset;
+            const uint16_t *row10 = reinterpret_cast<const uint16_t *>(sourceRow10) + offset;
+            const uint16_t *row11 = reinterpret_cast<const uint16_t *>(sourceRow11) + offset;
+            filtered[half] = AverageHalves(AverageHalves(vld1q_u16(row00), vld1q_u16(row01)),
+                                           AverageHalves(vld1q_u16(row10), vld1q_u16(row11)));
+        }
+        vst1q_u16(reinterpret_cast<uint16_t *>(destRow) + 4 * x,
+                  AverageAdjacentPixels64(filtered[0], filtered[1]));
+    }
+#endif
+    GenerateMipRowScalar_XYZ<R16G16B16A16F>(sourceRow00, sourceRow01, sourceRow10, sourceRow11,
+                                            destRow, x, destWidth);
+}
+}  // namespace priv
+}  // namespace angle
@@ -5,7 +5,8 @@
 //
 
 // generatemip.h: Defines the GenerateMip function, templated on the format
-// type of the image for which mip levels are being generated.
+// type of the image for which mip levels are being generated, and GenerateMipChain,
+// which generates several levels at once on a worker pool.
 
 #ifndef IMAGEUTIL_GENERATEMIP_H_
 #define IMAGEUTIL_GENERATEMIP_H_
@@ -15,6 +16,72 @@
 
 namespace angle
 {
+class WorkerThreadPool;
+
+// The type of every GenerateMip<T> instantiation.
+using GenerateMipFunction = void (*)(size_t sourceWidth,
+                                     size_t sourceHeight,
+                                     size_t sourceDepth,
+                                     const uint8_t *sourceData,
+                                     size_t sourceRowPitch,
+                                     size_t sourceDepthPitch,
+                                     uint8_t *destData,
+                                     size_t destRowPitch,
+                                     size_t destDepthPitch);
+
+struct MipLevelData
+{
+    uint8_t *data;
+    size_t rowPitch;
+    size_t depthPitch;
+};
+
+// Generates |levelCount| mip levels below the source image, each from the previous one, with
+// |generateMip|.  The result is identical to calling |generateMip| level by level, but:
+//
+// - 2D images are filtered in bands of source rows that produce the matching rows of the next few
+//   levels while the band is still in cache, so the source is read only once.
+// - Large images are split into bands (or groups of slices for 3D images) that are filtered in
+//   parallel on |workerPool|, if it is asynchronous.  The calling thread filters bands too, and
+//   doesn't wait for other tasks queued on |workerPool|.  |workerPool| may be null.
+void GenerateMipChain(GenerateMipFunction generateMip,
+                      WorkerThreadPool *workerPool,
+                      size_t sourceWidth,
+                      size_t sourceHeight,
+                      size_t sourceDepth,
+                      const uint8_t *sourceData,
+                      size_t sourceRowPitch,
+                      size_t sourceDepthPitch,
+                      const MipLevelData *levels,
+                      size_t levelCount);
+
+namespace priv
+{
+// Vectorized box filters for one row of destination pixels, used by GenerateMip for the formats
+// below.  XY filters the 2x2 blocks of |sourceRow0| and |sourceRow1|.  XYZ filters the 2x2x2 blocks
+// of two rows in two slices, where |sourceRowYZ| is the row at y+Y in slice z+Z.  The results are
+// bit-exact with the formats' average() functions.
+void GenerateMipRow_XY_RGBA8(const uint8_t *sourceRow0,
+                             const uint8_t *sourceRow1,
+                             uint8_t *destRow,
+                             size_t destWidth);
+void GenerateMipRow_XYZ_RGBA8(const uint8_t *sourceRow00,
+                              const uint8_t *sourceRow01,
+                              const uint8_t *sourceRow10,
+                              const uint8_t *sourceRow11,
+                              uint8_t *destRow,
+                              size_t destWidth);
+void GenerateMipRow_XY_RGBA16F(const uint8_t *sourceRow0,
+                               const uint8_t *sourceRow1,
+                               uint8_t *destRow,
+                               size_t destWidth);
+void GenerateMipRow_XYZ_RGBA16F(const uint8_t *sourceRow00,
+                                const uint8_t *sourceRow01,
+                                const uint8_t *sourceRow10,
+                                const uint8_t *sourceRow11,
+                                uint8_t *destRow,
+                                size_t destWidth);
+}  // namespace priv
 
 template <typename T>
 inline void GenerateMip(size_t sourceWidth,
@@ -8,7 +8,10 @@
 
 #include "image_util/loadimage.h"
 
+#include <algorithm>
 #include <type_traits>
+
+#include "common/WorkerThread.h"
 #include "common/mathutil.h"
 
 #include "image_util/imageformats.h"
@@ -1470,6 +1473,52 @@ static const uint8_t DefaultETCAlphaValues[4][4] =
 };
 
 // clang-format on
+
+// Images with fewer blocks than this are not worth splitting across threads.
+constexpr size_t kMinParallelBlocks = 16 * 1024;
+// The number of blocks decoded by each job.  Small enough that the jobs balance across threads,
+// and large enough that posting them is cheap in comparison.
+constexpr size_t kBlocksPerJob = 4 * 1024;
+
+// Calls |decodeRow(y, z)| for the first pixel row |y| of every row of blocks of every slice |z|.
+// Rows of blocks are independent, so large images are decoded in tiles of rows on the worker
+// pool.  |decodeRow| may be called concurrently and must only write to its own row of blocks.
+template <typename DecodeRowFunc>
+void ForEachBlockRow(const ImageLoadContext &context,
+                     size_t width,
+                     size_t height,
+                     size_t depth,
+                     DecodeRowFunc &&decodeRow)
+{
+    const size_t blocksPerRow    = (width + 3) / 4;
+    const size_t blockRowCount   = (height + 3) / 4;
+    const size_t totalRowCount   = blockRowCount * depth;
+    WorkerThreadPool *workerPool = context.multiThreadPool.get();
+
+    if (workerPool == nullptr || blocksPerRow * totalRowCount < kMinParallelBlocks)
+    {
+        for (size_t z = 0; z < depth; z++)
+        {
+            for (size_t y = 0; y < height; y += 4)
+            {
+                decodeRow(y, z);
+            }
+        }
+        return;
+    }
+
+    const size_t rowsPerJob = std::max<size_t>(1, kBlocksPerJob / blocksPerRow);
+    const size_t jobCount   = (totalRowCount + rowsPerJob - 1) / rowsPerJob;
+    RunParallelJobs(workerPool, jobCount, [&](size_t job) {
+        const size_t begin = job * rowsPerJob;
+        const size_t end   = std::min(begin + rowsPerJob, totalRowCount);
+        for (size_t row = begin; row < end; row++)
+        {
+            decodeRow((row % blockRowCount) * 4, row / blockRowCount);
+        }
+    });
+}
+
 void LoadR11EACToR8(const ImageLoadContext &context,
                     size_t width,
                     size_t height,
@@ -1482,25 +1531,21 @@ void LoadR11EACToR8(const ImageLoadContext &context,
                     size_t outputDepthPitch,
                     bool isSigned)
 {
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y += 4)
-        {
-            const ETC2Block *sourceRow =
-                priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
-            uint8_t *destRow =
-                priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
+    ForEachBlockRow(context, width, height, depth, [&](size_t y, size_t z) {
+        const ETC2Block *sourceRow =
+            priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
+        uint8_t *destRow =
+            priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
 
-            for (size_t x = 0; x < width; x += 4)
-            {
-                const ETC2Block *sourceBlock = sourceRow + (x / 4);
-                uint8_t *destPixels          = destRow + x;
+        for (size_t x = 0; x < width; x += 4)
+        {
+            const ETC2Block *sourceBlock = sourceRow + (x / 4);
+            uint8_t *destPixels          = destRow + x;
 
-                sourceBlock->decodeAsSingleETC2Channel(destPixels, x, y, width, height, 1,
-                                                       outputRowPitch, isSigned);
-            }
+            sourceBlock->decodeAsSingleETC2Channel(destPixels, x, y, width, height, 1,
+                                                   outputRowPitch, isSigned);
         }
-    }
+    });
 }
 
 void LoadRG11EACToRG8(const ImageLoadContext &context,
@@ -1515,29 +1560,25 @@ void LoadRG11EACToRG8(const ImageLoadContext &context,
                       size_t outputDepthPitch,
                       bool isSigned)
 {
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y += 4)
-        {
-            const ETC2Block *sourceRow =
-                priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
-            uint8_t *destRow =
-                priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
+    ForEachBlockRow(context, width, height, depth, [&](size_t y, size_t z) {
+        const ETC2Block *sourceRow =
+            priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
+        uint8_t *destRow =
+            priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
 
-            for (size_t x = 0; x < width; x += 4)
-            {
-                uint8_t *destPixelsRed          = destRow + (x * 2);
-                const ETC2Block *sourceBlockRed = sourceRow + (x / 2);
-                sourceBlockRed->decodeAsSingleETC2Channel(destPixelsRed, x, y, width, height, 2,
-                                                          outputRowPitch, isSigned);
-
-                uint8_t *destPixelsGreen          = destPixelsRed + 1;
-                const ETC2Block *sourceBlockGreen = sourceBlockRed + 1;
-                sourceBlockGreen->decodeAsSingleETC2Channel(destPixelsGreen, x, y, width, height, 2,
-                                                            outputRowPitch, isSigned);
-            }
+        for (size_t x = 0; x < width; x += 4)
+        {
+            uint8_t *destPixelsRed          = destRow + (x * 2);
+            const ETC2Block *sourceBlockRed = sourceRow + (x / 2);
+            sourceBlockRed->decodeAsSingleETC2Channel(destPixelsRed, x, y, width, height, 2,
+                                                      outputRowPitch, isSigned);
+
+            uint8_t *destPixelsGreen          = destPixelsRed + 1;
+            const ETC2Block *sourceBlockGreen = sourceBlockRed + 1;
+            sourceBlockGreen->decodeAsSingleETC2Channel(destPixelsGreen, x, y, width, height, 2,
+                                                        outputRowPitch, isSigned);
         }
-    }
+    });
 }
 
 void LoadR11EACToR16(const ImageLoadContext &context,
@@ -1553,25 +1594,21 @@ void LoadR11EACToR16(const ImageLoadContext &context,
                      bool isSigned,
                      bool isFloat)
 {
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y += 4)
-        {
-            const ETC2Block *sourceRow =
-                priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
-            uint16_t *destRow =
-                priv::OffsetDataPointer<uint16_t>(output, y, z, outputRowPitch, outputDepthPitch);
+    ForEachBlockRow(context, width, height, depth, [&](size_t y, size_t z) {
+        const ETC2Block *sourceRow =
+            priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
+        uint16_t *destRow =
+            priv::OffsetDataPointer<uint16_t>(output, y, z, outputRowPitch, outputDepthPitch);
 
-            for (size_t x = 0; x < width; x += 4)
-            {
-                const ETC2Block *sourceBlock = sourceRow + (x / 4);
-                uint16_t *destPixels         = destRow + x;
+        for (size_t x = 0; x < width; x += 4)
+        {
+            const ETC2Block *sourceBlock = sourceRow + (x / 4);
+            uint16_t *destPixels         = destRow + x;
 
-                sourceBlock->decodeAsSingleEACChannel(destPixels, x, y, width, height, 1,
-                                                      outputRowPitch, isSigned, isFloat);
-            }
+            sourceBlock->decodeAsSingleEACChannel(destPixels, x, y, width, height, 1,
+                                                  outputRowPitch, isSigned, isFloat);
         }
-    }
+    });
 }
 
 void LoadRG11EACToRG16(const ImageLoadContext &context,
@@ -1587,29 +1624,25 @@ void LoadRG11EACToRG16(const ImageLoadContext &context,
                        bool isSigned,
                        bool isFloat)
 {
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y += 4)
-        {
-            const ETC2Block *sourceRow =
-                priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
-            uint16_t *destRow =
-                priv::OffsetDataPointer<uint16_t>(output, y, z, outputRowPitch, outputDepthPitch);
+    ForEachBlockRow(context, width, height, depth, [&](size_t y, size_t z) {
+        const ETC2Block *sourceRow =
+            priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
+        uint16_t *destRow =
+            priv::OffsetDataPointer<uint16_t>(output, y, z, outputRowPitch, outputDepthPitch);
 
-            for (size_t x = 0; x < width; x += 4)
-            {
-                uint16_t *destPixelsRed         = destRow + (x * 2);
-                const ETC2Block *sourceBlockRed = sourceRow + (x / 2);
-                sourceBlockRed->decodeAsSingleEACChannel(destPixelsRed, x, y, width, height, 2,
-                                                         outputRowPitch, isSigned, isFloat);
-
-                uint16_t *destPixelsGreen         = destPixelsRed + 1;
-                const ETC2Block *sourceBlockGreen = sourceBlockRed + 1;
-                sourceBlockGreen->decodeAsSingleEACChannel(destPixelsGreen, x, y, width, height, 2,
-                                                           outputRowPitch, isSigned, isFloat);
-            }
+        for (size_t x = 0; x < width; x += 4)
+        {
+            uint16_t *destPixelsRed         = destRow + (x * 2);
+            const ETC2Block *sourceBlockRed = sourceRow + (x / 2);
+            sourceBlockRed->decodeAsSingleEACChannel(destPixelsRed, x, y, width, height, 2,
+                                                     outputRowPitch, isSigned, isFloat);
+
+            uint16_t *destPixelsGreen         = destPixelsRed + 1;
+            const ETC2Block *sourceBlockGreen = sourceBlockRed + 1;
+            sourceBlockGreen->decodeAsSingleEACChannel(destPixelsGreen, x, y, width, height, 2,
+                                                       outputRowPitch, isSigned, isFloat);
         }
-    }
+    });
 }
 
 void LoadETC2RGB8ToRGBA8(const ImageLoadContext &context,
@@ -1624,25 +1657,21 @@ void LoadETC2RGB8ToRGBA8(const ImageLoadContext &context,
                          size_t outputDepthPitch,
                          bool punchthroughAlpha)
 {
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y += 4)
-        {
-            const ETC2Block *sourceRow =
-                priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
-            uint8_t *destRow =
-                priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
+    ForEachBlockRow(context, width, height, depth, [&](size_t y, size_t z) {
+        const ETC2Block *sourceRow =
+            priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
+        uint8_t *destRow =
+            priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
 
-            for (size_t x = 0; x < width; x += 4)
-            {
-                const ETC2Block *sourceBlock = sourceRow + (x / 4);
-                uint8_t *destPixels          = destRow + (x * 4);
+        for (size_t x = 0; x < width; x += 4)
+        {
+            const ETC2Block *sourceBlock = sourceRow + (x / 4);
+            uint8_t *destPixels          = destRow + (x * 4);
 
-                sourceBlock->decodeAsRGB(destPixels, x, y, width, height, outputRowPitch,
-                                         DefaultETCAlphaValues, punchthroughAlpha);
-            }
+            sourceBlock->decodeAsRGB(destPixels, x, y, width, height, outputRowPitch,
+                                     DefaultETCAlphaValues, punchthroughAlpha);
         }
-    }
+    });
 }
 
 void LoadETC2RGB8ToBC1(const ImageLoadContext &context,
@@ -1657,25 +1686,21 @@ void LoadETC2RGB8ToBC1(const ImageLoadContext &context,
                        size_t outputDepthPitch,
                        bool punchthroughAlpha)
 {
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y += 4)
-        {
-            const ETC2Block *sourceRow =
-                priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
-            uint8_t *destRow = priv::OffsetDataPointer<uint8_t>(output, y / 4, z, outputRowPitch,
-                                                                outputDepthPitch);
+    ForEachBlockRow(context, width, height, depth, [&](size_t y, size_t z) {
+        const ETC2Block *sourceRow =
+            priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
+        uint8_t *destRow = priv::OffsetDataPointer<uint8_t>(output, y / 4, z, outputRowPitch,
+                                                            outputDepthPitch);
 
-            for (size_t x = 0; x < width; x += 4)
-            {
-                const ETC2Block *sourceBlock = sourceRow + (x / 4);
-                uint8_t *destPixels          = destRow + (x * 2);
+        for (size_t x = 0; x < width; x += 4)
+        {
+            const ETC2Block *sourceBlock = sourceRow + (x / 4);
+            uint8_t *destPixels          = destRow + (x * 2);
 
-                sourceBlock->transcodeAsBC1(destPixels, x, y, width, height, DefaultETCAlphaValues,
-                                            punchthroughAlpha);
-            }
+            sourceBlock->transcodeAsBC1(destPixels, x, y, width, height, DefaultETCAlphaValues,
+                                        punchthroughAlpha);
         }
-    }
+    });
 }
 
 void LoadETC2RGBA8ToBC3(const ImageLoadContext &context,
@@ -1691,30 +1716,26 @@ void LoadETC2RGBA8ToBC3(const ImageLoadContext &context,
                         bool punchthroughAlpha,
                         bool isSigned)
 {
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y += 4)
-        {
-            const ETC2Block *sourceRow =
-                priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
-            uint8_t *destRow = priv::OffsetDataPointer<uint8_t>(output, y / 4, z, outputRowPitch,
-                                                                outputDepthPitch);
+    ForEachBlockRow(context, width, height, depth, [&](size_t y, size_t z) {
+        const ETC2Block *sourceRow =
+            priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
+        uint8_t *destRow = priv::OffsetDataPointer<uint8_t>(output, y / 4, z, outputRowPitch,
+                                                            outputDepthPitch);
 
-            for (size_t x = 0; x < width; x += 4)
-            {
-                const ETC2Block *sourceAlphaBlock = sourceRow + (x / 4) * 2;
-                uint8_t *destAlphaPixels          = destRow + (x * 4);
+        for (size_t x = 0; x < width; x += 4)
+        {
+            const ETC2Block *sourceAlphaBlock = sourceRow + (x / 4) * 2;
+            uint8_t *destAlphaPixels          = destRow + (x * 4);
 
-                const ETC2Block *sourceRgbBlock = sourceAlphaBlock + 1;
-                uint8_t *destRgbPixels          = destAlphaPixels + 8;
+            const ETC2Block *sourceRgbBlock = sourceAlphaBlock + 1;
+            uint8_t *destRgbPixels          = destAlphaPixels + 8;
 
-                sourceRgbBlock->transcodeAsBC1(destRgbPixels, x, y, width, height,
-                                               DefaultETCAlphaValues, punchthroughAlpha);
+            sourceRgbBlock->transcodeAsBC1(destRgbPixels, x, y, width, height,
+                                           DefaultETCAlphaValues, punchthroughAlpha);
 
-                sourceAlphaBlock->transcodeAsBC4(destAlphaPixels, x, y, width, height, isSigned);
-            }
+            sourceAlphaBlock->transcodeAsBC4(destAlphaPixels, x, y, width, height, isSigned);
         }
-    }
+    });
 }
 
 void LoadETC2RGBA8ToRGBA8(const ImageLoadContext &context,
@@ -1729,31 +1750,27 @@ void LoadETC2RGBA8ToRGBA8(const ImageLoadContext &context,
                           size_t outputDepthPitch,
                           bool srgb)
 {
-    uint8_t decodedAlphaValues[4][4];
+    ForEachBlockRow(context, width, height, depth, [&](size_t y, size_t z) {
+        uint8_t decodedAlphaValues[4][4];
 
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y += 4)
-        {
-            const ETC2Block *sourceRow =
-                priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
-            uint8_t *destRow =
-                priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
+        const ETC2Block *sourceRow =
+            priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
+        uint8_t *destRow =
+            priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
 
-            for (size_t x = 0; x < width; x += 4)
-            {
-                const ETC2Block *sourceBlockAlpha = sourceRow + (x / 2);
-                sourceBlockAlpha->decodeAsSingleETC2Channel(
-                    reinterpret_cast<uint8_t *>(decodedAlphaValues), x, y, width, height, 1, 4,
-                    false);
-
-                uint8_t *destPixels             = destRow + (x * 4);
-                const ETC2Block *sourceBlockRGB = sourceBlockAlpha + 1;
-                sourceBlockRGB->decodeAsRGB(destPixels, x, y, width, height, outputRowPitch,
-                                            decodedAlphaValues, false);
-            }
+        for (size_t x = 0; x < width; x += 4)
+        {
+            const ETC2Block *sourceBlockAlpha = sourceRow + (x / 2);
+            sourceBlockAlpha->decodeAsSingleETC2Channel(
+                reinterpret_cast<uint8_t *>(decodedAlphaValues), x, y, width, height, 1, 4,
+                false);
+
+            uint8_t *destPixels             = destRow + (x * 4);
+            const ETC2Block *sourceBlockRGB = sourceBlockAlpha + 1;
+            sourceBlockRGB->decodeAsRGB(destPixels, x, y, width, height, outputRowPitch,
+                                        decodedAlphaValues, false);
         }
-    }
+    });
 }
 
 }  // anonymous namespace
@@ -2160,23 +2177,19 @@ void LoadEACR11ToBC4(const ImageLoadContext &context,
                      size_t outputDepthPitch,
                      bool isSigned)
 {
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y += 4)
-        {
-            const ETC2Block *sourceRow =
-                priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
-            uint8_t *destRow = priv::OffsetDataPointer<uint8_t>(output, y / 4, z, outputRowPitch,
-                                                                outputDepthPitch);
+    ForEachBlockRow(context, width, height, depth, [&](size_t y, size_t z) {
+        const ETC2Block *sourceRow =
+            priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
+        uint8_t *destRow = priv::OffsetDataPointer<uint8_t>(output, y / 4, z, outputRowPitch,
+                                                            outputDepthPitch);
 
-            for (size_t x = 0; x < width; x += 4)
-            {
-                const ETC2Block *sourceR11Block = sourceRow + (x / 4);
-                uint8_t *destR11Pixels          = destRow + (x * 2);
-                sourceR11Block->transcodeAsBC4(destR11Pixels, x, y, width, height, isSigned);
-            }
+        for (size_t x = 0; x < width; x += 4)
+        {
+            const ETC2Block *sourceR11Block = sourceRow + (x / 4);
+            uint8_t *destR11Pixels          = destRow + (x * 2);
+            sourceR11Block->transcodeAsBC4(destR11Pixels, x, y, width, height, isSigned);
         }
-    }
+    });
 }
 
 void LoadEACRG11ToBC5(const ImageLoadContext &context,
@@ -2191,27 +2204,23 @@ void LoadEACRG11ToBC5(const ImageLoadContext &context,
                       size_t outputDepthPitch,
                       bool isSigned)
 {
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y += 4)
-        {
-            const ETC2Block *sourceRow =
-                priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
-            uint8_t *destRow = priv::OffsetDataPointer<uint8_t>(output, y / 4, z, outputRowPitch,
-                                                                outputDepthPitch);
+    ForEachBlockRow(context, width, height, depth, [&](size_t y, size_t z) {
+        const ETC2Block *sourceRow =
+            priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
+        uint8_t *destRow = priv::OffsetDataPointer<uint8_t>(output, y / 4, z, outputRowPitch,
+                                                            outputDepthPitch);
 
-            for (size_t x = 0; x < width; x += 4)
-            {
-                const ETC2Block *sourceR11Block = sourceRow + (x / 2);
-                uint8_t *destR11Pixels          = destRow + (x * 4);
+        for (size_t x = 0; x < width; x += 4)
+        {
+            const ETC2Block *sourceR11Block = sourceRow + (x / 2);
+            uint8_t *destR11Pixels          = destRow + (x * 4);
 
-                const ETC2Block *sourceG11Block = sourceR11Block + 1;
-                uint8_t *destG11Pixels          = destR11Pixels + 8;
-                sourceR11Block->transcodeAsBC4(destR11Pixels, x, y, width, height, isSigned);
-                sourceG11Block->transcodeAsBC4(destG11Pixels, x, y, width, height, isSigned);
-            }
+            const ETC2Block *sourceG11Block = sourceR11Block + 1;
+            uint8_t *destG11Pixels          = destR11Pixels + 8;
+            sourceR11Block->transcodeAsBC4(destR11Pixels, x, y, width, height, isSigned);
+            sourceG11Block->transcodeAsBC4(destG11Pixels, x, y, width, height, isSigned);
         }
-    }
+    });
 }
 
 void LoadEACR11ToBC4(const ImageLoadContext &context,
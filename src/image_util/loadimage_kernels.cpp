@@ -0,0 +1,742 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// loadimage_kernels.cpp: Implements the per-row image loading kernels and picks the fastest set
+//   for the CPU.  The vector kernels convert as many pixels as they can in full vectors, and leave
+//   the rest of the row to the scalar kernel.  They never read or write past the row.
+
+#include "image_util/loadimage_kernels.h"
+
+#include <string.h>
+
+#include "common/debug.h"
+#include "common/mathutil.h"
+#include "common/platform.h"
+
+#if defined(_M_X64) || defined(__x86_64__) || defined(_M_IX86) || defined(__i386__)
+#    define ANGLE_LOADIMAGE_KERNELS_X86 1
+#    if defined(_MSC_VER)
+#        include <intrin.h>
+#    else
+#        include <cpuid.h>
+#    endif
+#    include <immintrin.h>
+// Lets the vector kernels be built without enabling the instruction sets for the whole target.
+// MSVC allows the intrinsics anywhere.
+#    if defined(__clang__) || defined(__GNUC__)
+#        define ANGLE_TARGET(features) __attribute__((target(features)))
+#    else
+#        define ANGLE_TARGET(features)
+#    endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+// NEON is always available on arm64.
+#    define ANGLE_LOADIMAGE_KERNELS_NEON 1
+#    include <arm_neon.h>
+#endif
+
+namespace angle
+{
+namespace priv
+{
+namespace
+{
+ANGLE_INLINE uint32_t Load32(const uint8_t *source)
+{
+    uint32_t value;
+    memcpy(&value, source, sizeof(value));
+    return value;
+}
+
+ANGLE_INLINE void Store32(uint8_t *dest, uint32_t value)
+{
+    memcpy(dest, &value, sizeof(value));
+}
+
+// Scalar kernels.  These are also used for the end of the row by the vector kernels.
+
+void RGB8ToRGBA8Scalar(const uint8_t *source, uint8_t *dest, size_t width, uint8_t fourthValue)
+{
+    ASSERT(IsLittleEndian());
+    const uint32_t fourthValue32 = static_cast<uint32_t>(fourthValue) << 24;
+
+    size_t x = 0;
+
+    // Three 32-bit values from the input contain 4 RGB pixels in total. This translates to four
+    // 32-bit values on the output.  (RGBR GBRG BRGB -> RGBA RGBA RGBA RGBA)
+    for (; x + 4 <= width; x += 4)
+    {
+        const uint32_t rgbr = Load32(source + 3 * x);
+        const uint32_t gbrg = Load32(source + 3 * x + 4);
+        const uint32_t brgb = Load32(source + 3 * x + 8);
+
+        Store32(dest + 4 * x, (rgbr & 0x00FFFFFF) | fourthValue32);
+        Store32(dest + 4 * x + 4, (rgbr >> 24) | ((gbrg & 0x0000FFFF) << 8) | fourthValue32);
+        Store32(dest + 4 * x + 8, (gbrg >> 16) | ((brgb & 0x000000FF) << 16) | fourthValue32);
+        Store32(dest + 4 * x + 12, (brgb >> 8) | fourthValue32);
+    }
+
+    for (; x < width; x++)
+    {
+        dest[4 * x + 0] = source[3 * x + 0];
+        dest[4 * x + 1] = source[3 * x + 1];
+        dest[4 * x + 2] = source[3 * x + 2];
+        dest[4 * x + 3] = fourthValue;
+    }
+}
+
+void RGB8ToBGRX8Scalar(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    for (size_t x = 0; x < width; x++)
+    {
+        dest[4 * x + 0] = source[3 * x + 2];
+        dest[4 * x + 1] = source[3 * x + 1];
+        dest[4 * x + 2] = source[3 * x + 0];
+        dest[4 * x + 3] = 0xFF;
+    }
+}
+
+void RGBA8ToBGRA8Scalar(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    for (size_t x = 0; x < width; x++)
+    {
+        const uint32_t rgba = Load32(source + 4 * x);
+        Store32(dest + 4 * x, (ANGLE_ROTL(rgba, 16) & 0x00FF00FF) | (rgba & 0xFF00FF00));
+    }
+}
+
+void A8ToRGBA8Scalar(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    for (size_t x = 0; x < width; x++)
+    {
+        Store32(dest + 4 * x, static_cast<uint32_t>(source[x]) << 24);
+    }
+}
+
+void LA8ToRGBA8Scalar(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    for (size_t x = 0; x < width; x++)
+    {
+        dest[4 * x + 0] = source[2 * x + 0];
+        dest[4 * x + 1] = source[2 * x + 0];
+        dest[4 * x + 2] = source[2 * x + 0];
+        dest[4 * x + 3] = source[2 * x + 1];
+    }
+}
+
+void RGB16FToRG11B10FScalar(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    for (size_t x = 0; x < width; x++)
+    {
+        uint16_t rgb[3];
+        memcpy(rgb, source + 6 * x, sizeof(rgb));
+
+        Store32(dest + 4 * x, (gl::float32ToFloat11(gl::float16ToFloat32(rgb[0])) << 0) |
+                                  (gl::float32ToFloat11(gl::float16ToFloat32(rgb[1])) << 11) |
+                                  (gl::float32ToFloat10(gl::float16ToFloat32(rgb[2])) << 22));
+    }
+}
+
+void D24S8ToD32FS8X24Scalar(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    for (size_t x = 0; x < width; x++)
+    {
+        const uint32_t d24s8   = Load32(source + 4 * x);
+        const float depth      = (d24s8 >> 8) / static_cast<float>(0xFFFFFF);
+        const uint32_t stencil = d24s8 & 0xFF;
+        memcpy(dest + 8 * x, &depth, sizeof(depth));
+        Store32(dest + 8 * x + 4, stencil);
+    }
+}
+
+constexpr LoadImageKernels kScalarKernels = {
+    RGB8ToRGBA8Scalar,  RGB8ToBGRX8Scalar,      RGBA8ToBGRA8Scalar,     A8ToRGBA8Scalar,
+    LA8ToRGBA8Scalar,   RGB16FToRG11B10FScalar, D24S8ToD32FS8X24Scalar,
+};
+
+// Converting a half float to the unsigned 11 and 10 bit floats only requires dropping mantissa
+// bits, as they all have 5 exponent bits with the same bias.  The vector kernels do this with the
+// same results as gl::float32ToFloat11(gl::float16ToFloat32()) and its float10 counterpart:
+//
+// - Negative values, including -INF, become 0.
+// - Finite values are rounded to nearest even, and clamped to the largest finite value.
+// - INF is kept, and NaNs stay NaNs with some of their payload.
+//
+// The parameters are the number of mantissa bits dropped, the shift that folds the dropped bits
+// of a NaN back into the payload, the largest finite value and the exponent mask.
+template <int kShift, int kNaNShift, uint16_t kMax, uint16_t kInf>
+struct PackedFloatParams
+{
+    static constexpr int kMantissaShift     = kShift;
+    static constexpr int kNaNPayloadShift   = kNaNShift;
+    static constexpr uint16_t kMaxFinite    = kMax;
+    static constexpr uint16_t kExponentMask = kInf;
+    static constexpr uint16_t kMantissaMask = (1 << (10 - kShift)) - 1;
+    static constexpr uint16_t kRoundingBias = (1 << (kShift - 1)) - 1;
+};
+using Float11Params = PackedFloatParams<4, 2, 0x7BF, 0x7C0>;
+using Float10Params = PackedFloatParams<5, 0, 0x3DF, 0x3E0>;
+
+#if defined(ANGLE_LOADIMAGE_KERNELS_X86)
+
+struct X86Features
+{
+    bool sse2  = false;
+    bool ssse3 = false;
+    bool avx2  = false;
+};
+
+void CpuId(uint32_t leaf, uint32_t subleaf, uint32_t regs[4])
+{
+#    if defined(_MSC_VER)
+    int intRegs[4];
+    __cpuidex(intRegs, static_cast<int>(leaf), static_cast<int>(subleaf));
+    memcpy(regs, intRegs, sizeof(intRegs));
+#    else
+    __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#    endif
+}
+
+ANGLE_TARGET("xsave") X86Features QueryX86Features()
+{
+    X86Features features;
+
+    uint32_t regs[4];
+    CpuId(0, 0, regs);
+    const uint32_t maxLeaf = regs[0];
+    if (maxLeaf < 1)
+    {
+        return features;
+    }
+
+    CpuId(1, 0, regs);
+    features.sse2  = (regs[3] >> 26) & 1;
+    features.ssse3 = (regs[2] >> 9) & 1;
+
+    // AVX2 also needs the OS to save the upper halves of the ymm registers.
+    const bool osxsave = (regs[2] >> 27) & 1;
+    const bool avx     = (regs[2] >> 28) & 1;
+    if (maxLeaf >= 7 && osxsave && avx && (_xgetbv(0) & 0x6) == 0x6)
+    {
+        CpuId(7, 0, regs);
+        features.avx2 = (regs[1] >> 5) & 1;
+    }
+
+    return features;
+}
+
+ANGLE_TARGET("sse2")
+void RGBA8ToBGRA8SSE2(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    const __m128i brMask = _mm_set1_epi32(0x00FF00FF);
+
+    size_t x = 0;
+    for (; x + 4 <= width; x += 4)
+    {
+        __m128i sourceData = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + 4 * x));
+        // Mask out g and a, which don't change
+        __m128i gaComponents = _mm_andnot_si128(brMask, sourceData);
+        // Mask out b and r
+        __m128i brComponents = _mm_and_si128(sourceData, brMask);
+        // Swap b and r
+        __m128i brSwapped =
+            _mm_shufflehi_epi16(_mm_shufflelo_epi16(brComponents, _MM_SHUFFLE(2, 3, 0, 1)),
+                                _MM_SHUFFLE(2, 3, 0, 1));
+        __m128i result = _mm_or_si128(gaComponents, brSwapped);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + 4 * x), result);
+    }
+
+    RGBA8ToBGRA8Scalar(source + 4 * x, dest + 4 * x, width - x);
+}
+
+ANGLE_TARGET("sse2")
+void A8ToRGBA8SSE2(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    const __m128i zeroWide = _mm_setzero_si128();
+
+    size_t x = 0;
+    for (; x + 8 <= width; x += 8)
+    {
+        __m128i sourceData = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(source + x));
+        // Interleave each byte to 16bit, make the lower byte to zero
+        sourceData = _mm_unpacklo_epi8(zeroWide, sourceData);
+        // Interleave each 16bit to 32bit, make the lower 16bit to zero
+        __m128i lo = _mm_unpacklo_epi16(zeroWide, sourceData);
+        __m128i hi = _mm_unpackhi_epi16(zeroWide, sourceData);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + 4 * x), lo);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + 4 * x + 16), hi);
+    }
+
+    A8ToRGBA8Scalar(source + x, dest + 4 * x, width - x);
+}
+
+ANGLE_TARGET("sse2")
+void LA8ToRGBA8SSE2(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    const __m128i lumaMask = _mm_set1_epi16(0x00FF);
+
+    size_t x = 0;
+    for (; x + 8 <= width; x += 8)
+    {
+        // Each 16-bit lane is one LA pixel.  Duplicating L into both bytes of a lane and
+        // interleaving that with the original lanes gives LLLA.
+        __m128i la = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + 2 * x));
+        __m128i l  = _mm_and_si128(la, lumaMask);
+        __m128i ll = _mm_or_si128(l, _mm_slli_epi16(l, 8));
+        __m128i lo = _mm_unpacklo_epi16(ll, la);
+        __m128i hi = _mm_unpackhi_epi16(ll, la);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + 4 * x), lo);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + 4 * x + 16), hi);
+    }
+
+    LA8ToRGBA8Scalar(source + 2 * x, dest + 4 * x, width - x);
+}
+
+template <typename Params>
+ANGLE_TARGET("sse2")
+ANGLE_INLINE __m128i Float16ToPackedFloatSSE2(__m128i half)
+{
+    // All values are at most 0x7FFF after the sign is removed, so signed compares are fine.
+    const __m128i abs      = _mm_and_si128(half, _mm_set1_epi16(0x7FFF));
+    const __m128i mantissa = _mm_and_si128(abs, _mm_set1_epi16(0x3FF));
+    const __m128i halfInf  = _mm_set1_epi16(0x7C00);
+    const __m128i inf      = _mm_set1_epi16(Params::kExponentMask);
+
+    const __m128i roundBit =
+        _mm_and_si128(_mm_srli_epi16(abs, Params::kMantissaShift), _mm_set1_epi16(1));
+    __m128i finite = _mm_add_epi16(_mm_add_epi16(abs, _mm_set1_epi16(Params::kRoundingBias)),
+                                   roundBit);
+    finite = _mm_srli_epi16(finite, Params::kMantissaShift);
+    finite = _mm_min_epi16(finite, _mm_set1_epi16(Params::kMaxFinite));
+
+    __m128i nan = _mm_or_si128(_mm_srli_epi16(mantissa, Params::kMantissaShift),
+                               _mm_slli_epi16(mantissa, Params::kNaNPayloadShift));
+    nan         = _mm_or_si128(inf, _mm_and_si128(nan, _mm_set1_epi16(Params::kMantissaMask)));
+
+    const __m128i isNaN = _mm_cmpgt_epi16(abs, halfInf);
+    const __m128i isInf = _mm_cmpeq_epi16(abs, halfInf);
+    // Negative non-NaN values become 0.
+    const __m128i isZero = _mm_andnot_si128(isNaN, _mm_srai_epi16(half, 15));
+
+    __m128i result = _mm_or_si128(_mm_andnot_si128(isInf, finite), _mm_and_si128(isInf, inf));
+    result         = _mm_or_si128(_mm_andnot_si128(isNaN, result), _mm_and_si128(isNaN, nan));
+    return _mm_andnot_si128(isZero, result);
+}
+
+ANGLE_TARGET("sse2")
+ANGLE_INLINE __m128i ConvertRGB16FLanesSSE2(__m128i half, __m128i isBlue)
+{
+    const __m128i float11 = Float16ToPackedFloatSSE2<Float11Params>(half);
+    const __m128i float10 = Float16ToPackedFloatSSE2<Float10Params>(half);
+    return _mm_or_si128(_mm_andnot_si128(isBlue, float11), _mm_and_si128(isBlue, float10));
+}
+
+ANGLE_TARGET("sse2")
+void RGB16FToRG11B10FSSE2(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    // 8 pixels are 24 components in three registers.  The masks select the blue lanes, which
+    // become float10 rather than float11.
+    const __m128i isBlue0 = _mm_setr_epi16(0, 0, -1, 0, 0, -1, 0, 0);
+    const __m128i isBlue1 = _mm_setr_epi16(-1, 0, 0, -1, 0, 0, -1, 0);
+    const __m128i isBlue2 = _mm_setr_epi16(0, -1, 0, 0, -1, 0, 0, -1);
+
+    size_t x = 0;
+    for (; x + 8 <= width; x += 8)
+    {
+        const __m128i *source128 = reinterpret_cast<const __m128i *>(source + 6 * x);
+
+        alignas(16) uint16_t converted[24];
+        __m128i *converted128 = reinterpret_cast<__m128i *>(converted);
+        _mm_store_si128(converted128 + 0,
+                        ConvertRGB16FLanesSSE2(_mm_loadu_si128(source128 + 0), isBlue0));
+        _mm_store_si128(converted128 + 1,
+                        ConvertRGB16FLanesSSE2(_mm_loadu_si128(source128 + 1), isBlue1));
+        _mm_store_si128(converted128 + 2,
+                        ConvertRGB16FLanesSSE2(_mm_loadu_si128(source128 + 2), isBlue2));
+
+        for (size_t pixel = 0; pixel < 8; ++pixel)
+        {
+            Store32(dest + 4 * (x + pixel),
+                    static_cast<uint32_t>(converted[3 * pixel + 0]) |
+                        (static_cast<uint32_t>(converted[3 * pixel + 1]) << 11) |
+                        (static_cast<uint32_t>(converted[3 * pixel + 2]) << 22));
+        }
+    }
+
+    RGB16FToRG11B10FScalar(source + 6 * x, dest + 4 * x, width - x);
+}
+
+ANGLE_TARGET("sse2")
+void D24S8ToD32FS8X24SSE2(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    const __m128 depthScale   = _mm_set1_ps(static_cast<float>(0xFFFFFF));
+    const __m128i stencilMask = _mm_set1_epi32(0xFF);
+
+    size_t x = 0;
+    for (; x + 4 <= width; x += 4)
+    {
+        __m128i d24s8   = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + 4 * x));
+        __m128 depth    = _mm_div_ps(_mm_cvtepi32_ps(_mm_srli_epi32(d24s8, 8)), depthScale);
+        __m128i stencil = _mm_and_si128(d24s8, stencilMask);
+
+        __m128i depthBits = _mm_castps_si128(depth);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + 8 * x),
+                         _mm_unpacklo_epi32(depthBits, stencil));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + 8 * x + 16),
+                         _mm_unpackhi_epi32(depthBits, stencil));
+    }
+
+    D24S8ToD32FS8X24Scalar(source + 4 * x, dest + 8 * x, width - x);
+}
+
+// Spreads 4 RGB pixels in the low 12 bytes to 4 RGBx or BGRx pixels.
+#    define ANGLE_RGB_TO_RGBX_SHUFFLE \
+        0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1
+#    define ANGLE_RGB_TO_BGRX_SHUFFLE \
+        2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1
+
+template <typename ScalarFunction>
+ANGLE_TARGET("ssse3")
+ANGLE_INLINE void RGB8ToFourBytesSSSE3(const uint8_t *source,
+                                       uint8_t *dest,
+                                       size_t width,
+                                       __m128i shuffle,
+                                       uint8_t fourthValue,
+                                       ScalarFunction scalar)
+{
+    const __m128i fourth =
+        _mm_set1_epi32(static_cast<int>(static_cast<uint32_t>(fourthValue) << 24));
+
+    // Each iteration reads 16 bytes to convert 4 pixels (12 bytes), so stop early enough to not
+    // read past the row.
+    size_t x = 0;
+    for (; x + 6 <= width; x += 4)
+    {
+        __m128i rgb  = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + 3 * x));
+        __m128i rgbx = _mm_or_si128(_mm_shuffle_epi8(rgb, shuffle), fourth);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + 4 * x), rgbx);
+    }
+
+    scalar(source + 3 * x, dest + 4 * x, width - x);
+}
+
+ANGLE_TARGET("ssse3")
+void RGB8ToRGBA8SSSE3(const uint8_t *source, uint8_t *dest, size_t width, uint8_t fourthValue)
+{
+    RGB8ToFourBytesSSSE3(source, dest, width, _mm_setr_epi8(ANGLE_RGB_TO_RGBX_SHUFFLE),
+                         fourthValue,
+                         [fourthValue](const uint8_t *source, uint8_t *dest, size_t width) {
+                             RGB8ToRGBA8Scalar(source, dest, width, fourthValue);
+                         });
+}
+
+ANGLE_TARGET("ssse3")
+void RGB8ToBGRX8SSSE3(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    RGB8ToFourBytesSSSE3(source, dest, width, _mm_setr_epi8(ANGLE_RGB_TO_BGRX_SHUFFLE), 0xFF,
+                         RGB8ToBGRX8Scalar);
+}
+
+#    undef ANGLE_RGB_TO_RGBX_SHUFFLE
+#    undef ANGLE_RGB_TO_BGRX_SHUFFLE
+
+ANGLE_TARGET("avx2")
+void RGBA8ToBGRA8AVX2(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    const __m256i shuffle =
+        _mm256_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15, 2, 1, 0, 3, 6, 5,
+                         4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+
+    size_t x = 0;
+    for (; x + 8 <= width; x += 8)
+    {
+        __m256i rgba = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(source + 4 * x));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dest + 4 * x),
+                            _mm256_shuffle_epi8(rgba, shuffle));
+    }
+
+    RGBA8ToBGRA8SSE2(source + 4 * x, dest + 4 * x, width - x);
+}
+
+ANGLE_TARGET("avx2")
+void D24S8ToD32FS8X24AVX2(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    const __m256 depthScale   = _mm256_set1_ps(static_cast<float>(0xFFFFFF));
+    const __m256i stencilMask = _mm256_set1_epi32(0xFF);
+
+    size_t x = 0;
+    for (; x + 8 <= width; x += 8)
+    {
+        __m256i d24s8 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(source + 4 * x));
+        __m256 depth  = _mm256_div_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(d24s8, 8)), depthScale);
+        __m256i stencil = _mm256_and_si256(d24s8, stencilMask);
+
+        // The unpacks work within 128-bit lanes, giving pixels 0, 1, 4, 5 and 2, 3, 6, 7.
+        __m256i depthBits = _mm256_castps_si256(depth);
+        __m256i lo        = _mm256_unpacklo_epi32(depthBits, stencil);
+        __m256i hi        = _mm256_unpackhi_epi32(depthBits, stencil);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dest + 8 * x),
+                            _mm256_permute2x128_si256(lo, hi, 0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dest + 8 * x + 32),
+                            _mm256_permute2x128_si256(lo, hi, 0x31));
+    }
+
+    D24S8ToD32FS8X24SSE2(source + 4 * x, dest + 8 * x, width - x);
+}
+
+constexpr LoadImageKernels kSSE2Kernels = {
+    RGB8ToRGBA8Scalar, RGB8ToBGRX8Scalar,    RGBA8ToBGRA8SSE2,     A8ToRGBA8SSE2,
+    LA8ToRGBA8SSE2,    RGB16FToRG11B10FSSE2, D24S8ToD32FS8X24SSE2,
+};
+
+constexpr LoadImageKernels kSSSE3Kernels = {
+    RGB8ToRGBA8SSSE3, RGB8ToBGRX8SSSE3,     RGBA8ToBGRA8SSE2,     A8ToRGBA8SSE2,
+    LA8ToRGBA8SSE2,   RGB16FToRG11B10FSSE2, D24S8ToD32FS8X24SSE2,
+};
+
+// Widening the RGB shuffles to AVX2 needs two loads per vector and doesn't beat SSSE3.
+constexpr LoadImageKernels kAVX2Kernels = {
+    RGB8ToRGBA8SSSE3, RGB8ToBGRX8SSSE3,     RGBA8ToBGRA8AVX2,     A8ToRGBA8SSE2,
+    LA8ToRGBA8SSE2,   RGB16FToRG11B10FSSE2, D24S8ToD32FS8X24AVX2,
+};
+
+const X86Features &GetX86Features()
+{
+    static const X86Features kFeatures = QueryX86Features();
+    return kFeatures;
+}
+
+#endif  // defined(ANGLE_LOADIMAGE_KERNELS_X86)
+
+#if defined(ANGLE_LOADIMAGE_KERNELS_NEON)
+
+void RGB8ToRGBA8NEON(const uint8_t *source, uint8_t *dest, size_t width, uint8_t fourthValue)
+{
+    const uint8x16_t fourth = vdupq_n_u8(fourthValue);
+
+    size_t x = 0;
+    for (; x + 16 <= width; x += 16)
+    {
+        uint8x16x3_t rgb = vld3q_u8(source + 3 * x);
+        uint8x16x4_t rgba;
+        rgba.val[0] = rgb.val[0];
+        rgba.val[1] = rgb.val[1];
+        rgba.val[2] = rgb.val[2];
+        rgba.val[3] = fourth;
+        vst4q_u8(dest + 4 * x, rgba);
+    }
+
+    RGB8ToRGBA8Scalar(source + 3 * x, dest + 4 * x, width - x, fourthValue);
+}
+
+void RGB8ToBGRX8NEON(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    const uint8x16_t opaque = vdupq_n_u8(0xFF);
+
+    size_t x = 0;
+    for (; x + 16 <= width; x += 16)
+    {
+        uint8x16x3_t rgb = vld3q_u8(source + 3 * x);
+        uint8x16x4_t bgrx;
+        bgrx.val[0] = rgb.val[2];
+        bgrx.val[1] = rgb.val[1];
+        bgrx.val[2] = rgb.val[0];
+        bgrx.val[3] = opaque;
+        vst4q_u8(dest + 4 * x, bgrx);
+    }
+
+    RGB8ToBGRX8Scalar(source + 3 * x, dest + 4 * x, width - x);
+}
+
+void RGBA8ToBGRA8NEON(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    size_t x = 0;
+    for (; x + 16 <= width; x += 16)
+    {
+        uint8x16x4_t rgba = vld4q_u8(source + 4 * x);
+        uint8x16_t red    = rgba.val[0];
+        rgba.val[0]       = rgba.val[2];
+        rgba.val[2]       = red;
+        vst4q_u8(dest + 4 * x, rgba);
+    }
+
+    RGBA8ToBGRA8Scalar(source + 4 * x, dest + 4 * x, width - x);
+}
+
+void A8ToRGBA8NEON(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    const uint8x16_t zero = vdupq_n_u8(0);
+
+    size_t x = 0;
+    for (; x + 16 <= width; x += 16)
+    {
+        uint8x16x4_t rgba;
+        rgba.val[0] = zero;
+        rgba.val[1] = zero;
+        rgba.val[2] = zero;
+        rgba.val[3] = vld1q_u8(source + x);
+        vst4q_u8(dest + 4 * x, rgba);
+    }
+
+    A8ToRGBA8Scalar(source + x, dest + 4 * x, width - x);
+}
+
+void LA8ToRGBA8NEON(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    size_t x = 0;
+    for (; x + 16 <= width; x += 16)
+    {
+        uint8x16x2_t la = vld2q_u8(source + 2 * x);
+        uint8x16x4_t rgba;
+        rgba.val[0] = la.val[0];
+        rgba.val[1] = la.val[0];
+        rgba.val[2] = la.val[0];
+        rgba.val[3] = la.val[1];
+        vst4q_u8(dest + 4 * x, rgba);
+    }
+
+    LA8ToRGBA8Scalar(source + 2 * x, dest + 4 * x, width - x);
+}
+
+template <typename Params>
+ANGLE_INLINE uint16x8_t Float16ToPackedFloatNEON(uint16x8_t half)
+{
+    const uint16x8_t abs      = vandq_u16(half, vdupq_n_u16(0x7FFF));
+    const uint16x8_t mantissa = vandq_u16(abs, vdupq_n_u16(0x3FF));
+    const uint16x8_t halfInf  = vdupq_n_u16(0x7C00);
+    const uint16x8_t inf      = vdupq_n_u16(Params::kExponentMask);
+
+    const uint16x8_t roundBit =
+        vandq_u16(vshrq_n_u16(abs, Params::kMantissaShift), vdupq_n_u16(1));
+    uint16x8_t finite = vaddq_u16(vaddq_u16(abs, vdupq_n_u16(Params::kRoundingBias)), roundBit);
+    finite            = vshrq_n_u16(finite, Params::kMantissaShift);
+    finite            = vminq_u16(finite, vdupq_n_u16(Params::kMaxFinite));
+
+    uint16x8_t nan = vorrq_u16(vshrq_n_u16(mantissa, Params::kMantissaShift),
+                               vshlq_u16(mantissa, vdupq_n_s16(Params::kNaNPayloadShift)));
+    nan            = vorrq_u16(inf, vandq_u16(nan, vdupq_n_u16(Params::kMantissaMask)));
+
+    const uint16x8_t isNaN = vcgtq_u16(abs, halfInf);
+    const uint16x8_t isInf = vceqq_u16(abs, halfInf);
+    // Negative non-NaN values become 0.
+    const uint16x8_t isZero = vbicq_u16(vtstq_u16(half, vdupq_n_u16(0x8000)), isNaN);
+
+    uint16x8_t result = vbslq_u16(isInf, inf, finite);
+    result            = vbslq_u16(isNaN, nan, result);
+    return vbicq_u16(result, isZero);
+}
+
+void RGB16FToRG11B10FNEON(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    size_t x = 0;
+    for (; x + 8 <= width; x += 8)
+    {
+        uint16_t halves[24];
+        memcpy(halves, source + 6 * x, sizeof(halves));
+        uint16x8x3_t rgb = vld3q_u16(halves);
+
+        const uint16x8_t red   = Float16ToPackedFloatNEON<Float11Params>(rgb.val[0]);
+        const uint16x8_t green = Float16ToPackedFloatNEON<Float11Params>(rgb.val[1]);
+        const uint16x8_t blue  = Float16ToPackedFloatNEON<Float10Params>(rgb.val[2]);
+
+        uint32x4_t lo =
+            vorrq_u32(vmovl_u16(vget_low_u16(red)), vshll_n_u16(vget_low_u16(green), 11));
+        lo = vorrq_u32(lo, vshlq_n_u32(vmovl_u16(vget_low_u16(blue)), 22));
+        uint32x4_t hi =
+            vorrq_u32(vmovl_u16(vget_high_u16(red)), vshll_n_u16(vget_high_u16(green), 11));
+        hi = vorrq_u32(hi, vshlq_n_u32(vmovl_u16(vget_high_u16(blue)), 22));
+
+        vst1q_u8(dest + 4 * x, vreinterpretq_u8_u32(lo));
+        vst1q_u8(dest + 4 * x + 16, vreinterpretq_u8_u32(hi));
+    }
+
+    RGB16FToRG11B10FScalar(source + 6 * x, dest + 4 * x, width - x);
+}
+
+void D24S8ToD32FS8X24NEON(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    const float32x4_t depthScale = vdupq_n_f32(static_cast<float>(0xFFFFFF));
+    const uint32x4_t stencilMask = vdupq_n_u32(0xFF);
+
+    size_t x = 0;
+    for (; x + 4 <= width; x += 4)
+    {
+        uint32x4_t d24s8  = vreinterpretq_u32_u8(vld1q_u8(source + 4 * x));
+        float32x4_t depth = vdivq_f32(vcvtq_f32_u32(vshrq_n_u32(d24s8, 8)), depthScale);
+
+        uint32x4x2_t depthStencil;
+        depthStencil.val[0] = vreinterpretq_u32_f32(depth);
+        depthStencil.val[1] = vandq_u32(d24s8, stencilMask);
+
+        uint32_t interleaved[8];
+        vst2q_u32(interleaved, depthStencil);
+        memcpy(dest + 8 * x, interleaved, sizeof(interleaved));
+    }
+
+    D24S8ToD32FS8X24Scalar(source + 4 * x, dest + 8 * x, width - x);
+}
+
+constexpr LoadImageKernels kNEONKernels = {
+    RGB8ToRGBA8NEON, RGB8ToBGRX8NEON,      RGBA8ToBGRA8NEON,     A8ToRGBA8NEON,
+    LA8ToRGBA8NEON,  RGB16FToRG11B10FNEON, D24S8ToD32FS8X24NEON,
+};
+
+#endif  // defined(ANGLE_LOADIMAGE_KERNELS_NEON)
+
+const LoadImageKernels &SelectLoadImageKernels()
+{
+    constexpr LoadImageKernelLevel kLevels[] = {
+        LoadImageKernelLevel::AVX2,
+        LoadImageKernelLevel::SSSE3,
+        LoadImageKernelLevel::SSE2,
+        LoadImageKernelLevel::NEON,
+    };
+
+    for (LoadImageKernelLevel level : kLevels)
+    {
+        const LoadImageKernels *kernels = GetLoadImageKernels(level);
+        if (kernels != nullptr)
+        {
+            return *kernels;
+        }
+    }
+
+    return kScalarKernels;
+}
+}  // anonymous namespace
+
+const LoadImageKernels *GetLoadImageKernels(LoadImageKernelLevel level)
+{
+    switch (level)
+    {
+        case LoadImageKernelLevel::Scalar:
+            return &kScalarKernels;
+#if defined(ANGLE_LOADIMAGE_KERNELS_X86)
+        case LoadImageKernelLevel::SSE2:
+            return GetX86Features().sse2 ? &kSSE2Kernels : nullptr;
+        case LoadImageKernelLevel::SSSE3:
+            return GetX86Features().sse2 && GetX86Features().ssse3 ? &kSSSE3Kernels : nullptr;
+        case LoadImageKernelLevel::AVX2:
+            return GetX86Features().sse2 && GetX86Features().ssse3 && GetX86Features().avx2
+                       ? &kAVX2Kernels
+                       : nullptr;
+#endif
+#if defined(ANGLE_LOADIMAGE_KERNELS_NEON)
+        case LoadImageKernelLevel::NEON:
+            return &kNEONKernels;
+#endif
+        default:
+            return nullptr;
+    }
+}
+
+const LoadImageKernels &GetLoadImageKernels()
+{
+    static const LoadImageKernels &kKernels = SelectLoadImageKernels();
+    return kKernels;
+}
+}  // namespace priv
+}  // namespace angle
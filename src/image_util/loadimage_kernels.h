@@ -0,0 +1,56 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// loadimage_kernels.h: Per-row kernels for the hottest image loading functions.  Each kernel has a
+//   portable implementation, and some have SSE2, SSSE3 or AVX2 implementations on x86 and NEON
+//   implementations on arm64.  The fastest set the CPU supports is picked on first use.
+
+#ifndef IMAGEUTIL_LOADIMAGE_KERNELS_H_
+#define IMAGEUTIL_LOADIMAGE_KERNELS_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace angle
+{
+namespace priv
+{
+enum class LoadImageKernelLevel
+{
+    Scalar,
+    SSE2,
+    SSSE3,
+    AVX2,
+    NEON,
+
+    InvalidEnum,
+    EnumCount = InvalidEnum,
+};
+
+// Each kernel converts |width| pixels.  There are no alignment requirements on |source| or |dest|.
+struct LoadImageKernels
+{
+    // RGB8 to RGBA8, with the fourth byte set to |fourthValue|.
+    void (*rgb8ToRGBA8)(const uint8_t *source, uint8_t *dest, size_t width, uint8_t fourthValue);
+    // RGB8 to BGRA8, with alpha set to 0xFF.
+    void (*rgb8ToBGRX8)(const uint8_t *source, uint8_t *dest, size_t width);
+    void (*rgba8ToBGRA8)(const uint8_t *source, uint8_t *dest, size_t width);
+    void (*a8ToRGBA8)(const uint8_t *source, uint8_t *dest, size_t width);
+    void (*la8ToRGBA8)(const uint8_t *source, uint8_t *dest, size_t width);
+    void (*rgb16FToRG11B10F)(const uint8_t *source, uint8_t *dest, size_t width);
+    void (*d24s8ToD32FS8X24)(const uint8_t *source, uint8_t *dest, size_t width);
+};
+
+// Returns the kernels of the given level, or nullptr if the CPU doesn't support them or they are
+// not built for this architecture.  Kernels that have no implementation at a level fall back to the
+// next lower level.
+const LoadImageKernels *GetLoadImageKernels(LoadImageKernelLevel level);
+
+// Returns the fastest kernels available.
+const LoadImageKernels &GetLoadImageKernels();
+}  // namespace priv
+}  // namespace angle
+
+#endif  // IMAGEUTIL_LOADIMAGE_KERNELS_H_
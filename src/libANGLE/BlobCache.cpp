@@ -17,7 +17,10 @@
 namespace egl
 {
 BlobCache::BlobCache(size_t maxCacheSizeBytes)
-    : mBlobCache(maxCacheSizeBytes), mSetBlobFunc(nullptr), mGetBlobFunc(nullptr)
+    : mBlobCache(maxCacheSizeBytes),
+      mSetBlobFunc(nullptr),
+      mGetBlobFunc(nullptr),
+      mCompressionCodec(angle::BlobCompressionCodec::Gzip)
 {}
 
 BlobCache::~BlobCache() {}
@@ -42,7 +45,8 @@ bool BlobCache::compressAndPut(const gl::Context *context,
                                size_t *compressedSize)
 {
     angle::MemoryBuffer compressedValue;
-    if (!angle::CompressBlob(uncompressedValue.size(), uncompressedValue.data(), &compressedValue))
+    if (!angle::CompressBlob(mCompressionCodec, uncompressedValue.size(), uncompressedValue.data(),
+                             &compressedValue))
     {
         return false;
     }
@@ -71,8 +75,26 @@ void BlobCache::putApplication(const gl::Context *context,
     }
 }
 
+void BlobCache::putPersistent(const BlobCache::Key &key, const angle::MemoryBuffer &value)
+{
+    if (areBlobCacheFuncsSet())
+    {
+        putApplication(nullptr, key, value);
+    }
+    else
+    {
+        putDiskStore(key, value);
+    }
+}
+
 void BlobCache::populate(const BlobCache::Key &key, angle::MemoryBuffer &&value, CacheSource source)
 {
+    // Blobs that were loaded from disk don't need to be written back.
+    if (source == CacheSource::Memory)
+    {
+        putDiskStore(key, value);
+    }
+
     std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
     CacheEntry newEntry;
     newEntry.first  = std::move(value);
@@ -125,17 +147,48 @@ bool BlobCache::get(const gl::Context *context,
         return true;
     }
 
-    std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
     // Otherwise we are doing caching internally, so try to find it there
     const CacheEntry *entry;
-    bool result = mBlobCache.get(key, &entry);
+    {
+        std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
+        if (mBlobCache.get(key, &entry))
+        {
+            *valueOut = BlobCache::Value(entry->first.data(), entry->first.size());
+            return true;
+        }
+    }
 
-    if (result)
+    // Blobs found on disk are copied into the in-memory cache, which then owns the memory the
+    // returned value points to.  Blobs too large for it are returned in the scratch buffer instead.
+    // The disk store is read without holding the cache lock, so other users of the cache don't
+    // wait for the file.
+    CacheEntry diskEntry;
+    diskEntry.second = CacheSource::Disk;
     {
+        std::scoped_lock<angle::SimpleMutex> lock(mDiskStoreMutex);
+        if (!mDiskStore.isOpen() || !mDiskStore.get(key, &diskEntry.first))
+        {
+            return false;
+        }
+    }
+
+    std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
+    const size_t size = diskEntry.first.size();
+    if (size <= mBlobCache.maxSize())
+    {
+        entry     = mBlobCache.put(key, std::move(diskEntry), size);
         *valueOut = BlobCache::Value(entry->first.data(), entry->first.size());
+        return true;
     }
 
-    return result;
+    angle::MemoryBuffer *scratchMemory;
+    if (scratchBuffer == nullptr || !scratchBuffer->get(size, &scratchMemory))
+    {
+        return false;
+    }
+    memcpy(scratchMemory->data(), diskEntry.first.data(), size);
+    *valueOut = BlobCache::Value(scratchMemory->data(), size);
+    return true;
 }
 
 bool BlobCache::getAt(size_t index, const BlobCache::Key **keyOut, BlobCache::Value *valueOut)
@@ -180,9 +233,77 @@ BlobCache::GetAndDecompressResult BlobCache::getAndDecompress(
 }
 
 void BlobCache::remove(const BlobCache::Key &key)
+{
+    {
+        std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
+        mBlobCache.eraseByKey(key);
+    }
+
+    std::scoped_lock<angle::SimpleMutex> lock(mDiskStoreMutex);
+    mDiskStore.remove(key);
+}
+
+void BlobCache::clear()
+{
+    std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
+    mBlobCache.clear();
+}
+
+void BlobCache::resize(size_t maxCacheSizeBytes)
+{
+    std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
+    mBlobCache.resize(maxCacheSizeBytes);
+}
+
+size_t BlobCache::entryCount() const
+{
+    std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
+    return mBlobCache.entryCount();
+}
+
+size_t BlobCache::trim(size_t limit)
+{
+    std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
+    return mBlobCache.shrinkToSize(limit);
+}
+
+size_t BlobCache::size() const
 {
     std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
-    mBlobCache.eraseByKey(key);
+    return mBlobCache.size();
+}
+
+size_t BlobCache::maxSize() const
+{
+    std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
+    return mBlobCache.maxSize();
+}
+
+bool BlobCache::openDiskStore(const std::string &path, size_t maxCacheSizeBytes)
+{
+    std::scoped_lock<angle::SimpleMutex> lock(mDiskStoreMutex);
+    return mDiskStore.open(path, maxCacheSizeBytes);
+}
+
+void BlobCache::closeDiskStore()
+{
+    std::scoped_lock<angle::SimpleMutex> lock(mDiskStoreMutex);
+    mDiskStore.close();
+}
+
+bool BlobCache::isDiskStoreOpen() const
+{
+    std::scoped_lock<angle::SimpleMutex> lock(mDiskStoreMutex);
+    return mDiskStore.isOpen();
+}
+
+void BlobCache::putDiskStore(const BlobCache::Key &key, const angle::MemoryBuffer &value)
+{
+    std::scoped_lock<angle::SimpleMutex> lock(mDiskStoreMutex);
+    if (mDiskStore.isOpen())
+    {
+        mDiskStore.put(key, value.data(), value.size());
+    }
 }
 
 void BlobCache::setBlobCacheFuncs(EGLSetBlobFuncANDROID set, EGLGetBlobFuncANDROID get)
@@ -203,7 +324,8 @@ bool BlobCache::areBlobCacheFuncsSet() const
 
 bool BlobCache::isCachingEnabled(const gl::Context *context) const
 {
-    return areBlobCacheFuncsSet() || (context && context->areBlobCacheFuncsSet()) || maxSize() > 0;
+    return areBlobCacheFuncsSet() || (context && context->areBlobCacheFuncsSet()) ||
+           maxSize() > 0 || isDiskStoreOpen();
 }
 
 size_t BlobCache::callBlobGetCallback(const gl::Context *context,
@@ -14,6 +14,7 @@
 #include <cstring>
 
 #include "common/SimpleMutex.h"
+#include "libANGLE/BlobCacheDiskStore.h"
 #include "libANGLE/Error.h"
 #include "libANGLE/SizedMRUCache.h"
 #include "libANGLE/angletypes.h"
@@ -71,6 +72,11 @@ class BlobCache final : angle::NonCopyable
                         const BlobCache::Key &key,
                         const angle::MemoryBuffer &value);
 
+    // Store a key-blob pair where it survives process restarts: in the application cache if
+    // callbacks are set, or otherwise in the disk store if open.  The in-memory cache is skipped,
+    // so this is used for data the caller already keeps in memory, such as the pipeline cache.
+    void putPersistent(const BlobCache::Key &key, const angle::MemoryBuffer &value);
+
     // Store a key-blob pair in the cache without making callbacks to the application.  This is used
     // to repopulate this object's cache on startup without generating callback calls.
     void populate(const BlobCache::Key &key,
@@ -78,7 +84,8 @@ class BlobCache final : angle::NonCopyable
                   CacheSource source = CacheSource::Disk);
 
     // Check if the cache contains the blob corresponding to this key.  If application callbacks are
-    // set, those will be used.  Otherwise they key is looked up in this object's cache.
+    // set, those will be used.  Otherwise they key is looked up in this object's cache, and then in
+    // the disk store if open.
     [[nodiscard]] bool get(const gl::Context *context,
                            angle::ScratchBuffer *scratchBuffer,
                            const BlobCache::Key &key,
@@ -106,25 +113,34 @@ class BlobCache final : angle::NonCopyable
     void remove(const BlobCache::Key &key);
 
     // Empty the cache.
-    void clear() { mBlobCache.clear(); }
+    void clear();
 
     // Resize the cache. Discards current contents.
-    void resize(size_t maxCacheSizeBytes) { mBlobCache.resize(maxCacheSizeBytes); }
+    void resize(size_t maxCacheSizeBytes);
 
     // Returns the number of entries in the cache.
-    size_t entryCount() const { return mBlobCache.entryCount(); }
+    size_t entryCount() const;
 
     // Reduces the current cache size and returns the number of bytes freed.
-    size_t trim(size_t limit) { return mBlobCache.shrinkToSize(limit); }
+    size_t trim(size_t limit);
 
     // Returns the current cache size in bytes.
-    size_t size() const { return mBlobCache.size(); }
+    size_t size() const;
 
     // Returns whether the cache is empty
-    bool empty() const { return mBlobCache.empty(); }
+    bool empty() const { return entryCount() == 0; }
 
     // Returns the maximum cache size in bytes.
-    size_t maxSize() const { return mBlobCache.maxSize(); }
+    size_t maxSize() const;
+
+    // Back the internal cache with a memory-mapped file at |path|, so that blobs survive process
+    // restarts.  Blobs stored in the in-memory cache are also written to the file, and blobs not
+    // found in memory are looked up there.  The file keeps its own size and is not affected by
+    // clear(), resize() or trim(), which only apply to the in-memory cache.  Blobs are still handed
+    // to the application instead if it sets blob cache callbacks.
+    [[nodiscard]] bool openDiskStore(const std::string &path, size_t maxCacheSizeBytes);
+    void closeDiskStore();
+    bool isDiskStoreOpen() const;
 
     void setBlobCacheFuncs(EGLSetBlobFuncANDROID set, EGLGetBlobFuncANDROID get);
 
@@ -134,6 +150,10 @@ class BlobCache final : angle::NonCopyable
 
     angle::SimpleMutex &getMutex() { return mBlobCacheMutex; }
 
+    // The codec used to compress blobs stored through this cache.
+    void setCompressionCodec(angle::BlobCompressionCodec codec) { mCompressionCodec = codec; }
+    angle::BlobCompressionCodec getCompressionCodec() const { return mCompressionCodec; }
+
   private:
     size_t callBlobGetCallback(const gl::Context *context,
                                const void *key,
@@ -141,14 +161,24 @@ class BlobCache final : angle::NonCopyable
                                void *value,
                                size_t valueSize);
 
+    // Writes the blob to the disk store if it's open.
+    void putDiskStore(const BlobCache::Key &key, const angle::MemoryBuffer &value);
+
     // This internal cache is used only if the application is not providing caching callbacks
     using CacheEntry = std::pair<angle::MemoryBuffer, CacheSource>;
 
     mutable angle::SimpleMutex mBlobCacheMutex;
     angle::SizedMRUCache<BlobCache::Key, CacheEntry> mBlobCache;
 
+    // The disk store has its own lock, so that the file I/O, and compaction in particular, doesn't
+    // block users of the in-memory cache.  The two locks are never held together.
+    mutable angle::SimpleMutex mDiskStoreMutex;
+    BlobCacheDiskStore mDiskStore;
+
     EGLSetBlobFuncANDROID mSetBlobFunc;
     EGLGetBlobFuncANDROID mGetBlobFunc;
+
+    angle::BlobCompressionCodec mCompressionCodec;
 };
 
 }  // namespace egl
@@ -0,0 +1,422 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// BlobCacheDiskStore.cpp: Implements the memory-mapped backing store for BlobCache.
+
+#include "libANGLE/BlobCacheDiskStore.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "common/debug.h"
+#include "common/mathutil.h"
+
+namespace egl
+{
+namespace
+{
+// File layout:
+//
+//   FileHeader | RecordHeader | blob | padding | RecordHeader | blob | padding | ...
+//
+// Records are only ever appended.  A blob that is replaced or removed is left in place and skipped
+// when the file is indexed; removal appends a tombstone record for this purpose.  The space is
+// reclaimed when the file is compacted.  FileHeader::endOffset is updated after a record is fully
+// written, so a partially written record at the end of the file is ignored on the next open.
+//
+// Other stores pick up appended records by indexing the file from where they last stopped.  When
+// records are moved or dropped, FileHeader::generation is incremented so that they reindex the
+// whole file instead.
+constexpr uint32_t kFileMagic     = 0x43424C41;  // "ALBC"
+constexpr uint32_t kFileVersion   = 2;
+constexpr uint32_t kRecordMagic   = 0x424F4C42;  // "BLOB"
+constexpr size_t kRecordAlignment = 8;
+
+enum RecordFlags : uint32_t
+{
+    kRecordFlagLive      = 0,
+    kRecordFlagTombstone = 1,
+};
+
+struct FileHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint64_t fileSize;
+    uint64_t endOffset;
+    uint64_t generation;
+};
+
+struct RecordHeader
+{
+    uint32_t magic;
+    uint32_t flags;
+    uint64_t size;
+    angle::BlobCacheKey key;
+    uint32_t crc;
+};
+
+static_assert(sizeof(FileHeader) % kRecordAlignment == 0, "Misaligned first record");
+static_assert(sizeof(RecordHeader) % kRecordAlignment == 0, "Misaligned blob data");
+
+size_t GetRecordSize(size_t blobSize)
+{
+    return sizeof(RecordHeader) + rx::roundUpPow2(blobSize, kRecordAlignment);
+}
+
+class [[nodiscard]] ScopedFileLock : angle::NonCopyable
+{
+  public:
+    ScopedFileLock(angle::MemoryMappedFile *file) : mFile(file) { mFile->lock(); }
+    ~ScopedFileLock() { mFile->unlock(); }
+
+  private:
+    angle::MemoryMappedFile *mFile;
+};
+}  // anonymous namespace
+
+BlobCacheDiskStore::BlobCacheDiskStore()
+    : mIndex(Index::NO_AUTO_EVICT), mEndOffset(0), mPayloadSize(0), mGeneration(0)
+{}
+
+BlobCacheDiskStore::~BlobCacheDiskStore()
+{
+    close();
+}
+
+bool BlobCacheDiskStore::open(const std::string &path, size_t maxSizeBytes)
+{
+    close();
+
+    if (!mFile.open(path, maxSizeBytes))
+    {
+        WARN() << "Failed to map blob cache file " << path;
+        return false;
+    }
+
+    if (mFile.size() <= sizeof(FileHeader) + sizeof(RecordHeader))
+    {
+        WARN() << "Blob cache file " << path << " is too small";
+        mFile.close();
+        return false;
+    }
+
+    ScopedFileLock lock(&mFile);
+    if (isHeaderValid())
+    {
+        reindex();
+    }
+    else
+    {
+        reset();
+    }
+
+    return true;
+}
+
+void BlobCacheDiskStore::close()
+{
+    if (isOpen())
+    {
+        mFile.flush();
+        mFile.close();
+    }
+    mIndex.Clear();
+    mEndOffset   = 0;
+    mPayloadSize = 0;
+    mGeneration  = 0;
+}
+
+bool BlobCacheDiskStore::put(const Key &key, const uint8_t *data, size_t size)
+{
+    const size_t recordSize = GetRecordSize(size);
+    if (!isOpen() || recordSize > maxSize() - sizeof(FileHeader))
+    {
+        return false;
+    }
+
+    ScopedFileLock lock(&mFile);
+    syncIndex();
+
+    // The previous record for this key, if any, becomes garbage.  A later record always takes
+    // precedence when the file is indexed, so no tombstone is needed.
+    auto existing = mIndex.Peek(key);
+    if (existing != mIndex.end())
+    {
+        mPayloadSize -= existing->second.size;
+        mIndex.Erase(existing);
+    }
+
+    if (recordSize > freeSpace())
+    {
+        // Evict until the new blob fits with some room to spare, so that the next few puts don't
+        // immediately trigger another compaction.
+        const size_t capacity   = maxSize() - sizeof(FileHeader);
+        const size_t targetSize = capacity - std::max(recordSize, capacity / 4);
+
+        size_t liveSize = 0;
+        for (const auto &iter : mIndex)
+        {
+            liveSize += GetRecordSize(iter.second.size);
+        }
+        while (liveSize > targetSize)
+        {
+            ASSERT(!mIndex.empty());
+            liveSize -= GetRecordSize(mIndex.rbegin()->second.size);
+            evict(mIndex.rbegin());
+        }
+
+        compact();
+    }
+
+    ASSERT(recordSize <= freeSpace());
+    appendRecord(key, data, size, kRecordFlagLive);
+    return true;
+}
+
+bool BlobCacheDiskStore::get(const Key &key, angle::MemoryBuffer *valueOut)
+{
+    if (!isOpen())
+    {
+        return false;
+    }
+
+    ScopedFileLock lock(&mFile);
+    syncIndex();
+
+    auto iter = mIndex.Get(key);
+    if (iter == mIndex.end())
+    {
+        return false;
+    }
+
+    Entry &entry        = iter->second;
+    const uint8_t *blob = mFile.data() + entry.offset + sizeof(RecordHeader);
+
+    // The file may have been corrupted or truncated behind our back.  The crc is checked only the
+    // first time a blob is used to keep open() cheap.
+    if (!entry.verified)
+    {
+        if (angle::GenerateCRC32(blob, entry.size) != entry.crc)
+        {
+            WARN() << "Discarding corrupted blob cache entry";
+            removeLocked(key);
+            return false;
+        }
+        entry.verified = true;
+    }
+
+    if (!valueOut->resize(entry.size))
+    {
+        return false;
+    }
+    if (entry.size > 0)
+    {
+        memcpy(valueOut->data(), blob, entry.size);
+    }
+    return true;
+}
+
+void BlobCacheDiskStore::remove(const Key &key)
+{
+    if (!isOpen())
+    {
+        return;
+    }
+
+    ScopedFileLock lock(&mFile);
+    syncIndex();
+    removeLocked(key);
+}
+
+void BlobCacheDiskStore::removeLocked(const Key &key)
+{
+    auto iter = mIndex.Peek(key);
+    if (iter == mIndex.end())
+    {
+        return;
+    }
+
+    mPayloadSize -= iter->second.size;
+    mIndex.Erase(iter);
+
+    // Compacting drops the removed record from the file entirely, otherwise a tombstone makes sure
+    // it's not indexed again on the next open.
+    if (freeSpace() < sizeof(RecordHeader))
+    {
+        compact();
+    }
+    else
+    {
+        appendRecord(key, nullptr, 0, kRecordFlagTombstone);
+    }
+}
+
+void BlobCacheDiskStore::compact()
+{
+    std::vector<Entry *> liveEntries;
+    liveEntries.reserve(mIndex.size());
+    for (auto &iter : mIndex)
+    {
+        liveEntries.push_back(&iter.second);
+    }
+    std::sort(liveEntries.begin(), liveEntries.end(),
+              [](const Entry *a, const Entry *b) { return a->offset < b->offset; });
+
+    // Mark the file empty while records are being moved, so an interrupted compaction results in
+    // an empty cache rather than a corrupt one.  Other stores reindex the file after this.
+    setEndOffset(sizeof(FileHeader));
+    FileHeader *header = reinterpret_cast<FileHeader *>(mFile.data());
+    mGeneration        = header->generation + 1;
+    header->generation = mGeneration;
+
+    // Records only ever move towards the start of the file, so they can be moved in place.
+    size_t writeOffset = sizeof(FileHeader);
+    for (Entry *entry : liveEntries)
+    {
+        ASSERT(entry->offset >= writeOffset);
+        const size_t recordSize = GetRecordSize(entry->size);
+        if (entry->offset != writeOffset)
+        {
+            memmove(mFile.data() + writeOffset, mFile.data() + entry->offset, recordSize);
+            entry->offset = writeOffset;
+        }
+        writeOffset += recordSize;
+    }
+
+    setEndOffset(writeOffset);
+}
+
+size_t BlobCacheDiskStore::freeSpace() const
+{
+    return isOpen() ? mFile.size() - mEndOffset : 0;
+}
+
+void BlobCacheDiskStore::syncIndex()
+{
+    const FileHeader *header = reinterpret_cast<const FileHeader *>(mFile.data());
+    if (!isHeaderValid())
+    {
+        WARN() << "Discarding corrupted blob cache file";
+        reset();
+    }
+    else if (header->generation != mGeneration || header->endOffset < mEndOffset)
+    {
+        reindex();
+    }
+    else if (header->endOffset > mEndOffset)
+    {
+        indexRecords(static_cast<size_t>(header->endOffset));
+    }
+}
+
+bool BlobCacheDiskStore::isHeaderValid() const
+{
+    const FileHeader *header = reinterpret_cast<const FileHeader *>(mFile.data());
+    return header->magic == kFileMagic && header->version == kFileVersion &&
+           header->fileSize == mFile.size() && header->endOffset >= sizeof(FileHeader) &&
+           header->endOffset <= mFile.size();
+}
+
+void BlobCacheDiskStore::reset()
+{
+    FileHeader *header = reinterpret_cast<FileHeader *>(mFile.data());
+    mGeneration        = header->generation + 1;
+    header->magic      = kFileMagic;
+    header->version    = kFileVersion;
+    header->fileSize   = mFile.size();
+    header->generation = mGeneration;
+    setEndOffset(sizeof(FileHeader));
+
+    mIndex.Clear();
+    mPayloadSize = 0;
+}
+
+void BlobCacheDiskStore::reindex()
+{
+    const FileHeader *header = reinterpret_cast<const FileHeader *>(mFile.data());
+
+    mIndex.Clear();
+    mPayloadSize = 0;
+    mEndOffset   = sizeof(FileHeader);
+    mGeneration  = header->generation;
+    indexRecords(static_cast<size_t>(header->endOffset));
+}
+
+void BlobCacheDiskStore::indexRecords(size_t endOffset)
+{
+    size_t offset = mEndOffset;
+    while (offset + sizeof(RecordHeader) <= endOffset)
+    {
+        const RecordHeader *record = reinterpret_cast<const RecordHeader *>(mFile.data() + offset);
+        if (record->magic != kRecordMagic || record->size > endOffset - offset ||
+            GetRecordSize(static_cast<size_t>(record->size)) > endOffset - offset)
+        {
+            break;
+        }
+
+        auto existing = mIndex.Peek(record->key);
+        if (existing != mIndex.end())
+        {
+            mPayloadSize -= existing->second.size;
+            mIndex.Erase(existing);
+        }
+
+        const size_t blobSize = static_cast<size_t>(record->size);
+        if (record->flags == kRecordFlagLive)
+        {
+            mIndex.Put(record->key, Entry{offset, blobSize, record->crc, false});
+            mPayloadSize += blobSize;
+        }
+
+        offset += GetRecordSize(blobSize);
+    }
+
+    // Anything past the last valid record is dropped.
+    setEndOffset(offset);
+}
+
+void BlobCacheDiskStore::appendRecord(const Key &key,
+                                      const uint8_t *data,
+                                      size_t size,
+                                      uint32_t flags)
+{
+    ASSERT(GetRecordSize(size) <= freeSpace());
+
+    const size_t offset  = mEndOffset;
+    RecordHeader *record = reinterpret_cast<RecordHeader *>(mFile.data() + offset);
+    record->magic        = kRecordMagic;
+    record->flags        = flags;
+    record->size         = size;
+    record->key          = key;
+    record->crc          = size > 0 ? angle::GenerateCRC32(data, size) : 0;
+    if (size > 0)
+    {
+        memcpy(mFile.data() + offset + sizeof(RecordHeader), data, size);
+    }
+
+    if (flags == kRecordFlagLive)
+    {
+        // The blob was just written from memory, so it doesn't need to be verified.
+        mIndex.Put(key, Entry{offset, size, record->crc, true});
+        mPayloadSize += size;
+    }
+
+    setEndOffset(offset + GetRecordSize(size));
+}
+
+void BlobCacheDiskStore::evict(Index::reverse_iterator iter)
+{
+    mPayloadSize -= iter->second.size;
+    mIndex.Erase(iter);
+}
+
+void BlobCacheDiskStore::setEndOffset(size_t endOffset)
+{
+    mEndOffset = endOffset;
+    reinterpret_cast<FileHeader *>(mFile.data())->endOffset = endOffset;
+}
+
+}  // namespace egl
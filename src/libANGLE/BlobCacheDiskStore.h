@@ -0,0 +1,104 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// BlobCacheDiskStore: A persistent backing store for BlobCache.  Blobs are appended to a
+//   memory-mapped file and indexed by their BlobCache key.  When the file fills up, the least
+//   recently used blobs are dropped and the survivors are compacted towards the start of the file.
+//   The file may be shared by any number of stores, in this or other processes; every access
+//   takes a lock on the file and first catches up with the changes made by the other stores.
+
+#ifndef LIBANGLE_BLOB_CACHE_DISK_STORE_H_
+#define LIBANGLE_BLOB_CACHE_DISK_STORE_H_
+
+#include <anglebase/containers/mru_cache.h>
+
+#include "common/MemoryBuffer.h"
+#include "common/system_utils.h"
+#include "libANGLE/angletypes.h"
+
+namespace egl
+{
+
+class BlobCacheDiskStore final : angle::NonCopyable
+{
+  public:
+    using Key = angle::BlobCacheKey;
+
+    BlobCacheDiskStore();
+    ~BlobCacheDiskStore();
+
+    // Maps the file at |path|.  The file is created with a total size of |maxSizeBytes| if it
+    // doesn't exist, otherwise it keeps its own size.  Blobs already in the file are indexed.  A
+    // file that was written by a different version is discarded.
+    [[nodiscard]] bool open(const std::string &path, size_t maxSizeBytes);
+    void close();
+    bool isOpen() const { return mFile.valid(); }
+
+    // Appends a blob.  Older blobs are evicted and the file compacted if there is not enough room
+    // left at the end of the file.  Returns false if the blob can never fit.
+    bool put(const Key &key, const uint8_t *data, size_t size);
+
+    // Looks up a blob and copies it to |valueOut|.  The blob is copied out of the mapping because
+    // another store may compact the file as soon as the lock is released.
+    [[nodiscard]] bool get(const Key &key, angle::MemoryBuffer *valueOut);
+
+    void remove(const Key &key);
+
+    // Returns the number of blobs in the store, as of the last access.
+    size_t entryCount() const { return mIndex.size(); }
+
+    // Returns the total size of the blobs in the store in bytes, as of the last access.
+    size_t size() const { return mPayloadSize; }
+
+    // Returns the size of the mapped file, in bytes.
+    size_t maxSize() const { return mFile.size(); }
+
+    // Returns the number of bytes that can still be appended without compacting, as of the last
+    // access.
+    size_t freeSpace() const;
+
+  private:
+    struct Entry
+    {
+        // Offset of the record header in the file.
+        size_t offset;
+        size_t size;
+        uint32_t crc;
+        // Set once the crc has been checked against the file contents.
+        bool verified;
+    };
+    using Index = angle::base::HashingMRUCache<Key, Entry>;
+
+    // Brings the index up to date with the records other stores have written to the file.  Must be
+    // called with the file locked.
+    void syncIndex();
+    bool isHeaderValid() const;
+    void reset();
+    void reindex();
+    void indexRecords(size_t endOffset);
+
+    void removeLocked(const Key &key);
+    void appendRecord(const Key &key, const uint8_t *data, size_t size, uint32_t flags);
+    void evict(Index::reverse_iterator iter);
+    // Moves all live blobs to the start of the file, reclaiming space used by evicted, removed or
+    // replaced blobs.
+    void compact();
+    void setEndOffset(size_t endOffset);
+
+    angle::MemoryMappedFile mFile;
+    Index mIndex;
+
+    // Offset past the last record indexed.
+    size_t mEndOffset;
+    // Total size of the live blobs.
+    size_t mPayloadSize;
+    // The file's generation when it was last indexed.  Stores increment it when they move or drop
+    // records.
+    uint64_t mGeneration;
+};
+
+}  // namespace egl
+
+#endif  // LIBANGLE_BLOB_CACHE_DISK_STORE_H_
@@ -0,0 +1,408 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// BlobCacheDiskStore_unittest.cpp: Unit tests for the memory-mapped blob cache backing store.
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+
+#include "common/system_utils.h"
+#include "libANGLE/BlobCache.h"
+#include "libANGLE/BlobCacheDiskStore.h"
+#include "util/test_utils.h"
+
+namespace egl
+{
+namespace
+{
+using Key   = BlobCacheDiskStore::Key;
+using Value = BlobCache::Value;
+
+Key MakeKey(uint8_t start)
+{
+    Key key;
+    for (size_t i = 0; i < key.size(); ++i)
+    {
+        key[i] = static_cast<uint8_t>(start + i);
+    }
+    return key;
+}
+
+std::vector<uint8_t> MakeBlob(size_t size, uint8_t start)
+{
+    std::vector<uint8_t> blob(size);
+    for (size_t i = 0; i < size; ++i)
+    {
+        blob[i] = static_cast<uint8_t>(start + i);
+    }
+    return blob;
+}
+
+angle::MemoryBuffer MakeBuffer(const std::vector<uint8_t> &blob)
+{
+    angle::MemoryBuffer buffer;
+    EXPECT_TRUE(buffer.resize(blob.size()));
+    memcpy(buffer.data(), blob.data(), blob.size());
+    return buffer;
+}
+
+bool BlobEquals(const uint8_t *data, size_t size, const std::vector<uint8_t> &expected)
+{
+    return size == expected.size() && memcmp(data, expected.data(), expected.size()) == 0;
+}
+
+bool BlobEquals(const angle::MemoryBuffer &value, const std::vector<uint8_t> &expected)
+{
+    return BlobEquals(value.data(), value.size(), expected);
+}
+
+bool BlobEquals(Value value, const std::vector<uint8_t> &expected)
+{
+    return BlobEquals(value.data(), value.size(), expected);
+}
+
+class BlobCacheDiskStoreTest : public testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        Optional<std::string> path = angle::CreateTemporaryFile();
+        ASSERT_TRUE(path.valid());
+        mPath = path.value();
+    }
+
+    void TearDown() override { angle::DeleteSystemFile(mPath.c_str()); }
+
+    std::string mPath;
+};
+
+#if defined(ANGLE_PLATFORM_ANDROID) || defined(ANGLE_IS_WINUWP)
+#    define MAYBE_TEST_F(fixture, name) TEST_F(fixture, DISABLED_##name)
+#else
+#    define MAYBE_TEST_F(fixture, name) TEST_F(fixture, name)
+#endif
+
+// Test that blobs are found again after the file is closed and reopened.
+MAYBE_TEST_F(BlobCacheDiskStoreTest, PersistsAcrossReopen)
+{
+    constexpr size_t kMaxSize = 64 * 1024;
+
+    const std::vector<uint8_t> blob0 = MakeBlob(100, 0);
+    const std::vector<uint8_t> blob1 = MakeBlob(3000, 7);
+
+    {
+        BlobCacheDiskStore store;
+        ASSERT_TRUE(store.open(mPath, kMaxSize));
+        EXPECT_TRUE(store.put(MakeKey(0), blob0.data(), blob0.size()));
+        EXPECT_TRUE(store.put(MakeKey(1), blob1.data(), blob1.size()));
+        EXPECT_EQ(2u, store.entryCount());
+        EXPECT_EQ(blob0.size() + blob1.size(), store.size());
+    }
+
+    BlobCacheDiskStore store;
+    ASSERT_TRUE(store.open(mPath, kMaxSize));
+    EXPECT_EQ(2u, store.entryCount());
+
+    angle::MemoryBuffer value;
+    ASSERT_TRUE(store.get(MakeKey(0), &value));
+    EXPECT_TRUE(BlobEquals(value, blob0));
+    ASSERT_TRUE(store.get(MakeKey(1), &value));
+    EXPECT_TRUE(BlobEquals(value, blob1));
+}
+
+// Test that replacing and removing blobs is remembered across reopens.
+MAYBE_TEST_F(BlobCacheDiskStoreTest, ReplaceAndRemovePersist)
+{
+    constexpr size_t kMaxSize = 64 * 1024;
+
+    const std::vector<uint8_t> oldBlob = MakeBlob(50, 1);
+    const std::vector<uint8_t> newBlob = MakeBlob(70, 2);
+
+    {
+        BlobCacheDiskStore store;
+        ASSERT_TRUE(store.open(mPath, kMaxSize));
+        EXPECT_TRUE(store.put(MakeKey(0), oldBlob.data(), oldBlob.size()));
+        EXPECT_TRUE(store.put(MakeKey(0), newBlob.data(), newBlob.size()));
+        EXPECT_TRUE(store.put(MakeKey(1), oldBlob.data(), oldBlob.size()));
+        store.remove(MakeKey(1));
+        EXPECT_EQ(1u, store.entryCount());
+    }
+
+    BlobCacheDiskStore store;
+    ASSERT_TRUE(store.open(mPath, kMaxSize));
+    EXPECT_EQ(1u, store.entryCount());
+
+    angle::MemoryBuffer value;
+    ASSERT_TRUE(store.get(MakeKey(0), &value));
+    EXPECT_TRUE(BlobEquals(value, newBlob));
+    EXPECT_FALSE(store.get(MakeKey(1), &value));
+}
+
+// Test that filling the file evicts the least recently used blobs and keeps the rest intact.
+MAYBE_TEST_F(BlobCacheDiskStoreTest, CompactionEvictsLeastRecentlyUsed)
+{
+    constexpr size_t kMaxSize  = 16 * 1024;
+    constexpr size_t kBlobSize = 1000;
+
+    BlobCacheDiskStore store;
+    ASSERT_TRUE(store.open(mPath, kMaxSize));
+
+    // Fill the file, keeping key 0 in use so it's never the least recently used.
+    uint8_t keyCount = 0;
+    while (store.freeSpace() > 2 * kBlobSize)
+    {
+        const std::vector<uint8_t> blob = MakeBlob(kBlobSize, keyCount);
+        EXPECT_TRUE(store.put(MakeKey(keyCount), blob.data(), blob.size()));
+        ++keyCount;
+
+        angle::MemoryBuffer value;
+        EXPECT_TRUE(store.get(MakeKey(0), &value));
+    }
+
+    // Keep a blob read before the compaction, which must not be affected by it.
+    angle::MemoryBuffer valueBeforeCompaction;
+    ASSERT_TRUE(store.get(MakeKey(0), &valueBeforeCompaction));
+
+    const std::vector<uint8_t> blob = MakeBlob(kBlobSize, 200);
+    for (int iteration = 0; iteration < 3; ++iteration)
+    {
+        EXPECT_TRUE(store.put(MakeKey(200), blob.data(), blob.size()));
+    }
+    EXPECT_TRUE(store.put(MakeKey(201), blob.data(), blob.size()));
+    EXPECT_LE(store.size(), kMaxSize);
+    EXPECT_TRUE(BlobEquals(valueBeforeCompaction, MakeBlob(kBlobSize, 0)));
+
+    angle::MemoryBuffer value;
+    EXPECT_FALSE(store.get(MakeKey(1), &value));
+    ASSERT_TRUE(store.get(MakeKey(0), &value));
+    EXPECT_TRUE(BlobEquals(value, MakeBlob(kBlobSize, 0)));
+    ASSERT_TRUE(store.get(MakeKey(200), &value));
+    EXPECT_TRUE(BlobEquals(value, blob));
+    ASSERT_TRUE(store.get(MakeKey(201), &value));
+    EXPECT_TRUE(BlobEquals(value, blob));
+
+    // Blobs larger than the file are rejected.
+    const std::vector<uint8_t> hugeBlob = MakeBlob(kMaxSize, 0);
+    EXPECT_FALSE(store.put(MakeKey(202), hugeBlob.data(), hugeBlob.size()));
+}
+
+// Test that reopening with a different size keeps the file at its own size and keeps its contents.
+MAYBE_TEST_F(BlobCacheDiskStoreTest, ReopenKeepsFileSize)
+{
+    const std::vector<uint8_t> blob = MakeBlob(100, 0);
+
+    {
+        BlobCacheDiskStore store;
+        ASSERT_TRUE(store.open(mPath, 64 * 1024));
+        EXPECT_TRUE(store.put(MakeKey(0), blob.data(), blob.size()));
+    }
+
+    BlobCacheDiskStore store;
+    ASSERT_TRUE(store.open(mPath, 32 * 1024));
+    EXPECT_EQ(64u * 1024u, store.maxSize());
+    EXPECT_EQ(1u, store.entryCount());
+
+    angle::MemoryBuffer value;
+    ASSERT_TRUE(store.get(MakeKey(0), &value));
+    EXPECT_TRUE(BlobEquals(value, blob));
+}
+
+// Test that stores sharing a file see each other's changes, including after a compaction moved the
+// records around.
+MAYBE_TEST_F(BlobCacheDiskStoreTest, SharedBetweenStores)
+{
+    constexpr size_t kMaxSize  = 16 * 1024;
+    constexpr size_t kBlobSize = 1000;
+
+    BlobCacheDiskStore store0;
+    BlobCacheDiskStore store1;
+    ASSERT_TRUE(store0.open(mPath, kMaxSize));
+    ASSERT_TRUE(store1.open(mPath, kMaxSize));
+
+    const std::vector<uint8_t> blob0 = MakeBlob(kBlobSize, 0);
+    EXPECT_TRUE(store0.put(MakeKey(0), blob0.data(), blob0.size()));
+
+    angle::MemoryBuffer value;
+    ASSERT_TRUE(store1.get(MakeKey(0), &value));
+    EXPECT_TRUE(BlobEquals(value, blob0));
+
+    // Fill the file through the second store until it has compacted it, keeping key 0 in use.
+    for (uint8_t key = 1; key < 40; ++key)
+    {
+        const std::vector<uint8_t> blob = MakeBlob(kBlobSize, key);
+        EXPECT_TRUE(store1.put(MakeKey(key), blob.data(), blob.size()));
+        EXPECT_TRUE(store1.get(MakeKey(0), &value));
+    }
+
+    // The first store reindexes the file and finds the blobs at their new offsets.
+    ASSERT_TRUE(store0.get(MakeKey(0), &value));
+    EXPECT_TRUE(BlobEquals(value, blob0));
+    ASSERT_TRUE(store0.get(MakeKey(39), &value));
+    EXPECT_TRUE(BlobEquals(value, MakeBlob(kBlobSize, 39)));
+    EXPECT_FALSE(store0.get(MakeKey(1), &value));
+
+    // Removal is seen by the other store too.
+    store0.remove(MakeKey(39));
+    EXPECT_FALSE(store1.get(MakeKey(39), &value));
+    EXPECT_EQ(store0.entryCount(), store1.entryCount());
+}
+
+// Test that BlobCache writes blobs through to the disk store and reads them back from it.
+MAYBE_TEST_F(BlobCacheDiskStoreTest, BlobCacheUsesDiskStore)
+{
+    constexpr size_t kMaxSize = 64 * 1024;
+
+    const std::vector<uint8_t> blob = MakeBlob(2000, 3);
+    {
+        BlobCache blobCache(4096);
+        ASSERT_TRUE(blobCache.openDiskStore(mPath, kMaxSize));
+        blobCache.populate(MakeKey(0), MakeBuffer(blob), BlobCache::CacheSource::Memory);
+        EXPECT_EQ(1u, blobCache.entryCount());
+        blobCache.closeDiskStore();
+    }
+
+    BlobCache blobCache(4096);
+    ASSERT_TRUE(blobCache.openDiskStore(mPath, kMaxSize));
+    EXPECT_EQ(0u, blobCache.entryCount());
+
+    Value value;
+    ASSERT_TRUE(blobCache.get(nullptr, nullptr, MakeKey(0), &value));
+    EXPECT_TRUE(BlobEquals(value, blob));
+
+    // The blob is now cached in memory as well.
+    EXPECT_EQ(1u, blobCache.entryCount());
+
+    // Blobs too large for the in-memory cache are returned through the scratch buffer.
+    const std::vector<uint8_t> largeBlob = MakeBlob(8000, 5);
+    blobCache.populate(MakeKey(1), MakeBuffer(largeBlob), BlobCache::CacheSource::Memory);
+    angle::ScratchBuffer scratchBuffer;
+    ASSERT_TRUE(blobCache.get(nullptr, &scratchBuffer, MakeKey(1), &value));
+    EXPECT_TRUE(BlobEquals(value, largeBlob));
+}
+
+// Test that clearing, resizing and trimming the in-memory cache leave the disk store intact.
+MAYBE_TEST_F(BlobCacheDiskStoreTest, BlobCacheClearKeepsDiskStore)
+{
+    constexpr size_t kMaxSize = 64 * 1024;
+
+    const std::vector<uint8_t> blob0 = MakeBlob(100, 1);
+    const std::vector<uint8_t> blob1 = MakeBlob(100, 2);
+    const std::vector<uint8_t> blob2 = MakeBlob(100, 3);
+
+    BlobCache blobCache(4096);
+    ASSERT_TRUE(blobCache.openDiskStore(mPath, kMaxSize));
+    blobCache.populate(MakeKey(0), MakeBuffer(blob0), BlobCache::CacheSource::Memory);
+    blobCache.clear();
+    blobCache.populate(MakeKey(1), MakeBuffer(blob1), BlobCache::CacheSource::Memory);
+    blobCache.resize(8192);
+    blobCache.populate(MakeKey(2), MakeBuffer(blob2), BlobCache::CacheSource::Memory);
+    EXPECT_EQ(blob2.size(), blobCache.trim(0));
+    EXPECT_EQ(0u, blobCache.entryCount());
+
+    BlobCacheDiskStore store;
+    ASSERT_TRUE(store.open(mPath, kMaxSize));
+    EXPECT_EQ(3u, store.entryCount());
+
+    Value value;
+    ASSERT_TRUE(blobCache.get(nullptr, nullptr, MakeKey(0), &value));
+    EXPECT_TRUE(BlobEquals(value, blob0));
+    ASSERT_TRUE(blobCache.get(nullptr, nullptr, MakeKey(1), &value));
+    EXPECT_TRUE(BlobEquals(value, blob1));
+    ASSERT_TRUE(blobCache.get(nullptr, nullptr, MakeKey(2), &value));
+    EXPECT_TRUE(BlobEquals(value, blob2));
+}
+
+// Test that blobs the application loaded from its own disk cache aren't written to the disk store.
+MAYBE_TEST_F(BlobCacheDiskStoreTest, BlobCacheSkipsBlobsFromDisk)
+{
+    constexpr size_t kMaxSize = 64 * 1024;
+
+    BlobCache blobCache(4096);
+    ASSERT_TRUE(blobCache.openDiskStore(mPath, kMaxSize));
+    blobCache.populate(MakeKey(0), MakeBuffer(MakeBlob(100, 0)), BlobCache::CacheSource::Disk);
+    blobCache.populate(MakeKey(1), MakeBuffer(MakeBlob(100, 1)), BlobCache::CacheSource::Memory);
+    EXPECT_EQ(2u, blobCache.entryCount());
+
+    BlobCacheDiskStore store;
+    ASSERT_TRUE(store.open(mPath, kMaxSize));
+    EXPECT_EQ(1u, store.entryCount());
+
+    angle::MemoryBuffer value;
+    EXPECT_FALSE(store.get(MakeKey(0), &value));
+    EXPECT_TRUE(store.get(MakeKey(1), &value));
+}
+
+// Test that blobs stored with putPersistent(), as the Vulkan backend does with its pipeline cache,
+// skip the in-memory cache but are found by a new cache on a cold start.
+MAYBE_TEST_F(BlobCacheDiskStoreTest, BlobCachePersistentSurvivesColdStart)
+{
+    constexpr size_t kMaxSize = 64 * 1024;
+
+    const std::vector<uint8_t> blob = MakeBlob(3000, 7);
+    {
+        BlobCache blobCache(4096);
+        ASSERT_TRUE(blobCache.openDiskStore(mPath, kMaxSize));
+        blobCache.putPersistent(MakeKey(0), MakeBuffer(blob));
+        EXPECT_EQ(0u, blobCache.entryCount());
+        blobCache.closeDiskStore();
+    }
+
+    BlobCache blobCache(4096);
+    ASSERT_TRUE(blobCache.openDiskStore(mPath, kMaxSize));
+
+    Value value;
+    ASSERT_TRUE(blobCache.get(nullptr, nullptr, MakeKey(0), &value));
+    EXPECT_TRUE(BlobEquals(value, blob));
+}
+
+// Test that threads using the in-memory cache and the disk store at the same time, which take the
+// two locks separately, see every blob.
+MAYBE_TEST_F(BlobCacheDiskStoreTest, BlobCacheConcurrentAccess)
+{
+    constexpr size_t kMaxSize     = 16 * 1024;
+    constexpr size_t kThreadCount = 4;
+    constexpr uint8_t kBlobCount  = 16;
+    constexpr size_t kBlobSize    = 500;
+
+    // The in-memory cache holds every blob, as the values returned by get() point into it, but
+    // together the threads write more than the disk store holds, so it compacts while they run.
+    BlobCache blobCache(kThreadCount * kBlobCount * kBlobSize);
+    ASSERT_TRUE(blobCache.openDiskStore(mPath, kMaxSize));
+
+    std::vector<std::thread> threads;
+    std::atomic<size_t> mismatchCount(0);
+    for (size_t threadIndex = 0; threadIndex < kThreadCount; ++threadIndex)
+    {
+        threads.emplace_back([&, threadIndex]() {
+            for (uint8_t blobIndex = 0; blobIndex < kBlobCount; ++blobIndex)
+            {
+                const uint8_t keyStart = static_cast<uint8_t>(threadIndex * kBlobCount + blobIndex);
+                const std::vector<uint8_t> blob = MakeBlob(kBlobSize, keyStart);
+                blobCache.populate(MakeKey(keyStart), MakeBuffer(blob),
+                                   BlobCache::CacheSource::Memory);
+
+                Value value;
+                if (blobCache.get(nullptr, nullptr, MakeKey(keyStart), &value) &&
+                    !BlobEquals(value, blob))
+                {
+                    mismatchCount++;
+                }
+            }
+        });
+    }
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+    EXPECT_EQ(0u, mismatchCount);
+
+    // The blobs kept by compaction are still in the file.
+    BlobCacheDiskStore store;
+    ASSERT_TRUE(store.open(mPath, kMaxSize));
+    EXPECT_GT(store.entryCount(), 0u);
+}
+}  // anonymous namespace
+}  // namespace egl
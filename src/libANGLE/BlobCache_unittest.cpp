@@ -127,4 +127,54 @@ TEST(BlobCacheTest, OversizeValue)
     EXPECT_FALSE(blobCache.get(nullptr, nullptr, MakeKey(5), &qvalue));
 }
 
+// Tests that compressed blobs round trip with every codec, and are rejected when corrupted.
+TEST(BlobCacheTest, CompressionCodecs)
+{
+    BlobPut input;
+    ASSERT_TRUE(input.resize(4096));
+    for (size_t i = 0; i < input.size(); ++i)
+    {
+        input[i] = static_cast<uint8_t>(i % 97);
+    }
+
+    for (angle::BlobCompressionCodec codec :
+         {angle::BlobCompressionCodec::Gzip, angle::BlobCompressionCodec::LZ4})
+    {
+        angle::MemoryBuffer compressed;
+        ASSERT_TRUE(angle::CompressBlob(codec, input.size(), input.data(), &compressed));
+        EXPECT_LT(compressed.size(), input.size());
+
+        angle::MemoryBuffer output;
+        ASSERT_TRUE(
+            angle::DecompressBlob(compressed.data(), compressed.size(), input.size(), &output));
+        ASSERT_EQ(input.size(), output.size());
+        EXPECT_EQ(0, memcmp(input.data(), output.data(), input.size()));
+
+        // The size limit is enforced.
+        EXPECT_FALSE(
+            angle::DecompressBlob(compressed.data(), compressed.size(), input.size() - 1, &output));
+
+        // Corruption is caught by the checksum.
+        compressed[compressed.size() / 2] ^= 0xFF;
+        EXPECT_FALSE(
+            angle::DecompressBlob(compressed.data(), compressed.size(), input.size(), &output));
+    }
+}
+
+// Tests that headerless gzip blobs written by older versions can still be decompressed.
+TEST(BlobCacheTest, DecompressLegacyGzipBlob)
+{
+    // gzip stream of "legacy gzip blob".
+    constexpr uint8_t kLegacyBlob[] = {
+        0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xCB, 0x49,
+        0x4D, 0x4F, 0x4C, 0xAE, 0x54, 0x48, 0xAF, 0xCA, 0x2C, 0x50, 0x48, 0xCA,
+        0xC9, 0x4F, 0x02, 0x00, 0x08, 0x29, 0x8E, 0xEC, 0x10, 0x00, 0x00, 0x00};
+    constexpr char kExpected[] = "legacy gzip blob";
+
+    angle::MemoryBuffer output;
+    ASSERT_TRUE(angle::DecompressBlob(kLegacyBlob, sizeof(kLegacyBlob), 1024, &output));
+    ASSERT_EQ(strlen(kExpected), output.size());
+    EXPECT_EQ(0, memcmp(kExpected, output.data(), output.size()));
+}
+
 }  // namespace egl
@@ -250,8 +250,7 @@ angle::Result Buffer::bufferSubData(const Context *context,
 {
     ANGLE_TRY(mImpl->setSubData(context, target, data, size, offset));
 
-    mIndexRangeCache.invalidateRange(static_cast<unsigned int>(offset),
-                                     static_cast<unsigned int>(size));
+    mIndexRangeCache.invalidateRange(static_cast<size_t>(offset), static_cast<size_t>(size));
 
     // Notify when data changes.
     onContentsChange();
@@ -268,8 +267,7 @@ angle::Result Buffer::copyBufferSubData(const Context *context,
     ANGLE_TRY(
         mImpl->copySubData(context, source->getImplementation(), sourceOffset, destOffset, size));
 
-    mIndexRangeCache.invalidateRange(static_cast<unsigned int>(destOffset),
-                                     static_cast<unsigned int>(size));
+    mIndexRangeCache.invalidateRange(static_cast<size_t>(destOffset), static_cast<size_t>(size));
 
     // Notify when data changes.
     onContentsChange();
@@ -323,8 +321,8 @@ angle::Result Buffer::mapRange(const Context *context,
 
     if ((access & GL_MAP_WRITE_BIT) > 0)
     {
-        mIndexRangeCache.invalidateRange(static_cast<unsigned int>(offset),
-                                         static_cast<unsigned int>(length));
+        mIndexRangeCache.invalidateRange(static_cast<size_t>(offset),
+                                         static_cast<size_t>(length));
     }
 
     // Notify when state changes.
@@ -32,6 +32,7 @@
 #include "libANGLE/Fence.h"
 #include "libANGLE/FramebufferAttachment.h"
 #include "libANGLE/MemoryObject.h"
+#include "libANGLE/PerfCounterExport.h"
 #include "libANGLE/PixelLocalStorage.h"
 #include "libANGLE/Program.h"
 #include "libANGLE/ProgramPipeline.h"
@@ -9646,6 +9647,11 @@ void Context::onPreSwap()
 {
     // Dump frame capture if enabled.
     getShareGroup()->getFrameCaptureShared()->onEndFrame(this);
+
+    if (PerfCounterExport *perfCounterExport = PerfCounterExport::Get())
+    {
+        perfCounterExport->onFrameEnd(this);
+    }
 }
 
 void Context::getTexImage(TextureTarget target,
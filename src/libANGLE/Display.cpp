@@ -33,6 +33,7 @@
 #include "libANGLE/Device.h"
 #include "libANGLE/EGLSync.h"
 #include "libANGLE/Image.h"
+#include "libANGLE/PerfCounterExport.h"
 #include "libANGLE/ResourceManager.h"
 #include "libANGLE/Stream.h"
 #include "libANGLE/Surface.h"
@@ -142,6 +143,11 @@ TLSData *GetDisplayTLS()
 
 constexpr angle::SubjectIndex kGPUSwitchedSubjectIndex = 0;
 
+// Environment variables that enable and size the on-disk blob cache.
+constexpr char kBlobCachePathEnv[]             = "ANGLE_BLOB_CACHE_PATH";
+constexpr char kBlobCacheMaxSizeEnv[]          = "ANGLE_BLOB_CACHE_MAX_SIZE";
+constexpr size_t kDefaultMaxBlobCacheDiskBytes = 64 * 1024 * 1024;
+
 static constexpr size_t kWindowSurfaceMapSize = 32;
 typedef angle::FlatUnorderedMap<EGLNativeWindowType, Surface *, kWindowSurfaceMapSize>
     WindowSurfaceMap;
@@ -1038,6 +1044,26 @@ Error Display::initialize()
         mBlobCache.resize(1024 * 1024);
     }
 
+    // Persist the internal blob cache to disk if requested, so that compiled shaders and pipelines
+    // survive process restarts even if the application doesn't set blob cache callbacks.
+    if (!mBlobCache.isDiskStoreOpen())
+    {
+        std::string blobCachePath = angle::GetEnvironmentVar(kBlobCachePathEnv);
+        if (!blobCachePath.empty())
+        {
+            size_t maxSize = static_cast<size_t>(
+                strtoull(angle::GetEnvironmentVar(kBlobCacheMaxSizeEnv).c_str(), nullptr, 10));
+            if (maxSize == 0)
+            {
+                maxSize = kDefaultMaxBlobCacheDiskBytes;
+            }
+            if (!mBlobCache.openDiskStore(blobCachePath, maxSize))
+            {
+                WARN() << "Failed to open blob cache file " << blobCachePath;
+            }
+        }
+    }
+
     setGlobalDebugAnnotator();
 
     gl::InitializeDebugMutexIfNeeded();
@@ -1082,6 +1108,34 @@ Error Display::initialize()
         initializeFrontendFeatures();
     }
 
+    // The command stream executes the GL calls on a thread to which the native context of a GL
+    // backend is never current, so it is only supported by the Vulkan backend.
+    if (mFrontendFeatures.threadedCommandStream.enabled)
+    {
+#if defined(ANGLE_ENABLE_COMMAND_STREAM)
+        const bool isSupported = mAttributeMap.get(EGL_PLATFORM_ANGLE_TYPE_ANGLE,
+                                                   EGL_PLATFORM_ANGLE_TYPE_DEFAULT_ANGLE) ==
+                                 EGL_PLATFORM_ANGLE_TYPE_VULKAN_ANGLE;
+#else
+        const bool isSupported = false;
+#endif  // defined(ANGLE_ENABLE_COMMAND_STREAM)
+        if (!isSupported)
+        {
+            WARN() << "threadedCommandStream requires the Vulkan backend and a build with "
+                      "angle_enable_command_stream; disabling it.";
+            mFrontendFeatures.threadedCommandStream.enabled = false;
+        }
+    }
+
+    mBlobCache.setCompressionCodec(mFrontendFeatures.useFastBlobCompression.enabled
+                                       ? angle::BlobCompressionCodec::LZ4
+                                       : angle::BlobCompressionCodec::Gzip);
+
+    if (mFrontendFeatures.exportPerformanceCounters.enabled)
+    {
+        gl::PerfCounterExport::Enable();
+    }
+
     mFeatures.clear();
     mFrontendFeatures.populateFeatureList(&mFeatures);
     mImplementation->populateFeatureList(&mFeatures);
@@ -1185,6 +1239,12 @@ Error Display::terminate(Thread *thread, TerminateReason terminateReason)
         return NoError();
     }
 
+    // Make sure the stats of the frames since the last interval aren't lost.
+    if (gl::PerfCounterExport *perfCounterExport = gl::PerfCounterExport::Get())
+    {
+        perfCounterExport->flush();
+    }
+
     // EGL 1.5 Specification
     // 3.2 Initialization
     // Termination marks all EGL-specific resources, such as contexts and surfaces, associated
@@ -1278,6 +1338,7 @@ Error Display::terminate(Thread *thread, TerminateReason terminateReason)
 
     mImplementation->terminate();
 
+    mBlobCache.closeDiskStore();
     mMemoryProgramCache.clear();
     mMemoryShaderCache.clear();
     mBlobCache.setBlobCacheFuncs(nullptr, nullptr);
@@ -15,17 +15,76 @@
 namespace gl
 {
 
-IndexRangeCache::IndexRangeCache() {}
+IndexRangeCache::IndexRangeCache() : mEntryCount(0) {}
 
 IndexRangeCache::~IndexRangeCache() {}
 
+// static
+size_t IndexRangeCache::GetHomeSlot(DrawElementsType type,
+                                    size_t offset,
+                                    size_t count,
+                                    bool primitiveRestartEnabled)
+{
+    // Draws usually use aligned offsets, so mix the bits before picking a slot.
+    uint64_t hash = static_cast<uint64_t>(offset) * 0x9E3779B97F4A7C15ull;
+    hash ^= static_cast<uint64_t>(count) * 0xC2B2AE3D27D4EB4Full;
+    hash ^= (static_cast<uint64_t>(type) << 1 | (primitiveRestartEnabled ? 1 : 0));
+    hash ^= hash >> 29;
+    return static_cast<size_t>(hash % kCapacity);
+}
+
 void IndexRangeCache::addRange(DrawElementsType type,
                                size_t offset,
                                size_t count,
                                bool primitiveRestartEnabled,
                                const IndexRange &range)
 {
-    mIndexRangeCache[IndexRangeKey(type, offset, count, primitiveRestartEnabled)] = range;
+    ASSERT(type != DrawElementsType::InvalidEnum);
+
+    if (!mEntries)
+    {
+        mEntries = std::make_unique<Entries>();
+        for (Entry &entry : *mEntries)
+        {
+            entry.type = DrawElementsType::InvalidEnum;
+        }
+    }
+
+    const size_t homeSlot = GetHomeSlot(type, offset, count, primitiveRestartEnabled);
+
+    // Reuse the slot of the same key, or else the first free one.  When every slot the key can
+    // probe is taken, the entry in the home slot is replaced.
+    Entry *target = nullptr;
+    for (size_t probe = 0; probe < kMaxProbes; ++probe)
+    {
+        Entry &entry = (*mEntries)[(homeSlot + probe) % kCapacity];
+        if (entry.type == DrawElementsType::InvalidEnum)
+        {
+            if (target == nullptr)
+            {
+                target = &entry;
+            }
+        }
+        else if (entry.type == type && entry.offset == offset && entry.count == count &&
+                 entry.primitiveRestartEnabled == primitiveRestartEnabled)
+        {
+            entry.range = range;
+            return;
+        }
+    }
+
+    if (target == nullptr)
+    {
+        target = &(*mEntries)[homeSlot];
+        --mEntryCount;
+    }
+
+    target->offset                  = offset;
+    target->count                   = count;
+    target->type                    = type;
+    target->primitiveRestartEnabled = primitiveRestartEnabled;
+    target->range                   = range;
+    ++mEntryCount;
 }
 
 bool IndexRangeCache::findRange(DrawElementsType type,
@@ -34,83 +93,70 @@ bool IndexRangeCache::findRange(DrawElementsType type,
                                 bool primitiveRestartEnabled,
                                 IndexRange *outRange) const
 {
-    auto i = mIndexRangeCache.find(IndexRangeKey(type, offset, count, primitiveRestartEnabled));
-    if (i != mIndexRangeCache.end())
+    if (mEntryCount > 0)
     {
-        if (outRange)
+        const size_t homeSlot = GetHomeSlot(type, offset, count, primitiveRestartEnabled);
+        for (size_t probe = 0; probe < kMaxProbes; ++probe)
         {
-            *outRange = i->second;
+            const Entry &entry = (*mEntries)[(homeSlot + probe) % kCapacity];
+            if (entry.type == type && entry.offset == offset && entry.count == count &&
+                entry.primitiveRestartEnabled == primitiveRestartEnabled)
+            {
+                if (outRange)
+                {
+                    *outRange = entry.range;
+                }
+                return true;
+            }
         }
-        return true;
     }
-    else
+
+    if (outRange)
     {
-        if (outRange)
-        {
-            *outRange = IndexRange();
-        }
-        return false;
+        *outRange = IndexRange();
     }
+    return false;
 }
 
 void IndexRangeCache::invalidateRange(size_t offset, size_t size)
 {
-    size_t invalidateStart = offset;
-    size_t invalidateEnd   = offset + size;
-
-    auto i = mIndexRangeCache.begin();
-    while (i != mIndexRangeCache.end())
+    if (mEntryCount == 0 || size == 0)
     {
-        size_t rangeStart = i->first.offset;
-        size_t rangeEnd =
-            i->first.offset + (GetDrawElementsTypeSize(i->first.type) * i->first.count);
+        return;
+    }
+
+    const size_t invalidateStart = offset;
+    const size_t invalidateEnd   = offset + size;
 
-        if (invalidateEnd < rangeStart || invalidateStart > rangeEnd)
+    for (Entry &entry : *mEntries)
+    {
+        if (entry.type == DrawElementsType::InvalidEnum)
         {
-            ++i;
+            continue;
         }
-        else
+
+        const size_t rangeStart = entry.offset;
+        const size_t rangeEnd   = entry.offset + GetDrawElementsTypeSize(entry.type) * entry.count;
+        if (invalidateStart < rangeEnd && rangeStart < invalidateEnd)
         {
-            mIndexRangeCache.erase(i++);
+            entry.type = DrawElementsType::InvalidEnum;
+            --mEntryCount;
         }
     }
 }
 
 void IndexRangeCache::clear()
 {
-    mIndexRangeCache.clear();
-}
-
-IndexRangeCache::IndexRangeKey::IndexRangeKey()
-    : IndexRangeCache::IndexRangeKey(DrawElementsType::InvalidEnum, 0, 0, false)
-{}
-
-IndexRangeCache::IndexRangeKey::IndexRangeKey(DrawElementsType type_,
-                                              size_t offset_,
-                                              size_t count_,
-                                              bool primitiveRestartEnabled_)
-    : type(type_), offset(offset_), count(count_), primitiveRestartEnabled(primitiveRestartEnabled_)
-{}
-
-bool IndexRangeCache::IndexRangeKey::operator<(const IndexRangeKey &rhs) const
-{
-    if (type != rhs.type)
-    {
-        return type < rhs.type;
-    }
-    if (offset != rhs.offset)
-    {
-        return offset < rhs.offset;
-    }
-    if (count != rhs.count)
+    if (mEntryCount == 0)
     {
-        return count < rhs.count;
+        return;
     }
-    if (primitiveRestartEnabled != rhs.primitiveRestartEnabled)
+
+    for (Entry &entry : *mEntries)
     {
-        return primitiveRestartEnabled;
+        entry.type = DrawElementsType::InvalidEnum;
     }
-    return false;
+    mEntryCount = 0;
 }
 
 }  // namespace gl
@@ -5,7 +5,8 @@
 //
 
 // IndexRangeCache.h: Defines the gl::IndexRangeCache class which stores information about
-// ranges of indices.
+// ranges of indices.  The cache is a small fixed-size hash table that is only allocated once a
+// buffer is used for indexed draws.  Old entries are evicted when a slot's neighbourhood is full.
 
 #ifndef LIBANGLE_INDEXRANGECACHE_H_
 #define LIBANGLE_INDEXRANGECACHE_H_
@@ -15,7 +16,8 @@
 #include "common/angleutils.h"
 #include "common/mathutil.h"
 
-#include <map>
+#include <array>
+#include <memory>
 
 namespace gl
 {
@@ -41,21 +43,27 @@ class IndexRangeCache
     void clear();
 
   private:
-    struct IndexRangeKey
-    {
-        IndexRangeKey();
-        IndexRangeKey(DrawElementsType type, size_t offset, size_t count, bool primitiveRestart);
-
-        bool operator<(const IndexRangeKey &rhs) const;
+    static constexpr size_t kCapacity  = 16;
+    static constexpr size_t kMaxProbes = 4;
 
-        DrawElementsType type;
+    struct Entry
+    {
         size_t offset;
         size_t count;
+        DrawElementsType type;
         bool primitiveRestartEnabled;
+        IndexRange range;
     };
 
-    typedef std::map<IndexRangeKey, IndexRange> IndexRangeMap;
-    IndexRangeMap mIndexRangeCache;
+    static size_t GetHomeSlot(DrawElementsType type,
+                              size_t offset,
+                              size_t count,
+                              bool primitiveRestartEnabled);
+
+    // Entries with type InvalidEnum are empty.
+    using Entries = std::array<Entry, kCapacity>;
+    std::unique_ptr<Entries> mEntries;
+    size_t mEntryCount;
 };
 
 }  // namespace gl
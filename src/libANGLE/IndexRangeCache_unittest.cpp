@@ -0,0 +1,112 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// IndexRangeCache_unittest.cpp: Unit tests for the index range cache of buffers.
+
+#include <gtest/gtest.h>
+
+#include "libANGLE/IndexRangeCache.h"
+
+namespace gl
+{
+namespace
+{
+bool HasRange(const IndexRangeCache &cache,
+              DrawElementsType type,
+              size_t offset,
+              size_t count,
+              size_t expectedEnd)
+{
+    IndexRange range;
+    return cache.findRange(type, offset, count, false, &range) && range.end == expectedEnd;
+}
+
+// Test that ranges are found by their full key.
+TEST(IndexRangeCacheTest, FindByKey)
+{
+    IndexRangeCache cache;
+    IndexRange range;
+    EXPECT_FALSE(cache.findRange(DrawElementsType::UnsignedShort, 0, 6, false, &range));
+
+    cache.addRange(DrawElementsType::UnsignedShort, 0, 6, false, IndexRange(0, 3, 6));
+    cache.addRange(DrawElementsType::UnsignedShort, 0, 6, true, IndexRange(0, 2, 5));
+
+    EXPECT_TRUE(cache.findRange(DrawElementsType::UnsignedShort, 0, 6, false, &range));
+    EXPECT_EQ(3u, range.end);
+    EXPECT_TRUE(cache.findRange(DrawElementsType::UnsignedShort, 0, 6, true, &range));
+    EXPECT_EQ(2u, range.end);
+    EXPECT_FALSE(cache.findRange(DrawElementsType::UnsignedInt, 0, 6, false, &range));
+    EXPECT_FALSE(cache.findRange(DrawElementsType::UnsignedShort, 2, 6, false, &range));
+    EXPECT_FALSE(cache.findRange(DrawElementsType::UnsignedShort, 0, 3, false, &range));
+
+    // Adding the same key again replaces the range.
+    cache.addRange(DrawElementsType::UnsignedShort, 0, 6, false, IndexRange(0, 7, 6));
+    EXPECT_TRUE(HasRange(cache, DrawElementsType::UnsignedShort, 0, 6, 7));
+}
+
+// Test that invalidating bytes only drops the ranges that overlap them.
+TEST(IndexRangeCacheTest, PartialInvalidation)
+{
+    IndexRangeCache cache;
+
+    // Four ranges of 8 shorts, covering bytes [0, 16), [16, 32), [32, 48) and [48, 64).
+    for (size_t i = 0; i < 4; ++i)
+    {
+        cache.addRange(DrawElementsType::UnsignedShort, i * 16, 8, false, IndexRange(0, i, 8));
+    }
+
+    // Ranges that only touch the invalidated bytes are kept.
+    cache.invalidateRange(16, 16);
+    EXPECT_TRUE(HasRange(cache, DrawElementsType::UnsignedShort, 0, 8, 0));
+    EXPECT_FALSE(HasRange(cache, DrawElementsType::UnsignedShort, 16, 8, 1));
+    EXPECT_TRUE(HasRange(cache, DrawElementsType::UnsignedShort, 32, 8, 2));
+    EXPECT_TRUE(HasRange(cache, DrawElementsType::UnsignedShort, 48, 8, 3));
+
+    cache.invalidateRange(47, 2);
+    EXPECT_TRUE(HasRange(cache, DrawElementsType::UnsignedShort, 0, 8, 0));
+    EXPECT_FALSE(HasRange(cache, DrawElementsType::UnsignedShort, 32, 8, 2));
+    EXPECT_FALSE(HasRange(cache, DrawElementsType::UnsignedShort, 48, 8, 3));
+
+    // Empty updates don't invalidate anything.
+    cache.invalidateRange(0, 0);
+    EXPECT_TRUE(HasRange(cache, DrawElementsType::UnsignedShort, 0, 8, 0));
+
+    cache.clear();
+    EXPECT_FALSE(HasRange(cache, DrawElementsType::UnsignedShort, 0, 8, 0));
+}
+
+// Test that the cache keeps working once it holds more ranges than it has room for.
+TEST(IndexRangeCacheTest, Eviction)
+{
+    IndexRangeCache cache;
+
+    constexpr size_t kRangeCount = 100;
+    for (size_t i = 0; i < kRangeCount; ++i)
+    {
+        cache.addRange(DrawElementsType::UnsignedInt, i * 4, 1, false, IndexRange(i, i, 1));
+        EXPECT_TRUE(HasRange(cache, DrawElementsType::UnsignedInt, i * 4, 1, i));
+    }
+
+    // Whatever survived eviction must still hold the right range.
+    size_t found = 0;
+    for (size_t i = 0; i < kRangeCount; ++i)
+    {
+        IndexRange range;
+        if (cache.findRange(DrawElementsType::UnsignedInt, i * 4, 1, false, &range))
+        {
+            EXPECT_EQ(i, range.start);
+            ++found;
+        }
+    }
+    EXPECT_GT(found, 0u);
+
+    cache.invalidateRange(0, kRangeCount * 4);
+    for (size_t i = 0; i < kRangeCount; ++i)
+    {
+        EXPECT_FALSE(HasRange(cache, DrawElementsType::UnsignedInt, i * 4, 1, i));
+    }
+}
+}  // anonymous namespace
+}  // namespace gl
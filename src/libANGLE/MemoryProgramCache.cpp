@@ -186,7 +186,8 @@ angle::Result MemoryProgramCache::putProgram(const egl::BlobCache::Key &programH
     const angle::MemoryBuffer &serializedProgram = program->getSerializedBinary();
 
     angle::MemoryBuffer compressedData;
-    if (!angle::CompressBlob(serializedProgram.size(), serializedProgram.data(), &compressedData))
+    if (!angle::CompressBlob(mBlobCache.getCompressionCodec(), serializedProgram.size(),
+                             serializedProgram.data(), &compressedData))
     {
         ANGLE_PERF_WARNING(context->getState().getDebug(), GL_DEBUG_SEVERITY_LOW,
                            "Error compressing binary data.");
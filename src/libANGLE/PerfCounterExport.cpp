@@ -0,0 +1,310 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// PerfCounterExport.cpp:
+//   Periodically writes the entry point stats and the performance counters of the contexts to a
+//   JSON file, for collection by tools that don't render the overlay.
+//
+
+#include "libANGLE/PerfCounterExport.h"
+
+#include <atomic>
+#include <fstream>
+#include <sstream>
+
+#include "common/entry_point_stats.h"
+#include "common/system_utils.h"
+#include "libANGLE/Context.h"
+
+namespace gl
+{
+namespace
+{
+constexpr char kPerfCountersFileVarName[]       = "ANGLE_PERF_COUNTERS_FILE";
+constexpr char kAndroidPerfCountersFile[]       = "debug.angle.perf_counters_file";
+constexpr char kPerfCountersIntervalVarName[]   = "ANGLE_PERF_COUNTERS_INTERVAL_MS";
+constexpr char kAndroidPerfCountersInterval[]   = "debug.angle.perf_counters_interval_ms";
+constexpr char kDefaultPerfCountersFile[]       = "angle_perf_counters.json";
+constexpr uint32_t kDefaultPerfCountersInterval = 1000;
+
+constexpr char kCacheHitsSuffix[]   = "CacheHits";
+constexpr char kCacheMissesSuffix[] = "CacheMisses";
+
+// The export lives until the process exits.
+std::mutex gExportMutex;
+std::atomic<PerfCounterExport *> gExport(nullptr);
+std::atomic<bool> gEnvironmentChecked(false);
+
+std::string GetPerfCountersFile()
+{
+    return angle::GetEnvironmentVarOrAndroidProperty(kPerfCountersFileVarName,
+                                                     kAndroidPerfCountersFile);
+}
+
+std::chrono::milliseconds GetPerfCountersInterval()
+{
+    const std::string interval = angle::GetEnvironmentVarOrAndroidProperty(
+        kPerfCountersIntervalVarName, kAndroidPerfCountersInterval);
+    uint32_t intervalMs        = kDefaultPerfCountersInterval;
+    if (!interval.empty())
+    {
+        intervalMs = static_cast<uint32_t>(strtoul(interval.c_str(), nullptr, 10));
+    }
+    return std::chrono::milliseconds(intervalMs);
+}
+
+bool EndsWith(const std::string &str, const char *suffix, size_t suffixLength)
+{
+    return str.size() > suffixLength &&
+           str.compare(str.size() - suffixLength, suffixLength, suffix) == 0;
+}
+
+void WriteCounterGroups(const angle::PerfMonitorCounterGroups &groups, std::ostream &out)
+{
+    out << "\"counters\": {";
+    for (size_t groupIndex = 0; groupIndex < groups.size(); ++groupIndex)
+    {
+        const angle::PerfMonitorCounterGroup &group = groups[groupIndex];
+        out << (groupIndex > 0 ? ", " : "") << "\"" << group.name << "\": {";
+        for (size_t counterIndex = 0; counterIndex < group.counters.size(); ++counterIndex)
+        {
+            const angle::PerfMonitorCounter &counter = group.counters[counterIndex];
+            out << (counterIndex > 0 ? ", " : "") << "\"" << counter.name
+                << "\": " << counter.value;
+        }
+        out << "}";
+    }
+    out << "}";
+
+    // Pair every <cache>CacheHits counter with the matching <cache>CacheMisses counter.
+    out << ", \"cacheHitRates\": {";
+    bool first = true;
+    for (const angle::PerfMonitorCounterGroup &group : groups)
+    {
+        for (const angle::PerfMonitorCounter &hits : group.counters)
+        {
+            const size_t suffixLength = sizeof(kCacheHitsSuffix) - 1;
+            if (!EndsWith(hits.name, kCacheHitsSuffix, suffixLength))
+            {
+                continue;
+            }
+
+            const std::string cacheName  = hits.name.substr(0, hits.name.size() - suffixLength);
+            const std::string missesName = cacheName + kCacheMissesSuffix;
+            for (const angle::PerfMonitorCounter &misses : group.counters)
+            {
+                if (misses.name != missesName || hits.value + misses.value == 0)
+                {
+                    continue;
+                }
+                out << (first ? "" : ", ") << "\"" << cacheName << "Cache\": "
+                    << static_cast<double>(hits.value) /
+                           static_cast<double>(hits.value + misses.value);
+                first = false;
+            }
+        }
+    }
+    out << "}";
+}
+}  // anonymous namespace
+
+// static
+PerfCounterExport *PerfCounterExport::Get()
+{
+    if (ANGLE_UNLIKELY(!gEnvironmentChecked.load(std::memory_order_acquire)))
+    {
+        std::lock_guard<std::mutex> lock(gExportMutex);
+        if (!gEnvironmentChecked.load(std::memory_order_relaxed))
+        {
+            const std::string path = GetPerfCountersFile();
+            if (!path.empty())
+            {
+                angle::EnableEntryPointStats();
+                gExport.store(new PerfCounterExport(path, GetPerfCountersInterval()));
+            }
+            gEnvironmentChecked.store(true, std::memory_order_release);
+        }
+    }
+    return gExport.load(std::memory_order_acquire);
+}
+
+// static
+void PerfCounterExport::Enable()
+{
+    if (Get() != nullptr)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(gExportMutex);
+    if (gExport.load(std::memory_order_relaxed) == nullptr)
+    {
+        angle::EnableEntryPointStats();
+        gExport.store(new PerfCounterExport(kDefaultPerfCountersFile, GetPerfCountersInterval()));
+    }
+}
+
+PerfCounterExport::PerfCounterExport(const std::string &path, std::chrono::milliseconds interval)
+    : mPath(path),
+      mInterval(interval),
+      mStartTime(std::chrono::steady_clock::now()),
+      mLastWriteTime(mStartTime),
+      mFrameCount(0),
+      mWritePending(false),
+      mExitThread(false)
+{
+    INFO() << "Writing performance counters to " << mPath << " every " << mInterval.count()
+           << "ms";
+    mThread = std::thread(&PerfCounterExport::threadMain, this);
+}
+
+PerfCounterExport::~PerfCounterExport()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mExitThread = true;
+    }
+    mWriteCondition.notify_one();
+    mThread.join();
+}
+
+void PerfCounterExport::onFrameEnd(Context *context)
+{
+    const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    ++mFrameCount;
+
+    // Sampling the counters isn't free, so it's only done as often as the file is written.
+    auto iter = mContextCounters.find(context->id().value);
+    if (iter == mContextCounters.end() || now - iter->second.snapshotTime >= mInterval)
+    {
+        snapshotContext(context, &mContextCounters[context->id().value]);
+    }
+
+    if (now - mLastWriteTime >= mInterval)
+    {
+        mLastWriteTime = now;
+        mWritePending  = true;
+        mWriteCondition.notify_one();
+    }
+}
+
+void PerfCounterExport::flush()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mLastWriteTime = std::chrono::steady_clock::now();
+        mWritePending  = false;
+    }
+    writeFile();
+}
+
+void PerfCounterExport::threadMain()
+{
+    angle::SetCurrentThreadName("ANGLE-PerfCnt");
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mWriteCondition.wait(lock, [this]() { return mWritePending || mExitThread; });
+            if (mExitThread)
+            {
+                break;
+            }
+            mWritePending = false;
+        }
+        writeFile();
+    }
+}
+
+void PerfCounterExport::snapshotContext(Context *context, ContextCounters *countersOut)
+{
+    std::ostringstream out;
+    out << "{\"id\": " << context->id().value << ", ";
+    WriteCounterGroups(context->getPerfMonitorCounterGroups(), out);
+    out << "}";
+
+    countersOut->snapshotTime = std::chrono::steady_clock::now();
+    countersOut->json         = out.str();
+}
+
+std::string PerfCounterExport::getJSON(std::chrono::steady_clock::time_point now) const
+{
+    const std::chrono::milliseconds time =
+        std::chrono::duration_cast<std::chrono::milliseconds>(now - mStartTime);
+
+    std::ostringstream out;
+    out << "{\n";
+    out << "  \"version\": 1,\n";
+    out << "  \"timeMs\": " << time.count() << ",\n";
+    out << "  \"frames\": " << mFrameCount << ",\n";
+
+    out << "  \"entryPoints\": [";
+    const std::vector<angle::EntryPointStats> stats = angle::GetEntryPointStats();
+    for (size_t index = 0; index < stats.size(); ++index)
+    {
+        const angle::EntryPointStats &entry = stats[index];
+        out << (index > 0 ? ",\n" : "\n") << "    {\"name\": \""
+            << angle::GetEntryPointName(entry.entryPoint) << "\", \"calls\": " << entry.callCount
+            << ", \"totalNs\": " << entry.totalNs << ", \"maxNs\": " << entry.maxNs
+            << ", \"latencyHistogramNs\": [";
+
+        bool firstBucket = true;
+        for (size_t bucket = 0; bucket < angle::kEntryPointLatencyBucketCount; ++bucket)
+        {
+            if (entry.latencyHistogram[bucket] == 0)
+            {
+                continue;
+            }
+            out << (firstBucket ? "" : ", ") << "[" << (uint64_t(1) << bucket) << ", "
+                << entry.latencyHistogram[bucket] << "]";
+            firstBucket = false;
+        }
+        out << "]}";
+    }
+    out << "\n  ],\n";
+
+    out << "  \"contexts\": [";
+    bool firstContext = true;
+    for (const auto &idAndCounters : mContextCounters)
+    {
+        out << (firstContext ? "\n" : ",\n") << "    " << idAndCounters.second.json;
+        firstContext = false;
+    }
+    out << "\n  ]\n";
+    out << "}\n";
+    return out.str();
+}
+
+void PerfCounterExport::writeFile()
+{
+    // The stats are taken with the file locked, so a file is never replaced by older stats.
+    std::lock_guard<std::mutex> fileLock(mFileMutex);
+    std::string json;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        json = getJSON(std::chrono::steady_clock::now());
+    }
+
+    // Write to a temporary file first so readers never see a partial file.
+    const std::string tempPath = mPath + ".tmp";
+    {
+        std::ofstream out(tempPath, std::ios::out | std::ios::trunc);
+        if (!out)
+        {
+            WARN() << "Failed to write performance counters to " << tempPath;
+            return;
+        }
+        out << json;
+    }
+
+    if (!angle::RenameFileReplacingExisting(tempPath, mPath))
+    {
+        WARN() << "Failed to write performance counters to " << mPath;
+    }
+}
+}  // namespace gl
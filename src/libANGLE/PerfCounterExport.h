@@ -0,0 +1,100 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// PerfCounterExport.h:
+//   Periodically writes the entry point stats and the performance counters of the contexts to a
+//   JSON file, for collection by tools that don't render the overlay.
+//
+
+#ifndef LIBANGLE_PERFCOUNTEREXPORT_H_
+#define LIBANGLE_PERFCOUNTEREXPORT_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+
+#include "common/angleutils.h"
+
+namespace gl
+{
+class Context;
+
+// The file is rewritten as a whole at the end of the first frame after each interval, so readers
+// always find the totals since the export was enabled.  The format is:
+//
+//   {
+//     "version": 1,
+//     "timeMs": <time since the export was enabled>,
+//     "frames": <frames swapped by all contexts>,
+//     "entryPoints": [
+//       {"name": "glDrawArrays", "calls": 10, "totalNs": 5120, "maxNs": 980,
+//        "latencyHistogramNs": [[<exclusive upper bound>, <calls>], ...]},
+//       ...
+//     ],
+//     "contexts": [
+//       {"id": 1, "counters": {"vulkan": {"renderPasses": 3, ...}},
+//        "cacheHitRates": {"pipelineCreationCache": 0.98, ...}},
+//       ...
+//     ]
+//   }
+//
+// The counters of a context are the ones returned by GL_AMD_performance_monitor.  They are
+// sampled when the context swaps, at most once per interval.  The file is written by a dedicated
+// thread, so the swap never waits for the file system.
+class PerfCounterExport : angle::NonCopyable
+{
+  public:
+    // Returns the export if it was enabled through the environment or by a display, or null.
+    static PerfCounterExport *Get();
+    // Enables the export for a display that has the exportPerformanceCounters feature enabled.
+    static void Enable();
+
+    void onFrameEnd(Context *context);
+    // Writes the file on the calling thread, regardless of the interval.
+    void flush();
+
+  private:
+    PerfCounterExport(const std::string &path, std::chrono::milliseconds interval);
+    ~PerfCounterExport();
+
+    struct ContextCounters
+    {
+        std::chrono::steady_clock::time_point snapshotTime;
+        std::string json;
+    };
+
+    void snapshotContext(Context *context, ContextCounters *countersOut);
+    // Must be called with mMutex locked.
+    std::string getJSON(std::chrono::steady_clock::time_point now) const;
+    void writeFile();
+
+    void threadMain();
+
+    const std::string mPath;
+    const std::chrono::milliseconds mInterval;
+    const std::chrono::steady_clock::time_point mStartTime;
+
+    std::mutex mMutex;
+    std::chrono::steady_clock::time_point mLastWriteTime;
+    uint64_t mFrameCount;
+    // The counters of each context, by context ID.  Kept after the context is destroyed.
+    std::map<uint32_t, ContextCounters> mContextCounters;
+
+    // Set when the interval has passed, for the thread to write the file.
+    bool mWritePending;
+    bool mExitThread;
+    std::condition_variable mWriteCondition;
+    std::thread mThread;
+
+    // Serializes the writes of the thread and of flush().  Taken before mMutex.
+    std::mutex mFileMutex;
+};
+}  // namespace gl
+
+#endif  // LIBANGLE_PERFCOUNTEREXPORT_H_
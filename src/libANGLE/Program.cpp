@@ -100,11 +100,18 @@ void ScheduleSubTasks(const std::shared_ptr<angle::WorkerThreadPool> &workerThre
                       std::vector<std::shared_ptr<rx::LinkSubTask>> &tasks,
                       std::vector<std::shared_ptr<angle::WaitableEvent>> *eventsOut)
 {
-    eventsOut->reserve(tasks.size());
+    if (tasks.empty())
+    {
+        return;
+    }
+
+    // The subtasks are only ever waited on together, so a single event is tracked for all of them.
+    auto group = std::make_shared<angle::WorkerTaskGroup>();
     for (const std::shared_ptr<rx::LinkSubTask> &subTask : tasks)
     {
-        eventsOut->push_back(workerThreadPool->postWorkerTask(subTask));
+        group->post(workerThreadPool.get(), subTask, angle::WorkerTaskPriority::High);
     }
+    eventsOut->push_back(std::move(group));
 }
 }  // anonymous namespace
 
@@ -255,26 +255,19 @@ void LoadProgramInputs(BinaryInputStream *stream, std::vector<ProgramInput> *pro
 void SaveUniforms(BinaryOutputStream *stream,
                   const std::vector<LinkedUniform> &uniforms,
                   const std::vector<std::string> &uniformNames,
-                  const std::vector<std::string> &uniformMappedNames,
                   const std::vector<VariableLocation> &uniformLocations)
 {
     stream->writeVector(uniforms);
     ASSERT(uniforms.size() == uniformNames.size());
-    ASSERT(uniforms.size() == uniformMappedNames.size());
     for (const std::string &name : uniformNames)
     {
         stream->writeString(name);
     }
-    for (const std::string &name : uniformMappedNames)
-    {
-        stream->writeString(name);
-    }
     stream->writeVector(uniformLocations);
 }
 void LoadUniforms(BinaryInputStream *stream,
                   std::vector<LinkedUniform> *uniforms,
                   std::vector<std::string> *uniformNames,
-                  std::vector<std::string> *uniformMappedNames,
                   std::vector<VariableLocation> *uniformLocations)
 {
     stream->readVector(uniforms);
@@ -285,11 +278,6 @@ void LoadUniforms(BinaryInputStream *stream,
         {
             stream->readString(&(*uniformNames)[uniformIndex]);
         }
-        uniformMappedNames->resize(uniforms->size());
-        for (size_t uniformIndex = 0; uniformIndex < uniforms->size(); ++uniformIndex)
-        {
-            stream->readString(&(*uniformMappedNames)[uniformIndex]);
-        }
     }
     stream->readVector(uniformLocations);
 }
@@ -843,6 +831,8 @@ void ProgramExecutable::reset()
     mShaderStorageBlocks.clear();
     mAtomicCounterBuffers.clear();
     mBufferVariables.clear();
+    mHasDeferredReflection.store(false, std::memory_order_relaxed);
+    mDeferredReflectionData.clear();
     mOutputVariables.clear();
     mOutputLocations.clear();
     mSecondaryOutputLocations.clear();
@@ -866,8 +856,7 @@ void ProgramExecutable::load(gl::BinaryInputStream *stream)
 
     stream->readStruct(&mPod);
 
-    LoadProgramInputs(stream, &mProgramInputs);
-    LoadUniforms(stream, &mUniforms, &mUniformNames, &mUniformMappedNames, &mUniformLocations);
+    LoadUniforms(stream, &mUniforms, &mUniformNames, &mUniformLocations);
 
     size_t uniformBlockCount = stream->readInt<size_t>();
     ASSERT(getUniformBlocks().empty());
@@ -897,14 +886,6 @@ void ProgramExecutable::load(gl::BinaryInputStream *stream)
         LoadAtomicCounterBuffer(stream, &atomicCounterBuffer);
     }
 
-    size_t bufferVariableCount = stream->readInt<size_t>();
-    ASSERT(getBufferVariables().empty());
-    mBufferVariables.resize(bufferVariableCount);
-    for (size_t bufferVarIndex = 0; bufferVarIndex < bufferVariableCount; ++bufferVarIndex)
-    {
-        LoadBufferVariable(stream, &mBufferVariables[bufferVarIndex]);
-    }
-
     size_t transformFeedbackVaryingCount = stream->readInt<size_t>();
     ASSERT(mLinkedTransformFeedbackVaryings.empty());
     mLinkedTransformFeedbackVaryings.resize(transformFeedbackVaryingCount);
@@ -956,34 +937,11 @@ void ProgramExecutable::load(gl::BinaryInputStream *stream)
     mPixelLocalStorageFormats.resize(plsCount);
     stream->readBytes(reinterpret_cast<uint8_t *>(mPixelLocalStorageFormats.data()), plsCount);
 
-    // These values are currently only used by PPOs, so only load them when the program is marked
-    // separable to save memory.
-    if (mPod.isSeparable)
-    {
-        for (ShaderType shaderType : getLinkedShaderStages())
-        {
-            mLinkedOutputVaryings[shaderType].resize(stream->readInt<size_t>());
-            for (sh::ShaderVariable &variable : mLinkedOutputVaryings[shaderType])
-            {
-                LoadShaderVar(stream, &variable);
-            }
-            mLinkedInputVaryings[shaderType].resize(stream->readInt<size_t>());
-            for (sh::ShaderVariable &variable : mLinkedInputVaryings[shaderType])
-            {
-                LoadShaderVar(stream, &variable);
-            }
-            mLinkedUniforms[shaderType].resize(stream->readInt<size_t>());
-            for (sh::ShaderVariable &variable : mLinkedUniforms[shaderType])
-            {
-                LoadShaderVar(stream, &variable);
-            }
-            mLinkedUniformBlocks[shaderType].resize(stream->readInt<size_t>());
-            for (sh::InterfaceBlock &shaderStorageBlock : mLinkedUniformBlocks[shaderType])
-            {
-                LoadShInterfaceBlock(stream, &shaderStorageBlock);
-            }
-        }
-    }
+    // The rarely used reflection data is only deserialized on first use.
+    ASSERT(!mHasDeferredReflection.load(std::memory_order_relaxed));
+    ASSERT(mDeferredReflectionData.empty());
+    stream->readVector(&mDeferredReflectionData);
+    mHasDeferredReflection.store(!mDeferredReflectionData.empty(), std::memory_order_release);
 }
 
 void ProgramExecutable::save(gl::BinaryOutputStream *stream) const
@@ -997,8 +955,7 @@ void ProgramExecutable::save(gl::BinaryOutputStream *stream) const
     ASSERT(mPod.geometryShaderInvocations >= 1 && mPod.geometryShaderMaxVertices >= 0);
     stream->writeStruct(mPod);
 
-    SaveProgramInputs(stream, mProgramInputs);
-    SaveUniforms(stream, mUniforms, mUniformNames, mUniformMappedNames, mUniformLocations);
+    SaveUniforms(stream, mUniforms, mUniformNames, mUniformLocations);
 
     stream->writeInt(getUniformBlocks().size());
     for (const InterfaceBlock &uniformBlock : getUniformBlocks())
@@ -1018,12 +975,6 @@ void ProgramExecutable::save(gl::BinaryOutputStream *stream) const
         WriteAtomicCounterBuffer(stream, atomicCounterBuffer);
     }
 
-    stream->writeInt(getBufferVariables().size());
-    for (const BufferVariable &bufferVariable : getBufferVariables())
-    {
-        WriteBufferVariable(stream, bufferVariable);
-    }
-
     stream->writeInt(getLinkedTransformFeedbackVaryings().size());
     for (const auto &var : getLinkedTransformFeedbackVaryings())
     {
@@ -1062,6 +1013,37 @@ void ProgramExecutable::save(gl::BinaryOutputStream *stream) const
     stream->writeBytes(reinterpret_cast<const uint8_t *>(mPixelLocalStorageFormats.data()),
                        mPixelLocalStorageFormats.size());
 
+    // The rarely used reflection data is written as a separate block, which load() keeps as is.  If
+    // it was never deserialized, it is written back unchanged.
+    std::lock_guard<std::mutex> lock(mDeferredReflectionMutex);
+    if (mHasDeferredReflection.load(std::memory_order_relaxed))
+    {
+        stream->writeVector(mDeferredReflectionData);
+    }
+    else
+    {
+        BinaryOutputStream reflectionStream;
+        saveDeferredReflection(&reflectionStream);
+        stream->writeVector(reflectionStream.getData());
+    }
+}
+
+void ProgramExecutable::saveDeferredReflection(BinaryOutputStream *stream) const
+{
+    SaveProgramInputs(stream, mProgramInputs);
+
+    ASSERT(mUniformMappedNames.size() == mUniforms.size());
+    for (const std::string &name : mUniformMappedNames)
+    {
+        stream->writeString(name);
+    }
+
+    stream->writeInt(mBufferVariables.size());
+    for (const BufferVariable &bufferVariable : mBufferVariables)
+    {
+        WriteBufferVariable(stream, bufferVariable);
+    }
+
     // These values are currently only used by PPOs, so only save them when the program is marked
     // separable to save memory.
     if (mPod.isSeparable)
@@ -1092,6 +1074,89 @@ void ProgramExecutable::save(gl::BinaryOutputStream *stream) const
     }
 }
 
+void ProgramExecutable::loadDeferredReflection() const
+{
+    std::lock_guard<std::mutex> lock(mDeferredReflectionMutex);
+    if (!mHasDeferredReflection.load(std::memory_order_relaxed))
+    {
+        // Another thread got here first.
+        return;
+    }
+
+    // The data is only loaded once, by the first query of an otherwise const executable.
+    ProgramExecutable *self = const_cast<ProgramExecutable *>(this);
+    BinaryInputStream stream(mDeferredReflectionData.data(), mDeferredReflectionData.size());
+    self->loadDeferredReflectionFromStream(&stream);
+    if (stream.error() || !stream.endOfStream())
+    {
+        // The binary was already accepted, so the best that can be done is to drop the data.
+        WARN() << "Failed to load the program binary reflection data";
+        self->mProgramInputs.clear();
+        self->mUniformMappedNames.assign(mUniforms.size(), std::string());
+        self->mBufferVariables.clear();
+        for (ShaderType shaderType : AllShaderTypes())
+        {
+            self->mLinkedOutputVaryings[shaderType].clear();
+            self->mLinkedInputVaryings[shaderType].clear();
+            self->mLinkedUniforms[shaderType].clear();
+            self->mLinkedUniformBlocks[shaderType].clear();
+        }
+    }
+
+    self->mDeferredReflectionData.clear();
+    self->mDeferredReflectionData.shrink_to_fit();
+    mHasDeferredReflection.store(false, std::memory_order_release);
+}
+
+void ProgramExecutable::loadDeferredReflectionFromStream(BinaryInputStream *stream)
+{
+    LoadProgramInputs(stream, &mProgramInputs);
+
+    ASSERT(mUniformMappedNames.empty());
+    mUniformMappedNames.resize(mUniforms.size());
+    for (std::string &name : mUniformMappedNames)
+    {
+        stream->readString(&name);
+    }
+
+    size_t bufferVariableCount = stream->readInt<size_t>();
+    ASSERT(mBufferVariables.empty());
+    mBufferVariables.resize(bufferVariableCount);
+    for (size_t bufferVarIndex = 0; bufferVarIndex < bufferVariableCount; ++bufferVarIndex)
+    {
+        LoadBufferVariable(stream, &mBufferVariables[bufferVarIndex]);
+    }
+
+    // These values are currently only used by PPOs, so only load them when the program is marked
+    // separable to save memory.
+    if (mPod.isSeparable)
+    {
+        for (ShaderType shaderType : getLinkedShaderStages())
+        {
+            mLinkedOutputVaryings[shaderType].resize(stream->readInt<size_t>());
+            for (sh::ShaderVariable &variable : mLinkedOutputVaryings[shaderType])
+            {
+                LoadShaderVar(stream, &variable);
+            }
+            mLinkedInputVaryings[shaderType].resize(stream->readInt<size_t>());
+            for (sh::ShaderVariable &variable : mLinkedInputVaryings[shaderType])
+            {
+                LoadShaderVar(stream, &variable);
+            }
+            mLinkedUniforms[shaderType].resize(stream->readInt<size_t>());
+            for (sh::ShaderVariable &variable : mLinkedUniforms[shaderType])
+            {
+                LoadShaderVar(stream, &variable);
+            }
+            mLinkedUniformBlocks[shaderType].resize(stream->readInt<size_t>());
+            for (sh::InterfaceBlock &shaderStorageBlock : mLinkedUniformBlocks[shaderType])
+            {
+                LoadShInterfaceBlock(stream, &shaderStorageBlock);
+            }
+        }
+    }
+}
+
 std::string ProgramExecutable::getInfoLogString() const
 {
     return mInfoLog->str();
@@ -2141,6 +2206,7 @@ void ProgramExecutable::getResourceName(const std::string name,
 
 GLuint ProgramExecutable::getInputResourceIndex(const GLchar *name) const
 {
+    ensureDeferredReflectionLoaded();
     const std::string nameString = StripLastArrayIndex(name);
 
     for (size_t index = 0; index < mProgramInputs.size(); index++)
@@ -2156,6 +2222,7 @@ GLuint ProgramExecutable::getInputResourceIndex(const GLchar *name) const
 
 GLuint ProgramExecutable::getInputResourceMaxNameSize() const
 {
+    ensureDeferredReflectionLoaded();
     GLint max = 0;
 
     for (const ProgramInput &resource : mProgramInputs)
@@ -2248,6 +2315,7 @@ void ProgramExecutable::getBufferVariableResourceName(GLuint index,
                                                       GLsizei *length,
                                                       GLchar *name) const
 {
+    ensureDeferredReflectionLoaded();
     ASSERT(index < mBufferVariables.size());
     getResourceName(mBufferVariables[index].name, bufSize, length, name);
 }
@@ -2358,6 +2426,7 @@ void ProgramExecutable::getActiveAttribute(GLuint index,
                                            GLenum *type,
                                            GLchar *name) const
 {
+    ensureDeferredReflectionLoaded();
     if (mProgramInputs.empty())
     {
         // Program is not successfully linked
@@ -2391,6 +2460,7 @@ void ProgramExecutable::getActiveAttribute(GLuint index,
 
 GLint ProgramExecutable::getActiveAttributeMaxLength() const
 {
+    ensureDeferredReflectionLoaded();
     size_t maxLength = 0;
 
     for (const ProgramInput &attrib : mProgramInputs)
@@ -2403,6 +2473,7 @@ GLint ProgramExecutable::getActiveAttributeMaxLength() const
 
 GLuint ProgramExecutable::getAttributeLocation(const std::string &name) const
 {
+    ensureDeferredReflectionLoaded();
     for (const ProgramInput &attribute : mProgramInputs)
     {
         if (attribute.name == name)
@@ -2516,6 +2587,7 @@ GLuint ProgramExecutable::getUniformIndexFromName(const std::string &name) const
 
 GLuint ProgramExecutable::getBufferVariableIndexFromName(const std::string &name) const
 {
+    ensureDeferredReflectionLoaded();
     return GetResourceIndexFromName(mBufferVariables, name);
 }
 
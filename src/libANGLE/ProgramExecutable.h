@@ -9,6 +9,9 @@
 #ifndef LIBANGLE_PROGRAMEXECUTABLE_H_
 #define LIBANGLE_PROGRAMEXECUTABLE_H_
 
+#include <atomic>
+#include <mutex>
+
 #include "common/BinaryStream.h"
 #include "libANGLE/Caps.h"
 #include "libANGLE/InfoLog.h"
@@ -351,7 +354,11 @@ class ProgramExecutable final : public angle::Subject
     void updateCanDrawWith() { mPod.canDrawWith = hasLinkedShaderStage(ShaderType::Vertex); }
     bool hasVertexShader() const { return mPod.canDrawWith; }
 
-    const std::vector<ProgramInput> &getProgramInputs() const { return mProgramInputs; }
+    const std::vector<ProgramInput> &getProgramInputs() const
+    {
+        ensureDeferredReflectionLoaded();
+        return mProgramInputs;
+    }
     const std::vector<ProgramOutput> &getOutputVariables() const { return mOutputVariables; }
     const std::vector<VariableLocation> &getOutputLocations() const { return mOutputLocations; }
     const std::vector<VariableLocation> &getSecondaryOutputLocations() const
@@ -360,7 +367,11 @@ class ProgramExecutable final : public angle::Subject
     }
     const std::vector<LinkedUniform> &getUniforms() const { return mUniforms; }
     const std::vector<std::string> &getUniformNames() const { return mUniformNames; }
-    const std::vector<std::string> &getUniformMappedNames() const { return mUniformMappedNames; }
+    const std::vector<std::string> &getUniformMappedNames() const
+    {
+        ensureDeferredReflectionLoaded();
+        return mUniformMappedNames;
+    }
     const std::vector<InterfaceBlock> &getUniformBlocks() const { return mUniformBlocks; }
     const std::vector<VariableLocation> &getUniformLocations() const { return mUniformLocations; }
     const std::vector<SamplerBinding> &getSamplerBindings() const { return mSamplerBindings; }
@@ -430,6 +441,7 @@ class ProgramExecutable final : public angle::Subject
     }
     const BufferVariable &getBufferVariableByIndex(size_t index) const
     {
+        ensureDeferredReflectionLoaded();
         ASSERT(index < mBufferVariables.size());
         return mBufferVariables[index];
     }
@@ -445,7 +457,11 @@ class ProgramExecutable final : public angle::Subject
     {
         return mShaderStorageBlocks;
     }
-    const std::vector<BufferVariable> &getBufferVariables() const { return mBufferVariables; }
+    const std::vector<BufferVariable> &getBufferVariables() const
+    {
+        ensureDeferredReflectionLoaded();
+        return mBufferVariables;
+    }
     const LinkedUniform &getUniformByIndex(size_t index) const
     {
         ASSERT(index < static_cast<size_t>(mUniforms.size()));
@@ -472,20 +488,24 @@ class ProgramExecutable final : public angle::Subject
     void saveLinkedStateInfo(const ProgramState &state);
     const std::vector<sh::ShaderVariable> &getLinkedOutputVaryings(ShaderType shaderType) const
     {
+        ensureDeferredReflectionLoaded();
         return mLinkedOutputVaryings[shaderType];
     }
     const std::vector<sh::ShaderVariable> &getLinkedInputVaryings(ShaderType shaderType) const
     {
+        ensureDeferredReflectionLoaded();
         return mLinkedInputVaryings[shaderType];
     }
 
     const std::vector<sh::ShaderVariable> &getLinkedUniforms(ShaderType shaderType) const
     {
+        ensureDeferredReflectionLoaded();
         return mLinkedUniforms[shaderType];
     }
 
     const std::vector<sh::InterfaceBlock> &getLinkedUniformBlocks(ShaderType shaderType) const
     {
+        ensureDeferredReflectionLoaded();
         return mLinkedUniformBlocks[shaderType];
     }
 
@@ -561,6 +581,7 @@ class ProgramExecutable final : public angle::Subject
                                        GLchar *name) const;
     const ProgramInput &getInputResource(size_t index) const
     {
+        ensureDeferredReflectionLoaded();
         ASSERT(index < mProgramInputs.size());
         return mProgramInputs[index];
     }
@@ -757,6 +778,26 @@ class ProgramExecutable final : public angle::Subject
 
     void reset();
 
+    // Some reflection data is rarely used after a program binary is loaded: the program inputs,
+    // which only glGetAttribLocation and the resource queries use once locations are assigned, the
+    // uniform mapped names, which only the GL and Metal backends use, the buffer variables, and the
+    // varyings and uniforms that are only needed to link program pipelines.  load() keeps them
+    // serialized, and they are deserialized on first use.
+    //
+    // The uniform names are kept eager for glGetUniformLocation, and the uniform and storage
+    // blocks, outputs and transform feedback varyings for the backends, which use them at draw
+    // time or to warm up the pipeline cache right after load.
+    void ensureDeferredReflectionLoaded() const
+    {
+        if (ANGLE_UNLIKELY(mHasDeferredReflection.load(std::memory_order_acquire)))
+        {
+            loadDeferredReflection();
+        }
+    }
+    void loadDeferredReflection() const;
+    void loadDeferredReflectionFromStream(gl::BinaryInputStream *stream);
+    void saveDeferredReflection(gl::BinaryOutputStream *stream) const;
+
     void updateActiveImages(const ProgramExecutable &executable);
 
     bool linkMergedVaryings(const Caps &caps,
@@ -1031,6 +1072,11 @@ class ProgramExecutable final : public angle::Subject
     // only Vulkan) to run post-link optimization tasks which don't affect the link results.
     mutable std::vector<std::shared_ptr<rx::LinkSubTask>> mPostLinkSubTasks;
     mutable std::vector<std::shared_ptr<angle::WaitableEvent>> mPostLinkSubTaskWaitableEvents;
+
+    // The serialized reflection data that load() left for ensureDeferredReflectionLoaded().
+    mutable std::mutex mDeferredReflectionMutex;
+    mutable std::atomic<bool> mHasDeferredReflection{false};
+    std::vector<uint8_t> mDeferredReflectionData;
 };
 
 void InstallExecutable(const Context *context,
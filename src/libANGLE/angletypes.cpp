@@ -7,6 +7,7 @@
 // angletypes.h : Defines a variety of structures and enum types that are used throughout libGLESv2
 
 #include "libANGLE/angletypes.h"
+#include "common/lz4_block.h"
 #include "libANGLE/Program.h"
 #include "libANGLE/State.h"
 #include "libANGLE/VertexArray.h"
@@ -1075,21 +1076,41 @@ GLsizeiptr GetBoundBufferAvailableSize(const OffsetBindingPointer<Buffer> &bindi
    //
 namespace angle
 {
-bool CompressBlob(const size_t cacheSize, const uint8_t *cacheData, MemoryBuffer *compressedData)
+namespace
+{
+// Header in front of every blob produced by CompressBlob.  The magic can't be mistaken for the
+// start of a gzip stream (0x1F 0x8B), which is how headerless legacy blobs are told apart.
+struct BlobCompressionHeader
+{
+    uint32_t magic;
+    BlobCompressionCodec codec;
+    uint8_t reserved[3];
+    uint32_t uncompressedSize;
+    // CRC32 of the compressed data following the header.
+    uint32_t checksum;
+};
+constexpr uint32_t kBlobCompressionMagic = 0x5A4C4E41;  // "ANLZ"
+static_assert(sizeof(BlobCompressionHeader) == 16, "Unexpected header padding");
+
+bool GzipCompress(const size_t cacheSize,
+                  const uint8_t *cacheData,
+                  size_t headerSize,
+                  MemoryBuffer *compressedData)
 {
     uLong uncompressedSize       = static_cast<uLong>(cacheSize);
     uLong expectedCompressedSize = zlib_internal::GzipExpectedCompressedSize(uncompressedSize);
     uLong actualCompressedSize   = expectedCompressedSize;
 
     // Allocate memory.
-    if (!compressedData->resize(expectedCompressedSize))
+    if (!compressedData->resize(headerSize + expectedCompressedSize))
     {
         ERR() << "Failed to allocate memory for compression";
         return false;
     }
 
-    int zResult = zlib_internal::GzipCompressHelper(compressedData->data(), &actualCompressedSize,
-                                                    cacheData, uncompressedSize, nullptr, nullptr);
+    int zResult = zlib_internal::GzipCompressHelper(compressedData->data() + headerSize,
+                                                    &actualCompressedSize, cacheData,
+                                                    uncompressedSize, nullptr, nullptr);
 
     if (zResult != Z_OK)
     {
@@ -1099,12 +1120,12 @@ bool CompressBlob(const size_t cacheSize, const uint8_t *cacheData, MemoryBuffer
 
     // Trim to actual size.
     ASSERT(actualCompressedSize <= expectedCompressedSize);
-    compressedData->setSize(actualCompressedSize);
+    compressedData->setSize(headerSize + actualCompressedSize);
 
     return true;
 }
 
-bool DecompressBlob(const uint8_t *compressedData,
+bool GzipDecompress(const uint8_t *compressedData,
                     const size_t compressedSize,
                     size_t maxUncompressedDataSize,
                     MemoryBuffer *uncompressedData)
@@ -1150,6 +1171,135 @@ bool DecompressBlob(const uint8_t *compressedData,
 
     return true;
 }
+}  // anonymous namespace
+
+bool CompressBlob(BlobCompressionCodec codec,
+                  const size_t cacheSize,
+                  const uint8_t *cacheData,
+                  MemoryBuffer *compressedData)
+{
+    constexpr size_t kHeaderSize = sizeof(BlobCompressionHeader);
+
+    if (cacheSize > std::numeric_limits<uint32_t>::max())
+    {
+        ERR() << "Blob is too large to compress";
+        return false;
+    }
+
+    switch (codec)
+    {
+        case BlobCompressionCodec::Gzip:
+            if (!GzipCompress(cacheSize, cacheData, kHeaderSize, compressedData))
+            {
+                return false;
+            }
+            break;
+
+        case BlobCompressionCodec::LZ4:
+        {
+            if (!compressedData->resize(kHeaderSize + LZ4BlockCompressBound(cacheSize)))
+            {
+                ERR() << "Failed to allocate memory for compression";
+                return false;
+            }
+            size_t compressedSize =
+                LZ4BlockCompress(cacheData, cacheSize, compressedData->data() + kHeaderSize);
+            compressedData->setSize(kHeaderSize + compressedSize);
+            break;
+        }
+
+        default:
+            UNREACHABLE();
+            return false;
+    }
+
+    BlobCompressionHeader header = {};
+    header.magic                 = kBlobCompressionMagic;
+    header.codec                 = codec;
+    header.uncompressedSize      = static_cast<uint32_t>(cacheSize);
+    header.checksum =
+        GenerateCRC32(compressedData->data() + kHeaderSize, compressedData->size() - kHeaderSize);
+    memcpy(compressedData->data(), &header, kHeaderSize);
+
+    return true;
+}
+
+bool CompressBlob(const size_t cacheSize, const uint8_t *cacheData, MemoryBuffer *compressedData)
+{
+    return CompressBlob(BlobCompressionCodec::Gzip, cacheSize, cacheData, compressedData);
+}
+
+bool DecompressBlob(const uint8_t *compressedData,
+                    const size_t compressedSize,
+                    size_t maxUncompressedDataSize,
+                    MemoryBuffer *uncompressedData)
+{
+    constexpr size_t kHeaderSize = sizeof(BlobCompressionHeader);
+
+    BlobCompressionHeader header;
+    if (compressedSize >= kHeaderSize)
+    {
+        memcpy(&header, compressedData, kHeaderSize);
+    }
+    if (compressedSize < kHeaderSize || header.magic != kBlobCompressionMagic)
+    {
+        // A headerless blob from an older version of ANGLE.
+        return GzipDecompress(compressedData, compressedSize, maxUncompressedDataSize,
+                              uncompressedData);
+    }
+
+    const uint8_t *payload   = compressedData + kHeaderSize;
+    const size_t payloadSize = compressedSize - kHeaderSize;
+
+    if (GenerateCRC32(payload, payloadSize) != header.checksum)
+    {
+        WARN() << "Compressed blob checksum mismatch";
+        return false;
+    }
+
+    if (header.uncompressedSize > maxUncompressedDataSize)
+    {
+        ERR() << "Decompressed data size is larger than the maximum supported ("
+              << header.uncompressedSize << " vs " << maxUncompressedDataSize << ")";
+        return false;
+    }
+
+    switch (header.codec)
+    {
+        case BlobCompressionCodec::Gzip:
+            if (!GzipDecompress(payload, payloadSize, maxUncompressedDataSize, uncompressedData))
+            {
+                return false;
+            }
+            break;
+
+        case BlobCompressionCodec::LZ4:
+            if (!uncompressedData->resize(header.uncompressedSize))
+            {
+                ERR() << "Failed to allocate memory for decompression";
+                return false;
+            }
+            if (!LZ4BlockDecompress(payload, payloadSize, uncompressedData->data(),
+                                    header.uncompressedSize))
+            {
+                WARN() << "Failed to decompress data";
+                return false;
+            }
+            break;
+
+        default:
+            WARN() << "Unknown blob compression codec " << static_cast<int>(header.codec);
+            return false;
+    }
+
+    if (uncompressedData->size() != header.uncompressedSize)
+    {
+        WARN() << "Decompressed blob size mismatch";
+        return false;
+    }
+
+    return true;
+}
 
 uint32_t GenerateCRC32(const uint8_t *data, size_t size)
 {
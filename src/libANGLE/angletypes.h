@@ -1283,6 +1283,25 @@ class BlobCacheValue  // To be replaced with std::span when C++20 is required
     size_t mSize;
 };
 
+// Codecs that CompressBlob can use.  Compressed blobs start with a small header that records the
+// codec, the uncompressed size and a checksum of the compressed data, so DecompressBlob doesn't
+// need to be told which codec produced a blob.  Blobs from before the header was introduced are
+// plain gzip streams, and are still accepted by DecompressBlob.
+enum class BlobCompressionCodec : uint8_t
+{
+    // Smallest output, slowest.
+    Gzip = 0,
+    // Larger output, but several times faster to compress and decompress.
+    LZ4 = 1,
+
+    InvalidEnum = 2,
+    EnumCount   = 2,
+};
+
+bool CompressBlob(BlobCompressionCodec codec,
+                  const size_t cacheSize,
+                  const uint8_t *cacheData,
+                  MemoryBuffer *compressedData);
 bool CompressBlob(const size_t cacheSize, const uint8_t *cacheData, MemoryBuffer *compressedData);
 bool DecompressBlob(const uint8_t *compressedData,
                     const size_t compressedSize,
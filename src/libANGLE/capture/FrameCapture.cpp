@@ -82,6 +82,7 @@ constexpr char kValidationExprVarName[] = "ANGLE_CAPTURE_VALIDATION_EXPR";
 constexpr char kSourceExtVarName[]      = "ANGLE_CAPTURE_SOURCE_EXT";
 constexpr char kSourceSizeVarName[]     = "ANGLE_CAPTURE_SOURCE_SIZE";
 constexpr char kForceShadowVarName[]    = "ANGLE_CAPTURE_FORCE_SHADOW";
+constexpr char kWriteQueueSizeVarName[] = "ANGLE_CAPTURE_WRITE_QUEUE_MB";
 
 constexpr size_t kBinaryAlignment   = 16;
 constexpr size_t kFunctionSizeLimit = 5000;
@@ -93,6 +94,15 @@ constexpr size_t kStringLengthLimit = 16380;
 constexpr char kDefaultSourceFileExt[]           = "cpp";
 constexpr size_t kDefaultSourceFileSizeThreshold = 400000;
 
+// Default limit to the number of megabytes waiting to be written to the capture files.
+constexpr size_t kDefaultWriteQueueSizeMB = 256;
+
+// The binary data is handed to the file writer in chunks of at least this size.
+constexpr size_t kBinaryDataChunkSize = 16 * 1024 * 1024;
+
+// Size of the buffer the binary data is compressed into before it's written.
+constexpr size_t kCompressedChunkSize = 1024 * 1024;
+
 // Android debug properties that correspond to the above environment variables
 constexpr char kAndroidEnabled[]        = "debug.angle.capture.enabled";
 constexpr char kAndroidOutDir[]         = "debug.angle.capture.out_dir";
@@ -106,6 +116,7 @@ constexpr char kAndroidValidationExpr[] = "debug.angle.capture.validation_expr";
 constexpr char kAndroidSourceExt[]      = "debug.angle.capture.source_ext";
 constexpr char kAndroidSourceSize[]     = "debug.angle.capture.source_size";
 constexpr char kAndroidForceShadow[]    = "debug.angle.capture.force_shadow";
+constexpr char kAndroidWriteQueueSize[] = "debug.angle.capture.write_queue_mb";
 
 struct FramebufferCaptureFuncs
 {
@@ -645,7 +656,7 @@ void WriteStringParamReplay(ReplayWriter &replayWriter,
                             std::ostream &header,
                             const CallCapture &call,
                             const ParamCapture &param,
-                            std::vector<uint8_t> *binaryData)
+                            ReplayBinaryData *binaryData)
 {
     const std::vector<uint8_t> &data = param.data[0];
     // null terminate C style string
@@ -657,9 +668,7 @@ void WriteStringParamReplay(ReplayWriter &replayWriter,
     {
         // Store in binary file if the string is too long.
         // Round up to 16-byte boundary for cross ABI safety.
-        size_t offset = rx::roundUpPow2(binaryData->size(), kBinaryAlignment);
-        binaryData->resize(offset + str.size() + 1);
-        memcpy(binaryData->data() + offset, str.data(), str.size() + 1);
+        size_t offset = binaryData->append(str.data(), str.size() + 1, kBinaryAlignment);
         out << "(const char *)&gBinaryData[" << offset << "]";
     }
     else if (str.find('\n') != std::string::npos)
@@ -779,7 +788,7 @@ void WriteBinaryParamReplay(ReplayWriter &replayWriter,
                             std::ostream &header,
                             const CallCapture &call,
                             const ParamCapture &param,
-                            std::vector<uint8_t> *binaryData)
+                            ReplayBinaryData *binaryData)
 {
     std::string varName = replayWriter.getInlineVariableName(call.entryPoint, param.name);
 
@@ -805,9 +814,7 @@ void WriteBinaryParamReplay(ReplayWriter &replayWriter,
     {
         // Store in binary file if data are not of type string
         // Round up to 16-byte boundary for cross ABI safety
-        size_t offset = rx::roundUpPow2(binaryData->size(), kBinaryAlignment);
-        binaryData->resize(offset + data.size());
-        memcpy(binaryData->data() + offset, data.data(), data.size());
+        size_t offset = binaryData->append(data.data(), data.size(), kBinaryAlignment);
         out << "(" << ParamTypeToString(overrideType) << ")&gBinaryData[" << offset << "]";
     }
 }
@@ -829,7 +836,7 @@ void WriteCppReplayForCall(const CallCapture &call,
                            ReplayWriter &replayWriter,
                            std::ostream &out,
                            std::ostream &header,
-                           std::vector<uint8_t> *binaryData,
+                           ReplayBinaryData *binaryData,
                            size_t *maxResourceIDBufferSize)
 {
     if (call.customFunctionName == "Comment")
@@ -1037,41 +1044,29 @@ struct SaveFileHelper
     std::string mFilePath;
 };
 
-void SaveBinaryData(bool compression,
-                    const std::string &outDir,
-                    gl::ContextID contextId,
-                    const std::string &captureLabel,
-                    const std::vector<uint8_t> &binaryData)
+// Compresses the input of |stream| and writes it to |file|.  Z_FINISH also ends the stream.
+void DeflateToFile(z_stream *stream,
+                   int flush,
+                   std::vector<uint8_t> *compressedData,
+                   SaveFileHelper *file)
 {
-    std::string binaryDataFileName = GetBinaryDataFilePath(compression, captureLabel);
-    std::string dataFilepath       = outDir + binaryDataFileName;
-
-    SaveFileHelper saveData(dataFilepath);
-
-    if (compression)
+    int zResult = Z_OK;
+    do
     {
-        // Save compressed data.
-        uLong uncompressedSize       = static_cast<uLong>(binaryData.size());
-        uLong expectedCompressedSize = zlib_internal::GzipExpectedCompressedSize(uncompressedSize);
-
-        std::vector<uint8_t> compressedData(expectedCompressedSize, 0);
+        stream->next_out  = compressedData->data();
+        stream->avail_out = static_cast<uInt>(compressedData->size());
 
-        uLong compressedSize = expectedCompressedSize;
-        int zResult = zlib_internal::GzipCompressHelper(compressedData.data(), &compressedSize,
-                                                        binaryData.data(), uncompressedSize,
-                                                        nullptr, nullptr);
-
-        if (zResult != Z_OK)
+        zResult = deflate(stream, flush);
+        if (zResult == Z_STREAM_ERROR)
         {
             FATAL() << "Error compressing binary data: " << zResult;
         }
 
-        saveData.write(compressedData.data(), compressedSize);
-    }
-    else
-    {
-        saveData.write(binaryData.data(), binaryData.size());
-    }
+        file->write(compressedData->data(), compressedData->size() - stream->avail_out);
+    } while (stream->avail_out == 0);
+
+    ASSERT(stream->avail_in == 0);
+    ASSERT(flush != Z_FINISH || zResult == Z_STREAM_END);
 }
 
 void WriteInitReplayCall(bool compression,
@@ -1144,7 +1139,7 @@ void MaybeResetResources(egl::Display *display,
                          std::stringstream &out,
                          std::stringstream &header,
                          ResourceTracker *resourceTracker,
-                         std::vector<uint8_t> *binaryData,
+                         ReplayBinaryData *binaryData,
                          bool &anyResourceReset,
                          size_t *maxResourceIDBufferSize)
 {
@@ -1591,7 +1586,7 @@ void MaybeResetFenceSyncObjects(std::stringstream &out,
                                 ReplayWriter &replayWriter,
                                 std::stringstream &header,
                                 ResourceTracker *resourceTracker,
-                                std::vector<uint8_t> *binaryData,
+                                ReplayBinaryData *binaryData,
                                 size_t *maxResourceIDBufferSize)
 {
     FenceSyncCalls &fenceSyncRegenCalls = resourceTracker->getFenceSyncRegenCalls();
@@ -1665,7 +1660,7 @@ void MaybeResetDefaultUniforms(std::stringstream &out,
                                std::stringstream &header,
                                const gl::Context *context,
                                ResourceTracker *resourceTracker,
-                               std::vector<uint8_t> *binaryData,
+                               ReplayBinaryData *binaryData,
                                size_t *maxResourceIDBufferSize)
 {
     DefaultUniformLocationsPerProgramMap &defaultUniformsToReset =
@@ -1732,7 +1727,7 @@ void MaybeResetOpaqueTypeObjects(ReplayWriter &replayWriter,
                                  std::stringstream &header,
                                  const gl::Context *context,
                                  ResourceTracker *resourceTracker,
-                                 std::vector<uint8_t> *binaryData,
+                                 ReplayBinaryData *binaryData,
                                  size_t *maxResourceIDBufferSize)
 {
     MaybeResetFenceSyncObjects(out, replayWriter, header, resourceTracker, binaryData,
@@ -1747,7 +1742,7 @@ void MaybeResetContextState(ReplayWriter &replayWriter,
                             std::stringstream &header,
                             ResourceTracker *resourceTracker,
                             const gl::Context *context,
-                            std::vector<uint8_t> *binaryData,
+                            ReplayBinaryData *binaryData,
                             StateResetHelper &stateResetHelper,
                             size_t *maxResourceIDBufferSize)
 {
@@ -1882,7 +1877,7 @@ void WriteCppReplayFunctionWithParts(const gl::ContextID contextID,
                                      ReplayFunc replayFunc,
                                      ReplayWriter &replayWriter,
                                      uint32_t frameIndex,
-                                     std::vector<uint8_t> *binaryData,
+                                     ReplayBinaryData *binaryData,
                                      const std::vector<CallCapture> &calls,
                                      std::stringstream &header,
                                      std::stringstream &out,
@@ -1957,7 +1952,7 @@ void WriteCppReplayFunctionWithPartsMultiContext(const gl::ContextID contextID,
                                                  ReplayFunc replayFunc,
                                                  ReplayWriter &replayWriter,
                                                  uint32_t frameIndex,
-                                                 std::vector<uint8_t> *binaryData,
+                                                 ReplayBinaryData *binaryData,
                                                  std::vector<CallCapture> &calls,
                                                  std::stringstream &header,
                                                  std::stringstream &out,
@@ -2108,7 +2103,7 @@ void WriteAuxiliaryContextCppSetupReplay(ReplayWriter &replayWriter,
                                          const std::string &captureLabel,
                                          uint32_t frameIndex,
                                          const std::vector<CallCapture> &setupCalls,
-                                         std::vector<uint8_t> *binaryData,
+                                         ReplayBinaryData *binaryData,
                                          bool serializeStateEnabled,
                                          const FrameCaptureShared &frameCaptureShared,
                                          size_t *maxResourceIDBufferSize)
@@ -2160,7 +2155,7 @@ void WriteShareGroupCppSetupReplay(ReplayWriter &replayWriter,
                                    uint32_t frameCount,
                                    const std::vector<CallCapture> &setupCalls,
                                    ResourceTracker *resourceTracker,
-                                   std::vector<uint8_t> *binaryData,
+                                   ReplayBinaryData *binaryData,
                                    bool serializeStateEnabled,
                                    gl::ContextID windowSurfaceContextID,
                                    size_t *maxResourceIDBufferSize)
@@ -6304,6 +6299,23 @@ FrameCaptureShared::FrameCaptureShared()
         }
     }
 
+    mFileWriter.setPendingBytesLimit(kDefaultWriteQueueSizeMB * 1024 * 1024);
+    std::string writeQueueSizeFromEnv =
+        GetEnvironmentVarOrUnCachedAndroidProperty(kWriteQueueSizeVarName, kAndroidWriteQueueSize);
+    if (!writeQueueSizeFromEnv.empty())
+    {
+        int writeQueueSize = atoi(writeQueueSizeFromEnv.c_str());
+        if (writeQueueSize <= 0)
+        {
+            WARN() << "Invalid capture write queue size: " << writeQueueSize;
+        }
+        else
+        {
+            mFileWriter.setPendingBytesLimit(static_cast<size_t>(writeQueueSize) * 1024 * 1024);
+        }
+    }
+    mReplayWriter.setFileWriter(&mFileWriter);
+
     std::string forceShadowFromEnv =
         GetEnvironmentVarOrUnCachedAndroidProperty(kForceShadowVarName, kAndroidForceShadow);
     if (forceShadowFromEnv == "1")
@@ -9023,6 +9035,7 @@ void FrameCaptureShared::onEndFrame(gl::Context *context)
 
     writeMainContextCppReplay(context, frameCapture->getSetupCalls(),
                               frameCapture->getStateResetHelper());
+    writeBinaryData(false);
 
     if (mFrameIndex == mCaptureEndFrame)
     {
@@ -9034,8 +9047,7 @@ void FrameCaptureShared::onEndFrame(gl::Context *context)
 
         // Save the index files after the last frame.
         writeCppReplayIndexFiles(context, false);
-        SaveBinaryData(mCompression, mOutDirectory, kSharedContextId, mCaptureLabel, mBinaryData);
-        mBinaryData.clear();
+        writeBinaryData(true);
         mWroteIndexFile = true;
         INFO() << "Finished recording graphics API capture";
     }
@@ -9058,12 +9070,38 @@ void FrameCaptureShared::onDestroyContext(const gl::Context *context)
         mFrameIndex -= 1;
         mCaptureEndFrame = mFrameIndex;
         writeCppReplayIndexFiles(context, true);
-        SaveBinaryData(mCompression, mOutDirectory, kSharedContextId, mCaptureLabel, mBinaryData);
-        mBinaryData.clear();
+        writeBinaryData(true);
         mWroteIndexFile = true;
     }
 }
 
+void FrameCaptureShared::writeBinaryData(bool endOfCapture)
+{
+    if (!endOfCapture && mBinaryData.getPendingSize() < kBinaryDataChunkSize)
+    {
+        return;
+    }
+
+    if (!mFileWriter.isWritingBinaryData())
+    {
+        std::string binaryDataFileName = GetBinaryDataFilePath(mCompression, mCaptureLabel);
+        mFileWriter.beginBinaryData(mOutDirectory + binaryDataFileName, mCompression);
+    }
+    mFileWriter.appendBinaryData(mBinaryData.takePending());
+
+    if (endOfCapture)
+    {
+        INFO() << "Binary data is " << mBinaryData.getSize() << " bytes, "
+               << mBinaryData.getDeduplicatedSize() << " bytes of repeated payloads were omitted";
+
+        mFileWriter.endBinaryData();
+        mBinaryData.reset();
+
+        // Make sure the capture is complete on disk once it's reported as finished.
+        mFileWriter.finish();
+    }
+}
+
 void FrameCaptureShared::onMakeCurrent(const gl::Context *context, const egl::Surface *drawSurface)
 {
     if (!drawSurface)
@@ -9460,8 +9498,7 @@ void FrameCaptureShared::writeJSON(const gl::Context *context)
                            << ".json";
         std::string jsonFileName = jsonFileNameStream.str();
 
-        SaveFileHelper saveData(jsonFileName);
-        saveData.write(reinterpret_cast<const uint8_t *>(json.data()), json.length());
+        mFileWriter.writeFile(jsonFileName, std::string(json.data(), json.length()));
     }
 }
 
@@ -10062,9 +10099,215 @@ void CaptureShaderStrings(GLsizei count,
     paramCapture->data.emplace_back(std::move(data));
 }
 
+// CaptureFileWriter implementation.
+CaptureFileWriter::CaptureFileWriter()
+    : mPendingBytesLimit(std::numeric_limits<size_t>::max()),
+      mWritingBinaryData(false),
+      mPendingBytes(0),
+      mTaskRunning(false),
+      mExitThread(false)
+{}
+
+CaptureFileWriter::~CaptureFileWriter()
+{
+    // The capture may be destroyed before its last frame, e.g. if the application exits early.
+    // Finish the binary data so the file is still complete, in particular its gzip stream.
+    if (mWritingBinaryData)
+    {
+        endBinaryData();
+    }
+
+    // The thread writes everything that's queued before exiting.
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mExitThread = true;
+    }
+    mTaskCondition.notify_one();
+
+    if (mThread.joinable())
+    {
+        mThread.join();
+    }
+}
+
+void CaptureFileWriter::writeFile(const std::string &path, std::string &&contents)
+{
+    Task task;
+    task.type     = Task::Type::WriteFile;
+    task.path     = path;
+    task.contents = std::move(contents);
+    enqueue(std::move(task));
+}
+
+void CaptureFileWriter::beginBinaryData(const std::string &path, bool compression)
+{
+    if (mWritingBinaryData)
+    {
+        endBinaryData();
+    }
+    mWritingBinaryData = true;
+
+    Task task;
+    task.type        = Task::Type::BeginBinaryData;
+    task.path        = path;
+    task.compression = compression;
+    enqueue(std::move(task));
+}
+
+void CaptureFileWriter::appendBinaryData(std::vector<uint8_t> &&data)
+{
+    ASSERT(mWritingBinaryData);
+
+    Task task;
+    task.type = Task::Type::AppendBinaryData;
+    task.data = std::move(data);
+    enqueue(std::move(task));
+}
+
+void CaptureFileWriter::endBinaryData()
+{
+    ASSERT(mWritingBinaryData);
+    mWritingBinaryData = false;
+
+    Task task;
+    task.type = Task::Type::EndBinaryData;
+    enqueue(std::move(task));
+}
+
+void CaptureFileWriter::finish()
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+    mDoneCondition.wait(lock, [this] { return mTasks.empty() && !mTaskRunning; });
+}
+
+void CaptureFileWriter::enqueue(Task &&task)
+{
+    const size_t taskBytes = task.contents.size() + task.data.size();
+
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+
+        // Wait for the thread to catch up if too much is waiting to be written.  Anything fits
+        // once nothing is pending, so a single task larger than the limit still goes through.
+        mDoneCondition.wait(lock, [this, taskBytes] {
+            return mPendingBytes == 0 || mPendingBytes + taskBytes <= mPendingBytesLimit;
+        });
+
+        mPendingBytes += taskBytes;
+        mTasks.push_back(std::move(task));
+
+        if (!mThread.joinable())
+        {
+            mThread = std::thread(&CaptureFileWriter::threadMain, this);
+        }
+    }
+    mTaskCondition.notify_one();
+}
+
+void CaptureFileWriter::threadMain()
+{
+    // State of the binary data file, which is only touched by this thread.
+    std::unique_ptr<SaveFileHelper> binaryDataFile;
+    bool compression = false;
+    z_stream stream  = {};
+    std::vector<uint8_t> compressedData;
+
+    while (true)
+    {
+        Task task;
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mTaskCondition.wait(lock, [this] { return mExitThread || !mTasks.empty(); });
+            if (mTasks.empty())
+            {
+                return;
+            }
+            task = std::move(mTasks.front());
+            mTasks.pop_front();
+            mTaskRunning = true;
+        }
+
+        const size_t taskBytes = task.contents.size() + task.data.size();
+
+        switch (task.type)
+        {
+            case Task::Type::WriteFile:
+            {
+                SaveFileHelper saveFile(task.path);
+                saveFile.write(reinterpret_cast<const uint8_t *>(task.contents.data()),
+                               task.contents.size());
+                break;
+            }
+
+            case Task::Type::BeginBinaryData:
+                ASSERT(!binaryDataFile);
+                binaryDataFile = std::make_unique<SaveFileHelper>(task.path);
+                compression    = task.compression;
+                if (compression)
+                {
+                    // Produce a single gzip member, the same as compressing all the data at once.
+                    stream      = {};
+                    int zResult = deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED,
+                                               MAX_WBITS + 16, 8, Z_DEFAULT_STRATEGY);
+                    if (zResult != Z_OK)
+                    {
+                        FATAL() << "Error compressing binary data: " << zResult;
+                    }
+                    compressedData.resize(kCompressedChunkSize);
+                }
+                break;
+
+            case Task::Type::AppendBinaryData:
+                ASSERT(binaryDataFile);
+                if (compression)
+                {
+                    size_t offset = 0;
+                    while (offset < task.data.size())
+                    {
+                        size_t size = std::min<size_t>(task.data.size() - offset,
+                                                       std::numeric_limits<uInt>::max());
+                        stream.next_in  = task.data.data() + offset;
+                        stream.avail_in = static_cast<uInt>(size);
+                        DeflateToFile(&stream, Z_NO_FLUSH, &compressedData, binaryDataFile.get());
+                        offset += size;
+                    }
+                }
+                else
+                {
+                    binaryDataFile->write(task.data.data(), task.data.size());
+                }
+                break;
+
+            case Task::Type::EndBinaryData:
+                ASSERT(binaryDataFile);
+                if (compression)
+                {
+                    stream.next_in  = nullptr;
+                    stream.avail_in = 0;
+                    DeflateToFile(&stream, Z_FINISH, &compressedData, binaryDataFile.get());
+                    deflateEnd(&stream);
+                }
+                binaryDataFile.reset();
+                break;
+
+            default:
+                UNREACHABLE();
+                break;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mPendingBytes -= taskBytes;
+            mTaskRunning = false;
+        }
+        mDoneCondition.notify_all();
+    }
+}
+
 // ReplayWriter implementation.
 ReplayWriter::ReplayWriter()
-    : mSourceFileExtension(kDefaultSourceFileExt),
+    : mFileWriter(nullptr),
+      mSourceFileExtension(kDefaultSourceFileExt),
       mSourceFileSizeThreshold(kDefaultSourceFileSizeThreshold),
       mFrameIndex(1)
 {}
@@ -10251,7 +10494,7 @@ void ReplayWriter::saveHeader()
     headerPathStream << mFilenamePattern << ".h";
     std::string headerPath = headerPathStream.str();
 
-    SaveFileHelper saveH(headerPath);
+    std::ostringstream saveH;
 
     saveH << mHeaderPrologue << "\n";
 
@@ -10274,6 +10517,8 @@ void ReplayWriter::saveHeader()
         saveH << "extern " << globalVar << ";\n";
     }
 
+    mFileWriter->writeFile(headerPath, saveH.str());
+
     mPublicFunctionPrototypes.clear();
     mPrivateFunctionPrototypes.clear();
     mGlobalVariableDeclarations.clear();
@@ -10307,7 +10552,7 @@ void ReplayWriter::saveSetupFile()
 
 void ReplayWriter::writeReplaySource(const std::string &filename)
 {
-    SaveFileHelper saveCpp(filename);
+    std::ostringstream saveCpp;
 
     saveCpp << mSourcePrologue << "\n";
     for (const std::string &header : mReplayHeaders)
@@ -10342,6 +10587,8 @@ void ReplayWriter::writeReplaySource(const std::string &filename)
         saveCpp << "}  // extern \"C\"\n";
     }
 
+    mFileWriter->writeFile(filename, saveCpp.str());
+
     mReplayHeaders.clear();
     mPrivateFunctions.clear();
     mPublicFunctions.clear();
@@ -10,6 +10,12 @@
 #ifndef LIBANGLE_FRAME_CAPTURE_H_
 #define LIBANGLE_FRAME_CAPTURE_H_
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
 #include "common/PackedEnums.h"
 #include "common/SimpleMutex.h"
 #include "common/frame_capture_utils.h"
@@ -18,6 +24,7 @@
 #include "libANGLE/ShareGroup.h"
 #include "libANGLE/Thread.h"
 #include "libANGLE/angletypes.h"
+#include "libANGLE/capture/ReplayBinaryData.h"
 #include "libANGLE/entry_points_utils.h"
 
 namespace gl
@@ -71,12 +78,69 @@ class DataTracker final : angle::NonCopyable
     StringCounters mStringCounters;
 };
 
+// Writes the files of a capture on a background thread, so the application's thread doesn't wait
+// for the disk or for compression.  The binary data is written as a single file that is given in
+// chunks and compressed as a stream.  Queueing blocks while more than a limit of data is waiting to
+// be written, which bounds the memory a capture can use.
+class CaptureFileWriter final : angle::NonCopyable
+{
+  public:
+    CaptureFileWriter();
+    ~CaptureFileWriter();
+
+    void setPendingBytesLimit(size_t limit) { mPendingBytesLimit = limit; }
+
+    void writeFile(const std::string &path, std::string &&contents);
+
+    void beginBinaryData(const std::string &path, bool compression);
+    void appendBinaryData(std::vector<uint8_t> &&data);
+    void endBinaryData();
+    bool isWritingBinaryData() const { return mWritingBinaryData; }
+
+    // Waits until everything queued so far is written.
+    void finish();
+
+  private:
+    struct Task
+    {
+        enum class Type
+        {
+            WriteFile,
+            BeginBinaryData,
+            AppendBinaryData,
+            EndBinaryData,
+        };
+
+        Type type = Type::WriteFile;
+        std::string path;
+        std::string contents;
+        std::vector<uint8_t> data;
+        bool compression = false;
+    };
+
+    void enqueue(Task &&task);
+    void threadMain();
+
+    size_t mPendingBytesLimit;
+    bool mWritingBinaryData;
+
+    std::mutex mMutex;
+    std::condition_variable mTaskCondition;
+    std::condition_variable mDoneCondition;
+    std::deque<Task> mTasks;
+    size_t mPendingBytes;
+    bool mTaskRunning;
+    bool mExitThread;
+    std::thread mThread;
+};
+
 class ReplayWriter final : angle::NonCopyable
 {
   public:
     ReplayWriter();
     ~ReplayWriter();
 
+    void setFileWriter(CaptureFileWriter *fileWriter) { mFileWriter = fileWriter; }
     void setSourceFileExtension(const char *ext);
     void setSourceFileSizeThreshold(size_t sourceFileSizeThreshold);
     void setFilenamePattern(const std::string &pattern);
@@ -112,6 +176,7 @@ class ReplayWriter final : angle::NonCopyable
     void addWrittenFile(const std::string &filename);
     size_t getStoredReplaySourceSize() const;
 
+    CaptureFileWriter *mFileWriter;
     std::string mSourceFileExtension;
     size_t mSourceFileSizeThreshold;
     size_t mFrameIndex;
@@ -788,13 +853,17 @@ class FrameCaptureShared final : angle::NonCopyable
 
     void runMidExecutionCapture(gl::Context *context);
 
+    // Hands the pending binary data over to the file writer once there is enough of it, or when
+    // the capture is done.
+    void writeBinaryData(bool endOfCapture);
+
     void scanSetupCalls(std::vector<CallCapture> &setupCalls);
 
     std::vector<CallCapture> mFrameCalls;
 
     // We save one large buffer of binary data for the whole CPP replay.
     // This simplifies a lot of file management.
-    std::vector<uint8_t> mBinaryData;
+    ReplayBinaryData mBinaryData;
 
     bool mEnabled;
     bool mSerializeStateEnabled;
@@ -821,6 +890,7 @@ class FrameCaptureShared final : angle::NonCopyable
     angle::SimpleMutex mFrameCaptureMutex;
 
     ResourceTracker mResourceTracker;
+    CaptureFileWriter mFileWriter;
     ReplayWriter mReplayWriter;
 
     // If you don't know which frame you want to start capturing at, use the capture trigger.
@@ -30,6 +30,8 @@ DataCounters::DataCounters() {}
 DataCounters::~DataCounters() {}
 StringCounters::StringCounters() {}
 StringCounters::~StringCounters() {}
+CaptureFileWriter::CaptureFileWriter() {}
+CaptureFileWriter::~CaptureFileWriter() {}
 ReplayWriter::ReplayWriter() {}
 ReplayWriter::~ReplayWriter() {}
 
@@ -0,0 +1,97 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ReplayBinaryData.cpp:
+//   The binary data of a captured replay (gBinaryData).
+//
+
+#include "libANGLE/capture/ReplayBinaryData.h"
+
+#include <cstring>
+
+#include "common/hash_utils.h"
+#include "common/mathutil.h"
+
+namespace angle
+{
+namespace
+{
+// Smaller payloads are always stored, as looking them up costs about as much as they save.
+constexpr size_t kMinDeduplicatedSize = 64;
+
+uint64_t HashPayload(const void *data, size_t size)
+{
+    return XXH64(data, size, 0x4A1E7C39u);
+}
+}  // anonymous namespace
+
+ReplayBinaryData::ReplayBinaryData() : ReplayBinaryData(HashPayload) {}
+
+ReplayBinaryData::ReplayBinaryData(HashFunction hashFunction)
+    : mHashFunction(hashFunction), mTakenSize(0), mDeduplicatedSize(0)
+{}
+
+ReplayBinaryData::~ReplayBinaryData() = default;
+
+size_t ReplayBinaryData::append(const void *data, size_t size, size_t alignment)
+{
+    ContentKey key = {};
+    bool indexed   = false;
+    if (size >= kMinDeduplicatedSize)
+    {
+        key.hash = mHashFunction(data, size);
+        key.size = size;
+
+        auto iter = mContentOffsets.find(key);
+        if (iter == mContentOffsets.end())
+        {
+            indexed = true;
+        }
+        else if (iter->second % alignment == 0 && isStoredAt(iter->second, data, size))
+        {
+            mDeduplicatedSize += size;
+            return iter->second;
+        }
+    }
+
+    // Round up to keep the data aligned for cross ABI safety.
+    size_t offset        = rx::roundUpPow2(getSize(), alignment);
+    size_t offsetInChunk = offset - mTakenSize;
+    mPending.resize(offsetInChunk + size);
+    memcpy(mPending.data() + offsetInChunk, data, size);
+
+    // On a collision or a misaligned match, the index keeps pointing to the earlier copy.
+    if (indexed)
+    {
+        mContentOffsets[key] = offset;
+    }
+    return offset;
+}
+
+bool ReplayBinaryData::isStoredAt(size_t offset, const void *data, size_t size) const
+{
+    if (offset < mTakenSize)
+    {
+        return true;
+    }
+    return memcmp(mPending.data() + (offset - mTakenSize), data, size) == 0;
+}
+
+std::vector<uint8_t> ReplayBinaryData::takePending()
+{
+    std::vector<uint8_t> pending = std::move(mPending);
+    mPending.clear();
+    mTakenSize += pending.size();
+    return pending;
+}
+
+void ReplayBinaryData::reset()
+{
+    mTakenSize = 0;
+    mPending.clear();
+    mContentOffsets.clear();
+    mDeduplicatedSize = 0;
+}
+}  // namespace angle
@@ -0,0 +1,84 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ReplayBinaryData.h:
+//   The binary data of a captured replay (gBinaryData).
+//
+
+#ifndef LIBANGLE_CAPTURE_REPLAY_BINARY_DATA_H_
+#define LIBANGLE_CAPTURE_REPLAY_BINARY_DATA_H_
+
+#include <unordered_map>
+#include <vector>
+
+#include "common/angleutils.h"
+
+namespace angle
+{
+// The binary data of a replay (gBinaryData).  The data of the frames that are already written is
+// handed over to the CaptureFileWriter in chunks, so only the rest is kept in memory.  Offsets are
+// relative to the start of the whole data.
+//
+// The data is content-addressed: a payload that was already appended, such as a buffer uploaded
+// every frame or a texture shared by several contexts, is only stored once and every call that
+// uses it points to the same offset.
+class ReplayBinaryData final : angle::NonCopyable
+{
+  public:
+    using HashFunction = uint64_t (*)(const void *data, size_t size);
+
+    ReplayBinaryData();
+    // For testing, with a hash function that collides on purpose.
+    explicit ReplayBinaryData(HashFunction hashFunction);
+    ~ReplayBinaryData();
+
+    // Appends |size| bytes at an offset aligned to |alignment| and returns that offset, or returns
+    // the offset of an identical payload that is already stored.
+    size_t append(const void *data, size_t size, size_t alignment);
+
+    size_t getPendingSize() const { return mPending.size(); }
+    std::vector<uint8_t> takePending();
+
+    size_t getSize() const { return mTakenSize + mPending.size(); }
+    size_t getDeduplicatedSize() const { return mDeduplicatedSize; }
+
+    // Starts over for the next capture.
+    void reset();
+
+  private:
+    // Payloads are identified by a 64-bit hash and their size.  While the earlier copy of a payload
+    // is still pending its contents are compared as well, so a collision stores the payload again.
+    // The data that was handed over can't be compared anymore, and a collision with it would need
+    // about 2^32 payloads of the same size to become likely.
+    struct ContentKey
+    {
+        bool operator==(const ContentKey &other) const
+        {
+            return hash == other.hash && size == other.size;
+        }
+
+        uint64_t hash;
+        size_t size;
+    };
+
+    struct ContentKeyHash
+    {
+        size_t operator()(const ContentKey &key) const { return static_cast<size_t>(key.hash); }
+    };
+
+    bool isStoredAt(size_t offset, const void *data, size_t size) const;
+
+    HashFunction mHashFunction;
+
+    // The size of the data that was already handed over.
+    size_t mTakenSize;
+    std::vector<uint8_t> mPending;
+
+    std::unordered_map<ContentKey, size_t, ContentKeyHash> mContentOffsets;
+    size_t mDeduplicatedSize;
+};
+}  // namespace angle
+
+#endif  // LIBANGLE_CAPTURE_REPLAY_BINARY_DATA_H_
@@ -0,0 +1,151 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ReplayBinaryData_unittest.cpp: Unit tests for the deduplicated binary data of captures.
+
+#include <gtest/gtest.h>
+
+#include "libANGLE/capture/ReplayBinaryData.h"
+
+namespace angle
+{
+namespace
+{
+std::vector<uint8_t> MakePayload(size_t size, uint8_t start)
+{
+    std::vector<uint8_t> payload(size);
+    for (size_t i = 0; i < size; ++i)
+    {
+        payload[i] = static_cast<uint8_t>(i + start);
+    }
+    return payload;
+}
+
+// Makes every payload collide.
+uint64_t CollidingHash(const void *data, size_t size)
+{
+    return 0;
+}
+
+// Returns the data stored at |offset| by |binaryData|, which must not have been taken yet.
+std::vector<uint8_t> GetStored(ReplayBinaryData *binaryData, size_t offset, size_t size)
+{
+    std::vector<uint8_t> pending = binaryData->takePending();
+    EXPECT_LE(offset + size, pending.size());
+    return std::vector<uint8_t>(pending.begin() + offset, pending.begin() + offset + size);
+}
+}  // anonymous namespace
+
+// Tests that a repeated payload is stored once.
+TEST(ReplayBinaryDataTest, RepeatedPayload)
+{
+    ReplayBinaryData binaryData;
+    std::vector<uint8_t> payload = MakePayload(256, 0);
+    std::vector<uint8_t> other   = MakePayload(256, 1);
+
+    size_t first = binaryData.append(payload.data(), payload.size(), 4);
+    EXPECT_EQ(0u, first);
+    size_t second = binaryData.append(other.data(), other.size(), 4);
+    EXPECT_EQ(256u, second);
+
+    EXPECT_EQ(first, binaryData.append(payload.data(), payload.size(), 4));
+    EXPECT_EQ(second, binaryData.append(other.data(), other.size(), 4));
+    EXPECT_EQ(512u, binaryData.getSize());
+    EXPECT_EQ(512u, binaryData.getDeduplicatedSize());
+}
+
+// Tests that payloads are still found after the data before them was handed over.
+TEST(ReplayBinaryDataTest, RepeatedPayloadAfterTake)
+{
+    ReplayBinaryData binaryData;
+    std::vector<uint8_t> payload = MakePayload(256, 0);
+
+    size_t offset = binaryData.append(payload.data(), payload.size(), 4);
+    EXPECT_EQ(256u, binaryData.takePending().size());
+    EXPECT_EQ(0u, binaryData.getPendingSize());
+
+    EXPECT_EQ(offset, binaryData.append(payload.data(), payload.size(), 4));
+    EXPECT_EQ(256u, binaryData.getSize());
+    EXPECT_EQ(256u, binaryData.getDeduplicatedSize());
+}
+
+// Tests that small payloads are always stored.
+TEST(ReplayBinaryDataTest, SmallPayload)
+{
+    ReplayBinaryData binaryData;
+    std::vector<uint8_t> payload = MakePayload(16, 0);
+
+    size_t first  = binaryData.append(payload.data(), payload.size(), 4);
+    size_t second = binaryData.append(payload.data(), payload.size(), 4);
+    EXPECT_NE(first, second);
+    EXPECT_EQ(0u, binaryData.getDeduplicatedSize());
+}
+
+// Tests that a payload isn't shared with a copy that doesn't have the alignment it needs.
+TEST(ReplayBinaryDataTest, MisalignedPayload)
+{
+    ReplayBinaryData binaryData;
+    std::vector<uint8_t> padding = MakePayload(4, 0);
+    std::vector<uint8_t> payload = MakePayload(256, 1);
+
+    binaryData.append(padding.data(), padding.size(), 4);
+    size_t first = binaryData.append(payload.data(), payload.size(), 4);
+    EXPECT_EQ(4u, first);
+
+    size_t second = binaryData.append(payload.data(), payload.size(), 16);
+    EXPECT_EQ(0u, second % 16);
+    EXPECT_NE(first, second);
+
+    // The earlier copy still serves payloads that it is aligned enough for.
+    EXPECT_EQ(first, binaryData.append(payload.data(), payload.size(), 4));
+}
+
+// Tests that payloads with the same hash but different contents are both stored.
+TEST(ReplayBinaryDataTest, HashCollision)
+{
+    ReplayBinaryData binaryData(CollidingHash);
+    std::vector<uint8_t> payload = MakePayload(256, 0);
+    std::vector<uint8_t> other   = MakePayload(256, 1);
+
+    size_t first  = binaryData.append(payload.data(), payload.size(), 4);
+    size_t second = binaryData.append(other.data(), other.size(), 4);
+    EXPECT_NE(first, second);
+    EXPECT_EQ(0u, binaryData.getDeduplicatedSize());
+
+    // The first payload is still deduplicated.
+    EXPECT_EQ(first, binaryData.append(payload.data(), payload.size(), 4));
+    EXPECT_EQ(256u, binaryData.getDeduplicatedSize());
+
+    EXPECT_EQ(payload, GetStored(&binaryData, first, payload.size()));
+}
+
+// Tests that payloads of different sizes don't match even if their hashes do.
+TEST(ReplayBinaryDataTest, SizeMismatch)
+{
+    ReplayBinaryData binaryData(CollidingHash);
+    std::vector<uint8_t> payload = MakePayload(256, 0);
+
+    size_t first  = binaryData.append(payload.data(), payload.size(), 4);
+    size_t second = binaryData.append(payload.data(), 128, 4);
+    EXPECT_NE(first, second);
+    EXPECT_EQ(0u, binaryData.getDeduplicatedSize());
+}
+
+// Tests that reset forgets the payloads of the previous capture.
+TEST(ReplayBinaryDataTest, Reset)
+{
+    ReplayBinaryData binaryData;
+    std::vector<uint8_t> payload = MakePayload(256, 0);
+
+    binaryData.append(payload.data(), payload.size(), 4);
+    binaryData.takePending();
+    binaryData.reset();
+    EXPECT_EQ(0u, binaryData.getSize());
+
+    EXPECT_EQ(0u, binaryData.append(payload.data(), payload.size(), 4));
+    EXPECT_EQ(0u, binaryData.getDeduplicatedSize());
+    EXPECT_EQ(payload, GetStored(&binaryData, 0, payload.size()));
+}
+}  // namespace angle
@@ -0,0 +1,361 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// copyvertex.cpp: Implements the parallel vertex conversion and the vector kernels of the vertex
+//   conversion functions.  The kernels convert as many values as they can in full vectors, and the
+//   rest with the same arithmetic as the scalar templates in copyvertex.inc.h, so the result
+//   doesn't depend on the path taken.
+
+#include "libANGLE/renderer/copyvertex.h"
+
+#include <string.h>
+
+#include <algorithm>
+#include <limits>
+
+#include "common/WorkerThread.h"
+
+#if defined(_M_X64) || defined(__x86_64__)
+#    define ANGLE_COPYVERTEX_SSE2 1
+#    include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#    define ANGLE_COPYVERTEX_NEON 1
+#    include <arm_neon.h>
+#endif
+
+namespace rx
+{
+void ConvertVertexData(angle::WorkerThreadPool *workerPool,
+                       VertexCopyFunction copyFunction,
+                       const uint8_t *input,
+                       size_t inputStride,
+                       size_t vertexCount,
+                       uint8_t *output,
+                       size_t outputStride)
+{
+    ASSERT(copyFunction != nullptr);
+
+    if (vertexCount * outputStride < kMinParallelVertexConversionBytes)
+    {
+        copyFunction(input, inputStride, vertexCount, output);
+        return;
+    }
+
+    const size_t jobVertexCount = std::max<size_t>(kVertexConversionJobBytes / outputStride, 1);
+    const size_t jobCount       = (vertexCount + jobVertexCount - 1) / jobVertexCount;
+    angle::RunParallelJobs(workerPool, jobCount, [&](size_t job) {
+        const size_t firstVertex = job * jobVertexCount;
+        const size_t count       = std::min(jobVertexCount, vertexCount - firstVertex);
+        copyFunction(input + firstVertex * inputStride, inputStride, count,
+                     output + firstVertex * outputStride);
+    });
+}
+
+namespace priv
+{
+namespace
+{
+template <typename T>
+void CopyRemainingToFloat(const uint8_t *input,
+                          size_t first,
+                          size_t valueCount,
+                          bool normalized,
+                          float *output)
+{
+    typedef std::numeric_limits<T> NL;
+
+    for (size_t index = first; index < valueCount; ++index)
+    {
+        T value;
+        memcpy(&value, input + index * sizeof(T), sizeof(T));
+
+        float result = static_cast<float>(value);
+        if (normalized)
+        {
+            result = result / static_cast<float>(NL::max());
+            result = NL::is_signed && result < -1.0f ? -1.0f : result;
+        }
+        output[index] = result;
+    }
+}
+
+#if defined(ANGLE_COPYVERTEX_SSE2)
+ANGLE_INLINE void StoreFloat4(__m128i values,
+                              bool normalized,
+                              bool isSigned,
+                              __m128 max,
+                              float *output)
+{
+    __m128 result = _mm_cvtepi32_ps(values);
+    if (normalized)
+    {
+        // Divide rather than multiply by the reciprocal to round like the scalar path.
+        result = _mm_div_ps(result, max);
+        if (isSigned)
+        {
+            result = _mm_max_ps(result, _mm_set1_ps(-1.0f));
+        }
+    }
+    _mm_storeu_ps(output, result);
+}
+
+template <bool isSigned>
+size_t Copy16BitToFloatSIMD(const uint8_t *input, size_t valueCount, bool normalized, float *output)
+{
+    const __m128 max   = _mm_set1_ps(isSigned ? 32767.0f : 65535.0f);
+    const __m128i zero = _mm_setzero_si128();
+    size_t index       = 0;
+    for (; index + 8 <= valueCount; index += 8)
+    {
+        const __m128i values =
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(input + index * 2));
+        // Sign extend by shifting the value down from the top of each 32-bit lane.
+        const __m128i low  = isSigned ? _mm_srai_epi32(_mm_unpacklo_epi16(values, values), 16)
+                                      : _mm_unpacklo_epi16(values, zero);
+        const __m128i high = isSigned ? _mm_srai_epi32(_mm_unpackhi_epi16(values, values), 16)
+                                      : _mm_unpackhi_epi16(values, zero);
+        StoreFloat4(low, normalized, isSigned, max, output + index);
+        StoreFloat4(high, normalized, isSigned, max, output + index + 4);
+    }
+    return index;
+}
+
+template <bool isSigned>
+size_t Copy8BitToFloatSIMD(const uint8_t *input, size_t valueCount, bool normalized, float *output)
+{
+    const __m128 max   = _mm_set1_ps(isSigned ? 127.0f : 255.0f);
+    const __m128i zero = _mm_setzero_si128();
+    size_t index       = 0;
+    for (; index + 16 <= valueCount; index += 16)
+    {
+        const __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input + index));
+        const __m128i low16  = isSigned ? _mm_srai_epi16(_mm_unpacklo_epi8(values, values), 8)
+                                        : _mm_unpacklo_epi8(values, zero);
+        const __m128i high16 = isSigned ? _mm_srai_epi16(_mm_unpackhi_epi8(values, values), 8)
+                                        : _mm_unpackhi_epi8(values, zero);
+        const __m128i words[2] = {low16, high16};
+        for (size_t half = 0; half < 2; ++half)
+        {
+            const __m128i word = words[half];
+            const __m128i low  = isSigned ? _mm_srai_epi32(_mm_unpacklo_epi16(word, word), 16)
+                                          : _mm_unpacklo_epi16(word, zero);
+            const __m128i high = isSigned ? _mm_srai_epi32(_mm_unpackhi_epi16(word, word), 16)
+                                          : _mm_unpackhi_epi16(word, zero);
+            StoreFloat4(low, normalized, isSigned, max, output + index + half * 8);
+            StoreFloat4(high, normalized, isSigned, max, output + index + half * 8 + 4);
+        }
+    }
+    return index;
+}
+
+size_t CopyFixedToFloatSIMD(const uint8_t *input, size_t valueCount, float *output)
+{
+    const __m128 scale = _mm_set1_ps(1.0f / (1 << 16));
+    size_t index       = 0;
+    for (; index + 4 <= valueCount; index += 4)
+    {
+        const __m128i values =
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(input + index * 4));
+        _mm_storeu_ps(output + index, _mm_mul_ps(_mm_cvtepi32_ps(values), scale));
+    }
+    return index;
+}
+#elif defined(ANGLE_COPYVERTEX_NEON)
+ANGLE_INLINE void StoreFloat4(float32x4_t result,
+                              bool normalized,
+                              bool isSigned,
+                              float32x4_t max,
+                              float *output)
+{
+    if (normalized)
+    {
+        // Divide rather than multiply by the reciprocal to round like the scalar path.
+        result = vdivq_f32(result, max);
+        if (isSigned)
+        {
+            result = vmaxq_f32(result, vdupq_n_f32(-1.0f));
+        }
+    }
+    vst1q_f32(output, result);
+}
+
+ANGLE_INLINE void StoreInt16x8(int16x8_t values,
+                               bool normalized,
+                               float32x4_t max,
+                               float *output)
+{
+    StoreFloat4(vcvtq_f32_s32(vmovl_s16(vget_low_s16(values))), normalized, true, max, output);
+    StoreFloat4(vcvtq_f32_s32(vmovl_s16(vget_high_s16(values))), normalized, true, max,
+                output + 4);
+}
+
+ANGLE_INLINE void StoreUint16x8(uint16x8_t values,
+                                bool normalized,
+                                float32x4_t max,
+                                float *output)
+{
+    StoreFloat4(vcvtq_f32_u32(vmovl_u16(vget_low_u16(values))), normalized, false, max, output);
+    StoreFloat4(vcvtq_f32_u32(vmovl_u16(vget_high_u16(values))), normalized, false, max,
+                output + 4);
+}
+
+template <bool isSigned>
+size_t Copy16BitToFloatSIMD(const uint8_t *input, size_t valueCount, bool normalized, float *output)
+{
+    const float32x4_t max = vdupq_n_f32(isSigned ? 32767.0f : 65535.0f);
+    size_t index          = 0;
+    for (; index + 8 <= valueCount; index += 8)
+    {
+        const uint8x16_t values = vld1q_u8(input + index * 2);
+        if (isSigned)
+        {
+            StoreInt16x8(vreinterpretq_s16_u8(values), normalized, max, output + index);
+        }
+        else
+        {
+            StoreUint16x8(vreinterpretq_u16_u8(values), normalized, max, output + index);
+        }
+    }
+    return index;
+}
+
+template <bool isSigned>
+size_t Copy8BitToFloatSIMD(const uint8_t *input, size_t valueCount, bool normalized, float *output)
+{
+    const float32x4_t max = vdupq_n_f32(isSigned ? 127.0f : 255.0f);
+    size_t index          = 0;
+    for (; index + 16 <= valueCount; index += 16)
+    {
+        const uint8x16_t values = vld1q_u8(input + index);
+        if (isSigned)
+        {
+            const int8x16_t signedValues = vreinterpretq_s8_u8(values);
+            StoreInt16x8(vmovl_s8(vget_low_s8(signedValues)), normalized, max, output + index);
+            StoreInt16x8(vmovl_s8(vget_high_s8(signedValues)), normalized, max,
+                         output + index + 8);
+        }
+        else
+        {
+            StoreUint16x8(vmovl_u8(vget_low_u8(values)), normalized, max, output + index);
+            StoreUint16x8(vmovl_u8(vget_high_u8(values)), normalized, max, output + index + 8);
+        }
+    }
+    return index;
+}
+
+size_t CopyFixedToFloatSIMD(const uint8_t *input, size_t valueCount, float *output)
+{
+    size_t index = 0;
+    for (; index + 4 <= valueCount; index += 4)
+    {
+        const int32x4_t values = vreinterpretq_s32_u8(vld1q_u8(input + index * 4));
+        vst1q_f32(output + index, vmulq_n_f32(vcvtq_f32_s32(values), 1.0f / (1 << 16)));
+    }
+    return index;
+}
+#endif  // defined(ANGLE_COPYVERTEX_SSE2)
+}  // anonymous namespace
+
+#if defined(ANGLE_COPYVERTEX_SSE2) || defined(ANGLE_COPYVERTEX_NEON)
+template <>
+bool CopyPackedToFloat<GLbyte>(const uint8_t *input,
+                               size_t valueCount,
+                               bool normalized,
+                               float *output)
+{
+    const size_t first = Copy8BitToFloatSIMD<true>(input, valueCount, normalized, output);
+    CopyRemainingToFloat<GLbyte>(input, first, valueCount, normalized, output);
+    return true;
+}
+
+template <>
+bool CopyPackedToFloat<GLubyte>(const uint8_t *input,
+                                size_t valueCount,
+                                bool normalized,
+                                float *output)
+{
+    const size_t first = Copy8BitToFloatSIMD<false>(input, valueCount, normalized, output);
+    CopyRemainingToFloat<GLubyte>(input, first, valueCount, normalized, output);
+    return true;
+}
+
+template <>
+bool CopyPackedToFloat<GLshort>(const uint8_t *input,
+                                size_t valueCount,
+                                bool normalized,
+                                float *output)
+{
+    const size_t first = Copy16BitToFloatSIMD<true>(input, valueCount, normalized, output);
+    CopyRemainingToFloat<GLshort>(input, first, valueCount, normalized, output);
+    return true;
+}
+
+template <>
+bool CopyPackedToFloat<GLushort>(const uint8_t *input,
+                                 size_t valueCount,
+                                 bool normalized,
+                                 float *output)
+{
+    const size_t first = Copy16BitToFloatSIMD<false>(input, valueCount, normalized, output);
+    CopyRemainingToFloat<GLushort>(input, first, valueCount, normalized, output);
+    return true;
+}
+
+bool CopyPackedFixedToFloat(const uint8_t *input, size_t valueCount, float *output)
+{
+    size_t index = CopyFixedToFloatSIMD(input, valueCount, output);
+    for (; index < valueCount; ++index)
+    {
+        GLfixed value;
+        memcpy(&value, input + index * sizeof(GLfixed), sizeof(GLfixed));
+        output[index] = static_cast<float>(value) * (1.0f / (1 << 16));
+    }
+    return true;
+}
+#else
+template <>
+bool CopyPackedToFloat<GLbyte>(const uint8_t *input,
+                               size_t valueCount,
+                               bool normalized,
+                               float *output)
+{
+    return false;
+}
+
+template <>
+bool CopyPackedToFloat<GLubyte>(const uint8_t *input,
+                                size_t valueCount,
+                                bool normalized,
+                                float *output)
+{
+    return false;
+}
+
+template <>
+bool CopyPackedToFloat<GLshort>(const uint8_t *input,
+                                size_t valueCount,
+                                bool normalized,
+                                float *output)
+{
+    return false;
+}
+
+template <>
+bool CopyPackedToFloat<GLushort>(const uint8_t *input,
+                                 size_t valueCount,
+                                 bool normalized,
+                                 float *output)
+{
+    return false;
+}
+
+bool CopyPackedFixedToFloat(const uint8_t *input, size_t valueCount, float *output)
+{
+    return false;
+}
+#endif  // defined(ANGLE_COPYVERTEX_SSE2) || defined(ANGLE_COPYVERTEX_NEON)
+}  // namespace priv
+}  // namespace rx
@@ -9,8 +9,14 @@
 #ifndef LIBANGLE_RENDERER_COPYVERTEX_H_
 #define LIBANGLE_RENDERER_COPYVERTEX_H_
 
+#include "angle_gl.h"
 #include "common/mathutil.h"
 
+namespace angle
+{
+class WorkerThreadPool;
+}  // namespace angle
+
 namespace rx
 {
 
@@ -19,6 +25,55 @@ using VertexCopyFunction = void (*)(const uint8_t *input,
                                     size_t count,
                                     uint8_t *output);
 
+// Conversions that produce less than this are not worth splitting across threads.
+constexpr size_t kMinParallelVertexConversionBytes = 1024 * 1024;
+// The amount of converted data produced by each job of a parallel conversion.
+constexpr size_t kVertexConversionJobBytes = 256 * 1024;
+
+// Converts |vertexCount| vertices with |copyFunction|.  Conversions of at least
+// kMinParallelVertexConversionBytes are split in runs of vertices that are converted in parallel
+// if |workerPool| is asynchronous.  |workerPool| may be null.
+void ConvertVertexData(angle::WorkerThreadPool *workerPool,
+                       VertexCopyFunction copyFunction,
+                       const uint8_t *input,
+                       size_t inputStride,
+                       size_t vertexCount,
+                       uint8_t *output,
+                       size_t outputStride);
+
+namespace priv
+{
+// Converts |valueCount| tightly packed values to floats with vector instructions.  Return false if
+// the CPU has no vector kernel for the type, in which case the caller converts the values.
+template <typename T>
+bool CopyPackedToFloat(const uint8_t *input, size_t valueCount, bool normalized, float *output)
+{
+    return false;
+}
+template <>
+bool CopyPackedToFloat<GLbyte>(const uint8_t *input,
+                               size_t valueCount,
+                               bool normalized,
+                               float *output);
+template <>
+bool CopyPackedToFloat<GLubyte>(const uint8_t *input,
+                                size_t valueCount,
+                                bool normalized,
+                                float *output);
+template <>
+bool CopyPackedToFloat<GLshort>(const uint8_t *input,
+                                size_t valueCount,
+                                bool normalized,
+                                float *output);
+template <>
+bool CopyPackedToFloat<GLushort>(const uint8_t *input,
+                                 size_t valueCount,
+                                 bool normalized,
+                                 float *output);
+
+bool CopyPackedFixedToFloat(const uint8_t *input, size_t valueCount, float *output);
+}  // namespace priv
+
 // 'alphaDefaultValueBits' gives the default value for the alpha channel (4th component)
 template <typename T,
           size_t inputComponentCount,
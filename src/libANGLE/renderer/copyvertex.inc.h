@@ -193,6 +193,14 @@ inline void Copy32FixedTo32FVertexData(const uint8_t *input,
 {
     static const float divisor = 1.0f / (1 << 16);
 
+    if (inputComponentCount == outputComponentCount &&
+        stride == sizeof(GLfixed) * inputComponentCount &&
+        priv::CopyPackedFixedToFloat(input, count * inputComponentCount,
+                                     reinterpret_cast<float *>(output)))
+    {
+        return;
+    }
+
     for (size_t i = 0; i < count; i++)
     {
         const uint8_t *offsetInput = input + i * stride;
@@ -242,6 +250,15 @@ inline void CopyToFloatVertexData(const uint8_t *input,
     typedef std::numeric_limits<T> NL;
     typedef typename std::conditional<toHalf, GLhalf, float>::type outputType;
 
+    // Tightly packed data without padding is converted as one array of values.
+    if (!toHalf && inputComponentCount == outputComponentCount &&
+        stride == sizeof(T) * inputComponentCount &&
+        priv::CopyPackedToFloat<T>(input, count * inputComponentCount, normalized,
+                                   reinterpret_cast<float *>(output)))
+    {
+        return;
+    }
+
     for (size_t i = 0; i < count; i++)
     {
         const T *offsetInput = reinterpret_cast<const T *>(input + (stride * i));
@@ -0,0 +1,203 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// copyvertex_unittest:
+//   Tests that the vector kernels and the parallel path of the vertex conversion functions produce
+//   the same results as the scalar path.
+//
+
+#include <gtest/gtest.h>
+
+#include <string.h>
+
+#include <array>
+#include <vector>
+
+#include "common/WorkerThread.h"
+#include "libANGLE/renderer/copyvertex.h"
+
+namespace rx
+{
+namespace
+{
+// Vertex counts around the vector widths, so that every kernel has a tail of every length.
+constexpr size_t kVertexCounts[] = {1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 33, 257};
+
+// Extra bytes after each vertex, which make the conversion functions take the scalar path.
+constexpr size_t kPadding = 4;
+
+// Returns |size| bytes that start with the extreme values of every type.
+std::vector<uint8_t> MakeInput(size_t size)
+{
+    const uint8_t kExtremes[] = {0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF,
+                                 0x00, 0x80, 0xFF, 0x7F, 0x01, 0x00, 0x00, 0x01};
+
+    std::vector<uint8_t> input(size);
+    uint32_t state = 0x12345678u;
+    for (size_t i = 0; i < size; ++i)
+    {
+        state    = state * 1664525u + 1013904223u;
+        input[i] = i < sizeof(kExtremes) ? kExtremes[i] : static_cast<uint8_t>(state >> 24);
+    }
+    return input;
+}
+
+// Copies tightly packed vertices to a buffer with |kPadding| bytes after each vertex.
+std::vector<uint8_t> PadVertices(const std::vector<uint8_t> &packed,
+                                 size_t vertexSize,
+                                 size_t vertexCount)
+{
+    std::vector<uint8_t> padded((vertexSize + kPadding) * vertexCount, 0);
+    for (size_t vertex = 0; vertex < vertexCount; ++vertex)
+    {
+        memcpy(padded.data() + vertex * (vertexSize + kPadding),
+               packed.data() + vertex * vertexSize, vertexSize);
+    }
+    return padded;
+}
+
+// Converts tightly packed vertices with |copyFunction|, which takes the vector path if there is
+// one, and converts the same vertices again with padding, which takes the scalar path.  The input
+// starts one byte into its allocation so the vector loads are unaligned.
+void CheckPackedMatchesScalar(VertexCopyFunction copyFunction,
+                              size_t inputVertexSize,
+                              size_t outputVertexSize)
+{
+    for (size_t vertexCount : kVertexCounts)
+    {
+        const std::vector<uint8_t> packed = MakeInput(inputVertexSize * vertexCount);
+        const std::vector<uint8_t> padded = PadVertices(packed, inputVertexSize, vertexCount);
+
+        std::vector<uint8_t> unalignedPacked(packed.size() + 1);
+        memcpy(unalignedPacked.data() + 1, packed.data(), packed.size());
+
+        std::vector<uint8_t> vectorOutput(outputVertexSize * vertexCount + 1, 0xCD);
+        std::vector<uint8_t> scalarOutput(outputVertexSize * vertexCount + 1, 0xCD);
+        copyFunction(unalignedPacked.data() + 1, inputVertexSize, vertexCount,
+                     vectorOutput.data());
+        copyFunction(padded.data(), inputVertexSize + kPadding, vertexCount, scalarOutput.data());
+
+        // Compare the bits, as the vector kernels are expected to round like the scalar path.
+        EXPECT_EQ(scalarOutput, vectorOutput) << "vertex count: " << vertexCount;
+        EXPECT_EQ(0xCD, vectorOutput.back()) << "vertex count: " << vertexCount;
+    }
+}
+
+template <typename T, size_t componentCount, bool normalized>
+void CheckToFloat()
+{
+    CheckPackedMatchesScalar(
+        CopyToFloatVertexData<T, componentCount, componentCount, normalized, false>,
+        sizeof(T) * componentCount, sizeof(float) * componentCount);
+}
+
+template <typename T, bool normalized>
+void CheckToFloatAllComponentCounts()
+{
+    CheckToFloat<T, 1, normalized>();
+    CheckToFloat<T, 2, normalized>();
+    CheckToFloat<T, 3, normalized>();
+    CheckToFloat<T, 4, normalized>();
+}
+
+template <size_t componentCount>
+void CheckFixedToFloat()
+{
+    CheckPackedMatchesScalar(Copy32FixedTo32FVertexData<componentCount, componentCount>,
+                             sizeof(GLfixed) * componentCount, sizeof(float) * componentCount);
+}
+
+// Tests the conversion of bytes to floats.
+TEST(CopyVertexTest, ByteToFloat)
+{
+    CheckToFloatAllComponentCounts<GLbyte, false>();
+    CheckToFloatAllComponentCounts<GLbyte, true>();
+}
+
+// Tests the conversion of unsigned bytes to floats.
+TEST(CopyVertexTest, UnsignedByteToFloat)
+{
+    CheckToFloatAllComponentCounts<GLubyte, false>();
+    CheckToFloatAllComponentCounts<GLubyte, true>();
+}
+
+// Tests the conversion of shorts to floats.
+TEST(CopyVertexTest, ShortToFloat)
+{
+    CheckToFloatAllComponentCounts<GLshort, false>();
+    CheckToFloatAllComponentCounts<GLshort, true>();
+}
+
+// Tests the conversion of unsigned shorts to floats.
+TEST(CopyVertexTest, UnsignedShortToFloat)
+{
+    CheckToFloatAllComponentCounts<GLushort, false>();
+    CheckToFloatAllComponentCounts<GLushort, true>();
+}
+
+// Tests the conversion of fixed-point values to floats.
+TEST(CopyVertexTest, FixedToFloat)
+{
+    CheckFixedToFloat<1>();
+    CheckFixedToFloat<2>();
+    CheckFixedToFloat<3>();
+    CheckFixedToFloat<4>();
+}
+
+// Tests that conversions large enough to be split across threads produce the same result as a
+// single conversion, including the last job that has fewer vertices than the others.
+TEST(CopyVertexTest, ParallelConversion)
+{
+    constexpr size_t kComponentCount   = 3;
+    constexpr size_t kInputStride      = sizeof(GLshort) * kComponentCount;
+    constexpr size_t kOutputVertexSize = sizeof(float) * kComponentCount;
+    constexpr VertexCopyFunction kCopyFunction =
+        CopyToFloatVertexData<GLshort, kComponentCount, kComponentCount, true, false>;
+
+    // A bit more than twice the threshold, which isn't a multiple of the job size.
+    const size_t vertexCount = 2 * kMinParallelVertexConversionBytes / kOutputVertexSize + 1001;
+    ASSERT_NE(0u, (vertexCount * kOutputVertexSize) % kVertexConversionJobBytes);
+
+    const std::vector<uint8_t> input = MakeInput(kInputStride * vertexCount);
+    std::vector<uint8_t> expected(kOutputVertexSize * vertexCount);
+    kCopyFunction(input.data(), kInputStride, vertexCount, expected.data());
+
+    std::array<std::shared_ptr<angle::WorkerThreadPool>, 3> pools = {
+        {nullptr, angle::WorkerThreadPool::Create(1, ANGLEPlatformCurrent()),
+         angle::WorkerThreadPool::Create(0, ANGLEPlatformCurrent())}};
+    for (std::shared_ptr<angle::WorkerThreadPool> &pool : pools)
+    {
+        std::vector<uint8_t> output(expected.size() + 1, 0xCD);
+        ConvertVertexData(pool.get(), kCopyFunction, input.data(), kInputStride, vertexCount,
+                          output.data(), kOutputVertexSize);
+        EXPECT_TRUE(memcmp(expected.data(), output.data(), expected.size()) == 0);
+        EXPECT_EQ(0xCD, output.back());
+    }
+}
+
+// Tests that conversions below the threshold are done in one call.
+TEST(CopyVertexTest, SmallConversionIsNotSplit)
+{
+    constexpr size_t kVertexCount = kMinParallelVertexConversionBytes / sizeof(float) - 1;
+
+    static size_t sCallCount        = 0;
+    VertexCopyFunction countingCopy = [](const uint8_t *input, size_t stride, size_t count,
+                                         uint8_t *output) {
+        sCallCount++;
+        CopyToFloatVertexData<GLubyte, 1, 1, false, false>(input, stride, count, output);
+    };
+
+    const std::vector<uint8_t> input = MakeInput(kVertexCount);
+    std::vector<uint8_t> output(sizeof(float) * kVertexCount);
+    std::shared_ptr<angle::WorkerThreadPool> pool =
+        angle::WorkerThreadPool::Create(0, ANGLEPlatformCurrent());
+
+    sCallCount = 0;
+    ConvertVertexData(pool.get(), countingCopy, input.data(), 1, kVertexCount, output.data(),
+                      sizeof(float));
+    EXPECT_EQ(1u, sCallCount);
+}
+}  // anonymous namespace
+}  // namespace rx
@@ -133,6 +133,37 @@ VkMemoryPropertyFlags GetStorageMemoryType(vk::Renderer *renderer,
     return hasMapAccess ? kHostCachedFlags : kDeviceLocalFlags;
 }
 
+// Adds |range| to |ranges|, which are sorted and neither overlap nor touch each other, merging it
+// with the ranges it overlaps or touches.  Returns the number of bytes that weren't covered yet.
+VkDeviceSize AddCoalescedRange(std::vector<RangeDeviceSize> *ranges, const RangeDeviceSize &range)
+{
+    if (range.empty())
+    {
+        return 0;
+    }
+
+    // Find the first range that doesn't end before |range| starts.
+    auto first = std::lower_bound(
+        ranges->begin(), ranges->end(), range.low(),
+        [](const RangeDeviceSize &other, VkDeviceSize low) { return other.high() < low; });
+
+    RangeDeviceSize merged     = range;
+    VkDeviceSize coveredLength = 0;
+    auto last                  = first;
+    for (; last != ranges->end() && last->low() <= range.high(); ++last)
+    {
+        const VkDeviceSize overlapLow  = std::max(last->low(), range.low());
+        const VkDeviceSize overlapHigh = std::min(last->high(), range.high());
+        coveredLength += overlapHigh > overlapLow ? overlapHigh - overlapLow : 0;
+        merged.merge(*last);
+    }
+
+    first = ranges->erase(first, last);
+    ranges->insert(first, merged);
+
+    return range.length() - coveredLength;
+}
+
 bool ShouldAllocateNewMemoryForUpdate(ContextVk *contextVk, size_t subDataSize, size_t bufferSize)
 {
     // A sub-data update with size > 50% of buffer size meets the threshold to acquire a new
@@ -376,7 +407,9 @@ BufferVk::BufferVk(const gl::BufferState &state)
       mIsStagingBufferMapped(false),
       mHasValidData(false),
       mIsMappedForWrite(false),
-      mUsageType(BufferUsageType::Static)
+      mUsageType(BufferUsageType::Static),
+      mGhostedBufferMapPtr(nullptr),
+      mGhostedBufferRenderer(nullptr)
 {
     mMappedRange.invalidate();
 }
@@ -402,6 +435,7 @@ void BufferVk::releaseConversionBuffers(vk::Renderer *renderer)
 angle::Result BufferVk::release(ContextVk *contextVk)
 {
     vk::Renderer *renderer = contextVk->getRenderer();
+    ANGLE_TRY(discardGhostedBuffer(contextVk));
     if (mBuffer.valid())
     {
         ANGLE_TRY(contextVk->releaseBufferAllocation(&mBuffer));
@@ -514,6 +548,7 @@ angle::Result BufferVk::setDataWithMemoryType(const gl::Context *context,
     // passed in data to fill the buffer, the flag will be updated when the data is copied to the
     // buffer.
     mHasValidData = false;
+    ANGLE_TRY(discardGhostedBuffer(contextVk));
 
     if (size == 0)
     {
@@ -728,8 +763,6 @@ angle::Result BufferVk::ghostMappedBuffer(ContextVk *contextVk,
     ANGLE_TRY(acquireBufferHelper(contextVk, static_cast<size_t>(mState.getSize()),
                                   BufferUsageType::Dynamic));
 
-    // Before returning the new buffer, map the previous buffer and copy its entire
-    // contents into the new buffer.
     uint8_t *srcMapPtr = nullptr;
     uint8_t *dstMapPtr = nullptr;
     ANGLE_TRY(src.map(contextVk, &srcMapPtr));
@@ -738,27 +771,14 @@ angle::Result BufferVk::ghostMappedBuffer(ContextVk *contextVk,
     ASSERT(src.isCoherent());
     ASSERT(mBuffer.isCoherent());
 
-    // No need to copy over [offset, offset + length), just around it
-    if ((access & GL_MAP_INVALIDATE_RANGE_BIT) != 0)
-    {
-        if (offset != 0)
-        {
-            memcpy(dstMapPtr, srcMapPtr, static_cast<size_t>(offset));
-        }
-        size_t totalSize      = static_cast<size_t>(mState.getSize());
-        size_t remainingStart = static_cast<size_t>(offset + length);
-        size_t remainingSize  = totalSize - remainingStart;
-        if (remainingSize != 0)
-        {
-            memcpy(dstMapPtr + remainingStart, srcMapPtr + remainingStart, remainingSize);
-        }
-    }
-    else
+    // Only the mapped range is needed right away, and not even that if it's invalidated.  The
+    // rest is carried over once the buffer is used, unless it's overwritten before then.
+    if ((access & GL_MAP_INVALIDATE_RANGE_BIT) == 0)
     {
-        memcpy(dstMapPtr, srcMapPtr, static_cast<size_t>(mState.getSize()));
+        memcpy(dstMapPtr + offset, srcMapPtr + offset, static_cast<size_t>(length));
     }
-
-    ANGLE_TRY(contextVk->releaseBufferAllocation(&src));
+    setGhostedBuffer(contextVk, std::move(src), srcMapPtr,
+                     RangeDeviceSize(offset, offset + length));
 
     // Return the already mapped pointer with the offset adjustment to avoid the call to unmap().
     *mapPtr = dstMapPtr + offset;
@@ -775,6 +795,25 @@ angle::Result BufferVk::mapRangeImpl(ContextVk *contextVk,
     vk::Renderer *renderer = contextVk->getRenderer();
     ASSERT(mBuffer.valid());
 
+    if (mGhostedBufferMapPtr != nullptr)
+    {
+        // A write-only map that invalidates the range overwrites it.  Otherwise, the contents
+        // must be valid before the buffer is mapped.
+        const bool invalidateBuffer = (access & GL_MAP_INVALIDATE_BUFFER_BIT) != 0;
+        const bool invalidateRange  = (access & GL_MAP_INVALIDATE_RANGE_BIT) != 0;
+        if ((access & GL_MAP_READ_BIT) == 0 && (invalidateBuffer || invalidateRange))
+        {
+            onGhostedBufferRangeOverwritten(
+                contextVk, invalidateBuffer
+                               ? RangeDeviceSize(0, static_cast<VkDeviceSize>(mState.getSize()))
+                               : RangeDeviceSize(offset, offset + length));
+        }
+        else
+        {
+            carryOverGhostedBufferContents();
+        }
+    }
+
     // Record map call parameters in case this call is from angle internal (the access/offset/length
     // will be inconsistent from mState).
     mIsMappedForWrite = (access & GL_MAP_WRITE_BIT) != 0;
@@ -972,6 +1011,11 @@ angle::Result BufferVk::updateBuffer(ContextVk *contextVk,
                                      size_t updateSize,
                                      size_t updateOffset)
 {
+    if (dataSource.data != nullptr)
+    {
+        contextVk->getPerfCounters().bufferBytesUploaded += updateSize;
+    }
+
     // To copy on the CPU, destination must be host-visible.  The source should also be either a CPU
     // pointer or other a host-visible buffer that is not being written to by the GPU.
     const bool shouldCopyOnCPU =
@@ -1136,6 +1180,18 @@ angle::Result BufferVk::acquireAndUpdate(ContextVk *contextVk,
     ANGLE_TRY(acquireBufferHelper(contextVk, bufferSize, BufferUsageType::Dynamic));
     ANGLE_TRY(updateBuffer(contextVk, bufferSize, dataSource, updateSize, updateOffset));
 
+    // If the copy would be done on the CPU, defer it until the new buffer is used.  Apps that
+    // stream data with many updates per frame would otherwise copy bytes they overwrite next.
+    if (prevMapPtrBeforeSubData != nullptr && dataSource.data != nullptr &&
+        prevBuffer.isCoherent() && mBuffer.isHostVisible() && mBuffer.isCoherent())
+    {
+        uint8_t *mapPointer = nullptr;
+        ANGLE_TRY(mBuffer.map(contextVk, &mapPointer));
+        setGhostedBuffer(contextVk, std::move(prevBuffer), prevMapPtrBeforeSubData,
+                         RangeDeviceSize(updateOffset, offsetAfterSubdata));
+        return angle::Result::Continue;
+    }
+
     constexpr int kMaxCopyRegions = 2;
     angle::FixedVector<VkBufferCopy, kMaxCopyRegions> copyRegions;
 
@@ -1192,6 +1248,25 @@ angle::Result BufferVk::setDataImpl(ContextVk *contextVk,
                                     size_t updateOffset,
                                     BufferUpdateType updateType)
 {
+    // If the buffer replaced a ghosted one that still has contents to carry over, it hasn't been
+    // used yet.  CPU updates are written directly, and only what they don't overwrite will be
+    // copied.
+    if (mGhostedBufferMapPtr != nullptr)
+    {
+        ASSERT(!isCurrentlyInUse(contextVk->getRenderer()));
+        if (dataSource.data != nullptr)
+        {
+            const RangeDeviceSize updateRange(updateOffset, updateOffset + updateSize);
+            contextVk->getPerfCounters().bufferBytesUploaded += updateSize;
+            ANGLE_TRY(directUpdate(contextVk, dataSource, updateSize, updateOffset));
+            onGhostedBufferRangeOverwritten(contextVk, updateRange);
+            dataRangeUpdated(updateRange);
+            return angle::Result::Continue;
+        }
+
+        carryOverGhostedBufferContents();
+    }
+
     // if the buffer is currently in use
     //     if it isn't an external buffer and not a self-copy and sub data size meets threshold
     //          acquire a new BufferHelper from the pool
@@ -1314,6 +1389,9 @@ angle::Result BufferVk::acquireBufferHelper(ContextVk *contextVk,
     size_t size            = roundUpPow2(sizeInBytes, kBufferSizeGranularity);
     size_t alignment       = renderer->getDefaultBufferAlignment();
 
+    // The contents of a ghosted buffer would be lost.
+    ASSERT(mGhostedBufferMapPtr == nullptr);
+
     if (mBuffer.valid())
     {
         ANGLE_TRY(contextVk->releaseBufferAllocation(&mBuffer));
@@ -1332,6 +1410,71 @@ angle::Result BufferVk::acquireBufferHelper(ContextVk *contextVk,
     return angle::Result::Continue;
 }
 
+void BufferVk::setGhostedBuffer(ContextVk *contextVk,
+                                vk::BufferHelper &&ghostedBuffer,
+                                uint8_t *ghostedBufferMapPtr,
+                                const RangeDeviceSize &overwrittenRange)
+{
+    ASSERT(mGhostedBufferMapPtr == nullptr && !mGhostedBuffer.valid());
+    ASSERT(mBuffer.isMapped() && mBuffer.isCoherent());
+    ASSERT(ghostedBuffer.isCoherent());
+
+    mGhostedBuffer                  = std::move(ghostedBuffer);
+    mGhostedBufferMapPtr            = ghostedBufferMapPtr;
+    mGhostedBufferRenderer          = contextVk->getRenderer();
+    mGhostedBufferOverwrittenRanges = {overwrittenRange};
+}
+
+void BufferVk::onGhostedBufferRangeOverwritten(ContextVk *contextVk, const RangeDeviceSize &range)
+{
+    ASSERT(mGhostedBufferMapPtr != nullptr);
+    contextVk->getPerfCounters().ghostedBufferBytesSkipped +=
+        AddCoalescedRange(&mGhostedBufferOverwrittenRanges, range);
+}
+
+void BufferVk::carryOverGhostedBufferContents()
+{
+    ASSERT(mGhostedBufferMapPtr != nullptr);
+    ASSERT(mBuffer.isMapped());
+
+    uint8_t *dstMapPtr      = mBuffer.getMappedMemory();
+    const VkDeviceSize size = static_cast<VkDeviceSize>(mState.getSize());
+
+    // Copy the gaps between the overwritten ranges.
+    VkDeviceSize copyOffset = 0;
+    for (const RangeDeviceSize &overwritten : mGhostedBufferOverwrittenRanges)
+    {
+        if (overwritten.low() > copyOffset)
+        {
+            memcpy(dstMapPtr + copyOffset, mGhostedBufferMapPtr + copyOffset,
+                   static_cast<size_t>(overwritten.low() - copyOffset));
+        }
+        copyOffset = std::max(copyOffset, overwritten.high());
+    }
+    if (size > copyOffset)
+    {
+        memcpy(dstMapPtr + copyOffset, mGhostedBufferMapPtr + copyOffset,
+               static_cast<size_t>(size - copyOffset));
+    }
+
+    mGhostedBuffer.releaseBufferAndDescriptorSetCache(mGhostedBufferRenderer);
+    mGhostedBufferMapPtr   = nullptr;
+    mGhostedBufferRenderer = nullptr;
+    mGhostedBufferOverwrittenRanges.clear();
+}
+
+angle::Result BufferVk::discardGhostedBuffer(ContextVk *contextVk)
+{
+    if (mGhostedBuffer.valid())
+    {
+        ANGLE_TRY(contextVk->releaseBufferAllocation(&mGhostedBuffer));
+    }
+    mGhostedBufferMapPtr   = nullptr;
+    mGhostedBufferRenderer = nullptr;
+    mGhostedBufferOverwrittenRanges.clear();
+    return angle::Result::Continue;
+}
+
 bool BufferVk::isCurrentlyInUse(vk::Renderer *renderer) const
 {
     return !renderer->hasResourceUseFinished(mBuffer.getResourceUse());
@@ -203,6 +203,12 @@ class BufferVk : public BufferImpl
     vk::BufferHelper &getBuffer()
     {
         ASSERT(isBufferValid());
+        // The buffer is about to be used, so the contents of the buffer it replaced must be
+        // carried over.
+        if (ANGLE_UNLIKELY(mGhostedBufferMapPtr != nullptr))
+        {
+            carryOverGhostedBufferContents();
+        }
         return mBuffer;
     }
 
@@ -295,6 +301,14 @@ class BufferVk : public BufferImpl
 
     void releaseConversionBuffers(vk::Renderer *renderer);
 
+    void setGhostedBuffer(ContextVk *contextVk,
+                          vk::BufferHelper &&ghostedBuffer,
+                          uint8_t *ghostedBufferMapPtr,
+                          const RangeDeviceSize &overwrittenRange);
+    void onGhostedBufferRangeOverwritten(ContextVk *contextVk, const RangeDeviceSize &range);
+    void carryOverGhostedBufferContents();
+    angle::Result discardGhostedBuffer(ContextVk *contextVk);
+
     vk::BufferHelper mBuffer;
 
     // If not null, this is the external memory pointer passed from client API.
@@ -327,6 +341,16 @@ class BufferVk : public BufferImpl
     // Similar as mIsMappedForWrite, this maybe different from mState's getMapOffset/getMapLength if
     // mapped from angle internal.
     RangeDeviceSize mMappedRange;
+
+    // When a buffer that the GPU is reading is replaced by a new one for a partial update, the
+    // rest of its contents is carried over lazily, right before the new buffer is used.  Until
+    // then, the ranges of |mBuffer| that are overwritten are tracked, sorted and coalesced, so that
+    // only the bytes that are still needed are copied.  This is only done when both buffers are
+    // host-coherent, so the copy needs neither a context nor a flush.
+    vk::BufferHelper mGhostedBuffer;
+    uint8_t *mGhostedBufferMapPtr;
+    vk::Renderer *mGhostedBufferRenderer;
+    std::vector<RangeDeviceSize> mGhostedBufferOverwrittenRanges;
 };
 
 }  // namespace rx
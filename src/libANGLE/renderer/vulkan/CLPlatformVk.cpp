@@ -286,6 +286,11 @@ bool CLPlatformVk::getBlob(const angle::BlobCacheKey &key, angle::BlobCacheValue
     return result;
 }
 
+angle::BlobCompressionCodec CLPlatformVk::getBlobCompressionCodec() const
+{
+    return angle::BlobCompressionCodec::Gzip;
+}
+
 std::shared_ptr<angle::WaitableEvent> CLPlatformVk::postMultiThreadWorkerTask(
     const std::shared_ptr<angle::Closure> &task)
 {
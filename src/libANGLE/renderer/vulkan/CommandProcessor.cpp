@@ -712,7 +712,13 @@ angle::Result CommandProcessor::processTasksImpl(bool *exitThread)
             {
                 ANGLE_TRY(mCommandQueue->retireFinishedCommands(this));
             }
-            mRenderer->cleanupGarbage();
+
+            // Destroy garbage in budgeted passes so that a burst of garbage (e.g. after a scene
+            // transition) neither holds the garbage list locks for long nor delays pending tasks.
+            if (!mRenderer->cleanupGarbageWithinBudget())
+            {
+                mNeedCommandsAndGarbageCleanup = true;
+            }
         }
     }
     *exitThread = true;
@@ -1192,10 +1198,25 @@ angle::Result CommandQueue::postSubmitCheck(Context *context)
         while (suballocationGarbageSize > kMaxBufferSuballocationGarbageSize &&
                mInFlightCommands.size() > 1)
         {
-            ANGLE_TRY(
-                finishOneCommandBatchAndCleanupImpl(context, renderer->getMaxFenceWaitTimeNs()));
+            ANGLE_TRY(finishOneCommandBatchLocked(context, renderer->getMaxFenceWaitTimeNs()));
+            // Only the suballocations need to be destroyed for the throttling. If enabled, the rest
+            // of the garbage is left to the async garbage cleanup.
+            if (renderer->isAsyncCommandBufferResetAndGarbageCleanupEnabled())
+            {
+                renderer->cleanupSuballocationGarbage();
+            }
+            else
+            {
+                renderer->cleanupGarbage();
+            }
             suballocationGarbageSize = renderer->getSuballocationGarbageSize();
         }
+        lock.unlock();
+
+        if (renderer->isAsyncCommandBufferResetAndGarbageCleanupEnabled())
+        {
+            renderer->requestAsyncCommandsAndGarbageCleanup(context);
+        }
     }
 
     if (kOutputVmaStatsString)
@@ -1658,6 +1679,14 @@ angle::Result CommandQueue::finishOneCommandBatchAndCleanup(Context *context,
 }
 
 angle::Result CommandQueue::finishOneCommandBatchAndCleanupImpl(Context *context, uint64_t timeout)
+{
+    ANGLE_TRY(finishOneCommandBatchLocked(context, timeout));
+    context->getRenderer()->cleanupGarbage();
+
+    return angle::Result::Continue;
+}
+
+angle::Result CommandQueue::finishOneCommandBatchLocked(Context *context, uint64_t timeout)
 {
     ASSERT(!mInFlightCommands.empty());
     CommandBatch &batch = mInFlightCommands.front();
@@ -1678,7 +1707,6 @@ angle::Result CommandQueue::finishOneCommandBatchAndCleanupImpl(Context *context
 
     // Immediately clean up finished batches.
     ANGLE_TRY(retireFinishedCommandsLocked(context));
-    context->getRenderer()->cleanupGarbage();
 
     return angle::Result::Continue;
 }
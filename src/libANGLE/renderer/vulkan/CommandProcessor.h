@@ -509,6 +509,8 @@ class CommandQueue : angle::NonCopyable
     angle::Result checkOneCommandBatch(Context *context, bool *finished);
     // Similar to checkOneCommandBatch, except we will wait for it to finish
     angle::Result finishOneCommandBatchAndCleanupImpl(Context *context, uint64_t timeout);
+    // Same as finishOneCommandBatchAndCleanupImpl, but leaves the garbage to the caller.
+    angle::Result finishOneCommandBatchLocked(Context *context, uint64_t timeout);
     // Walk mFinishedCommands, reset and recycle all command buffers.
     angle::Result retireFinishedCommandsLocked(Context *context);
     // Walk mInFlightCommands, check and update mLastCompletedSerials for all commands that are
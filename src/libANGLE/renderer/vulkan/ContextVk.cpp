@@ -15,6 +15,7 @@
 #include "common/utilities.h"
 #include "image_util/loadimage.h"
 #include "libANGLE/Context.h"
+#include "libANGLE/Context.inl.h"
 #include "libANGLE/Display.h"
 #include "libANGLE/Program.h"
 #include "libANGLE/Semaphore.h"
@@ -43,6 +44,7 @@
 #include "libANGLE/renderer/vulkan/VertexArrayVk.h"
 #include "libANGLE/renderer/vulkan/vk_renderer.h"
 
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 #include <sstream>
@@ -169,6 +171,7 @@ constexpr gl::ShaderMap<vk::ImageLayout> kShaderWriteImageLayouts = {
 
 constexpr VkBufferUsageFlags kVertexBufferUsage = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT;
 constexpr size_t kDynamicVertexDataSize         = 16 * 1024;
+constexpr size_t kDynamicIndirectDataSize       = 16 * 1024;
 
 bool CanMultiDrawIndirectUseCmd(ContextVk *contextVk,
                                 VertexArrayVk *vertexArray,
@@ -194,6 +197,87 @@ bool CanMultiDrawIndirectUseCmd(ContextVk *contextVk,
     return canMultiDrawIndirectUseCmd;
 }
 
+// Whether all |count| values are the same.  A null array stands for values that are all zero.
+template <typename T>
+bool AllValuesEqual(const T *values, GLsizei count)
+{
+    return values == nullptr || std::all_of(values + 1, values + count,
+                                            [values](T value) { return value == values[0]; });
+}
+
+// Whether the draws of a multi-draw call can be recorded as a single indirect draw, which is the
+// case unless the generic implementation is needed to set uniforms or emulate state per draw.
+bool CanBatchMultiDraw(ContextVk *contextVk,
+                       const gl::Context *context,
+                       VertexArrayVk *vertexArray,
+                       gl::PrimitiveMode mode,
+                       GLsizei drawcount,
+                       const GLint *baseVertices,
+                       const GLuint *baseInstances)
+{
+    // A single draw is recorded as is.
+    if (drawcount <= 1 || !CanMultiDrawIndirectUseCmd(contextVk, vertexArray, mode, drawcount, 0))
+    {
+        return false;
+    }
+
+    // gl_DrawID is emulated with a uniform, which the generic implementation sets between the
+    // draws.  With shaderDrawParameters, the translator adds the DrawIndex built-in to it, so the
+    // uniform is left at zero and each draw gets its index from the indirect command instead.
+    const gl::ProgramExecutable *executable =
+        context->getState().getLinkedProgramExecutable(context);
+    if (executable->hasDrawIDUniform() &&
+        !contextVk->getFeatures().supportsShaderDrawParameters.enabled)
+    {
+        return false;
+    }
+
+    // gl_BaseVertex and gl_BaseInstance are emulated with uniforms as well, which can only be set
+    // once for the whole call.
+    if ((executable->hasBaseVertexUniform() && !AllValuesEqual(baseVertices, drawcount)) ||
+        (executable->hasBaseInstanceUniform() && !AllValuesEqual(baseInstances, drawcount)))
+    {
+        return false;
+    }
+
+    // Transform feedback emulation offsets the captured vertices by the first vertex of each draw.
+    // VK_EXT_transform_feedback captures the vertices of indirect draws like those of any other.
+    if (contextVk->getFeatures().emulateTransformFeedback.enabled &&
+        context->getState().isTransformFeedbackActiveUnpaused())
+    {
+        return false;
+    }
+
+    // A non-zero firstInstance in an indirect command is only allowed with
+    // drawIndirectFirstInstance.
+    return baseInstances == nullptr ||
+           contextVk->getRenderer()->getEnabledFeatures().features.drawIndirectFirstInstance;
+}
+
+// Indexed draws can only be batched when they read from the element array buffer as is.
+bool CanBatchMultiDrawElements(ContextVk *contextVk,
+                               gl::DrawElementsType type,
+                               const GLvoid *const *indices,
+                               GLsizei drawcount)
+{
+    const gl::VertexArray *vertexArray = contextVk->getState().getVertexArray();
+    if (vertexArray->getElementArrayBuffer() == nullptr ||
+        contextVk->shouldConvertUint8VkIndexType(type))
+    {
+        return false;
+    }
+
+    const uintptr_t indexSizeMask = gl::GetDrawElementsTypeSize(type) - 1;
+    for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
+    {
+        if ((reinterpret_cast<uintptr_t>(indices[drawID]) & indexSizeMask) != 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 uint32_t GetCoverageSampleCount(const gl::State &glState, GLint samples)
 {
     ASSERT(glState.isSampleCoverageEnabled());
@@ -756,7 +840,8 @@ angle::Result CreateGraphicsPipelineSubset(ContextVk *contextVk,
     vk::PipelineHelper *oldPipeline = *pipelineOut;
 
     const vk::GraphicsPipelineDesc *descPtr = nullptr;
-    if (!cache->getPipeline(desc, &descPtr, pipelineOut))
+    const size_t descHash                   = desc.hash(Cache::kSubset);
+    if (!cache->getPipeline(desc, descHash, &descPtr, pipelineOut))
     {
         const vk::RenderPass unusedRenderPass;
         const vk::RenderPass *compatibleRenderPass = &unusedRenderPass;
@@ -769,7 +854,8 @@ angle::Result CreateGraphicsPipelineSubset(ContextVk *contextVk,
 
         ANGLE_TRY(cache->createPipeline(contextVk, pipelineCache, *compatibleRenderPass,
                                         unusedPipelineLayout, unusedShaders, unusedSpecConsts,
-                                        PipelineSource::Draw, desc, &descPtr, pipelineOut));
+                                        PipelineSource::Draw, desc, descHash, &descPtr,
+                                        pipelineOut));
     }
 
     if (oldPipeline)
@@ -884,6 +970,8 @@ ContextVk::ContextVk(const gl::State &state, gl::ErrorSet *errorSet, vk::Rendere
       mCurrentWindowSurface(nullptr),
       mCurrentRotationDrawFramebuffer(SurfaceRotation::Identity),
       mCurrentRotationReadFramebuffer(SurfaceRotation::Identity),
+      mGraphicsPipelineHashBaseDesc(nullptr),
+      mGraphicsPipelineHashBase(0),
       mActiveRenderPassQueries{},
       mLastIndexBufferOffset(nullptr),
       mCurrentIndexBuffer(nullptr),
@@ -899,6 +987,7 @@ ContextVk::ContextVk(const gl::State &state, gl::ErrorSet *errorSet, vk::Rendere
       mFlipViewportForDrawFramebuffer(false),
       mFlipViewportForReadFramebuffer(false),
       mIsAnyHostVisibleBufferWritten(false),
+      mHasInFlightStreamedIndirectBuffers(false),
       mCurrentQueueSerialIndex(kInvalidQueueSerialIndex),
       mOutsideRenderPassCommands(nullptr),
       mRenderPassCommands(nullptr),
@@ -1288,6 +1377,7 @@ void ContextVk::onDestroy(const gl::Context *context)
     {
         defaultBuffer.destroy(mRenderer);
     }
+    mStreamedIndirectBuffer.destroy(mRenderer);
 
     for (vk::DynamicQueryPool &queryPool : mQueryPools)
     {
@@ -1413,6 +1503,8 @@ angle::Result ContextVk::initialize(const angle::ImageLoadContext &imageLoadCont
         buffer.init(mRenderer, kVertexBufferUsage, vk::kVertexBufferAlignment,
                     kDynamicVertexDataSize, true);
     }
+    mStreamedIndirectBuffer.init(mRenderer, vk::kIndirectBufferUsageFlags,
+                                 vk::kIndirectBufferAlignment, kDynamicIndirectDataSize, true);
 
 #if ANGLE_ENABLE_VULKAN_GPU_TRACE_EVENTS
     angle::PlatformMethods *platform = ANGLEPlatformCurrent();
@@ -2126,10 +2218,18 @@ angle::Result ContextVk::createGraphicsPipeline()
 
     vk::PipelineHelper *oldGraphicsPipeline = mCurrentGraphicsPipeline;
 
+    // Rehash only the parts of the desc that have changed since the last lookup, if possible.
+    const size_t descHash =
+        mGraphicsPipelineHashBaseDesc != nullptr
+            ? mGraphicsPipelineDesc->updateHash(
+                  vk::GraphicsPipelineSubset::Complete, mGraphicsPipelineHashBase,
+                  *mGraphicsPipelineHashBaseDesc, mGraphicsPipelineHashTransition)
+            : mGraphicsPipelineDesc->hash(vk::GraphicsPipelineSubset::Complete);
+
     // Attempt to use an existing pipeline.
     const vk::GraphicsPipelineDesc *descPtr = nullptr;
     ANGLE_TRY(executableVk->getGraphicsPipeline(this, vk::GraphicsPipelineSubset::Complete,
-                                                *mGraphicsPipelineDesc, &descPtr,
+                                                *mGraphicsPipelineDesc, descHash, &descPtr,
                                                 &mCurrentGraphicsPipeline));
 
     // If no such pipeline exists:
@@ -2147,7 +2247,7 @@ angle::Result ContextVk::createGraphicsPipeline()
         {
             ANGLE_TRY(executableVk->createGraphicsPipeline(
                 this, vk::GraphicsPipelineSubset::Complete, &pipelineCache, PipelineSource::Draw,
-                *mGraphicsPipelineDesc, &descPtr, &mCurrentGraphicsPipeline));
+                *mGraphicsPipelineDesc, descHash, &descPtr, &mCurrentGraphicsPipeline));
         }
         else
         {
@@ -2179,15 +2279,17 @@ angle::Result ContextVk::createGraphicsPipeline()
                         mCurrentGraphicsPipelineShaders;
 
                     const vk::GraphicsPipelineDesc *shadersDescPtr = nullptr;
+                    const size_t shadersDescHash =
+                        mGraphicsPipelineDesc->hash(vk::GraphicsPipelineSubset::Shaders);
                     ANGLE_TRY(executableVk->getGraphicsPipeline(
                         this, vk::GraphicsPipelineSubset::Shaders, *mGraphicsPipelineDesc,
-                        &shadersDescPtr, &mCurrentGraphicsPipelineShaders));
+                        shadersDescHash, &shadersDescPtr, &mCurrentGraphicsPipelineShaders));
                     if (shadersDescPtr == nullptr)
                     {
                         ANGLE_TRY(executableVk->createGraphicsPipeline(
                             this, vk::GraphicsPipelineSubset::Shaders, &pipelineCache,
-                            PipelineSource::Draw, *mGraphicsPipelineDesc, &shadersDescPtr,
-                            &mCurrentGraphicsPipelineShaders));
+                            PipelineSource::Draw, *mGraphicsPipelineDesc, shadersDescHash,
+                            &shadersDescPtr, &mCurrentGraphicsPipelineShaders));
                     }
                     if (oldGraphicsPipelineShaders)
                     {
@@ -2232,9 +2334,9 @@ angle::Result ContextVk::createGraphicsPipeline()
 
             // Link the three subsets into one pipeline.
             ANGLE_TRY(executableVk->linkGraphicsPipelineLibraries(
-                this, &pipelineCache, *mGraphicsPipelineDesc, mCurrentGraphicsPipelineVertexInput,
-                mCurrentGraphicsPipelineShaders, mCurrentGraphicsPipelineFragmentOutput, &descPtr,
-                &mCurrentGraphicsPipeline));
+                this, &pipelineCache, *mGraphicsPipelineDesc, descHash,
+                mCurrentGraphicsPipelineVertexInput, mCurrentGraphicsPipelineShaders,
+                mCurrentGraphicsPipelineFragmentOutput, &descPtr, &mCurrentGraphicsPipeline));
 
             // Reset the transition bits for pipeline libraries, they are only made to be up-to-date
             // here.
@@ -2249,6 +2351,11 @@ angle::Result ContextVk::createGraphicsPipeline()
                                            mCurrentGraphicsPipeline);
     }
 
+    // The next lookup's hash is derived from this one.
+    mGraphicsPipelineHashBaseDesc = descPtr;
+    mGraphicsPipelineHashBase     = descHash;
+    mGraphicsPipelineHashTransition.reset();
+
     return angle::Result::Continue;
 }
 
@@ -2263,6 +2370,7 @@ angle::Result ContextVk::handleDirtyGraphicsPipelineDesc(DirtyBits::Iterator *di
     // path, |mGraphicsPipelineTransition| is reset while the partial pipelines are left stale.  A
     // future partial library recreation would need to know the bits that have changed since.
     mGraphicsPipelineLibraryTransition |= mGraphicsPipelineTransition;
+    mGraphicsPipelineHashTransition |= mGraphicsPipelineTransition;
 
     // Recreate the pipeline if necessary.
     bool shouldRecreatePipeline =
@@ -4363,6 +4471,10 @@ angle::Result ContextVk::multiDrawArrays(const gl::Context *context,
                                          const GLsizei *counts,
                                          GLsizei drawcount)
 {
+    if (CanBatchMultiDraw(this, context, getVertexArray(), mode, drawcount, nullptr, nullptr))
+    {
+        return multiDrawArraysBatched(context, mode, firsts, counts, nullptr, nullptr, drawcount);
+    }
     return rx::MultiDrawArraysGeneral(this, context, mode, firsts, counts, drawcount);
 }
 
@@ -4373,6 +4485,11 @@ angle::Result ContextVk::multiDrawArraysInstanced(const gl::Context *context,
                                                   const GLsizei *instanceCounts,
                                                   GLsizei drawcount)
 {
+    if (CanBatchMultiDraw(this, context, getVertexArray(), mode, drawcount, nullptr, nullptr))
+    {
+        return multiDrawArraysBatched(context, mode, firsts, counts, instanceCounts, nullptr,
+                                      drawcount);
+    }
     return rx::MultiDrawArraysInstancedGeneral(this, context, mode, firsts, counts, instanceCounts,
                                                drawcount);
 }
@@ -4459,6 +4576,12 @@ angle::Result ContextVk::multiDrawElements(const gl::Context *context,
                                            const GLvoid *const *indices,
                                            GLsizei drawcount)
 {
+    if (CanBatchMultiDraw(this, context, getVertexArray(), mode, drawcount, nullptr, nullptr) &&
+        CanBatchMultiDrawElements(this, type, indices, drawcount))
+    {
+        return multiDrawElementsBatched(context, mode, counts, type, indices, nullptr, nullptr,
+                                        nullptr, drawcount);
+    }
     return rx::MultiDrawElementsGeneral(this, context, mode, counts, type, indices, drawcount);
 }
 
@@ -4470,6 +4593,12 @@ angle::Result ContextVk::multiDrawElementsInstanced(const gl::Context *context,
                                                     const GLsizei *instanceCounts,
                                                     GLsizei drawcount)
 {
+    if (CanBatchMultiDraw(this, context, getVertexArray(), mode, drawcount, nullptr, nullptr) &&
+        CanBatchMultiDrawElements(this, type, indices, drawcount))
+    {
+        return multiDrawElementsBatched(context, mode, counts, type, indices, instanceCounts,
+                                        nullptr, nullptr, drawcount);
+    }
     return rx::MultiDrawElementsInstancedGeneral(this, context, mode, counts, type, indices,
                                                  instanceCounts, drawcount);
 }
@@ -4581,6 +4710,12 @@ angle::Result ContextVk::multiDrawArraysInstancedBaseInstance(const gl::Context
                                                               const GLuint *baseInstances,
                                                               GLsizei drawcount)
 {
+    if (CanBatchMultiDraw(this, context, getVertexArray(), mode, drawcount, nullptr,
+                          baseInstances))
+    {
+        return multiDrawArraysBatched(context, mode, firsts, counts, instanceCounts, baseInstances,
+                                      drawcount);
+    }
     return rx::MultiDrawArraysInstancedBaseInstanceGeneral(
         this, context, mode, firsts, counts, instanceCounts, baseInstances, drawcount);
 }
@@ -4596,11 +4731,148 @@ angle::Result ContextVk::multiDrawElementsInstancedBaseVertexBaseInstance(
     const GLuint *baseInstances,
     GLsizei drawcount)
 {
+    if (CanBatchMultiDraw(this, context, getVertexArray(), mode, drawcount, baseVertices,
+                          baseInstances) &&
+        CanBatchMultiDrawElements(this, type, indices, drawcount))
+    {
+        return multiDrawElementsBatched(context, mode, counts, type, indices, instanceCounts,
+                                        baseVertices, baseInstances, drawcount);
+    }
     return rx::MultiDrawElementsInstancedBaseVertexBaseInstanceGeneral(
         this, context, mode, counts, type, indices, instanceCounts, baseVertices, baseInstances,
         drawcount);
 }
 
+angle::Result ContextVk::multiDrawArraysBatched(const gl::Context *context,
+                                                gl::PrimitiveMode mode,
+                                                const GLint *firsts,
+                                                const GLsizei *counts,
+                                                const GLsizei *instanceCounts,
+                                                const GLuint *baseInstances,
+                                                GLsizei drawcount)
+{
+    vk::BufferHelper *indirectBuffer = nullptr;
+    bool newBuffer                   = false;
+    ANGLE_TRY(mStreamedIndirectBuffer.allocate(this, sizeof(VkDrawIndirectCommand) * drawcount,
+                                               &indirectBuffer, &newBuffer));
+    if (newBuffer)
+    {
+        mHasInFlightStreamedIndirectBuffers = true;
+    }
+
+    VkDrawIndirectCommand *commands =
+        reinterpret_cast<VkDrawIndirectCommand *>(indirectBuffer->getMappedMemory());
+    for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
+    {
+        VkDrawIndirectCommand &command = commands[drawID];
+
+        command.vertexCount   = gl::GetClampedVertexCount<uint32_t>(counts[drawID]);
+        command.instanceCount = instanceCounts ? static_cast<uint32_t>(instanceCounts[drawID]) : 1;
+        command.firstVertex   = static_cast<uint32_t>(firsts[drawID]);
+        command.firstInstance = baseInstances ? baseInstances[drawID] : 0;
+    }
+    ANGLE_TRY(indirectBuffer->flush(mRenderer));
+
+    // The draws share their base instance, so the uniform emulating gl_BaseInstance is set once.
+    gl::ProgramExecutable *executable = context->getState().getLinkedProgramExecutable(context);
+    const bool hasBaseInstance = baseInstances != nullptr && executable->hasBaseInstanceUniform();
+    if (hasBaseInstance)
+    {
+        executable->setBaseInstanceUniform(baseInstances[0]);
+    }
+    ResetBaseVertexBaseInstance resetUniforms(executable, false, hasBaseInstance);
+
+    ANGLE_TRY(setupIndirectDraw(context, mode, mNonIndexedDirtyBitsMask, indirectBuffer));
+
+    mRenderPassCommandBuffer->drawIndirect(indirectBuffer->getBuffer(), indirectBuffer->getOffset(),
+                                           drawcount, sizeof(VkDrawIndirectCommand));
+
+    onMultiDrawBatched(context, counts, instanceCounts, drawcount);
+    return angle::Result::Continue;
+}
+
+angle::Result ContextVk::multiDrawElementsBatched(const gl::Context *context,
+                                                  gl::PrimitiveMode mode,
+                                                  const GLsizei *counts,
+                                                  gl::DrawElementsType type,
+                                                  const GLvoid *const *indices,
+                                                  const GLsizei *instanceCounts,
+                                                  const GLint *baseVertices,
+                                                  const GLuint *baseInstances,
+                                                  GLsizei drawcount)
+{
+    vk::BufferHelper *indirectBuffer = nullptr;
+    bool newBuffer                   = false;
+    ANGLE_TRY(mStreamedIndirectBuffer.allocate(
+        this, sizeof(VkDrawIndexedIndirectCommand) * drawcount, &indirectBuffer, &newBuffer));
+    if (newBuffer)
+    {
+        mHasInFlightStreamedIndirectBuffers = true;
+    }
+
+    const GLuint indexSizeShift = gl::GetDrawElementsTypeShift(type);
+
+    VkDrawIndexedIndirectCommand *commands =
+        reinterpret_cast<VkDrawIndexedIndirectCommand *>(indirectBuffer->getMappedMemory());
+    for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
+    {
+        VkDrawIndexedIndirectCommand &command = commands[drawID];
+        const uintptr_t indexOffset           = reinterpret_cast<uintptr_t>(indices[drawID]);
+
+        command.indexCount    = static_cast<uint32_t>(counts[drawID]);
+        command.instanceCount = instanceCounts ? static_cast<uint32_t>(instanceCounts[drawID]) : 1;
+        command.firstIndex    = static_cast<uint32_t>(indexOffset >> indexSizeShift);
+        command.vertexOffset  = baseVertices ? baseVertices[drawID] : 0;
+        command.firstInstance = baseInstances ? baseInstances[drawID] : 0;
+    }
+    ANGLE_TRY(indirectBuffer->flush(mRenderer));
+
+    // The draws share their base vertex and base instance, so the uniforms emulating gl_BaseVertex
+    // and gl_BaseInstance are set once.
+    gl::ProgramExecutable *executable = context->getState().getLinkedProgramExecutable(context);
+    const bool hasBaseVertex   = baseVertices != nullptr && executable->hasBaseVertexUniform();
+    const bool hasBaseInstance = baseInstances != nullptr && executable->hasBaseInstanceUniform();
+    if (hasBaseVertex)
+    {
+        executable->setBaseVertexUniform(baseVertices[0]);
+    }
+    if (hasBaseInstance)
+    {
+        executable->setBaseInstanceUniform(baseInstances[0]);
+    }
+    ResetBaseVertexBaseInstance resetUniforms(executable, hasBaseVertex, hasBaseInstance);
+
+    // The offsets of the draws are in the commands, so bind the element array buffer itself at
+    // offset 0, replacing any buffer converted for a previous draw.
+    mGraphicsDirtyBits.set(DIRTY_BIT_INDEX_BUFFER);
+    mCurrentIndexBufferOffset = 0;
+    mLastIndexBufferOffset    = reinterpret_cast<const void *>(angle::DirtyPointer);
+    getVertexArray()->updateCurrentElementArrayBuffer();
+
+    ANGLE_TRY(setupIndexedIndirectDraw(context, mode, type, indirectBuffer));
+
+    mRenderPassCommandBuffer->drawIndexedIndirect(indirectBuffer->getBuffer(),
+                                                  indirectBuffer->getOffset(), drawcount,
+                                                  sizeof(VkDrawIndexedIndirectCommand));
+
+    onMultiDrawBatched(context, counts, instanceCounts, drawcount);
+    return angle::Result::Continue;
+}
+
+void ContextVk::onMultiDrawBatched(const gl::Context *context,
+                                   const GLsizei *counts,
+                                   const GLsizei *instanceCounts,
+                                   GLsizei drawcount)
+{
+    // Account for what the draws write, as the generic implementation does after each draw.
+    for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
+    {
+        gl::MarkTransformFeedbackBufferUsage(context, counts[drawID],
+                                             instanceCounts ? instanceCounts[drawID] : 1);
+    }
+    gl::MarkShaderStorageUsage(context);
+}
+
 angle::Result ContextVk::optimizeRenderPassForPresent(vk::ImageViewHelper *colorImageView,
                                                       vk::ImageHelper *colorImage,
                                                       vk::ImageHelper *colorImageMS,
@@ -7796,6 +8068,13 @@ angle::Result ContextVk::flushImpl(const vk::Semaphore *signalSemaphore,
         mHasInFlightStreamedVertexBuffers.reset();
     }
 
+    if (mHasInFlightStreamedIndirectBuffers)
+    {
+        mStreamedIndirectBuffer.updateQueueSerialAndReleaseInFlightBuffers(this,
+                                                                           mLastFlushedQueueSerial);
+        mHasInFlightStreamedIndirectBuffers = false;
+    }
+
     ASSERT(mWaitSemaphores.empty());
     ASSERT(mWaitSemaphoreStageMasks.empty());
 
@@ -8116,6 +8395,8 @@ angle::Result ContextVk::flushCommandsAndEndRenderPassWithoutSubmit(RenderPassCl
     pauseTransformFeedbackIfActiveUnpaused();
 
     ANGLE_TRY(mRenderPassCommands->endRenderPass(this));
+    mPerfCounters.redundantStateCommandsSkipped +=
+        mRenderPassCommands->getCommandBuffer().getSkippedRedundantStateCommandCount();
 
     if (kEnableCommandStreamDiagnostics)
     {
@@ -8418,6 +8699,8 @@ angle::Result ContextVk::flushOutsideRenderPassCommands()
     }
 
     flushDescriptorSetUpdates();
+    mPerfCounters.redundantStateCommandsSkipped +=
+        mOutsideRenderPassCommands->getCommandBuffer().getSkippedRedundantStateCommandCount();
 
     // Track completion of this command buffer.
     mOutsideRenderPassCommands->flushSetEvents(this);
@@ -227,6 +227,26 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
                                                 GLsizei drawcount,
                                                 GLsizei stride);
 
+    // Records the draws of a multi-draw call as a single indirect draw.  The per-draw arrays other
+    // than counts (and firsts or indices) may be null, which stands for 1 instance and a base
+    // vertex and base instance of 0.
+    angle::Result multiDrawArraysBatched(const gl::Context *context,
+                                         gl::PrimitiveMode mode,
+                                         const GLint *firsts,
+                                         const GLsizei *counts,
+                                         const GLsizei *instanceCounts,
+                                         const GLuint *baseInstances,
+                                         GLsizei drawcount);
+    angle::Result multiDrawElementsBatched(const gl::Context *context,
+                                           gl::PrimitiveMode mode,
+                                           const GLsizei *counts,
+                                           gl::DrawElementsType type,
+                                           const GLvoid *const *indices,
+                                           const GLsizei *instanceCounts,
+                                           const GLint *baseVertices,
+                                           const GLuint *baseInstances,
+                                           GLsizei drawcount);
+
     // ShareGroup
     ShareGroupVk *getShareGroup() { return mShareGroupVk; }
     PipelineLayoutCache &getPipelineLayoutCache()
@@ -768,6 +788,7 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     {
         mCurrentGraphicsPipeline        = nullptr;
         mCurrentGraphicsPipelineShaders = nullptr;
+        mGraphicsPipelineHashBaseDesc   = nullptr;
     }
 
     void onProgramExecutableReset(ProgramExecutableVk *executableVk);
@@ -1138,6 +1159,11 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
                                            gl::PrimitiveMode mode,
                                            gl::DrawElementsType indexType,
                                            vk::BufferHelper *indirectBuffer);
+    // Marks the buffers written by the draws of a batched multi-draw call.
+    void onMultiDrawBatched(const gl::Context *context,
+                            const GLsizei *counts,
+                            const GLsizei *instanceCounts,
+                            GLsizei drawcount);
 
     angle::Result setupLineLoopIndexedIndirectDraw(const gl::Context *context,
                                                    gl::PrimitiveMode mode,
@@ -1497,6 +1523,15 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     vk::GraphicsPipelineTransitionBits mGraphicsPipelineTransition;
     vk::GraphicsPipelineTransitionBits mGraphicsPipelineLibraryTransition;
 
+    // The hash of |mGraphicsPipelineDesc| is derived from that of the desc of a pipeline that was
+    // previously current, by only rehashing the parts marked in |mGraphicsPipelineHashTransition|.
+    // That accumulates |mGraphicsPipelineTransition| the same way as above, since the desc the
+    // hash was derived from.  The base desc is dropped along with |mCurrentGraphicsPipeline|, as
+    // the desc may then change without transition bits.
+    const vk::GraphicsPipelineDesc *mGraphicsPipelineHashBaseDesc;
+    size_t mGraphicsPipelineHashBase;
+    vk::GraphicsPipelineTransitionBits mGraphicsPipelineHashTransition;
+
     // A pipeline cache specifically used for vertex input and fragment output pipelines, when there
     // is no blob reuse between libraries and monolithic pipelines.  In that case, there's no point
     // in making monolithic pipelines be stored in the same cache as these partial pipelines.
@@ -1595,6 +1630,10 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     gl::AttribArray<vk::DynamicBuffer> mStreamedVertexBuffers;
     gl::AttributesMask mHasInFlightStreamedVertexBuffers;
 
+    // DynamicBuffer for the indirect commands of batched multi-draw calls.
+    vk::DynamicBuffer mStreamedIndirectBuffer;
+    bool mHasInFlightStreamedIndirectBuffers;
+
     // We use a single pool for recording commands. We also keep a free list for pool recycling.
     vk::SecondaryCommandPools mCommandPools;
 
@@ -651,7 +651,7 @@ void DisplayVk::populateFeatureList(angle::FeatureList *features)
 // vk::GlobalOps
 void DisplayVk::putBlob(const angle::BlobCacheKey &key, const angle::MemoryBuffer &value)
 {
-    getBlobCache()->putApplication(nullptr, key, value);
+    getBlobCache()->putPersistent(key, value);
 }
 
 bool DisplayVk::getBlob(const angle::BlobCacheKey &key, angle::BlobCacheValue *valueOut)
@@ -659,6 +659,11 @@ bool DisplayVk::getBlob(const angle::BlobCacheKey &key, angle::BlobCacheValue *v
     return getBlobCache()->get(nullptr, &mScratchBuffer, key, valueOut);
 }
 
+angle::BlobCompressionCodec DisplayVk::getBlobCompressionCodec() const
+{
+    return getBlobCache()->getCompressionCodec();
+}
+
 std::shared_ptr<angle::WaitableEvent> DisplayVk::postMultiThreadWorkerTask(
     const std::shared_ptr<angle::Closure> &task)
 {
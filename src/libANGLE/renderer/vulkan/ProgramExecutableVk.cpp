@@ -27,10 +27,11 @@ namespace
 // Limit decompressed vulkan pipelines to 10MB per program.
 static constexpr size_t kMaxLocalPipelineCacheSize = 10 * 1024 * 1024;
 
-bool ValidateTransformedSpirV(vk::Context *context,
-                              const gl::ShaderBitSet &linkedShaderStages,
-                              const ShaderInterfaceVariableInfoMap &variableInfoMap,
-                              const gl::ShaderMap<angle::spirv::Blob> &spirvBlobs)
+bool ValidateTransformedSpirV(
+    vk::Context *context,
+    const gl::ShaderBitSet &linkedShaderStages,
+    const ShaderInterfaceVariableInfoMap &variableInfoMap,
+    const gl::ShaderMap<std::shared_ptr<const angle::spirv::Blob>> &spirvBlobs)
 {
     gl::ShaderType lastPreFragmentStage = gl::GetLastPreFragmentStage(linkedShaderStages);
 
@@ -45,8 +46,8 @@ bool ValidateTransformedSpirV(vk::Context *context,
             context->getFeatures().varyingsRequireMatchingPrecisionInSpirv.enabled;
 
         angle::spirv::Blob transformed;
-        if (SpvTransformSpirvCode(options, variableInfoMap, spirvBlobs[shaderType], &transformed) !=
-            angle::Result::Continue)
+        if (SpvTransformSpirvCode(options, variableInfoMap, *spirvBlobs[shaderType],
+                                  &transformed) != angle::Result::Continue)
         {
             return false;
         }
@@ -208,7 +209,10 @@ void GetPipelineCacheData(ContextVk *contextVk,
         }
 
         // Compress it.
-        if (!angle::CompressBlob(pipelineCacheData.size(), pipelineCacheData.data(), cacheDataOut))
+        const angle::BlobCompressionCodec codec =
+            contextVk->getRenderer()->getGlobalOps()->getBlobCompressionCodec();
+        if (!angle::CompressBlob(codec, pipelineCacheData.size(), pipelineCacheData.data(),
+                                 cacheDataOut))
         {
             cacheDataOut->clear();
         }
@@ -535,7 +539,7 @@ angle::Result ShaderInfo::initShaders(vk::Context *context,
     {
         if (spirvBlobs[shaderType] != nullptr)
         {
-            mSpirvBlobs[shaderType] = *spirvBlobs[shaderType];
+            mSpirvBlobs[shaderType] = std::make_shared<angle::spirv::Blob>(*spirvBlobs[shaderType]);
         }
     }
 
@@ -560,9 +564,9 @@ void ShaderInfo::initShaderFromProgram(gl::ShaderType shaderType,
 
 void ShaderInfo::clear()
 {
-    for (angle::spirv::Blob &spirvBlob : mSpirvBlobs)
+    for (std::shared_ptr<const angle::spirv::Blob> &spirvBlob : mSpirvBlobs)
     {
-        spirvBlob.clear();
+        spirvBlob.reset();
     }
     mIsInitialized = false;
 }
@@ -574,7 +578,12 @@ void ShaderInfo::load(gl::BinaryInputStream *stream)
     // Read in shader codes for all shader types
     for (gl::ShaderType shaderType : gl::AllShaderTypes())
     {
-        stream->readVector(&mSpirvBlobs[shaderType]);
+        angle::spirv::Blob spirvBlob;
+        stream->readVector(&spirvBlob);
+        if (!spirvBlob.empty())
+        {
+            mSpirvBlobs[shaderType] = std::make_shared<angle::spirv::Blob>(std::move(spirvBlob));
+        }
     }
 
     mIsInitialized = true;
@@ -587,7 +596,14 @@ void ShaderInfo::save(gl::BinaryOutputStream *stream)
     // Write out shader codes for all shader types
     for (gl::ShaderType shaderType : gl::AllShaderTypes())
     {
-        stream->writeVector(mSpirvBlobs[shaderType]);
+        if (mSpirvBlobs[shaderType])
+        {
+            stream->writeVector(*mSpirvBlobs[shaderType]);
+        }
+        else
+        {
+            stream->writeVector(angle::spirv::Blob());
+        }
     }
 }
 
@@ -604,10 +620,9 @@ angle::Result ProgramInfo::initProgram(vk::Context *context,
                                        ProgramTransformOptions optionBits,
                                        const ShaderInterfaceVariableInfoMap &variableInfoMap)
 {
-    const gl::ShaderMap<angle::spirv::Blob> &originalSpirvBlobs = shaderInfo.getSpirvBlobs();
-    const angle::spirv::Blob &originalSpirvBlob                 = originalSpirvBlobs[shaderType];
-    gl::ShaderMap<angle::spirv::Blob> transformedSpirvBlobs;
-    angle::spirv::Blob &transformedSpirvBlob = transformedSpirvBlobs[shaderType];
+    const std::shared_ptr<const angle::spirv::Blob> &originalSpirvBlob =
+        shaderInfo.getSpirvBlobs()[shaderType];
+    ASSERT(originalSpirvBlob);
 
     SpvTransformOptions options;
     options.shaderType               = shaderType;
@@ -622,11 +637,14 @@ angle::Result ProgramInfo::initProgram(vk::Context *context,
     options.useSpirvVaryingPrecisionFixer =
         context->getFeatures().varyingsRequireMatchingPrecisionInSpirv.enabled;
 
-    ANGLE_TRY(
-        SpvTransformSpirvCode(options, variableInfoMap, originalSpirvBlob, &transformedSpirvBlob));
+    // Programs that share a shader and its interface often transform it identically, so the
+    // result is shared through the renderer.
+    std::shared_ptr<const angle::spirv::Blob> transformedSpirvBlob;
+    ANGLE_TRY(context->getRenderer()->getTransformedSpirvCache().getTransformedSpirv(
+        context, options, variableInfoMap, originalSpirvBlob, &transformedSpirvBlob));
     ANGLE_TRY(vk::InitShaderModule(context, &mShaders[shaderType].get(),
-                                   transformedSpirvBlob.data(),
-                                   transformedSpirvBlob.size() * sizeof(uint32_t)));
+                                   transformedSpirvBlob->data(),
+                                   transformedSpirvBlob->size() * sizeof(uint32_t)));
 
     mProgramHelper.setShader(shaderType, &mShaders[shaderType]);
 
@@ -690,6 +708,7 @@ void ProgramExecutableVk::resetLayout(ContextVk *contextVk)
     {
         descriptorSet.reset();
     }
+    mTextureDescriptorSetDesc.resize(0);
 
     for (vk::DescriptorPoolPointer &pool : mDescriptorPools)
     {
@@ -1090,9 +1109,10 @@ angle::Result ProgramExecutableVk::warmUpGraphicsPipelineCache(
     ProgramTransformOptions transformOptions = {};
     transformOptions.surfaceRotation         = isSurfaceRotated;
 
+    // Warm up pipelines are not added to the cache, so the hash is not used.
     ANGLE_TRY(createGraphicsPipelineImpl(context, transformOptions, subset, &pipelineCache,
-                                         PipelineSource::WarmUp, graphicsPipelineDesc, renderPass,
-                                         &descPtr, &placeholderPipelineHelper));
+                                         PipelineSource::WarmUp, graphicsPipelineDesc, 0,
+                                         renderPass, &descPtr, &placeholderPipelineHelper));
 
     ASSERT(placeholderPipelineHelper->valid());
     return angle::Result::Continue;
@@ -1514,6 +1534,7 @@ angle::Result ProgramExecutableVk::initProgramThenCreateGraphicsPipeline(
     vk::PipelineCacheAccess *pipelineCache,
     PipelineSource source,
     const vk::GraphicsPipelineDesc &desc,
+    size_t descHash,
     const vk::RenderPass &compatibleRenderPass,
     const vk::GraphicsPipelineDesc **descPtrOut,
     vk::PipelineHelper **pipelineOut)
@@ -1521,7 +1542,8 @@ angle::Result ProgramExecutableVk::initProgramThenCreateGraphicsPipeline(
     ANGLE_TRY(initGraphicsShaderPrograms(context, transformOptions));
 
     return createGraphicsPipelineImpl(context, transformOptions, pipelineSubset, pipelineCache,
-                                      source, desc, compatibleRenderPass, descPtrOut, pipelineOut);
+                                      source, desc, descHash, compatibleRenderPass, descPtrOut,
+                                      pipelineOut);
 }
 
 angle::Result ProgramExecutableVk::createGraphicsPipelineImpl(
@@ -1531,6 +1553,7 @@ angle::Result ProgramExecutableVk::createGraphicsPipelineImpl(
     vk::PipelineCacheAccess *pipelineCache,
     PipelineSource source,
     const vk::GraphicsPipelineDesc &desc,
+    size_t descHash,
     const vk::RenderPass &compatibleRenderPass,
     const vk::GraphicsPipelineDesc **descPtrOut,
     vk::PipelineHelper **pipelineOut)
@@ -1559,7 +1582,7 @@ angle::Result ProgramExecutableVk::createGraphicsPipelineImpl(
         CompleteGraphicsPipelineCache &pipelines = mCompleteGraphicsPipelines[programIndex];
         return programInfo.getShaderProgram().createGraphicsPipeline(
             context, &pipelines, pipelineCache, compatibleRenderPass, getPipelineLayout(), source,
-            desc, specConsts, descPtrOut, pipelineOut);
+            desc, descHash, specConsts, descPtrOut, pipelineOut);
     }
     else
     {
@@ -1570,13 +1593,14 @@ angle::Result ProgramExecutableVk::createGraphicsPipelineImpl(
         ShadersGraphicsPipelineCache &pipelines = mShadersGraphicsPipelines[programIndex];
         return programInfo.getShaderProgram().createGraphicsPipeline(
             context, &pipelines, pipelineCache, compatibleRenderPass, getPipelineLayout(), source,
-            desc, specConsts, descPtrOut, pipelineOut);
+            desc, descHash, specConsts, descPtrOut, pipelineOut);
     }
 }
 
 angle::Result ProgramExecutableVk::getGraphicsPipeline(ContextVk *contextVk,
                                                        vk::GraphicsPipelineSubset pipelineSubset,
                                                        const vk::GraphicsPipelineDesc &desc,
+                                                       size_t descHash,
                                                        const vk::GraphicsPipelineDesc **descPtrOut,
                                                        vk::PipelineHelper **pipelineOut)
 {
@@ -1591,7 +1615,8 @@ angle::Result ProgramExecutableVk::getGraphicsPipeline(ContextVk *contextVk,
 
     if (pipelineSubset == vk::GraphicsPipelineSubset::Complete)
     {
-        mCompleteGraphicsPipelines[programIndex].getPipeline(desc, descPtrOut, pipelineOut);
+        mCompleteGraphicsPipelines[programIndex].getPipeline(desc, descHash, descPtrOut,
+                                                             pipelineOut);
     }
     else
     {
@@ -1599,7 +1624,8 @@ angle::Result ProgramExecutableVk::getGraphicsPipeline(ContextVk *contextVk,
         // through the program executable.
         ASSERT(pipelineSubset == vk::GraphicsPipelineSubset::Shaders);
 
-        mShadersGraphicsPipelines[programIndex].getPipeline(desc, descPtrOut, pipelineOut);
+        mShadersGraphicsPipelines[programIndex].getPipeline(desc, descHash, descPtrOut,
+                                                            pipelineOut);
     }
 
     return angle::Result::Continue;
@@ -1611,6 +1637,7 @@ angle::Result ProgramExecutableVk::createGraphicsPipeline(
     vk::PipelineCacheAccess *pipelineCache,
     PipelineSource source,
     const vk::GraphicsPipelineDesc &desc,
+    size_t descHash,
     const vk::GraphicsPipelineDesc **descPtrOut,
     vk::PipelineHelper **pipelineOut)
 {
@@ -1633,7 +1660,7 @@ angle::Result ProgramExecutableVk::createGraphicsPipeline(
     ANGLE_TRY(contextVk->getCompatibleRenderPass(desc.getRenderPassDesc(), &compatibleRenderPass));
 
     ANGLE_TRY(initProgramThenCreateGraphicsPipeline(
-        contextVk, transformOptions, pipelineSubset, pipelineCache, source, desc,
+        contextVk, transformOptions, pipelineSubset, pipelineCache, source, desc, descHash,
         *compatibleRenderPass, descPtrOut, pipelineOut));
 
     if (useProgramPipelineCache &&
@@ -1649,6 +1676,7 @@ angle::Result ProgramExecutableVk::linkGraphicsPipelineLibraries(
     ContextVk *contextVk,
     vk::PipelineCacheAccess *pipelineCache,
     const vk::GraphicsPipelineDesc &desc,
+    size_t descHash,
     vk::PipelineHelper *vertexInputPipeline,
     vk::PipelineHelper *shadersPipeline,
     vk::PipelineHelper *fragmentOutputPipeline,
@@ -1659,8 +1687,8 @@ angle::Result ProgramExecutableVk::linkGraphicsPipelineLibraries(
     const uint8_t programIndex               = transformOptions.permutationIndex;
 
     ANGLE_TRY(mCompleteGraphicsPipelines[programIndex].linkLibraries(
-        contextVk, pipelineCache, desc, getPipelineLayout(), vertexInputPipeline, shadersPipeline,
-        fragmentOutputPipeline, descPtrOut, pipelineOut));
+        contextVk, pipelineCache, desc, descHash, getPipelineLayout(), vertexInputPipeline,
+        shadersPipeline, fragmentOutputPipeline, descPtrOut, pipelineOut));
 
     // If monolithic pipelines are preferred over libraries, create a task so that it can be created
     // asynchronously.
@@ -1975,6 +2003,15 @@ angle::Result ProgramExecutableVk::updateTexturesDescriptorSet(
         vk::DescriptorSetDescBuilder descriptorBuilder;
         descriptorBuilder.updatePreCacheActiveTextures(context, *mExecutable, textures, samplers);
 
+        // Image view and sampler serials come from the renderer-wide ResourceSerialFactory and
+        // are never reused, so a set with the same desc still holds the right descriptors.
+        if (mDescriptorSets[DescriptorSetIndex::Texture] &&
+            descriptorBuilder.getDesc() == mTextureDescriptorSetDesc)
+        {
+            mDynamicDescriptorPools[DescriptorSetIndex::Texture]->onCachedDescriptorSetReused();
+            return angle::Result::Continue;
+        }
+
         ANGLE_TRY(mDynamicDescriptorPools[DescriptorSetIndex::Texture]->getOrAllocateDescriptorSet(
             context, descriptorBuilder.getDesc(),
             mDescriptorSetLayouts[DescriptorSetIndex::Texture].get(),
@@ -1982,6 +2019,7 @@ angle::Result ProgramExecutableVk::updateTexturesDescriptorSet(
         ASSERT(mDescriptorSets[DescriptorSetIndex::Texture]);
         mDescriptorPools[DescriptorSetIndex::Texture] =
             mDescriptorSets[DescriptorSetIndex::Texture]->getPool();
+        mTextureDescriptorSetDesc = descriptorBuilder.getDesc();
 
         if (newSharedCacheKey != nullptr)
         {
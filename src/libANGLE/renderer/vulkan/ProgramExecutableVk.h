@@ -42,14 +42,18 @@ class ShaderInfo final : angle::NonCopyable
 
     ANGLE_INLINE bool valid() const { return mIsInitialized; }
 
-    const gl::ShaderMap<angle::spirv::Blob> &getSpirvBlobs() const { return mSpirvBlobs; }
+    const gl::ShaderMap<std::shared_ptr<const angle::spirv::Blob>> &getSpirvBlobs() const
+    {
+        return mSpirvBlobs;
+    }
 
     // Save and load implementation for GLES Program Binary support.
     void load(gl::BinaryInputStream *stream);
     void save(gl::BinaryOutputStream *stream);
 
   private:
-    gl::ShaderMap<angle::spirv::Blob> mSpirvBlobs;
+    // Shared with the programs of a program pipeline and with the TransformedSpirvCache.
+    gl::ShaderMap<std::shared_ptr<const angle::spirv::Blob>> mSpirvBlobs;
     bool mIsInitialized = false;
 };
 
@@ -172,10 +176,12 @@ class ProgramExecutableVk : public ProgramExecutableImpl
         return mCurrentDefaultUniformBufferSerial;
     }
 
-    // Get the graphics pipeline if already created.
+    // Get the graphics pipeline if already created.  |descHash| is the hash of |desc| for
+    // |pipelineSubset|.
     angle::Result getGraphicsPipeline(ContextVk *contextVk,
                                       vk::GraphicsPipelineSubset pipelineSubset,
                                       const vk::GraphicsPipelineDesc &desc,
+                                      size_t descHash,
                                       const vk::GraphicsPipelineDesc **descPtrOut,
                                       vk::PipelineHelper **pipelineOut);
 
@@ -184,12 +190,14 @@ class ProgramExecutableVk : public ProgramExecutableImpl
                                          vk::PipelineCacheAccess *pipelineCache,
                                          PipelineSource source,
                                          const vk::GraphicsPipelineDesc &desc,
+                                         size_t descHash,
                                          const vk::GraphicsPipelineDesc **descPtrOut,
                                          vk::PipelineHelper **pipelineOut);
 
     angle::Result linkGraphicsPipelineLibraries(ContextVk *contextVk,
                                                 vk::PipelineCacheAccess *pipelineCache,
                                                 const vk::GraphicsPipelineDesc &desc,
+                                                size_t descHash,
                                                 vk::PipelineHelper *vertexInputPipeline,
                                                 vk::PipelineHelper *shadersPipeline,
                                                 vk::PipelineHelper *fragmentOutputPipeline,
@@ -460,6 +468,7 @@ class ProgramExecutableVk : public ProgramExecutableImpl
                                                         vk::PipelineCacheAccess *pipelineCache,
                                                         PipelineSource source,
                                                         const vk::GraphicsPipelineDesc &desc,
+                                                        size_t descHash,
                                                         const vk::RenderPass &compatibleRenderPass,
                                                         const vk::GraphicsPipelineDesc **descPtrOut,
                                                         vk::PipelineHelper **pipelineOut);
@@ -469,6 +478,7 @@ class ProgramExecutableVk : public ProgramExecutableImpl
                                              vk::PipelineCacheAccess *pipelineCache,
                                              PipelineSource source,
                                              const vk::GraphicsPipelineDesc &desc,
+                                             size_t descHash,
                                              const vk::RenderPass &compatibleRenderPass,
                                              const vk::GraphicsPipelineDesc **descPtrOut,
                                              vk::PipelineHelper **pipelineOut);
@@ -514,6 +524,12 @@ class ProgramExecutableVk : public ProgramExecutableImpl
     vk::DescriptorSetArray<vk::DescriptorSetPointer> mDescriptorSets;
     vk::DescriptorSetArray<vk::DynamicDescriptorPoolPointer> mDynamicDescriptorPools;
     vk::DescriptorSetArray<vk::DescriptorPoolPointer> mDescriptorPools;
+    // The desc of the cached texture descriptor set in mDescriptorSets.  The textures are often
+    // marked dirty without any change to their descriptors, for example when switching back to this
+    // program, in which case the set is used again without a cache lookup.  The descriptor set
+    // cache itself remains per share group, as its sets are allocated from the share group's
+    // descriptor pools.
+    vk::DescriptorSetDesc mTextureDescriptorSetDesc;
     vk::BufferSerial mCurrentDefaultUniformBufferSerial;
 
     // We keep a reference to the pipeline and descriptor set layouts. This ensures they don't get
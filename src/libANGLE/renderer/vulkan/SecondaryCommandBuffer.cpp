@@ -8,6 +8,9 @@
 //
 
 #include "libANGLE/renderer/vulkan/SecondaryCommandBuffer.h"
+
+#include <algorithm>
+
 #include "common/debug.h"
 #include "libANGLE/renderer/vulkan/vk_utils.h"
 #include "libANGLE/trace.h"
@@ -187,6 +190,21 @@ ANGLE_INLINE const NextT *GetNextArrayParameter(const PrevT *array, size_t array
     const size_t arrayAllocateBytes = roundUpPow2<size_t>(sizeof(*array) * arrayLen, 8u);
     return Offset<NextT>(array, arrayAllocateBytes);
 }
+
+constexpr uint32_t DynamicStateBit(CommandID id)
+{
+    return 1u << (ToUnderlying(id) - ToUnderlying(CommandID::SetBlendConstants));
+}
+
+// These states are dynamic in every graphics pipeline, so binding a pipeline never affects them.
+// The other dynamic states are static in some pipelines depending on the enabled features, and
+// binding such a pipeline overwrites them.
+constexpr uint32_t kPipelineIndependentDynamicStates =
+    DynamicStateBit(CommandID::SetViewport) | DynamicStateBit(CommandID::SetScissor) |
+    DynamicStateBit(CommandID::SetLineWidth) | DynamicStateBit(CommandID::SetDepthBias) |
+    DynamicStateBit(CommandID::SetStencilCompareMask) |
+    DynamicStateBit(CommandID::SetStencilWriteMask) |
+    DynamicStateBit(CommandID::SetStencilReference);
 }  // namespace
 
 ANGLE_INLINE const CommandHeader *NextCommand(const CommandHeader *command)
@@ -399,8 +417,10 @@ void SecondaryCommandBuffer::executeCommands(PrimaryCommandBuffer *primary)
                 {
                     const CopyImageToBufferParams *params =
                         getParamPtr<CopyImageToBufferParams>(currentCommand);
+                    const VkBufferImageCopy *regions =
+                        GetFirstArrayParameter<VkBufferImageCopy>(params);
                     vkCmdCopyImageToBuffer(cmdBuffer, params->srcImage, params->srcImageLayout,
-                                           params->dstBuffer, 1, &params->region);
+                                           params->dstBuffer, params->regionCount, regions);
                     break;
                 }
                 case CommandID::Dispatch:
@@ -901,6 +921,185 @@ void SecondaryCommandBuffer::executeCommands(PrimaryCommandBuffer *primary)
     }
 }
 
+RedundantStateTracker::RedundantStateTracker()
+{
+    reset();
+}
+
+void RedundantStateTracker::reset()
+{
+    invalidate();
+    mSkippedCommandCount = 0;
+}
+
+void RedundantStateTracker::invalidate()
+{
+    mGraphicsPipeline = VK_NULL_HANDLE;
+    mComputePipeline  = VK_NULL_HANDLE;
+    mGraphicsDescriptorSets.known.reset();
+    mComputeDescriptorSets.known.reset();
+    mIndexBufferKnown = false;
+    mKnownVertexBuffers.reset();
+    mKnownDynamicStates.reset();
+}
+
+RedundantStateTracker::DescriptorSetBindings &RedundantStateTracker::getDescriptorSetBindings(
+    VkPipelineBindPoint pipelineBindPoint)
+{
+    ASSERT(pipelineBindPoint == VK_PIPELINE_BIND_POINT_GRAPHICS ||
+           pipelineBindPoint == VK_PIPELINE_BIND_POINT_COMPUTE);
+    return pipelineBindPoint == VK_PIPELINE_BIND_POINT_GRAPHICS ? mGraphicsDescriptorSets
+                                                                : mComputeDescriptorSets;
+}
+
+bool RedundantStateTracker::onBindPipeline(VkPipelineBindPoint pipelineBindPoint,
+                                           VkPipeline pipeline)
+{
+    ASSERT(pipeline != VK_NULL_HANDLE);
+    const bool isGraphics     = pipelineBindPoint == VK_PIPELINE_BIND_POINT_GRAPHICS;
+    VkPipeline &boundPipeline = isGraphics ? mGraphicsPipeline : mComputePipeline;
+
+    if (boundPipeline == pipeline)
+    {
+        ++mSkippedCommandCount;
+        return true;
+    }
+
+    boundPipeline = pipeline;
+    if (isGraphics)
+    {
+        mKnownDynamicStates &= kPipelineIndependentDynamicStates;
+    }
+    return false;
+}
+
+bool RedundantStateTracker::onBindDescriptorSets(VkPipelineLayout layout,
+                                                 VkPipelineBindPoint pipelineBindPoint,
+                                                 uint32_t firstSet,
+                                                 uint32_t descriptorSetCount,
+                                                 const VkDescriptorSet *descriptorSets,
+                                                 uint32_t dynamicOffsetCount,
+                                                 const uint32_t *dynamicOffsets)
+{
+    DescriptorSetBindings &bindings = getDescriptorSetBindings(pipelineBindPoint);
+
+    // The dynamic offsets can only be attributed to a set if a single set is bound.
+    const bool isTrackable =
+        firstSet + descriptorSetCount <= kMaxTrackedDescriptorSets &&
+        (dynamicOffsetCount == 0 ||
+         (descriptorSetCount == 1 && dynamicOffsetCount <= kMaxTrackedDynamicOffsets));
+
+    if (isTrackable)
+    {
+        bool isRedundant = true;
+        for (uint32_t index = 0; index < descriptorSetCount && isRedundant; ++index)
+        {
+            const uint32_t set                  = firstSet + index;
+            const DescriptorSetBinding &binding = bindings.sets[set];
+            isRedundant = bindings.known.test(set) && binding.layout == layout &&
+                          binding.descriptorSet == descriptorSets[index] &&
+                          binding.dynamicOffsetCount == dynamicOffsetCount &&
+                          std::equal(dynamicOffsets, dynamicOffsets + dynamicOffsetCount,
+                                     binding.dynamicOffsets.begin());
+        }
+
+        if (isRedundant)
+        {
+            ++mSkippedCommandCount;
+            return true;
+        }
+    }
+
+    // Binding sets with a layout that is not compatible with the one the other sets were bound
+    // with may disturb them.  Conservatively forget every set bound with a different layout.
+    for (uint32_t set = 0; set < kMaxTrackedDescriptorSets; ++set)
+    {
+        if (bindings.known.test(set) && bindings.sets[set].layout != layout)
+        {
+            bindings.known.reset(set);
+        }
+    }
+
+    for (uint32_t index = 0; index < descriptorSetCount; ++index)
+    {
+        const uint32_t set = firstSet + index;
+        if (set >= kMaxTrackedDescriptorSets)
+        {
+            break;
+        }
+        if (!isTrackable)
+        {
+            bindings.known.reset(set);
+            continue;
+        }
+
+        DescriptorSetBinding &binding = bindings.sets[set];
+        binding.layout                = layout;
+        binding.descriptorSet         = descriptorSets[index];
+        binding.dynamicOffsetCount    = dynamicOffsetCount;
+        std::copy(dynamicOffsets, dynamicOffsets + dynamicOffsetCount,
+                  binding.dynamicOffsets.begin());
+        bindings.known.set(set);
+    }
+
+    return false;
+}
+
+bool RedundantStateTracker::onBindIndexBuffer(VkBuffer buffer,
+                                              VkDeviceSize offset,
+                                              VkIndexType indexType)
+{
+    if (mIndexBufferKnown && mIndexBuffer == buffer && mIndexBufferOffset == offset &&
+        mIndexType == indexType)
+    {
+        ++mSkippedCommandCount;
+        return true;
+    }
+
+    mIndexBufferKnown  = true;
+    mIndexBuffer       = buffer;
+    mIndexBufferOffset = offset;
+    mIndexType         = indexType;
+    return false;
+}
+
+bool RedundantStateTracker::onBindVertexBuffers(uint32_t bindingCount,
+                                                const VkBuffer *buffers,
+                                                const VkDeviceSize *offsets,
+                                                const VkDeviceSize *strides)
+{
+    if (bindingCount > kMaxTrackedVertexBindings)
+    {
+        mKnownVertexBuffers.reset();
+        return false;
+    }
+
+    bool isRedundant = true;
+    for (uint32_t binding = 0; binding < bindingCount && isRedundant; ++binding)
+    {
+        const VertexBufferBinding &known = mVertexBuffers[binding];
+        const VkDeviceSize stride        = strides != nullptr ? strides[binding] : kUnknownStride;
+        isRedundant = mKnownVertexBuffers.test(binding) && known.buffer == buffers[binding] &&
+                      known.offset == offsets[binding] && known.stride == stride;
+    }
+
+    if (isRedundant)
+    {
+        ++mSkippedCommandCount;
+        return true;
+    }
+
+    for (uint32_t binding = 0; binding < bindingCount; ++binding)
+    {
+        VertexBufferBinding &known = mVertexBuffers[binding];
+        known.buffer               = buffers[binding];
+        known.offset               = offsets[binding];
+        known.stride               = strides != nullptr ? strides[binding] : kUnknownStride;
+        mKnownVertexBuffers.set(binding);
+    }
+    return false;
+}
+
 void SecondaryCommandBuffer::getMemoryUsageStats(size_t *usedMemoryOut,
                                                  size_t *allocatedMemoryOut) const
 {
@@ -11,6 +11,7 @@
 #ifndef LIBANGLE_RENDERER_VULKAN_SECONDARYCOMMANDBUFFERVK_H_
 #define LIBANGLE_RENDERER_VULKAN_SECONDARYCOMMANDBUFFERVK_H_
 
+#include "common/bitset_utils.h"
 #include "common/vulkan/vk_headers.h"
 #include "libANGLE/renderer/vulkan/vk_command_buffer_utils.h"
 #include "libANGLE/renderer/vulkan/vk_wrapper.h"
@@ -302,10 +303,11 @@ struct CopyImageToBufferParams
 {
     CommandHeader header;
 
+    uint32_t regionCount;
     VkImageLayout srcImageLayout;
+    uint32_t padding;
     VkImage srcImage;
     VkBuffer dstBuffer;
-    VkBufferImageCopy region;
 };
 VERIFY_8_BYTE_ALIGNMENT(CopyImageToBufferParams)
 
@@ -819,6 +821,118 @@ ANGLE_INLINE const DestT *Offset(const T *ptr, size_t bytes)
     return reinterpret_cast<const DestT *>((reinterpret_cast<const uint8_t *>(ptr) + bytes));
 }
 
+// Tracks the state set by the commands recorded in a SecondaryCommandBuffer, so that commands that
+// set the state to the value it already has can be dropped at record time instead of being
+// replayed.  Nothing is known about the state at the start of the command buffer, as it is
+// inherited from whatever was recorded before it in the primary command buffer.
+class RedundantStateTracker final : angle::NonCopyable
+{
+  public:
+    RedundantStateTracker();
+
+    // Forgets the state and the count of skipped commands.
+    void reset();
+    // Forgets the state only.
+    void invalidate();
+
+    // Each of the following returns true if the command is redundant and can be skipped.
+    // Otherwise, the tracked state is updated as if the command was recorded.
+    bool onBindPipeline(VkPipelineBindPoint pipelineBindPoint, VkPipeline pipeline);
+    bool onBindDescriptorSets(VkPipelineLayout layout,
+                              VkPipelineBindPoint pipelineBindPoint,
+                              uint32_t firstSet,
+                              uint32_t descriptorSetCount,
+                              const VkDescriptorSet *descriptorSets,
+                              uint32_t dynamicOffsetCount,
+                              const uint32_t *dynamicOffsets);
+    bool onBindIndexBuffer(VkBuffer buffer, VkDeviceSize offset, VkIndexType indexType);
+    // |strides| is null for vkCmdBindVertexBuffers.
+    bool onBindVertexBuffers(uint32_t bindingCount,
+                             const VkBuffer *buffers,
+                             const VkDeviceSize *offsets,
+                             const VkDeviceSize *strides);
+    // |params| must be zero-initialized before it is filled, so it can be compared bytewise.
+    template <class StructType>
+    bool onSetDynamicState(const StructType &params);
+
+    uint32_t getSkippedCommandCount() const { return mSkippedCommandCount; }
+
+  private:
+    // Larger indices are not tracked, and are always considered to be unknown.
+    static constexpr uint32_t kMaxTrackedDescriptorSets = 4;
+    static constexpr uint32_t kMaxTrackedDynamicOffsets = 8;
+    static constexpr uint32_t kMaxTrackedVertexBindings = 16;
+
+    static constexpr size_t kMaxDynamicStateParamsSize = 32;
+    static constexpr size_t kDynamicStateCount =
+        ToUnderlying(CommandID::SetViewport) - ToUnderlying(CommandID::SetBlendConstants) + 1;
+    using DynamicStateBitSet = angle::BitSet32<kDynamicStateCount>;
+
+    // The stride of vertex buffers bound with vkCmdBindVertexBuffers.
+    static constexpr VkDeviceSize kUnknownStride = std::numeric_limits<VkDeviceSize>::max();
+
+    struct DescriptorSetBinding
+    {
+        VkPipelineLayout layout;
+        VkDescriptorSet descriptorSet;
+        uint32_t dynamicOffsetCount;
+        std::array<uint32_t, kMaxTrackedDynamicOffsets> dynamicOffsets;
+    };
+    struct DescriptorSetBindings
+    {
+        std::array<DescriptorSetBinding, kMaxTrackedDescriptorSets> sets;
+        angle::BitSet8<kMaxTrackedDescriptorSets> known;
+    };
+    struct VertexBufferBinding
+    {
+        VkBuffer buffer;
+        VkDeviceSize offset;
+        VkDeviceSize stride;
+    };
+
+    DescriptorSetBindings &getDescriptorSetBindings(VkPipelineBindPoint pipelineBindPoint);
+
+    VkPipeline mGraphicsPipeline;
+    VkPipeline mComputePipeline;
+    DescriptorSetBindings mGraphicsDescriptorSets;
+    DescriptorSetBindings mComputeDescriptorSets;
+
+    bool mIndexBufferKnown;
+    VkBuffer mIndexBuffer;
+    VkDeviceSize mIndexBufferOffset;
+    VkIndexType mIndexType;
+
+    std::array<VertexBufferBinding, kMaxTrackedVertexBindings> mVertexBuffers;
+    angle::BitSet32<kMaxTrackedVertexBindings> mKnownVertexBuffers;
+
+    std::array<std::array<uint8_t, kMaxDynamicStateParamsSize>, kDynamicStateCount>
+        mDynamicStateParams;
+    DynamicStateBitSet mKnownDynamicStates;
+
+    uint32_t mSkippedCommandCount;
+};
+
+template <class StructType>
+ANGLE_INLINE bool RedundantStateTracker::onSetDynamicState(const StructType &params)
+{
+    static_assert(sizeof(StructType) <= kMaxDynamicStateParamsSize, "Increase the params size");
+
+    const size_t index =
+        ToUnderlying(params.header.id) - ToUnderlying(CommandID::SetBlendConstants);
+    ASSERT(index < kDynamicStateCount);
+
+    uint8_t *knownParams = mDynamicStateParams[index].data();
+    if (mKnownDynamicStates.test(index) && memcmp(knownParams, &params, sizeof(StructType)) == 0)
+    {
+        ++mSkippedCommandCount;
+        return true;
+    }
+
+    memcpy(knownParams, &params, sizeof(StructType));
+    mKnownDynamicStates.set(index);
+    return false;
+}
+
 class SecondaryCommandBuffer final : angle::NonCopyable
 {
   public:
@@ -1150,6 +1264,7 @@ class SecondaryCommandBuffer final : angle::NonCopyable
     {
         mCommands.clear();
         mCommandAllocator.reset(&mCommandTracker);
+        mStateTracker.reset();
     }
 
     // The SecondaryCommandBuffer is valid if it's been initialized
@@ -1166,6 +1281,12 @@ class SecondaryCommandBuffer final : angle::NonCopyable
         return mCommandTracker.getRenderPassWriteCommandCount();
     }
 
+    // The number of commands that were not recorded because they didn't change the state.
+    uint32_t getSkippedRedundantStateCommandCount() const
+    {
+        return mStateTracker.getSkippedCommandCount();
+    }
+
     void clearCommands() { mCommands.clear(); }
     bool hasEmptyCommands() { return mCommands.empty(); }
     void pushToCommands(uint8_t *command)
@@ -1225,6 +1346,27 @@ class SecondaryCommandBuffer final : angle::NonCopyable
         return commonInit<StructType>(cmdID, allocationSize, commandMemory);
     }
 
+    // Dynamic state commands are built on the stack first, and only recorded if they change the
+    // state.  The params are zero-initialized so they can be compared bytewise, padding included.
+    template <class StructType>
+    ANGLE_INLINE StructType initDynamicStateParams(CommandID cmdID)
+    {
+        StructType params;
+        memset(&params, 0, sizeof(params));
+        params.header.id   = cmdID;
+        params.header.size = static_cast<uint16_t>(sizeof(StructType));
+        return params;
+    }
+    template <class StructType>
+    ANGLE_INLINE void recordDynamicState(const StructType &params)
+    {
+        if (mStateTracker.onSetDynamicState(params))
+        {
+            return;
+        }
+        *initCommand<StructType>(params.header.id) = params;
+    }
+
     // Return a pointer to the parameter type.  Note that every param struct has the header as its
     // first member, so in fact the parameter type pointer is identical to the header pointer.
     template <class StructType>
@@ -1271,6 +1413,8 @@ class SecondaryCommandBuffer final : angle::NonCopyable
     SecondaryCommandBlockPool mCommandAllocator;
 
     CommandBufferCommandTracker mCommandTracker;
+
+    RedundantStateTracker mStateTracker;
 };
 
 ANGLE_INLINE SecondaryCommandBuffer::SecondaryCommandBuffer() : mIsOpen(true)
@@ -1334,6 +1478,10 @@ ANGLE_INLINE void SecondaryCommandBuffer::beginTransformFeedback(
 
 ANGLE_INLINE void SecondaryCommandBuffer::bindComputePipeline(const Pipeline &pipeline)
 {
+    if (mStateTracker.onBindPipeline(VK_PIPELINE_BIND_POINT_COMPUTE, pipeline.getHandle()))
+    {
+        return;
+    }
     BindPipelineParams *paramStruct =
         initCommand<BindPipelineParams>(CommandID::BindComputePipeline);
     paramStruct->pipeline = pipeline.getHandle();
@@ -1347,6 +1495,13 @@ ANGLE_INLINE void SecondaryCommandBuffer::bindDescriptorSets(const PipelineLayou
                                                              uint32_t dynamicOffsetCount,
                                                              const uint32_t *dynamicOffsets)
 {
+    if (mStateTracker.onBindDescriptorSets(layout.getHandle(), pipelineBindPoint,
+                                           ToUnderlying(firstSet), descriptorSetCount,
+                                           descriptorSets, dynamicOffsetCount, dynamicOffsets))
+    {
+        return;
+    }
+
     const ArrayParamSize descSize =
         calculateArrayParameterSize<VkDescriptorSet>(descriptorSetCount);
     const ArrayParamSize offsetSize = calculateArrayParameterSize<uint32_t>(dynamicOffsetCount);
@@ -1370,6 +1525,10 @@ ANGLE_INLINE void SecondaryCommandBuffer::bindDescriptorSets(const PipelineLayou
 
 ANGLE_INLINE void SecondaryCommandBuffer::bindGraphicsPipeline(const Pipeline &pipeline)
 {
+    if (mStateTracker.onBindPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline.getHandle()))
+    {
+        return;
+    }
     BindPipelineParams *paramStruct =
         initCommand<BindPipelineParams>(CommandID::BindGraphicsPipeline);
     paramStruct->pipeline = pipeline.getHandle();
@@ -1379,6 +1538,10 @@ ANGLE_INLINE void SecondaryCommandBuffer::bindIndexBuffer(const Buffer &buffer,
                                                           VkDeviceSize offset,
                                                           VkIndexType indexType)
 {
+    if (mStateTracker.onBindIndexBuffer(buffer.getHandle(), offset, indexType))
+    {
+        return;
+    }
     BindIndexBufferParams *paramStruct =
         initCommand<BindIndexBufferParams>(CommandID::BindIndexBuffer);
     paramStruct->buffer    = buffer.getHandle();
@@ -1415,6 +1578,11 @@ ANGLE_INLINE void SecondaryCommandBuffer::bindVertexBuffers(uint32_t firstBindin
                                                             const VkDeviceSize *offsets)
 {
     ASSERT(firstBinding == 0);
+    if (mStateTracker.onBindVertexBuffers(bindingCount, buffers, offsets, nullptr))
+    {
+        return;
+    }
+
     uint8_t *writePtr;
     const ArrayParamSize buffersSize     = calculateArrayParameterSize<VkBuffer>(bindingCount);
     const ArrayParamSize offsetsSize     = calculateArrayParameterSize<VkDeviceSize>(bindingCount);
@@ -1436,6 +1604,11 @@ ANGLE_INLINE void SecondaryCommandBuffer::bindVertexBuffers2(uint32_t firstBindi
 {
     ASSERT(firstBinding == 0);
     ASSERT(sizes == nullptr);
+    if (mStateTracker.onBindVertexBuffers(bindingCount, buffers, offsets, strides))
+    {
+        return;
+    }
+
     uint8_t *writePtr;
     const ArrayParamSize buffersSize      = calculateArrayParameterSize<VkBuffer>(bindingCount);
     const ArrayParamSize offsetsSize      = calculateArrayParameterSize<VkDeviceSize>(bindingCount);
@@ -1597,13 +1770,30 @@ ANGLE_INLINE void SecondaryCommandBuffer::copyImageToBuffer(const Image &srcImag
                                                             uint32_t regionCount,
                                                             const VkBufferImageCopy *regions)
 {
-    ASSERT(regionCount == 1);
-    CopyImageToBufferParams *paramStruct =
-        initCommand<CopyImageToBufferParams>(CommandID::CopyImageToBuffer);
-    paramStruct->srcImage       = srcImage.getHandle();
-    paramStruct->srcImageLayout = srcImageLayout;
-    paramStruct->dstBuffer      = dstBuffer;
-    paramStruct->region         = regions[0];
+    // The size of a command must fit in its header, so a long list of regions is split.
+    constexpr uint32_t kMaxRegionsPerCommand = static_cast<uint32_t>(
+        (std::numeric_limits<uint16_t>::max() - sizeof(CopyImageToBufferParams)) /
+        sizeof(VkBufferImageCopy));
+
+    while (regionCount > 0)
+    {
+        const uint32_t commandRegionCount = std::min(regionCount, kMaxRegionsPerCommand);
+
+        uint8_t *writePtr;
+        const ArrayParamSize regionSize =
+            calculateArrayParameterSize<VkBufferImageCopy>(commandRegionCount);
+        CopyImageToBufferParams *paramStruct = initCommand<CopyImageToBufferParams>(
+            CommandID::CopyImageToBuffer, regionSize.allocateBytes, &writePtr);
+        paramStruct->srcImage       = srcImage.getHandle();
+        paramStruct->srcImageLayout = srcImageLayout;
+        paramStruct->dstBuffer      = dstBuffer;
+        paramStruct->regionCount    = commandRegionCount;
+        // Copy variable sized data
+        storeArrayParameter(writePtr, regions, regionSize);
+
+        regions += commandRegionCount;
+        regionCount -= commandRegionCount;
+    }
 }
 
 ANGLE_INLINE void SecondaryCommandBuffer::dispatch(uint32_t groupCountX,
@@ -1879,6 +2069,8 @@ ANGLE_INLINE void SecondaryCommandBuffer::nextSubpass(VkSubpassContents subpassC
 {
     ASSERT(subpassContents == VK_SUBPASS_CONTENTS_INLINE);
     initCommand<EmptyParams>(CommandID::NextSubpass);
+    // The pipelines of the next subpass are different anyway, don't carry any state over.
+    mStateTracker.invalidate();
 }
 
 ANGLE_INLINE void SecondaryCommandBuffer::pipelineBarrier(
@@ -2015,56 +2207,64 @@ ANGLE_INLINE void SecondaryCommandBuffer::resolveImage(const Image &srcImage,
 
 ANGLE_INLINE void SecondaryCommandBuffer::setBlendConstants(const float blendConstants[4])
 {
-    SetBlendConstantsParams *paramStruct =
-        initCommand<SetBlendConstantsParams>(CommandID::SetBlendConstants);
+    SetBlendConstantsParams params =
+        initDynamicStateParams<SetBlendConstantsParams>(CommandID::SetBlendConstants);
     for (uint32_t channel = 0; channel < 4; ++channel)
     {
-        paramStruct->blendConstants[channel] = blendConstants[channel];
+        params.blendConstants[channel] = blendConstants[channel];
     }
+    recordDynamicState(params);
 }
 
 ANGLE_INLINE void SecondaryCommandBuffer::setCullMode(VkCullModeFlags cullMode)
 {
-    SetCullModeParams *paramStruct = initCommand<SetCullModeParams>(CommandID::SetCullMode);
-    paramStruct->cullMode          = cullMode;
+    SetCullModeParams params = initDynamicStateParams<SetCullModeParams>(CommandID::SetCullMode);
+    params.cullMode          = cullMode;
+    recordDynamicState(params);
 }
 
 ANGLE_INLINE void SecondaryCommandBuffer::setDepthBias(float depthBiasConstantFactor,
                                                        float depthBiasClamp,
                                                        float depthBiasSlopeFactor)
 {
-    SetDepthBiasParams *paramStruct      = initCommand<SetDepthBiasParams>(CommandID::SetDepthBias);
-    paramStruct->depthBiasConstantFactor = depthBiasConstantFactor;
-    paramStruct->depthBiasClamp          = depthBiasClamp;
-    paramStruct->depthBiasSlopeFactor    = depthBiasSlopeFactor;
+    SetDepthBiasParams params =
+        initDynamicStateParams<SetDepthBiasParams>(CommandID::SetDepthBias);
+    params.depthBiasConstantFactor = depthBiasConstantFactor;
+    params.depthBiasClamp          = depthBiasClamp;
+    params.depthBiasSlopeFactor    = depthBiasSlopeFactor;
+    recordDynamicState(params);
 }
 
 ANGLE_INLINE void SecondaryCommandBuffer::setDepthBiasEnable(VkBool32 depthBiasEnable)
 {
-    SetDepthBiasEnableParams *paramStruct =
-        initCommand<SetDepthBiasEnableParams>(CommandID::SetDepthBiasEnable);
-    paramStruct->depthBiasEnable = depthBiasEnable;
+    SetDepthBiasEnableParams params =
+        initDynamicStateParams<SetDepthBiasEnableParams>(CommandID::SetDepthBiasEnable);
+    params.depthBiasEnable = depthBiasEnable;
+    recordDynamicState(params);
 }
 
 ANGLE_INLINE void SecondaryCommandBuffer::setDepthCompareOp(VkCompareOp depthCompareOp)
 {
-    SetDepthCompareOpParams *paramStruct =
-        initCommand<SetDepthCompareOpParams>(CommandID::SetDepthCompareOp);
-    paramStruct->depthCompareOp = depthCompareOp;
+    SetDepthCompareOpParams params =
+        initDynamicStateParams<SetDepthCompareOpParams>(CommandID::SetDepthCompareOp);
+    params.depthCompareOp = depthCompareOp;
+    recordDynamicState(params);
 }
 
 ANGLE_INLINE void SecondaryCommandBuffer::setDepthTestEnable(VkBool32 depthTestEnable)
 {
-    SetDepthTestEnableParams *paramStruct =
-        initCommand<SetDepthTestEnableParams>(CommandID::SetDepthTestEnable);
-    paramStruct->depthTestEnable = depthTestEnable;
+    SetDepthTestEnableParams params =
+        initDynamicStateParams<SetDepthTestEnableParams>(CommandID::SetDepthTestEnable);
+    params.depthTestEnable = depthTestEnable;
+    recordDynamicState(params);
 }
 
 ANGLE_INLINE void SecondaryCommandBuffer::setDepthWriteEnable(VkBool32 depthWriteEnable)
 {
-    SetDepthWriteEnableParams *paramStruct =
-        initCommand<SetDepthWriteEnableParams>(CommandID::SetDepthWriteEnable);
-    paramStruct->depthWriteEnable = depthWriteEnable;
+    SetDepthWriteEnableParams params =
+        initDynamicStateParams<SetDepthWriteEnableParams>(CommandID::SetDepthWriteEnable);
+    params.depthWriteEnable = depthWriteEnable;
+    recordDynamicState(params);
 }
 
 ANGLE_INLINE void SecondaryCommandBuffer::setEvent(VkEvent event, VkPipelineStageFlags stageMask)
@@ -2088,44 +2288,52 @@ ANGLE_INLINE void SecondaryCommandBuffer::setFragmentShadingRate(
     ASSERT(fragmentSize->width <= 4);
     ASSERT(fragmentSize->height <= 4);
 
-    SetFragmentShadingRateParams *paramStruct =
-        initCommand<SetFragmentShadingRateParams>(CommandID::SetFragmentShadingRate);
-    paramStruct->fragmentWidth                    = static_cast<uint16_t>(fragmentSize->width);
-    paramStruct->fragmentHeight                   = static_cast<uint16_t>(fragmentSize->height);
-    paramStruct->vkFragmentShadingRateCombinerOp1 = static_cast<uint16_t>(ops[1]);
+    SetFragmentShadingRateParams params =
+        initDynamicStateParams<SetFragmentShadingRateParams>(CommandID::SetFragmentShadingRate);
+    params.fragmentWidth                    = static_cast<uint16_t>(fragmentSize->width);
+    params.fragmentHeight                   = static_cast<uint16_t>(fragmentSize->height);
+    params.vkFragmentShadingRateCombinerOp1 = static_cast<uint16_t>(ops[1]);
+    recordDynamicState(params);
 }
 
 ANGLE_INLINE void SecondaryCommandBuffer::setFrontFace(VkFrontFace frontFace)
 {
-    SetFrontFaceParams *paramStruct = initCommand<SetFrontFaceParams>(CommandID::SetFrontFace);
-    paramStruct->frontFace          = frontFace;
+    SetFrontFaceParams params = initDynamicStateParams<SetFrontFaceParams>(CommandID::SetFrontFace);
+    params.frontFace          = frontFace;
+    recordDynamicState(params);
 }
 
 ANGLE_INLINE void SecondaryCommandBuffer::setLineWidth(float lineWidth)
 {
-    SetLineWidthParams *paramStruct = initCommand<SetLineWidthParams>(CommandID::SetLineWidth);
-    paramStruct->lineWidth          = lineWidth;
+    SetLineWidthParams params = initDynamicStateParams<SetLineWidthParams>(CommandID::SetLineWidth);
+    params.lineWidth          = lineWidth;
+    recordDynamicState(params);
 }
 
 ANGLE_INLINE void SecondaryCommandBuffer::setLogicOp(VkLogicOp logicOp)
 {
-    SetLogicOpParams *paramStruct = initCommand<SetLogicOpParams>(CommandID::SetLogicOp);
-    paramStruct->logicOp          = logicOp;
+    SetLogicOpParams params = initDynamicStateParams<SetLogicOpParams>(CommandID::SetLogicOp);
+    params.logicOp          = logicOp;
+    recordDynamicState(params);
 }
 
 ANGLE_INLINE void SecondaryCommandBuffer::setPrimitiveRestartEnable(VkBool32 primitiveRestartEnable)
 {
-    SetPrimitiveRestartEnableParams *paramStruct =
-        initCommand<SetPrimitiveRestartEnableParams>(CommandID::SetPrimitiveRestartEnable);
-    paramStruct->primitiveRestartEnable = primitiveRestartEnable;
+    SetPrimitiveRestartEnableParams params =
+        initDynamicStateParams<SetPrimitiveRestartEnableParams>(
+            CommandID::SetPrimitiveRestartEnable);
+    params.primitiveRestartEnable = primitiveRestartEnable;
+    recordDynamicState(params);
 }
 
 ANGLE_INLINE void SecondaryCommandBuffer::setRasterizerDiscardEnable(
     VkBool32 rasterizerDiscardEnable)
 {
-    SetRasterizerDiscardEnableParams *paramStruct =
-        initCommand<SetRasterizerDiscardEnableParams>(CommandID::SetRasterizerDiscardEnable);
-    paramStruct->rasterizerDiscardEnable = rasterizerDiscardEnable;
+    SetRasterizerDiscardEnableParams params =
+        initDynamicStateParams<SetRasterizerDiscardEnableParams>(
+            CommandID::SetRasterizerDiscardEnable);
+    params.rasterizerDiscardEnable = rasterizerDiscardEnable;
+    recordDynamicState(params);
 }
 
 ANGLE_INLINE void SecondaryCommandBuffer::setScissor(uint32_t firstScissor,
@@ -2135,17 +2343,19 @@ ANGLE_INLINE void SecondaryCommandBuffer::setScissor(uint32_t firstScissor,
     ASSERT(firstScissor == 0);
     ASSERT(scissorCount == 1);
     ASSERT(scissors != nullptr);
-    SetScissorParams *paramStruct = initCommand<SetScissorParams>(CommandID::SetScissor);
-    paramStruct->scissor          = scissors[0];
+    SetScissorParams params = initDynamicStateParams<SetScissorParams>(CommandID::SetScissor);
+    params.scissor          = scissors[0];
+    recordDynamicState(params);
 }
 
 ANGLE_INLINE void SecondaryCommandBuffer::setStencilCompareMask(uint32_t compareFrontMask,
                                                                 uint32_t compareBackMask)
 {
-    SetStencilCompareMaskParams *paramStruct =
-        initCommand<SetStencilCompareMaskParams>(CommandID::SetStencilCompareMask);
-    paramStruct->compareFrontMask = static_cast<uint16_t>(compareFrontMask);
-    paramStruct->compareBackMask  = static_cast<uint16_t>(compareBackMask);
+    SetStencilCompareMaskParams params =
+        initDynamicStateParams<SetStencilCompareMaskParams>(CommandID::SetStencilCompareMask);
+    params.compareFrontMask = static_cast<uint16_t>(compareFrontMask);
+    params.compareBackMask  = static_cast<uint16_t>(compareBackMask);
+    recordDynamicState(params);
 }
 
 ANGLE_INLINE void SecondaryCommandBuffer::setStencilOp(VkStencilFaceFlags faceMask,
@@ -2154,37 +2364,41 @@ ANGLE_INLINE void SecondaryCommandBuffer::setStencilOp(VkStencilFaceFlags faceMa
                                                        VkStencilOp depthFailOp,
                                                        VkCompareOp compareOp)
 {
-    SetStencilOpParams *paramStruct = initCommand<SetStencilOpParams>(CommandID::SetStencilOp);
-    SetBitField(paramStruct->faceMask, faceMask);
-    SetBitField(paramStruct->failOp, failOp);
-    SetBitField(paramStruct->passOp, passOp);
-    SetBitField(paramStruct->depthFailOp, depthFailOp);
-    SetBitField(paramStruct->compareOp, compareOp);
+    SetStencilOpParams params = initDynamicStateParams<SetStencilOpParams>(CommandID::SetStencilOp);
+    SetBitField(params.faceMask, faceMask);
+    SetBitField(params.failOp, failOp);
+    SetBitField(params.passOp, passOp);
+    SetBitField(params.depthFailOp, depthFailOp);
+    SetBitField(params.compareOp, compareOp);
+    recordDynamicState(params);
 }
 
 ANGLE_INLINE void SecondaryCommandBuffer::setStencilReference(uint32_t frontReference,
                                                               uint32_t backReference)
 {
-    SetStencilReferenceParams *paramStruct =
-        initCommand<SetStencilReferenceParams>(CommandID::SetStencilReference);
-    paramStruct->frontReference = static_cast<uint16_t>(frontReference);
-    paramStruct->backReference  = static_cast<uint16_t>(backReference);
+    SetStencilReferenceParams params =
+        initDynamicStateParams<SetStencilReferenceParams>(CommandID::SetStencilReference);
+    params.frontReference = static_cast<uint16_t>(frontReference);
+    params.backReference  = static_cast<uint16_t>(backReference);
+    recordDynamicState(params);
 }
 
 ANGLE_INLINE void SecondaryCommandBuffer::setStencilTestEnable(VkBool32 stencilTestEnable)
 {
-    SetStencilTestEnableParams *paramStruct =
-        initCommand<SetStencilTestEnableParams>(CommandID::SetStencilTestEnable);
-    paramStruct->stencilTestEnable = stencilTestEnable;
+    SetStencilTestEnableParams params =
+        initDynamicStateParams<SetStencilTestEnableParams>(CommandID::SetStencilTestEnable);
+    params.stencilTestEnable = stencilTestEnable;
+    recordDynamicState(params);
 }
 
 ANGLE_INLINE void SecondaryCommandBuffer::setStencilWriteMask(uint32_t writeFrontMask,
                                                               uint32_t writeBackMask)
 {
-    SetStencilWriteMaskParams *paramStruct =
-        initCommand<SetStencilWriteMaskParams>(CommandID::SetStencilWriteMask);
-    paramStruct->writeFrontMask = static_cast<uint16_t>(writeFrontMask);
-    paramStruct->writeBackMask  = static_cast<uint16_t>(writeBackMask);
+    SetStencilWriteMaskParams params =
+        initDynamicStateParams<SetStencilWriteMaskParams>(CommandID::SetStencilWriteMask);
+    params.writeFrontMask = static_cast<uint16_t>(writeFrontMask);
+    params.writeBackMask  = static_cast<uint16_t>(writeBackMask);
+    recordDynamicState(params);
 }
 
 ANGLE_INLINE void SecondaryCommandBuffer::setVertexInput(
@@ -2228,8 +2442,9 @@ ANGLE_INLINE void SecondaryCommandBuffer::setViewport(uint32_t firstViewport,
     ASSERT(firstViewport == 0);
     ASSERT(viewportCount == 1);
     ASSERT(viewports != nullptr);
-    SetViewportParams *paramStruct = initCommand<SetViewportParams>(CommandID::SetViewport);
-    paramStruct->viewport          = viewports[0];
+    SetViewportParams params = initDynamicStateParams<SetViewportParams>(CommandID::SetViewport);
+    params.viewport          = viewports[0];
+    recordDynamicState(params);
 }
 
 ANGLE_INLINE void SecondaryCommandBuffer::waitEvents(
@@ -0,0 +1,192 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// SecondaryCommandBuffer_unittest:
+//   Unit tests for the tracking of redundant state commands in SecondaryCommandBuffer.
+//
+
+#include <gtest/gtest.h>
+
+#include "libANGLE/renderer/vulkan/SecondaryCommandBuffer.h"
+
+namespace rx
+{
+namespace vk
+{
+namespace priv
+{
+namespace
+{
+// Non-dispatchable handles are pointers on 64-bit platforms and integers on 32-bit ones.
+template <typename HandleT>
+HandleT FakeHandle(uint64_t value)
+{
+    static_assert(sizeof(HandleT) <= sizeof(value), "Unexpected handle size");
+    HandleT handle;
+    memcpy(&handle, &value, sizeof(handle));
+    return handle;
+}
+
+template <class StructType>
+StructType MakeDynamicStateParams(CommandID id)
+{
+    StructType params;
+    memset(&params, 0, sizeof(params));
+    params.header.id   = id;
+    params.header.size = static_cast<uint16_t>(sizeof(StructType));
+    return params;
+}
+
+SetViewportParams MakeViewport(float width)
+{
+    SetViewportParams params = MakeDynamicStateParams<SetViewportParams>(CommandID::SetViewport);
+    params.viewport.width    = width;
+    params.viewport.height   = 1.0f;
+    params.viewport.maxDepth = 1.0f;
+    return params;
+}
+
+SetCullModeParams MakeCullMode(VkCullModeFlags cullMode)
+{
+    SetCullModeParams params = MakeDynamicStateParams<SetCullModeParams>(CommandID::SetCullMode);
+    params.cullMode          = cullMode;
+    return params;
+}
+
+class RedundantStateTrackerTest : public testing::Test
+{
+  protected:
+    bool bindDescriptorSet(VkPipelineLayout layout, uint32_t set, VkDescriptorSet descriptorSet)
+    {
+        return mTracker.onBindDescriptorSets(layout, VK_PIPELINE_BIND_POINT_GRAPHICS, set, 1,
+                                             &descriptorSet, 0, nullptr);
+    }
+
+    bool bindVertexBuffer(VkBuffer buffer)
+    {
+        const VkDeviceSize offset = 0;
+        return mTracker.onBindVertexBuffers(1, &buffer, &offset, nullptr);
+    }
+
+    RedundantStateTracker mTracker;
+
+    const VkPipeline mPipeline1           = FakeHandle<VkPipeline>(1);
+    const VkPipeline mPipeline2           = FakeHandle<VkPipeline>(2);
+    const VkPipelineLayout mLayout1       = FakeHandle<VkPipelineLayout>(3);
+    const VkPipelineLayout mLayout2       = FakeHandle<VkPipelineLayout>(4);
+    const VkDescriptorSet mDescriptorSet1 = FakeHandle<VkDescriptorSet>(5);
+    const VkDescriptorSet mDescriptorSet2 = FakeHandle<VkDescriptorSet>(6);
+    const VkBuffer mBuffer                = FakeHandle<VkBuffer>(7);
+};
+
+// Tests that binding the bound pipeline again is skipped, separately for each bind point.
+TEST_F(RedundantStateTrackerTest, PipelineBind)
+{
+    EXPECT_FALSE(mTracker.onBindPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS, mPipeline1));
+    EXPECT_TRUE(mTracker.onBindPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS, mPipeline1));
+    EXPECT_FALSE(mTracker.onBindPipeline(VK_PIPELINE_BIND_POINT_COMPUTE, mPipeline1));
+
+    EXPECT_FALSE(mTracker.onBindPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS, mPipeline2));
+    EXPECT_FALSE(mTracker.onBindPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS, mPipeline1));
+    EXPECT_TRUE(mTracker.onBindPipeline(VK_PIPELINE_BIND_POINT_COMPUTE, mPipeline1));
+
+    EXPECT_EQ(2u, mTracker.getSkippedCommandCount());
+}
+
+// Tests that binding a graphics pipeline forgets the dynamic states that pipelines may have as
+// static state, and keeps the others.
+TEST_F(RedundantStateTrackerTest, PipelineBindForgetsPipelineDynamicState)
+{
+    EXPECT_FALSE(mTracker.onSetDynamicState(MakeViewport(16.0f)));
+    EXPECT_FALSE(mTracker.onSetDynamicState(MakeCullMode(VK_CULL_MODE_BACK_BIT)));
+    EXPECT_TRUE(mTracker.onSetDynamicState(MakeViewport(16.0f)));
+    EXPECT_TRUE(mTracker.onSetDynamicState(MakeCullMode(VK_CULL_MODE_BACK_BIT)));
+
+    EXPECT_FALSE(mTracker.onBindPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS, mPipeline1));
+    EXPECT_TRUE(mTracker.onSetDynamicState(MakeViewport(16.0f)));
+    EXPECT_FALSE(mTracker.onSetDynamicState(MakeCullMode(VK_CULL_MODE_BACK_BIT)));
+
+    // A compute pipeline doesn't affect the graphics state.
+    EXPECT_FALSE(mTracker.onBindPipeline(VK_PIPELINE_BIND_POINT_COMPUTE, mPipeline2));
+    EXPECT_TRUE(mTracker.onSetDynamicState(MakeCullMode(VK_CULL_MODE_BACK_BIT)));
+
+    // A different value is never skipped.
+    EXPECT_FALSE(mTracker.onSetDynamicState(MakeViewport(32.0f)));
+}
+
+// Tests that binding descriptor sets with a different layout forgets the sets bound with the
+// previous one.
+TEST_F(RedundantStateTrackerTest, DescriptorSetLayoutChange)
+{
+    EXPECT_FALSE(bindDescriptorSet(mLayout1, 0, mDescriptorSet1));
+    EXPECT_FALSE(bindDescriptorSet(mLayout1, 1, mDescriptorSet2));
+    EXPECT_TRUE(bindDescriptorSet(mLayout1, 0, mDescriptorSet1));
+    EXPECT_TRUE(bindDescriptorSet(mLayout1, 1, mDescriptorSet2));
+
+    // The same set with another layout isn't redundant.
+    EXPECT_FALSE(bindDescriptorSet(mLayout2, 1, mDescriptorSet2));
+    EXPECT_FALSE(bindDescriptorSet(mLayout1, 0, mDescriptorSet1));
+    EXPECT_FALSE(bindDescriptorSet(mLayout1, 1, mDescriptorSet2));
+}
+
+// Tests that descriptor sets are only redundant if their dynamic offsets match.
+TEST_F(RedundantStateTrackerTest, DescriptorSetDynamicOffsets)
+{
+    const uint32_t offsets1[2] = {0, 256};
+    const uint32_t offsets2[2] = {0, 512};
+
+    EXPECT_FALSE(mTracker.onBindDescriptorSets(mLayout1, VK_PIPELINE_BIND_POINT_GRAPHICS, 0, 1,
+                                               &mDescriptorSet1, 2, offsets1));
+    EXPECT_TRUE(mTracker.onBindDescriptorSets(mLayout1, VK_PIPELINE_BIND_POINT_GRAPHICS, 0, 1,
+                                              &mDescriptorSet1, 2, offsets1));
+    EXPECT_FALSE(mTracker.onBindDescriptorSets(mLayout1, VK_PIPELINE_BIND_POINT_GRAPHICS, 0, 1,
+                                               &mDescriptorSet1, 2, offsets2));
+    EXPECT_FALSE(mTracker.onBindDescriptorSets(mLayout1, VK_PIPELINE_BIND_POINT_GRAPHICS, 0, 1,
+                                               &mDescriptorSet1, 0, nullptr));
+}
+
+// Tests that invalidating the state, as done by nextSubpass, forgets all of it but keeps the count
+// of skipped commands.
+TEST_F(RedundantStateTrackerTest, Invalidate)
+{
+    EXPECT_FALSE(mTracker.onBindPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS, mPipeline1));
+    EXPECT_FALSE(bindDescriptorSet(mLayout1, 0, mDescriptorSet1));
+    EXPECT_FALSE(mTracker.onBindIndexBuffer(mBuffer, 0, VK_INDEX_TYPE_UINT16));
+    EXPECT_FALSE(bindVertexBuffer(mBuffer));
+    EXPECT_FALSE(mTracker.onSetDynamicState(MakeViewport(16.0f)));
+    EXPECT_TRUE(mTracker.onBindIndexBuffer(mBuffer, 0, VK_INDEX_TYPE_UINT16));
+    EXPECT_EQ(1u, mTracker.getSkippedCommandCount());
+
+    mTracker.invalidate();
+
+    EXPECT_FALSE(mTracker.onBindPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS, mPipeline1));
+    EXPECT_FALSE(bindDescriptorSet(mLayout1, 0, mDescriptorSet1));
+    EXPECT_FALSE(mTracker.onBindIndexBuffer(mBuffer, 0, VK_INDEX_TYPE_UINT16));
+    EXPECT_FALSE(bindVertexBuffer(mBuffer));
+    EXPECT_FALSE(mTracker.onSetDynamicState(MakeViewport(16.0f)));
+    EXPECT_EQ(1u, mTracker.getSkippedCommandCount());
+}
+
+// Tests that resetting the tracker, as done when the command buffer is reset, forgets the state
+// and the count of skipped commands.
+TEST_F(RedundantStateTrackerTest, Reset)
+{
+    EXPECT_FALSE(mTracker.onBindPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS, mPipeline1));
+    EXPECT_TRUE(mTracker.onBindPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS, mPipeline1));
+    EXPECT_FALSE(bindVertexBuffer(mBuffer));
+    EXPECT_TRUE(bindVertexBuffer(mBuffer));
+    EXPECT_EQ(2u, mTracker.getSkippedCommandCount());
+
+    mTracker.reset();
+    EXPECT_EQ(0u, mTracker.getSkippedCommandCount());
+
+    EXPECT_FALSE(mTracker.onBindPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS, mPipeline1));
+    EXPECT_FALSE(bindVertexBuffer(mBuffer));
+    EXPECT_EQ(0u, mTracker.getSkippedCommandCount());
+}
+}  // anonymous namespace
+}  // namespace priv
+}  // namespace vk
+}  // namespace rx
@@ -40,6 +40,26 @@ void SaveShaderInterfaceVariableXfbInfo(const ShaderInterfaceVariableXfbInfo &xf
         SaveShaderInterfaceVariableXfbInfo(arrayElement, stream);
     }
 }
+
+template <typename T>
+void AppendWords(const T &value, std::vector<uint32_t> *descOut)
+{
+    static_assert(sizeof(T) % sizeof(uint32_t) == 0, "Only whole words can be appended");
+    const size_t offset = descOut->size();
+    descOut->resize(offset + sizeof(T) / sizeof(uint32_t));
+    memcpy(descOut->data() + offset, &value, sizeof(T));
+}
+
+void AppendShaderInterfaceVariableXfbInfo(const ShaderInterfaceVariableXfbInfo &xfb,
+                                          std::vector<uint32_t> *descOut)
+{
+    AppendWords(xfb.pod, descOut);
+    descOut->push_back(static_cast<uint32_t>(xfb.arrayElements.size()));
+    for (const ShaderInterfaceVariableXfbInfo &arrayElement : xfb.arrayElements)
+    {
+        AppendShaderInterfaceVariableXfbInfo(arrayElement, descOut);
+    }
+}
 }  // anonymous namespace
 
 // ShaderInterfaceVariableInfoMap implementation.
@@ -246,6 +266,42 @@ bool ShaderInterfaceVariableInfoMap::hasVariable(gl::ShaderType shaderType, uint
            mIdToIndexMap[shaderType].at(hashedId).index != VariableIndex::kInvalid;
 }
 
+void ShaderInterfaceVariableInfoMap::appendTransformDesc(gl::ShaderType shaderType,
+                                                         std::vector<uint32_t> *descOut) const
+{
+    descOut->push_back(mPod.inputPerVertexActiveMembers[shaderType].bits());
+    descOut->push_back(mPod.outputPerVertexActiveMembers[shaderType].bits());
+    descOut->push_back(mPod.hasAliasingAttributes);
+
+    // The variables are looked up by id, so the ids are part of the description too.  The
+    // transformer doesn't see the variables of the other stages.
+    const IdToIndexMap &idToIndexMap = mIdToIndexMap[shaderType];
+    for (uint32_t hashedId = 0; hashedId < idToIndexMap.size(); ++hashedId)
+    {
+        const VariableIndex &variableIndex = idToIndexMap.at(hashedId);
+        if (variableIndex.index == VariableIndex::kInvalid)
+        {
+            continue;
+        }
+
+        const ShaderInterfaceVariableInfo &info = mData[variableIndex.index];
+        descOut->push_back(hashedId);
+        AppendWords(info, descOut);
+
+        if (info.hasTransformFeedback && variableIndex.index < mXFBData.size() &&
+            mXFBData[variableIndex.index])
+        {
+            const XFBInterfaceVariableInfo &xfbInfo = *mXFBData[variableIndex.index];
+            AppendShaderInterfaceVariableXfbInfo(xfbInfo.xfb, descOut);
+            descOut->push_back(static_cast<uint32_t>(xfbInfo.fieldXfb.size()));
+            for (const ShaderInterfaceVariableXfbInfo &fieldXfb : xfbInfo.fieldXfb)
+            {
+                AppendShaderInterfaceVariableXfbInfo(fieldXfb, descOut);
+            }
+        }
+    }
+}
+
 bool ShaderInterfaceVariableInfoMap::hasTransformFeedbackInfo(gl::ShaderType shaderType,
                                                               uint32_t bufferIndex) const
 {
@@ -100,6 +100,10 @@ class ShaderInterfaceVariableInfoMap final : angle::NonCopyable
     void setHasAliasingAttributes() { mPod.hasAliasingAttributes = true; }
     bool hasAliasingAttributes() const { return mPod.hasAliasingAttributes; }
 
+    // Appends everything the SPIR-V transformer reads from this map for |shaderType| to |descOut|.
+    // Programs whose maps append the same words get the same transformed SPIR-V from a shader.
+    void appendTransformDesc(gl::ShaderType shaderType, std::vector<uint32_t> *descOut) const;
+
   private:
     void setVariableIndex(gl::ShaderType shaderType, uint32_t id, VariableIndex index);
     const VariableIndex &getVariableIndex(gl::ShaderType shaderType, uint32_t id) const;
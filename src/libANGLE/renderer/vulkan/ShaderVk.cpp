@@ -46,6 +46,11 @@ std::shared_ptr<ShaderTranslateTask> ShaderVk::compile(const gl::Context *contex
         options->emitSPIRV14 = true;
     }
 
+    if (contextVk->getFeatures().supportsShaderDrawParameters.enabled)
+    {
+        options->addDrawIndexToGLDrawID = true;
+    }
+
     if (contextVk->getFeatures().retainSPIRVDebugInfo.enabled)
     {
         options->outputDebugInfo = true;
@@ -255,6 +255,7 @@ class BufferSuballocationGarbage
     bool destroyIfComplete(Renderer *renderer);
     bool hasResourceUseSubmitted(Renderer *renderer) const;
     VkDeviceSize getSize() const { return mSuballocation.getSize(); }
+    size_t getObjectCount() const { return 1; }
     bool isSuballocated() const { return mSuballocation.isSuballocated(); }
 
   private:
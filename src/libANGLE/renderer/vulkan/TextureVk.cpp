@@ -11,7 +11,7 @@
 #include <vulkan/vulkan.h>
 
 #include "common/debug.h"
-#include "image_util/generatemip.inc"
+#include "image_util/generatemip.h"
 #include "libANGLE/Config.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/Image.h"
@@ -2540,11 +2540,11 @@ angle::Result TextureVk::generateMipmapsWithCPU(const gl::Context *context)
     {
         size_t bufferOffset = layer * baseLevelAllocationSize;
 
-        ANGLE_TRY(generateMipmapLevelsWithCPU(contextVk, angleFormat, layer, baseLevelGL + 1,
-                                              gl::LevelIndex(mState.getMipmapMaxLevel()),
-                                              baseLevelExtents.width, baseLevelExtents.height,
-                                              baseLevelExtents.depth, sourceRowPitch,
-                                              sourceDepthPitch, imageData + bufferOffset));
+        ANGLE_TRY(generateMipmapLevelsWithCPU(
+            contextVk, context->getWorkerThreadPool().get(), angleFormat, layer, baseLevelGL + 1,
+            gl::LevelIndex(mState.getMipmapMaxLevel()), baseLevelExtents.width,
+            baseLevelExtents.height, baseLevelExtents.depth, sourceRowPitch, sourceDepthPitch,
+            imageData + bufferOffset));
     }
 
     ASSERT(!TextureHasAnyRedefinedLevels(mRedefinedLevels));
@@ -4107,6 +4107,7 @@ uint32_t TextureVk::getMaxLevelCount() const
 }
 
 angle::Result TextureVk::generateMipmapLevelsWithCPU(ContextVk *contextVk,
+                                                     angle::WorkerThreadPool *workerPool,
                                                      const angle::Format &sourceFormat,
                                                      GLuint layer,
                                                      gl::LevelIndex firstMipLevel,
@@ -4118,13 +4119,12 @@ angle::Result TextureVk::generateMipmapLevelsWithCPU(ContextVk *contextVk,
                                                      const size_t sourceDepthPitch,
                                                      uint8_t *sourceData)
 {
-    size_t previousLevelWidth      = sourceWidth;
-    size_t previousLevelHeight     = sourceHeight;
-    size_t previousLevelDepth      = sourceDepth;
-    uint8_t *previousLevelData     = sourceData;
-    size_t previousLevelRowPitch   = sourceRowPitch;
-    size_t previousLevelDepthPitch = sourceDepthPitch;
+    size_t previousLevelWidth  = sourceWidth;
+    size_t previousLevelHeight = sourceHeight;
+    size_t previousLevelDepth  = sourceDepth;
 
+    // Stage all the levels first, so they can be generated in one pass over the source.
+    std::vector<angle::MipLevelData> levels;
     for (gl::LevelIndex currentMipLevel = firstMipLevel; currentMipLevel <= maxMipLevel;
          ++currentMipLevel)
     {
@@ -4147,20 +4147,18 @@ angle::Result TextureVk::generateMipmapLevelsWithCPU(ContextVk *contextVk,
             gl::ImageIndex::MakeFromType(mState.getType(), currentMipLevel.get(), layer),
             mipLevelExtents, gl::Offset(), &destData, sourceFormat.id));
 
-        // Generate the mipmap into that new buffer
-        sourceFormat.mipGenerationFunction(
-            previousLevelWidth, previousLevelHeight, previousLevelDepth, previousLevelData,
-            previousLevelRowPitch, previousLevelDepthPitch, destData, destRowPitch, destDepthPitch);
+        levels.push_back({destData, destRowPitch, destDepthPitch});
 
-        // Swap for the next iteration
-        previousLevelWidth      = mipWidth;
-        previousLevelHeight     = mipHeight;
-        previousLevelDepth      = mipDepth;
-        previousLevelData       = destData;
-        previousLevelRowPitch   = destRowPitch;
-        previousLevelDepthPitch = destDepthPitch;
+        previousLevelWidth  = mipWidth;
+        previousLevelHeight = mipHeight;
+        previousLevelDepth  = mipDepth;
     }
 
+    // Generate the mipmaps into the new buffers.
+    angle::GenerateMipChain(sourceFormat.mipGenerationFunction, workerPool, sourceWidth,
+                            sourceHeight, sourceDepth, sourceData, sourceRowPitch,
+                            sourceDepthPitch, levels.data(), levels.size());
+
     return angle::Result::Continue;
 }
 
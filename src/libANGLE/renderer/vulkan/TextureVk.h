@@ -469,6 +469,7 @@ class TextureVk : public TextureImpl, public angle::ObserverInterface
     angle::Result generateMipmapsWithCPU(const gl::Context *context);
 
     angle::Result generateMipmapLevelsWithCPU(ContextVk *contextVk,
+                                              angle::WorkerThreadPool *workerPool,
                                               const angle::Format &sourceFormat,
                                               GLuint layer,
                                               gl::LevelIndex firstMipLevel,
@@ -1960,11 +1960,13 @@ angle::Result UtilsVk::setupGraphicsProgramWithLayout(
     const vk::GraphicsPipelineDesc *descPtr;
     vk::PipelineHelper *helper;
 
-    if (!programAndPipelines->pipelines.getPipeline(*pipelineDesc, &descPtr, &helper))
+    const size_t descHash = pipelineDesc->hash(vk::GraphicsPipelineSubset::Complete);
+    if (!programAndPipelines->pipelines.getPipeline(*pipelineDesc, descHash, &descPtr, &helper))
     {
         ANGLE_TRY(programAndPipelines->program.createGraphicsPipeline(
             contextVk, &programAndPipelines->pipelines, &pipelineCache, *compatibleRenderPass,
-            pipelineLayout, PipelineSource::Utils, *pipelineDesc, {}, &descPtr, &helper));
+            pipelineLayout, PipelineSource::Utils, *pipelineDesc, descHash, {}, &descPtr,
+            &helper));
     }
 
     contextVk->getStartedRenderPassCommands().retainResource(helper);
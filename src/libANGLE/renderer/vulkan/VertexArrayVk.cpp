@@ -9,6 +9,7 @@
 
 #include "libANGLE/renderer/vulkan/VertexArrayVk.h"
 
+#include "common/WorkerThread.h"
 #include "common/debug.h"
 #include "common/utilities.h"
 #include "libANGLE/Context.h"
@@ -657,7 +658,7 @@ angle::Result VertexArrayVk::convertVertexBufferGPU(ContextVk *contextVk,
     return angle::Result::Continue;
 }
 
-angle::Result VertexArrayVk::convertVertexBufferCPU(ContextVk *contextVk,
+angle::Result VertexArrayVk::convertVertexBufferCPU(const gl::Context *context,
                                                     BufferVk *srcBuffer,
                                                     VertexConversionBuffer *conversion,
                                                     const angle::Format &srcFormat,
@@ -666,6 +667,8 @@ angle::Result VertexArrayVk::convertVertexBufferCPU(ContextVk *contextVk,
 {
     ANGLE_TRACE_EVENT0("gpu.angle", "VertexArrayVk::convertVertexBufferCpu");
 
+    ContextVk *contextVk = vk::GetImpl(context);
+
     size_t maxNumVertices;
     ANGLE_TRY(CalculateMaxVertexCountForConversion(contextVk, srcBuffer, conversion, srcFormat,
                                                    dstFormat, &maxNumVertices));
@@ -676,16 +679,26 @@ angle::Result VertexArrayVk::convertVertexBufferCPU(ContextVk *contextVk,
 
     uint8_t *src = nullptr;
     ANGLE_TRY(srcBuffer->mapImpl(contextVk, GL_MAP_READ_BIT, reinterpret_cast<void **>(&src)));
-    uint32_t srcStride      = conversion->getCacheKey().stride;
+    uint32_t srcStride = conversion->getCacheKey().stride;
+    size_t dstStride   = dstFormat.pixelBytes;
+
+    vk::BufferHelper *dstBuffer = conversion->getBuffer();
+    uint8_t *dst                = dstBuffer->getMappedMemory();
+    size_t convertedVertexCount = 0;
+
+    // Large conversions are split across the worker threads, like CPU mipmap generation.
+    std::shared_ptr<angle::WorkerThreadPool> workerPool;
+    if (!context->getFrontendFeatures().singleThreadedVertexConversion.enabled)
+    {
+        workerPool = context->getWorkerThreadPool();
+    }
 
     if (conversion->isEntireBufferDirty())
     {
-        size_t srcOffset        = conversion->getCacheKey().offset;
-        size_t dstOffset        = 0;
-        const uint8_t *srcBytes = src + srcOffset;
-        size_t bytesToCopy      = maxNumVertices * dstFormat.pixelBytes;
-        ANGLE_TRY(StreamVertexData(contextVk, conversion->getBuffer(), srcBytes, bytesToCopy,
-                                   dstOffset, maxNumVertices, srcStride, vertexLoadFunction));
+        size_t srcOffset = conversion->getCacheKey().offset;
+        ConvertVertexData(workerPool.get(), vertexLoadFunction, src + srcOffset, srcStride,
+                          maxNumVertices, dst, dstStride);
+        convertedVertexCount = maxNumVertices;
     }
     else
     {
@@ -693,6 +706,8 @@ angle::Result VertexArrayVk::convertVertexBufferCPU(ContextVk *contextVk,
         // conversion in the overlapped area.
         conversion->consolidateDirtyRanges();
 
+        // Only the vertices that overlap the dirty ranges are converted again; the rest of the
+        // conversion buffer still holds their converted data.
         const std::vector<RangeDeviceSize> &dirtyRanges = conversion->getDirtyBufferRanges();
         for (const RangeDeviceSize &dirtyRange : dirtyRanges)
         {
@@ -709,15 +724,16 @@ angle::Result VertexArrayVk::convertVertexBufferCPU(ContextVk *contextVk,
 
             if (numVertices > 0)
             {
-                const uint8_t *srcBytes = src + srcOffset;
-                size_t bytesToCopy      = maxNumVertices * dstFormat.pixelBytes;
-                ANGLE_TRY(StreamVertexData(contextVk, conversion->getBuffer(), srcBytes,
-                                           bytesToCopy, dstOffset, maxNumVertices, srcStride,
-                                           vertexLoadFunction));
+                ConvertVertexData(workerPool.get(), vertexLoadFunction, src + srcOffset,
+                                  srcStride, numVertices, dst + dstOffset, dstStride);
+                convertedVertexCount += numVertices;
             }
         }
     }
 
+    contextVk->getPerfCounters().vertexBytesConvertedOnCPU += convertedVertexCount * dstStride;
+
+    ANGLE_TRY(dstBuffer->flush(contextVk->getRenderer()));
     conversion->clearDirty();
     ANGLE_TRY(srcBuffer->unmapImpl(contextVk));
 
@@ -816,7 +832,7 @@ angle::Result VertexArrayVk::syncState(const gl::Context *context,
         gl::VertexArray::DirtyAttribBits dirtyAttribBitsRequiresPipelineUpdate =              \
             (*attribBits)[INDEX] & mAttribDirtyBitsRequiresPipelineUpdate;                    \
         const bool bufferOnly = dirtyAttribBitsRequiresPipelineUpdate.none();                 \
-        ANGLE_TRY(syncDirtyAttrib(contextVk, attribs[INDEX],                                  \
+        ANGLE_TRY(syncDirtyAttrib(context, attribs[INDEX],                                    \
                                   bindings[attribs[INDEX].bindingIndex], INDEX, bufferOnly)); \
         (*attribBits)[INDEX].reset();                                                         \
         break;                                                                                \
@@ -838,7 +854,7 @@ angle::Result VertexArrayVk::syncState(const gl::Context *context,
                 (*attribBits)[attribIndex] & mAttribDirtyBitsRequiresPipelineUpdate;    \
             const bool bufferOnly = dirtyBindingBitsRequirePipelineUpdate.none() &&     \
                                     dirtyAttribBitsRequiresPipelineUpdate.none();       \
-            ANGLE_TRY(syncDirtyAttrib(contextVk, attribs[attribIndex], bindings[INDEX], \
+            ANGLE_TRY(syncDirtyAttrib(context, attribs[attribIndex], bindings[INDEX],   \
                                       attribIndex, bufferOnly));                        \
             iter.resetLaterBit(gl::VertexArray::DIRTY_BIT_BUFFER_DATA_0 + attribIndex); \
             iter.resetLaterBit(gl::VertexArray::DIRTY_BIT_ATTRIB_0 + attribIndex);      \
@@ -852,7 +868,7 @@ angle::Result VertexArrayVk::syncState(const gl::Context *context,
 
 #define ANGLE_VERTEX_DIRTY_BUFFER_DATA_FUNC(INDEX)                                       \
     case gl::VertexArray::DIRTY_BIT_BUFFER_DATA_0 + INDEX:                               \
-        ANGLE_TRY(syncDirtyAttrib(contextVk, attribs[INDEX],                             \
+        ANGLE_TRY(syncDirtyAttrib(context, attribs[INDEX],                               \
                                   bindings[attribs[INDEX].bindingIndex], INDEX, false)); \
         iter.resetLaterBit(gl::VertexArray::DIRTY_BIT_ATTRIB_0 + INDEX);                 \
         (*attribBits)[INDEX].reset();                                                    \
@@ -909,12 +925,13 @@ angle::Result VertexArrayVk::updateActiveAttribInfo(ContextVk *contextVk)
     return angle::Result::Continue;
 }
 
-angle::Result VertexArrayVk::syncDirtyAttrib(ContextVk *contextVk,
+angle::Result VertexArrayVk::syncDirtyAttrib(const gl::Context *context,
                                              const gl::VertexAttribute &attrib,
                                              const gl::VertexBinding &binding,
                                              size_t attribIndex,
                                              bool bufferOnly)
 {
+    ContextVk *contextVk   = vk::GetImpl(context);
     vk::Renderer *renderer = contextVk->getRenderer();
     if (attrib.enabled)
     {
@@ -1026,7 +1043,7 @@ angle::Result VertexArrayVk::syncDirtyAttrib(ContextVk *contextVk,
                             "GPU stall due to vertex format conversion of unaligned data");
 
                         ANGLE_TRY(convertVertexBufferCPU(
-                            contextVk, bufferVk, conversion, srcFormat, dstFormat,
+                            context, bufferVk, conversion, srcFormat, dstFormat,
                             vertexFormat.getVertexLoadFunction(compressed)));
                     }
 
@@ -172,14 +172,14 @@ class VertexArrayVk : public VertexArrayImpl
                                          VertexConversionBuffer *conversion,
                                          const angle::Format &srcFormat,
                                          const angle::Format &dstFormat);
-    angle::Result convertVertexBufferCPU(ContextVk *contextVk,
+    angle::Result convertVertexBufferCPU(const gl::Context *context,
                                          BufferVk *srcBuffer,
                                          VertexConversionBuffer *conversion,
                                          const angle::Format &srcFormat,
                                          const angle::Format &dstFormat,
                                          const VertexCopyFunction vertexLoadFunction);
 
-    angle::Result syncDirtyAttrib(ContextVk *contextVk,
+    angle::Result syncDirtyAttrib(const gl::Context *context,
                                   const gl::VertexAttribute &attrib,
                                   const gl::VertexBinding &binding,
                                   size_t attribIndex,
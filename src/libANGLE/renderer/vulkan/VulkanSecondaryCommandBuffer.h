@@ -273,6 +273,8 @@ class VulkanSecondaryCommandBuffer : public priv::CommandBuffer
         ASSERT(valid());
         return mCommandTracker.getRenderPassWriteCommandCount();
     }
+    // Commands are recorded directly in the Vulkan command buffer, and are never skipped.
+    uint32_t getSkippedRedundantStateCommandCount() const { return 0; }
     std::string dumpCommands(const char *separator) const { return ""; }
 
   private:
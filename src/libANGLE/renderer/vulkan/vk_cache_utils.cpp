@@ -11,6 +11,7 @@
 #include "libANGLE/renderer/vulkan/vk_cache_utils.h"
 
 #include "common/aligned_memory.h"
+#include "common/hash_utils.h"
 #include "common/system_utils.h"
 #include "libANGLE/BlobCache.h"
 #include "libANGLE/VertexAttribute.h"
@@ -33,6 +34,9 @@ constexpr bool kDumpPipelineCacheGraph = true;
 constexpr bool kDumpPipelineCacheGraph = false;
 #endif  // ANGLE_DUMP_PIPELINE_CACHE_GRAPH
 
+// Big enough for the transformed SPIR-V of a few hundred typical programs.
+constexpr size_t kTransformedSpirvCacheMaxSize = 16 * 1024 * 1024;
+
 namespace vk
 {
 
@@ -2541,12 +2545,8 @@ PipelineState GetPipelineState(size_t stateIndex, bool *isRangedOut, size_t *sub
 }
 
 template <typename Hash>
-void DumpPipelineCacheGraph(
-    Context *context,
-    const std::unordered_map<GraphicsPipelineDesc,
-                             PipelineHelper,
-                             Hash,
-                             typename GraphicsPipelineCacheTypeHelper<Hash>::KeyEqual> &cache)
+void DumpPipelineCacheGraph(Context *context,
+                            const typename GraphicsPipelineCache<Hash>::Payload &cache)
 {
     constexpr GraphicsPipelineSubset kSubset = GraphicsPipelineCacheTypeHelper<Hash>::kSubset;
 
@@ -3209,6 +3209,20 @@ bool operator==(const RenderPassDesc &lhs, const RenderPassDesc &rhs)
     return memcmp(&lhs, &rhs, sizeof(RenderPassDesc)) == 0;
 }
 
+namespace
+{
+// Hashes one 4-byte chunk of a GraphicsPipelineDesc together with its index.  The input is a
+// bijection of (index, chunk) and the mix is invertible, so different chunks never hash the same.
+ANGLE_INLINE uint64_t HashGraphicsPipelineDescChunk(size_t chunkIndex, uint32_t chunk)
+{
+    uint64_t x = (static_cast<uint64_t>(chunkIndex) << 32 | chunk) * 0x9E3779B97F4A7C15ull;
+    x ^= x >> 29;
+    x *= 0xBF58476D1CE4E5B9ull;
+    x ^= x >> 32;
+    return x;
+}
+}  // anonymous namespace
+
 // GraphicsPipelineDesc implementation.
 // Use aligned allocation and free so we can use the alignas keyword.
 void *GraphicsPipelineDesc::operator new(std::size_t size)
@@ -3302,12 +3316,74 @@ const void *GraphicsPipelineDesc::getPipelineSubsetMemory(GraphicsPipelineSubset
     }
 }
 
-size_t GraphicsPipelineDesc::hash(GraphicsPipelineSubset subset) const
+void GraphicsPipelineDesc::getPipelineSubsetChunkRange(GraphicsPipelineSubset subset,
+                                                       size_t *firstChunkOut,
+                                                       size_t *endChunkOut) const
 {
     size_t keySize  = 0;
     const void *key = getPipelineSubsetMemory(subset, &keySize);
+    const size_t keyOffset =
+        static_cast<const uint8_t *>(key) - reinterpret_cast<const uint8_t *>(this);
+
+    ASSERT(keyOffset % kGraphicsPipelineDirtyBitBytes == 0);
+    ASSERT(keySize % kGraphicsPipelineDirtyBitBytes == 0);
+
+    *firstChunkOut = keyOffset / kGraphicsPipelineDirtyBitBytes;
+    *endChunkOut   = *firstChunkOut + keySize / kGraphicsPipelineDirtyBitBytes;
+}
 
-    return angle::ComputeGenericHash(key, keySize);
+size_t GraphicsPipelineDesc::hash(GraphicsPipelineSubset subset) const
+{
+    size_t firstChunk = 0;
+    size_t endChunk   = 0;
+    getPipelineSubsetChunkRange(subset, &firstChunk, &endChunk);
+
+    const uint32_t *chunks = getPtr<uint32_t>();
+
+    uint64_t descHash = 0;
+    for (size_t chunkIndex = firstChunk; chunkIndex < endChunk; ++chunkIndex)
+    {
+        descHash += HashGraphicsPipelineDescChunk(chunkIndex, chunks[chunkIndex]);
+    }
+
+    return static_cast<size_t>(descHash);
+}
+
+size_t GraphicsPipelineDesc::updateHash(GraphicsPipelineSubset subset,
+                                        size_t previousHash,
+                                        const GraphicsPipelineDesc &previousDesc,
+                                        GraphicsPipelineTransitionBits transition) const
+{
+    size_t firstChunk = 0;
+    size_t endChunk   = 0;
+    getPipelineSubsetChunkRange(subset, &firstChunk, &endChunk);
+
+    // If the vertex input workarounds differ, the two descs don't hash the same chunks.
+    size_t previousFirstChunk = 0;
+    size_t previousEndChunk   = 0;
+    previousDesc.getPipelineSubsetChunkRange(subset, &previousFirstChunk, &previousEndChunk);
+    if (endChunk != previousEndChunk)
+    {
+        return hash(subset);
+    }
+
+    const uint32_t *chunks         = getPtr<uint32_t>();
+    const uint32_t *previousChunks = previousDesc.getPtr<uint32_t>();
+
+    uint64_t descHash = previousHash;
+    for (size_t chunkIndex : transition)
+    {
+        if (chunkIndex < firstChunk || chunkIndex >= endChunk ||
+            chunks[chunkIndex] == previousChunks[chunkIndex])
+        {
+            continue;
+        }
+        descHash += HashGraphicsPipelineDescChunk(chunkIndex, chunks[chunkIndex]) -
+                    HashGraphicsPipelineDescChunk(chunkIndex, previousChunks[chunkIndex]);
+    }
+
+    ASSERT(static_cast<size_t>(descHash) == hash(subset));
+    return static_cast<size_t>(descHash);
 }
 
 bool GraphicsPipelineDesc::keyEqual(const GraphicsPipelineDesc &other,
@@ -7120,6 +7196,43 @@ void PipelineCacheAccess::merge(Renderer *renderer, const vk::PipelineCache &pip
 
     mPipelineCache->merge(renderer->getDevice(), 1, pipelineCache.ptr());
 }
+
+// TransformedSpirvDesc implementation.
+TransformedSpirvDesc::TransformedSpirvDesc(const SpvTransformOptions &options,
+                                           const ShaderInterfaceVariableInfoMap &variableInfoMap,
+                                           const angle::spirv::Blob &initialSpirvBlob)
+{
+    // |validate| doesn't change the result, so it's left out.
+    mWords.push_back(static_cast<uint32_t>(options.shaderType));
+    const uint32_t optionBits = static_cast<uint32_t>(options.isLastPreFragmentStage) |
+                                static_cast<uint32_t>(options.isTransformFeedbackStage) << 1 |
+                                static_cast<uint32_t>(options.isTransformFeedbackEmulated) << 2 |
+                                static_cast<uint32_t>(options.isMultisampledFramebufferFetch) << 3 |
+                                static_cast<uint32_t>(options.enableSampleShading) << 4 |
+                                static_cast<uint32_t>(options.useSpirvVaryingPrecisionFixer) << 5;
+    mWords.push_back(optionBits);
+
+    const uint64_t spirvHash = angle::ComputeGenericHash(
+        initialSpirvBlob.data(), initialSpirvBlob.size() * sizeof(uint32_t));
+    mWords.push_back(static_cast<uint32_t>(initialSpirvBlob.size()));
+    mWords.push_back(static_cast<uint32_t>(spirvHash));
+    mWords.push_back(static_cast<uint32_t>(spirvHash >> 32));
+
+    variableInfoMap.appendTransformDesc(options.shaderType, &mWords);
+
+    mHash = angle::ComputeGenericHash(mWords.data(), mWords.size() * sizeof(uint32_t));
+}
+
+TransformedSpirvDesc::~TransformedSpirvDesc() = default;
+
+TransformedSpirvDesc::TransformedSpirvDesc(const TransformedSpirvDesc &other) = default;
+
+TransformedSpirvDesc &TransformedSpirvDesc::operator=(const TransformedSpirvDesc &other) = default;
+
+bool TransformedSpirvDesc::operator==(const TransformedSpirvDesc &other) const
+{
+    return mHash == other.mHash && mWords == other.mWords;
+}
 }  // namespace vk
 
 // UpdateDescriptorSetsBuilder implementation.
@@ -7884,6 +7997,64 @@ angle::Result RenderPassCache::MakeRenderPass(vk::Context *context,
     return angle::Result::Continue;
 }
 
+// GraphicsPipelineDescMap implementation.
+template <typename KeyEqual>
+typename GraphicsPipelineDescMap<KeyEqual>::value_type *GraphicsPipelineDescMap<KeyEqual>::insert(
+    const vk::GraphicsPipelineDesc &desc,
+    size_t hash,
+    vk::Pipeline &&pipeline,
+    vk::CacheLookUpFeedback feedback)
+{
+    ASSERT(find(desc, hash) == nullptr);
+
+    // Keep the load factor at most 1/2, so probe sequences stay short.
+    if ((mEntries.size() + 1) * 2 > mSlots.size())
+    {
+        constexpr size_t kInitialSlotCount = 16;
+        std::vector<Slot> oldSlots         = std::move(mSlots);
+        mSlots.assign(std::max(kInitialSlotCount, oldSlots.size() * 2), Slot{0, nullptr});
+
+        // The hashes are kept in the slots, so growing doesn't need to rehash any desc.
+        for (const Slot &slot : oldSlots)
+        {
+            if (slot.entry != nullptr)
+            {
+                insertSlot(slot.hash, slot.entry);
+            }
+        }
+    }
+
+    mEntries.emplace_back(std::piecewise_construct, std::forward_as_tuple(desc),
+                          std::forward_as_tuple(std::move(pipeline), feedback));
+    insertSlot(hash, &mEntries.back());
+
+    return &mEntries.back();
+}
+
+template <typename KeyEqual>
+void GraphicsPipelineDescMap<KeyEqual>::insertSlot(size_t hash, value_type *entry)
+{
+    const size_t mask = mSlots.size() - 1;
+    size_t index      = hash & mask;
+    while (mSlots[index].entry != nullptr)
+    {
+        index = (index + 1) & mask;
+    }
+    mSlots[index] = {hash, entry};
+}
+
+template <typename KeyEqual>
+void GraphicsPipelineDescMap<KeyEqual>::clear()
+{
+    mSlots.clear();
+    mEntries.clear();
+}
+
+template class GraphicsPipelineDescMap<GraphicsPipelineDescCompleteKeyEqual>;
+template class GraphicsPipelineDescMap<GraphicsPipelineDescVertexInputKeyEqual>;
+template class GraphicsPipelineDescMap<GraphicsPipelineDescShadersKeyEqual>;
+template class GraphicsPipelineDescMap<GraphicsPipelineDescFragmentOutputKeyEqual>;
+
 // GraphicsPipelineCache implementation.
 template <typename Hash>
 void GraphicsPipelineCache<Hash>::destroy(vk::Context *context)
@@ -7933,6 +8104,7 @@ angle::Result GraphicsPipelineCache<Hash>::createPipeline(
     const vk::SpecializationConstants &specConsts,
     PipelineSource source,
     const vk::GraphicsPipelineDesc &desc,
+    size_t descHash,
     const vk::GraphicsPipelineDesc **descPtrOut,
     vk::PipelineHelper **pipelineOut)
 {
@@ -7942,9 +8114,6 @@ angle::Result GraphicsPipelineCache<Hash>::createPipeline(
     // This "if" is left here for the benefit of VulkanPipelineCachePerfTest.
     if (context != nullptr)
     {
-        constexpr vk::GraphicsPipelineSubset kSubset =
-            GraphicsPipelineCacheTypeHelper<Hash>::kSubset;
-
         ANGLE_VK_TRY(context, desc.initializePipeline(context, pipelineCache, kSubset,
                                                       compatibleRenderPass, pipelineLayout, shaders,
                                                       specConsts, &newPipeline, &feedback));
@@ -7960,7 +8129,8 @@ angle::Result GraphicsPipelineCache<Hash>::createPipeline(
     }
     else
     {
-        addToCache(source, desc, std::move(newPipeline), feedback, descPtrOut, pipelineOut);
+        addToCache(source, desc, descHash, std::move(newPipeline), feedback, descPtrOut,
+                   pipelineOut);
     }
     return angle::Result::Continue;
 }
@@ -7970,6 +8140,7 @@ angle::Result GraphicsPipelineCache<Hash>::linkLibraries(
     vk::Context *context,
     vk::PipelineCacheAccess *pipelineCache,
     const vk::GraphicsPipelineDesc &desc,
+    size_t descHash,
     const vk::PipelineLayout &pipelineLayout,
     vk::PipelineHelper *vertexInputPipeline,
     vk::PipelineHelper *shadersPipeline,
@@ -7984,8 +8155,8 @@ angle::Result GraphicsPipelineCache<Hash>::linkLibraries(
         context, pipelineCache, pipelineLayout, *vertexInputPipeline, *shadersPipeline,
         *fragmentOutputPipeline, desc, &newPipeline, &feedback));
 
-    addToCache(PipelineSource::DrawLinked, desc, std::move(newPipeline), feedback, descPtrOut,
-               pipelineOut);
+    addToCache(PipelineSource::DrawLinked, desc, descHash, std::move(newPipeline), feedback,
+               descPtrOut, pipelineOut);
     (*pipelineOut)->setLinkedLibraryReferences(shadersPipeline);
 
     return angle::Result::Continue;
@@ -7994,12 +8165,13 @@ angle::Result GraphicsPipelineCache<Hash>::linkLibraries(
 template <typename Hash>
 void GraphicsPipelineCache<Hash>::addToCache(PipelineSource source,
                                              const vk::GraphicsPipelineDesc &desc,
+                                             size_t descHash,
                                              vk::Pipeline &&pipeline,
                                              vk::CacheLookUpFeedback feedback,
                                              const vk::GraphicsPipelineDesc **descPtrOut,
                                              vk::PipelineHelper **pipelineOut)
 {
-    ASSERT(mPayload.find(desc) == mPayload.end());
+    ASSERT(descHash == Hash()(desc));
 
     mCacheStats.missAndIncrementSize();
 
@@ -8024,10 +8196,10 @@ void GraphicsPipelineCache<Hash>::addToCache(PipelineSource source,
             break;
     }
 
-    auto insertedItem = mPayload.emplace(std::piecewise_construct, std::forward_as_tuple(desc),
-                                         std::forward_as_tuple(std::move(pipeline), feedback));
-    *descPtrOut       = &insertedItem.first->first;
-    *pipelineOut      = &insertedItem.first->second;
+    typename Payload::value_type *insertedItem =
+        mPayload.insert(desc, descHash, std::move(pipeline), feedback);
+    *descPtrOut  = &insertedItem->first;
+    *pipelineOut = &insertedItem->second;
 }
 
 template <typename Hash>
@@ -8035,8 +8207,8 @@ void GraphicsPipelineCache<Hash>::populate(const vk::GraphicsPipelineDesc &desc,
                                            vk::Pipeline &&pipeline,
                                            vk::PipelineHelper **pipelineHelperOut)
 {
-    auto item = mPayload.find(desc);
-    if (item != mPayload.end())
+    const size_t descHash = Hash()(desc);
+    if (mPayload.find(desc, descHash) != nullptr)
     {
         return;
     }
@@ -8044,14 +8216,12 @@ void GraphicsPipelineCache<Hash>::populate(const vk::GraphicsPipelineDesc &desc,
     // This function is used by -
     // 1. WarmUp tasks to insert placeholder pipelines
     // 2. VulkanPipelineCachePerfTest
-    auto insertedItem =
-        mPayload.emplace(std::piecewise_construct, std::forward_as_tuple(desc),
-                         std::forward_as_tuple(std::move(pipeline), vk::CacheLookUpFeedback::None));
+    typename Payload::value_type *insertedItem =
+        mPayload.insert(desc, descHash, std::move(pipeline), vk::CacheLookUpFeedback::None);
 
     if (pipelineHelperOut)
     {
-        ASSERT(insertedItem.second);
-        *pipelineHelperOut = &insertedItem.first->second;
+        *pipelineHelperOut = &insertedItem->second;
     }
 }
 
@@ -8069,12 +8239,14 @@ template angle::Result GraphicsPipelineCache<GraphicsPipelineDescCompleteHash>::
     const vk::SpecializationConstants &specConsts,
     PipelineSource source,
     const vk::GraphicsPipelineDesc &desc,
+    size_t descHash,
     const vk::GraphicsPipelineDesc **descPtrOut,
     vk::PipelineHelper **pipelineOut);
 template angle::Result GraphicsPipelineCache<GraphicsPipelineDescCompleteHash>::linkLibraries(
     vk::Context *context,
     vk::PipelineCacheAccess *pipelineCache,
     const vk::GraphicsPipelineDesc &desc,
+    size_t descHash,
     const vk::PipelineLayout &pipelineLayout,
     vk::PipelineHelper *vertexInputPipeline,
     vk::PipelineHelper *shadersPipeline,
@@ -8099,6 +8271,7 @@ template angle::Result GraphicsPipelineCache<GraphicsPipelineDescVertexInputHash
     const vk::SpecializationConstants &specConsts,
     PipelineSource source,
     const vk::GraphicsPipelineDesc &desc,
+    size_t descHash,
     const vk::GraphicsPipelineDesc **descPtrOut,
     vk::PipelineHelper **pipelineOut);
 template void GraphicsPipelineCache<GraphicsPipelineDescVertexInputHash>::populate(
@@ -8117,6 +8290,7 @@ template angle::Result GraphicsPipelineCache<GraphicsPipelineDescShadersHash>::c
     const vk::SpecializationConstants &specConsts,
     PipelineSource source,
     const vk::GraphicsPipelineDesc &desc,
+    size_t descHash,
     const vk::GraphicsPipelineDesc **descPtrOut,
     vk::PipelineHelper **pipelineOut);
 template void GraphicsPipelineCache<GraphicsPipelineDescShadersHash>::populate(
@@ -8138,6 +8312,7 @@ GraphicsPipelineCache<GraphicsPipelineDescFragmentOutputHash>::createPipeline(
     const vk::SpecializationConstants &specConsts,
     PipelineSource source,
     const vk::GraphicsPipelineDesc &desc,
+    size_t descHash,
     const vk::GraphicsPipelineDesc **descPtrOut,
     vk::PipelineHelper **pipelineOut);
 template void GraphicsPipelineCache<GraphicsPipelineDescFragmentOutputHash>::populate(
@@ -8296,6 +8471,63 @@ angle::Result PipelineLayoutCache::getPipelineLayout(
     return angle::Result::Continue;
 }
 
+// TransformedSpirvCache implementation.
+TransformedSpirvCache::TransformedSpirvCache() : mPayload(kTransformedSpirvCacheMaxSize) {}
+
+TransformedSpirvCache::~TransformedSpirvCache() = default;
+
+void TransformedSpirvCache::destroy(vk::Renderer *renderer)
+{
+    std::lock_guard<angle::SimpleMutex> lock(mMutex);
+    renderer->accumulateCacheStats(VulkanCacheType::TransformedSpirv, mCacheStats);
+    mPayload.clear();
+}
+
+angle::Result TransformedSpirvCache::getTransformedSpirv(
+    vk::Context *context,
+    const SpvTransformOptions &options,
+    const ShaderInterfaceVariableInfoMap &variableInfoMap,
+    const std::shared_ptr<const angle::spirv::Blob> &initialSpirvBlob,
+    std::shared_ptr<const angle::spirv::Blob> *spirvBlobOut)
+{
+    const vk::TransformedSpirvDesc desc(options, variableInfoMap, *initialSpirvBlob);
+
+    {
+        std::lock_guard<angle::SimpleMutex> lock(mMutex);
+        const Entry *entry = nullptr;
+        if (mPayload.get(desc, &entry) && (entry->initialSpirvBlob == initialSpirvBlob ||
+                                           *entry->initialSpirvBlob == *initialSpirvBlob))
+        {
+            mCacheStats.hit();
+            *spirvBlobOut = entry->transformedSpirvBlob;
+            return angle::Result::Continue;
+        }
+    }
+
+    // Transform without holding the lock, so other programs can be linked meanwhile.  If two
+    // threads transform the same shader, the last result replaces the first.
+    auto transformedSpirvBlob = std::make_shared<angle::spirv::Blob>();
+    ANGLE_TRY(SpvTransformSpirvCode(options, variableInfoMap, *initialSpirvBlob,
+                                    transformedSpirvBlob.get()));
+    *spirvBlobOut = transformedSpirvBlob;
+
+    // The source SPIR-V is shared with the program rather than copied.  It's still counted, as the
+    // cache may keep it alive after the program is deleted.
+    Entry entry;
+    entry.initialSpirvBlob     = initialSpirvBlob;
+    entry.transformedSpirvBlob = std::move(transformedSpirvBlob);
+    const size_t entrySize =
+        desc.getMemorySize() + (entry.initialSpirvBlob->size() + (*spirvBlobOut)->size()) *
+                                   sizeof(uint32_t);
+
+    std::lock_guard<angle::SimpleMutex> lock(mMutex);
+    mCacheStats.miss();
+    mPayload.put(desc, std::move(entry), entrySize);
+    mCacheStats.setSize(static_cast<uint32_t>(mPayload.entryCount()));
+
+    return angle::Result::Continue;
+}
+
 // YuvConversionCache implementation
 SamplerYcbcrConversionCache::SamplerYcbcrConversionCache() = default;
 
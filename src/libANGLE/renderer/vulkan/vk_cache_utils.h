@@ -11,10 +11,13 @@
 #ifndef LIBANGLE_RENDERER_VULKAN_VK_CACHE_UTILS_H_
 #define LIBANGLE_RENDERER_VULKAN_VK_CACHE_UTILS_H_
 
+#include <deque>
+
 #include "common/Color.h"
 #include "common/FixedVector.h"
 #include "common/SimpleMutex.h"
 #include "common/WorkerThread.h"
+#include "libANGLE/SizedMRUCache.h"
 #include "libANGLE/Uniform.h"
 #include "libANGLE/renderer/vulkan/ShaderInterfaceVariableInfoMap.h"
 #include "libANGLE/renderer/vulkan/vk_resource.h"
@@ -824,7 +827,14 @@ class GraphicsPipelineDesc final
     GraphicsPipelineDesc(const GraphicsPipelineDesc &other);
     GraphicsPipelineDesc &operator=(const GraphicsPipelineDesc &other);
 
+    // The hash is a sum of the hashes of the desc's 4-byte chunks, one per transition bit.  This
+    // lets updateHash() derive the hash of a desc from that of a previous state of it by only
+    // rehashing the chunks in |transition|, which must cover every chunk that has changed since.
     size_t hash(GraphicsPipelineSubset subset) const;
+    size_t updateHash(GraphicsPipelineSubset subset,
+                      size_t previousHash,
+                      const GraphicsPipelineDesc &previousDesc,
+                      GraphicsPipelineTransitionBits transition) const;
     bool keyEqual(const GraphicsPipelineDesc &other, GraphicsPipelineSubset subset) const;
 
     void initDefaults(const Context *context,
@@ -1044,6 +1054,10 @@ class GraphicsPipelineDesc final
     void updateSubpass(GraphicsPipelineTransitionBits *transition, uint32_t subpass);
 
     const void *getPipelineSubsetMemory(GraphicsPipelineSubset subset, size_t *sizeOut) const;
+    // The range of transition bits (i.e. 4-byte chunks) that make up the subset's key.
+    void getPipelineSubsetChunkRange(GraphicsPipelineSubset subset,
+                                     size_t *firstChunkOut,
+                                     size_t *endChunkOut) const;
 
     void initializePipelineVertexInputState(
         Context *context,
@@ -2202,6 +2216,30 @@ class SharedCacheKeyManager
 
 using FramebufferCacheManager   = SharedCacheKeyManager<SharedFramebufferCacheKey>;
 using DescriptorSetCacheManager = SharedCacheKeyManager<SharedDescriptorSetCacheKey>;
+
+// Describes a SpvTransformSpirvCode call: the transform options, the parts of the interface
+// variable map that the transformer reads, and a hash of the SPIR-V to transform.  The SPIR-V
+// itself is compared by the cache, so a hash collision can't return the wrong code.
+class TransformedSpirvDesc final
+{
+  public:
+    TransformedSpirvDesc(const SpvTransformOptions &options,
+                         const ShaderInterfaceVariableInfoMap &variableInfoMap,
+                         const angle::spirv::Blob &initialSpirvBlob);
+    ~TransformedSpirvDesc();
+
+    TransformedSpirvDesc(const TransformedSpirvDesc &other);
+    TransformedSpirvDesc &operator=(const TransformedSpirvDesc &other);
+
+    size_t hash() const { return mHash; }
+    bool operator==(const TransformedSpirvDesc &other) const;
+
+    size_t getMemorySize() const { return mWords.size() * sizeof(uint32_t); }
+
+  private:
+    std::vector<uint32_t> mWords;
+    size_t mHash;
+};
 }  // namespace vk
 }  // namespace rx
 
@@ -2265,6 +2303,12 @@ struct hash<rx::vk::SamplerDesc>
     size_t operator()(const rx::vk::SamplerDesc &key) const { return key.hash(); }
 };
 
+template <>
+struct hash<rx::vk::TransformedSpirvDesc>
+{
+    size_t operator()(const rx::vk::TransformedSpirvDesc &key) const { return key.hash(); }
+};
+
 // See Resource Serial types defined in vk_utils.h.
 #define ANGLE_HASH_VK_SERIAL(Type)                               \
     template <>                                                  \
@@ -2298,6 +2342,7 @@ enum class VulkanCacheType
     ShaderResourcesDescriptors,
     Framebuffer,
     DescriptorMetaCache,
+    TransformedSpirv,
     EnumCount
 };
 
@@ -2591,11 +2636,84 @@ struct GraphicsPipelineCacheTypeHelper<GraphicsPipelineDescFragmentOutputHash>
         vk::GraphicsPipelineSubset::FragmentOutput;
 };
 
+// An open-addressing hash table of pipelines keyed by GraphicsPipelineDesc.  The slots only hold
+// the hash of the key and a pointer to the entry, so probing walks a small contiguous array and the
+// key itself is only compared when the hashes match.  Entries are never moved as the table grows,
+// since transitions between PipelineHelpers and the contexts hold pointers to both the desc and the
+// PipelineHelper.
+template <typename KeyEqual>
+class GraphicsPipelineDescMap final : angle::NonCopyable
+{
+  public:
+    using value_type     = std::pair<const vk::GraphicsPipelineDesc, vk::PipelineHelper>;
+    using iterator       = typename std::deque<value_type>::iterator;
+    using const_iterator = typename std::deque<value_type>::const_iterator;
+
+    GraphicsPipelineDescMap()  = default;
+    ~GraphicsPipelineDescMap() = default;
+
+    ANGLE_INLINE value_type *find(const vk::GraphicsPipelineDesc &desc, size_t hash) const
+    {
+        if (mSlots.empty())
+        {
+            return nullptr;
+        }
+
+        const size_t mask = mSlots.size() - 1;
+        for (size_t index = hash & mask;; index = (index + 1) & mask)
+        {
+            const Slot &slot = mSlots[index];
+            if (slot.entry == nullptr)
+            {
+                return nullptr;
+            }
+            if (slot.hash == hash && KeyEqual()(slot.entry->first, desc))
+            {
+                return slot.entry;
+            }
+        }
+    }
+
+    // The desc must not already be in the map.
+    value_type *insert(const vk::GraphicsPipelineDesc &desc,
+                       size_t hash,
+                       vk::Pipeline &&pipeline,
+                       vk::CacheLookUpFeedback feedback);
+
+    bool empty() const { return mEntries.empty(); }
+    size_t size() const { return mEntries.size(); }
+    iterator begin() { return mEntries.begin(); }
+    iterator end() { return mEntries.end(); }
+    const_iterator begin() const { return mEntries.begin(); }
+    const_iterator end() const { return mEntries.end(); }
+
+    void clear();
+
+  private:
+    struct Slot
+    {
+        size_t hash;
+        value_type *entry;
+    };
+
+    void insertSlot(size_t hash, value_type *entry);
+
+    // The number of slots is a power of two, and at most half of them are used.
+    std::vector<Slot> mSlots;
+    std::deque<value_type> mEntries;
+};
+
 // TODO(jmadill): Add cache trimming/eviction.
 template <typename Hash>
 class GraphicsPipelineCache final : public HasCacheStats<VulkanCacheType::GraphicsPipeline>
 {
   public:
+    using KeyEqual = typename GraphicsPipelineCacheTypeHelper<Hash>::KeyEqual;
+    using Payload  = GraphicsPipelineDescMap<KeyEqual>;
+
+    static constexpr vk::GraphicsPipelineSubset kSubset =
+        GraphicsPipelineCacheTypeHelper<Hash>::kSubset;
+
     GraphicsPipelineCache() = default;
     ~GraphicsPipelineCache() override { ASSERT(mPayload.empty()); }
 
@@ -2611,8 +2729,20 @@ class GraphicsPipelineCache final : public HasCacheStats<VulkanCacheType::Graphi
                                   const vk::GraphicsPipelineDesc **descPtrOut,
                                   vk::PipelineHelper **pipelineOut)
     {
-        auto item = mPayload.find(desc);
-        if (item == mPayload.end())
+        return getPipeline(desc, Hash()(desc), descPtrOut, pipelineOut);
+    }
+
+    // Same as above, with |descHash| already computed by the caller, for example with
+    // GraphicsPipelineDesc::updateHash().
+    ANGLE_INLINE bool getPipeline(const vk::GraphicsPipelineDesc &desc,
+                                  size_t descHash,
+                                  const vk::GraphicsPipelineDesc **descPtrOut,
+                                  vk::PipelineHelper **pipelineOut)
+    {
+        ASSERT(descHash == Hash()(desc));
+
+        typename Payload::value_type *item = mPayload.find(desc, descHash);
+        if (item == nullptr)
         {
             return false;
         }
@@ -2625,6 +2755,7 @@ class GraphicsPipelineCache final : public HasCacheStats<VulkanCacheType::Graphi
         return true;
     }
 
+    // |descHash| is the hash of |desc|, as already computed for the lookup that missed.
     angle::Result createPipeline(vk::Context *context,
                                  vk::PipelineCacheAccess *pipelineCache,
                                  const vk::RenderPass &compatibleRenderPass,
@@ -2633,12 +2764,14 @@ class GraphicsPipelineCache final : public HasCacheStats<VulkanCacheType::Graphi
                                  const vk::SpecializationConstants &specConsts,
                                  PipelineSource source,
                                  const vk::GraphicsPipelineDesc &desc,
+                                 size_t descHash,
                                  const vk::GraphicsPipelineDesc **descPtrOut,
                                  vk::PipelineHelper **pipelineOut);
 
     angle::Result linkLibraries(vk::Context *context,
                                 vk::PipelineCacheAccess *pipelineCache,
                                 const vk::GraphicsPipelineDesc &desc,
+                                size_t descHash,
                                 const vk::PipelineLayout &pipelineLayout,
                                 vk::PipelineHelper *vertexInputPipeline,
                                 vk::PipelineHelper *shadersPipeline,
@@ -2652,13 +2785,13 @@ class GraphicsPipelineCache final : public HasCacheStats<VulkanCacheType::Graphi
   private:
     void addToCache(PipelineSource source,
                     const vk::GraphicsPipelineDesc &desc,
+                    size_t descHash,
                     vk::Pipeline &&pipeline,
                     vk::CacheLookUpFeedback feedback,
                     const vk::GraphicsPipelineDesc **descPtrOut,
                     vk::PipelineHelper **pipelineOut);
 
-    using KeyEqual = typename GraphicsPipelineCacheTypeHelper<Hash>::KeyEqual;
-    std::unordered_map<vk::GraphicsPipelineDesc, vk::PipelineHelper, Hash, KeyEqual> mPayload;
+    Payload mPayload;
 };
 
 using CompleteGraphicsPipelineCache    = GraphicsPipelineCache<GraphicsPipelineDescCompleteHash>;
@@ -2725,6 +2858,39 @@ class SamplerCache final : public HasCacheStats<VulkanCacheType::Sampler>
     std::unordered_map<vk::SamplerDesc, vk::RefCountedSampler> mPayload;
 };
 
+// Transformed SPIR-V Cache.  Programs that link the same shader with the same interface variable
+// layout and transform options share the SPIR-V transformed for the first one.  Thread-safe, as
+// programs are linked by the worker threads.  The entries only hold references to CPU memory, so
+// the cache may be destroyed while not empty.
+class TransformedSpirvCache final : public HasCacheStats<VulkanCacheType::TransformedSpirv>
+{
+  public:
+    TransformedSpirvCache();
+    ~TransformedSpirvCache() override;
+
+    void destroy(vk::Renderer *renderer);
+
+    // Same as SpvTransformSpirvCode, but returns the previous result if the same transformation
+    // was already done.
+    angle::Result getTransformedSpirv(
+        vk::Context *context,
+        const SpvTransformOptions &options,
+        const ShaderInterfaceVariableInfoMap &variableInfoMap,
+        const std::shared_ptr<const angle::spirv::Blob> &initialSpirvBlob,
+        std::shared_ptr<const angle::spirv::Blob> *spirvBlobOut);
+
+  private:
+    struct Entry
+    {
+        // Shared with the programs, and compared on a hit to rule out hash collisions.
+        std::shared_ptr<const angle::spirv::Blob> initialSpirvBlob;
+        std::shared_ptr<const angle::spirv::Blob> transformedSpirvBlob;
+    };
+
+    angle::SimpleMutex mMutex;
+    angle::SizedMRUCache<vk::TransformedSpirvDesc, Entry> mPayload;
+};
+
 // YuvConversion Cache
 class SamplerYcbcrConversionCache final
     : public HasCacheStats<VulkanCacheType::SamplerYcbcrConversion>
@@ -0,0 +1,131 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// vk_cache_utils_unittest:
+//   Unit tests for the sharing of transformed SPIR-V between programs in TransformedSpirvCache.
+//
+
+#include <gtest/gtest.h>
+
+#include "GLSLANG/ShaderLang.h"
+#include "common/spirv/spirv_instruction_builder_autogen.h"
+#include "libANGLE/renderer/vulkan/vk_cache_utils.h"
+
+namespace rx
+{
+namespace vk
+{
+namespace
+{
+// The smallest shader the transformer accepts: declarations that end with the overview
+// non-semantic instruction the translator outputs.  |capability| makes different shaders.
+std::shared_ptr<const angle::spirv::Blob> MakeSpirv(spv::Capability capability)
+{
+    using namespace sh::vk::spirv;
+
+    auto blob = std::make_shared<angle::spirv::Blob>();
+    angle::spirv::WriteSpirvHeader(blob.get(), angle::spirv::kVersion_1_0, kIdFirstUnreserved + 1);
+    angle::spirv::WriteCapability(blob.get(), capability);
+    angle::spirv::WriteExtInstImport(
+        blob.get(), angle::spirv::IdResult(kIdNonSemanticInstructionSet), "NonSemantic.ANGLE");
+    angle::spirv::WriteMemoryModel(blob.get(), spv::AddressingModelLogical,
+                                   spv::MemoryModelGLSL450);
+    angle::spirv::WriteTypeVoid(blob.get(), angle::spirv::IdResult(kIdVoid));
+    angle::spirv::WriteExtInst(blob.get(), angle::spirv::IdResultType(kIdVoid),
+                               angle::spirv::IdResult(kIdFirstUnreserved),
+                               angle::spirv::IdRef(kIdNonSemanticInstructionSet),
+                               angle::spirv::LiteralExtInstInteger(kNonSemanticOverview), {});
+    return blob;
+}
+
+// An interface with only the default uniform block, at |binding|.
+void InitVariableInfoMap(uint32_t binding, ShaderInterfaceVariableInfoMap *variableInfoMap)
+{
+    ShaderInterfaceVariableInfo &info =
+        variableInfoMap->add(gl::ShaderType::Vertex, sh::vk::spirv::kIdDefaultUniformsBlock);
+    info.descriptorSet = 0;
+    info.binding       = binding;
+}
+
+class TransformedSpirvCacheTest : public testing::Test
+{
+  protected:
+    void SetUp() override { mOptions.shaderType = gl::ShaderType::Vertex; }
+
+    std::shared_ptr<const angle::spirv::Blob> transform(
+        const ShaderInterfaceVariableInfoMap &variableInfoMap,
+        const std::shared_ptr<const angle::spirv::Blob> &initialSpirvBlob)
+    {
+        std::shared_ptr<const angle::spirv::Blob> transformedSpirvBlob;
+        EXPECT_EQ(angle::Result::Continue,
+                  mCache.getTransformedSpirv(nullptr, mOptions, variableInfoMap, initialSpirvBlob,
+                                             &transformedSpirvBlob));
+        EXPECT_NE(nullptr, transformedSpirvBlob);
+        return transformedSpirvBlob;
+    }
+
+    void expectCacheStats(uint32_t hitCount, uint32_t missCount)
+    {
+        CacheStats stats;
+        mCache.getCacheStats(&stats);
+        EXPECT_EQ(hitCount, stats.getHitCount());
+        EXPECT_EQ(missCount, stats.getMissCount());
+    }
+
+    SpvTransformOptions mOptions;
+    TransformedSpirvCache mCache;
+};
+
+// Tests that two programs that share a shader and its interface share the transformed SPIR-V, and
+// that the cache references the program's SPIR-V rather than copying it.
+TEST_F(TransformedSpirvCacheTest, SharedShaderAndInterfaceHits)
+{
+    const std::shared_ptr<const angle::spirv::Blob> spirv = MakeSpirv(spv::CapabilityShader);
+    const long useCount                                   = spirv.use_count();
+
+    ShaderInterfaceVariableInfoMap firstProgramInterface;
+    ShaderInterfaceVariableInfoMap secondProgramInterface;
+    InitVariableInfoMap(1, &firstProgramInterface);
+    InitVariableInfoMap(1, &secondProgramInterface);
+
+    const std::shared_ptr<const angle::spirv::Blob> first = transform(firstProgramInterface, spirv);
+    EXPECT_EQ(useCount + 1, spirv.use_count());
+    expectCacheStats(0, 1);
+
+    const std::shared_ptr<const angle::spirv::Blob> second =
+        transform(secondProgramInterface, spirv);
+    EXPECT_EQ(first, second);
+    expectCacheStats(1, 1);
+
+    // A program that links its own copy of the same shader also hits.
+    const std::shared_ptr<const angle::spirv::Blob> spirvCopy =
+        std::make_shared<angle::spirv::Blob>(*spirv);
+    EXPECT_EQ(first, transform(secondProgramInterface, spirvCopy));
+    expectCacheStats(2, 1);
+}
+
+// Tests that programs whose interfaces differ, or whose shaders differ, don't share the
+// transformed SPIR-V.
+TEST_F(TransformedSpirvCacheTest, DifferentInterfaceOrShaderMisses)
+{
+    const std::shared_ptr<const angle::spirv::Blob> spirv = MakeSpirv(spv::CapabilityShader);
+
+    ShaderInterfaceVariableInfoMap firstProgramInterface;
+    ShaderInterfaceVariableInfoMap secondProgramInterface;
+    InitVariableInfoMap(1, &firstProgramInterface);
+    InitVariableInfoMap(2, &secondProgramInterface);
+
+    const std::shared_ptr<const angle::spirv::Blob> first = transform(firstProgramInterface, spirv);
+    EXPECT_NE(first, transform(secondProgramInterface, spirv));
+    expectCacheStats(0, 2);
+
+    const std::shared_ptr<const angle::spirv::Blob> otherSpirv =
+        MakeSpirv(spv::CapabilityGeometry);
+    EXPECT_NE(first, transform(firstProgramInterface, otherSpirv));
+    expectCacheStats(0, 3);
+}
+}  // anonymous namespace
+}  // namespace vk
+}  // namespace rx
@@ -8469,6 +8469,8 @@ angle::Result ImageHelper::stageSubresourceUpdateImpl(ContextVk *contextVk,
         }
     }
 
+    contextVk->getPerfCounters().textureBytesUploaded += allocationSize;
+
     const uint8_t *source = pixels + static_cast<ptrdiff_t>(inputSkipBytes);
 
     // If possible, copy the buffer to the image directly on the host, to avoid having to use a temp
@@ -10982,9 +10984,11 @@ bool ImageHelper::canCopyWithTransformForReadPixels(const PackPixelsParams &pack
     // Only allow copies to PBOs with identical format.
     const bool isSameFormatCopy = *readFormat == *packPixelsParams.destFormat;
 
-    // Disallow any transformation.
+    // Disallow rotation.  Flipped copies are done one row at a time, which isn't possible with
+    // block formats.
     const bool needsTransformation =
-        packPixelsParams.rotation != SurfaceRotation::Identity || packPixelsParams.reverseRowOrder;
+        packPixelsParams.rotation != SurfaceRotation::Identity ||
+        (packPixelsParams.reverseRowOrder && readFormat->isBlock);
 
     // Disallow copies when the output pitch cannot be correctly specified in Vulkan.
     const bool isPitchMultipleOfTexelSize =
@@ -11297,8 +11301,14 @@ angle::Result ImageHelper::readPixelsImpl(ContextVk *contextVk,
         ANGLE_TRACE_EVENT0("gpu.angle", "ImageHelper::readPixelsImpl - PBO");
 
         const ptrdiff_t pixelsOffset = reinterpret_cast<ptrdiff_t>(pixels);
-        if (canCopyWithTransformForReadPixels(packPixelsParams, srcExtent, readFormat,
-                                              pixelsOffset))
+
+        const bool canCopyWithTransfer = canCopyWithTransformForReadPixels(
+            packPixelsParams, srcExtent, readFormat, pixelsOffset);
+        const bool canCopyWithCompute  = canCopyWithComputeForReadPixels(
+            packPixelsParams, srcExtent, readFormat, pixelsOffset);
+
+        // A flipped copy takes a transfer region per row, so a single dispatch is preferred.
+        if (canCopyWithTransfer && (!packPixelsParams.reverseRowOrder || !canCopyWithCompute))
         {
             BufferHelper &packBuffer      = GetImpl(packPixelsParams.packBuffer)->getBuffer();
             VkDeviceSize packBufferOffset = packBuffer.getOffset();
@@ -11320,11 +11330,37 @@ angle::Result ImageHelper::readPixelsImpl(ContextVk *contextVk,
             region.imageOffset       = srcOffset;
             region.imageSubresource  = srcSubresource;
 
-            copyCommandBuffer->copyImageToBuffer(src->getImage(), src->getCurrentLayout(renderer),
-                                                 packBuffer.getBuffer().getHandle(), 1, &region);
+            if (!packPixelsParams.reverseRowOrder)
+            {
+                copyCommandBuffer->copyImageToBuffer(
+                    src->getImage(), src->getCurrentLayout(renderer),
+                    packBuffer.getBuffer().getHandle(), 1, &region);
+                return angle::Result::Continue;
+            }
+
+            // vkCmdCopyImageToBuffer can't flip the image, so copy each row to its flipped
+            // position in the buffer instead, with one region per row.  This keeps the readback on
+            // the GPU rather than waiting for it to finish and packing the rows on the CPU.
+            const VkDeviceSize firstRowOffset = region.bufferOffset;
+            region.bufferImageHeight          = 1;
+            region.imageExtent.height         = 1;
+
+            std::vector<VkBufferImageCopy> rowRegions(srcExtent.height, region);
+            for (uint32_t row = 0; row < srcExtent.height; ++row)
+            {
+                const VkDeviceSize flippedRow = srcExtent.height - 1 - row;
+
+                rowRegions[row].bufferOffset =
+                    firstRowOffset + flippedRow * packPixelsParams.outputPitch;
+                rowRegions[row].imageOffset.y = srcOffset.y + static_cast<int32_t>(row);
+            }
+            copyCommandBuffer->copyImageToBuffer(
+                src->getImage(), src->getCurrentLayout(renderer),
+                packBuffer.getBuffer().getHandle(), static_cast<uint32_t>(rowRegions.size()),
+                rowRegions.data());
             return angle::Result::Continue;
         }
-        if (canCopyWithComputeForReadPixels(packPixelsParams, srcExtent, readFormat, pixelsOffset))
+        if (canCopyWithCompute)
         {
             ANGLE_TRY(readPixelsWithCompute(contextVk, src, packPixelsParams, srcOffset, srcExtent,
                                             pixelsOffset, srcSubresource));
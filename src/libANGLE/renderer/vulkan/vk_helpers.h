@@ -428,6 +428,8 @@ class DynamicDescriptorPool final : angle::NonCopyable
         accum->accumulateCacheStats(cacheType, mCacheStats);
     }
     void resetDescriptorCacheStats() { mCacheStats.resetHitAndMissCount(); }
+    // Counts a hit on a cached descriptor set that the caller kept from an earlier lookup.
+    void onCachedDescriptorSetReused() { mCacheStats.hit(); }
     size_t getTotalCacheKeySizeBytes() const
     {
         return mDescriptorSetCache.getTotalCacheKeySizeBytes();
@@ -3806,7 +3808,7 @@ class ShaderProgramHelper : angle::NonCopyable
     void setShader(gl::ShaderType shaderType, RefCounted<ShaderModule> *shader);
 
     // Create a graphics pipeline and place it in the cache.  Must not be called if the pipeline
-    // exists in cache.
+    // exists in cache.  |pipelineDescHash| is the hash of |pipelineDesc| used for that lookup.
     template <typename PipelineHash>
     ANGLE_INLINE angle::Result createGraphicsPipeline(
         vk::Context *context,
@@ -3816,13 +3818,14 @@ class ShaderProgramHelper : angle::NonCopyable
         const PipelineLayout &pipelineLayout,
         PipelineSource source,
         const GraphicsPipelineDesc &pipelineDesc,
+        size_t pipelineDescHash,
         const SpecializationConstants &specConsts,
         const GraphicsPipelineDesc **descPtrOut,
         PipelineHelper **pipelineOut) const
     {
-        return graphicsPipelines->createPipeline(context, pipelineCache, compatibleRenderPass,
-                                                 pipelineLayout, mShaders, specConsts, source,
-                                                 pipelineDesc, descPtrOut, pipelineOut);
+        return graphicsPipelines->createPipeline(
+            context, pipelineCache, compatibleRenderPass, pipelineLayout, mShaders, specConsts,
+            source, pipelineDesc, pipelineDescHash, descPtrOut, pipelineOut);
     }
 
     void createMonolithicPipelineCreationTask(vk::Context *context,
@@ -48,6 +48,10 @@ constexpr const char *kDefaultPipelineCacheGraphDumpPath = "";
 
 constexpr VkFormatFeatureFlags kInvalidFormatFeatureFlags = static_cast<VkFormatFeatureFlags>(-1);
 
+// The default number of garbage objects the async garbage cleanup destroys before yielding to other
+// work. Overridden with ANGLE_GARBAGE_CLEANUP_BUDGET.
+constexpr size_t kDefaultGarbageCleanupBudget = 256;
+
 #if defined(ANGLE_EXPOSE_NON_CONFORMANT_EXTENSIONS_AND_VERSIONS)
 constexpr bool kExposeNonConformantExtensionsAndVersions = true;
 #else
@@ -1077,7 +1081,8 @@ void CompressAndStorePipelineCacheVk(vk::GlobalOps *globalOps,
     // To make it possible to store more pipeline cache data, compress the whole pipelineCache.
     angle::MemoryBuffer compressedData;
 
-    if (!angle::CompressBlob(cacheData.size(), cacheData.data(), &compressedData))
+    if (!angle::CompressBlob(globalOps->getBlobCompressionCodec(), cacheData.size(),
+                             cacheData.data(), &compressedData))
     {
         WARN() << "Skip syncing pipeline cache data as it failed compression.";
         return;
@@ -1763,6 +1768,16 @@ Renderer::Renderer()
     {
         mPipelineCacheGraphDumpPath = kDefaultPipelineCacheGraphDumpPath;
     }
+
+    mGarbageCleanupBudget = static_cast<size_t>(
+        strtoull(angle::GetEnvironmentVarOrAndroidProperty("ANGLE_GARBAGE_CLEANUP_BUDGET",
+                                                           "angle.garbage_cleanup_budget")
+                     .c_str(),
+                 nullptr, 10));
+    if (mGarbageCleanupBudget == 0)
+    {
+        mGarbageCleanupBudget = kDefaultGarbageCleanupBudget;
+    }
 }
 
 Renderer::~Renderer() {}
@@ -1806,6 +1821,7 @@ void Renderer::onDestroy(vk::Context *context)
 
     mSamplerCache.destroy(this);
     mYuvConversionCache.destroy(this);
+    mTransformedSpirvCache.destroy(this);
     mVkFormatDescriptorCountMap.clear();
 
     mOutsideRenderPassCommandBufferRecycler.onDestroy();
@@ -2728,6 +2744,7 @@ void Renderer::appendDeviceExtensionFeaturesNotPromoted(
 //                                          storageInputOutput16 (feature)
 // - VK_KHR_variable_pointers:              variablePointers (feature)
 //                                          variablePointersStorageBuffer (feature)
+// - VK_KHR_shader_draw_parameters:         shaderDrawParameters (feature)
 //
 //
 // Note that subgroup and protected memory features and properties came from unpublished extensions
@@ -2745,6 +2762,7 @@ void Renderer::appendDeviceExtensionFeaturesPromotedTo11(
     vk::AddToPNextChain(deviceProperties, &mMultiviewProperties);
     vk::AddToPNextChain(deviceFeatures, &m16BitStorageFeatures);
     vk::AddToPNextChain(deviceFeatures, &mVariablePointersFeatures);
+    vk::AddToPNextChain(deviceFeatures, &mShaderDrawParametersFeatures);
 }
 
 // The following features and properties used by ANGLE have been promoted to Vulkan 1.2:
@@ -3076,6 +3094,10 @@ void Renderer::queryDeviceExtensionFeatures(const vk::ExtensionNameList &deviceE
     mVariablePointersFeatures.sType =
         VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VARIABLE_POINTERS_FEATURES_KHR;
 
+    mShaderDrawParametersFeatures = {};
+    mShaderDrawParametersFeatures.sType =
+        VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_DRAW_PARAMETERS_FEATURES;
+
     // Rounding and denormal caps from VK_KHR_float_controls_properties
     mFloatControlProperties       = {};
     mFloatControlProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FLOAT_CONTROLS_PROPERTIES;
@@ -3162,6 +3184,7 @@ void Renderer::queryDeviceExtensionFeatures(const vk::ExtensionNameList &deviceE
     mSynchronization2Features.pNext                   = nullptr;
     mBlendOperationAdvancedFeatures.pNext             = nullptr;
     mVariablePointersFeatures.pNext                   = nullptr;
+    mShaderDrawParametersFeatures.pNext               = nullptr;
     mFloatControlProperties.pNext                     = nullptr;
 #if defined(ANGLE_PLATFORM_ANDROID)
     mExternalFormatResolveFeatures.pNext   = nullptr;
@@ -3543,6 +3566,11 @@ void Renderer::enableDeviceExtensionsPromotedTo11(const vk::ExtensionNameList &d
     }
 
     vk::AddToPNextChain(&mEnabledFeatures, &mVariablePointersFeatures);
+
+    if (mFeatures.supportsShaderDrawParameters.enabled)
+    {
+        vk::AddToPNextChain(&mEnabledFeatures, &mShaderDrawParametersFeatures);
+    }
 }
 
 // See comment above appendDeviceExtensionFeaturesPromotedTo12.  Additional extensions are enabled
@@ -4885,6 +4913,9 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
     ANGLE_FEATURE_CONDITION(&mFeatures, supportsMultiDrawIndirect,
                             mPhysicalDeviceFeatures.multiDrawIndirect == VK_TRUE);
 
+    ANGLE_FEATURE_CONDITION(&mFeatures, supportsShaderDrawParameters,
+                            mShaderDrawParametersFeatures.shaderDrawParameters == VK_TRUE);
+
     ANGLE_FEATURE_CONDITION(&mFeatures, perFrameWindowSizeQuery,
                             IsAndroid() || isIntel || (IsWindows() && isAMD) || IsFuchsia() ||
                                 isSamsung ||
@@ -5973,10 +6004,12 @@ angle::Result Renderer::syncPipelineCacheVk(vk::Context *context,
         // ensure the size can fit into the 32MB blob cache limit on supported platforms.
         constexpr size_t kMaxTotalSize = 64 * 1024 * 1024;
 
-        // Create task to compress.
+        // Create task to compress.  It's only waited on when the renderer is destroyed, so it
+        // shouldn't hold up compile and link tasks.
         mCompressEvent = contextGL->getWorkerThreadPool()->postWorkerTask(
             std::make_shared<CompressAndStorePipelineCacheTask>(
-                globalOps, this, std::move(pipelineCacheData), kMaxTotalSize));
+                globalOps, this, std::move(pipelineCacheData), kMaxTotalSize),
+            angle::WorkerTaskPriority::Low);
     }
     else
     {
@@ -6181,6 +6214,25 @@ void Renderer::cleanupGarbage()
     mRefCountedEventRecycler.cleanupResettingEvents(this);
 }
 
+bool Renderer::cleanupGarbageWithinBudget()
+{
+    ANGLE_TRACE_EVENT0("gpu.angle", "Renderer::cleanupGarbageWithinBudget");
+
+    // Suballocations are cleaned up first since they are the most common garbage, and the CPU gets
+    // throttled when too much of it accumulates.
+    size_t budget            = mGarbageCleanupBudget;
+    bool allGarbageDestroyed = mSuballocationGarbageList.cleanupSubmittedGarbage(this, &budget) &&
+                               mSharedGarbageList.cleanupSubmittedGarbage(this, &budget);
+    mOrphanedBufferBlockList.pruneEmptyBufferBlocks(this);
+    mRefCountedEventRecycler.cleanupResettingEvents(this);
+    return allGarbageDestroyed;
+}
+
+void Renderer::cleanupSuballocationGarbage()
+{
+    mSuballocationGarbageList.cleanupSubmittedGarbage(this);
+}
+
 void Renderer::cleanupPendingSubmissionGarbage()
 {
     // Check if pending garbage is still pending. If not, move them to the garbage list.
@@ -431,6 +431,7 @@ class Renderer : angle::NonCopyable
 
     SamplerCache &getSamplerCache() { return mSamplerCache; }
     SamplerYcbcrConversionCache &getYuvConversionCache() { return mYuvConversionCache; }
+    TransformedSpirvCache &getTransformedSpirvCache() { return mTransformedSpirvCache; }
 
     void onAllocateHandle(vk::HandleType handleType);
     void onDeallocateHandle(vk::HandleType handleType);
@@ -446,6 +447,10 @@ class Renderer : angle::NonCopyable
     bool haveSameFormatFeatureBits(angle::FormatID formatID1, angle::FormatID formatID2) const;
 
     void cleanupGarbage();
+    // Same as cleanupGarbage(), but destroys at most mGarbageCleanupBudget garbage objects so that
+    // a burst of garbage is destroyed over several passes. Returns false if garbage is left over.
+    bool cleanupGarbageWithinBudget();
+    void cleanupSuballocationGarbage();
     void cleanupPendingSubmissionGarbage();
 
     angle::Result submitCommands(vk::Context *context,
@@ -907,6 +912,7 @@ class Renderer : angle::NonCopyable
     VkPhysicalDevice16BitStorageFeatures m16BitStorageFeatures;
     VkPhysicalDeviceSynchronization2Features mSynchronization2Features;
     VkPhysicalDeviceVariablePointersFeatures mVariablePointersFeatures;
+    VkPhysicalDeviceShaderDrawParametersFeatures mShaderDrawParametersFeatures;
     VkPhysicalDeviceFloatControlsProperties mFloatControlProperties;
 
     uint32_t mLegacyDitheringVersion = 0;
@@ -935,6 +941,8 @@ class Renderer : angle::NonCopyable
     vk::RefCountedEventRecycler mRefCountedEventRecycler;
 
     VkDeviceSize mPendingGarbageSizeLimit;
+    // The maximum number of garbage objects destroyed by one cleanupGarbageWithinBudget() call.
+    size_t mGarbageCleanupBudget;
 
     vk::FormatTable mFormatTable;
     // A cache of VkFormatProperties as queried from the device over time.
@@ -1007,6 +1015,7 @@ class Renderer : angle::NonCopyable
 
     SamplerCache mSamplerCache;
     SamplerYcbcrConversionCache mYuvConversionCache;
+    TransformedSpirvCache mTransformedSpirvCache;
     angle::HashMap<VkFormat, uint32_t> mVkFormatDescriptorCountMap;
     vk::ActiveHandleCounter mActiveHandleCounts;
     angle::SimpleMutex mActiveHandleCountsMutex;
@@ -15,6 +15,7 @@
 #include "libANGLE/HandleAllocator.h"
 #include "libANGLE/renderer/vulkan/vk_utils.h"
 
+#include <limits>
 #include <queue>
 
 namespace rx
@@ -168,6 +169,7 @@ class SharedGarbage final : angle::NonCopyable
     bool hasResourceUseSubmitted(Renderer *renderer) const;
     // This is not being used now.
     VkDeviceSize getSize() const { return 0; }
+    size_t getObjectCount() const { return mGarbage.size(); }
 
   private:
     ResourceUse mLifetime;
@@ -235,24 +237,42 @@ class SharedGarbageList final : angle::NonCopyable
     }
     void resetDestroyedGarbageSize() { mTotalGarbageDestroyed = 0; }
 
-    // Number of bytes destroyed is returned.
     void cleanupSubmittedGarbage(Renderer *renderer)
+    {
+        size_t unlimitedBudget = std::numeric_limits<size_t>::max();
+        cleanupSubmittedGarbage(renderer, &unlimitedBudget);
+    }
+
+    // Destroys completed garbage until |*budget| objects are destroyed, and decrements |*budget| by
+    // the number of objects destroyed. Garbage is destroyed whole, so the last one may take more
+    // objects than were left in the budget. Returns false if the budget ran out while garbage was
+    // still queued.
+    bool cleanupSubmittedGarbage(Renderer *renderer, size_t *budget)
     {
         std::unique_lock<angle::SimpleMutex> lock(mSubmittedQueueDequeueMutex);
         VkDeviceSize bytesDestroyed = 0;
+        bool budgetExhausted        = false;
         while (!mSubmittedQueue.empty())
         {
-            T &garbage        = mSubmittedQueue.front();
-            VkDeviceSize size = garbage.getSize();
+            if (*budget == 0)
+            {
+                budgetExhausted = true;
+                break;
+            }
+            T &garbage         = mSubmittedQueue.front();
+            VkDeviceSize size  = garbage.getSize();
+            size_t objectCount = garbage.getObjectCount();
             if (!garbage.destroyIfComplete(renderer))
             {
                 break;
             }
             bytesDestroyed += size;
             mSubmittedQueue.pop();
+            *budget -= std::min(objectCount, *budget);
         }
         mTotalSubmittedGarbageBytes -= bytesDestroyed;
         mTotalGarbageDestroyed += bytesDestroyed;
+        return !budgetExhausted;
     }
 
     // Check if pending garbage is still pending submission. If not, move them to the garbage list.
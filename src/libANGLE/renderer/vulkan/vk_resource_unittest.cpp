@@ -0,0 +1,167 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// vk_resource_unittest:
+//   Unit tests for the budgeted cleanup of SharedGarbageList.
+//
+
+#include <gtest/gtest.h>
+
+#include "libANGLE/renderer/vulkan/vk_resource.h"
+
+namespace rx
+{
+namespace vk
+{
+namespace
+{
+// Garbage made of |objectCount| objects, which is destroyed once the GPU is done with it.
+class FakeGarbage
+{
+  public:
+    FakeGarbage() = default;
+    FakeGarbage(size_t objectCount, const bool *gpuDone, size_t *destroyedObjectCount)
+        : mObjectCount(objectCount), mGpuDone(gpuDone), mDestroyedObjectCount(destroyedObjectCount)
+    {}
+
+    bool destroyIfComplete(Renderer *renderer)
+    {
+        if (!*mGpuDone)
+        {
+            return false;
+        }
+        *mDestroyedObjectCount += mObjectCount;
+        return true;
+    }
+    bool hasResourceUseSubmitted(Renderer *renderer) const { return true; }
+    VkDeviceSize getSize() const { return 0; }
+    size_t getObjectCount() const { return mObjectCount; }
+
+  private:
+    size_t mObjectCount           = 0;
+    const bool *mGpuDone          = nullptr;
+    size_t *mDestroyedObjectCount = nullptr;
+};
+
+class SharedGarbageListTest : public testing::Test
+{
+  protected:
+    void TearDown() override
+    {
+        mGpuDone = true;
+        mGarbageList.cleanupSubmittedGarbage(nullptr);
+    }
+
+    void addGarbage(size_t objectCount)
+    {
+        mGarbageList.add(nullptr, FakeGarbage(objectCount, &mGpuDone, &mDestroyedObjectCount));
+    }
+
+    SharedGarbageList<FakeGarbage> mGarbageList;
+    bool mGpuDone                = false;
+    size_t mDestroyedObjectCount = 0;
+};
+
+// Tests that the budget counts the objects in the garbage rather than the garbage.
+TEST_F(SharedGarbageListTest, BudgetCountsObjects)
+{
+    for (int i = 0; i < 5; ++i)
+    {
+        addGarbage(3);
+    }
+    mGpuDone = true;
+
+    size_t budget = 6;
+    EXPECT_FALSE(mGarbageList.cleanupSubmittedGarbage(nullptr, &budget));
+    EXPECT_EQ(6u, mDestroyedObjectCount);
+    EXPECT_EQ(0u, budget);
+
+    // Garbage is not split, so the garbage that runs out the budget is destroyed whole.
+    budget = 4;
+    EXPECT_FALSE(mGarbageList.cleanupSubmittedGarbage(nullptr, &budget));
+    EXPECT_EQ(12u, mDestroyedObjectCount);
+    EXPECT_EQ(0u, budget);
+
+    // The last garbage fits in the budget, which leaves the list empty.
+    budget = 4;
+    EXPECT_TRUE(mGarbageList.cleanupSubmittedGarbage(nullptr, &budget));
+    EXPECT_EQ(15u, mDestroyedObjectCount);
+    EXPECT_EQ(1u, budget);
+    EXPECT_TRUE(mGarbageList.empty());
+}
+
+// Tests that garbage the GPU is still using stops the cleanup without asking for another pass, so
+// the cleanup thread doesn't spin until the GPU is done.
+TEST_F(SharedGarbageListTest, IncompleteGarbageDoesNotRearm)
+{
+    addGarbage(1);
+    addGarbage(1);
+
+    size_t budget = 1;
+    EXPECT_TRUE(mGarbageList.cleanupSubmittedGarbage(nullptr, &budget));
+    EXPECT_EQ(0u, mDestroyedObjectCount);
+    EXPECT_EQ(1u, budget);
+    EXPECT_FALSE(mGarbageList.empty());
+}
+
+// Tests that a burst of garbage is destroyed over as many passes as the budget requires, with the
+// cleanup thread re-armed after every pass but the last, the way it is driven by
+// Renderer::cleanupGarbageWithinBudget().
+TEST_F(SharedGarbageListTest, BurstIsDestroyedOverSeveralPasses)
+{
+    constexpr size_t kGarbageCount = 1000;
+    constexpr size_t kBudget       = 64;
+
+    for (size_t i = 0; i < kGarbageCount; ++i)
+    {
+        addGarbage(1);
+    }
+    mGpuDone = true;
+
+    size_t passCount  = 0;
+    bool needsAnother = true;
+    while (needsAnother)
+    {
+        const size_t destroyedBefore = mDestroyedObjectCount;
+        size_t budget                = kBudget;
+        needsAnother                 = !mGarbageList.cleanupSubmittedGarbage(nullptr, &budget);
+        EXPECT_LE(mDestroyedObjectCount - destroyedBefore, kBudget);
+        ++passCount;
+        ASSERT_LE(passCount, kGarbageCount);
+    }
+
+    EXPECT_EQ(kGarbageCount, mDestroyedObjectCount);
+    EXPECT_EQ((kGarbageCount + kBudget) / kBudget, passCount);
+    EXPECT_TRUE(mGarbageList.empty());
+}
+
+// Tests that the budget left over by one list is used by the next one, and that a list is not
+// cleaned at all once the budget is spent.
+TEST_F(SharedGarbageListTest, BudgetIsSharedBetweenLists)
+{
+    SharedGarbageList<FakeGarbage> otherGarbageList;
+    size_t otherDestroyedObjectCount = 0;
+
+    addGarbage(2);
+    otherGarbageList.add(nullptr, FakeGarbage(2, &mGpuDone, &otherDestroyedObjectCount));
+    otherGarbageList.add(nullptr, FakeGarbage(2, &mGpuDone, &otherDestroyedObjectCount));
+    mGpuDone = true;
+
+    size_t budget = 4;
+    EXPECT_TRUE(mGarbageList.cleanupSubmittedGarbage(nullptr, &budget));
+    EXPECT_FALSE(otherGarbageList.cleanupSubmittedGarbage(nullptr, &budget));
+    EXPECT_EQ(2u, mDestroyedObjectCount);
+    EXPECT_EQ(2u, otherDestroyedObjectCount);
+
+    budget = 0;
+    EXPECT_FALSE(otherGarbageList.cleanupSubmittedGarbage(nullptr, &budget));
+    EXPECT_EQ(2u, otherDestroyedObjectCount);
+
+    otherGarbageList.cleanupSubmittedGarbage(nullptr);
+    EXPECT_EQ(4u, otherDestroyedObjectCount);
+}
+}  // anonymous namespace
+}  // namespace vk
+}  // namespace rx
@@ -0,0 +1,213 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// command_stream.cpp : Implements the stream that executes the GL calls of a context on a
+// dedicated thread.
+
+#include "libGLESv2/command_stream.h"
+
+#include "common/debug.h"
+#include "common/mathutil.h"
+#include "common/system_utils.h"
+#include "libANGLE/Context.h"
+#include "libANGLE/Thread.h"
+#include "libANGLE/VertexArray.h"
+#include "libGLESv2/global_state.h"
+
+namespace gl
+{
+namespace
+{
+// 1MB of recorded calls.
+constexpr uint64_t kSlotCount = 64 * 1024;
+static_assert(isPow2(kSlotCount), "The buffer size must be a power of two");
+}  // anonymous namespace
+
+CommandStream::CommandStream(Context *context)
+    : mContext(context),
+      mSlots(kSlotCount),
+      mWritePosition(0),
+      mReadPosition(0),
+      mAllocatedPosition(0),
+      mConsumerWaiting(false),
+      mProducerWaiting(false),
+      mExitThread(false),
+      mRecording(context->getState().getDebug().getCallback() == nullptr),
+      mMayUseClientArrays(true)
+{
+    mThread = std::thread(&CommandStream::threadMain, this);
+}
+
+CommandStream::~CommandStream()
+{
+    finish();
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mExitThread = true;
+    }
+    mWriteCondition.notify_one();
+    mThread.join();
+}
+
+CommandStream::Slot *CommandStream::allocate(uint32_t slotCount)
+{
+    ASSERT(slotCount <= kSlotCount);
+
+    const uint64_t writePosition = mWritePosition.load(std::memory_order_relaxed);
+    const uint64_t index         = writePosition % kSlotCount;
+
+    // Commands are contiguous, so a command that doesn't fit before the end of the buffer is
+    // recorded at its start, after padding.
+    const uint64_t paddingCount = index + slotCount > kSlotCount ? kSlotCount - index : 0;
+    mAllocatedPosition          = writePosition + paddingCount + slotCount;
+    waitForReadPosition(mAllocatedPosition - kSlotCount);
+
+    if (paddingCount > 0)
+    {
+        CommandHeader *padding = reinterpret_cast<CommandHeader *>(&mSlots[index]);
+        padding->execute       = nullptr;
+        padding->slotCount     = static_cast<uint32_t>(paddingCount);
+        return &mSlots[0];
+    }
+    return &mSlots[index];
+}
+
+void CommandStream::submit()
+{
+    mWritePosition.store(mAllocatedPosition);
+
+    // Pairs with the check of the write position the consumer makes before blocking.
+    if (mConsumerWaiting.load())
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mWriteCondition.notify_one();
+    }
+}
+
+void CommandStream::finish()
+{
+    waitForReadPosition(mWritePosition.load(std::memory_order_relaxed));
+}
+
+void CommandStream::onDebugCallbackChange(bool hasCallback)
+{
+    // The callback must be called on the thread that makes the call that triggers it.
+    mRecording = !hasCallback;
+}
+
+bool CommandStream::updateClientArrayUse()
+{
+    finish();
+
+    // Client arrays can only be used with the default vertex array.  A disabled attribute may be
+    // enabled by a call recorded later, so all of them are checked.
+    const VertexArray *vertexArray = mContext->getVertexArray({0});
+    mMayUseClientArrays            = false;
+    for (size_t attribIndex : vertexArray->getClientAttribsMask())
+    {
+        if (vertexArray->getVertexAttribute(attribIndex).pointer != nullptr)
+        {
+            mMayUseClientArrays = true;
+            break;
+        }
+    }
+    return mMayUseClientArrays;
+}
+
+void CommandStream::waitForReadPosition(uint64_t position)
+{
+    // Positions may be "negative" while the buffer fills up for the first time.
+    if (static_cast<int64_t>(mReadPosition.load(std::memory_order_acquire) - position) >= 0)
+    {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(mMutex);
+    mProducerWaiting.store(true);
+    mReadCondition.wait(lock, [this, position]() {
+        return static_cast<int64_t>(mReadPosition.load() - position) >= 0;
+    });
+    mProducerWaiting.store(false);
+}
+
+void CommandStream::threadMain()
+{
+    angle::SetCurrentThreadName("ANGLE-CmdStream");
+
+    // The calls go through the same entry points as on the application thread, which find the
+    // context in the thread-local state.  The context isn't made current through EGL, so this
+    // thread doesn't take part in its lifetime.
+    egl::Thread *thread = egl::GetCurrentThread();
+    thread->setCurrent(mContext);
+    SetCurrentValidContext(mContext);
+
+    uint64_t readPosition = 0;
+    while (true)
+    {
+        const uint64_t writePosition = mWritePosition.load(std::memory_order_acquire);
+        if (readPosition == writePosition)
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mConsumerWaiting.store(true);
+            mWriteCondition.wait(lock, [this, readPosition]() {
+                return mWritePosition.load() != readPosition || mExitThread;
+            });
+            mConsumerWaiting.store(false);
+
+            if (mWritePosition.load() == readPosition)
+            {
+                break;
+            }
+            continue;
+        }
+
+        while (readPosition != writePosition)
+        {
+            const Slot *slot            = &mSlots[readPosition % kSlotCount];
+            const CommandHeader *header = reinterpret_cast<const CommandHeader *>(slot);
+            if (header->execute != nullptr)
+            {
+                header->execute(slot + 1);
+            }
+            readPosition += header->slotCount;
+            mReadPosition.store(readPosition);
+
+            // Pairs with the check of the read position the producer makes before blocking.
+            if (mProducerWaiting.load())
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                mReadCondition.notify_one();
+            }
+        }
+    }
+
+    thread->setCurrent(nullptr);
+    SetCurrentValidContext(nullptr);
+}
+
+#if defined(ANGLE_ENABLE_COMMAND_STREAM)
+thread_local CommandStream *gCurrentCommandStream = nullptr;
+
+void SetCurrentCommandStreamContext(Context *context)
+{
+    CommandStream *stream = gCurrentCommandStream;
+    if (stream != nullptr && stream->getContext() == context)
+    {
+        return;
+    }
+
+    // The EGL call that changed the current context has already waited for the previous stream.
+    gCurrentCommandStream = nullptr;
+    SafeDelete(stream);
+
+    if (context != nullptr && context->getFrontendFeatures().threadedCommandStream.enabled)
+    {
+        gCurrentCommandStream = new CommandStream(context);
+    }
+}
+#endif  // defined(ANGLE_ENABLE_COMMAND_STREAM)
+
+}  // namespace gl
@@ -0,0 +1,221 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// command_stream.h : Defines the stream that executes the GL calls of a context on a dedicated
+// thread.
+
+#ifndef LIBGLESV2_COMMANDSTREAM_H_
+#define LIBGLESV2_COMMANDSTREAM_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "common/angleutils.h"
+#include "common/platform.h"
+
+namespace gl
+{
+class Context;
+
+// Records the GL calls made on the thread a context is current to, and executes them in order on a
+// dedicated thread to which the same context is current.  Only calls that return nothing and take
+// no pointers are recorded: their parameters can be copied, and the application can't tell when
+// they are executed.  Every other call, including all EGL calls, waits for the recorded calls to be
+// executed and then runs on the application thread as usual.
+//
+// A few calls that fit the above can still be observed by the application, and are only recorded
+// when they can't be:
+//
+//  - Draws that don't take indices read the vertex attributes from client memory, which the
+//    application may overwrite as soon as the call returns.  They run on the application thread
+//    while the default vertex array may point to client memory.
+//  - Errors and other debug messages are reported to the KHR_debug callback on the thread that
+//    executes the call.  Nothing is recorded while a callback is installed.
+//
+// The calls are recorded in a ring buffer with a single producer and a single consumer.  Neither
+// thread takes a lock unless the buffer is full or the consumer runs out of calls to execute.
+class CommandStream : angle::NonCopyable
+{
+  public:
+    explicit CommandStream(Context *context);
+    // Executes the remaining calls and stops the thread.
+    ~CommandStream();
+
+    Context *getContext() const { return mContext; }
+
+    // Records a call to |kEntryPoint| with |args|.
+    template <auto kEntryPoint, typename... Args>
+    void enqueue(Args... args)
+    {
+        using Params = std::tuple<Args...>;
+        static_assert((std::is_arithmetic_v<Args> && ...), "Only scalar parameters are recorded");
+        static_assert(alignof(Params) <= sizeof(Slot), "Parameters are over-aligned");
+
+        constexpr uint32_t kSlotCount = 1 + (sizeof(Params) + sizeof(Slot) - 1) / sizeof(Slot);
+        Slot *slot                    = allocate(kSlotCount);
+
+        CommandHeader *header = reinterpret_cast<CommandHeader *>(slot);
+        header->execute       = &Execute<kEntryPoint, Args...>;
+        header->slotCount     = kSlotCount;
+        new (slot + 1) Params(args...);
+
+        submit();
+    }
+
+    // Waits until every recorded call is executed.
+    void finish();
+
+    bool isRecording() const { return mRecording; }
+    // Called when the KHR_debug callback is set.
+    void onDebugCallbackChange(bool hasCallback);
+
+    // Returns whether a draw that may read client arrays can be recorded.  If not, waits for the
+    // recorded calls to be executed so the draw can run on the application thread.
+    bool canRecordDraw() { return mRecording && (!mMayUseClientArrays || !updateClientArrayUse()); }
+    // Called when a vertex attribute pointer may have been set to client memory.
+    void onClientArrayChange() { mMayUseClientArrays = true; }
+
+  private:
+    // The buffer is made of slots.  A command takes a slot for its header followed by as many as
+    // needed for its parameters.
+    struct alignas(16) Slot
+    {
+        uint8_t data[16];
+    };
+
+    using ExecuteFunc = void (*)(const Slot *params);
+    struct CommandHeader
+    {
+        // Null for the padding that skips the end of the buffer.
+        ExecuteFunc execute;
+        uint32_t slotCount;
+    };
+    static_assert(sizeof(CommandHeader) <= sizeof(Slot), "Header doesn't fit in a slot");
+
+    template <auto kEntryPoint, typename... Args>
+    static void Execute(const Slot *params)
+    {
+        std::apply(kEntryPoint, *reinterpret_cast<const std::tuple<Args...> *>(params));
+    }
+
+    // Returns |slotCount| contiguous slots, waiting for the consumer to free them if necessary.
+    Slot *allocate(uint32_t slotCount);
+    // Makes the last allocated command visible to the consumer.
+    void submit();
+    void waitForReadPosition(uint64_t position);
+    // Waits for the recorded calls to be executed and checks whether the default vertex array still
+    // points to client memory.
+    bool updateClientArrayUse();
+
+    void threadMain();
+
+    Context *mContext;
+    std::vector<Slot> mSlots;
+
+    // Positions only ever increase, and are taken modulo the size of the buffer.  The write
+    // position is only changed by the producer and the read position by the consumer.
+    std::atomic<uint64_t> mWritePosition;
+    std::atomic<uint64_t> mReadPosition;
+    // The write position after the command being recorded.
+    uint64_t mAllocatedPosition;
+
+    // Set by a thread that is about to block on the corresponding condition, so the other thread
+    // knows to wake it.
+    std::atomic<bool> mConsumerWaiting;
+    std::atomic<bool> mProducerWaiting;
+
+    std::mutex mMutex;
+    std::condition_variable mWriteCondition;
+    std::condition_variable mReadCondition;
+    bool mExitThread;
+
+    std::thread mThread;
+
+    // Only accessed by the producer.
+    bool mRecording;
+    bool mMayUseClientArrays;
+};
+
+#if defined(ANGLE_ENABLE_COMMAND_STREAM)
+// The stream of the context current to the thread, if the context has the threadedCommandStream
+// feature enabled.
+extern thread_local CommandStream *gCurrentCommandStream;
+
+// Called whenever the context current to the thread may have changed.
+void SetCurrentCommandStreamContext(Context *context);
+
+// Records the call to the entry point it's used in and returns, if the thread has a stream that is
+// recording.  A stream that isn't recording has no calls left to execute.
+#    define ANGLE_COMMAND_STREAM_ENQUEUE(EP, ...)                             \
+        do                                                                    \
+        {                                                                     \
+            gl::CommandStream *stream_ = gl::gCurrentCommandStream;           \
+            if (ANGLE_UNLIKELY(stream_ != nullptr) && stream_->isRecording()) \
+            {                                                                 \
+                stream_->enqueue<&EP>(__VA_ARGS__);                           \
+                return;                                                       \
+            }                                                                 \
+        } while (0)
+
+// Same as ANGLE_COMMAND_STREAM_ENQUEUE, for draws that may read client arrays.
+#    define ANGLE_COMMAND_STREAM_ENQUEUE_DRAW(EP, ...)                          \
+        do                                                                      \
+        {                                                                       \
+            gl::CommandStream *stream_ = gl::gCurrentCommandStream;             \
+            if (ANGLE_UNLIKELY(stream_ != nullptr) && stream_->canRecordDraw()) \
+            {                                                                   \
+                stream_->enqueue<&EP>(__VA_ARGS__);                             \
+                return;                                                         \
+            }                                                                   \
+        } while (0)
+
+// Waits for the recorded calls to be executed before the entry point it's used in runs.
+#    define ANGLE_COMMAND_STREAM_SYNC()                               \
+        do                                                            \
+        {                                                             \
+            if (ANGLE_UNLIKELY(gl::gCurrentCommandStream != nullptr)) \
+            {                                                         \
+                gl::gCurrentCommandStream->finish();                  \
+            }                                                         \
+        } while (0)
+
+// Same as ANGLE_COMMAND_STREAM_SYNC, for calls that set a vertex attribute pointer.
+#    define ANGLE_COMMAND_STREAM_SYNC_CLIENT_ARRAYS()                 \
+        do                                                            \
+        {                                                             \
+            if (ANGLE_UNLIKELY(gl::gCurrentCommandStream != nullptr)) \
+            {                                                         \
+                gl::gCurrentCommandStream->finish();                  \
+                gl::gCurrentCommandStream->onClientArrayChange();     \
+            }                                                         \
+        } while (0)
+
+// Same as ANGLE_COMMAND_STREAM_SYNC, for calls that set the KHR_debug callback.
+#    define ANGLE_COMMAND_STREAM_SYNC_DEBUG_CALLBACK(CALLBACK)                         \
+        do                                                                             \
+        {                                                                              \
+            if (ANGLE_UNLIKELY(gl::gCurrentCommandStream != nullptr))                  \
+            {                                                                          \
+                gl::gCurrentCommandStream->finish();                                   \
+                gl::gCurrentCommandStream->onDebugCallbackChange(CALLBACK != nullptr); \
+            }                                                                          \
+        } while (0)
+#else
+#    define ANGLE_COMMAND_STREAM_ENQUEUE(EP, ...)
+#    define ANGLE_COMMAND_STREAM_ENQUEUE_DRAW(EP, ...)
+#    define ANGLE_COMMAND_STREAM_SYNC()
+#    define ANGLE_COMMAND_STREAM_SYNC_CLIENT_ARRAYS()
+#    define ANGLE_COMMAND_STREAM_SYNC_DEBUG_CALLBACK(CALLBACK)
+#endif  // defined(ANGLE_ENABLE_COMMAND_STREAM)
+
+}  // namespace gl
+
+#endif  // LIBGLESV2_COMMANDSTREAM_H_
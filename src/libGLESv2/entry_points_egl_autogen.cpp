@@ -30,7 +30,7 @@ EGLBoolean EGLAPIENTRY EGL_ChooseConfig(EGLDisplay dpy,
                                         EGLint config_size,
                                         EGLint *num_config)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -71,7 +71,7 @@ EGLBoolean EGLAPIENTRY EGL_CopyBuffers(EGLDisplay dpy,
                                        EGLSurface surface,
                                        EGLNativePixmapType target)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -109,7 +109,7 @@ EGLContext EGLAPIENTRY EGL_CreateContext(EGLDisplay dpy,
                                          EGLContext share_context,
                                          const EGLint *attrib_list)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLContext returnValue;
     {
@@ -152,7 +152,7 @@ EGLSurface EGLAPIENTRY EGL_CreatePbufferSurface(EGLDisplay dpy,
                                                 EGLConfig config,
                                                 const EGLint *attrib_list)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLSurface returnValue;
     {
@@ -193,7 +193,7 @@ EGLSurface EGLAPIENTRY EGL_CreatePixmapSurface(EGLDisplay dpy,
                                                EGLNativePixmapType pixmap,
                                                const EGLint *attrib_list)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLSurface returnValue;
     {
@@ -235,7 +235,7 @@ EGLSurface EGLAPIENTRY EGL_CreateWindowSurface(EGLDisplay dpy,
                                                EGLNativeWindowType win,
                                                const EGLint *attrib_list)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLSurface returnValue;
     {
@@ -274,7 +274,7 @@ EGLSurface EGLAPIENTRY EGL_CreateWindowSurface(EGLDisplay dpy,
 
 EGLBoolean EGLAPIENTRY EGL_DestroyContext(EGLDisplay dpy, EGLContext ctx)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -307,7 +307,7 @@ EGLBoolean EGLAPIENTRY EGL_DestroyContext(EGLDisplay dpy, EGLContext ctx)
 
 EGLBoolean EGLAPIENTRY EGL_DestroySurface(EGLDisplay dpy, EGLSurface surface)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -343,7 +343,7 @@ EGLBoolean EGLAPIENTRY EGL_GetConfigAttrib(EGLDisplay dpy,
                                            EGLint attribute,
                                            EGLint *value)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -382,7 +382,7 @@ EGLBoolean EGLAPIENTRY EGL_GetConfigs(EGLDisplay dpy,
                                       EGLint config_size,
                                       EGLint *num_config)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -417,7 +417,7 @@ EGLBoolean EGLAPIENTRY EGL_GetConfigs(EGLDisplay dpy,
 
 EGLDisplay EGLAPIENTRY EGL_GetCurrentDisplay()
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLDisplay returnValue;
 
@@ -441,7 +441,7 @@ EGLDisplay EGLAPIENTRY EGL_GetCurrentDisplay()
 
 EGLSurface EGLAPIENTRY EGL_GetCurrentSurface(EGLint readdraw)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLSurface returnValue;
 
@@ -465,7 +465,7 @@ EGLSurface EGLAPIENTRY EGL_GetCurrentSurface(EGLint readdraw)
 
 EGLDisplay EGLAPIENTRY EGL_GetDisplay(EGLNativeDisplayType display_id)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLDisplay returnValue;
     {
@@ -493,7 +493,7 @@ EGLDisplay EGLAPIENTRY EGL_GetDisplay(EGLNativeDisplayType display_id)
 
 EGLint EGLAPIENTRY EGL_GetError()
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLint returnValue;
 
@@ -517,7 +517,7 @@ EGLint EGLAPIENTRY EGL_GetError()
 
 __eglMustCastToProperFunctionPointerType EGLAPIENTRY EGL_GetProcAddress(const char *procname)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     __eglMustCastToProperFunctionPointerType returnValue;
     {
@@ -546,7 +546,7 @@ __eglMustCastToProperFunctionPointerType EGLAPIENTRY EGL_GetProcAddress(const ch
 
 EGLBoolean EGLAPIENTRY EGL_Initialize(EGLDisplay dpy, EGLint *major, EGLint *minor)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -582,7 +582,7 @@ EGLBoolean EGLAPIENTRY EGL_MakeCurrent(EGLDisplay dpy,
                                        EGLSurface read,
                                        EGLContext ctx)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -623,7 +623,7 @@ EGLBoolean EGLAPIENTRY EGL_QueryContext(EGLDisplay dpy,
                                         EGLint attribute,
                                         EGLint *value)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -659,7 +659,7 @@ EGLBoolean EGLAPIENTRY EGL_QueryContext(EGLDisplay dpy,
 
 const char *EGLAPIENTRY EGL_QueryString(EGLDisplay dpy, EGLint name)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     const char *returnValue;
     {
@@ -693,6 +693,7 @@ EGLBoolean EGLAPIENTRY EGL_QuerySurface(EGLDisplay dpy,
                                         EGLint attribute,
                                         EGLint *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     if (attribute == EGL_BUFFER_AGE_EXT)
     {
         ANGLE_EGLBOOLEAN_TRY(EGL_PrepareSwapBuffersANGLE(dpy, surface));
@@ -732,6 +733,7 @@ EGLBoolean EGLAPIENTRY EGL_QuerySurface(EGLDisplay dpy,
 
 EGLBoolean EGLAPIENTRY EGL_SwapBuffers(EGLDisplay dpy, EGLSurface surface)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     ANGLE_EGLBOOLEAN_TRY(EGL_PrepareSwapBuffersANGLE(dpy, surface));
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
@@ -765,7 +767,7 @@ EGLBoolean EGLAPIENTRY EGL_SwapBuffers(EGLDisplay dpy, EGLSurface surface)
 
 EGLBoolean EGLAPIENTRY EGL_Terminate(EGLDisplay dpy)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -796,7 +798,7 @@ EGLBoolean EGLAPIENTRY EGL_Terminate(EGLDisplay dpy)
 
 EGLBoolean EGLAPIENTRY EGL_WaitGL()
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -824,7 +826,7 @@ EGLBoolean EGLAPIENTRY EGL_WaitGL()
 
 EGLBoolean EGLAPIENTRY EGL_WaitNative(EGLint engine)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -853,7 +855,7 @@ EGLBoolean EGLAPIENTRY EGL_WaitNative(EGLint engine)
 // EGL 1.1
 EGLBoolean EGLAPIENTRY EGL_BindTexImage(EGLDisplay dpy, EGLSurface surface, EGLint buffer)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -887,7 +889,7 @@ EGLBoolean EGLAPIENTRY EGL_BindTexImage(EGLDisplay dpy, EGLSurface surface, EGLi
 
 EGLBoolean EGLAPIENTRY EGL_ReleaseTexImage(EGLDisplay dpy, EGLSurface surface, EGLint buffer)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -925,7 +927,7 @@ EGLBoolean EGLAPIENTRY EGL_SurfaceAttrib(EGLDisplay dpy,
                                          EGLint attribute,
                                          EGLint value)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -961,7 +963,7 @@ EGLBoolean EGLAPIENTRY EGL_SurfaceAttrib(EGLDisplay dpy,
 
 EGLBoolean EGLAPIENTRY EGL_SwapInterval(EGLDisplay dpy, EGLint interval)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -993,7 +995,7 @@ EGLBoolean EGLAPIENTRY EGL_SwapInterval(EGLDisplay dpy, EGLint interval)
 // EGL 1.2
 EGLBoolean EGLAPIENTRY EGL_BindAPI(EGLenum api)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -1025,7 +1027,7 @@ EGLSurface EGLAPIENTRY EGL_CreatePbufferFromClientBuffer(EGLDisplay dpy,
                                                          EGLConfig config,
                                                          const EGLint *attrib_list)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLSurface returnValue;
     {
@@ -1066,7 +1068,7 @@ EGLSurface EGLAPIENTRY EGL_CreatePbufferFromClientBuffer(EGLDisplay dpy,
 
 EGLenum EGLAPIENTRY EGL_QueryAPI()
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLenum returnValue;
     {
@@ -1094,7 +1096,7 @@ EGLenum EGLAPIENTRY EGL_QueryAPI()
 
 EGLBoolean EGLAPIENTRY EGL_ReleaseThread()
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -1122,7 +1124,7 @@ EGLBoolean EGLAPIENTRY EGL_ReleaseThread()
 
 EGLBoolean EGLAPIENTRY EGL_WaitClient()
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -1151,7 +1153,7 @@ EGLBoolean EGLAPIENTRY EGL_WaitClient()
 // EGL 1.4
 EGLContext EGLAPIENTRY EGL_GetCurrentContext()
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLContext returnValue;
 
@@ -1176,7 +1178,7 @@ EGLContext EGLAPIENTRY EGL_GetCurrentContext()
 // EGL 1.5
 EGLint EGLAPIENTRY EGL_ClientWaitSync(EGLDisplay dpy, EGLSync sync, EGLint flags, EGLTime timeout)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLint returnValue;
     {
@@ -1215,7 +1217,7 @@ EGLImage EGLAPIENTRY EGL_CreateImage(EGLDisplay dpy,
                                      EGLClientBuffer buffer,
                                      const EGLAttrib *attrib_list)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLImage returnValue;
     {
@@ -1258,7 +1260,7 @@ EGLSurface EGLAPIENTRY EGL_CreatePlatformPixmapSurface(EGLDisplay dpy,
                                                        void *native_pixmap,
                                                        const EGLAttrib *attrib_list)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLSurface returnValue;
     {
@@ -1302,7 +1304,7 @@ EGLSurface EGLAPIENTRY EGL_CreatePlatformWindowSurface(EGLDisplay dpy,
                                                        void *native_window,
                                                        const EGLAttrib *attrib_list)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLSurface returnValue;
     {
@@ -1343,7 +1345,7 @@ EGLSurface EGLAPIENTRY EGL_CreatePlatformWindowSurface(EGLDisplay dpy,
 
 EGLSync EGLAPIENTRY EGL_CreateSync(EGLDisplay dpy, EGLenum type, const EGLAttrib *attrib_list)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLSync returnValue;
     {
@@ -1379,7 +1381,7 @@ EGLSync EGLAPIENTRY EGL_CreateSync(EGLDisplay dpy, EGLenum type, const EGLAttrib
 
 EGLBoolean EGLAPIENTRY EGL_DestroyImage(EGLDisplay dpy, EGLImage image)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -1412,7 +1414,7 @@ EGLBoolean EGLAPIENTRY EGL_DestroyImage(EGLDisplay dpy, EGLImage image)
 
 EGLBoolean EGLAPIENTRY EGL_DestroySync(EGLDisplay dpy, EGLSync sync)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -1447,7 +1449,7 @@ EGLDisplay EGLAPIENTRY EGL_GetPlatformDisplay(EGLenum platform,
                                               void *native_display,
                                               const EGLAttrib *attrib_list)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLDisplay returnValue;
     {
@@ -1486,7 +1488,7 @@ EGLBoolean EGLAPIENTRY EGL_GetSyncAttrib(EGLDisplay dpy,
                                          EGLint attribute,
                                          EGLAttrib *value)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -1522,7 +1524,7 @@ EGLBoolean EGLAPIENTRY EGL_GetSyncAttrib(EGLDisplay dpy,
 
 EGLBoolean EGLAPIENTRY EGL_WaitSync(EGLDisplay dpy, EGLSync sync, EGLint flags)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
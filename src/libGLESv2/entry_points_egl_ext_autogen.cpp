@@ -26,7 +26,7 @@ void EGLAPIENTRY EGL_SetBlobCacheFuncsANDROID(EGLDisplay dpy,
                                               EGLSetBlobFuncANDROID set,
                                               EGLGetBlobFuncANDROID get)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     {
         ANGLE_SCOPED_GLOBAL_LOCK();
@@ -58,7 +58,7 @@ void EGLAPIENTRY EGL_SetBlobCacheFuncsANDROID(EGLDisplay dpy,
 // EGL_ANDROID_create_native_client_buffer
 EGLClientBuffer EGLAPIENTRY EGL_CreateNativeClientBufferANDROID(const EGLint *attrib_list)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLClientBuffer returnValue;
     {
@@ -95,7 +95,7 @@ EGLBoolean EGLAPIENTRY EGL_GetCompositorTimingSupportedANDROID(EGLDisplay dpy,
                                                                EGLSurface surface,
                                                                EGLint name)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -137,7 +137,7 @@ EGLBoolean EGLAPIENTRY EGL_GetCompositorTimingANDROID(EGLDisplay dpy,
                                                       const EGLint *names,
                                                       EGLnsecsANDROID *values)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -178,7 +178,7 @@ EGLBoolean EGLAPIENTRY EGL_GetNextFrameIdANDROID(EGLDisplay dpy,
                                                  EGLSurface surface,
                                                  EGLuint64KHR *frameId)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -216,7 +216,7 @@ EGLBoolean EGLAPIENTRY EGL_GetFrameTimestampSupportedANDROID(EGLDisplay dpy,
                                                              EGLSurface surface,
                                                              EGLint timestamp)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -259,7 +259,7 @@ EGLBoolean EGLAPIENTRY EGL_GetFrameTimestampsANDROID(EGLDisplay dpy,
                                                      const EGLint *timestamps,
                                                      EGLnsecsANDROID *values)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -300,7 +300,7 @@ EGLBoolean EGLAPIENTRY EGL_GetFrameTimestampsANDROID(EGLDisplay dpy,
 // EGL_ANDROID_get_native_client_buffer
 EGLClientBuffer EGLAPIENTRY EGL_GetNativeClientBufferANDROID(const struct AHardwareBuffer *buffer)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLClientBuffer returnValue;
     {
@@ -330,7 +330,7 @@ EGLClientBuffer EGLAPIENTRY EGL_GetNativeClientBufferANDROID(const struct AHardw
 // EGL_ANDROID_native_fence_sync
 EGLint EGLAPIENTRY EGL_DupNativeFenceFDANDROID(EGLDisplay dpy, EGLSyncKHR sync)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLint returnValue;
     {
@@ -367,7 +367,7 @@ EGLBoolean EGLAPIENTRY EGL_PresentationTimeANDROID(EGLDisplay dpy,
                                                    EGLSurface surface,
                                                    EGLnsecsANDROID time)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -405,7 +405,7 @@ EGLDeviceEXT EGLAPIENTRY EGL_CreateDeviceANGLE(EGLint device_type,
                                                void *native_device,
                                                const EGLAttrib *attrib_list)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLDeviceEXT returnValue;
     {
@@ -438,7 +438,7 @@ EGLDeviceEXT EGLAPIENTRY EGL_CreateDeviceANGLE(EGLint device_type,
 
 EGLBoolean EGLAPIENTRY EGL_ReleaseDeviceANGLE(EGLDeviceEXT device)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -469,7 +469,7 @@ EGLBoolean EGLAPIENTRY EGL_ReleaseDeviceANGLE(EGLDeviceEXT device)
 // EGL_ANGLE_external_context_and_surface
 void EGLAPIENTRY EGL_AcquireExternalContextANGLE(EGLDisplay dpy, EGLSurface drawAndRead)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     {
         ANGLE_SCOPED_GLOBAL_LOCK();
@@ -501,7 +501,7 @@ void EGLAPIENTRY EGL_AcquireExternalContextANGLE(EGLDisplay dpy, EGLSurface draw
 
 void EGLAPIENTRY EGL_ReleaseExternalContextANGLE(EGLDisplay dpy)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     {
         ANGLE_SCOPED_GLOBAL_LOCK();
@@ -531,7 +531,7 @@ void EGLAPIENTRY EGL_ReleaseExternalContextANGLE(EGLDisplay dpy)
 // EGL_ANGLE_feature_control
 const char *EGLAPIENTRY EGL_QueryStringiANGLE(EGLDisplay dpy, EGLint name, EGLint index)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     const char *returnValue;
     {
@@ -565,7 +565,7 @@ EGLBoolean EGLAPIENTRY EGL_QueryDisplayAttribANGLE(EGLDisplay dpy,
                                                    EGLint attribute,
                                                    EGLAttrib *value)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -600,7 +600,7 @@ EGLBoolean EGLAPIENTRY EGL_QueryDisplayAttribANGLE(EGLDisplay dpy,
 // EGL_ANGLE_metal_shared_event_sync
 void *EGLAPIENTRY EGL_CopyMetalSharedEventANGLE(EGLDisplay dpy, EGLSyncKHR sync)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     void *returnValue;
     {
@@ -635,7 +635,7 @@ void *EGLAPIENTRY EGL_CopyMetalSharedEventANGLE(EGLDisplay dpy, EGLSyncKHR sync)
 // EGL_ANGLE_no_error
 void EGLAPIENTRY EGL_SetValidationEnabledANGLE(EGLBoolean validationState)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     {
         ANGLE_SCOPED_GLOBAL_LOCK();
@@ -663,7 +663,7 @@ void EGLAPIENTRY EGL_SetValidationEnabledANGLE(EGLBoolean validationState)
 // EGL_ANGLE_power_preference
 void EGLAPIENTRY EGL_ReleaseHighPowerGPUANGLE(EGLDisplay dpy, EGLContext ctx)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     {
         ANGLE_SCOPED_GLOBAL_LOCK();
@@ -694,7 +694,7 @@ void EGLAPIENTRY EGL_ReleaseHighPowerGPUANGLE(EGLDisplay dpy, EGLContext ctx)
 
 void EGLAPIENTRY EGL_ReacquireHighPowerGPUANGLE(EGLDisplay dpy, EGLContext ctx)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     {
         ANGLE_SCOPED_GLOBAL_LOCK();
@@ -725,7 +725,7 @@ void EGLAPIENTRY EGL_ReacquireHighPowerGPUANGLE(EGLDisplay dpy, EGLContext ctx)
 
 void EGLAPIENTRY EGL_HandleGPUSwitchANGLE(EGLDisplay dpy)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     {
         ANGLE_SCOPED_GLOBAL_LOCK();
@@ -754,7 +754,7 @@ void EGLAPIENTRY EGL_HandleGPUSwitchANGLE(EGLDisplay dpy)
 
 void EGLAPIENTRY EGL_ForceGPUSwitchANGLE(EGLDisplay dpy, EGLint gpuIDHigh, EGLint gpuIDLow)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     {
         ANGLE_SCOPED_GLOBAL_LOCK();
@@ -785,7 +785,7 @@ void EGLAPIENTRY EGL_ForceGPUSwitchANGLE(EGLDisplay dpy, EGLint gpuIDHigh, EGLin
 // EGL_ANGLE_prepare_swap_buffers
 EGLBoolean EGLAPIENTRY EGL_PrepareSwapBuffersANGLE(EGLDisplay dpy, EGLSurface surface)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -820,7 +820,7 @@ EGLBoolean EGLAPIENTRY EGL_PrepareSwapBuffersANGLE(EGLDisplay dpy, EGLSurface su
 // EGL_ANGLE_program_cache_control
 EGLint EGLAPIENTRY EGL_ProgramCacheGetAttribANGLE(EGLDisplay dpy, EGLenum attrib)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLint returnValue;
     {
@@ -857,7 +857,7 @@ void EGLAPIENTRY EGL_ProgramCacheQueryANGLE(EGLDisplay dpy,
                                             void *binary,
                                             EGLint *binarysize)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     {
         ANGLE_SCOPED_GLOBAL_LOCK();
@@ -897,7 +897,7 @@ void EGLAPIENTRY EGL_ProgramCachePopulateANGLE(EGLDisplay dpy,
                                                const void *binary,
                                                EGLint binarysize)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     {
         ANGLE_SCOPED_GLOBAL_LOCK();
@@ -931,7 +931,7 @@ void EGLAPIENTRY EGL_ProgramCachePopulateANGLE(EGLDisplay dpy,
 
 EGLint EGLAPIENTRY EGL_ProgramCacheResizeANGLE(EGLDisplay dpy, EGLint limit, EGLint mode)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLint returnValue;
     {
@@ -968,7 +968,7 @@ EGLBoolean EGLAPIENTRY EGL_QuerySurfacePointerANGLE(EGLDisplay dpy,
                                                     EGLint attribute,
                                                     void **value)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -1008,7 +1008,7 @@ EGLBoolean EGLAPIENTRY EGL_CreateStreamProducerD3DTextureANGLE(EGLDisplay dpy,
                                                                EGLStreamKHR stream,
                                                                const EGLAttrib *attrib_list)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -1051,7 +1051,7 @@ EGLBoolean EGLAPIENTRY EGL_StreamPostD3DTextureANGLE(EGLDisplay dpy,
                                                      void *texture,
                                                      const EGLAttrib *attrib_list)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -1093,6 +1093,7 @@ EGLBoolean EGLAPIENTRY EGL_SwapBuffersWithFrameTokenANGLE(EGLDisplay dpy,
                                                           EGLSurface surface,
                                                           EGLFrameTokenANGLE frametoken)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     ANGLE_EGLBOOLEAN_TRY(EGL_PrepareSwapBuffersANGLE(dpy, surface));
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
@@ -1134,7 +1135,7 @@ EGLBoolean EGLAPIENTRY EGL_GetMscRateANGLE(EGLDisplay dpy,
                                            EGLint *numerator,
                                            EGLint *denominator)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -1174,7 +1175,7 @@ EGLBoolean EGLAPIENTRY EGL_ExportVkImageANGLE(EGLDisplay dpy,
                                               void *vk_image,
                                               void *vk_image_create_info)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -1214,7 +1215,7 @@ EGLBoolean EGLAPIENTRY EGL_ExportVkImageANGLE(EGLDisplay dpy,
 // EGL_ANGLE_wait_until_work_scheduled
 void EGLAPIENTRY EGL_WaitUntilWorkScheduledANGLE(EGLDisplay dpy)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     {
         ANGLE_SCOPED_GLOBAL_LOCK();
@@ -1248,7 +1249,7 @@ EGLBoolean EGLAPIENTRY EGL_GetSyncValuesCHROMIUM(EGLDisplay dpy,
                                                  EGLuint64KHR *msc,
                                                  EGLuint64KHR *sbc)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -1288,7 +1289,7 @@ EGLBoolean EGLAPIENTRY EGL_QueryDeviceAttribEXT(EGLDeviceEXT device,
                                                 EGLint attribute,
                                                 EGLAttrib *value)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -1322,7 +1323,7 @@ EGLBoolean EGLAPIENTRY EGL_QueryDeviceAttribEXT(EGLDeviceEXT device,
 
 const char *EGLAPIENTRY EGL_QueryDeviceStringEXT(EGLDeviceEXT device, EGLint name)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     const char *returnValue;
     {
@@ -1354,7 +1355,7 @@ const char *EGLAPIENTRY EGL_QueryDeviceStringEXT(EGLDeviceEXT device, EGLint nam
 
 EGLBoolean EGLAPIENTRY EGL_QueryDisplayAttribEXT(EGLDisplay dpy, EGLint attribute, EGLAttrib *value)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -1392,7 +1393,7 @@ EGLBoolean EGLAPIENTRY EGL_QueryDmaBufFormatsEXT(EGLDisplay dpy,
                                                  EGLint *formats,
                                                  EGLint *num_formats)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -1433,7 +1434,7 @@ EGLBoolean EGLAPIENTRY EGL_QueryDmaBufModifiersEXT(EGLDisplay dpy,
                                                    EGLBoolean *external_only,
                                                    EGLint *num_modifiers)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -1476,7 +1477,7 @@ EGLSurface EGLAPIENTRY EGL_CreatePlatformPixmapSurfaceEXT(EGLDisplay dpy,
                                                           void *native_pixmap,
                                                           const EGLint *attrib_list)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLSurface returnValue;
     {
@@ -1520,7 +1521,7 @@ EGLSurface EGLAPIENTRY EGL_CreatePlatformWindowSurfaceEXT(EGLDisplay dpy,
                                                           void *native_window,
                                                           const EGLint *attrib_list)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLSurface returnValue;
     {
@@ -1563,7 +1564,7 @@ EGLDisplay EGLAPIENTRY EGL_GetPlatformDisplayEXT(EGLenum platform,
                                                  void *native_display,
                                                  const EGLint *attrib_list)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLDisplay returnValue;
     {
@@ -1602,7 +1603,7 @@ EGLDisplay EGLAPIENTRY EGL_GetPlatformDisplayEXT(EGLenum platform,
 EGLint EGLAPIENTRY EGL_DebugMessageControlKHR(EGLDEBUGPROCKHR callback,
                                               const EGLAttrib *attrib_list)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLint returnValue;
     {
@@ -1640,7 +1641,7 @@ EGLint EGLAPIENTRY EGL_LabelObjectKHR(EGLDisplay display,
                                       EGLObjectKHR object,
                                       EGLLabelKHR label)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLint returnValue;
     {
@@ -1676,7 +1677,7 @@ EGLint EGLAPIENTRY EGL_LabelObjectKHR(EGLDisplay display,
 
 EGLBoolean EGLAPIENTRY EGL_QueryDebugKHR(EGLint attribute, EGLAttrib *value)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -1709,7 +1710,7 @@ EGLint EGLAPIENTRY EGL_ClientWaitSyncKHR(EGLDisplay dpy,
                                          EGLint flags,
                                          EGLTimeKHR timeout)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLint returnValue;
     {
@@ -1744,7 +1745,7 @@ EGLint EGLAPIENTRY EGL_ClientWaitSyncKHR(EGLDisplay dpy,
 
 EGLSyncKHR EGLAPIENTRY EGL_CreateSyncKHR(EGLDisplay dpy, EGLenum type, const EGLint *attrib_list)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLSyncKHR returnValue;
     {
@@ -1780,7 +1781,7 @@ EGLSyncKHR EGLAPIENTRY EGL_CreateSyncKHR(EGLDisplay dpy, EGLenum type, const EGL
 
 EGLBoolean EGLAPIENTRY EGL_DestroySyncKHR(EGLDisplay dpy, EGLSyncKHR sync)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -1816,7 +1817,7 @@ EGLBoolean EGLAPIENTRY EGL_GetSyncAttribKHR(EGLDisplay dpy,
                                             EGLint attribute,
                                             EGLint *value)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -1857,7 +1858,7 @@ EGLImageKHR EGLAPIENTRY EGL_CreateImageKHR(EGLDisplay dpy,
                                            EGLClientBuffer buffer,
                                            const EGLint *attrib_list)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLImageKHR returnValue;
     {
@@ -1898,7 +1899,7 @@ EGLImageKHR EGLAPIENTRY EGL_CreateImageKHR(EGLDisplay dpy,
 
 EGLBoolean EGLAPIENTRY EGL_DestroyImageKHR(EGLDisplay dpy, EGLImageKHR image)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -1934,7 +1935,7 @@ EGLBoolean EGLAPIENTRY EGL_LockSurfaceKHR(EGLDisplay dpy,
                                           EGLSurface surface,
                                           const EGLint *attrib_list)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -1975,6 +1976,7 @@ EGLBoolean EGLAPIENTRY EGL_QuerySurface64KHR(EGLDisplay dpy,
                                              EGLint attribute,
                                              EGLAttribKHR *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     if (attribute == EGL_BUFFER_AGE_EXT)
     {
         ANGLE_EGLBOOLEAN_TRY(EGL_PrepareSwapBuffersANGLE(dpy, surface));
@@ -2014,7 +2016,7 @@ EGLBoolean EGLAPIENTRY EGL_QuerySurface64KHR(EGLDisplay dpy,
 
 EGLBoolean EGLAPIENTRY EGL_UnlockSurfaceKHR(EGLDisplay dpy, EGLSurface surface)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -2051,7 +2053,7 @@ EGLBoolean EGLAPIENTRY EGL_SetDamageRegionKHR(EGLDisplay dpy,
                                               EGLint *rects,
                                               EGLint n_rects)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -2088,7 +2090,7 @@ EGLBoolean EGLAPIENTRY EGL_SetDamageRegionKHR(EGLDisplay dpy,
 // EGL_KHR_reusable_sync
 EGLBoolean EGLAPIENTRY EGL_SignalSyncKHR(EGLDisplay dpy, EGLSyncKHR sync, EGLenum mode)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -2130,7 +2132,7 @@ EGLBoolean EGLAPIENTRY EGL_SignalSyncKHR(EGLDisplay dpy, EGLSyncKHR sync, EGLenu
 // EGL_KHR_stream
 EGLStreamKHR EGLAPIENTRY EGL_CreateStreamKHR(EGLDisplay dpy, const EGLint *attrib_list)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLStreamKHR returnValue;
     {
@@ -2164,7 +2166,7 @@ EGLStreamKHR EGLAPIENTRY EGL_CreateStreamKHR(EGLDisplay dpy, const EGLint *attri
 
 EGLBoolean EGLAPIENTRY EGL_DestroyStreamKHR(EGLDisplay dpy, EGLStreamKHR stream)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -2200,7 +2202,7 @@ EGLBoolean EGLAPIENTRY EGL_QueryStreamKHR(EGLDisplay dpy,
                                           EGLenum attribute,
                                           EGLint *value)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -2239,7 +2241,7 @@ EGLBoolean EGLAPIENTRY EGL_QueryStreamu64KHR(EGLDisplay dpy,
                                              EGLenum attribute,
                                              EGLuint64KHR *value)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -2278,7 +2280,7 @@ EGLBoolean EGLAPIENTRY EGL_StreamAttribKHR(EGLDisplay dpy,
                                            EGLenum attribute,
                                            EGLint value)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -2315,7 +2317,7 @@ EGLBoolean EGLAPIENTRY EGL_StreamAttribKHR(EGLDisplay dpy,
 // EGL_KHR_stream_consumer_gltexture
 EGLBoolean EGLAPIENTRY EGL_StreamConsumerAcquireKHR(EGLDisplay dpy, EGLStreamKHR stream)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -2349,7 +2351,7 @@ EGLBoolean EGLAPIENTRY EGL_StreamConsumerAcquireKHR(EGLDisplay dpy, EGLStreamKHR
 
 EGLBoolean EGLAPIENTRY EGL_StreamConsumerGLTextureExternalKHR(EGLDisplay dpy, EGLStreamKHR stream)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -2385,7 +2387,7 @@ EGLBoolean EGLAPIENTRY EGL_StreamConsumerGLTextureExternalKHR(EGLDisplay dpy, EG
 
 EGLBoolean EGLAPIENTRY EGL_StreamConsumerReleaseKHR(EGLDisplay dpy, EGLStreamKHR stream)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -2423,6 +2425,7 @@ EGLBoolean EGLAPIENTRY EGL_SwapBuffersWithDamageKHR(EGLDisplay dpy,
                                                     const EGLint *rects,
                                                     EGLint n_rects)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     ANGLE_EGLBOOLEAN_TRY(EGL_PrepareSwapBuffersANGLE(dpy, surface));
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
@@ -2461,7 +2464,7 @@ EGLBoolean EGLAPIENTRY EGL_SwapBuffersWithDamageKHR(EGLDisplay dpy,
 // EGL_KHR_wait_sync
 EGLint EGLAPIENTRY EGL_WaitSyncKHR(EGLDisplay dpy, EGLSyncKHR sync, EGLint flags)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLint returnValue;
     {
@@ -2500,7 +2503,7 @@ EGLBoolean EGLAPIENTRY EGL_PostSubBufferNV(EGLDisplay dpy,
                                            EGLint width,
                                            EGLint height)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
@@ -2539,7 +2542,7 @@ EGLBoolean EGLAPIENTRY EGL_StreamConsumerGLTextureExternalAttribsNV(EGLDisplay d
                                                                     EGLStreamKHR stream,
                                                                     const EGLAttrib *attrib_list)
 {
-
+    ANGLE_COMMAND_STREAM_SYNC();
     Thread *thread = egl::GetCurrentThread();
     EGLBoolean returnValue;
     {
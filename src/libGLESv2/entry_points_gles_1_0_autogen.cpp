@@ -25,6 +25,7 @@ using namespace gl;
 extern "C" {
 void GL_APIENTRY GL_AlphaFunc(GLenum func, GLfloat ref)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_AlphaFunc, func, ref);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLAlphaFunc, "context = %d, func = %s, ref = %f", CID(context),
           GLenumToString(GLESEnum::AlphaFunction, func), ref);
@@ -52,6 +53,7 @@ void GL_APIENTRY GL_AlphaFunc(GLenum func, GLfloat ref)
 
 void GL_APIENTRY GL_AlphaFuncx(GLenum func, GLfixed ref)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_AlphaFuncx, func, ref);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLAlphaFuncx, "context = %d, func = %s, ref = 0x%X", CID(context),
           GLenumToString(GLESEnum::AlphaFunction, func), ref);
@@ -79,6 +81,7 @@ void GL_APIENTRY GL_AlphaFuncx(GLenum func, GLfixed ref)
 
 void GL_APIENTRY GL_ClearColorx(GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_ClearColorx, red, green, blue, alpha);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLClearColorx,
           "context = %d, red = 0x%X, green = 0x%X, blue = 0x%X, alpha = 0x%X", CID(context), red,
@@ -108,6 +111,7 @@ void GL_APIENTRY GL_ClearColorx(GLfixed red, GLfixed green, GLfixed blue, GLfixe
 
 void GL_APIENTRY GL_ClearDepthx(GLfixed depth)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_ClearDepthx, depth);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLClearDepthx, "context = %d, depth = 0x%X", CID(context), depth);
 
@@ -133,6 +137,7 @@ void GL_APIENTRY GL_ClearDepthx(GLfixed depth)
 
 void GL_APIENTRY GL_ClientActiveTexture(GLenum texture)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_ClientActiveTexture, texture);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLClientActiveTexture, "context = %d, texture = %s", CID(context),
           GLenumToString(GLESEnum::TextureUnit, texture));
@@ -158,6 +163,7 @@ void GL_APIENTRY GL_ClientActiveTexture(GLenum texture)
 
 void GL_APIENTRY GL_ClipPlanef(GLenum p, const GLfloat *eqn)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLClipPlanef, "context = %d, p = %s, eqn = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::ClipPlaneName, p), (uintptr_t)eqn);
@@ -184,6 +190,7 @@ void GL_APIENTRY GL_ClipPlanef(GLenum p, const GLfloat *eqn)
 
 void GL_APIENTRY GL_ClipPlanex(GLenum plane, const GLfixed *equation)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLClipPlanex, "context = %d, plane = %s, equation = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::ClipPlaneName, plane), (uintptr_t)equation);
@@ -210,6 +217,7 @@ void GL_APIENTRY GL_ClipPlanex(GLenum plane, const GLfixed *equation)
 
 void GL_APIENTRY GL_Color4f(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_Color4f, red, green, blue, alpha);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLColor4f, "context = %d, red = %f, green = %f, blue = %f, alpha = %f",
           CID(context), red, green, blue, alpha);
@@ -236,6 +244,7 @@ void GL_APIENTRY GL_Color4f(GLfloat red, GLfloat green, GLfloat blue, GLfloat al
 
 void GL_APIENTRY GL_Color4ub(GLubyte red, GLubyte green, GLubyte blue, GLubyte alpha)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_Color4ub, red, green, blue, alpha);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLColor4ub, "context = %d, red = %d, green = %d, blue = %d, alpha = %d",
           CID(context), red, green, blue, alpha);
@@ -263,6 +272,7 @@ void GL_APIENTRY GL_Color4ub(GLubyte red, GLubyte green, GLubyte blue, GLubyte a
 
 void GL_APIENTRY GL_Color4x(GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_Color4x, red, green, blue, alpha);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLColor4x, "context = %d, red = 0x%X, green = 0x%X, blue = 0x%X, alpha = 0x%X",
           CID(context), red, green, blue, alpha);
@@ -289,6 +299,7 @@ void GL_APIENTRY GL_Color4x(GLfixed red, GLfixed green, GLfixed blue, GLfixed al
 
 void GL_APIENTRY GL_ColorPointer(GLint size, GLenum type, GLsizei stride, const void *pointer)
 {
+    ANGLE_COMMAND_STREAM_SYNC_CLIENT_ARRAYS();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLColorPointer,
           "context = %d, size = %d, type = %s, stride = %d, pointer = 0x%016" PRIxPTR "",
@@ -317,6 +328,7 @@ void GL_APIENTRY GL_ColorPointer(GLint size, GLenum type, GLsizei stride, const
 
 void GL_APIENTRY GL_DepthRangex(GLfixed n, GLfixed f)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_DepthRangex, n, f);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDepthRangex, "context = %d, n = 0x%X, f = 0x%X", CID(context), n, f);
 
@@ -342,6 +354,7 @@ void GL_APIENTRY GL_DepthRangex(GLfixed n, GLfixed f)
 
 void GL_APIENTRY GL_DisableClientState(GLenum array)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_DisableClientState, array);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDisableClientState, "context = %d, array = %s", CID(context),
           GLenumToString(GLESEnum::EnableCap, array));
@@ -368,6 +381,7 @@ void GL_APIENTRY GL_DisableClientState(GLenum array)
 
 void GL_APIENTRY GL_EnableClientState(GLenum array)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_EnableClientState, array);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLEnableClientState, "context = %d, array = %s", CID(context),
           GLenumToString(GLESEnum::EnableCap, array));
@@ -394,6 +408,7 @@ void GL_APIENTRY GL_EnableClientState(GLenum array)
 
 void GL_APIENTRY GL_Fogf(GLenum pname, GLfloat param)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_Fogf, pname, param);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLFogf, "context = %d, pname = %s, param = %f", CID(context),
           GLenumToString(GLESEnum::FogParameter, pname), param);
@@ -420,6 +435,7 @@ void GL_APIENTRY GL_Fogf(GLenum pname, GLfloat param)
 
 void GL_APIENTRY GL_Fogfv(GLenum pname, const GLfloat *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLFogfv, "context = %d, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::FogParameter, pname), (uintptr_t)params);
@@ -446,6 +462,7 @@ void GL_APIENTRY GL_Fogfv(GLenum pname, const GLfloat *params)
 
 void GL_APIENTRY GL_Fogx(GLenum pname, GLfixed param)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_Fogx, pname, param);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLFogx, "context = %d, pname = %s, param = 0x%X", CID(context),
           GLenumToString(GLESEnum::FogPName, pname), param);
@@ -472,6 +489,7 @@ void GL_APIENTRY GL_Fogx(GLenum pname, GLfixed param)
 
 void GL_APIENTRY GL_Fogxv(GLenum pname, const GLfixed *param)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLFogxv, "context = %d, pname = %s, param = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::FogPName, pname), (uintptr_t)param);
@@ -498,6 +516,7 @@ void GL_APIENTRY GL_Fogxv(GLenum pname, const GLfixed *param)
 
 void GL_APIENTRY GL_Frustumf(GLfloat l, GLfloat r, GLfloat b, GLfloat t, GLfloat n, GLfloat f)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_Frustumf, l, r, b, t, n, f);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLFrustumf, "context = %d, l = %f, r = %f, b = %f, t = %f, n = %f, f = %f",
           CID(context), l, r, b, t, n, f);
@@ -524,6 +543,7 @@ void GL_APIENTRY GL_Frustumf(GLfloat l, GLfloat r, GLfloat b, GLfloat t, GLfloat
 
 void GL_APIENTRY GL_Frustumx(GLfixed l, GLfixed r, GLfixed b, GLfixed t, GLfixed n, GLfixed f)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_Frustumx, l, r, b, t, n, f);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLFrustumx,
           "context = %d, l = 0x%X, r = 0x%X, b = 0x%X, t = 0x%X, n = 0x%X, f = 0x%X", CID(context),
@@ -551,6 +571,7 @@ void GL_APIENTRY GL_Frustumx(GLfixed l, GLfixed r, GLfixed b, GLfixed t, GLfixed
 
 void GL_APIENTRY GL_GetClipPlanef(GLenum plane, GLfloat *equation)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetClipPlanef, "context = %d, plane = %s, equation = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::ClipPlaneName, plane), (uintptr_t)equation);
@@ -578,6 +599,7 @@ void GL_APIENTRY GL_GetClipPlanef(GLenum plane, GLfloat *equation)
 
 void GL_APIENTRY GL_GetClipPlanex(GLenum plane, GLfixed *equation)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetClipPlanex, "context = %d, plane = %s, equation = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::ClipPlaneName, plane), (uintptr_t)equation);
@@ -605,6 +627,7 @@ void GL_APIENTRY GL_GetClipPlanex(GLenum plane, GLfixed *equation)
 
 void GL_APIENTRY GL_GetFixedv(GLenum pname, GLfixed *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetFixedv, "context = %d, pname = %s, params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::GetPName, pname), (uintptr_t)params);
@@ -630,6 +653,7 @@ void GL_APIENTRY GL_GetFixedv(GLenum pname, GLfixed *params)
 
 void GL_APIENTRY GL_GetLightfv(GLenum light, GLenum pname, GLfloat *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetLightfv, "context = %d, light = %s, pname = %s, params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::LightName, light),
@@ -660,6 +684,7 @@ void GL_APIENTRY GL_GetLightfv(GLenum light, GLenum pname, GLfloat *params)
 
 void GL_APIENTRY GL_GetLightxv(GLenum light, GLenum pname, GLfixed *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetLightxv, "context = %d, light = %s, pname = %s, params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::LightName, light),
@@ -690,6 +715,7 @@ void GL_APIENTRY GL_GetLightxv(GLenum light, GLenum pname, GLfixed *params)
 
 void GL_APIENTRY GL_GetMaterialfv(GLenum face, GLenum pname, GLfloat *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetMaterialfv,
           "context = %d, face = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
@@ -721,6 +747,7 @@ void GL_APIENTRY GL_GetMaterialfv(GLenum face, GLenum pname, GLfloat *params)
 
 void GL_APIENTRY GL_GetMaterialxv(GLenum face, GLenum pname, GLfixed *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetMaterialxv,
           "context = %d, face = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
@@ -752,6 +779,7 @@ void GL_APIENTRY GL_GetMaterialxv(GLenum face, GLenum pname, GLfixed *params)
 
 void GL_APIENTRY GL_GetTexEnvfv(GLenum target, GLenum pname, GLfloat *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetTexEnvfv,
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
@@ -784,6 +812,7 @@ void GL_APIENTRY GL_GetTexEnvfv(GLenum target, GLenum pname, GLfloat *params)
 
 void GL_APIENTRY GL_GetTexEnviv(GLenum target, GLenum pname, GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetTexEnviv,
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
@@ -816,6 +845,7 @@ void GL_APIENTRY GL_GetTexEnviv(GLenum target, GLenum pname, GLint *params)
 
 void GL_APIENTRY GL_GetTexEnvxv(GLenum target, GLenum pname, GLfixed *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetTexEnvxv,
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
@@ -848,6 +878,7 @@ void GL_APIENTRY GL_GetTexEnvxv(GLenum target, GLenum pname, GLfixed *params)
 
 void GL_APIENTRY GL_GetTexParameterxv(GLenum target, GLenum pname, GLfixed *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetTexParameterxv,
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
@@ -877,6 +908,7 @@ void GL_APIENTRY GL_GetTexParameterxv(GLenum target, GLenum pname, GLfixed *para
 
 void GL_APIENTRY GL_LightModelf(GLenum pname, GLfloat param)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_LightModelf, pname, param);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLLightModelf, "context = %d, pname = %s, param = %f", CID(context),
           GLenumToString(GLESEnum::LightModelParameter, pname), param);
@@ -903,6 +935,7 @@ void GL_APIENTRY GL_LightModelf(GLenum pname, GLfloat param)
 
 void GL_APIENTRY GL_LightModelfv(GLenum pname, const GLfloat *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLLightModelfv, "context = %d, pname = %s, params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::LightModelParameter, pname), (uintptr_t)params);
@@ -929,6 +962,7 @@ void GL_APIENTRY GL_LightModelfv(GLenum pname, const GLfloat *params)
 
 void GL_APIENTRY GL_LightModelx(GLenum pname, GLfixed param)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_LightModelx, pname, param);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLLightModelx, "context = %d, pname = %s, param = 0x%X", CID(context),
           GLenumToString(GLESEnum::LightModelParameter, pname), param);
@@ -955,6 +989,7 @@ void GL_APIENTRY GL_LightModelx(GLenum pname, GLfixed param)
 
 void GL_APIENTRY GL_LightModelxv(GLenum pname, const GLfixed *param)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLLightModelxv, "context = %d, pname = %s, param = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::LightModelParameter, pname), (uintptr_t)param);
@@ -981,6 +1016,7 @@ void GL_APIENTRY GL_LightModelxv(GLenum pname, const GLfixed *param)
 
 void GL_APIENTRY GL_Lightf(GLenum light, GLenum pname, GLfloat param)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_Lightf, light, pname, param);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLLightf, "context = %d, light = %s, pname = %s, param = %f", CID(context),
           GLenumToString(GLESEnum::LightName, light),
@@ -1009,6 +1045,7 @@ void GL_APIENTRY GL_Lightf(GLenum light, GLenum pname, GLfloat param)
 
 void GL_APIENTRY GL_Lightfv(GLenum light, GLenum pname, const GLfloat *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLLightfv, "context = %d, light = %s, pname = %s, params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::LightName, light),
@@ -1038,6 +1075,7 @@ void GL_APIENTRY GL_Lightfv(GLenum light, GLenum pname, const GLfloat *params)
 
 void GL_APIENTRY GL_Lightx(GLenum light, GLenum pname, GLfixed param)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_Lightx, light, pname, param);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLLightx, "context = %d, light = %s, pname = %s, param = 0x%X", CID(context),
           GLenumToString(GLESEnum::LightName, light),
@@ -1066,6 +1104,7 @@ void GL_APIENTRY GL_Lightx(GLenum light, GLenum pname, GLfixed param)
 
 void GL_APIENTRY GL_Lightxv(GLenum light, GLenum pname, const GLfixed *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLLightxv, "context = %d, light = %s, pname = %s, params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::LightName, light),
@@ -1095,6 +1134,7 @@ void GL_APIENTRY GL_Lightxv(GLenum light, GLenum pname, const GLfixed *params)
 
 void GL_APIENTRY GL_LineWidthx(GLfixed width)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_LineWidthx, width);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLLineWidthx, "context = %d, width = 0x%X", CID(context), width);
 
@@ -1120,6 +1160,7 @@ void GL_APIENTRY GL_LineWidthx(GLfixed width)
 
 void GL_APIENTRY GL_LoadIdentity()
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_LoadIdentity);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLLoadIdentity, "context = %d", CID(context));
 
@@ -1145,6 +1186,7 @@ void GL_APIENTRY GL_LoadIdentity()
 
 void GL_APIENTRY GL_LoadMatrixf(const GLfloat *m)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLLoadMatrixf, "context = %d, m = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)m);
@@ -1171,6 +1213,7 @@ void GL_APIENTRY GL_LoadMatrixf(const GLfloat *m)
 
 void GL_APIENTRY GL_LoadMatrixx(const GLfixed *m)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLLoadMatrixx, "context = %d, m = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)m);
@@ -1197,6 +1240,7 @@ void GL_APIENTRY GL_LoadMatrixx(const GLfixed *m)
 
 void GL_APIENTRY GL_LogicOp(GLenum opcode)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_LogicOp, opcode);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLLogicOp, "context = %d, opcode = %s", CID(context),
           GLenumToString(GLESEnum::LogicOp, opcode));
@@ -1224,6 +1268,7 @@ void GL_APIENTRY GL_LogicOp(GLenum opcode)
 
 void GL_APIENTRY GL_Materialf(GLenum face, GLenum pname, GLfloat param)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_Materialf, face, pname, param);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLMaterialf, "context = %d, face = %s, pname = %s, param = %f", CID(context),
           GLenumToString(GLESEnum::TriangleFace, face),
@@ -1254,6 +1299,7 @@ void GL_APIENTRY GL_Materialf(GLenum face, GLenum pname, GLfloat param)
 
 void GL_APIENTRY GL_Materialfv(GLenum face, GLenum pname, const GLfloat *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLMaterialfv, "context = %d, face = %s, pname = %s, params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::TriangleFace, face),
@@ -1284,6 +1330,7 @@ void GL_APIENTRY GL_Materialfv(GLenum face, GLenum pname, const GLfloat *params)
 
 void GL_APIENTRY GL_Materialx(GLenum face, GLenum pname, GLfixed param)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_Materialx, face, pname, param);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLMaterialx, "context = %d, face = %s, pname = %s, param = 0x%X", CID(context),
           GLenumToString(GLESEnum::TriangleFace, face),
@@ -1314,6 +1361,7 @@ void GL_APIENTRY GL_Materialx(GLenum face, GLenum pname, GLfixed param)
 
 void GL_APIENTRY GL_Materialxv(GLenum face, GLenum pname, const GLfixed *param)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLMaterialxv, "context = %d, face = %s, pname = %s, param = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::TriangleFace, face),
@@ -1344,6 +1392,7 @@ void GL_APIENTRY GL_Materialxv(GLenum face, GLenum pname, const GLfixed *param)
 
 void GL_APIENTRY GL_MatrixMode(GLenum mode)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_MatrixMode, mode);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLMatrixMode, "context = %d, mode = %s", CID(context),
           GLenumToString(GLESEnum::MatrixMode, mode));
@@ -1371,6 +1420,7 @@ void GL_APIENTRY GL_MatrixMode(GLenum mode)
 
 void GL_APIENTRY GL_MultMatrixf(const GLfloat *m)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLMultMatrixf, "context = %d, m = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)m);
@@ -1397,6 +1447,7 @@ void GL_APIENTRY GL_MultMatrixf(const GLfloat *m)
 
 void GL_APIENTRY GL_MultMatrixx(const GLfixed *m)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLMultMatrixx, "context = %d, m = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)m);
@@ -1423,6 +1474,7 @@ void GL_APIENTRY GL_MultMatrixx(const GLfixed *m)
 
 void GL_APIENTRY GL_MultiTexCoord4f(GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_MultiTexCoord4f, target, s, t, r, q);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLMultiTexCoord4f, "context = %d, target = %s, s = %f, t = %f, r = %f, q = %f",
           CID(context), GLenumToString(GLESEnum::TextureUnit, target), s, t, r, q);
@@ -1451,6 +1503,7 @@ void GL_APIENTRY GL_MultiTexCoord4f(GLenum target, GLfloat s, GLfloat t, GLfloat
 
 void GL_APIENTRY GL_MultiTexCoord4x(GLenum texture, GLfixed s, GLfixed t, GLfixed r, GLfixed q)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_MultiTexCoord4x, texture, s, t, r, q);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLMultiTexCoord4x,
           "context = %d, texture = %s, s = 0x%X, t = 0x%X, r = 0x%X, q = 0x%X", CID(context),
@@ -1480,6 +1533,7 @@ void GL_APIENTRY GL_MultiTexCoord4x(GLenum texture, GLfixed s, GLfixed t, GLfixe
 
 void GL_APIENTRY GL_Normal3f(GLfloat nx, GLfloat ny, GLfloat nz)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_Normal3f, nx, ny, nz);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLNormal3f, "context = %d, nx = %f, ny = %f, nz = %f", CID(context), nx, ny, nz);
 
@@ -1505,6 +1559,7 @@ void GL_APIENTRY GL_Normal3f(GLfloat nx, GLfloat ny, GLfloat nz)
 
 void GL_APIENTRY GL_Normal3x(GLfixed nx, GLfixed ny, GLfixed nz)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_Normal3x, nx, ny, nz);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLNormal3x, "context = %d, nx = 0x%X, ny = 0x%X, nz = 0x%X", CID(context), nx,
           ny, nz);
@@ -1531,6 +1586,7 @@ void GL_APIENTRY GL_Normal3x(GLfixed nx, GLfixed ny, GLfixed nz)
 
 void GL_APIENTRY GL_NormalPointer(GLenum type, GLsizei stride, const void *pointer)
 {
+    ANGLE_COMMAND_STREAM_SYNC_CLIENT_ARRAYS();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLNormalPointer,
           "context = %d, type = %s, stride = %d, pointer = 0x%016" PRIxPTR "", CID(context),
@@ -1558,6 +1614,7 @@ void GL_APIENTRY GL_NormalPointer(GLenum type, GLsizei stride, const void *point
 
 void GL_APIENTRY GL_Orthof(GLfloat l, GLfloat r, GLfloat b, GLfloat t, GLfloat n, GLfloat f)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_Orthof, l, r, b, t, n, f);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLOrthof, "context = %d, l = %f, r = %f, b = %f, t = %f, n = %f, f = %f",
           CID(context), l, r, b, t, n, f);
@@ -1584,6 +1641,7 @@ void GL_APIENTRY GL_Orthof(GLfloat l, GLfloat r, GLfloat b, GLfloat t, GLfloat n
 
 void GL_APIENTRY GL_Orthox(GLfixed l, GLfixed r, GLfixed b, GLfixed t, GLfixed n, GLfixed f)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_Orthox, l, r, b, t, n, f);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLOrthox,
           "context = %d, l = 0x%X, r = 0x%X, b = 0x%X, t = 0x%X, n = 0x%X, f = 0x%X", CID(context),
@@ -1611,6 +1669,7 @@ void GL_APIENTRY GL_Orthox(GLfixed l, GLfixed r, GLfixed b, GLfixed t, GLfixed n
 
 void GL_APIENTRY GL_PointParameterf(GLenum pname, GLfloat param)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_PointParameterf, pname, param);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPointParameterf, "context = %d, pname = %s, param = %f", CID(context),
           GLenumToString(GLESEnum::AllEnums, pname), param);
@@ -1640,6 +1699,7 @@ void GL_APIENTRY GL_PointParameterf(GLenum pname, GLfloat param)
 
 void GL_APIENTRY GL_PointParameterfv(GLenum pname, const GLfloat *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPointParameterfv, "context = %d, pname = %s, params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::AllEnums, pname), (uintptr_t)params);
@@ -1669,6 +1729,7 @@ void GL_APIENTRY GL_PointParameterfv(GLenum pname, const GLfloat *params)
 
 void GL_APIENTRY GL_PointParameterx(GLenum pname, GLfixed param)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_PointParameterx, pname, param);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPointParameterx, "context = %d, pname = %s, param = 0x%X", CID(context),
           GLenumToString(GLESEnum::AllEnums, pname), param);
@@ -1698,6 +1759,7 @@ void GL_APIENTRY GL_PointParameterx(GLenum pname, GLfixed param)
 
 void GL_APIENTRY GL_PointParameterxv(GLenum pname, const GLfixed *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPointParameterxv, "context = %d, pname = %s, params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::AllEnums, pname), (uintptr_t)params);
@@ -1727,6 +1789,7 @@ void GL_APIENTRY GL_PointParameterxv(GLenum pname, const GLfixed *params)
 
 void GL_APIENTRY GL_PointSize(GLfloat size)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_PointSize, size);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPointSize, "context = %d, size = %f", CID(context), size);
 
@@ -1752,6 +1815,7 @@ void GL_APIENTRY GL_PointSize(GLfloat size)
 
 void GL_APIENTRY GL_PointSizex(GLfixed size)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_PointSizex, size);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPointSizex, "context = %d, size = 0x%X", CID(context), size);
 
@@ -1777,6 +1841,7 @@ void GL_APIENTRY GL_PointSizex(GLfixed size)
 
 void GL_APIENTRY GL_PolygonOffsetx(GLfixed factor, GLfixed units)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_PolygonOffsetx, factor, units);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPolygonOffsetx, "context = %d, factor = 0x%X, units = 0x%X", CID(context),
           factor, units);
@@ -1804,6 +1869,7 @@ void GL_APIENTRY GL_PolygonOffsetx(GLfixed factor, GLfixed units)
 
 void GL_APIENTRY GL_PopMatrix()
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_PopMatrix);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPopMatrix, "context = %d", CID(context));
 
@@ -1829,6 +1895,7 @@ void GL_APIENTRY GL_PopMatrix()
 
 void GL_APIENTRY GL_PushMatrix()
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_PushMatrix);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPushMatrix, "context = %d", CID(context));
 
@@ -1854,6 +1921,7 @@ void GL_APIENTRY GL_PushMatrix()
 
 void GL_APIENTRY GL_Rotatef(GLfloat angle, GLfloat x, GLfloat y, GLfloat z)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_Rotatef, angle, x, y, z);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLRotatef, "context = %d, angle = %f, x = %f, y = %f, z = %f", CID(context),
           angle, x, y, z);
@@ -1880,6 +1948,7 @@ void GL_APIENTRY GL_Rotatef(GLfloat angle, GLfloat x, GLfloat y, GLfloat z)
 
 void GL_APIENTRY GL_Rotatex(GLfixed angle, GLfixed x, GLfixed y, GLfixed z)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_Rotatex, angle, x, y, z);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLRotatex, "context = %d, angle = 0x%X, x = 0x%X, y = 0x%X, z = 0x%X",
           CID(context), angle, x, y, z);
@@ -1906,6 +1975,7 @@ void GL_APIENTRY GL_Rotatex(GLfixed angle, GLfixed x, GLfixed y, GLfixed z)
 
 void GL_APIENTRY GL_SampleCoveragex(GLclampx value, GLboolean invert)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_SampleCoveragex, value, invert);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLSampleCoveragex, "context = %d, value = 0x%X, invert = %s", CID(context),
           value, GLbooleanToString(invert));
@@ -1933,6 +2003,7 @@ void GL_APIENTRY GL_SampleCoveragex(GLclampx value, GLboolean invert)
 
 void GL_APIENTRY GL_Scalef(GLfloat x, GLfloat y, GLfloat z)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_Scalef, x, y, z);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLScalef, "context = %d, x = %f, y = %f, z = %f", CID(context), x, y, z);
 
@@ -1958,6 +2029,7 @@ void GL_APIENTRY GL_Scalef(GLfloat x, GLfloat y, GLfloat z)
 
 void GL_APIENTRY GL_Scalex(GLfixed x, GLfixed y, GLfixed z)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_Scalex, x, y, z);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLScalex, "context = %d, x = 0x%X, y = 0x%X, z = 0x%X", CID(context), x, y, z);
 
@@ -1983,6 +2055,7 @@ void GL_APIENTRY GL_Scalex(GLfixed x, GLfixed y, GLfixed z)
 
 void GL_APIENTRY GL_ShadeModel(GLenum mode)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_ShadeModel, mode);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLShadeModel, "context = %d, mode = %s", CID(context),
           GLenumToString(GLESEnum::ShadingModel, mode));
@@ -2010,6 +2083,7 @@ void GL_APIENTRY GL_ShadeModel(GLenum mode)
 
 void GL_APIENTRY GL_TexCoordPointer(GLint size, GLenum type, GLsizei stride, const void *pointer)
 {
+    ANGLE_COMMAND_STREAM_SYNC_CLIENT_ARRAYS();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexCoordPointer,
           "context = %d, size = %d, type = %s, stride = %d, pointer = 0x%016" PRIxPTR "",
@@ -2038,6 +2112,7 @@ void GL_APIENTRY GL_TexCoordPointer(GLint size, GLenum type, GLsizei stride, con
 
 void GL_APIENTRY GL_TexEnvf(GLenum target, GLenum pname, GLfloat param)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_TexEnvf, target, pname, param);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexEnvf, "context = %d, target = %s, pname = %s, param = %f", CID(context),
           GLenumToString(GLESEnum::TextureEnvTarget, target),
@@ -2068,6 +2143,7 @@ void GL_APIENTRY GL_TexEnvf(GLenum target, GLenum pname, GLfloat param)
 
 void GL_APIENTRY GL_TexEnvfv(GLenum target, GLenum pname, const GLfloat *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexEnvfv, "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::TextureEnvTarget, target),
@@ -2099,6 +2175,7 @@ void GL_APIENTRY GL_TexEnvfv(GLenum target, GLenum pname, const GLfloat *params)
 
 void GL_APIENTRY GL_TexEnvi(GLenum target, GLenum pname, GLint param)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_TexEnvi, target, pname, param);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexEnvi, "context = %d, target = %s, pname = %s, param = %d", CID(context),
           GLenumToString(GLESEnum::TextureEnvTarget, target),
@@ -2129,6 +2206,7 @@ void GL_APIENTRY GL_TexEnvi(GLenum target, GLenum pname, GLint param)
 
 void GL_APIENTRY GL_TexEnviv(GLenum target, GLenum pname, const GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexEnviv, "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::TextureEnvTarget, target),
@@ -2160,6 +2238,7 @@ void GL_APIENTRY GL_TexEnviv(GLenum target, GLenum pname, const GLint *params)
 
 void GL_APIENTRY GL_TexEnvx(GLenum target, GLenum pname, GLfixed param)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_TexEnvx, target, pname, param);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexEnvx, "context = %d, target = %s, pname = %s, param = 0x%X", CID(context),
           GLenumToString(GLESEnum::TextureEnvTarget, target),
@@ -2190,6 +2269,7 @@ void GL_APIENTRY GL_TexEnvx(GLenum target, GLenum pname, GLfixed param)
 
 void GL_APIENTRY GL_TexEnvxv(GLenum target, GLenum pname, const GLfixed *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexEnvxv, "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::TextureEnvTarget, target),
@@ -2221,6 +2301,7 @@ void GL_APIENTRY GL_TexEnvxv(GLenum target, GLenum pname, const GLfixed *params)
 
 void GL_APIENTRY GL_TexParameterx(GLenum target, GLenum pname, GLfixed param)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_TexParameterx, target, pname, param);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexParameterx, "context = %d, target = %s, pname = %s, param = 0x%X",
           CID(context), GLenumToString(GLESEnum::TextureTarget, target),
@@ -2248,6 +2329,7 @@ void GL_APIENTRY GL_TexParameterx(GLenum target, GLenum pname, GLfixed param)
 
 void GL_APIENTRY GL_TexParameterxv(GLenum target, GLenum pname, const GLfixed *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexParameterxv,
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
@@ -2276,6 +2358,7 @@ void GL_APIENTRY GL_TexParameterxv(GLenum target, GLenum pname, const GLfixed *p
 
 void GL_APIENTRY GL_Translatef(GLfloat x, GLfloat y, GLfloat z)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_Translatef, x, y, z);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTranslatef, "context = %d, x = %f, y = %f, z = %f", CID(context), x, y, z);
 
@@ -2301,6 +2384,7 @@ void GL_APIENTRY GL_Translatef(GLfloat x, GLfloat y, GLfloat z)
 
 void GL_APIENTRY GL_Translatex(GLfixed x, GLfixed y, GLfixed z)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_Translatex, x, y, z);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTranslatex, "context = %d, x = 0x%X, y = 0x%X, z = 0x%X", CID(context), x, y,
           z);
@@ -2327,6 +2411,7 @@ void GL_APIENTRY GL_Translatex(GLfixed x, GLfixed y, GLfixed z)
 
 void GL_APIENTRY GL_VertexPointer(GLint size, GLenum type, GLsizei stride, const void *pointer)
 {
+    ANGLE_COMMAND_STREAM_SYNC_CLIENT_ARRAYS();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertexPointer,
           "context = %d, size = %d, type = %s, stride = %d, pointer = 0x%016" PRIxPTR "",
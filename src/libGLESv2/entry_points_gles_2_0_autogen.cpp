@@ -25,6 +25,7 @@ using namespace gl;
 extern "C" {
 void GL_APIENTRY GL_ActiveTexture(GLenum texture)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_ActiveTexture, texture);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLActiveTexture, "context = %d, texture = %s", CID(context),
           GLenumToString(GLESEnum::TextureUnit, texture));
@@ -51,6 +52,7 @@ void GL_APIENTRY GL_ActiveTexture(GLenum texture)
 
 void GL_APIENTRY GL_AttachShader(GLuint program, GLuint shader)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_AttachShader, program, shader);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLAttachShader, "context = %d, program = %u, shader = %u", CID(context), program,
           shader);
@@ -82,6 +84,7 @@ void GL_APIENTRY GL_AttachShader(GLuint program, GLuint shader)
 
 void GL_APIENTRY GL_BindAttribLocation(GLuint program, GLuint index, const GLchar *name)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBindAttribLocation,
           "context = %d, program = %u, index = %u, name = 0x%016" PRIxPTR "", CID(context), program,
@@ -113,6 +116,7 @@ void GL_APIENTRY GL_BindAttribLocation(GLuint program, GLuint index, const GLcha
 
 void GL_APIENTRY GL_BindBuffer(GLenum target, GLuint buffer)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_BindBuffer, target, buffer);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBindBuffer, "context = %d, target = %s, buffer = %u", CID(context),
           GLenumToString(GLESEnum::BufferTargetARB, target), buffer);
@@ -140,6 +144,7 @@ void GL_APIENTRY GL_BindBuffer(GLenum target, GLuint buffer)
 
 void GL_APIENTRY GL_BindFramebuffer(GLenum target, GLuint framebuffer)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_BindFramebuffer, target, framebuffer);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBindFramebuffer, "context = %d, target = %s, framebuffer = %u", CID(context),
           GLenumToString(GLESEnum::FramebufferTarget, target), framebuffer);
@@ -170,6 +175,7 @@ void GL_APIENTRY GL_BindFramebuffer(GLenum target, GLuint framebuffer)
 
 void GL_APIENTRY GL_BindRenderbuffer(GLenum target, GLuint renderbuffer)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_BindRenderbuffer, target, renderbuffer);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBindRenderbuffer, "context = %d, target = %s, renderbuffer = %u", CID(context),
           GLenumToString(GLESEnum::RenderbufferTarget, target), renderbuffer);
@@ -200,6 +206,7 @@ void GL_APIENTRY GL_BindRenderbuffer(GLenum target, GLuint renderbuffer)
 
 void GL_APIENTRY GL_BindTexture(GLenum target, GLuint texture)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_BindTexture, target, texture);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBindTexture, "context = %d, target = %s, texture = %u", CID(context),
           GLenumToString(GLESEnum::TextureTarget, target), texture);
@@ -227,6 +234,7 @@ void GL_APIENTRY GL_BindTexture(GLenum target, GLuint texture)
 
 void GL_APIENTRY GL_BlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_BlendColor, red, green, blue, alpha);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBlendColor, "context = %d, red = %f, green = %f, blue = %f, alpha = %f",
           CID(context), red, green, blue, alpha);
@@ -258,6 +266,7 @@ void GL_APIENTRY GL_BlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat
 
 void GL_APIENTRY GL_BlendEquation(GLenum mode)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_BlendEquation, mode);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBlendEquation, "context = %d, mode = %s", CID(context),
           GLenumToString(GLESEnum::BlendEquationModeEXT, mode));
@@ -288,6 +297,7 @@ void GL_APIENTRY GL_BlendEquation(GLenum mode)
 
 void GL_APIENTRY GL_BlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_BlendEquationSeparate, modeRGB, modeAlpha);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBlendEquationSeparate, "context = %d, modeRGB = %s, modeAlpha = %s",
           CID(context), GLenumToString(GLESEnum::BlendEquationModeEXT, modeRGB),
@@ -320,6 +330,7 @@ void GL_APIENTRY GL_BlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha)
 
 void GL_APIENTRY GL_BlendFunc(GLenum sfactor, GLenum dfactor)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_BlendFunc, sfactor, dfactor);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBlendFunc, "context = %d, sfactor = %s, dfactor = %s", CID(context),
           GLenumToString(GLESEnum::BlendingFactor, sfactor),
@@ -354,6 +365,8 @@ void GL_APIENTRY GL_BlendFuncSeparate(GLenum sfactorRGB,
                                       GLenum sfactorAlpha,
                                       GLenum dfactorAlpha)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_BlendFuncSeparate, sfactorRGB, dfactorRGB, sfactorAlpha,
+                                 dfactorAlpha);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBlendFuncSeparate,
           "context = %d, sfactorRGB = %s, dfactorRGB = %s, sfactorAlpha = %s, dfactorAlpha = %s",
@@ -391,6 +404,7 @@ void GL_APIENTRY GL_BlendFuncSeparate(GLenum sfactorRGB,
 
 void GL_APIENTRY GL_BufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBufferData,
           "context = %d, target = %s, size = %llu, data = 0x%016" PRIxPTR ", usage = %s",
@@ -421,6 +435,7 @@ void GL_APIENTRY GL_BufferData(GLenum target, GLsizeiptr size, const void *data,
 
 void GL_APIENTRY GL_BufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBufferSubData,
           "context = %d, target = %s, offset = %llu, size = %llu, data = 0x%016" PRIxPTR "",
@@ -450,6 +465,7 @@ void GL_APIENTRY GL_BufferSubData(GLenum target, GLintptr offset, GLsizeiptr siz
 
 GLenum GL_APIENTRY GL_CheckFramebufferStatus(GLenum target)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLCheckFramebufferStatus, "context = %d, target = %s", CID(context),
           GLenumToString(GLESEnum::FramebufferTarget, target));
@@ -483,6 +499,7 @@ GLenum GL_APIENTRY GL_CheckFramebufferStatus(GLenum target)
 
 void GL_APIENTRY GL_Clear(GLbitfield mask)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_Clear, mask);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLClear, "context = %d, mask = %s", CID(context),
           GLbitfieldToString(GLESEnum::ClearBufferMask, mask).c_str());
@@ -511,6 +528,7 @@ void GL_APIENTRY GL_Clear(GLbitfield mask)
 
 void GL_APIENTRY GL_ClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_ClearColor, red, green, blue, alpha);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLClearColor, "context = %d, red = %f, green = %f, blue = %f, alpha = %f",
           CID(context), red, green, blue, alpha);
@@ -542,6 +560,7 @@ void GL_APIENTRY GL_ClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat
 
 void GL_APIENTRY GL_ClearDepthf(GLfloat d)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_ClearDepthf, d);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLClearDepthf, "context = %d, d = %f", CID(context), d);
 
@@ -571,6 +590,7 @@ void GL_APIENTRY GL_ClearDepthf(GLfloat d)
 
 void GL_APIENTRY GL_ClearStencil(GLint s)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_ClearStencil, s);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLClearStencil, "context = %d, s = %d", CID(context), s);
 
@@ -600,6 +620,7 @@ void GL_APIENTRY GL_ClearStencil(GLint s)
 
 void GL_APIENTRY GL_ColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_ColorMask, red, green, blue, alpha);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLColorMask, "context = %d, red = %s, green = %s, blue = %s, alpha = %s",
           CID(context), GLbooleanToString(red), GLbooleanToString(green), GLbooleanToString(blue),
@@ -632,6 +653,7 @@ void GL_APIENTRY GL_ColorMask(GLboolean red, GLboolean green, GLboolean blue, GL
 
 void GL_APIENTRY GL_CompileShader(GLuint shader)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_CompileShader, shader);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLCompileShader, "context = %d, shader = %u", CID(context), shader);
 
@@ -667,6 +689,7 @@ void GL_APIENTRY GL_CompressedTexImage2D(GLenum target,
                                          GLsizei imageSize,
                                          const void *data)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLCompressedTexImage2D,
           "context = %d, target = %s, level = %d, internalformat = %s, width = %d, height = %d, "
@@ -712,6 +735,7 @@ void GL_APIENTRY GL_CompressedTexSubImage2D(GLenum target,
                                             GLsizei imageSize,
                                             const void *data)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLCompressedTexSubImage2D,
           "context = %d, target = %s, level = %d, xoffset = %d, yoffset = %d, width = %d, height = "
@@ -756,6 +780,8 @@ void GL_APIENTRY GL_CopyTexImage2D(GLenum target,
                                    GLsizei height,
                                    GLint border)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_CopyTexImage2D, target, level, internalformat, x, y, width,
+                                 height, border);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLCopyTexImage2D,
           "context = %d, target = %s, level = %d, internalformat = %s, x = %d, y = %d, width = %d, "
@@ -798,6 +824,8 @@ void GL_APIENTRY GL_CopyTexSubImage2D(GLenum target,
                                       GLsizei width,
                                       GLsizei height)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_CopyTexSubImage2D, target, level, xoffset, yoffset, x, y, width,
+                                 height);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLCopyTexSubImage2D,
           "context = %d, target = %s, level = %d, xoffset = %d, yoffset = %d, x = %d, y = %d, "
@@ -833,6 +861,7 @@ void GL_APIENTRY GL_CopyTexSubImage2D(GLenum target,
 
 GLuint GL_APIENTRY GL_CreateProgram()
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLCreateProgram, "context = %d", CID(context));
 
@@ -867,6 +896,7 @@ GLuint GL_APIENTRY GL_CreateProgram()
 
 GLuint GL_APIENTRY GL_CreateShader(GLenum type)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLCreateShader, "context = %d, type = %s", CID(context),
           GLenumToString(GLESEnum::ShaderType, type));
@@ -903,6 +933,7 @@ GLuint GL_APIENTRY GL_CreateShader(GLenum type)
 
 void GL_APIENTRY GL_CullFace(GLenum mode)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_CullFace, mode);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLCullFace, "context = %d, mode = %s", CID(context),
           GLenumToString(GLESEnum::TriangleFace, mode));
@@ -930,6 +961,7 @@ void GL_APIENTRY GL_CullFace(GLenum mode)
 
 void GL_APIENTRY GL_DeleteBuffers(GLsizei n, const GLuint *buffers)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDeleteBuffers, "context = %d, n = %d, buffers = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)buffers);
@@ -956,6 +988,7 @@ void GL_APIENTRY GL_DeleteBuffers(GLsizei n, const GLuint *buffers)
 
 void GL_APIENTRY GL_DeleteFramebuffers(GLsizei n, const GLuint *framebuffers)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDeleteFramebuffers, "context = %d, n = %d, framebuffers = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)framebuffers);
@@ -983,6 +1016,7 @@ void GL_APIENTRY GL_DeleteFramebuffers(GLsizei n, const GLuint *framebuffers)
 
 void GL_APIENTRY GL_DeleteProgram(GLuint program)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_DeleteProgram, program);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDeleteProgram, "context = %d, program = %u", CID(context), program);
 
@@ -1008,6 +1042,7 @@ void GL_APIENTRY GL_DeleteProgram(GLuint program)
 
 void GL_APIENTRY GL_DeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDeleteRenderbuffers, "context = %d, n = %d, renderbuffers = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)renderbuffers);
@@ -1036,6 +1071,7 @@ void GL_APIENTRY GL_DeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers)
 
 void GL_APIENTRY GL_DeleteShader(GLuint shader)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_DeleteShader, shader);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDeleteShader, "context = %d, shader = %u", CID(context), shader);
 
@@ -1061,6 +1097,7 @@ void GL_APIENTRY GL_DeleteShader(GLuint shader)
 
 void GL_APIENTRY GL_DeleteTextures(GLsizei n, const GLuint *textures)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDeleteTextures, "context = %d, n = %d, textures = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)textures);
@@ -1087,6 +1124,7 @@ void GL_APIENTRY GL_DeleteTextures(GLsizei n, const GLuint *textures)
 
 void GL_APIENTRY GL_DepthFunc(GLenum func)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_DepthFunc, func);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDepthFunc, "context = %d, func = %s", CID(context),
           GLenumToString(GLESEnum::DepthFunction, func));
@@ -1113,6 +1151,7 @@ void GL_APIENTRY GL_DepthFunc(GLenum func)
 
 void GL_APIENTRY GL_DepthMask(GLboolean flag)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_DepthMask, flag);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDepthMask, "context = %d, flag = %s", CID(context), GLbooleanToString(flag));
 
@@ -1138,6 +1177,7 @@ void GL_APIENTRY GL_DepthMask(GLboolean flag)
 
 void GL_APIENTRY GL_DepthRangef(GLfloat n, GLfloat f)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_DepthRangef, n, f);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDepthRangef, "context = %d, n = %f, f = %f", CID(context), n, f);
 
@@ -1163,6 +1203,7 @@ void GL_APIENTRY GL_DepthRangef(GLfloat n, GLfloat f)
 
 void GL_APIENTRY GL_DetachShader(GLuint program, GLuint shader)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_DetachShader, program, shader);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDetachShader, "context = %d, program = %u, shader = %u", CID(context), program,
           shader);
@@ -1194,6 +1235,7 @@ void GL_APIENTRY GL_DetachShader(GLuint program, GLuint shader)
 
 void GL_APIENTRY GL_Disable(GLenum cap)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_Disable, cap);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDisable, "context = %d, cap = %s", CID(context),
           GLenumToString(GLESEnum::EnableCap, cap));
@@ -1220,6 +1262,7 @@ void GL_APIENTRY GL_Disable(GLenum cap)
 
 void GL_APIENTRY GL_DisableVertexAttribArray(GLuint index)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_DisableVertexAttribArray, index);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDisableVertexAttribArray, "context = %d, index = %u", CID(context), index);
 
@@ -1244,6 +1287,7 @@ void GL_APIENTRY GL_DisableVertexAttribArray(GLuint index)
 
 void GL_APIENTRY GL_DrawArrays(GLenum mode, GLint first, GLsizei count)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE_DRAW(GL_DrawArrays, mode, first, count);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDrawArrays, "context = %d, mode = %s, first = %d, count = %d", CID(context),
           GLenumToString(GLESEnum::PrimitiveType, mode), first, count);
@@ -1270,6 +1314,7 @@ void GL_APIENTRY GL_DrawArrays(GLenum mode, GLint first, GLsizei count)
 
 void GL_APIENTRY GL_DrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDrawElements,
           "context = %d, mode = %s, count = %d, type = %s, indices = 0x%016" PRIxPTR "",
@@ -1300,6 +1345,7 @@ void GL_APIENTRY GL_DrawElements(GLenum mode, GLsizei count, GLenum type, const
 
 void GL_APIENTRY GL_Enable(GLenum cap)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_Enable, cap);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLEnable, "context = %d, cap = %s", CID(context),
           GLenumToString(GLESEnum::EnableCap, cap));
@@ -1326,6 +1372,7 @@ void GL_APIENTRY GL_Enable(GLenum cap)
 
 void GL_APIENTRY GL_EnableVertexAttribArray(GLuint index)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_EnableVertexAttribArray, index);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLEnableVertexAttribArray, "context = %d, index = %u", CID(context), index);
 
@@ -1350,6 +1397,7 @@ void GL_APIENTRY GL_EnableVertexAttribArray(GLuint index)
 
 void GL_APIENTRY GL_Finish()
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLFinish, "context = %d", CID(context));
 
@@ -1377,6 +1425,7 @@ void GL_APIENTRY GL_Finish()
 
 void GL_APIENTRY GL_Flush()
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_Flush);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLFlush, "context = %d", CID(context));
 
@@ -1407,6 +1456,8 @@ void GL_APIENTRY GL_FramebufferRenderbuffer(GLenum target,
                                             GLenum renderbuffertarget,
                                             GLuint renderbuffer)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_FramebufferRenderbuffer, target, attachment, renderbuffertarget,
+                                 renderbuffer);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLFramebufferRenderbuffer,
           "context = %d, target = %s, attachment = %s, renderbuffertarget = %s, renderbuffer = %u",
@@ -1447,6 +1498,8 @@ void GL_APIENTRY GL_FramebufferTexture2D(GLenum target,
                                          GLuint texture,
                                          GLint level)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_FramebufferTexture2D, target, attachment, textarget, texture,
+                                 level);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLFramebufferTexture2D,
           "context = %d, target = %s, attachment = %s, textarget = %s, texture = %u, level = %d",
@@ -1484,6 +1537,7 @@ void GL_APIENTRY GL_FramebufferTexture2D(GLenum target,
 
 void GL_APIENTRY GL_FrontFace(GLenum mode)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_FrontFace, mode);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLFrontFace, "context = %d, mode = %s", CID(context),
           GLenumToString(GLESEnum::FrontFaceDirection, mode));
@@ -1510,6 +1564,7 @@ void GL_APIENTRY GL_FrontFace(GLenum mode)
 
 void GL_APIENTRY GL_GenBuffers(GLsizei n, GLuint *buffers)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGenBuffers, "context = %d, n = %d, buffers = 0x%016" PRIxPTR "", CID(context),
           n, (uintptr_t)buffers);
@@ -1536,6 +1591,7 @@ void GL_APIENTRY GL_GenBuffers(GLsizei n, GLuint *buffers)
 
 void GL_APIENTRY GL_GenFramebuffers(GLsizei n, GLuint *framebuffers)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGenFramebuffers, "context = %d, n = %d, framebuffers = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)framebuffers);
@@ -1562,6 +1618,7 @@ void GL_APIENTRY GL_GenFramebuffers(GLsizei n, GLuint *framebuffers)
 
 void GL_APIENTRY GL_GenRenderbuffers(GLsizei n, GLuint *renderbuffers)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGenRenderbuffers, "context = %d, n = %d, renderbuffers = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)renderbuffers);
@@ -1588,6 +1645,7 @@ void GL_APIENTRY GL_GenRenderbuffers(GLsizei n, GLuint *renderbuffers)
 
 void GL_APIENTRY GL_GenTextures(GLsizei n, GLuint *textures)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGenTextures, "context = %d, n = %d, textures = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)textures);
@@ -1614,6 +1672,7 @@ void GL_APIENTRY GL_GenTextures(GLsizei n, GLuint *textures)
 
 void GL_APIENTRY GL_GenerateMipmap(GLenum target)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_GenerateMipmap, target);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGenerateMipmap, "context = %d, target = %s", CID(context),
           GLenumToString(GLESEnum::TextureTarget, target));
@@ -1646,6 +1705,7 @@ void GL_APIENTRY GL_GetActiveAttrib(GLuint program,
                                     GLenum *type,
                                     GLchar *name)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetActiveAttrib,
           "context = %d, program = %u, index = %u, bufSize = %d, length = 0x%016" PRIxPTR
@@ -1683,6 +1743,7 @@ void GL_APIENTRY GL_GetActiveUniform(GLuint program,
                                      GLenum *type,
                                      GLchar *name)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetActiveUniform,
           "context = %d, program = %u, index = %u, bufSize = %d, length = 0x%016" PRIxPTR
@@ -1717,6 +1778,7 @@ void GL_APIENTRY GL_GetAttachedShaders(GLuint program,
                                        GLsizei *count,
                                        GLuint *shaders)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetAttachedShaders,
           "context = %d, program = %u, maxCount = %d, count = 0x%016" PRIxPTR
@@ -1748,6 +1810,7 @@ void GL_APIENTRY GL_GetAttachedShaders(GLuint program,
 
 GLint GL_APIENTRY GL_GetAttribLocation(GLuint program, const GLchar *name)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetAttribLocation, "context = %d, program = %u, name = 0x%016" PRIxPTR "",
           CID(context), program, (uintptr_t)name);
@@ -1782,6 +1845,7 @@ GLint GL_APIENTRY GL_GetAttribLocation(GLuint program, const GLchar *name)
 
 void GL_APIENTRY GL_GetBooleanv(GLenum pname, GLboolean *data)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetBooleanv, "context = %d, pname = %s, data = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::GetPName, pname), (uintptr_t)data);
@@ -1807,6 +1871,7 @@ void GL_APIENTRY GL_GetBooleanv(GLenum pname, GLboolean *data)
 
 void GL_APIENTRY GL_GetBufferParameteriv(GLenum target, GLenum pname, GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetBufferParameteriv,
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
@@ -1836,6 +1901,7 @@ void GL_APIENTRY GL_GetBufferParameteriv(GLenum target, GLenum pname, GLint *par
 
 GLenum GL_APIENTRY GL_GetError()
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetGlobalContext();
     EVENT(context, GLGetError, "context = %d", CID(context));
 
@@ -1866,6 +1932,7 @@ GLenum GL_APIENTRY GL_GetError()
 
 void GL_APIENTRY GL_GetFloatv(GLenum pname, GLfloat *data)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetFloatv, "context = %d, pname = %s, data = 0x%016" PRIxPTR "", CID(context),
           GLenumToString(GLESEnum::GetPName, pname), (uintptr_t)data);
@@ -1894,6 +1961,7 @@ void GL_APIENTRY GL_GetFramebufferAttachmentParameteriv(GLenum target,
                                                         GLenum pname,
                                                         GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetFramebufferAttachmentParameteriv,
           "context = %d, target = %s, attachment = %s, pname = %s, params = 0x%016" PRIxPTR "",
@@ -1924,6 +1992,7 @@ void GL_APIENTRY GL_GetFramebufferAttachmentParameteriv(GLenum target,
 
 void GL_APIENTRY GL_GetIntegerv(GLenum pname, GLint *data)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetIntegerv, "context = %d, pname = %s, data = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::GetPName, pname), (uintptr_t)data);
@@ -1952,6 +2021,7 @@ void GL_APIENTRY GL_GetProgramInfoLog(GLuint program,
                                       GLsizei *length,
                                       GLchar *infoLog)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetProgramInfoLog,
           "context = %d, program = %u, bufSize = %d, length = 0x%016" PRIxPTR
@@ -1982,6 +2052,7 @@ void GL_APIENTRY GL_GetProgramInfoLog(GLuint program,
 
 void GL_APIENTRY GL_GetProgramiv(GLuint program, GLenum pname, GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetGlobalContext();
     EVENT(context, GLGetProgramiv,
           "context = %d, program = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
@@ -2008,6 +2079,7 @@ void GL_APIENTRY GL_GetProgramiv(GLuint program, GLenum pname, GLint *params)
 
 void GL_APIENTRY GL_GetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetRenderbufferParameteriv,
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
@@ -2039,6 +2111,7 @@ void GL_APIENTRY GL_GetShaderInfoLog(GLuint shader,
                                      GLsizei *length,
                                      GLchar *infoLog)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetShaderInfoLog,
           "context = %d, shader = %u, bufSize = %d, length = 0x%016" PRIxPTR
@@ -2071,6 +2144,7 @@ void GL_APIENTRY GL_GetShaderPrecisionFormat(GLenum shadertype,
                                              GLint *range,
                                              GLint *precision)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetShaderPrecisionFormat,
           "context = %d, shadertype = %s, precisiontype = %s, range = 0x%016" PRIxPTR
@@ -2102,6 +2176,7 @@ void GL_APIENTRY GL_GetShaderPrecisionFormat(GLenum shadertype,
 
 void GL_APIENTRY GL_GetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetShaderSource,
           "context = %d, shader = %u, bufSize = %d, length = 0x%016" PRIxPTR
@@ -2131,6 +2206,7 @@ void GL_APIENTRY GL_GetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *len
 
 void GL_APIENTRY GL_GetShaderiv(GLuint shader, GLenum pname, GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetGlobalContext();
     EVENT(context, GLGetShaderiv,
           "context = %d, shader = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context), shader,
@@ -2157,6 +2233,7 @@ void GL_APIENTRY GL_GetShaderiv(GLuint shader, GLenum pname, GLint *params)
 
 const GLubyte *GL_APIENTRY GL_GetString(GLenum name)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetString, "context = %d, name = %s", CID(context),
           GLenumToString(GLESEnum::StringName, name));
@@ -2188,6 +2265,7 @@ const GLubyte *GL_APIENTRY GL_GetString(GLenum name)
 
 void GL_APIENTRY GL_GetTexParameterfv(GLenum target, GLenum pname, GLfloat *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetTexParameterfv,
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
@@ -2217,6 +2295,7 @@ void GL_APIENTRY GL_GetTexParameterfv(GLenum target, GLenum pname, GLfloat *para
 
 void GL_APIENTRY GL_GetTexParameteriv(GLenum target, GLenum pname, GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetTexParameteriv,
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
@@ -2246,6 +2325,7 @@ void GL_APIENTRY GL_GetTexParameteriv(GLenum target, GLenum pname, GLint *params
 
 GLint GL_APIENTRY GL_GetUniformLocation(GLuint program, const GLchar *name)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetUniformLocation, "context = %d, program = %u, name = 0x%016" PRIxPTR "",
           CID(context), program, (uintptr_t)name);
@@ -2281,6 +2361,7 @@ GLint GL_APIENTRY GL_GetUniformLocation(GLuint program, const GLchar *name)
 
 void GL_APIENTRY GL_GetUniformfv(GLuint program, GLint location, GLfloat *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetUniformfv,
           "context = %d, program = %u, location = %d, params = 0x%016" PRIxPTR "", CID(context),
@@ -2309,6 +2390,7 @@ void GL_APIENTRY GL_GetUniformfv(GLuint program, GLint location, GLfloat *params
 
 void GL_APIENTRY GL_GetUniformiv(GLuint program, GLint location, GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetUniformiv,
           "context = %d, program = %u, location = %d, params = 0x%016" PRIxPTR "", CID(context),
@@ -2337,6 +2419,7 @@ void GL_APIENTRY GL_GetUniformiv(GLuint program, GLint location, GLint *params)
 
 void GL_APIENTRY GL_GetVertexAttribPointerv(GLuint index, GLenum pname, void **pointer)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetVertexAttribPointerv,
           "context = %d, index = %u, pname = %s, pointer = 0x%016" PRIxPTR "", CID(context), index,
@@ -2364,6 +2447,7 @@ void GL_APIENTRY GL_GetVertexAttribPointerv(GLuint index, GLenum pname, void **p
 
 void GL_APIENTRY GL_GetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetVertexAttribfv,
           "context = %d, index = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context), index,
@@ -2391,6 +2475,7 @@ void GL_APIENTRY GL_GetVertexAttribfv(GLuint index, GLenum pname, GLfloat *param
 
 void GL_APIENTRY GL_GetVertexAttribiv(GLuint index, GLenum pname, GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetVertexAttribiv,
           "context = %d, index = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context), index,
@@ -2418,6 +2503,7 @@ void GL_APIENTRY GL_GetVertexAttribiv(GLuint index, GLenum pname, GLint *params)
 
 void GL_APIENTRY GL_Hint(GLenum target, GLenum mode)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_Hint, target, mode);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLHint, "context = %d, target = %s, mode = %s", CID(context),
           GLenumToString(GLESEnum::HintTarget, target), GLenumToString(GLESEnum::HintMode, mode));
@@ -2447,6 +2533,7 @@ void GL_APIENTRY GL_Hint(GLenum target, GLenum mode)
 
 GLboolean GL_APIENTRY GL_IsBuffer(GLuint buffer)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIsBuffer, "context = %d, buffer = %u", CID(context), buffer);
 
@@ -2478,6 +2565,7 @@ GLboolean GL_APIENTRY GL_IsBuffer(GLuint buffer)
 
 GLboolean GL_APIENTRY GL_IsEnabled(GLenum cap)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIsEnabled, "context = %d, cap = %s", CID(context),
           GLenumToString(GLESEnum::EnableCap, cap));
@@ -2511,6 +2599,7 @@ GLboolean GL_APIENTRY GL_IsEnabled(GLenum cap)
 
 GLboolean GL_APIENTRY GL_IsFramebuffer(GLuint framebuffer)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIsFramebuffer, "context = %d, framebuffer = %u", CID(context), framebuffer);
 
@@ -2543,6 +2632,7 @@ GLboolean GL_APIENTRY GL_IsFramebuffer(GLuint framebuffer)
 
 GLboolean GL_APIENTRY GL_IsProgram(GLuint program)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIsProgram, "context = %d, program = %u", CID(context), program);
 
@@ -2575,6 +2665,7 @@ GLboolean GL_APIENTRY GL_IsProgram(GLuint program)
 
 GLboolean GL_APIENTRY GL_IsRenderbuffer(GLuint renderbuffer)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIsRenderbuffer, "context = %d, renderbuffer = %u", CID(context), renderbuffer);
 
@@ -2607,6 +2698,7 @@ GLboolean GL_APIENTRY GL_IsRenderbuffer(GLuint renderbuffer)
 
 GLboolean GL_APIENTRY GL_IsShader(GLuint shader)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIsShader, "context = %d, shader = %u", CID(context), shader);
 
@@ -2638,6 +2730,7 @@ GLboolean GL_APIENTRY GL_IsShader(GLuint shader)
 
 GLboolean GL_APIENTRY GL_IsTexture(GLuint texture)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIsTexture, "context = %d, texture = %u", CID(context), texture);
 
@@ -2670,6 +2763,7 @@ GLboolean GL_APIENTRY GL_IsTexture(GLuint texture)
 
 void GL_APIENTRY GL_LineWidth(GLfloat width)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_LineWidth, width);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLLineWidth, "context = %d, width = %f", CID(context), width);
 
@@ -2699,6 +2793,7 @@ void GL_APIENTRY GL_LineWidth(GLfloat width)
 
 void GL_APIENTRY GL_LinkProgram(GLuint program)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_LinkProgram, program);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLLinkProgram, "context = %d, program = %u", CID(context), program);
 
@@ -2727,6 +2822,7 @@ void GL_APIENTRY GL_LinkProgram(GLuint program)
 
 void GL_APIENTRY GL_PixelStorei(GLenum pname, GLint param)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_PixelStorei, pname, param);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPixelStorei, "context = %d, pname = %s, param = %d", CID(context),
           GLenumToString(GLESEnum::PixelStoreParameter, pname), param);
@@ -2757,6 +2853,7 @@ void GL_APIENTRY GL_PixelStorei(GLenum pname, GLint param)
 
 void GL_APIENTRY GL_PolygonOffset(GLfloat factor, GLfloat units)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_PolygonOffset, factor, units);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPolygonOffset, "context = %d, factor = %f, units = %f", CID(context), factor,
           units);
@@ -2790,6 +2887,7 @@ void GL_APIENTRY GL_ReadPixels(GLint x,
                                GLenum type,
                                void *pixels)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLReadPixels,
           "context = %d, x = %d, y = %d, width = %d, height = %d, format = %s, type = %s, pixels = "
@@ -2823,6 +2921,7 @@ void GL_APIENTRY GL_ReadPixels(GLint x,
 
 void GL_APIENTRY GL_ReleaseShaderCompiler()
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_ReleaseShaderCompiler);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLReleaseShaderCompiler, "context = %d", CID(context));
 
@@ -2853,6 +2952,7 @@ void GL_APIENTRY GL_RenderbufferStorage(GLenum target,
                                         GLsizei width,
                                         GLsizei height)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_RenderbufferStorage, target, internalformat, width, height);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLRenderbufferStorage,
           "context = %d, target = %s, internalformat = %s, width = %d, height = %d", CID(context),
@@ -2885,6 +2985,7 @@ void GL_APIENTRY GL_RenderbufferStorage(GLenum target,
 
 void GL_APIENTRY GL_SampleCoverage(GLfloat value, GLboolean invert)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_SampleCoverage, value, invert);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLSampleCoverage, "context = %d, value = %f, invert = %s", CID(context), value,
           GLbooleanToString(invert));
@@ -2915,6 +3016,7 @@ void GL_APIENTRY GL_SampleCoverage(GLfloat value, GLboolean invert)
 
 void GL_APIENTRY GL_Scissor(GLint x, GLint y, GLsizei width, GLsizei height)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_Scissor, x, y, width, height);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLScissor, "context = %d, x = %d, y = %d, width = %d, height = %d", CID(context),
           x, y, width, height);
@@ -2945,6 +3047,7 @@ void GL_APIENTRY GL_ShaderBinary(GLsizei count,
                                  const void *binary,
                                  GLsizei length)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLShaderBinary,
           "context = %d, count = %d, shaders = 0x%016" PRIxPTR
@@ -2982,6 +3085,7 @@ void GL_APIENTRY GL_ShaderSource(GLuint shader,
                                  const GLchar *const *string,
                                  const GLint *length)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLShaderSource,
           "context = %d, shader = %u, count = %d, string = 0x%016" PRIxPTR
@@ -3014,6 +3118,7 @@ void GL_APIENTRY GL_ShaderSource(GLuint shader,
 
 void GL_APIENTRY GL_StencilFunc(GLenum func, GLint ref, GLuint mask)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_StencilFunc, func, ref, mask);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLStencilFunc, "context = %d, func = %s, ref = %d, mask = %u", CID(context),
           GLenumToString(GLESEnum::StencilFunction, func), ref, mask);
@@ -3040,6 +3145,7 @@ void GL_APIENTRY GL_StencilFunc(GLenum func, GLint ref, GLuint mask)
 
 void GL_APIENTRY GL_StencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_StencilFuncSeparate, face, func, ref, mask);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLStencilFuncSeparate, "context = %d, face = %s, func = %s, ref = %d, mask = %u",
           CID(context), GLenumToString(GLESEnum::TriangleFace, face),
@@ -3069,6 +3175,7 @@ void GL_APIENTRY GL_StencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLu
 
 void GL_APIENTRY GL_StencilMask(GLuint mask)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_StencilMask, mask);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLStencilMask, "context = %d, mask = %u", CID(context), mask);
 
@@ -3094,6 +3201,7 @@ void GL_APIENTRY GL_StencilMask(GLuint mask)
 
 void GL_APIENTRY GL_StencilMaskSeparate(GLenum face, GLuint mask)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_StencilMaskSeparate, face, mask);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLStencilMaskSeparate, "context = %d, face = %s, mask = %u", CID(context),
           GLenumToString(GLESEnum::TriangleFace, face), mask);
@@ -3121,6 +3229,7 @@ void GL_APIENTRY GL_StencilMaskSeparate(GLenum face, GLuint mask)
 
 void GL_APIENTRY GL_StencilOp(GLenum fail, GLenum zfail, GLenum zpass)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_StencilOp, fail, zfail, zpass);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLStencilOp, "context = %d, fail = %s, zfail = %s, zpass = %s", CID(context),
           GLenumToString(GLESEnum::StencilOp, fail), GLenumToString(GLESEnum::StencilOp, zfail),
@@ -3148,6 +3257,7 @@ void GL_APIENTRY GL_StencilOp(GLenum fail, GLenum zfail, GLenum zpass)
 
 void GL_APIENTRY GL_StencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_StencilOpSeparate, face, sfail, dpfail, dppass);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLStencilOpSeparate,
           "context = %d, face = %s, sfail = %s, dpfail = %s, dppass = %s", CID(context),
@@ -3186,6 +3296,7 @@ void GL_APIENTRY GL_TexImage2D(GLenum target,
                                GLenum type,
                                const void *pixels)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexImage2D,
           "context = %d, target = %s, level = %d, internalformat = %d, width = %d, height = %d, "
@@ -3222,6 +3333,7 @@ void GL_APIENTRY GL_TexImage2D(GLenum target,
 
 void GL_APIENTRY GL_TexParameterf(GLenum target, GLenum pname, GLfloat param)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_TexParameterf, target, pname, param);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexParameterf, "context = %d, target = %s, pname = %s, param = %f",
           CID(context), GLenumToString(GLESEnum::TextureTarget, target),
@@ -3249,6 +3361,7 @@ void GL_APIENTRY GL_TexParameterf(GLenum target, GLenum pname, GLfloat param)
 
 void GL_APIENTRY GL_TexParameterfv(GLenum target, GLenum pname, const GLfloat *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexParameterfv,
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
@@ -3277,6 +3390,7 @@ void GL_APIENTRY GL_TexParameterfv(GLenum target, GLenum pname, const GLfloat *p
 
 void GL_APIENTRY GL_TexParameteri(GLenum target, GLenum pname, GLint param)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_TexParameteri, target, pname, param);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexParameteri, "context = %d, target = %s, pname = %s, param = %d",
           CID(context), GLenumToString(GLESEnum::TextureTarget, target),
@@ -3304,6 +3418,7 @@ void GL_APIENTRY GL_TexParameteri(GLenum target, GLenum pname, GLint param)
 
 void GL_APIENTRY GL_TexParameteriv(GLenum target, GLenum pname, const GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexParameteriv,
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
@@ -3340,6 +3455,7 @@ void GL_APIENTRY GL_TexSubImage2D(GLenum target,
                                   GLenum type,
                                   const void *pixels)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexSubImage2D,
           "context = %d, target = %s, level = %d, xoffset = %d, yoffset = %d, width = %d, height = "
@@ -3376,6 +3492,7 @@ void GL_APIENTRY GL_TexSubImage2D(GLenum target,
 
 void GL_APIENTRY GL_Uniform1f(GLint location, GLfloat v0)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_Uniform1f, location, v0);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLUniform1f, "context = %d, location = %d, v0 = %f", CID(context), location, v0);
 
@@ -3401,6 +3518,7 @@ void GL_APIENTRY GL_Uniform1f(GLint location, GLfloat v0)
 
 void GL_APIENTRY GL_Uniform1fv(GLint location, GLsizei count, const GLfloat *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLUniform1fv,
           "context = %d, location = %d, count = %d, value = 0x%016" PRIxPTR "", CID(context),
@@ -3428,6 +3546,7 @@ void GL_APIENTRY GL_Uniform1fv(GLint location, GLsizei count, const GLfloat *val
 
 void GL_APIENTRY GL_Uniform1i(GLint location, GLint v0)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_Uniform1i, location, v0);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLUniform1i, "context = %d, location = %d, v0 = %d", CID(context), location, v0);
 
@@ -3453,6 +3572,7 @@ void GL_APIENTRY GL_Uniform1i(GLint location, GLint v0)
 
 void GL_APIENTRY GL_Uniform1iv(GLint location, GLsizei count, const GLint *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLUniform1iv,
           "context = %d, location = %d, count = %d, value = 0x%016" PRIxPTR "", CID(context),
@@ -3480,6 +3600,7 @@ void GL_APIENTRY GL_Uniform1iv(GLint location, GLsizei count, const GLint *value
 
 void GL_APIENTRY GL_Uniform2f(GLint location, GLfloat v0, GLfloat v1)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_Uniform2f, location, v0, v1);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLUniform2f, "context = %d, location = %d, v0 = %f, v1 = %f", CID(context),
           location, v0, v1);
@@ -3506,6 +3627,7 @@ void GL_APIENTRY GL_Uniform2f(GLint location, GLfloat v0, GLfloat v1)
 
 void GL_APIENTRY GL_Uniform2fv(GLint location, GLsizei count, const GLfloat *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLUniform2fv,
           "context = %d, location = %d, count = %d, value = 0x%016" PRIxPTR "", CID(context),
@@ -3533,6 +3655,7 @@ void GL_APIENTRY GL_Uniform2fv(GLint location, GLsizei count, const GLfloat *val
 
 void GL_APIENTRY GL_Uniform2i(GLint location, GLint v0, GLint v1)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_Uniform2i, location, v0, v1);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLUniform2i, "context = %d, location = %d, v0 = %d, v1 = %d", CID(context),
           location, v0, v1);
@@ -3559,6 +3682,7 @@ void GL_APIENTRY GL_Uniform2i(GLint location, GLint v0, GLint v1)
 
 void GL_APIENTRY GL_Uniform2iv(GLint location, GLsizei count, const GLint *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLUniform2iv,
           "context = %d, location = %d, count = %d, value = 0x%016" PRIxPTR "", CID(context),
@@ -3586,6 +3710,7 @@ void GL_APIENTRY GL_Uniform2iv(GLint location, GLsizei count, const GLint *value
 
 void GL_APIENTRY GL_Uniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_Uniform3f, location, v0, v1, v2);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLUniform3f, "context = %d, location = %d, v0 = %f, v1 = %f, v2 = %f",
           CID(context), location, v0, v1, v2);
@@ -3612,6 +3737,7 @@ void GL_APIENTRY GL_Uniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2
 
 void GL_APIENTRY GL_Uniform3fv(GLint location, GLsizei count, const GLfloat *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLUniform3fv,
           "context = %d, location = %d, count = %d, value = 0x%016" PRIxPTR "", CID(context),
@@ -3639,6 +3765,7 @@ void GL_APIENTRY GL_Uniform3fv(GLint location, GLsizei count, const GLfloat *val
 
 void GL_APIENTRY GL_Uniform3i(GLint location, GLint v0, GLint v1, GLint v2)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_Uniform3i, location, v0, v1, v2);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLUniform3i, "context = %d, location = %d, v0 = %d, v1 = %d, v2 = %d",
           CID(context), location, v0, v1, v2);
@@ -3665,6 +3792,7 @@ void GL_APIENTRY GL_Uniform3i(GLint location, GLint v0, GLint v1, GLint v2)
 
 void GL_APIENTRY GL_Uniform3iv(GLint location, GLsizei count, const GLint *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLUniform3iv,
           "context = %d, location = %d, count = %d, value = 0x%016" PRIxPTR "", CID(context),
@@ -3692,6 +3820,7 @@ void GL_APIENTRY GL_Uniform3iv(GLint location, GLsizei count, const GLint *value
 
 void GL_APIENTRY GL_Uniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_Uniform4f, location, v0, v1, v2, v3);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLUniform4f, "context = %d, location = %d, v0 = %f, v1 = %f, v2 = %f, v3 = %f",
           CID(context), location, v0, v1, v2, v3);
@@ -3718,6 +3847,7 @@ void GL_APIENTRY GL_Uniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2
 
 void GL_APIENTRY GL_Uniform4fv(GLint location, GLsizei count, const GLfloat *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLUniform4fv,
           "context = %d, location = %d, count = %d, value = 0x%016" PRIxPTR "", CID(context),
@@ -3745,6 +3875,7 @@ void GL_APIENTRY GL_Uniform4fv(GLint location, GLsizei count, const GLfloat *val
 
 void GL_APIENTRY GL_Uniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_Uniform4i, location, v0, v1, v2, v3);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLUniform4i, "context = %d, location = %d, v0 = %d, v1 = %d, v2 = %d, v3 = %d",
           CID(context), location, v0, v1, v2, v3);
@@ -3771,6 +3902,7 @@ void GL_APIENTRY GL_Uniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLin
 
 void GL_APIENTRY GL_Uniform4iv(GLint location, GLsizei count, const GLint *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLUniform4iv,
           "context = %d, location = %d, count = %d, value = 0x%016" PRIxPTR "", CID(context),
@@ -3801,6 +3933,7 @@ void GL_APIENTRY GL_UniformMatrix2fv(GLint location,
                                      GLboolean transpose,
                                      const GLfloat *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLUniformMatrix2fv,
           "context = %d, location = %d, count = %d, transpose = %s, value = 0x%016" PRIxPTR "",
@@ -3832,6 +3965,7 @@ void GL_APIENTRY GL_UniformMatrix3fv(GLint location,
                                      GLboolean transpose,
                                      const GLfloat *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLUniformMatrix3fv,
           "context = %d, location = %d, count = %d, transpose = %s, value = 0x%016" PRIxPTR "",
@@ -3863,6 +3997,7 @@ void GL_APIENTRY GL_UniformMatrix4fv(GLint location,
                                      GLboolean transpose,
                                      const GLfloat *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLUniformMatrix4fv,
           "context = %d, location = %d, count = %d, transpose = %s, value = 0x%016" PRIxPTR "",
@@ -3891,6 +4026,7 @@ void GL_APIENTRY GL_UniformMatrix4fv(GLint location,
 
 void GL_APIENTRY GL_UseProgram(GLuint program)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_UseProgram, program);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLUseProgram, "context = %d, program = %u", CID(context), program);
 
@@ -3916,6 +4052,7 @@ void GL_APIENTRY GL_UseProgram(GLuint program)
 
 void GL_APIENTRY GL_ValidateProgram(GLuint program)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_ValidateProgram, program);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLValidateProgram, "context = %d, program = %u", CID(context), program);
 
@@ -3941,6 +4078,7 @@ void GL_APIENTRY GL_ValidateProgram(GLuint program)
 
 void GL_APIENTRY GL_VertexAttrib1f(GLuint index, GLfloat x)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_VertexAttrib1f, index, x);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertexAttrib1f, "context = %d, index = %u, x = %f", CID(context), index, x);
 
@@ -3966,6 +4104,7 @@ void GL_APIENTRY GL_VertexAttrib1f(GLuint index, GLfloat x)
 
 void GL_APIENTRY GL_VertexAttrib1fv(GLuint index, const GLfloat *v)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertexAttrib1fv, "context = %d, index = %u, v = 0x%016" PRIxPTR "",
           CID(context), index, (uintptr_t)v);
@@ -3993,6 +4132,7 @@ void GL_APIENTRY GL_VertexAttrib1fv(GLuint index, const GLfloat *v)
 
 void GL_APIENTRY GL_VertexAttrib2f(GLuint index, GLfloat x, GLfloat y)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_VertexAttrib2f, index, x, y);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertexAttrib2f, "context = %d, index = %u, x = %f, y = %f", CID(context),
           index, x, y);
@@ -4020,6 +4160,7 @@ void GL_APIENTRY GL_VertexAttrib2f(GLuint index, GLfloat x, GLfloat y)
 
 void GL_APIENTRY GL_VertexAttrib2fv(GLuint index, const GLfloat *v)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertexAttrib2fv, "context = %d, index = %u, v = 0x%016" PRIxPTR "",
           CID(context), index, (uintptr_t)v);
@@ -4047,6 +4188,7 @@ void GL_APIENTRY GL_VertexAttrib2fv(GLuint index, const GLfloat *v)
 
 void GL_APIENTRY GL_VertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_VertexAttrib3f, index, x, y, z);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertexAttrib3f, "context = %d, index = %u, x = %f, y = %f, z = %f",
           CID(context), index, x, y, z);
@@ -4074,6 +4216,7 @@ void GL_APIENTRY GL_VertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z
 
 void GL_APIENTRY GL_VertexAttrib3fv(GLuint index, const GLfloat *v)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertexAttrib3fv, "context = %d, index = %u, v = 0x%016" PRIxPTR "",
           CID(context), index, (uintptr_t)v);
@@ -4101,6 +4244,7 @@ void GL_APIENTRY GL_VertexAttrib3fv(GLuint index, const GLfloat *v)
 
 void GL_APIENTRY GL_VertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_VertexAttrib4f, index, x, y, z, w);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertexAttrib4f, "context = %d, index = %u, x = %f, y = %f, z = %f, w = %f",
           CID(context), index, x, y, z, w);
@@ -4128,6 +4272,7 @@ void GL_APIENTRY GL_VertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z
 
 void GL_APIENTRY GL_VertexAttrib4fv(GLuint index, const GLfloat *v)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertexAttrib4fv, "context = %d, index = %u, v = 0x%016" PRIxPTR "",
           CID(context), index, (uintptr_t)v);
@@ -4160,6 +4305,7 @@ void GL_APIENTRY GL_VertexAttribPointer(GLuint index,
                                         GLsizei stride,
                                         const void *pointer)
 {
+    ANGLE_COMMAND_STREAM_SYNC_CLIENT_ARRAYS();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertexAttribPointer,
           "context = %d, index = %u, size = %d, type = %s, normalized = %s, stride = %d, pointer = "
@@ -4191,6 +4337,7 @@ void GL_APIENTRY GL_VertexAttribPointer(GLuint index,
 
 void GL_APIENTRY GL_Viewport(GLint x, GLint y, GLsizei width, GLsizei height)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_Viewport, x, y, width, height);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLViewport, "context = %d, x = %d, y = %d, width = %d, height = %d",
           CID(context), x, y, width, height);
@@ -25,6 +25,7 @@ using namespace gl;
 extern "C" {
 void GL_APIENTRY GL_BeginQuery(GLenum target, GLuint id)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_BeginQuery, target, id);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBeginQuery, "context = %d, target = %s, id = %u", CID(context),
           GLenumToString(GLESEnum::QueryTarget, target), id);
@@ -56,6 +57,7 @@ void GL_APIENTRY GL_BeginQuery(GLenum target, GLuint id)
 
 void GL_APIENTRY GL_BeginTransformFeedback(GLenum primitiveMode)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_BeginTransformFeedback, primitiveMode);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBeginTransformFeedback, "context = %d, primitiveMode = %s", CID(context),
           GLenumToString(GLESEnum::PrimitiveType, primitiveMode));
@@ -86,6 +88,7 @@ void GL_APIENTRY GL_BeginTransformFeedback(GLenum primitiveMode)
 
 void GL_APIENTRY GL_BindBufferBase(GLenum target, GLuint index, GLuint buffer)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_BindBufferBase, target, index, buffer);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBindBufferBase, "context = %d, target = %s, index = %u, buffer = %u",
           CID(context), GLenumToString(GLESEnum::BufferTargetARB, target), index, buffer);
@@ -114,6 +117,7 @@ void GL_APIENTRY GL_BindBufferBase(GLenum target, GLuint index, GLuint buffer)
 void GL_APIENTRY
 GL_BindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_BindBufferRange, target, index, buffer, offset, size);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBindBufferRange,
           "context = %d, target = %s, index = %u, buffer = %u, offset = %llu, size = %llu",
@@ -145,6 +149,7 @@ GL_BindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset,
 
 void GL_APIENTRY GL_BindSampler(GLuint unit, GLuint sampler)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_BindSampler, unit, sampler);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBindSampler, "context = %d, unit = %u, sampler = %u", CID(context), unit,
           sampler);
@@ -171,6 +176,7 @@ void GL_APIENTRY GL_BindSampler(GLuint unit, GLuint sampler)
 
 void GL_APIENTRY GL_BindTransformFeedback(GLenum target, GLuint id)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_BindTransformFeedback, target, id);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBindTransformFeedback, "context = %d, target = %s, id = %u", CID(context),
           GLenumToString(GLESEnum::BindTransformFeedbackTarget, target), id);
@@ -201,6 +207,7 @@ void GL_APIENTRY GL_BindTransformFeedback(GLenum target, GLuint id)
 
 void GL_APIENTRY GL_BindVertexArray(GLuint array)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_BindVertexArray, array);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBindVertexArray, "context = %d, array = %u", CID(context), array);
 
@@ -235,6 +242,8 @@ void GL_APIENTRY GL_BlitFramebuffer(GLint srcX0,
                                     GLbitfield mask,
                                     GLenum filter)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_BlitFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0,
+                                 dstX1, dstY1, mask, filter);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBlitFramebuffer,
           "context = %d, srcX0 = %d, srcY0 = %d, srcX1 = %d, srcY1 = %d, dstX0 = %d, dstY0 = %d, "
@@ -270,6 +279,7 @@ void GL_APIENTRY GL_BlitFramebuffer(GLint srcX0,
 
 void GL_APIENTRY GL_ClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_ClearBufferfi, buffer, drawbuffer, depth, stencil);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLClearBufferfi,
           "context = %d, buffer = %s, drawbuffer = %d, depth = %f, stencil = %d", CID(context),
@@ -296,6 +306,7 @@ void GL_APIENTRY GL_ClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth
 
 void GL_APIENTRY GL_ClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLClearBufferfv,
           "context = %d, buffer = %s, drawbuffer = %d, value = 0x%016" PRIxPTR "", CID(context),
@@ -322,6 +333,7 @@ void GL_APIENTRY GL_ClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat
 
 void GL_APIENTRY GL_ClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLClearBufferiv,
           "context = %d, buffer = %s, drawbuffer = %d, value = 0x%016" PRIxPTR "", CID(context),
@@ -348,6 +360,7 @@ void GL_APIENTRY GL_ClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *
 
 void GL_APIENTRY GL_ClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLClearBufferuiv,
           "context = %d, buffer = %s, drawbuffer = %d, value = 0x%016" PRIxPTR "", CID(context),
@@ -374,6 +387,7 @@ void GL_APIENTRY GL_ClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint
 
 GLenum GL_APIENTRY GL_ClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLClientWaitSync,
           "context = %d, sync = 0x%016" PRIxPTR ", flags = %s, timeout = %llu", CID(context),
@@ -422,6 +436,7 @@ void GL_APIENTRY GL_CompressedTexImage3D(GLenum target,
                                          GLsizei imageSize,
                                          const void *data)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLCompressedTexImage3D,
           "context = %d, target = %s, level = %d, internalformat = %s, width = %d, height = %d, "
@@ -469,6 +484,7 @@ void GL_APIENTRY GL_CompressedTexSubImage3D(GLenum target,
                                             GLsizei imageSize,
                                             const void *data)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLCompressedTexSubImage3D,
           "context = %d, target = %s, level = %d, xoffset = %d, yoffset = %d, zoffset = %d, width "
@@ -510,6 +526,8 @@ void GL_APIENTRY GL_CopyBufferSubData(GLenum readTarget,
                                       GLintptr writeOffset,
                                       GLsizeiptr size)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_CopyBufferSubData, readTarget, writeTarget, readOffset,
+                                 writeOffset, size);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLCopyBufferSubData,
           "context = %d, readTarget = %s, writeTarget = %s, readOffset = %llu, writeOffset = %llu, "
@@ -557,6 +575,8 @@ void GL_APIENTRY GL_CopyTexSubImage3D(GLenum target,
                                       GLsizei width,
                                       GLsizei height)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_CopyTexSubImage3D, target, level, xoffset, yoffset, zoffset, x,
+                                 y, width, height);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLCopyTexSubImage3D,
           "context = %d, target = %s, level = %d, xoffset = %d, yoffset = %d, zoffset = %d, x = "
@@ -593,6 +613,7 @@ void GL_APIENTRY GL_CopyTexSubImage3D(GLenum target,
 
 void GL_APIENTRY GL_DeleteQueries(GLsizei n, const GLuint *ids)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDeleteQueries, "context = %d, n = %d, ids = 0x%016" PRIxPTR "", CID(context),
           n, (uintptr_t)ids);
@@ -619,6 +640,7 @@ void GL_APIENTRY GL_DeleteQueries(GLsizei n, const GLuint *ids)
 
 void GL_APIENTRY GL_DeleteSamplers(GLsizei count, const GLuint *samplers)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDeleteSamplers, "context = %d, count = %d, samplers = 0x%016" PRIxPTR "",
           CID(context), count, (uintptr_t)samplers);
@@ -645,6 +667,7 @@ void GL_APIENTRY GL_DeleteSamplers(GLsizei count, const GLuint *samplers)
 
 void GL_APIENTRY GL_DeleteSync(GLsync sync)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDeleteSync, "context = %d, sync = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)sync);
@@ -671,6 +694,7 @@ void GL_APIENTRY GL_DeleteSync(GLsync sync)
 
 void GL_APIENTRY GL_DeleteTransformFeedbacks(GLsizei n, const GLuint *ids)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDeleteTransformFeedbacks, "context = %d, n = %d, ids = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)ids);
@@ -698,6 +722,7 @@ void GL_APIENTRY GL_DeleteTransformFeedbacks(GLsizei n, const GLuint *ids)
 
 void GL_APIENTRY GL_DeleteVertexArrays(GLsizei n, const GLuint *arrays)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDeleteVertexArrays, "context = %d, n = %d, arrays = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)arrays);
@@ -727,6 +752,7 @@ void GL_APIENTRY GL_DrawArraysInstanced(GLenum mode,
                                         GLsizei count,
                                         GLsizei instancecount)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE_DRAW(GL_DrawArraysInstanced, mode, first, count, instancecount);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDrawArraysInstanced,
           "context = %d, mode = %s, first = %d, count = %d, instancecount = %d", CID(context),
@@ -756,6 +782,7 @@ void GL_APIENTRY GL_DrawArraysInstanced(GLenum mode,
 
 void GL_APIENTRY GL_DrawBuffers(GLsizei n, const GLenum *bufs)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDrawBuffers, "context = %d, n = %d, bufs = 0x%016" PRIxPTR "", CID(context), n,
           (uintptr_t)bufs);
@@ -788,6 +815,7 @@ void GL_APIENTRY GL_DrawElementsInstanced(GLenum mode,
                                           const void *indices,
                                           GLsizei instancecount)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDrawElementsInstanced,
           "context = %d, mode = %s, count = %d, type = %s, indices = 0x%016" PRIxPTR
@@ -825,6 +853,7 @@ void GL_APIENTRY GL_DrawRangeElements(GLenum mode,
                                       GLenum type,
                                       const void *indices)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDrawRangeElements,
           "context = %d, mode = %s, start = %u, end = %u, count = %d, type = %s, indices = "
@@ -857,6 +886,7 @@ void GL_APIENTRY GL_DrawRangeElements(GLenum mode,
 
 void GL_APIENTRY GL_EndQuery(GLenum target)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_EndQuery, target);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLEndQuery, "context = %d, target = %s", CID(context),
           GLenumToString(GLESEnum::QueryTarget, target));
@@ -886,6 +916,7 @@ void GL_APIENTRY GL_EndQuery(GLenum target)
 
 void GL_APIENTRY GL_EndTransformFeedback()
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_EndTransformFeedback);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLEndTransformFeedback, "context = %d", CID(context));
 
@@ -913,6 +944,7 @@ void GL_APIENTRY GL_EndTransformFeedback()
 
 GLsync GL_APIENTRY GL_FenceSync(GLenum condition, GLbitfield flags)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLFenceSync, "context = %d, condition = %s, flags = %s", CID(context),
           GLenumToString(GLESEnum::SyncCondition, condition),
@@ -946,6 +978,7 @@ GLsync GL_APIENTRY GL_FenceSync(GLenum condition, GLbitfield flags)
 
 void GL_APIENTRY GL_FlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_FlushMappedBufferRange, target, offset, length);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLFlushMappedBufferRange,
           "context = %d, target = %s, offset = %llu, length = %llu", CID(context),
@@ -980,6 +1013,8 @@ void GL_APIENTRY GL_FramebufferTextureLayer(GLenum target,
                                             GLint level,
                                             GLint layer)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_FramebufferTextureLayer, target, attachment, texture, level,
+                                 layer);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLFramebufferTextureLayer,
           "context = %d, target = %s, attachment = %s, texture = %u, level = %d, layer = %d",
@@ -1013,6 +1048,7 @@ void GL_APIENTRY GL_FramebufferTextureLayer(GLenum target,
 
 void GL_APIENTRY GL_GenQueries(GLsizei n, GLuint *ids)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGenQueries, "context = %d, n = %d, ids = 0x%016" PRIxPTR "", CID(context), n,
           (uintptr_t)ids);
@@ -1039,6 +1075,7 @@ void GL_APIENTRY GL_GenQueries(GLsizei n, GLuint *ids)
 
 void GL_APIENTRY GL_GenSamplers(GLsizei count, GLuint *samplers)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGenSamplers, "context = %d, count = %d, samplers = 0x%016" PRIxPTR "",
           CID(context), count, (uintptr_t)samplers);
@@ -1065,6 +1102,7 @@ void GL_APIENTRY GL_GenSamplers(GLsizei count, GLuint *samplers)
 
 void GL_APIENTRY GL_GenTransformFeedbacks(GLsizei n, GLuint *ids)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGenTransformFeedbacks, "context = %d, n = %d, ids = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)ids);
@@ -1091,6 +1129,7 @@ void GL_APIENTRY GL_GenTransformFeedbacks(GLsizei n, GLuint *ids)
 
 void GL_APIENTRY GL_GenVertexArrays(GLsizei n, GLuint *arrays)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGenVertexArrays, "context = %d, n = %d, arrays = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)arrays);
@@ -1121,6 +1160,7 @@ void GL_APIENTRY GL_GetActiveUniformBlockName(GLuint program,
                                               GLsizei *length,
                                               GLchar *uniformBlockName)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(
         context, GLGetActiveUniformBlockName,
@@ -1159,6 +1199,7 @@ void GL_APIENTRY GL_GetActiveUniformBlockiv(GLuint program,
                                             GLenum pname,
                                             GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetActiveUniformBlockiv,
           "context = %d, program = %u, uniformBlockIndex = %u, pname = %s, params = 0x%016" PRIxPTR
@@ -1195,6 +1236,7 @@ void GL_APIENTRY GL_GetActiveUniformsiv(GLuint program,
                                         GLenum pname,
                                         GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetActiveUniformsiv,
           "context = %d, program = %u, uniformCount = %d, uniformIndices = 0x%016" PRIxPTR
@@ -1227,6 +1269,7 @@ void GL_APIENTRY GL_GetActiveUniformsiv(GLuint program,
 
 void GL_APIENTRY GL_GetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetBufferParameteri64v,
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
@@ -1256,6 +1299,7 @@ void GL_APIENTRY GL_GetBufferParameteri64v(GLenum target, GLenum pname, GLint64
 
 void GL_APIENTRY GL_GetBufferPointerv(GLenum target, GLenum pname, void **params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetBufferPointerv,
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
@@ -1285,6 +1329,7 @@ void GL_APIENTRY GL_GetBufferPointerv(GLenum target, GLenum pname, void **params
 
 GLint GL_APIENTRY GL_GetFragDataLocation(GLuint program, const GLchar *name)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetFragDataLocation, "context = %d, program = %u, name = 0x%016" PRIxPTR "",
           CID(context), program, (uintptr_t)name);
@@ -1320,6 +1365,7 @@ GLint GL_APIENTRY GL_GetFragDataLocation(GLuint program, const GLchar *name)
 
 void GL_APIENTRY GL_GetInteger64i_v(GLenum target, GLuint index, GLint64 *data)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetInteger64i_v,
           "context = %d, target = %s, index = %u, data = 0x%016" PRIxPTR "", CID(context),
@@ -1346,6 +1392,7 @@ void GL_APIENTRY GL_GetInteger64i_v(GLenum target, GLuint index, GLint64 *data)
 
 void GL_APIENTRY GL_GetInteger64v(GLenum pname, GLint64 *data)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetInteger64v, "context = %d, pname = %s, data = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::GetPName, pname), (uintptr_t)data);
@@ -1371,6 +1418,7 @@ void GL_APIENTRY GL_GetInteger64v(GLenum pname, GLint64 *data)
 
 void GL_APIENTRY GL_GetIntegeri_v(GLenum target, GLuint index, GLint *data)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetIntegeri_v,
           "context = %d, target = %s, index = %u, data = 0x%016" PRIxPTR "", CID(context),
@@ -1401,6 +1449,7 @@ void GL_APIENTRY GL_GetInternalformativ(GLenum target,
                                         GLsizei count,
                                         GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetInternalformativ,
           "context = %d, target = %s, internalformat = %s, pname = %s, count = %d, params = "
@@ -1436,6 +1485,7 @@ void GL_APIENTRY GL_GetProgramBinary(GLuint program,
                                      GLenum *binaryFormat,
                                      void *binary)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetProgramBinary,
           "context = %d, program = %u, bufSize = %d, length = 0x%016" PRIxPTR
@@ -1467,6 +1517,7 @@ void GL_APIENTRY GL_GetProgramBinary(GLuint program,
 
 void GL_APIENTRY GL_GetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetQueryObjectuiv,
           "context = %d, id = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context), id,
@@ -1495,6 +1546,7 @@ void GL_APIENTRY GL_GetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params)
 
 void GL_APIENTRY GL_GetQueryiv(GLenum target, GLenum pname, GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetQueryiv,
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
@@ -1523,6 +1575,7 @@ void GL_APIENTRY GL_GetQueryiv(GLenum target, GLenum pname, GLint *params)
 
 void GL_APIENTRY GL_GetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetSamplerParameterfv,
           "context = %d, sampler = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
@@ -1551,6 +1604,7 @@ void GL_APIENTRY GL_GetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat
 
 void GL_APIENTRY GL_GetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetSamplerParameteriv,
           "context = %d, sampler = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
@@ -1579,6 +1633,7 @@ void GL_APIENTRY GL_GetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *p
 
 const GLubyte *GL_APIENTRY GL_GetStringi(GLenum name, GLuint index)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetStringi, "context = %d, name = %s, index = %u", CID(context),
           GLenumToString(GLESEnum::StringName, name), index);
@@ -1612,6 +1667,7 @@ const GLubyte *GL_APIENTRY GL_GetStringi(GLenum name, GLuint index)
 void GL_APIENTRY
 GL_GetSynciv(GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *values)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetGlobalContext();
     EVENT(context, GLGetSynciv,
           "context = %d, sync = 0x%016" PRIxPTR ", pname = %s, count = %d, length = 0x%016" PRIxPTR
@@ -1646,6 +1702,7 @@ void GL_APIENTRY GL_GetTransformFeedbackVarying(GLuint program,
                                                 GLenum *type,
                                                 GLchar *name)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetTransformFeedbackVarying,
           "context = %d, program = %u, index = %u, bufSize = %d, length = 0x%016" PRIxPTR
@@ -1678,6 +1735,7 @@ void GL_APIENTRY GL_GetTransformFeedbackVarying(GLuint program,
 
 GLuint GL_APIENTRY GL_GetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetUniformBlockIndex,
           "context = %d, program = %u, uniformBlockName = 0x%016" PRIxPTR "", CID(context), program,
@@ -1718,6 +1776,7 @@ void GL_APIENTRY GL_GetUniformIndices(GLuint program,
                                       const GLchar *const *uniformNames,
                                       GLuint *uniformIndices)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetUniformIndices,
           "context = %d, program = %u, uniformCount = %d, uniformNames = 0x%016" PRIxPTR
@@ -1748,6 +1807,7 @@ void GL_APIENTRY GL_GetUniformIndices(GLuint program,
 
 void GL_APIENTRY GL_GetUniformuiv(GLuint program, GLint location, GLuint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetUniformuiv,
           "context = %d, program = %u, location = %d, params = 0x%016" PRIxPTR "", CID(context),
@@ -1777,6 +1837,7 @@ void GL_APIENTRY GL_GetUniformuiv(GLuint program, GLint location, GLuint *params
 
 void GL_APIENTRY GL_GetVertexAttribIiv(GLuint index, GLenum pname, GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetVertexAttribIiv,
           "context = %d, index = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context), index,
@@ -1804,6 +1865,7 @@ void GL_APIENTRY GL_GetVertexAttribIiv(GLuint index, GLenum pname, GLint *params
 
 void GL_APIENTRY GL_GetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetVertexAttribIuiv,
           "context = %d, index = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context), index,
@@ -1833,6 +1895,7 @@ void GL_APIENTRY GL_InvalidateFramebuffer(GLenum target,
                                           GLsizei numAttachments,
                                           const GLenum *attachments)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLInvalidateFramebuffer,
           "context = %d, target = %s, numAttachments = %d, attachments = 0x%016" PRIxPTR "",
@@ -1871,6 +1934,7 @@ void GL_APIENTRY GL_InvalidateSubFramebuffer(GLenum target,
                                              GLsizei width,
                                              GLsizei height)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLInvalidateSubFramebuffer,
           "context = %d, target = %s, numAttachments = %d, attachments = 0x%016" PRIxPTR
@@ -1906,6 +1970,7 @@ void GL_APIENTRY GL_InvalidateSubFramebuffer(GLenum target,
 
 GLboolean GL_APIENTRY GL_IsQuery(GLuint id)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIsQuery, "context = %d, id = %u", CID(context), id);
 
@@ -1937,6 +2002,7 @@ GLboolean GL_APIENTRY GL_IsQuery(GLuint id)
 
 GLboolean GL_APIENTRY GL_IsSampler(GLuint sampler)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIsSampler, "context = %d, sampler = %u", CID(context), sampler);
 
@@ -1969,6 +2035,7 @@ GLboolean GL_APIENTRY GL_IsSampler(GLuint sampler)
 
 GLboolean GL_APIENTRY GL_IsSync(GLsync sync)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIsSync, "context = %d, sync = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)sync);
@@ -2001,6 +2068,7 @@ GLboolean GL_APIENTRY GL_IsSync(GLsync sync)
 
 GLboolean GL_APIENTRY GL_IsTransformFeedback(GLuint id)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIsTransformFeedback, "context = %d, id = %u", CID(context), id);
 
@@ -2034,6 +2102,7 @@ GLboolean GL_APIENTRY GL_IsTransformFeedback(GLuint id)
 
 GLboolean GL_APIENTRY GL_IsVertexArray(GLuint array)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIsVertexArray, "context = %d, array = %u", CID(context), array);
 
@@ -2069,6 +2138,7 @@ void *GL_APIENTRY GL_MapBufferRange(GLenum target,
                                     GLsizeiptr length,
                                     GLbitfield access)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLMapBufferRange,
           "context = %d, target = %s, offset = %llu, length = %llu, access = %s", CID(context),
@@ -2106,6 +2176,7 @@ void *GL_APIENTRY GL_MapBufferRange(GLenum target,
 
 void GL_APIENTRY GL_PauseTransformFeedback()
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_PauseTransformFeedback);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPauseTransformFeedback, "context = %d", CID(context));
 
@@ -2137,6 +2208,7 @@ void GL_APIENTRY GL_ProgramBinary(GLuint program,
                                   const void *binary,
                                   GLsizei length)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramBinary,
           "context = %d, program = %u, binaryFormat = %s, binary = 0x%016" PRIxPTR ", length = %d",
@@ -2170,6 +2242,7 @@ void GL_APIENTRY GL_ProgramBinary(GLuint program,
 
 void GL_APIENTRY GL_ProgramParameteri(GLuint program, GLenum pname, GLint value)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_ProgramParameteri, program, pname, value);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramParameteri, "context = %d, program = %u, pname = %s, value = %d",
           CID(context), program, GLenumToString(GLESEnum::ProgramParameterPName, pname), value);
@@ -2200,6 +2273,7 @@ void GL_APIENTRY GL_ProgramParameteri(GLuint program, GLenum pname, GLint value)
 
 void GL_APIENTRY GL_ReadBuffer(GLenum src)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_ReadBuffer, src);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLReadBuffer, "context = %d, src = %s", CID(context),
           GLenumToString(GLESEnum::ReadBufferMode, src));
@@ -2232,6 +2306,8 @@ void GL_APIENTRY GL_RenderbufferStorageMultisample(GLenum target,
                                                    GLsizei width,
                                                    GLsizei height)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_RenderbufferStorageMultisample, target, samples, internalformat,
+                                 width, height);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLRenderbufferStorageMultisample,
           "context = %d, target = %s, samples = %d, internalformat = %s, width = %d, height = %d",
@@ -2265,6 +2341,7 @@ void GL_APIENTRY GL_RenderbufferStorageMultisample(GLenum target,
 
 void GL_APIENTRY GL_ResumeTransformFeedback()
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_ResumeTransformFeedback);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLResumeTransformFeedback, "context = %d", CID(context));
 
@@ -2293,6 +2370,7 @@ void GL_APIENTRY GL_ResumeTransformFeedback()
 
 void GL_APIENTRY GL_SamplerParameterf(GLuint sampler, GLenum pname, GLfloat param)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_SamplerParameterf, sampler, pname, param);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLSamplerParameterf, "context = %d, sampler = %u, pname = %s, param = %f",
           CID(context), sampler, GLenumToString(GLESEnum::SamplerParameterF, pname), param);
@@ -2320,6 +2398,7 @@ void GL_APIENTRY GL_SamplerParameterf(GLuint sampler, GLenum pname, GLfloat para
 
 void GL_APIENTRY GL_SamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLSamplerParameterfv,
           "context = %d, sampler = %u, pname = %s, param = 0x%016" PRIxPTR "", CID(context),
@@ -2348,6 +2427,7 @@ void GL_APIENTRY GL_SamplerParameterfv(GLuint sampler, GLenum pname, const GLflo
 
 void GL_APIENTRY GL_SamplerParameteri(GLuint sampler, GLenum pname, GLint param)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_SamplerParameteri, sampler, pname, param);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLSamplerParameteri, "context = %d, sampler = %u, pname = %s, param = %d",
           CID(context), sampler, GLenumToString(GLESEnum::SamplerParameterI, pname), param);
@@ -2375,6 +2455,7 @@ void GL_APIENTRY GL_SamplerParameteri(GLuint sampler, GLenum pname, GLint param)
 
 void GL_APIENTRY GL_SamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLSamplerParameteriv,
           "context = %d, sampler = %u, pname = %s, param = 0x%016" PRIxPTR "", CID(context),
@@ -2412,6 +2493,7 @@ void GL_APIENTRY GL_TexImage3D(GLenum target,
                                GLenum type,
                                const void *pixels)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexImage3D,
           "context = %d, target = %s, level = %d, internalformat = %d, width = %d, height = %d, "
@@ -2450,6 +2532,7 @@ void GL_APIENTRY GL_TexImage3D(GLenum target,
 void GL_APIENTRY
 GL_TexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_TexStorage2D, target, levels, internalformat, width, height);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexStorage2D,
           "context = %d, target = %s, levels = %d, internalformat = %s, width = %d, height = %d",
@@ -2488,6 +2571,8 @@ void GL_APIENTRY GL_TexStorage3D(GLenum target,
                                  GLsizei height,
                                  GLsizei depth)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_TexStorage3D, target, levels, internalformat, width, height,
+                                 depth);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexStorage3D,
           "context = %d, target = %s, levels = %d, internalformat = %s, width = %d, height = %d, "
@@ -2532,6 +2617,7 @@ void GL_APIENTRY GL_TexSubImage3D(GLenum target,
                                   GLenum type,
                                   const void *pixels)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexSubImage3D,
           "context = %d, target = %s, level = %d, xoffset = %d, yoffset = %d, zoffset = %d, width "
@@ -2572,6 +2658,7 @@ void GL_APIENTRY GL_TransformFeedbackVaryings(GLuint program,
                                               const GLchar *const *varyings,
                                               GLenum bufferMode)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTransformFeedbackVaryings,
           "context = %d, program = %u, count = %d, varyings = 0x%016" PRIxPTR ", bufferMode = %s",
@@ -2606,6 +2693,7 @@ void GL_APIENTRY GL_TransformFeedbackVaryings(GLuint program,
 
 void GL_APIENTRY GL_Uniform1ui(GLint location, GLuint v0)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_Uniform1ui, location, v0);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLUniform1ui, "context = %d, location = %d, v0 = %u", CID(context), location,
           v0);
@@ -2632,6 +2720,7 @@ void GL_APIENTRY GL_Uniform1ui(GLint location, GLuint v0)
 
 void GL_APIENTRY GL_Uniform1uiv(GLint location, GLsizei count, const GLuint *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLUniform1uiv,
           "context = %d, location = %d, count = %d, value = 0x%016" PRIxPTR "", CID(context),
@@ -2659,6 +2748,7 @@ void GL_APIENTRY GL_Uniform1uiv(GLint location, GLsizei count, const GLuint *val
 
 void GL_APIENTRY GL_Uniform2ui(GLint location, GLuint v0, GLuint v1)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_Uniform2ui, location, v0, v1);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLUniform2ui, "context = %d, location = %d, v0 = %u, v1 = %u", CID(context),
           location, v0, v1);
@@ -2685,6 +2775,7 @@ void GL_APIENTRY GL_Uniform2ui(GLint location, GLuint v0, GLuint v1)
 
 void GL_APIENTRY GL_Uniform2uiv(GLint location, GLsizei count, const GLuint *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLUniform2uiv,
           "context = %d, location = %d, count = %d, value = 0x%016" PRIxPTR "", CID(context),
@@ -2712,6 +2803,7 @@ void GL_APIENTRY GL_Uniform2uiv(GLint location, GLsizei count, const GLuint *val
 
 void GL_APIENTRY GL_Uniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_Uniform3ui, location, v0, v1, v2);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLUniform3ui, "context = %d, location = %d, v0 = %u, v1 = %u, v2 = %u",
           CID(context), location, v0, v1, v2);
@@ -2738,6 +2830,7 @@ void GL_APIENTRY GL_Uniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2)
 
 void GL_APIENTRY GL_Uniform3uiv(GLint location, GLsizei count, const GLuint *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLUniform3uiv,
           "context = %d, location = %d, count = %d, value = 0x%016" PRIxPTR "", CID(context),
@@ -2765,6 +2858,7 @@ void GL_APIENTRY GL_Uniform3uiv(GLint location, GLsizei count, const GLuint *val
 
 void GL_APIENTRY GL_Uniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_Uniform4ui, location, v0, v1, v2, v3);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLUniform4ui, "context = %d, location = %d, v0 = %u, v1 = %u, v2 = %u, v3 = %u",
           CID(context), location, v0, v1, v2, v3);
@@ -2791,6 +2885,7 @@ void GL_APIENTRY GL_Uniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2,
 
 void GL_APIENTRY GL_Uniform4uiv(GLint location, GLsizei count, const GLuint *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLUniform4uiv,
           "context = %d, location = %d, count = %d, value = 0x%016" PRIxPTR "", CID(context),
@@ -2820,6 +2915,8 @@ void GL_APIENTRY GL_UniformBlockBinding(GLuint program,
                                         GLuint uniformBlockIndex,
                                         GLuint uniformBlockBinding)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_UniformBlockBinding, program, uniformBlockIndex,
+                                 uniformBlockBinding);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLUniformBlockBinding,
           "context = %d, program = %u, uniformBlockIndex = %u, uniformBlockBinding = %u",
@@ -2854,6 +2951,7 @@ void GL_APIENTRY GL_UniformMatrix2x3fv(GLint location,
                                        GLboolean transpose,
                                        const GLfloat *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLUniformMatrix2x3fv,
           "context = %d, location = %d, count = %d, transpose = %s, value = 0x%016" PRIxPTR "",
@@ -2886,6 +2984,7 @@ void GL_APIENTRY GL_UniformMatrix2x4fv(GLint location,
                                        GLboolean transpose,
                                        const GLfloat *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLUniformMatrix2x4fv,
           "context = %d, location = %d, count = %d, transpose = %s, value = 0x%016" PRIxPTR "",
@@ -2918,6 +3017,7 @@ void GL_APIENTRY GL_UniformMatrix3x2fv(GLint location,
                                        GLboolean transpose,
                                        const GLfloat *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLUniformMatrix3x2fv,
           "context = %d, location = %d, count = %d, transpose = %s, value = 0x%016" PRIxPTR "",
@@ -2950,6 +3050,7 @@ void GL_APIENTRY GL_UniformMatrix3x4fv(GLint location,
                                        GLboolean transpose,
                                        const GLfloat *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLUniformMatrix3x4fv,
           "context = %d, location = %d, count = %d, transpose = %s, value = 0x%016" PRIxPTR "",
@@ -2982,6 +3083,7 @@ void GL_APIENTRY GL_UniformMatrix4x2fv(GLint location,
                                        GLboolean transpose,
                                        const GLfloat *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLUniformMatrix4x2fv,
           "context = %d, location = %d, count = %d, transpose = %s, value = 0x%016" PRIxPTR "",
@@ -3014,6 +3116,7 @@ void GL_APIENTRY GL_UniformMatrix4x3fv(GLint location,
                                        GLboolean transpose,
                                        const GLfloat *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLUniformMatrix4x3fv,
           "context = %d, location = %d, count = %d, transpose = %s, value = 0x%016" PRIxPTR "",
@@ -3043,6 +3146,7 @@ void GL_APIENTRY GL_UniformMatrix4x3fv(GLint location,
 
 GLboolean GL_APIENTRY GL_UnmapBuffer(GLenum target)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLUnmapBuffer, "context = %d, target = %s", CID(context),
           GLenumToString(GLESEnum::BufferTargetARB, target));
@@ -3076,6 +3180,7 @@ GLboolean GL_APIENTRY GL_UnmapBuffer(GLenum target)
 
 void GL_APIENTRY GL_VertexAttribDivisor(GLuint index, GLuint divisor)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_VertexAttribDivisor, index, divisor);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertexAttribDivisor, "context = %d, index = %u, divisor = %u", CID(context),
           index, divisor);
@@ -3101,6 +3206,7 @@ void GL_APIENTRY GL_VertexAttribDivisor(GLuint index, GLuint divisor)
 
 void GL_APIENTRY GL_VertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_VertexAttribI4i, index, x, y, z, w);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertexAttribI4i, "context = %d, index = %u, x = %d, y = %d, z = %d, w = %d",
           CID(context), index, x, y, z, w);
@@ -3129,6 +3235,7 @@ void GL_APIENTRY GL_VertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLi
 
 void GL_APIENTRY GL_VertexAttribI4iv(GLuint index, const GLint *v)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertexAttribI4iv, "context = %d, index = %u, v = 0x%016" PRIxPTR "",
           CID(context), index, (uintptr_t)v);
@@ -3156,6 +3263,7 @@ void GL_APIENTRY GL_VertexAttribI4iv(GLuint index, const GLint *v)
 
 void GL_APIENTRY GL_VertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_VertexAttribI4ui, index, x, y, z, w);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertexAttribI4ui, "context = %d, index = %u, x = %u, y = %u, z = %u, w = %u",
           CID(context), index, x, y, z, w);
@@ -3184,6 +3292,7 @@ void GL_APIENTRY GL_VertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z,
 
 void GL_APIENTRY GL_VertexAttribI4uiv(GLuint index, const GLuint *v)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertexAttribI4uiv, "context = %d, index = %u, v = 0x%016" PRIxPTR "",
           CID(context), index, (uintptr_t)v);
@@ -3212,6 +3321,7 @@ void GL_APIENTRY GL_VertexAttribI4uiv(GLuint index, const GLuint *v)
 void GL_APIENTRY
 GL_VertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer)
 {
+    ANGLE_COMMAND_STREAM_SYNC_CLIENT_ARRAYS();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertexAttribIPointer,
           "context = %d, index = %u, size = %d, type = %s, stride = %d, pointer = 0x%016" PRIxPTR
@@ -3243,6 +3353,7 @@ GL_VertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, c
 
 void GL_APIENTRY GL_WaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLWaitSync, "context = %d, sync = 0x%016" PRIxPTR ", flags = %s, timeout = %llu",
           CID(context), (uintptr_t)sync,
@@ -25,6 +25,7 @@ using namespace gl;
 extern "C" {
 void GL_APIENTRY GL_ActiveShaderProgram(GLuint pipeline, GLuint program)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_ActiveShaderProgram, pipeline, program);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLActiveShaderProgram, "context = %d, pipeline = %u, program = %u", CID(context),
           pipeline, program);
@@ -62,6 +63,8 @@ void GL_APIENTRY GL_BindImageTexture(GLuint unit,
                                      GLenum access,
                                      GLenum format)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_BindImageTexture, unit, texture, level, layered, layer, access,
+                                 format);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBindImageTexture,
           "context = %d, unit = %u, texture = %u, level = %d, layered = %s, layer = %d, access = "
@@ -97,6 +100,7 @@ void GL_APIENTRY GL_BindImageTexture(GLuint unit,
 
 void GL_APIENTRY GL_BindProgramPipeline(GLuint pipeline)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_BindProgramPipeline, pipeline);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBindProgramPipeline, "context = %d, pipeline = %u", CID(context), pipeline);
 
@@ -129,6 +133,7 @@ void GL_APIENTRY GL_BindVertexBuffer(GLuint bindingindex,
                                      GLintptr offset,
                                      GLsizei stride)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_BindVertexBuffer, bindingindex, buffer, offset, stride);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBindVertexBuffer,
           "context = %d, bindingindex = %u, buffer = %u, offset = %llu, stride = %d", CID(context),
@@ -161,6 +166,7 @@ void GL_APIENTRY GL_BindVertexBuffer(GLuint bindingindex,
 
 GLuint GL_APIENTRY GL_CreateShaderProgramv(GLenum type, GLsizei count, const GLchar *const *strings)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLCreateShaderProgramv,
           "context = %d, type = %s, count = %d, strings = 0x%016" PRIxPTR "", CID(context),
@@ -201,6 +207,7 @@ GLuint GL_APIENTRY GL_CreateShaderProgramv(GLenum type, GLsizei count, const GLc
 
 void GL_APIENTRY GL_DeleteProgramPipelines(GLsizei n, const GLuint *pipelines)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDeleteProgramPipelines, "context = %d, n = %d, pipelines = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)pipelines);
@@ -228,6 +235,7 @@ void GL_APIENTRY GL_DeleteProgramPipelines(GLsizei n, const GLuint *pipelines)
 
 void GL_APIENTRY GL_DispatchCompute(GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_DispatchCompute, num_groups_x, num_groups_y, num_groups_z);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDispatchCompute,
           "context = %d, num_groups_x = %u, num_groups_y = %u, num_groups_z = %u", CID(context),
@@ -259,6 +267,7 @@ void GL_APIENTRY GL_DispatchCompute(GLuint num_groups_x, GLuint num_groups_y, GL
 
 void GL_APIENTRY GL_DispatchComputeIndirect(GLintptr indirect)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_DispatchComputeIndirect, indirect);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDispatchComputeIndirect, "context = %d, indirect = %llu", CID(context),
           static_cast<unsigned long long>(indirect));
@@ -284,6 +293,7 @@ void GL_APIENTRY GL_DispatchComputeIndirect(GLintptr indirect)
 
 void GL_APIENTRY GL_DrawArraysIndirect(GLenum mode, const void *indirect)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDrawArraysIndirect, "context = %d, mode = %s, indirect = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::PrimitiveType, mode), (uintptr_t)indirect);
@@ -311,6 +321,7 @@ void GL_APIENTRY GL_DrawArraysIndirect(GLenum mode, const void *indirect)
 
 void GL_APIENTRY GL_DrawElementsIndirect(GLenum mode, GLenum type, const void *indirect)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDrawElementsIndirect,
           "context = %d, mode = %s, type = %s, indirect = 0x%016" PRIxPTR "", CID(context),
@@ -342,6 +353,7 @@ void GL_APIENTRY GL_DrawElementsIndirect(GLenum mode, GLenum type, const void *i
 
 void GL_APIENTRY GL_FramebufferParameteri(GLenum target, GLenum pname, GLint param)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_FramebufferParameteri, target, pname, param);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLFramebufferParameteri, "context = %d, target = %s, pname = %s, param = %d",
           CID(context), GLenumToString(GLESEnum::FramebufferTarget, target),
@@ -372,6 +384,7 @@ void GL_APIENTRY GL_FramebufferParameteri(GLenum target, GLenum pname, GLint par
 
 void GL_APIENTRY GL_GenProgramPipelines(GLsizei n, GLuint *pipelines)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGenProgramPipelines, "context = %d, n = %d, pipelines = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)pipelines);
@@ -399,6 +412,7 @@ void GL_APIENTRY GL_GenProgramPipelines(GLsizei n, GLuint *pipelines)
 
 void GL_APIENTRY GL_GetBooleani_v(GLenum target, GLuint index, GLboolean *data)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetBooleani_v,
           "context = %d, target = %s, index = %u, data = 0x%016" PRIxPTR "", CID(context),
@@ -425,6 +439,7 @@ void GL_APIENTRY GL_GetBooleani_v(GLenum target, GLuint index, GLboolean *data)
 
 void GL_APIENTRY GL_GetFramebufferParameteriv(GLenum target, GLenum pname, GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetFramebufferParameteriv,
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
@@ -453,6 +468,7 @@ void GL_APIENTRY GL_GetFramebufferParameteriv(GLenum target, GLenum pname, GLint
 
 void GL_APIENTRY GL_GetMultisamplefv(GLenum pname, GLuint index, GLfloat *val)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetMultisamplefv,
           "context = %d, pname = %s, index = %u, val = 0x%016" PRIxPTR "", CID(context),
@@ -482,6 +498,7 @@ void GL_APIENTRY GL_GetProgramInterfaceiv(GLuint program,
                                           GLenum pname,
                                           GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetProgramInterfaceiv,
           "context = %d, program = %u, programInterface = %s, pname = %s, params = 0x%016" PRIxPTR
@@ -516,6 +533,7 @@ void GL_APIENTRY GL_GetProgramPipelineInfoLog(GLuint pipeline,
                                               GLsizei *length,
                                               GLchar *infoLog)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetProgramPipelineInfoLog,
           "context = %d, pipeline = %u, bufSize = %d, length = 0x%016" PRIxPTR
@@ -546,6 +564,7 @@ void GL_APIENTRY GL_GetProgramPipelineInfoLog(GLuint pipeline,
 
 void GL_APIENTRY GL_GetProgramPipelineiv(GLuint pipeline, GLenum pname, GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetProgramPipelineiv,
           "context = %d, pipeline = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
@@ -576,6 +595,7 @@ GLuint GL_APIENTRY GL_GetProgramResourceIndex(GLuint program,
                                               GLenum programInterface,
                                               const GLchar *name)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetProgramResourceIndex,
           "context = %d, program = %u, programInterface = %s, name = 0x%016" PRIxPTR "",
@@ -616,6 +636,7 @@ GLint GL_APIENTRY GL_GetProgramResourceLocation(GLuint program,
                                                 GLenum programInterface,
                                                 const GLchar *name)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetProgramResourceLocation,
           "context = %d, program = %u, programInterface = %s, name = 0x%016" PRIxPTR "",
@@ -661,6 +682,7 @@ void GL_APIENTRY GL_GetProgramResourceName(GLuint program,
                                            GLsizei *length,
                                            GLchar *name)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetProgramResourceName,
           "context = %d, program = %u, programInterface = %s, index = %u, bufSize = %d, length = "
@@ -700,6 +722,7 @@ void GL_APIENTRY GL_GetProgramResourceiv(GLuint program,
                                          GLsizei *length,
                                          GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetProgramResourceiv,
           "context = %d, program = %u, programInterface = %s, index = %u, propCount = %d, props = "
@@ -735,6 +758,7 @@ void GL_APIENTRY GL_GetTexLevelParameterfv(GLenum target,
                                            GLenum pname,
                                            GLfloat *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetTexLevelParameterfv,
           "context = %d, target = %s, level = %d, pname = %s, params = 0x%016" PRIxPTR "",
@@ -765,6 +789,7 @@ void GL_APIENTRY GL_GetTexLevelParameterfv(GLenum target,
 
 void GL_APIENTRY GL_GetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetTexLevelParameteriv,
           "context = %d, target = %s, level = %d, pname = %s, params = 0x%016" PRIxPTR "",
@@ -795,6 +820,7 @@ void GL_APIENTRY GL_GetTexLevelParameteriv(GLenum target, GLint level, GLenum pn
 
 GLboolean GL_APIENTRY GL_IsProgramPipeline(GLuint pipeline)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIsProgramPipeline, "context = %d, pipeline = %u", CID(context), pipeline);
 
@@ -828,6 +854,7 @@ GLboolean GL_APIENTRY GL_IsProgramPipeline(GLuint pipeline)
 
 void GL_APIENTRY GL_MemoryBarrier(GLbitfield barriers)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_MemoryBarrier, barriers);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLMemoryBarrier, "context = %d, barriers = %s", CID(context),
           GLbitfieldToString(GLESEnum::MemoryBarrierMask, barriers).c_str());
@@ -856,6 +883,7 @@ void GL_APIENTRY GL_MemoryBarrier(GLbitfield barriers)
 
 void GL_APIENTRY GL_MemoryBarrierByRegion(GLbitfield barriers)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_MemoryBarrierByRegion, barriers);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLMemoryBarrierByRegion, "context = %d, barriers = %s", CID(context),
           GLbitfieldToString(GLESEnum::MemoryBarrierMask, barriers).c_str());
@@ -885,6 +913,7 @@ void GL_APIENTRY GL_MemoryBarrierByRegion(GLbitfield barriers)
 
 void GL_APIENTRY GL_ProgramUniform1f(GLuint program, GLint location, GLfloat v0)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_ProgramUniform1f, program, location, v0);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniform1f, "context = %d, program = %u, location = %d, v0 = %f",
           CID(context), program, location, v0);
@@ -919,6 +948,7 @@ void GL_APIENTRY GL_ProgramUniform1fv(GLuint program,
                                       GLsizei count,
                                       const GLfloat *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniform1fv,
           "context = %d, program = %u, location = %d, count = %d, value = 0x%016" PRIxPTR "",
@@ -952,6 +982,7 @@ void GL_APIENTRY GL_ProgramUniform1fv(GLuint program,
 
 void GL_APIENTRY GL_ProgramUniform1i(GLuint program, GLint location, GLint v0)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_ProgramUniform1i, program, location, v0);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniform1i, "context = %d, program = %u, location = %d, v0 = %d",
           CID(context), program, location, v0);
@@ -986,6 +1017,7 @@ void GL_APIENTRY GL_ProgramUniform1iv(GLuint program,
                                       GLsizei count,
                                       const GLint *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniform1iv,
           "context = %d, program = %u, location = %d, count = %d, value = 0x%016" PRIxPTR "",
@@ -1019,6 +1051,7 @@ void GL_APIENTRY GL_ProgramUniform1iv(GLuint program,
 
 void GL_APIENTRY GL_ProgramUniform1ui(GLuint program, GLint location, GLuint v0)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_ProgramUniform1ui, program, location, v0);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniform1ui, "context = %d, program = %u, location = %d, v0 = %u",
           CID(context), program, location, v0);
@@ -1054,6 +1087,7 @@ void GL_APIENTRY GL_ProgramUniform1uiv(GLuint program,
                                        GLsizei count,
                                        const GLuint *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniform1uiv,
           "context = %d, program = %u, location = %d, count = %d, value = 0x%016" PRIxPTR "",
@@ -1087,6 +1121,7 @@ void GL_APIENTRY GL_ProgramUniform1uiv(GLuint program,
 
 void GL_APIENTRY GL_ProgramUniform2f(GLuint program, GLint location, GLfloat v0, GLfloat v1)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_ProgramUniform2f, program, location, v0, v1);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniform2f,
           "context = %d, program = %u, location = %d, v0 = %f, v1 = %f", CID(context), program,
@@ -1123,6 +1158,7 @@ void GL_APIENTRY GL_ProgramUniform2fv(GLuint program,
                                       GLsizei count,
                                       const GLfloat *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniform2fv,
           "context = %d, program = %u, location = %d, count = %d, value = 0x%016" PRIxPTR "",
@@ -1156,6 +1192,7 @@ void GL_APIENTRY GL_ProgramUniform2fv(GLuint program,
 
 void GL_APIENTRY GL_ProgramUniform2i(GLuint program, GLint location, GLint v0, GLint v1)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_ProgramUniform2i, program, location, v0, v1);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniform2i,
           "context = %d, program = %u, location = %d, v0 = %d, v1 = %d", CID(context), program,
@@ -1192,6 +1229,7 @@ void GL_APIENTRY GL_ProgramUniform2iv(GLuint program,
                                       GLsizei count,
                                       const GLint *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniform2iv,
           "context = %d, program = %u, location = %d, count = %d, value = 0x%016" PRIxPTR "",
@@ -1225,6 +1263,7 @@ void GL_APIENTRY GL_ProgramUniform2iv(GLuint program,
 
 void GL_APIENTRY GL_ProgramUniform2ui(GLuint program, GLint location, GLuint v0, GLuint v1)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_ProgramUniform2ui, program, location, v0, v1);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniform2ui,
           "context = %d, program = %u, location = %d, v0 = %u, v1 = %u", CID(context), program,
@@ -1261,6 +1300,7 @@ void GL_APIENTRY GL_ProgramUniform2uiv(GLuint program,
                                        GLsizei count,
                                        const GLuint *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniform2uiv,
           "context = %d, program = %u, location = %d, count = %d, value = 0x%016" PRIxPTR "",
@@ -1295,6 +1335,7 @@ void GL_APIENTRY GL_ProgramUniform2uiv(GLuint program,
 void GL_APIENTRY
 GL_ProgramUniform3f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_ProgramUniform3f, program, location, v0, v1, v2);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniform3f,
           "context = %d, program = %u, location = %d, v0 = %f, v1 = %f, v2 = %f", CID(context),
@@ -1331,6 +1372,7 @@ void GL_APIENTRY GL_ProgramUniform3fv(GLuint program,
                                       GLsizei count,
                                       const GLfloat *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniform3fv,
           "context = %d, program = %u, location = %d, count = %d, value = 0x%016" PRIxPTR "",
@@ -1364,6 +1406,7 @@ void GL_APIENTRY GL_ProgramUniform3fv(GLuint program,
 
 void GL_APIENTRY GL_ProgramUniform3i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_ProgramUniform3i, program, location, v0, v1, v2);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniform3i,
           "context = %d, program = %u, location = %d, v0 = %d, v1 = %d, v2 = %d", CID(context),
@@ -1400,6 +1443,7 @@ void GL_APIENTRY GL_ProgramUniform3iv(GLuint program,
                                       GLsizei count,
                                       const GLint *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniform3iv,
           "context = %d, program = %u, location = %d, count = %d, value = 0x%016" PRIxPTR "",
@@ -1434,6 +1478,7 @@ void GL_APIENTRY GL_ProgramUniform3iv(GLuint program,
 void GL_APIENTRY
 GL_ProgramUniform3ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_ProgramUniform3ui, program, location, v0, v1, v2);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniform3ui,
           "context = %d, program = %u, location = %d, v0 = %u, v1 = %u, v2 = %u", CID(context),
@@ -1470,6 +1515,7 @@ void GL_APIENTRY GL_ProgramUniform3uiv(GLuint program,
                                        GLsizei count,
                                        const GLuint *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniform3uiv,
           "context = %d, program = %u, location = %d, count = %d, value = 0x%016" PRIxPTR "",
@@ -1504,6 +1550,7 @@ void GL_APIENTRY GL_ProgramUniform3uiv(GLuint program,
 void GL_APIENTRY
 GL_ProgramUniform4f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_ProgramUniform4f, program, location, v0, v1, v2, v3);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniform4f,
           "context = %d, program = %u, location = %d, v0 = %f, v1 = %f, v2 = %f, v3 = %f",
@@ -1540,6 +1587,7 @@ void GL_APIENTRY GL_ProgramUniform4fv(GLuint program,
                                       GLsizei count,
                                       const GLfloat *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniform4fv,
           "context = %d, program = %u, location = %d, count = %d, value = 0x%016" PRIxPTR "",
@@ -1574,6 +1622,7 @@ void GL_APIENTRY GL_ProgramUniform4fv(GLuint program,
 void GL_APIENTRY
 GL_ProgramUniform4i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_ProgramUniform4i, program, location, v0, v1, v2, v3);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniform4i,
           "context = %d, program = %u, location = %d, v0 = %d, v1 = %d, v2 = %d, v3 = %d",
@@ -1610,6 +1659,7 @@ void GL_APIENTRY GL_ProgramUniform4iv(GLuint program,
                                       GLsizei count,
                                       const GLint *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniform4iv,
           "context = %d, program = %u, location = %d, count = %d, value = 0x%016" PRIxPTR "",
@@ -1644,6 +1694,7 @@ void GL_APIENTRY GL_ProgramUniform4iv(GLuint program,
 void GL_APIENTRY
 GL_ProgramUniform4ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_ProgramUniform4ui, program, location, v0, v1, v2, v3);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniform4ui,
           "context = %d, program = %u, location = %d, v0 = %u, v1 = %u, v2 = %u, v3 = %u",
@@ -1680,6 +1731,7 @@ void GL_APIENTRY GL_ProgramUniform4uiv(GLuint program,
                                        GLsizei count,
                                        const GLuint *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniform4uiv,
           "context = %d, program = %u, location = %d, count = %d, value = 0x%016" PRIxPTR "",
@@ -1717,6 +1769,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix2fv(GLuint program,
                                             GLboolean transpose,
                                             const GLfloat *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniformMatrix2fv,
           "context = %d, program = %u, location = %d, count = %d, transpose = %s, value = "
@@ -1757,6 +1810,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix2x3fv(GLuint program,
                                               GLboolean transpose,
                                               const GLfloat *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniformMatrix2x3fv,
           "context = %d, program = %u, location = %d, count = %d, transpose = %s, value = "
@@ -1797,6 +1851,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix2x4fv(GLuint program,
                                               GLboolean transpose,
                                               const GLfloat *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniformMatrix2x4fv,
           "context = %d, program = %u, location = %d, count = %d, transpose = %s, value = "
@@ -1837,6 +1892,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix3fv(GLuint program,
                                             GLboolean transpose,
                                             const GLfloat *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniformMatrix3fv,
           "context = %d, program = %u, location = %d, count = %d, transpose = %s, value = "
@@ -1877,6 +1933,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix3x2fv(GLuint program,
                                               GLboolean transpose,
                                               const GLfloat *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniformMatrix3x2fv,
           "context = %d, program = %u, location = %d, count = %d, transpose = %s, value = "
@@ -1917,6 +1974,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix3x4fv(GLuint program,
                                               GLboolean transpose,
                                               const GLfloat *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniformMatrix3x4fv,
           "context = %d, program = %u, location = %d, count = %d, transpose = %s, value = "
@@ -1957,6 +2015,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix4fv(GLuint program,
                                             GLboolean transpose,
                                             const GLfloat *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniformMatrix4fv,
           "context = %d, program = %u, location = %d, count = %d, transpose = %s, value = "
@@ -1997,6 +2056,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix4x2fv(GLuint program,
                                               GLboolean transpose,
                                               const GLfloat *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniformMatrix4x2fv,
           "context = %d, program = %u, location = %d, count = %d, transpose = %s, value = "
@@ -2037,6 +2097,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix4x3fv(GLuint program,
                                               GLboolean transpose,
                                               const GLfloat *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniformMatrix4x3fv,
           "context = %d, program = %u, location = %d, count = %d, transpose = %s, value = "
@@ -2073,6 +2134,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix4x3fv(GLuint program,
 
 void GL_APIENTRY GL_SampleMaski(GLuint maskNumber, GLbitfield mask)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_SampleMaski, maskNumber, mask);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLSampleMaski, "context = %d, maskNumber = %u, mask = %s", CID(context),
           maskNumber, GLbitfieldToString(GLESEnum::AllEnums, mask).c_str());
@@ -2108,6 +2170,8 @@ void GL_APIENTRY GL_TexStorage2DMultisample(GLenum target,
                                             GLsizei height,
                                             GLboolean fixedsamplelocations)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_TexStorage2DMultisample, target, samples, internalformat, width,
+                                 height, fixedsamplelocations);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexStorage2DMultisample,
           "context = %d, target = %s, samples = %d, internalformat = %s, width = %d, height = %d, "
@@ -2145,6 +2209,7 @@ void GL_APIENTRY GL_TexStorage2DMultisample(GLenum target,
 
 void GL_APIENTRY GL_UseProgramStages(GLuint pipeline, GLbitfield stages, GLuint program)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_UseProgramStages, pipeline, stages, program);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLUseProgramStages, "context = %d, pipeline = %u, stages = %s, program = %u",
           CID(context), pipeline, GLbitfieldToString(GLESEnum::UseProgramStageMask, stages).c_str(),
@@ -2178,6 +2243,7 @@ void GL_APIENTRY GL_UseProgramStages(GLuint pipeline, GLbitfield stages, GLuint
 
 void GL_APIENTRY GL_ValidateProgramPipeline(GLuint pipeline)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_ValidateProgramPipeline, pipeline);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLValidateProgramPipeline, "context = %d, pipeline = %u", CID(context),
           pipeline);
@@ -2208,6 +2274,7 @@ void GL_APIENTRY GL_ValidateProgramPipeline(GLuint pipeline)
 
 void GL_APIENTRY GL_VertexAttribBinding(GLuint attribindex, GLuint bindingindex)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_VertexAttribBinding, attribindex, bindingindex);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertexAttribBinding, "context = %d, attribindex = %u, bindingindex = %u",
           CID(context), attribindex, bindingindex);
@@ -2238,6 +2305,8 @@ void GL_APIENTRY GL_VertexAttribFormat(GLuint attribindex,
                                        GLboolean normalized,
                                        GLuint relativeoffset)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_VertexAttribFormat, attribindex, size, type, normalized,
+                                 relativeoffset);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertexAttribFormat,
           "context = %d, attribindex = %u, size = %d, type = %s, normalized = %s, relativeoffset = "
@@ -2272,6 +2341,7 @@ void GL_APIENTRY GL_VertexAttribIFormat(GLuint attribindex,
                                         GLenum type,
                                         GLuint relativeoffset)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_VertexAttribIFormat, attribindex, size, type, relativeoffset);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertexAttribIFormat,
           "context = %d, attribindex = %u, size = %d, type = %s, relativeoffset = %u", CID(context),
@@ -2301,6 +2371,7 @@ void GL_APIENTRY GL_VertexAttribIFormat(GLuint attribindex,
 
 void GL_APIENTRY GL_VertexBindingDivisor(GLuint bindingindex, GLuint divisor)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_VertexBindingDivisor, bindingindex, divisor);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertexBindingDivisor, "context = %d, bindingindex = %u, divisor = %u",
           CID(context), bindingindex, divisor);
@@ -25,6 +25,7 @@ using namespace gl;
 extern "C" {
 void GL_APIENTRY GL_BlendBarrier()
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_BlendBarrier);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBlendBarrier, "context = %d", CID(context));
 
@@ -52,6 +53,7 @@ void GL_APIENTRY GL_BlendBarrier()
 
 void GL_APIENTRY GL_BlendEquationSeparatei(GLuint buf, GLenum modeRGB, GLenum modeAlpha)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_BlendEquationSeparatei, buf, modeRGB, modeAlpha);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBlendEquationSeparatei, "context = %d, buf = %u, modeRGB = %s, modeAlpha = %s",
           CID(context), buf, GLenumToString(GLESEnum::BlendEquationModeEXT, modeRGB),
@@ -81,6 +83,7 @@ void GL_APIENTRY GL_BlendEquationSeparatei(GLuint buf, GLenum modeRGB, GLenum mo
 
 void GL_APIENTRY GL_BlendEquationi(GLuint buf, GLenum mode)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_BlendEquationi, buf, mode);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBlendEquationi, "context = %d, buf = %u, mode = %s", CID(context), buf,
           GLenumToString(GLESEnum::BlendEquationModeEXT, mode));
@@ -108,6 +111,7 @@ void GL_APIENTRY GL_BlendEquationi(GLuint buf, GLenum mode)
 void GL_APIENTRY
 GL_BlendFuncSeparatei(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_BlendFuncSeparatei, buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBlendFuncSeparatei,
           "context = %d, buf = %u, srcRGB = %s, dstRGB = %s, srcAlpha = %s, dstAlpha = %s",
@@ -141,6 +145,7 @@ GL_BlendFuncSeparatei(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha,
 
 void GL_APIENTRY GL_BlendFunci(GLuint buf, GLenum src, GLenum dst)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_BlendFunci, buf, src, dst);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBlendFunci, "context = %d, buf = %u, src = %s, dst = %s", CID(context), buf,
           GLenumToString(GLESEnum::BlendingFactor, src),
@@ -168,6 +173,7 @@ void GL_APIENTRY GL_BlendFunci(GLuint buf, GLenum src, GLenum dst)
 
 void GL_APIENTRY GL_ColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_ColorMaski, index, r, g, b, a);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLColorMaski, "context = %d, index = %u, r = %s, g = %s, b = %s, a = %s",
           CID(context), index, GLbooleanToString(r), GLbooleanToString(g), GLbooleanToString(b),
@@ -209,6 +215,9 @@ void GL_APIENTRY GL_CopyImageSubData(GLuint srcName,
                                      GLsizei srcHeight,
                                      GLsizei srcDepth)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_CopyImageSubData, srcName, srcTarget, srcLevel, srcX, srcY,
+                                 srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth,
+                                 srcHeight, srcDepth);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLCopyImageSubData,
           "context = %d, srcName = %u, srcTarget = %s, srcLevel = %d, srcX = %d, srcY = %d, srcZ = "
@@ -249,6 +258,7 @@ void GL_APIENTRY GL_CopyImageSubData(GLuint srcName,
 
 void GL_APIENTRY GL_DebugMessageCallback(GLDEBUGPROC callback, const void *userParam)
 {
+    ANGLE_COMMAND_STREAM_SYNC_DEBUG_CALLBACK(callback);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDebugMessageCallback,
           "context = %d, callback = 0x%016" PRIxPTR ", userParam = 0x%016" PRIxPTR "", CID(context),
@@ -281,6 +291,7 @@ void GL_APIENTRY GL_DebugMessageControl(GLenum source,
                                         const GLuint *ids,
                                         GLboolean enabled)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDebugMessageControl,
           "context = %d, source = %s, type = %s, severity = %s, count = %d, ids = 0x%016" PRIxPTR
@@ -318,6 +329,7 @@ void GL_APIENTRY GL_DebugMessageInsert(GLenum source,
                                        GLsizei length,
                                        const GLchar *buf)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDebugMessageInsert,
           "context = %d, source = %s, type = %s, id = %u, severity = %s, length = %d, buf = "
@@ -349,6 +361,7 @@ void GL_APIENTRY GL_DebugMessageInsert(GLenum source,
 
 void GL_APIENTRY GL_Disablei(GLenum target, GLuint index)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_Disablei, target, index);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDisablei, "context = %d, target = %s, index = %u", CID(context),
           GLenumToString(GLESEnum::EnableCap, target), index);
@@ -379,6 +392,7 @@ void GL_APIENTRY GL_DrawElementsBaseVertex(GLenum mode,
                                            const void *indices,
                                            GLint basevertex)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDrawElementsBaseVertex,
           "context = %d, mode = %s, count = %d, type = %s, indices = 0x%016" PRIxPTR
@@ -416,6 +430,7 @@ void GL_APIENTRY GL_DrawElementsInstancedBaseVertex(GLenum mode,
                                                     GLsizei instancecount,
                                                     GLint basevertex)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDrawElementsInstancedBaseVertex,
           "context = %d, mode = %s, count = %d, type = %s, indices = 0x%016" PRIxPTR
@@ -456,6 +471,7 @@ void GL_APIENTRY GL_DrawRangeElementsBaseVertex(GLenum mode,
                                                 const void *indices,
                                                 GLint basevertex)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDrawRangeElementsBaseVertex,
           "context = %d, mode = %s, start = %u, end = %u, count = %d, type = %s, indices = "
@@ -489,6 +505,7 @@ void GL_APIENTRY GL_DrawRangeElementsBaseVertex(GLenum mode,
 
 void GL_APIENTRY GL_Enablei(GLenum target, GLuint index)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_Enablei, target, index);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLEnablei, "context = %d, target = %s, index = %u", CID(context),
           GLenumToString(GLESEnum::EnableCap, target), index);
@@ -518,6 +535,7 @@ void GL_APIENTRY GL_FramebufferTexture(GLenum target,
                                        GLuint texture,
                                        GLint level)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_FramebufferTexture, target, attachment, texture, level);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLFramebufferTexture,
           "context = %d, target = %s, attachment = %s, texture = %u, level = %d", CID(context),
@@ -558,6 +576,7 @@ GLuint GL_APIENTRY GL_GetDebugMessageLog(GLuint count,
                                          GLsizei *lengths,
                                          GLchar *messageLog)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetDebugMessageLog,
           "context = %d, count = %u, bufSize = %d, sources = 0x%016" PRIxPTR
@@ -597,6 +616,7 @@ GLuint GL_APIENTRY GL_GetDebugMessageLog(GLuint count,
 
 GLenum GL_APIENTRY GL_GetGraphicsResetStatus()
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetGlobalContext();
     EVENT(context, GLGetGraphicsResetStatus, "context = %d", CID(context));
 
@@ -630,6 +650,7 @@ GLenum GL_APIENTRY GL_GetGraphicsResetStatus()
 void GL_APIENTRY
 GL_GetObjectLabel(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetObjectLabel,
           "context = %d, identifier = %s, name = %u, bufSize = %d, length = 0x%016" PRIxPTR
@@ -662,6 +683,7 @@ void GL_APIENTRY GL_GetObjectPtrLabel(const void *ptr,
                                       GLsizei *length,
                                       GLchar *label)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetObjectPtrLabel,
           "context = %d, ptr = 0x%016" PRIxPTR ", bufSize = %d, length = 0x%016" PRIxPTR
@@ -690,6 +712,7 @@ void GL_APIENTRY GL_GetObjectPtrLabel(const void *ptr,
 
 void GL_APIENTRY GL_GetPointerv(GLenum pname, void **params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetPointerv, "context = %d, pname = %s, params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::GetPointervPName, pname), (uintptr_t)params);
@@ -715,6 +738,7 @@ void GL_APIENTRY GL_GetPointerv(GLenum pname, void **params)
 
 void GL_APIENTRY GL_GetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetSamplerParameterIiv,
           "context = %d, sampler = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
@@ -744,6 +768,7 @@ void GL_APIENTRY GL_GetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *
 
 void GL_APIENTRY GL_GetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetSamplerParameterIuiv,
           "context = %d, sampler = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
@@ -773,6 +798,7 @@ void GL_APIENTRY GL_GetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint
 
 void GL_APIENTRY GL_GetTexParameterIiv(GLenum target, GLenum pname, GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetTexParameterIiv,
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
@@ -802,6 +828,7 @@ void GL_APIENTRY GL_GetTexParameterIiv(GLenum target, GLenum pname, GLint *param
 
 void GL_APIENTRY GL_GetTexParameterIuiv(GLenum target, GLenum pname, GLuint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetTexParameterIuiv,
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
@@ -831,6 +858,7 @@ void GL_APIENTRY GL_GetTexParameterIuiv(GLenum target, GLenum pname, GLuint *par
 
 void GL_APIENTRY GL_GetnUniformfv(GLuint program, GLint location, GLsizei bufSize, GLfloat *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetnUniformfv,
           "context = %d, program = %u, location = %d, bufSize = %d, params = 0x%016" PRIxPTR "",
@@ -860,6 +888,7 @@ void GL_APIENTRY GL_GetnUniformfv(GLuint program, GLint location, GLsizei bufSiz
 
 void GL_APIENTRY GL_GetnUniformiv(GLuint program, GLint location, GLsizei bufSize, GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetnUniformiv,
           "context = %d, program = %u, location = %d, bufSize = %d, params = 0x%016" PRIxPTR "",
@@ -889,6 +918,7 @@ void GL_APIENTRY GL_GetnUniformiv(GLuint program, GLint location, GLsizei bufSiz
 
 void GL_APIENTRY GL_GetnUniformuiv(GLuint program, GLint location, GLsizei bufSize, GLuint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetnUniformuiv,
           "context = %d, program = %u, location = %d, bufSize = %d, params = 0x%016" PRIxPTR "",
@@ -918,6 +948,7 @@ void GL_APIENTRY GL_GetnUniformuiv(GLuint program, GLint location, GLsizei bufSi
 
 GLboolean GL_APIENTRY GL_IsEnabledi(GLenum target, GLuint index)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIsEnabledi, "context = %d, target = %s, index = %u", CID(context),
           GLenumToString(GLESEnum::EnableCap, target), index);
@@ -952,6 +983,7 @@ GLboolean GL_APIENTRY GL_IsEnabledi(GLenum target, GLuint index)
 
 void GL_APIENTRY GL_MinSampleShading(GLfloat value)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_MinSampleShading, value);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLMinSampleShading, "context = %d, value = %f", CID(context), value);
 
@@ -981,6 +1013,7 @@ void GL_APIENTRY GL_MinSampleShading(GLfloat value)
 
 void GL_APIENTRY GL_ObjectLabel(GLenum identifier, GLuint name, GLsizei length, const GLchar *label)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLObjectLabel,
           "context = %d, identifier = %s, name = %u, length = %d, label = 0x%016" PRIxPTR "",
@@ -1008,6 +1041,7 @@ void GL_APIENTRY GL_ObjectLabel(GLenum identifier, GLuint name, GLsizei length,
 
 void GL_APIENTRY GL_ObjectPtrLabel(const void *ptr, GLsizei length, const GLchar *label)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLObjectPtrLabel,
           "context = %d, ptr = 0x%016" PRIxPTR ", length = %d, label = 0x%016" PRIxPTR "",
@@ -1034,6 +1068,7 @@ void GL_APIENTRY GL_ObjectPtrLabel(const void *ptr, GLsizei length, const GLchar
 
 void GL_APIENTRY GL_PatchParameteri(GLenum pname, GLint value)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_PatchParameteri, pname, value);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPatchParameteri, "context = %d, pname = %s, value = %d", CID(context),
           GLenumToString(GLESEnum::PatchParameterName, pname), value);
@@ -1064,6 +1099,7 @@ void GL_APIENTRY GL_PatchParameteri(GLenum pname, GLint value)
 
 void GL_APIENTRY GL_PopDebugGroup()
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_PopDebugGroup);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPopDebugGroup, "context = %d", CID(context));
 
@@ -1094,6 +1130,8 @@ void GL_APIENTRY GL_PrimitiveBoundingBox(GLfloat minX,
                                          GLfloat maxZ,
                                          GLfloat maxW)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_PrimitiveBoundingBox, minX, minY, minZ, minW, maxX, maxY, maxZ,
+                                 maxW);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPrimitiveBoundingBox,
           "context = %d, minX = %f, minY = %f, minZ = %f, minW = %f, maxX = %f, maxY = %f, maxZ = "
@@ -1129,6 +1167,7 @@ void GL_APIENTRY GL_PrimitiveBoundingBox(GLfloat minX,
 
 void GL_APIENTRY GL_PushDebugGroup(GLenum source, GLuint id, GLsizei length, const GLchar *message)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPushDebugGroup,
           "context = %d, source = %s, id = %u, length = %d, message = 0x%016" PRIxPTR "",
@@ -1163,6 +1202,7 @@ void GL_APIENTRY GL_ReadnPixels(GLint x,
                                 GLsizei bufSize,
                                 void *data)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLReadnPixels,
           "context = %d, x = %d, y = %d, width = %d, height = %d, format = %s, type = %s, bufSize "
@@ -1196,6 +1236,7 @@ void GL_APIENTRY GL_ReadnPixels(GLint x,
 
 void GL_APIENTRY GL_SamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLSamplerParameterIiv,
           "context = %d, sampler = %u, pname = %s, param = 0x%016" PRIxPTR "", CID(context),
@@ -1224,6 +1265,7 @@ void GL_APIENTRY GL_SamplerParameterIiv(GLuint sampler, GLenum pname, const GLin
 
 void GL_APIENTRY GL_SamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLSamplerParameterIuiv,
           "context = %d, sampler = %u, pname = %s, param = 0x%016" PRIxPTR "", CID(context),
@@ -1252,6 +1294,7 @@ void GL_APIENTRY GL_SamplerParameterIuiv(GLuint sampler, GLenum pname, const GLu
 
 void GL_APIENTRY GL_TexBuffer(GLenum target, GLenum internalformat, GLuint buffer)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_TexBuffer, target, internalformat, buffer);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexBuffer, "context = %d, target = %s, internalformat = %s, buffer = %u",
           CID(context), GLenumToString(GLESEnum::TextureTarget, target),
@@ -1289,6 +1332,7 @@ void GL_APIENTRY GL_TexBufferRange(GLenum target,
                                    GLintptr offset,
                                    GLsizeiptr size)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_TexBufferRange, target, internalformat, buffer, offset, size);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexBufferRange,
           "context = %d, target = %s, internalformat = %s, buffer = %u, offset = %llu, size = %llu",
@@ -1324,6 +1368,7 @@ void GL_APIENTRY GL_TexBufferRange(GLenum target,
 
 void GL_APIENTRY GL_TexParameterIiv(GLenum target, GLenum pname, const GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexParameterIiv,
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
@@ -1352,6 +1397,7 @@ void GL_APIENTRY GL_TexParameterIiv(GLenum target, GLenum pname, const GLint *pa
 
 void GL_APIENTRY GL_TexParameterIuiv(GLenum target, GLenum pname, const GLuint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexParameterIuiv,
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
@@ -1386,6 +1432,8 @@ void GL_APIENTRY GL_TexStorage3DMultisample(GLenum target,
                                             GLsizei depth,
                                             GLboolean fixedsamplelocations)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_TexStorage3DMultisample, target, samples, internalformat, width,
+                                 height, depth, fixedsamplelocations);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexStorage3DMultisample,
           "context = %d, target = %s, samples = %d, internalformat = %s, width = %d, height = %d, "
@@ -40,6 +40,7 @@ extern "C" {
 // GL_AMD_performance_monitor
 void GL_APIENTRY GL_BeginPerfMonitorAMD(GLuint monitor)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_BeginPerfMonitorAMD, monitor);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBeginPerfMonitorAMD, "context = %d, monitor = %u", CID(context), monitor);
 
@@ -68,6 +69,7 @@ void GL_APIENTRY GL_BeginPerfMonitorAMD(GLuint monitor)
 
 void GL_APIENTRY GL_DeletePerfMonitorsAMD(GLsizei n, GLuint *monitors)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDeletePerfMonitorsAMD, "context = %d, n = %d, monitors = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)monitors);
@@ -93,6 +95,7 @@ void GL_APIENTRY GL_DeletePerfMonitorsAMD(GLsizei n, GLuint *monitors)
 
 void GL_APIENTRY GL_EndPerfMonitorAMD(GLuint monitor)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_EndPerfMonitorAMD, monitor);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLEndPerfMonitorAMD, "context = %d, monitor = %u", CID(context), monitor);
 
@@ -120,6 +123,7 @@ void GL_APIENTRY GL_EndPerfMonitorAMD(GLuint monitor)
 
 void GL_APIENTRY GL_GenPerfMonitorsAMD(GLsizei n, GLuint *monitors)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGenPerfMonitorsAMD, "context = %d, n = %d, monitors = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)monitors);
@@ -149,6 +153,7 @@ void GL_APIENTRY GL_GetPerfMonitorCounterDataAMD(GLuint monitor,
                                                  GLuint *data,
                                                  GLint *bytesWritten)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetPerfMonitorCounterDataAMD,
           "context = %d, monitor = %u, pname = %s, dataSize = %d, data = 0x%016" PRIxPTR
@@ -182,6 +187,7 @@ void GL_APIENTRY GL_GetPerfMonitorCounterInfoAMD(GLuint group,
                                                  GLenum pname,
                                                  void *data)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetPerfMonitorCounterInfoAMD,
           "context = %d, group = %u, counter = %u, pname = %s, data = 0x%016" PRIxPTR "",
@@ -214,6 +220,7 @@ void GL_APIENTRY GL_GetPerfMonitorCounterStringAMD(GLuint group,
                                                    GLsizei *length,
                                                    GLchar *counterString)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetPerfMonitorCounterStringAMD,
           "context = %d, group = %u, counter = %u, bufSize = %d, length = 0x%016" PRIxPTR
@@ -247,6 +254,7 @@ void GL_APIENTRY GL_GetPerfMonitorCountersAMD(GLuint group,
                                               GLsizei counterSize,
                                               GLuint *counters)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetPerfMonitorCountersAMD,
           "context = %d, group = %u, numCounters = 0x%016" PRIxPTR
@@ -281,6 +289,7 @@ void GL_APIENTRY GL_GetPerfMonitorGroupStringAMD(GLuint group,
                                                  GLsizei *length,
                                                  GLchar *groupString)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetPerfMonitorGroupStringAMD,
           "context = %d, group = %u, bufSize = %d, length = 0x%016" PRIxPTR
@@ -310,6 +319,7 @@ void GL_APIENTRY GL_GetPerfMonitorGroupStringAMD(GLuint group,
 
 void GL_APIENTRY GL_GetPerfMonitorGroupsAMD(GLint *numGroups, GLsizei groupsSize, GLuint *groups)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetPerfMonitorGroupsAMD,
           "context = %d, numGroups = 0x%016" PRIxPTR ", groupsSize = %d, groups = 0x%016" PRIxPTR
@@ -343,6 +353,7 @@ void GL_APIENTRY GL_SelectPerfMonitorCountersAMD(GLuint monitor,
                                                  GLint numCounters,
                                                  GLuint *counterList)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLSelectPerfMonitorCountersAMD,
           "context = %d, monitor = %u, enable = %s, group = %u, numCounters = %d, counterList = "
@@ -384,6 +395,8 @@ void GL_APIENTRY GL_DrawArraysInstancedBaseInstanceANGLE(GLenum mode,
                                                          GLsizei instanceCount,
                                                          GLuint baseInstance)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE_DRAW(GL_DrawArraysInstancedBaseInstanceANGLE, mode, first, count,
+                                      instanceCount, baseInstance);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDrawArraysInstancedBaseInstanceANGLE,
           "context = %d, mode = %s, first = %d, count = %d, instanceCount = %d, baseInstance = %u",
@@ -421,6 +434,7 @@ void GL_APIENTRY GL_DrawElementsInstancedBaseVertexBaseInstanceANGLE(GLenum mode
                                                                      GLint baseVertex,
                                                                      GLuint baseInstance)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDrawElementsInstancedBaseVertexBaseInstanceANGLE,
           "context = %d, mode = %s, count = %d, type = %s, indices = 0x%016" PRIxPTR
@@ -462,6 +476,7 @@ void GL_APIENTRY GL_MultiDrawArraysInstancedBaseInstanceANGLE(GLenum mode,
                                                               const GLuint *baseInstances,
                                                               GLsizei drawcount)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLMultiDrawArraysInstancedBaseInstanceANGLE,
           "context = %d, mode = %s, firsts = 0x%016" PRIxPTR ", counts = 0x%016" PRIxPTR
@@ -506,6 +521,7 @@ GL_MultiDrawElementsInstancedBaseVertexBaseInstanceANGLE(GLenum mode,
                                                          const GLuint *baseInstances,
                                                          GLsizei drawcount)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLMultiDrawElementsInstancedBaseVertexBaseInstanceANGLE,
           "context = %d, mode = %s, counts = 0x%016" PRIxPTR ", type = %s, indices = 0x%016" PRIxPTR
@@ -552,6 +568,7 @@ void GL_APIENTRY GL_BlobCacheCallbacksANGLE(GLSETBLOBPROCANGLE set,
                                             GLGETBLOBPROCANGLE get,
                                             const void *userParam)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBlobCacheCallbacksANGLE,
           "context = %d, set = 0x%016" PRIxPTR ", get = 0x%016" PRIxPTR
@@ -583,6 +600,7 @@ void GL_APIENTRY GL_BlobCacheCallbacksANGLE(GLSETBLOBPROCANGLE set,
 
 void GL_APIENTRY GL_GetPointervANGLE(GLenum pname, void **params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetPointervANGLE, "context = %d, pname = %s, params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::AllEnums, pname), (uintptr_t)params);
@@ -622,6 +640,9 @@ void GL_APIENTRY GL_CopyTexture3DANGLE(GLuint sourceId,
                                        GLboolean unpackPremultiplyAlpha,
                                        GLboolean unpackUnmultiplyAlpha)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_CopyTexture3DANGLE, sourceId, sourceLevel, destTarget, destId,
+                                 destLevel, internalFormat, destType, unpackFlipY,
+                                 unpackPremultiplyAlpha, unpackUnmultiplyAlpha);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLCopyTexture3DANGLE,
           "context = %d, sourceId = %u, sourceLevel = %d, destTarget = %s, destId = %u, destLevel "
@@ -682,6 +703,10 @@ void GL_APIENTRY GL_CopySubTexture3DANGLE(GLuint sourceId,
                                           GLboolean unpackPremultiplyAlpha,
                                           GLboolean unpackUnmultiplyAlpha)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_CopySubTexture3DANGLE, sourceId, sourceLevel, destTarget,
+                                 destId, destLevel, xoffset, yoffset, zoffset, x, y, z, width,
+                                 height, depth, unpackFlipY, unpackPremultiplyAlpha,
+                                 unpackUnmultiplyAlpha);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLCopySubTexture3DANGLE,
           "context = %d, sourceId = %u, sourceLevel = %d, destTarget = %s, destId = %u, destLevel "
@@ -742,6 +767,8 @@ void GL_APIENTRY GL_BlitFramebufferANGLE(GLint srcX0,
                                          GLbitfield mask,
                                          GLenum filter)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_BlitFramebufferANGLE, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0,
+                                 dstX1, dstY1, mask, filter);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBlitFramebufferANGLE,
           "context = %d, srcX0 = %d, srcY0 = %d, srcX1 = %d, srcY1 = %d, dstX0 = %d, dstY0 = %d, "
@@ -783,6 +810,8 @@ void GL_APIENTRY GL_RenderbufferStorageMultisampleANGLE(GLenum target,
                                                         GLsizei width,
                                                         GLsizei height)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_RenderbufferStorageMultisampleANGLE, target, samples,
+                                 internalformat, width, height);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLRenderbufferStorageMultisampleANGLE,
           "context = %d, target = %s, samples = %d, internalformat = %s, width = %d, height = %d",
@@ -818,6 +847,7 @@ void GL_APIENTRY GL_RenderbufferStorageMultisampleANGLE(GLenum target,
 void GL_APIENTRY
 GL_GetTexImageANGLE(GLenum target, GLint level, GLenum format, GLenum type, void *pixels)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetTexImageANGLE,
           "context = %d, target = %s, level = %d, format = %s, type = %s, pixels = 0x%016" PRIxPTR
@@ -849,6 +879,7 @@ GL_GetTexImageANGLE(GLenum target, GLint level, GLenum format, GLenum type, void
 
 void GL_APIENTRY GL_GetCompressedTexImageANGLE(GLenum target, GLint level, void *pixels)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetCompressedTexImageANGLE,
           "context = %d, target = %s, level = %d, pixels = 0x%016" PRIxPTR "", CID(context),
@@ -881,6 +912,7 @@ void GL_APIENTRY GL_GetRenderbufferImageANGLE(GLenum target,
                                               GLenum type,
                                               void *pixels)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetRenderbufferImageANGLE,
           "context = %d, target = %s, format = %s, type = %s, pixels = 0x%016" PRIxPTR "",
@@ -917,6 +949,7 @@ void GL_APIENTRY GL_GetTexLevelParameterivANGLE(GLenum target,
                                                 GLenum pname,
                                                 GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetTexLevelParameterivANGLE,
           "context = %d, target = %s, level = %d, pname = %s, params = 0x%016" PRIxPTR "",
@@ -950,6 +983,7 @@ void GL_APIENTRY GL_GetTexLevelParameterfvANGLE(GLenum target,
                                                 GLenum pname,
                                                 GLfloat *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetTexLevelParameterfvANGLE,
           "context = %d, target = %s, level = %d, pname = %s, params = 0x%016" PRIxPTR "",
@@ -984,6 +1018,7 @@ void GL_APIENTRY GL_DrawArraysInstancedANGLE(GLenum mode,
                                              GLsizei count,
                                              GLsizei primcount)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE_DRAW(GL_DrawArraysInstancedANGLE, mode, first, count, primcount);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDrawArraysInstancedANGLE,
           "context = %d, mode = %s, first = %d, count = %d, primcount = %d", CID(context),
@@ -1017,6 +1052,7 @@ void GL_APIENTRY GL_DrawElementsInstancedANGLE(GLenum mode,
                                                const void *indices,
                                                GLsizei primcount)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDrawElementsInstancedANGLE,
           "context = %d, mode = %s, count = %d, type = %s, indices = 0x%016" PRIxPTR
@@ -1049,6 +1085,7 @@ void GL_APIENTRY GL_DrawElementsInstancedANGLE(GLenum mode,
 
 void GL_APIENTRY GL_VertexAttribDivisorANGLE(GLuint index, GLuint divisor)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_VertexAttribDivisorANGLE, index, divisor);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertexAttribDivisorANGLE, "context = %d, index = %u, divisor = %u",
           CID(context), index, divisor);
@@ -1076,6 +1113,7 @@ void GL_APIENTRY GL_VertexAttribDivisorANGLE(GLuint index, GLuint divisor)
 // GL_ANGLE_logic_op
 void GL_APIENTRY GL_LogicOpANGLE(GLenum opcode)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_LogicOpANGLE, opcode);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLLogicOpANGLE, "context = %d, opcode = %s", CID(context),
           GLenumToString(GLESEnum::LogicOp, opcode));
@@ -1119,6 +1157,7 @@ void GL_APIENTRY GL_TexStorageMemFlags2DANGLE(GLenum target,
                                               GLbitfield usageFlags,
                                               const void *imageCreateInfoPNext)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexStorageMemFlags2DANGLE,
           "context = %d, target = %s, levels = %d, internalFormat = %s, width = %d, height = %d, "
@@ -1174,6 +1213,7 @@ void GL_APIENTRY GL_TexStorageMemFlags2DMultisampleANGLE(GLenum target,
                                                          GLbitfield usageFlags,
                                                          const void *imageCreateInfoPNext)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexStorageMemFlags2DMultisampleANGLE,
           "context = %d, target = %s, samples = %d, internalFormat = %s, width = %d, height = %d, "
@@ -1229,6 +1269,7 @@ void GL_APIENTRY GL_TexStorageMemFlags3DANGLE(GLenum target,
                                               GLbitfield usageFlags,
                                               const void *imageCreateInfoPNext)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexStorageMemFlags3DANGLE,
           "context = %d, target = %s, levels = %d, internalFormat = %s, width = %d, height = %d, "
@@ -1285,6 +1326,7 @@ void GL_APIENTRY GL_TexStorageMemFlags3DMultisampleANGLE(GLenum target,
                                                          GLbitfield usageFlags,
                                                          const void *imageCreateInfoPNext)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexStorageMemFlags3DMultisampleANGLE,
           "context = %d, target = %s, samples = %d, internalFormat = %s, width = %d, height = %d, "
@@ -1334,6 +1376,8 @@ void GL_APIENTRY GL_ImportMemoryZirconHandleANGLE(GLuint memory,
                                                   GLenum handleType,
                                                   GLuint handle)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_ImportMemoryZirconHandleANGLE, memory, size, handleType,
+                                 handle);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLImportMemoryZirconHandleANGLE,
           "context = %d, memory = %u, size = %llu, handleType = %s, handle = %u", CID(context),
@@ -1375,6 +1419,7 @@ void GL_APIENTRY GL_MultiDrawArraysANGLE(GLenum mode,
                                          const GLsizei *counts,
                                          GLsizei drawcount)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLMultiDrawArraysANGLE,
           "context = %d, mode = %s, firsts = 0x%016" PRIxPTR ", counts = 0x%016" PRIxPTR
@@ -1413,6 +1458,7 @@ void GL_APIENTRY GL_MultiDrawArraysInstancedANGLE(GLenum mode,
                                                   const GLsizei *instanceCounts,
                                                   GLsizei drawcount)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLMultiDrawArraysInstancedANGLE,
           "context = %d, mode = %s, firsts = 0x%016" PRIxPTR ", counts = 0x%016" PRIxPTR
@@ -1453,6 +1499,7 @@ void GL_APIENTRY GL_MultiDrawElementsANGLE(GLenum mode,
                                            const void *const *indices,
                                            GLsizei drawcount)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLMultiDrawElementsANGLE,
           "context = %d, mode = %s, counts = 0x%016" PRIxPTR ", type = %s, indices = 0x%016" PRIxPTR
@@ -1493,6 +1540,7 @@ void GL_APIENTRY GL_MultiDrawElementsInstancedANGLE(GLenum mode,
                                                     const GLsizei *instanceCounts,
                                                     GLsizei drawcount)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLMultiDrawElementsInstancedANGLE,
           "context = %d, mode = %s, counts = 0x%016" PRIxPTR ", type = %s, indices = 0x%016" PRIxPTR
@@ -1534,6 +1582,7 @@ void GL_APIENTRY GL_MultiDrawElementsInstancedANGLE(GLenum mode,
 // GL_ANGLE_polygon_mode
 void GL_APIENTRY GL_PolygonModeANGLE(GLenum face, GLenum mode)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_PolygonModeANGLE, face, mode);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPolygonModeANGLE, "context = %d, face = %s, mode = %s", CID(context),
           GLenumToString(GLESEnum::TriangleFace, face),
@@ -1570,6 +1619,7 @@ void GL_APIENTRY GL_PolygonModeANGLE(GLenum face, GLenum mode)
 // GL_ANGLE_provoking_vertex
 void GL_APIENTRY GL_ProvokingVertexANGLE(GLenum provokeMode)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_ProvokingVertexANGLE, provokeMode);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProvokingVertexANGLE, "context = %d, provokeMode = %s", CID(context),
           GLenumToString(GLESEnum::VertexProvokingMode, provokeMode));
@@ -1603,6 +1653,7 @@ void GL_APIENTRY GL_ProvokingVertexANGLE(GLenum provokeMode)
 // GL_ANGLE_request_extension
 void GL_APIENTRY GL_RequestExtensionANGLE(const GLchar *name)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLRequestExtensionANGLE, "context = %d, name = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)name);
@@ -1632,6 +1683,7 @@ void GL_APIENTRY GL_RequestExtensionANGLE(const GLchar *name)
 
 void GL_APIENTRY GL_DisableExtensionANGLE(const GLchar *name)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDisableExtensionANGLE, "context = %d, name = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)name);
@@ -1667,6 +1719,7 @@ void GL_APIENTRY GL_GetBooleanvRobustANGLE(GLenum pname,
                                            GLsizei *length,
                                            GLboolean *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetBooleanvRobustANGLE,
           "context = %d, pname = %s, bufSize = %d, length = 0x%016" PRIxPTR
@@ -1701,6 +1754,7 @@ void GL_APIENTRY GL_GetBufferParameterivRobustANGLE(GLenum target,
                                                     GLsizei *length,
                                                     GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetBufferParameterivRobustANGLE,
           "context = %d, target = %s, pname = %s, bufSize = %d, length = 0x%016" PRIxPTR
@@ -1735,6 +1789,7 @@ void GL_APIENTRY GL_GetFloatvRobustANGLE(GLenum pname,
                                          GLsizei *length,
                                          GLfloat *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetFloatvRobustANGLE,
           "context = %d, pname = %s, bufSize = %d, length = 0x%016" PRIxPTR
@@ -1770,6 +1825,7 @@ void GL_APIENTRY GL_GetFramebufferAttachmentParameterivRobustANGLE(GLenum target
                                                                    GLsizei *length,
                                                                    GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetFramebufferAttachmentParameterivRobustANGLE,
           "context = %d, target = %s, attachment = %s, pname = %s, bufSize = %d, length = "
@@ -1806,6 +1862,7 @@ void GL_APIENTRY GL_GetIntegervRobustANGLE(GLenum pname,
                                            GLsizei *length,
                                            GLint *data)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetIntegervRobustANGLE,
           "context = %d, pname = %s, bufSize = %d, length = 0x%016" PRIxPTR
@@ -1840,6 +1897,7 @@ void GL_APIENTRY GL_GetProgramivRobustANGLE(GLuint program,
                                             GLsizei *length,
                                             GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetGlobalContext();
     EVENT(context, GLGetProgramivRobustANGLE,
           "context = %d, program = %u, pname = %s, bufSize = %d, length = 0x%016" PRIxPTR
@@ -1874,6 +1932,7 @@ void GL_APIENTRY GL_GetRenderbufferParameterivRobustANGLE(GLenum target,
                                                           GLsizei *length,
                                                           GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetRenderbufferParameterivRobustANGLE,
           "context = %d, target = %s, pname = %s, bufSize = %d, length = 0x%016" PRIxPTR
@@ -1908,6 +1967,7 @@ void GL_APIENTRY GL_GetShaderivRobustANGLE(GLuint shader,
                                            GLsizei *length,
                                            GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetGlobalContext();
     EVENT(context, GLGetShaderivRobustANGLE,
           "context = %d, shader = %u, pname = %s, bufSize = %d, length = 0x%016" PRIxPTR
@@ -1942,6 +2002,7 @@ void GL_APIENTRY GL_GetTexParameterfvRobustANGLE(GLenum target,
                                                  GLsizei *length,
                                                  GLfloat *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetTexParameterfvRobustANGLE,
           "context = %d, target = %s, pname = %s, bufSize = %d, length = 0x%016" PRIxPTR
@@ -1977,6 +2038,7 @@ void GL_APIENTRY GL_GetTexParameterivRobustANGLE(GLenum target,
                                                  GLsizei *length,
                                                  GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetTexParameterivRobustANGLE,
           "context = %d, target = %s, pname = %s, bufSize = %d, length = 0x%016" PRIxPTR
@@ -2012,6 +2074,7 @@ void GL_APIENTRY GL_GetUniformfvRobustANGLE(GLuint program,
                                             GLsizei *length,
                                             GLfloat *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetUniformfvRobustANGLE,
           "context = %d, program = %u, location = %d, bufSize = %d, length = 0x%016" PRIxPTR
@@ -2047,6 +2110,7 @@ void GL_APIENTRY GL_GetUniformivRobustANGLE(GLuint program,
                                             GLsizei *length,
                                             GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetUniformivRobustANGLE,
           "context = %d, program = %u, location = %d, bufSize = %d, length = 0x%016" PRIxPTR
@@ -2082,6 +2146,7 @@ void GL_APIENTRY GL_GetVertexAttribfvRobustANGLE(GLuint index,
                                                  GLsizei *length,
                                                  GLfloat *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetVertexAttribfvRobustANGLE,
           "context = %d, index = %u, pname = %s, bufSize = %d, length = 0x%016" PRIxPTR
@@ -2116,6 +2181,7 @@ void GL_APIENTRY GL_GetVertexAttribivRobustANGLE(GLuint index,
                                                  GLsizei *length,
                                                  GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetVertexAttribivRobustANGLE,
           "context = %d, index = %u, pname = %s, bufSize = %d, length = 0x%016" PRIxPTR
@@ -2150,6 +2216,7 @@ void GL_APIENTRY GL_GetVertexAttribPointervRobustANGLE(GLuint index,
                                                        GLsizei *length,
                                                        void **pointer)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetVertexAttribPointervRobustANGLE,
           "context = %d, index = %u, pname = %s, bufSize = %d, length = 0x%016" PRIxPTR
@@ -2190,6 +2257,7 @@ void GL_APIENTRY GL_ReadPixelsRobustANGLE(GLint x,
                                           GLsizei *rows,
                                           void *pixels)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLReadPixelsRobustANGLE,
           "context = %d, x = %d, y = %d, width = %d, height = %d, format = %s, type = %s, bufSize "
@@ -2236,6 +2304,7 @@ void GL_APIENTRY GL_TexImage2DRobustANGLE(GLenum target,
                                           GLsizei bufSize,
                                           const void *pixels)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexImage2DRobustANGLE,
           "context = %d, target = %s, level = %d, internalformat = %d, width = %d, height = %d, "
@@ -2276,6 +2345,7 @@ void GL_APIENTRY GL_TexParameterfvRobustANGLE(GLenum target,
                                               GLsizei bufSize,
                                               const GLfloat *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexParameterfvRobustANGLE,
           "context = %d, target = %s, pname = %s, bufSize = %d, params = 0x%016" PRIxPTR "",
@@ -2309,6 +2379,7 @@ void GL_APIENTRY GL_TexParameterivRobustANGLE(GLenum target,
                                               GLsizei bufSize,
                                               const GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexParameterivRobustANGLE,
           "context = %d, target = %s, pname = %s, bufSize = %d, params = 0x%016" PRIxPTR "",
@@ -2348,6 +2419,7 @@ void GL_APIENTRY GL_TexSubImage2DRobustANGLE(GLenum target,
                                              GLsizei bufSize,
                                              const void *pixels)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexSubImage2DRobustANGLE,
           "context = %d, target = %s, level = %d, xoffset = %d, yoffset = %d, width = %d, height = "
@@ -2395,6 +2467,7 @@ void GL_APIENTRY GL_TexImage3DRobustANGLE(GLenum target,
                                           GLsizei bufSize,
                                           const void *pixels)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexImage3DRobustANGLE,
           "context = %d, target = %s, level = %d, internalformat = %d, width = %d, height = %d, "
@@ -2445,6 +2518,7 @@ void GL_APIENTRY GL_TexSubImage3DRobustANGLE(GLenum target,
                                              GLsizei bufSize,
                                              const void *pixels)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(
         context, GLTexSubImage3DRobustANGLE,
@@ -2493,6 +2567,7 @@ void GL_APIENTRY GL_CompressedTexImage2DRobustANGLE(GLenum target,
                                                     GLsizei dataSize,
                                                     const void *data)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLCompressedTexImage2DRobustANGLE,
           "context = %d, target = %s, level = %d, internalformat = %s, width = %d, height = %d, "
@@ -2539,6 +2614,7 @@ void GL_APIENTRY GL_CompressedTexSubImage2DRobustANGLE(GLenum target,
                                                        GLsizei dataSize,
                                                        const void *data)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLCompressedTexSubImage2DRobustANGLE,
           "context = %d, target = %s, level = %d, xoffset = %d, yoffset = %d, width = %d, height = "
@@ -2584,6 +2660,7 @@ void GL_APIENTRY GL_CompressedTexImage3DRobustANGLE(GLenum target,
                                                     GLsizei dataSize,
                                                     const void *data)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLCompressedTexImage3DRobustANGLE,
           "context = %d, target = %s, level = %d, internalformat = %s, width = %d, height = %d, "
@@ -2632,6 +2709,7 @@ void GL_APIENTRY GL_CompressedTexSubImage3DRobustANGLE(GLenum target,
                                                        GLsizei dataSize,
                                                        const void *data)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLCompressedTexSubImage3DRobustANGLE,
           "context = %d, target = %s, level = %d, xoffset = %d, yoffset = %d, zoffset = %d, width "
@@ -2677,6 +2755,7 @@ void GL_APIENTRY GL_GetQueryivRobustANGLE(GLenum target,
                                           GLsizei *length,
                                           GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetQueryivRobustANGLE,
           "context = %d, target = %s, pname = %s, bufSize = %d, length = 0x%016" PRIxPTR
@@ -2712,6 +2791,7 @@ void GL_APIENTRY GL_GetQueryObjectuivRobustANGLE(GLuint id,
                                                  GLsizei *length,
                                                  GLuint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetQueryObjectuivRobustANGLE,
           "context = %d, id = %u, pname = %s, bufSize = %d, length = 0x%016" PRIxPTR
@@ -2747,6 +2827,7 @@ void GL_APIENTRY GL_GetBufferPointervRobustANGLE(GLenum target,
                                                  GLsizei *length,
                                                  void **params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetBufferPointervRobustANGLE,
           "context = %d, target = %s, pname = %s, bufSize = %d, length = 0x%016" PRIxPTR
@@ -2782,6 +2863,7 @@ void GL_APIENTRY GL_GetIntegeri_vRobustANGLE(GLenum target,
                                              GLsizei *length,
                                              GLint *data)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetIntegeri_vRobustANGLE,
           "context = %d, target = %s, index = %u, bufSize = %d, length = 0x%016" PRIxPTR
@@ -2817,6 +2899,7 @@ void GL_APIENTRY GL_GetInternalformativRobustANGLE(GLenum target,
                                                    GLsizei *length,
                                                    GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetInternalformativRobustANGLE,
           "context = %d, target = %s, internalformat = %s, pname = %s, bufSize = %d, length = "
@@ -2853,6 +2936,7 @@ void GL_APIENTRY GL_GetVertexAttribIivRobustANGLE(GLuint index,
                                                   GLsizei *length,
                                                   GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetVertexAttribIivRobustANGLE,
           "context = %d, index = %u, pname = %s, bufSize = %d, length = 0x%016" PRIxPTR
@@ -2887,6 +2971,7 @@ void GL_APIENTRY GL_GetVertexAttribIuivRobustANGLE(GLuint index,
                                                    GLsizei *length,
                                                    GLuint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetVertexAttribIuivRobustANGLE,
           "context = %d, index = %u, pname = %s, bufSize = %d, length = 0x%016" PRIxPTR
@@ -2921,6 +3006,7 @@ void GL_APIENTRY GL_GetUniformuivRobustANGLE(GLuint program,
                                              GLsizei *length,
                                              GLuint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetUniformuivRobustANGLE,
           "context = %d, program = %u, location = %d, bufSize = %d, length = 0x%016" PRIxPTR
@@ -2957,6 +3043,7 @@ void GL_APIENTRY GL_GetActiveUniformBlockivRobustANGLE(GLuint program,
                                                        GLsizei *length,
                                                        GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetActiveUniformBlockivRobustANGLE,
           "context = %d, program = %u, uniformBlockIndex = %u, pname = %s, bufSize = %d, length = "
@@ -2994,6 +3081,7 @@ void GL_APIENTRY GL_GetInteger64vRobustANGLE(GLenum pname,
                                              GLsizei *length,
                                              GLint64 *data)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetInteger64vRobustANGLE,
           "context = %d, pname = %s, bufSize = %d, length = 0x%016" PRIxPTR
@@ -3028,6 +3116,7 @@ void GL_APIENTRY GL_GetInteger64i_vRobustANGLE(GLenum target,
                                                GLsizei *length,
                                                GLint64 *data)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetInteger64i_vRobustANGLE,
           "context = %d, target = %s, index = %u, bufSize = %d, length = 0x%016" PRIxPTR
@@ -3062,6 +3151,7 @@ void GL_APIENTRY GL_GetBufferParameteri64vRobustANGLE(GLenum target,
                                                       GLsizei *length,
                                                       GLint64 *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetBufferParameteri64vRobustANGLE,
           "context = %d, target = %s, pname = %s, bufSize = %d, length = 0x%016" PRIxPTR
@@ -3096,6 +3186,7 @@ void GL_APIENTRY GL_SamplerParameterivRobustANGLE(GLuint sampler,
                                                   GLsizei bufSize,
                                                   const GLint *param)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLSamplerParameterivRobustANGLE,
           "context = %d, sampler = %u, pname = %u, bufSize = %d, param = 0x%016" PRIxPTR "",
@@ -3128,6 +3219,7 @@ void GL_APIENTRY GL_SamplerParameterfvRobustANGLE(GLuint sampler,
                                                   GLsizei bufSize,
                                                   const GLfloat *param)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLSamplerParameterfvRobustANGLE,
           "context = %d, sampler = %u, pname = %s, bufSize = %d, param = 0x%016" PRIxPTR "",
@@ -3162,6 +3254,7 @@ void GL_APIENTRY GL_GetSamplerParameterivRobustANGLE(GLuint sampler,
                                                      GLsizei *length,
                                                      GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetSamplerParameterivRobustANGLE,
           "context = %d, sampler = %u, pname = %s, bufSize = %d, length = 0x%016" PRIxPTR
@@ -3197,6 +3290,7 @@ void GL_APIENTRY GL_GetSamplerParameterfvRobustANGLE(GLuint sampler,
                                                      GLsizei *length,
                                                      GLfloat *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetSamplerParameterfvRobustANGLE,
           "context = %d, sampler = %u, pname = %s, bufSize = %d, length = 0x%016" PRIxPTR
@@ -3232,6 +3326,7 @@ void GL_APIENTRY GL_GetFramebufferParameterivRobustANGLE(GLenum target,
                                                          GLsizei *length,
                                                          GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetFramebufferParameterivRobustANGLE,
           "context = %d, target = %s, pname = %s, bufSize = %d, length = 0x%016" PRIxPTR
@@ -3267,6 +3362,7 @@ void GL_APIENTRY GL_GetProgramInterfaceivRobustANGLE(GLuint program,
                                                      GLsizei *length,
                                                      GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetProgramInterfaceivRobustANGLE,
           "context = %d, program = %u, programInterface = %s, pname = %s, bufSize = %d, length = "
@@ -3303,6 +3399,7 @@ void GL_APIENTRY GL_GetBooleani_vRobustANGLE(GLenum target,
                                              GLsizei *length,
                                              GLboolean *data)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetBooleani_vRobustANGLE,
           "context = %d, target = %s, index = %u, bufSize = %d, length = 0x%016" PRIxPTR
@@ -3337,6 +3434,7 @@ void GL_APIENTRY GL_GetMultisamplefvRobustANGLE(GLenum pname,
                                                 GLsizei *length,
                                                 GLfloat *val)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetMultisamplefvRobustANGLE,
           "context = %d, pname = %s, index = %u, bufSize = %d, length = 0x%016" PRIxPTR
@@ -3372,6 +3470,7 @@ void GL_APIENTRY GL_GetTexLevelParameterivRobustANGLE(GLenum target,
                                                       GLsizei *length,
                                                       GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetTexLevelParameterivRobustANGLE,
           "context = %d, target = %s, level = %d, pname = %s, bufSize = %d, length = 0x%016" PRIxPTR
@@ -3409,6 +3508,7 @@ void GL_APIENTRY GL_GetTexLevelParameterfvRobustANGLE(GLenum target,
                                                       GLsizei *length,
                                                       GLfloat *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetTexLevelParameterfvRobustANGLE,
           "context = %d, target = %s, level = %d, pname = %s, bufSize = %d, length = 0x%016" PRIxPTR
@@ -3444,6 +3544,7 @@ void GL_APIENTRY GL_GetPointervRobustANGLERobustANGLE(GLenum pname,
                                                       GLsizei *length,
                                                       void **params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetPointervRobustANGLERobustANGLE,
           "context = %d, pname = %s, bufSize = %d, length = 0x%016" PRIxPTR
@@ -3484,6 +3585,7 @@ void GL_APIENTRY GL_ReadnPixelsRobustANGLE(GLint x,
                                            GLsizei *rows,
                                            void *data)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLReadnPixelsRobustANGLE,
           "context = %d, x = %d, y = %d, width = %d, height = %d, format = %s, type = %s, bufSize "
@@ -3525,6 +3627,7 @@ void GL_APIENTRY GL_GetnUniformfvRobustANGLE(GLuint program,
                                              GLsizei *length,
                                              GLfloat *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetnUniformfvRobustANGLE,
           "context = %d, program = %u, location = %d, bufSize = %d, length = 0x%016" PRIxPTR
@@ -3560,6 +3663,7 @@ void GL_APIENTRY GL_GetnUniformivRobustANGLE(GLuint program,
                                              GLsizei *length,
                                              GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetnUniformivRobustANGLE,
           "context = %d, program = %u, location = %d, bufSize = %d, length = 0x%016" PRIxPTR
@@ -3595,6 +3699,7 @@ void GL_APIENTRY GL_GetnUniformuivRobustANGLE(GLuint program,
                                               GLsizei *length,
                                               GLuint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetnUniformuivRobustANGLE,
           "context = %d, program = %u, location = %d, bufSize = %d, length = 0x%016" PRIxPTR
@@ -3629,6 +3734,7 @@ void GL_APIENTRY GL_TexParameterIivRobustANGLE(GLenum target,
                                                GLsizei bufSize,
                                                const GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexParameterIivRobustANGLE,
           "context = %d, target = %s, pname = %s, bufSize = %d, params = 0x%016" PRIxPTR "",
@@ -3662,6 +3768,7 @@ void GL_APIENTRY GL_TexParameterIuivRobustANGLE(GLenum target,
                                                 GLsizei bufSize,
                                                 const GLuint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexParameterIuivRobustANGLE,
           "context = %d, target = %s, pname = %s, bufSize = %d, params = 0x%016" PRIxPTR "",
@@ -3696,6 +3803,7 @@ void GL_APIENTRY GL_GetTexParameterIivRobustANGLE(GLenum target,
                                                   GLsizei *length,
                                                   GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetTexParameterIivRobustANGLE,
           "context = %d, target = %s, pname = %s, bufSize = %d, length = 0x%016" PRIxPTR
@@ -3731,6 +3839,7 @@ void GL_APIENTRY GL_GetTexParameterIuivRobustANGLE(GLenum target,
                                                    GLsizei *length,
                                                    GLuint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetTexParameterIuivRobustANGLE,
           "context = %d, target = %s, pname = %s, bufSize = %d, length = 0x%016" PRIxPTR
@@ -3765,6 +3874,7 @@ void GL_APIENTRY GL_SamplerParameterIivRobustANGLE(GLuint sampler,
                                                    GLsizei bufSize,
                                                    const GLint *param)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLSamplerParameterIivRobustANGLE,
           "context = %d, sampler = %u, pname = %s, bufSize = %d, param = 0x%016" PRIxPTR "",
@@ -3798,6 +3908,7 @@ void GL_APIENTRY GL_SamplerParameterIuivRobustANGLE(GLuint sampler,
                                                     GLsizei bufSize,
                                                     const GLuint *param)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLSamplerParameterIuivRobustANGLE,
           "context = %d, sampler = %u, pname = %s, bufSize = %d, param = 0x%016" PRIxPTR "",
@@ -3832,6 +3943,7 @@ void GL_APIENTRY GL_GetSamplerParameterIivRobustANGLE(GLuint sampler,
                                                       GLsizei *length,
                                                       GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetSamplerParameterIivRobustANGLE,
           "context = %d, sampler = %u, pname = %s, bufSize = %d, length = 0x%016" PRIxPTR
@@ -3867,6 +3979,7 @@ void GL_APIENTRY GL_GetSamplerParameterIuivRobustANGLE(GLuint sampler,
                                                        GLsizei *length,
                                                        GLuint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetSamplerParameterIuivRobustANGLE,
           "context = %d, sampler = %u, pname = %s, bufSize = %d, length = 0x%016" PRIxPTR
@@ -3902,6 +4015,7 @@ void GL_APIENTRY GL_GetQueryObjectivRobustANGLE(GLuint id,
                                                 GLsizei *length,
                                                 GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetGlobalContext();
     EVENT(context, GLGetQueryObjectivRobustANGLE,
           "context = %d, id = %u, pname = %s, bufSize = %d, length = 0x%016" PRIxPTR
@@ -3936,6 +4050,7 @@ void GL_APIENTRY GL_GetQueryObjecti64vRobustANGLE(GLuint id,
                                                   GLsizei *length,
                                                   GLint64 *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetGlobalContext();
     EVENT(context, GLGetQueryObjecti64vRobustANGLE,
           "context = %d, id = %u, pname = %s, bufSize = %d, length = 0x%016" PRIxPTR
@@ -3970,6 +4085,7 @@ void GL_APIENTRY GL_GetQueryObjectui64vRobustANGLE(GLuint id,
                                                    GLsizei *length,
                                                    GLuint64 *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetQueryObjectui64vRobustANGLE,
           "context = %d, id = %u, pname = %s, bufSize = %d, length = 0x%016" PRIxPTR
@@ -4008,6 +4124,8 @@ void GL_APIENTRY GL_ImportSemaphoreZirconHandleANGLE(GLuint semaphore,
                                                      GLenum handleType,
                                                      GLuint handle)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_ImportSemaphoreZirconHandleANGLE, semaphore, handleType,
+                                 handle);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLImportSemaphoreZirconHandleANGLE,
           "context = %d, semaphore = %u, handleType = %s, handle = %u", CID(context), semaphore,
@@ -4045,6 +4163,8 @@ void GL_APIENTRY GL_ImportSemaphoreZirconHandleANGLE(GLuint semaphore,
 // GL_ANGLE_shader_pixel_local_storage
 void GL_APIENTRY GL_FramebufferMemorylessPixelLocalStorageANGLE(GLint plane, GLenum internalformat)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_FramebufferMemorylessPixelLocalStorageANGLE, plane,
+                                 internalformat);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLFramebufferMemorylessPixelLocalStorageANGLE,
           "context = %d, plane = %d, internalformat = %s", CID(context), plane,
@@ -4080,6 +4200,8 @@ void GL_APIENTRY GL_FramebufferTexturePixelLocalStorageANGLE(GLint plane,
                                                              GLint level,
                                                              GLint layer)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_FramebufferTexturePixelLocalStorageANGLE, plane, backingtexture,
+                                 level, layer);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLFramebufferTexturePixelLocalStorageANGLE,
           "context = %d, plane = %d, backingtexture = %u, level = %d, layer = %d", CID(context),
@@ -4113,6 +4235,7 @@ void GL_APIENTRY GL_FramebufferTexturePixelLocalStorageANGLE(GLint plane,
 
 void GL_APIENTRY GL_FramebufferPixelLocalClearValuefvANGLE(GLint plane, const GLfloat *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLFramebufferPixelLocalClearValuefvANGLE,
           "context = %d, plane = %d, value = 0x%016" PRIxPTR "", CID(context), plane,
@@ -4145,6 +4268,7 @@ void GL_APIENTRY GL_FramebufferPixelLocalClearValuefvANGLE(GLint plane, const GL
 
 void GL_APIENTRY GL_FramebufferPixelLocalClearValueivANGLE(GLint plane, const GLint *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLFramebufferPixelLocalClearValueivANGLE,
           "context = %d, plane = %d, value = 0x%016" PRIxPTR "", CID(context), plane,
@@ -4177,6 +4301,7 @@ void GL_APIENTRY GL_FramebufferPixelLocalClearValueivANGLE(GLint plane, const GL
 
 void GL_APIENTRY GL_FramebufferPixelLocalClearValueuivANGLE(GLint plane, const GLuint *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLFramebufferPixelLocalClearValueuivANGLE,
           "context = %d, plane = %d, value = 0x%016" PRIxPTR "", CID(context), plane,
@@ -4209,6 +4334,7 @@ void GL_APIENTRY GL_FramebufferPixelLocalClearValueuivANGLE(GLint plane, const G
 
 void GL_APIENTRY GL_BeginPixelLocalStorageANGLE(GLsizei n, const GLenum *loadops)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBeginPixelLocalStorageANGLE,
           "context = %d, n = %d, loadops = 0x%016" PRIxPTR "", CID(context), n, (uintptr_t)loadops);
@@ -4238,6 +4364,7 @@ void GL_APIENTRY GL_BeginPixelLocalStorageANGLE(GLsizei n, const GLenum *loadops
 
 void GL_APIENTRY GL_EndPixelLocalStorageANGLE(GLsizei n, const GLenum *storeops)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLEndPixelLocalStorageANGLE,
           "context = %d, n = %d, storeops = 0x%016" PRIxPTR "", CID(context), n,
@@ -4265,6 +4392,7 @@ void GL_APIENTRY GL_EndPixelLocalStorageANGLE(GLsizei n, const GLenum *storeops)
 
 void GL_APIENTRY GL_PixelLocalStorageBarrierANGLE()
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_PixelLocalStorageBarrierANGLE);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPixelLocalStorageBarrierANGLE, "context = %d", CID(context));
 
@@ -4289,6 +4417,7 @@ void GL_APIENTRY GL_PixelLocalStorageBarrierANGLE()
 
 void GL_APIENTRY GL_FramebufferPixelLocalStorageInterruptANGLE()
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_FramebufferPixelLocalStorageInterruptANGLE);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLFramebufferPixelLocalStorageInterruptANGLE, "context = %d", CID(context));
 
@@ -4314,6 +4443,7 @@ void GL_APIENTRY GL_FramebufferPixelLocalStorageInterruptANGLE()
 
 void GL_APIENTRY GL_FramebufferPixelLocalStorageRestoreANGLE()
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_FramebufferPixelLocalStorageRestoreANGLE);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLFramebufferPixelLocalStorageRestoreANGLE, "context = %d", CID(context));
 
@@ -4344,6 +4474,7 @@ void GL_APIENTRY GL_GetFramebufferPixelLocalStorageParameterfvANGLE(GLint plane,
                                                                     GLenum pname,
                                                                     GLfloat *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetFramebufferPixelLocalStorageParameterfvANGLE,
           "context = %d, plane = %d, pname = %s, params = 0x%016" PRIxPTR "", CID(context), plane,
@@ -4375,6 +4506,7 @@ void GL_APIENTRY GL_GetFramebufferPixelLocalStorageParameterivANGLE(GLint plane,
                                                                     GLenum pname,
                                                                     GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetFramebufferPixelLocalStorageParameterivANGLE,
           "context = %d, plane = %d, pname = %s, params = 0x%016" PRIxPTR "", CID(context), plane,
@@ -4408,6 +4540,7 @@ void GL_APIENTRY GL_GetFramebufferPixelLocalStorageParameterfvRobustANGLE(GLint
                                                                           GLsizei *length,
                                                                           GLfloat *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetFramebufferPixelLocalStorageParameterfvRobustANGLE,
           "context = %d, plane = %d, pname = %s, bufSize = %d, length = 0x%016" PRIxPTR
@@ -4445,6 +4578,7 @@ void GL_APIENTRY GL_GetFramebufferPixelLocalStorageParameterivRobustANGLE(GLint
                                                                           GLsizei *length,
                                                                           GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetFramebufferPixelLocalStorageParameterivRobustANGLE,
           "context = %d, plane = %d, pname = %s, bufSize = %d, length = 0x%016" PRIxPTR
@@ -4492,6 +4626,8 @@ void GL_APIENTRY GL_TexImage2DExternalANGLE(GLenum target,
                                             GLenum format,
                                             GLenum type)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_TexImage2DExternalANGLE, target, level, internalformat, width,
+                                 height, border, format, type);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexImage2DExternalANGLE,
           "context = %d, target = %s, level = %d, internalformat = %d, width = %d, height = %d, "
@@ -4529,6 +4665,7 @@ void GL_APIENTRY GL_TexImage2DExternalANGLE(GLenum target,
 
 void GL_APIENTRY GL_InvalidateTextureANGLE(GLenum target)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_InvalidateTextureANGLE, target);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLInvalidateTextureANGLE, "context = %d, target = %s", CID(context),
           GLenumToString(GLESEnum::TextureTarget, target));
@@ -4565,6 +4702,8 @@ void GL_APIENTRY GL_TexStorage2DMultisampleANGLE(GLenum target,
                                                  GLsizei height,
                                                  GLboolean fixedsamplelocations)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_TexStorage2DMultisampleANGLE, target, samples, internalformat,
+                                 width, height, fixedsamplelocations);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexStorage2DMultisampleANGLE,
           "context = %d, target = %s, samples = %d, internalformat = %s, width = %d, height = %d, "
@@ -4602,6 +4741,7 @@ void GL_APIENTRY GL_TexStorage2DMultisampleANGLE(GLenum target,
 
 void GL_APIENTRY GL_GetMultisamplefvANGLE(GLenum pname, GLuint index, GLfloat *val)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetMultisamplefvANGLE,
           "context = %d, pname = %s, index = %u, val = 0x%016" PRIxPTR "", CID(context),
@@ -4629,6 +4769,7 @@ void GL_APIENTRY GL_GetMultisamplefvANGLE(GLenum pname, GLuint index, GLfloat *v
 
 void GL_APIENTRY GL_SampleMaskiANGLE(GLuint maskNumber, GLbitfield mask)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_SampleMaskiANGLE, maskNumber, mask);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLSampleMaskiANGLE, "context = %d, maskNumber = %u, mask = %s", CID(context),
           maskNumber, GLbitfieldToString(GLESEnum::AllEnums, mask).c_str());
@@ -4669,6 +4810,7 @@ void GL_APIENTRY GL_GetTranslatedShaderSourceANGLE(GLuint shader,
                                                    GLsizei *length,
                                                    GLchar *source)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetTranslatedShaderSourceANGLE,
           "context = %d, shader = %u, bufSize = %d, length = 0x%016" PRIxPTR
@@ -4702,6 +4844,7 @@ void GL_APIENTRY GL_AcquireTexturesANGLE(GLuint numTextures,
                                          const GLuint *textures,
                                          const GLenum *layouts)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLAcquireTexturesANGLE,
           "context = %d, numTextures = %u, textures = 0x%016" PRIxPTR ", layouts = 0x%016" PRIxPTR
@@ -4737,6 +4880,7 @@ void GL_APIENTRY GL_ReleaseTexturesANGLE(GLuint numTextures,
                                          const GLuint *textures,
                                          GLenum *layouts)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLReleaseTexturesANGLE,
           "context = %d, numTextures = %u, textures = 0x%016" PRIxPTR ", layouts = 0x%016" PRIxPTR
@@ -4794,6 +4938,7 @@ void GL_APIENTRY GL_ReleaseTexturesANGLE(GLuint numTextures,
 // GL_CHROMIUM_bind_uniform_location
 void GL_APIENTRY GL_BindUniformLocationCHROMIUM(GLuint program, GLint location, const GLchar *name)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBindUniformLocationCHROMIUM,
           "context = %d, program = %u, location = %d, name = 0x%016" PRIxPTR "", CID(context),
@@ -4829,6 +4974,7 @@ void GL_APIENTRY GL_BindUniformLocationCHROMIUM(GLuint program, GLint location,
 // GL_CHROMIUM_copy_compressed_texture
 void GL_APIENTRY GL_CompressedCopyTextureCHROMIUM(GLuint sourceId, GLuint destId)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_CompressedCopyTextureCHROMIUM, sourceId, destId);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLCompressedCopyTextureCHROMIUM, "context = %d, sourceId = %u, destId = %u",
           CID(context), sourceId, destId);
@@ -4872,6 +5018,9 @@ void GL_APIENTRY GL_CopyTextureCHROMIUM(GLuint sourceId,
                                         GLboolean unpackPremultiplyAlpha,
                                         GLboolean unpackUnmultiplyAlpha)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_CopyTextureCHROMIUM, sourceId, sourceLevel, destTarget, destId,
+                                 destLevel, internalFormat, destType, unpackFlipY,
+                                 unpackPremultiplyAlpha, unpackUnmultiplyAlpha);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLCopyTextureCHROMIUM,
           "context = %d, sourceId = %u, sourceLevel = %d, destTarget = %s, destId = %u, destLevel "
@@ -4929,6 +5078,9 @@ void GL_APIENTRY GL_CopySubTextureCHROMIUM(GLuint sourceId,
                                            GLboolean unpackPremultiplyAlpha,
                                            GLboolean unpackUnmultiplyAlpha)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_CopySubTextureCHROMIUM, sourceId, sourceLevel, destTarget,
+                                 destId, destLevel, xoffset, yoffset, x, y, width, height,
+                                 unpackFlipY, unpackPremultiplyAlpha, unpackUnmultiplyAlpha);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLCopySubTextureCHROMIUM,
           "context = %d, sourceId = %u, sourceLevel = %d, destTarget = %s, destId = %u, destLevel "
@@ -4973,6 +5125,7 @@ void GL_APIENTRY GL_CopySubTextureCHROMIUM(GLuint sourceId,
 // GL_CHROMIUM_framebuffer_mixed_samples
 void GL_APIENTRY GL_CoverageModulationCHROMIUM(GLenum components)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_CoverageModulationCHROMIUM, components);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLCoverageModulationCHROMIUM, "context = %d, components = %s", CID(context),
           GLenumToString(GLESEnum::AllEnums, components));
@@ -5004,6 +5157,7 @@ void GL_APIENTRY GL_CoverageModulationCHROMIUM(GLenum components)
 // GL_CHROMIUM_lose_context
 void GL_APIENTRY GL_LoseContextCHROMIUM(GLenum current, GLenum other)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_LoseContextCHROMIUM, current, other);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLLoseContextCHROMIUM, "context = %d, current = %s, other = %s", CID(context),
           GLenumToString(GLESEnum::GraphicsResetStatus, current),
@@ -5041,6 +5195,7 @@ void GL_APIENTRY GL_EGLImageTargetTexStorageEXT(GLenum target,
                                                 GLeglImageOES image,
                                                 const GLint *attrib_list)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLEGLImageTargetTexStorageEXT,
           "context = %d, target = %s, image = 0x%016" PRIxPTR ", attrib_list = 0x%016" PRIxPTR "",
@@ -5077,6 +5232,7 @@ void GL_APIENTRY GL_EGLImageTargetTextureStorageEXT(GLuint texture,
                                                     GLeglImageOES image,
                                                     const GLint *attrib_list)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLEGLImageTargetTextureStorageEXT,
           "context = %d, texture = %u, image = 0x%016" PRIxPTR ", attrib_list = 0x%016" PRIxPTR "",
@@ -5117,6 +5273,8 @@ void GL_APIENTRY GL_DrawArraysInstancedBaseInstanceEXT(GLenum mode,
                                                        GLsizei instancecount,
                                                        GLuint baseinstance)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE_DRAW(GL_DrawArraysInstancedBaseInstanceEXT, mode, first, count,
+                                      instancecount, baseinstance);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDrawArraysInstancedBaseInstanceEXT,
           "context = %d, mode = %s, first = %d, count = %d, instancecount = %d, baseinstance = %u",
@@ -5153,6 +5311,7 @@ void GL_APIENTRY GL_DrawElementsInstancedBaseInstanceEXT(GLenum mode,
                                                          GLsizei instancecount,
                                                          GLuint baseinstance)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDrawElementsInstancedBaseInstanceEXT,
           "context = %d, mode = %s, count = %d, type = %s, indices = 0x%016" PRIxPTR
@@ -5194,6 +5353,7 @@ void GL_APIENTRY GL_DrawElementsInstancedBaseVertexBaseInstanceEXT(GLenum mode,
                                                                    GLint basevertex,
                                                                    GLuint baseinstance)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDrawElementsInstancedBaseVertexBaseInstanceEXT,
           "context = %d, mode = %s, count = %d, type = %s, indices = 0x%016" PRIxPTR
@@ -5231,6 +5391,7 @@ void GL_APIENTRY GL_DrawElementsInstancedBaseVertexBaseInstanceEXT(GLenum mode,
 // GL_EXT_blend_func_extended
 void GL_APIENTRY GL_BindFragDataLocationEXT(GLuint program, GLuint color, const GLchar *name)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBindFragDataLocationEXT,
           "context = %d, program = %u, color = %u, name = 0x%016" PRIxPTR "", CID(context), program,
@@ -5265,6 +5426,7 @@ void GL_APIENTRY GL_BindFragDataLocationIndexedEXT(GLuint program,
                                                    GLuint index,
                                                    const GLchar *name)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBindFragDataLocationIndexedEXT,
           "context = %d, program = %u, colorNumber = %u, index = %u, name = 0x%016" PRIxPTR "",
@@ -5298,6 +5460,7 @@ void GL_APIENTRY GL_BindFragDataLocationIndexedEXT(GLuint program,
 
 GLint GL_APIENTRY GL_GetFragDataIndexEXT(GLuint program, const GLchar *name)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetFragDataIndexEXT, "context = %d, program = %u, name = 0x%016" PRIxPTR "",
           CID(context), program, (uintptr_t)name);
@@ -5335,6 +5498,7 @@ GLint GL_APIENTRY GL_GetProgramResourceLocationIndexEXT(GLuint program,
                                                         GLenum programInterface,
                                                         const GLchar *name)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetProgramResourceLocationIndexEXT,
           "context = %d, program = %u, programInterface = %s, name = 0x%016" PRIxPTR "",
@@ -5382,6 +5546,7 @@ void GL_APIENTRY GL_BufferStorageEXT(GLenum target,
                                      const void *data,
                                      GLbitfield flags)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBufferStorageEXT,
           "context = %d, target = %s, size = %llu, data = 0x%016" PRIxPTR ", flags = %s",
@@ -5417,6 +5582,7 @@ void GL_APIENTRY GL_BufferStorageEXT(GLenum target,
 void GL_APIENTRY
 GL_ClearTexImageEXT(GLuint texture, GLint level, GLenum format, GLenum type, const void *data)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLClearTexImageEXT,
           "context = %d, texture = %u, level = %d, format = %s, type = %s, data = 0x%016" PRIxPTR
@@ -5461,6 +5627,7 @@ void GL_APIENTRY GL_ClearTexSubImageEXT(GLuint texture,
                                         GLenum type,
                                         const void *data)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLClearTexSubImageEXT,
           "context = %d, texture = %u, level = %d, xoffset = %d, yoffset = %d, zoffset = %d, width "
@@ -5499,6 +5666,7 @@ void GL_APIENTRY GL_ClearTexSubImageEXT(GLuint texture,
 // GL_EXT_clip_control
 void GL_APIENTRY GL_ClipControlEXT(GLenum origin, GLenum depth)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_ClipControlEXT, origin, depth);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLClipControlEXT, "context = %d, origin = %s, depth = %s", CID(context),
           GLenumToString(GLESEnum::AllEnums, origin), GLenumToString(GLESEnum::AllEnums, depth));
@@ -5552,6 +5720,9 @@ void GL_APIENTRY GL_CopyImageSubDataEXT(GLuint srcName,
                                         GLsizei srcHeight,
                                         GLsizei srcDepth)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_CopyImageSubDataEXT, srcName, srcTarget, srcLevel, srcX, srcY,
+                                 srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth,
+                                 srcHeight, srcDepth);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLCopyImageSubDataEXT,
           "context = %d, srcName = %u, srcTarget = %s, srcLevel = %d, srcX = %d, srcY = %d, srcZ = "
@@ -5595,6 +5766,7 @@ void GL_APIENTRY GL_CopyImageSubDataEXT(GLuint srcName,
 void GL_APIENTRY
 GL_GetObjectLabelEXT(GLenum type, GLuint object, GLsizei bufSize, GLsizei *length, GLchar *label)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetObjectLabelEXT,
           "context = %d, type = %s, object = %u, bufSize = %d, length = 0x%016" PRIxPTR
@@ -5625,6 +5797,7 @@ GL_GetObjectLabelEXT(GLenum type, GLuint object, GLsizei bufSize, GLsizei *lengt
 
 void GL_APIENTRY GL_LabelObjectEXT(GLenum type, GLuint object, GLsizei length, const GLchar *label)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLLabelObjectEXT,
           "context = %d, type = %s, object = %u, length = %d, label = 0x%016" PRIxPTR "",
@@ -5656,6 +5829,7 @@ void GL_APIENTRY GL_LabelObjectEXT(GLenum type, GLuint object, GLsizei length, c
 // GL_EXT_debug_marker
 void GL_APIENTRY GL_InsertEventMarkerEXT(GLsizei length, const GLchar *marker)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     // Don't run the EVENT() macro on the EXT_debug_marker entry points.
     // It can interfere with the debug events being set by the caller.
@@ -5687,6 +5861,7 @@ void GL_APIENTRY GL_InsertEventMarkerEXT(GLsizei length, const GLchar *marker)
 
 void GL_APIENTRY GL_PopGroupMarkerEXT()
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_PopGroupMarkerEXT);
     Context *context = GetValidGlobalContext();
     // Don't run the EVENT() macro on the EXT_debug_marker entry points.
     // It can interfere with the debug events being set by the caller.
@@ -5716,6 +5891,7 @@ void GL_APIENTRY GL_PopGroupMarkerEXT()
 
 void GL_APIENTRY GL_PushGroupMarkerEXT(GLsizei length, const GLchar *marker)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     // Don't run the EVENT() macro on the EXT_debug_marker entry points.
     // It can interfere with the debug events being set by the caller.
@@ -5752,6 +5928,7 @@ void GL_APIENTRY GL_DiscardFramebufferEXT(GLenum target,
                                           GLsizei numAttachments,
                                           const GLenum *attachments)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDiscardFramebufferEXT,
           "context = %d, target = %s, numAttachments = %d, attachments = 0x%016" PRIxPTR "",
@@ -5785,6 +5962,7 @@ void GL_APIENTRY GL_DiscardFramebufferEXT(GLenum target,
 // GL_EXT_disjoint_timer_query
 void GL_APIENTRY GL_BeginQueryEXT(GLenum target, GLuint id)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_BeginQueryEXT, target, id);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBeginQueryEXT, "context = %d, target = %s, id = %u", CID(context),
           GLenumToString(GLESEnum::QueryTarget, target), id);
@@ -5816,6 +5994,7 @@ void GL_APIENTRY GL_BeginQueryEXT(GLenum target, GLuint id)
 
 void GL_APIENTRY GL_DeleteQueriesEXT(GLsizei n, const GLuint *ids)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDeleteQueriesEXT, "context = %d, n = %d, ids = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)ids);
@@ -5842,6 +6021,7 @@ void GL_APIENTRY GL_DeleteQueriesEXT(GLsizei n, const GLuint *ids)
 
 void GL_APIENTRY GL_EndQueryEXT(GLenum target)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_EndQueryEXT, target);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLEndQueryEXT, "context = %d, target = %s", CID(context),
           GLenumToString(GLESEnum::QueryTarget, target));
@@ -5871,6 +6051,7 @@ void GL_APIENTRY GL_EndQueryEXT(GLenum target)
 
 void GL_APIENTRY GL_GenQueriesEXT(GLsizei n, GLuint *ids)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGenQueriesEXT, "context = %d, n = %d, ids = 0x%016" PRIxPTR "", CID(context),
           n, (uintptr_t)ids);
@@ -5897,6 +6078,7 @@ void GL_APIENTRY GL_GenQueriesEXT(GLsizei n, GLuint *ids)
 
 void GL_APIENTRY GL_GetInteger64vEXT(GLenum pname, GLint64 *data)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetInteger64vEXT, "context = %d, pname = %s, data = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::GetPName, pname), (uintptr_t)data);
@@ -5922,6 +6104,7 @@ void GL_APIENTRY GL_GetInteger64vEXT(GLenum pname, GLint64 *data)
 
 void GL_APIENTRY GL_GetQueryObjecti64vEXT(GLuint id, GLenum pname, GLint64 *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetGlobalContext();
     EVENT(context, GLGetQueryObjecti64vEXT,
           "context = %d, id = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context), id,
@@ -5949,6 +6132,7 @@ void GL_APIENTRY GL_GetQueryObjecti64vEXT(GLuint id, GLenum pname, GLint64 *para
 
 void GL_APIENTRY GL_GetQueryObjectivEXT(GLuint id, GLenum pname, GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetGlobalContext();
     EVENT(context, GLGetQueryObjectivEXT,
           "context = %d, id = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context), id,
@@ -5976,6 +6160,7 @@ void GL_APIENTRY GL_GetQueryObjectivEXT(GLuint id, GLenum pname, GLint *params)
 
 void GL_APIENTRY GL_GetQueryObjectui64vEXT(GLuint id, GLenum pname, GLuint64 *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetQueryObjectui64vEXT,
           "context = %d, id = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context), id,
@@ -6004,6 +6189,7 @@ void GL_APIENTRY GL_GetQueryObjectui64vEXT(GLuint id, GLenum pname, GLuint64 *pa
 
 void GL_APIENTRY GL_GetQueryObjectuivEXT(GLuint id, GLenum pname, GLuint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetQueryObjectuivEXT,
           "context = %d, id = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context), id,
@@ -6032,6 +6218,7 @@ void GL_APIENTRY GL_GetQueryObjectuivEXT(GLuint id, GLenum pname, GLuint *params
 
 void GL_APIENTRY GL_GetQueryivEXT(GLenum target, GLenum pname, GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetQueryivEXT,
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
@@ -6060,6 +6247,7 @@ void GL_APIENTRY GL_GetQueryivEXT(GLenum target, GLenum pname, GLint *params)
 
 GLboolean GL_APIENTRY GL_IsQueryEXT(GLuint id)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIsQueryEXT, "context = %d, id = %u", CID(context), id);
 
@@ -6091,6 +6279,7 @@ GLboolean GL_APIENTRY GL_IsQueryEXT(GLuint id)
 
 void GL_APIENTRY GL_QueryCounterEXT(GLuint id, GLenum target)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_QueryCounterEXT, id, target);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLQueryCounterEXT, "context = %d, id = %u, target = %s", CID(context), id,
           GLenumToString(GLESEnum::QueryCounterTarget, target));
@@ -6123,6 +6312,7 @@ void GL_APIENTRY GL_QueryCounterEXT(GLuint id, GLenum target)
 // GL_EXT_draw_buffers
 void GL_APIENTRY GL_DrawBuffersEXT(GLsizei n, const GLenum *bufs)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDrawBuffersEXT, "context = %d, n = %d, bufs = 0x%016" PRIxPTR "", CID(context),
           n, (uintptr_t)bufs);
@@ -6152,6 +6342,7 @@ void GL_APIENTRY GL_DrawBuffersEXT(GLsizei n, const GLenum *bufs)
 // GL_EXT_draw_buffers_indexed
 void GL_APIENTRY GL_BlendEquationSeparateiEXT(GLuint buf, GLenum modeRGB, GLenum modeAlpha)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_BlendEquationSeparateiEXT, buf, modeRGB, modeAlpha);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBlendEquationSeparateiEXT,
           "context = %d, buf = %u, modeRGB = %s, modeAlpha = %s", CID(context), buf,
@@ -6182,6 +6373,7 @@ void GL_APIENTRY GL_BlendEquationSeparateiEXT(GLuint buf, GLenum modeRGB, GLenum
 
 void GL_APIENTRY GL_BlendEquationiEXT(GLuint buf, GLenum mode)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_BlendEquationiEXT, buf, mode);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBlendEquationiEXT, "context = %d, buf = %u, mode = %s", CID(context), buf,
           GLenumToString(GLESEnum::BlendEquationModeEXT, mode));
@@ -6210,6 +6402,7 @@ void GL_APIENTRY GL_BlendEquationiEXT(GLuint buf, GLenum mode)
 void GL_APIENTRY
 GL_BlendFuncSeparateiEXT(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_BlendFuncSeparateiEXT, buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBlendFuncSeparateiEXT,
           "context = %d, buf = %u, srcRGB = %s, dstRGB = %s, srcAlpha = %s, dstAlpha = %s",
@@ -6244,6 +6437,7 @@ GL_BlendFuncSeparateiEXT(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlp
 
 void GL_APIENTRY GL_BlendFunciEXT(GLuint buf, GLenum src, GLenum dst)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_BlendFunciEXT, buf, src, dst);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBlendFunciEXT, "context = %d, buf = %u, src = %s, dst = %s", CID(context), buf,
           GLenumToString(GLESEnum::BlendingFactor, src),
@@ -6272,6 +6466,7 @@ void GL_APIENTRY GL_BlendFunciEXT(GLuint buf, GLenum src, GLenum dst)
 
 void GL_APIENTRY GL_ColorMaskiEXT(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_ColorMaskiEXT, index, r, g, b, a);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLColorMaskiEXT, "context = %d, index = %u, r = %s, g = %s, b = %s, a = %s",
           CID(context), index, GLbooleanToString(r), GLbooleanToString(g), GLbooleanToString(b),
@@ -6300,6 +6495,7 @@ void GL_APIENTRY GL_ColorMaskiEXT(GLuint index, GLboolean r, GLboolean g, GLbool
 
 void GL_APIENTRY GL_DisableiEXT(GLenum target, GLuint index)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_DisableiEXT, target, index);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDisableiEXT, "context = %d, target = %s, index = %u", CID(context),
           GLenumToString(GLESEnum::EnableCap, target), index);
@@ -6326,6 +6522,7 @@ void GL_APIENTRY GL_DisableiEXT(GLenum target, GLuint index)
 
 void GL_APIENTRY GL_EnableiEXT(GLenum target, GLuint index)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_EnableiEXT, target, index);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLEnableiEXT, "context = %d, target = %s, index = %u", CID(context),
           GLenumToString(GLESEnum::EnableCap, target), index);
@@ -6352,6 +6549,7 @@ void GL_APIENTRY GL_EnableiEXT(GLenum target, GLuint index)
 
 GLboolean GL_APIENTRY GL_IsEnablediEXT(GLenum target, GLuint index)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIsEnablediEXT, "context = %d, target = %s, index = %u", CID(context),
           GLenumToString(GLESEnum::EnableCap, target), index);
@@ -6392,6 +6590,7 @@ void GL_APIENTRY GL_DrawElementsBaseVertexEXT(GLenum mode,
                                               const void *indices,
                                               GLint basevertex)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDrawElementsBaseVertexEXT,
           "context = %d, mode = %s, count = %d, type = %s, indices = 0x%016" PRIxPTR
@@ -6429,6 +6628,7 @@ void GL_APIENTRY GL_DrawElementsInstancedBaseVertexEXT(GLenum mode,
                                                        GLsizei instancecount,
                                                        GLint basevertex)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDrawElementsInstancedBaseVertexEXT,
           "context = %d, mode = %s, count = %d, type = %s, indices = 0x%016" PRIxPTR
@@ -6469,6 +6669,7 @@ void GL_APIENTRY GL_DrawRangeElementsBaseVertexEXT(GLenum mode,
                                                    const void *indices,
                                                    GLint basevertex)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDrawRangeElementsBaseVertexEXT,
           "context = %d, mode = %s, start = %u, end = %u, count = %d, type = %s, indices = "
@@ -6507,6 +6708,7 @@ void GL_APIENTRY GL_MultiDrawElementsBaseVertexEXT(GLenum mode,
                                                    GLsizei drawcount,
                                                    const GLint *basevertex)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLMultiDrawElementsBaseVertexEXT,
           "context = %d, mode = %s, count = 0x%016" PRIxPTR ", type = %s, indices = 0x%016" PRIxPTR
@@ -6550,6 +6752,7 @@ void GL_APIENTRY GL_BufferStorageExternalEXT(GLenum target,
                                              GLeglClientBufferEXT clientBuffer,
                                              GLbitfield flags)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBufferStorageExternalEXT,
           "context = %d, target = %s, offset = %llu, size = %llu, clientBuffer = 0x%016" PRIxPTR
@@ -6590,6 +6793,7 @@ void GL_APIENTRY GL_NamedBufferStorageExternalEXT(GLuint buffer,
                                                   GLeglClientBufferEXT clientBuffer,
                                                   GLbitfield flags)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLNamedBufferStorageExternalEXT,
           "context = %d, buffer = %u, offset = %llu, size = %llu, clientBuffer = 0x%016" PRIxPTR
@@ -6631,6 +6835,7 @@ void GL_APIENTRY GL_FramebufferTextureEXT(GLenum target,
                                           GLuint texture,
                                           GLint level)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_FramebufferTextureEXT, target, attachment, texture, level);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLFramebufferTextureEXT,
           "context = %d, target = %s, attachment = %s, texture = %u, level = %d", CID(context),
@@ -6670,6 +6875,7 @@ void GL_APIENTRY GL_DrawArraysInstancedEXT(GLenum mode,
                                            GLsizei count,
                                            GLsizei primcount)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE_DRAW(GL_DrawArraysInstancedEXT, mode, start, count, primcount);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDrawArraysInstancedEXT,
           "context = %d, mode = %s, start = %d, count = %d, primcount = %d", CID(context),
@@ -6703,6 +6909,7 @@ void GL_APIENTRY GL_DrawElementsInstancedEXT(GLenum mode,
                                              const void *indices,
                                              GLsizei primcount)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDrawElementsInstancedEXT,
           "context = %d, mode = %s, count = %d, type = %s, indices = 0x%016" PRIxPTR
@@ -6735,6 +6942,7 @@ void GL_APIENTRY GL_DrawElementsInstancedEXT(GLenum mode,
 
 void GL_APIENTRY GL_VertexAttribDivisorEXT(GLuint index, GLuint divisor)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_VertexAttribDivisorEXT, index, divisor);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLVertexAttribDivisorEXT, "context = %d, index = %u, divisor = %u", CID(context),
           index, divisor);
@@ -6762,6 +6970,7 @@ void GL_APIENTRY GL_VertexAttribDivisorEXT(GLuint index, GLuint divisor)
 // GL_EXT_map_buffer_range
 void GL_APIENTRY GL_FlushMappedBufferRangeEXT(GLenum target, GLintptr offset, GLsizeiptr length)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_FlushMappedBufferRangeEXT, target, offset, length);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLFlushMappedBufferRangeEXT,
           "context = %d, target = %s, offset = %llu, length = %llu", CID(context),
@@ -6799,6 +7008,7 @@ void *GL_APIENTRY GL_MapBufferRangeEXT(GLenum target,
                                        GLsizeiptr length,
                                        GLbitfield access)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLMapBufferRangeEXT,
           "context = %d, target = %s, offset = %llu, length = %llu, access = %s", CID(context),
@@ -6844,6 +7054,7 @@ void GL_APIENTRY GL_BufferStorageMemEXT(GLenum target,
                                         GLuint memory,
                                         GLuint64 offset)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_BufferStorageMemEXT, target, size, memory, offset);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBufferStorageMemEXT,
           "context = %d, target = %s, size = %llu, memory = %u, offset = %llu", CID(context),
@@ -6878,6 +7089,7 @@ void GL_APIENTRY GL_BufferStorageMemEXT(GLenum target,
 
 void GL_APIENTRY GL_CreateMemoryObjectsEXT(GLsizei n, GLuint *memoryObjects)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLCreateMemoryObjectsEXT,
           "context = %d, n = %d, memoryObjects = 0x%016" PRIxPTR "", CID(context), n,
@@ -6909,6 +7121,7 @@ void GL_APIENTRY GL_CreateMemoryObjectsEXT(GLsizei n, GLuint *memoryObjects)
 
 void GL_APIENTRY GL_DeleteMemoryObjectsEXT(GLsizei n, const GLuint *memoryObjects)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDeleteMemoryObjectsEXT,
           "context = %d, n = %d, memoryObjects = 0x%016" PRIxPTR "", CID(context), n,
@@ -6938,6 +7151,7 @@ void GL_APIENTRY GL_DeleteMemoryObjectsEXT(GLsizei n, const GLuint *memoryObject
 
 void GL_APIENTRY GL_GetMemoryObjectParameterivEXT(GLuint memoryObject, GLenum pname, GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetMemoryObjectParameterivEXT,
           "context = %d, memoryObject = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
@@ -6968,6 +7182,7 @@ void GL_APIENTRY GL_GetMemoryObjectParameterivEXT(GLuint memoryObject, GLenum pn
 
 void GL_APIENTRY GL_GetUnsignedBytevEXT(GLenum pname, GLubyte *data)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetUnsignedBytevEXT, "context = %d, pname = %s, data = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::GetPName, pname), (uintptr_t)data);
@@ -6993,6 +7208,7 @@ void GL_APIENTRY GL_GetUnsignedBytevEXT(GLenum pname, GLubyte *data)
 
 void GL_APIENTRY GL_GetUnsignedBytei_vEXT(GLenum target, GLuint index, GLubyte *data)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetUnsignedBytei_vEXT,
           "context = %d, target = %s, index = %u, data = 0x%016" PRIxPTR "", CID(context),
@@ -7020,6 +7236,7 @@ void GL_APIENTRY GL_GetUnsignedBytei_vEXT(GLenum target, GLuint index, GLubyte *
 
 GLboolean GL_APIENTRY GL_IsMemoryObjectEXT(GLuint memoryObject)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIsMemoryObjectEXT, "context = %d, memoryObject = %u", CID(context),
           memoryObject);
@@ -7057,6 +7274,7 @@ void GL_APIENTRY GL_MemoryObjectParameterivEXT(GLuint memoryObject,
                                                GLenum pname,
                                                const GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLMemoryObjectParameterivEXT,
           "context = %d, memoryObject = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
@@ -7097,6 +7315,8 @@ void GL_APIENTRY GL_TexStorageMem2DEXT(GLenum target,
                                        GLuint memory,
                                        GLuint64 offset)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_TexStorageMem2DEXT, target, levels, internalFormat, width,
+                                 height, memory, offset);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexStorageMem2DEXT,
           "context = %d, target = %s, levels = %d, internalFormat = %s, width = %d, height = %d, "
@@ -7142,6 +7362,8 @@ void GL_APIENTRY GL_TexStorageMem2DMultisampleEXT(GLenum target,
                                                   GLuint memory,
                                                   GLuint64 offset)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_TexStorageMem2DMultisampleEXT, target, samples, internalFormat,
+                                 width, height, fixedSampleLocations, memory, offset);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexStorageMem2DMultisampleEXT,
           "context = %d, target = %s, samples = %d, internalFormat = %s, width = %d, height = %d, "
@@ -7188,6 +7410,8 @@ void GL_APIENTRY GL_TexStorageMem3DEXT(GLenum target,
                                        GLuint memory,
                                        GLuint64 offset)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_TexStorageMem3DEXT, target, levels, internalFormat, width,
+                                 height, depth, memory, offset);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexStorageMem3DEXT,
           "context = %d, target = %s, levels = %d, internalFormat = %s, width = %d, height = %d, "
@@ -7234,6 +7458,8 @@ void GL_APIENTRY GL_TexStorageMem3DMultisampleEXT(GLenum target,
                                                   GLuint memory,
                                                   GLuint64 offset)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_TexStorageMem3DMultisampleEXT, target, samples, internalFormat,
+                                 width, height, depth, fixedSampleLocations, memory, offset);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexStorageMem3DMultisampleEXT,
           "context = %d, target = %s, samples = %d, internalFormat = %s, width = %d, height = %d, "
@@ -7276,6 +7502,7 @@ void GL_APIENTRY GL_TexStorageMem3DMultisampleEXT(GLenum target,
 // GL_EXT_memory_object_fd
 void GL_APIENTRY GL_ImportMemoryFdEXT(GLuint memory, GLuint64 size, GLenum handleType, GLint fd)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_ImportMemoryFdEXT, memory, size, handleType, fd);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLImportMemoryFdEXT,
           "context = %d, memory = %u, size = %llu, handleType = %s, fd = %d", CID(context), memory,
@@ -7314,6 +7541,7 @@ void GL_APIENTRY GL_MultiDrawArraysIndirectEXT(GLenum mode,
                                                GLsizei drawcount,
                                                GLsizei stride)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLMultiDrawArraysIndirectEXT,
           "context = %d, mode = %s, indirect = 0x%016" PRIxPTR ", drawcount = %d, stride = %d",
@@ -7352,6 +7580,7 @@ void GL_APIENTRY GL_MultiDrawElementsIndirectEXT(GLenum mode,
                                                  GLsizei drawcount,
                                                  GLsizei stride)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLMultiDrawElementsIndirectEXT,
           "context = %d, mode = %s, type = %s, indirect = 0x%016" PRIxPTR
@@ -7394,6 +7623,8 @@ void GL_APIENTRY GL_FramebufferTexture2DMultisampleEXT(GLenum target,
                                                        GLint level,
                                                        GLsizei samples)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_FramebufferTexture2DMultisampleEXT, target, attachment,
+                                 textarget, texture, level, samples);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLFramebufferTexture2DMultisampleEXT,
           "context = %d, target = %s, attachment = %s, textarget = %s, texture = %u, level = %d, "
@@ -7436,6 +7667,8 @@ void GL_APIENTRY GL_RenderbufferStorageMultisampleEXT(GLenum target,
                                                       GLsizei width,
                                                       GLsizei height)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_RenderbufferStorageMultisampleEXT, target, samples,
+                                 internalformat, width, height);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLRenderbufferStorageMultisampleEXT,
           "context = %d, target = %s, samples = %d, internalformat = %s, width = %d, height = %d",
@@ -7488,6 +7721,7 @@ void GL_APIENTRY GL_RenderbufferStorageMultisampleEXT(GLenum target,
 // GL_EXT_polygon_offset_clamp
 void GL_APIENTRY GL_PolygonOffsetClampEXT(GLfloat factor, GLfloat units, GLfloat clamp)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_PolygonOffsetClampEXT, factor, units, clamp);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPolygonOffsetClampEXT, "context = %d, factor = %f, units = %f, clamp = %f",
           CID(context), factor, units, clamp);
@@ -7524,6 +7758,8 @@ void GL_APIENTRY GL_PrimitiveBoundingBoxEXT(GLfloat minX,
                                             GLfloat maxZ,
                                             GLfloat maxW)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_PrimitiveBoundingBoxEXT, minX, minY, minZ, minW, maxX, maxY,
+                                 maxZ, maxW);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPrimitiveBoundingBoxEXT,
           "context = %d, minX = %f, minY = %f, minZ = %f, minW = %f, maxX = %f, maxY = %f, maxZ = "
@@ -7568,6 +7804,7 @@ void GL_APIENTRY GL_PrimitiveBoundingBoxEXT(GLfloat minX,
 // GL_EXT_robustness
 GLenum GL_APIENTRY GL_GetGraphicsResetStatusEXT()
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetGlobalContext();
     EVENT(context, GLGetGraphicsResetStatusEXT, "context = %d", CID(context));
 
@@ -7604,6 +7841,7 @@ void GL_APIENTRY GL_GetnUniformfvEXT(GLuint program,
                                      GLsizei bufSize,
                                      GLfloat *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetnUniformfvEXT,
           "context = %d, program = %u, location = %d, bufSize = %d, params = 0x%016" PRIxPTR "",
@@ -7634,6 +7872,7 @@ void GL_APIENTRY GL_GetnUniformfvEXT(GLuint program,
 
 void GL_APIENTRY GL_GetnUniformivEXT(GLuint program, GLint location, GLsizei bufSize, GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetnUniformivEXT,
           "context = %d, program = %u, location = %d, bufSize = %d, params = 0x%016" PRIxPTR "",
@@ -7671,6 +7910,7 @@ void GL_APIENTRY GL_ReadnPixelsEXT(GLint x,
                                    GLsizei bufSize,
                                    void *data)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLReadnPixelsEXT,
           "context = %d, x = %d, y = %d, width = %d, height = %d, format = %s, type = %s, bufSize "
@@ -7709,6 +7949,7 @@ void GL_APIENTRY GL_ReadnPixelsEXT(GLint x,
 // GL_EXT_semaphore
 void GL_APIENTRY GL_DeleteSemaphoresEXT(GLsizei n, const GLuint *semaphores)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDeleteSemaphoresEXT, "context = %d, n = %d, semaphores = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)semaphores);
@@ -7736,6 +7977,7 @@ void GL_APIENTRY GL_DeleteSemaphoresEXT(GLsizei n, const GLuint *semaphores)
 
 void GL_APIENTRY GL_GenSemaphoresEXT(GLsizei n, GLuint *semaphores)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGenSemaphoresEXT, "context = %d, n = %d, semaphores = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)semaphores);
@@ -7762,6 +8004,7 @@ void GL_APIENTRY GL_GenSemaphoresEXT(GLsizei n, GLuint *semaphores)
 
 void GL_APIENTRY GL_GetSemaphoreParameterui64vEXT(GLuint semaphore, GLenum pname, GLuint64 *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetSemaphoreParameterui64vEXT,
           "context = %d, semaphore = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
@@ -7791,6 +8034,7 @@ void GL_APIENTRY GL_GetSemaphoreParameterui64vEXT(GLuint semaphore, GLenum pname
 
 GLboolean GL_APIENTRY GL_IsSemaphoreEXT(GLuint semaphore)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIsSemaphoreEXT, "context = %d, semaphore = %u", CID(context), semaphore);
 
@@ -7825,6 +8069,7 @@ void GL_APIENTRY GL_SemaphoreParameterui64vEXT(GLuint semaphore,
                                                GLenum pname,
                                                const GLuint64 *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLSemaphoreParameterui64vEXT,
           "context = %d, semaphore = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
@@ -7863,6 +8108,7 @@ void GL_APIENTRY GL_SignalSemaphoreEXT(GLuint semaphore,
                                        const GLuint *textures,
                                        const GLenum *dstLayouts)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLSignalSemaphoreEXT,
           "context = %d, semaphore = %u, numBufferBarriers = %u, buffers = 0x%016" PRIxPTR
@@ -7907,6 +8153,7 @@ void GL_APIENTRY GL_WaitSemaphoreEXT(GLuint semaphore,
                                      const GLuint *textures,
                                      const GLenum *srcLayouts)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLWaitSemaphoreEXT,
           "context = %d, semaphore = %u, numBufferBarriers = %u, buffers = 0x%016" PRIxPTR
@@ -7950,6 +8197,7 @@ void GL_APIENTRY GL_WaitSemaphoreEXT(GLuint semaphore,
 // GL_EXT_semaphore_fd
 void GL_APIENTRY GL_ImportSemaphoreFdEXT(GLuint semaphore, GLenum handleType, GLint fd)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_ImportSemaphoreFdEXT, semaphore, handleType, fd);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLImportSemaphoreFdEXT, "context = %d, semaphore = %u, handleType = %s, fd = %d",
           CID(context), semaphore, GLenumToString(GLESEnum::ExternalHandleType, handleType), fd);
@@ -7985,6 +8233,7 @@ void GL_APIENTRY GL_ImportSemaphoreFdEXT(GLuint semaphore, GLenum handleType, GL
 // GL_EXT_separate_shader_objects
 void GL_APIENTRY GL_ActiveShaderProgramEXT(GLuint pipeline, GLuint program)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_ActiveShaderProgramEXT, pipeline, program);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLActiveShaderProgramEXT, "context = %d, pipeline = %u, program = %u",
           CID(context), pipeline, program);
@@ -8017,6 +8266,7 @@ void GL_APIENTRY GL_ActiveShaderProgramEXT(GLuint pipeline, GLuint program)
 
 void GL_APIENTRY GL_BindProgramPipelineEXT(GLuint pipeline)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_BindProgramPipelineEXT, pipeline);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBindProgramPipelineEXT, "context = %d, pipeline = %u", CID(context), pipeline);
 
@@ -8046,6 +8296,7 @@ void GL_APIENTRY GL_BindProgramPipelineEXT(GLuint pipeline)
 
 GLuint GL_APIENTRY GL_CreateShaderProgramvEXT(GLenum type, GLsizei count, const GLchar **strings)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLCreateShaderProgramvEXT,
           "context = %d, type = %s, count = %d, strings = 0x%016" PRIxPTR "", CID(context),
@@ -8086,6 +8337,7 @@ GLuint GL_APIENTRY GL_CreateShaderProgramvEXT(GLenum type, GLsizei count, const
 
 void GL_APIENTRY GL_DeleteProgramPipelinesEXT(GLsizei n, const GLuint *pipelines)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDeleteProgramPipelinesEXT,
           "context = %d, n = %d, pipelines = 0x%016" PRIxPTR "", CID(context), n,
@@ -8114,6 +8366,7 @@ void GL_APIENTRY GL_DeleteProgramPipelinesEXT(GLsizei n, const GLuint *pipelines
 
 void GL_APIENTRY GL_GenProgramPipelinesEXT(GLsizei n, GLuint *pipelines)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGenProgramPipelinesEXT, "context = %d, n = %d, pipelines = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)pipelines);
@@ -8144,6 +8397,7 @@ void GL_APIENTRY GL_GetProgramPipelineInfoLogEXT(GLuint pipeline,
                                                  GLsizei *length,
                                                  GLchar *infoLog)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetProgramPipelineInfoLogEXT,
           "context = %d, pipeline = %u, bufSize = %d, length = 0x%016" PRIxPTR
@@ -8174,6 +8428,7 @@ void GL_APIENTRY GL_GetProgramPipelineInfoLogEXT(GLuint pipeline,
 
 void GL_APIENTRY GL_GetProgramPipelineivEXT(GLuint pipeline, GLenum pname, GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetProgramPipelineivEXT,
           "context = %d, pipeline = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
@@ -8203,6 +8458,7 @@ void GL_APIENTRY GL_GetProgramPipelineivEXT(GLuint pipeline, GLenum pname, GLint
 
 GLboolean GL_APIENTRY GL_IsProgramPipelineEXT(GLuint pipeline)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIsProgramPipelineEXT, "context = %d, pipeline = %u", CID(context), pipeline);
 
@@ -8237,6 +8493,7 @@ GLboolean GL_APIENTRY GL_IsProgramPipelineEXT(GLuint pipeline)
 
 void GL_APIENTRY GL_ProgramParameteriEXT(GLuint program, GLenum pname, GLint value)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_ProgramParameteriEXT, program, pname, value);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramParameteriEXT, "context = %d, program = %u, pname = %s, value = %d",
           CID(context), program, GLenumToString(GLESEnum::ProgramParameterPName, pname), value);
@@ -8267,6 +8524,7 @@ void GL_APIENTRY GL_ProgramParameteriEXT(GLuint program, GLenum pname, GLint val
 
 void GL_APIENTRY GL_ProgramUniform1fEXT(GLuint program, GLint location, GLfloat v0)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_ProgramUniform1fEXT, program, location, v0);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniform1fEXT, "context = %d, program = %u, location = %d, v0 = %f",
           CID(context), program, location, v0);
@@ -8302,6 +8560,7 @@ void GL_APIENTRY GL_ProgramUniform1fvEXT(GLuint program,
                                          GLsizei count,
                                          const GLfloat *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniform1fvEXT,
           "context = %d, program = %u, location = %d, count = %d, value = 0x%016" PRIxPTR "",
@@ -8335,6 +8594,7 @@ void GL_APIENTRY GL_ProgramUniform1fvEXT(GLuint program,
 
 void GL_APIENTRY GL_ProgramUniform1iEXT(GLuint program, GLint location, GLint v0)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_ProgramUniform1iEXT, program, location, v0);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniform1iEXT, "context = %d, program = %u, location = %d, v0 = %d",
           CID(context), program, location, v0);
@@ -8370,6 +8630,7 @@ void GL_APIENTRY GL_ProgramUniform1ivEXT(GLuint program,
                                          GLsizei count,
                                          const GLint *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniform1ivEXT,
           "context = %d, program = %u, location = %d, count = %d, value = 0x%016" PRIxPTR "",
@@ -8403,6 +8664,7 @@ void GL_APIENTRY GL_ProgramUniform1ivEXT(GLuint program,
 
 void GL_APIENTRY GL_ProgramUniform1uiEXT(GLuint program, GLint location, GLuint v0)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_ProgramUniform1uiEXT, program, location, v0);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniform1uiEXT, "context = %d, program = %u, location = %d, v0 = %u",
           CID(context), program, location, v0);
@@ -8438,6 +8700,7 @@ void GL_APIENTRY GL_ProgramUniform1uivEXT(GLuint program,
                                           GLsizei count,
                                           const GLuint *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniform1uivEXT,
           "context = %d, program = %u, location = %d, count = %d, value = 0x%016" PRIxPTR "",
@@ -8471,6 +8734,7 @@ void GL_APIENTRY GL_ProgramUniform1uivEXT(GLuint program,
 
 void GL_APIENTRY GL_ProgramUniform2fEXT(GLuint program, GLint location, GLfloat v0, GLfloat v1)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_ProgramUniform2fEXT, program, location, v0, v1);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniform2fEXT,
           "context = %d, program = %u, location = %d, v0 = %f, v1 = %f", CID(context), program,
@@ -8507,6 +8771,7 @@ void GL_APIENTRY GL_ProgramUniform2fvEXT(GLuint program,
                                          GLsizei count,
                                          const GLfloat *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniform2fvEXT,
           "context = %d, program = %u, location = %d, count = %d, value = 0x%016" PRIxPTR "",
@@ -8540,6 +8805,7 @@ void GL_APIENTRY GL_ProgramUniform2fvEXT(GLuint program,
 
 void GL_APIENTRY GL_ProgramUniform2iEXT(GLuint program, GLint location, GLint v0, GLint v1)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_ProgramUniform2iEXT, program, location, v0, v1);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniform2iEXT,
           "context = %d, program = %u, location = %d, v0 = %d, v1 = %d", CID(context), program,
@@ -8576,6 +8842,7 @@ void GL_APIENTRY GL_ProgramUniform2ivEXT(GLuint program,
                                          GLsizei count,
                                          const GLint *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniform2ivEXT,
           "context = %d, program = %u, location = %d, count = %d, value = 0x%016" PRIxPTR "",
@@ -8609,6 +8876,7 @@ void GL_APIENTRY GL_ProgramUniform2ivEXT(GLuint program,
 
 void GL_APIENTRY GL_ProgramUniform2uiEXT(GLuint program, GLint location, GLuint v0, GLuint v1)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_ProgramUniform2uiEXT, program, location, v0, v1);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniform2uiEXT,
           "context = %d, program = %u, location = %d, v0 = %u, v1 = %u", CID(context), program,
@@ -8645,6 +8913,7 @@ void GL_APIENTRY GL_ProgramUniform2uivEXT(GLuint program,
                                           GLsizei count,
                                           const GLuint *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniform2uivEXT,
           "context = %d, program = %u, location = %d, count = %d, value = 0x%016" PRIxPTR "",
@@ -8679,6 +8948,7 @@ void GL_APIENTRY GL_ProgramUniform2uivEXT(GLuint program,
 void GL_APIENTRY
 GL_ProgramUniform3fEXT(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_ProgramUniform3fEXT, program, location, v0, v1, v2);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniform3fEXT,
           "context = %d, program = %u, location = %d, v0 = %f, v1 = %f, v2 = %f", CID(context),
@@ -8715,6 +8985,7 @@ void GL_APIENTRY GL_ProgramUniform3fvEXT(GLuint program,
                                          GLsizei count,
                                          const GLfloat *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniform3fvEXT,
           "context = %d, program = %u, location = %d, count = %d, value = 0x%016" PRIxPTR "",
@@ -8749,6 +9020,7 @@ void GL_APIENTRY GL_ProgramUniform3fvEXT(GLuint program,
 void GL_APIENTRY
 GL_ProgramUniform3iEXT(GLuint program, GLint location, GLint v0, GLint v1, GLint v2)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_ProgramUniform3iEXT, program, location, v0, v1, v2);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniform3iEXT,
           "context = %d, program = %u, location = %d, v0 = %d, v1 = %d, v2 = %d", CID(context),
@@ -8785,6 +9057,7 @@ void GL_APIENTRY GL_ProgramUniform3ivEXT(GLuint program,
                                          GLsizei count,
                                          const GLint *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniform3ivEXT,
           "context = %d, program = %u, location = %d, count = %d, value = 0x%016" PRIxPTR "",
@@ -8819,6 +9092,7 @@ void GL_APIENTRY GL_ProgramUniform3ivEXT(GLuint program,
 void GL_APIENTRY
 GL_ProgramUniform3uiEXT(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_ProgramUniform3uiEXT, program, location, v0, v1, v2);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniform3uiEXT,
           "context = %d, program = %u, location = %d, v0 = %u, v1 = %u, v2 = %u", CID(context),
@@ -8855,6 +9129,7 @@ void GL_APIENTRY GL_ProgramUniform3uivEXT(GLuint program,
                                           GLsizei count,
                                           const GLuint *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniform3uivEXT,
           "context = %d, program = %u, location = %d, count = %d, value = 0x%016" PRIxPTR "",
@@ -8893,6 +9168,7 @@ void GL_APIENTRY GL_ProgramUniform4fEXT(GLuint program,
                                         GLfloat v2,
                                         GLfloat v3)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_ProgramUniform4fEXT, program, location, v0, v1, v2, v3);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniform4fEXT,
           "context = %d, program = %u, location = %d, v0 = %f, v1 = %f, v2 = %f, v3 = %f",
@@ -8929,6 +9205,7 @@ void GL_APIENTRY GL_ProgramUniform4fvEXT(GLuint program,
                                          GLsizei count,
                                          const GLfloat *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniform4fvEXT,
           "context = %d, program = %u, location = %d, count = %d, value = 0x%016" PRIxPTR "",
@@ -8963,6 +9240,7 @@ void GL_APIENTRY GL_ProgramUniform4fvEXT(GLuint program,
 void GL_APIENTRY
 GL_ProgramUniform4iEXT(GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_ProgramUniform4iEXT, program, location, v0, v1, v2, v3);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniform4iEXT,
           "context = %d, program = %u, location = %d, v0 = %d, v1 = %d, v2 = %d, v3 = %d",
@@ -8999,6 +9277,7 @@ void GL_APIENTRY GL_ProgramUniform4ivEXT(GLuint program,
                                          GLsizei count,
                                          const GLint *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniform4ivEXT,
           "context = %d, program = %u, location = %d, count = %d, value = 0x%016" PRIxPTR "",
@@ -9033,6 +9312,7 @@ void GL_APIENTRY GL_ProgramUniform4ivEXT(GLuint program,
 void GL_APIENTRY
 GL_ProgramUniform4uiEXT(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_ProgramUniform4uiEXT, program, location, v0, v1, v2, v3);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniform4uiEXT,
           "context = %d, program = %u, location = %d, v0 = %u, v1 = %u, v2 = %u, v3 = %u",
@@ -9069,6 +9349,7 @@ void GL_APIENTRY GL_ProgramUniform4uivEXT(GLuint program,
                                           GLsizei count,
                                           const GLuint *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniform4uivEXT,
           "context = %d, program = %u, location = %d, count = %d, value = 0x%016" PRIxPTR "",
@@ -9106,6 +9387,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix2fvEXT(GLuint program,
                                                GLboolean transpose,
                                                const GLfloat *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniformMatrix2fvEXT,
           "context = %d, program = %u, location = %d, count = %d, transpose = %s, value = "
@@ -9146,6 +9428,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix2x3fvEXT(GLuint program,
                                                  GLboolean transpose,
                                                  const GLfloat *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniformMatrix2x3fvEXT,
           "context = %d, program = %u, location = %d, count = %d, transpose = %s, value = "
@@ -9186,6 +9469,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix2x4fvEXT(GLuint program,
                                                  GLboolean transpose,
                                                  const GLfloat *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniformMatrix2x4fvEXT,
           "context = %d, program = %u, location = %d, count = %d, transpose = %s, value = "
@@ -9226,6 +9510,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix3fvEXT(GLuint program,
                                                GLboolean transpose,
                                                const GLfloat *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniformMatrix3fvEXT,
           "context = %d, program = %u, location = %d, count = %d, transpose = %s, value = "
@@ -9266,6 +9551,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix3x2fvEXT(GLuint program,
                                                  GLboolean transpose,
                                                  const GLfloat *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniformMatrix3x2fvEXT,
           "context = %d, program = %u, location = %d, count = %d, transpose = %s, value = "
@@ -9306,6 +9592,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix3x4fvEXT(GLuint program,
                                                  GLboolean transpose,
                                                  const GLfloat *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniformMatrix3x4fvEXT,
           "context = %d, program = %u, location = %d, count = %d, transpose = %s, value = "
@@ -9346,6 +9633,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix4fvEXT(GLuint program,
                                                GLboolean transpose,
                                                const GLfloat *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniformMatrix4fvEXT,
           "context = %d, program = %u, location = %d, count = %d, transpose = %s, value = "
@@ -9386,6 +9674,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix4x2fvEXT(GLuint program,
                                                  GLboolean transpose,
                                                  const GLfloat *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniformMatrix4x2fvEXT,
           "context = %d, program = %u, location = %d, count = %d, transpose = %s, value = "
@@ -9426,6 +9715,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix4x3fvEXT(GLuint program,
                                                  GLboolean transpose,
                                                  const GLfloat *value)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramUniformMatrix4x3fvEXT,
           "context = %d, program = %u, location = %d, count = %d, transpose = %s, value = "
@@ -9462,6 +9752,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix4x3fvEXT(GLuint program,
 
 void GL_APIENTRY GL_UseProgramStagesEXT(GLuint pipeline, GLbitfield stages, GLuint program)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_UseProgramStagesEXT, pipeline, stages, program);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLUseProgramStagesEXT, "context = %d, pipeline = %u, stages = %s, program = %u",
           CID(context), pipeline, GLbitfieldToString(GLESEnum::UseProgramStageMask, stages).c_str(),
@@ -9495,6 +9786,7 @@ void GL_APIENTRY GL_UseProgramStagesEXT(GLuint pipeline, GLbitfield stages, GLui
 
 void GL_APIENTRY GL_ValidateProgramPipelineEXT(GLuint pipeline)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_ValidateProgramPipelineEXT, pipeline);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLValidateProgramPipelineEXT, "context = %d, pipeline = %u", CID(context),
           pipeline);
@@ -9528,6 +9820,7 @@ void GL_APIENTRY GL_ValidateProgramPipelineEXT(GLuint pipeline)
 // GL_EXT_shader_framebuffer_fetch_non_coherent
 void GL_APIENTRY GL_FramebufferFetchBarrierEXT()
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_FramebufferFetchBarrierEXT);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLFramebufferFetchBarrierEXT, "context = %d", CID(context));
 
@@ -9565,6 +9858,7 @@ void GL_APIENTRY GL_FramebufferFetchBarrierEXT()
 // GL_EXT_tessellation_shader
 void GL_APIENTRY GL_PatchParameteriEXT(GLenum pname, GLint value)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_PatchParameteriEXT, pname, value);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPatchParameteriEXT, "context = %d, pname = %s, value = %d", CID(context),
           GLenumToString(GLESEnum::PatchParameterName, pname), value);
@@ -9596,6 +9890,7 @@ void GL_APIENTRY GL_PatchParameteriEXT(GLenum pname, GLint value)
 // GL_EXT_texture_border_clamp
 void GL_APIENTRY GL_GetSamplerParameterIivEXT(GLuint sampler, GLenum pname, GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetSamplerParameterIivEXT,
           "context = %d, sampler = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
@@ -9625,6 +9920,7 @@ void GL_APIENTRY GL_GetSamplerParameterIivEXT(GLuint sampler, GLenum pname, GLin
 
 void GL_APIENTRY GL_GetSamplerParameterIuivEXT(GLuint sampler, GLenum pname, GLuint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetSamplerParameterIuivEXT,
           "context = %d, sampler = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
@@ -9654,6 +9950,7 @@ void GL_APIENTRY GL_GetSamplerParameterIuivEXT(GLuint sampler, GLenum pname, GLu
 
 void GL_APIENTRY GL_GetTexParameterIivEXT(GLenum target, GLenum pname, GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetTexParameterIivEXT,
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
@@ -9683,6 +9980,7 @@ void GL_APIENTRY GL_GetTexParameterIivEXT(GLenum target, GLenum pname, GLint *pa
 
 void GL_APIENTRY GL_GetTexParameterIuivEXT(GLenum target, GLenum pname, GLuint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetTexParameterIuivEXT,
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
@@ -9712,6 +10010,7 @@ void GL_APIENTRY GL_GetTexParameterIuivEXT(GLenum target, GLenum pname, GLuint *
 
 void GL_APIENTRY GL_SamplerParameterIivEXT(GLuint sampler, GLenum pname, const GLint *param)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLSamplerParameterIivEXT,
           "context = %d, sampler = %u, pname = %s, param = 0x%016" PRIxPTR "", CID(context),
@@ -9740,6 +10039,7 @@ void GL_APIENTRY GL_SamplerParameterIivEXT(GLuint sampler, GLenum pname, const G
 
 void GL_APIENTRY GL_SamplerParameterIuivEXT(GLuint sampler, GLenum pname, const GLuint *param)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLSamplerParameterIuivEXT,
           "context = %d, sampler = %u, pname = %s, param = 0x%016" PRIxPTR "", CID(context),
@@ -9769,6 +10069,7 @@ void GL_APIENTRY GL_SamplerParameterIuivEXT(GLuint sampler, GLenum pname, const
 
 void GL_APIENTRY GL_TexParameterIivEXT(GLenum target, GLenum pname, const GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexParameterIivEXT,
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
@@ -9798,6 +10099,7 @@ void GL_APIENTRY GL_TexParameterIivEXT(GLenum target, GLenum pname, const GLint
 
 void GL_APIENTRY GL_TexParameterIuivEXT(GLenum target, GLenum pname, const GLuint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexParameterIuivEXT,
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
@@ -9828,6 +10130,7 @@ void GL_APIENTRY GL_TexParameterIuivEXT(GLenum target, GLenum pname, const GLuin
 // GL_EXT_texture_buffer
 void GL_APIENTRY GL_TexBufferEXT(GLenum target, GLenum internalformat, GLuint buffer)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_TexBufferEXT, target, internalformat, buffer);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexBufferEXT, "context = %d, target = %s, internalformat = %s, buffer = %u",
           CID(context), GLenumToString(GLESEnum::TextureTarget, target),
@@ -9865,6 +10168,8 @@ void GL_APIENTRY GL_TexBufferRangeEXT(GLenum target,
                                       GLintptr offset,
                                       GLsizeiptr size)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_TexBufferRangeEXT, target, internalformat, buffer, offset,
+                                 size);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexBufferRangeEXT,
           "context = %d, target = %s, internalformat = %s, buffer = %u, offset = %llu, size = %llu",
@@ -9942,6 +10247,7 @@ void GL_APIENTRY GL_TexStorage1DEXT(GLenum target,
                                     GLenum internalformat,
                                     GLsizei width)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_TexStorage1DEXT, target, levels, internalformat, width);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexStorage1DEXT,
           "context = %d, target = %s, levels = %d, internalformat = %s, width = %d", CID(context),
@@ -9978,6 +10284,7 @@ void GL_APIENTRY GL_TexStorage2DEXT(GLenum target,
                                     GLsizei width,
                                     GLsizei height)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_TexStorage2DEXT, target, levels, internalformat, width, height);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexStorage2DEXT,
           "context = %d, target = %s, levels = %d, internalformat = %s, width = %d, height = %d",
@@ -10016,6 +10323,8 @@ void GL_APIENTRY GL_TexStorage3DEXT(GLenum target,
                                     GLsizei height,
                                     GLsizei depth)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_TexStorage3DEXT, target, levels, internalformat, width, height,
+                                 depth);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexStorage3DEXT,
           "context = %d, target = %s, levels = %d, internalformat = %s, width = %d, height = %d, "
@@ -10059,6 +10368,7 @@ void GL_APIENTRY GL_TexStorage3DEXT(GLenum target,
 // GL_KHR_blend_equation_advanced
 void GL_APIENTRY GL_BlendBarrierKHR()
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_BlendBarrierKHR);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBlendBarrierKHR, "context = %d", CID(context));
 
@@ -10089,6 +10399,7 @@ void GL_APIENTRY GL_BlendBarrierKHR()
 // GL_KHR_debug
 void GL_APIENTRY GL_DebugMessageCallbackKHR(GLDEBUGPROCKHR callback, const void *userParam)
 {
+    ANGLE_COMMAND_STREAM_SYNC_DEBUG_CALLBACK(callback);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDebugMessageCallbackKHR,
           "context = %d, callback = 0x%016" PRIxPTR ", userParam = 0x%016" PRIxPTR "", CID(context),
@@ -10121,6 +10432,7 @@ void GL_APIENTRY GL_DebugMessageControlKHR(GLenum source,
                                            const GLuint *ids,
                                            GLboolean enabled)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDebugMessageControlKHR,
           "context = %d, source = %s, type = %s, severity = %s, count = %d, ids = 0x%016" PRIxPTR
@@ -10158,6 +10470,7 @@ void GL_APIENTRY GL_DebugMessageInsertKHR(GLenum source,
                                           GLsizei length,
                                           const GLchar *buf)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDebugMessageInsertKHR,
           "context = %d, source = %s, type = %s, id = %u, severity = %s, length = %d, buf = "
@@ -10196,6 +10509,7 @@ GLuint GL_APIENTRY GL_GetDebugMessageLogKHR(GLuint count,
                                             GLsizei *lengths,
                                             GLchar *messageLog)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetDebugMessageLogKHR,
           "context = %d, count = %u, bufSize = %d, sources = 0x%016" PRIxPTR
@@ -10240,6 +10554,7 @@ void GL_APIENTRY GL_GetObjectLabelKHR(GLenum identifier,
                                       GLsizei *length,
                                       GLchar *label)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetObjectLabelKHR,
           "context = %d, identifier = %s, name = %u, bufSize = %d, length = 0x%016" PRIxPTR
@@ -10273,6 +10588,7 @@ void GL_APIENTRY GL_GetObjectPtrLabelKHR(const void *ptr,
                                          GLsizei *length,
                                          GLchar *label)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetObjectPtrLabelKHR,
           "context = %d, ptr = 0x%016" PRIxPTR ", bufSize = %d, length = 0x%016" PRIxPTR
@@ -10301,6 +10617,7 @@ void GL_APIENTRY GL_GetObjectPtrLabelKHR(const void *ptr,
 
 void GL_APIENTRY GL_GetPointervKHR(GLenum pname, void **params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetPointervKHR, "context = %d, pname = %s, params = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::AllEnums, pname), (uintptr_t)params);
@@ -10329,6 +10646,7 @@ void GL_APIENTRY GL_ObjectLabelKHR(GLenum identifier,
                                    GLsizei length,
                                    const GLchar *label)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLObjectLabelKHR,
           "context = %d, identifier = %s, name = %u, length = %d, label = 0x%016" PRIxPTR "",
@@ -10356,6 +10674,7 @@ void GL_APIENTRY GL_ObjectLabelKHR(GLenum identifier,
 
 void GL_APIENTRY GL_ObjectPtrLabelKHR(const void *ptr, GLsizei length, const GLchar *label)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLObjectPtrLabelKHR,
           "context = %d, ptr = 0x%016" PRIxPTR ", length = %d, label = 0x%016" PRIxPTR "",
@@ -10383,6 +10702,7 @@ void GL_APIENTRY GL_ObjectPtrLabelKHR(const void *ptr, GLsizei length, const GLc
 
 void GL_APIENTRY GL_PopDebugGroupKHR()
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_PopDebugGroupKHR);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPopDebugGroupKHR, "context = %d", CID(context));
 
@@ -10410,6 +10730,7 @@ void GL_APIENTRY GL_PushDebugGroupKHR(GLenum source,
                                       GLsizei length,
                                       const GLchar *message)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPushDebugGroupKHR,
           "context = %d, source = %s, id = %u, length = %d, message = 0x%016" PRIxPTR "",
@@ -10441,6 +10762,7 @@ void GL_APIENTRY GL_PushDebugGroupKHR(GLenum source,
 // GL_KHR_parallel_shader_compile
 void GL_APIENTRY GL_MaxShaderCompilerThreadsKHR(GLuint count)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_MaxShaderCompilerThreadsKHR, count);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLMaxShaderCompilerThreadsKHR, "context = %d, count = %u", CID(context), count);
 
@@ -10472,6 +10794,7 @@ void GL_APIENTRY GL_MaxShaderCompilerThreadsKHR(GLuint count)
 // GL_KHR_robustness
 GLenum GL_APIENTRY GL_GetGraphicsResetStatusKHR()
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetGlobalContext();
     EVENT(context, GLGetGraphicsResetStatusKHR, "context = %d", CID(context));
 
@@ -10508,6 +10831,7 @@ void GL_APIENTRY GL_GetnUniformfvKHR(GLuint program,
                                      GLsizei bufSize,
                                      GLfloat *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetnUniformfvKHR,
           "context = %d, program = %u, location = %d, bufSize = %d, params = 0x%016" PRIxPTR "",
@@ -10538,6 +10862,7 @@ void GL_APIENTRY GL_GetnUniformfvKHR(GLuint program,
 
 void GL_APIENTRY GL_GetnUniformivKHR(GLuint program, GLint location, GLsizei bufSize, GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetnUniformivKHR,
           "context = %d, program = %u, location = %d, bufSize = %d, params = 0x%016" PRIxPTR "",
@@ -10571,6 +10896,7 @@ void GL_APIENTRY GL_GetnUniformuivKHR(GLuint program,
                                       GLsizei bufSize,
                                       GLuint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetnUniformuivKHR,
           "context = %d, program = %u, location = %d, bufSize = %d, params = 0x%016" PRIxPTR "",
@@ -10608,6 +10934,7 @@ void GL_APIENTRY GL_ReadnPixelsKHR(GLint x,
                                    GLsizei bufSize,
                                    void *data)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLReadnPixelsKHR,
           "context = %d, x = %d, y = %d, width = %d, height = %d, format = %s, type = %s, bufSize "
@@ -10648,6 +10975,7 @@ void GL_APIENTRY GL_ReadnPixelsKHR(GLint x,
 // GL_MESA_framebuffer_flip_y
 void GL_APIENTRY GL_FramebufferParameteriMESA(GLenum target, GLenum pname, GLint param)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_FramebufferParameteriMESA, target, pname, param);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLFramebufferParameteriMESA, "context = %d, target = %s, pname = %s, param = %d",
           CID(context), GLenumToString(GLESEnum::FramebufferTarget, target),
@@ -10678,6 +11006,7 @@ void GL_APIENTRY GL_FramebufferParameteriMESA(GLenum target, GLenum pname, GLint
 
 void GL_APIENTRY GL_GetFramebufferParameterivMESA(GLenum target, GLenum pname, GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetFramebufferParameterivMESA,
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
@@ -10708,6 +11037,7 @@ void GL_APIENTRY GL_GetFramebufferParameterivMESA(GLenum target, GLenum pname, G
 // GL_NV_fence
 void GL_APIENTRY GL_DeleteFencesNV(GLsizei n, const GLuint *fences)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDeleteFencesNV, "context = %d, n = %d, fences = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)fences);
@@ -10734,6 +11064,7 @@ void GL_APIENTRY GL_DeleteFencesNV(GLsizei n, const GLuint *fences)
 
 void GL_APIENTRY GL_FinishFenceNV(GLuint fence)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_FinishFenceNV, fence);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLFinishFenceNV, "context = %d, fence = %u", CID(context), fence);
 
@@ -10762,6 +11093,7 @@ void GL_APIENTRY GL_FinishFenceNV(GLuint fence)
 
 void GL_APIENTRY GL_GenFencesNV(GLsizei n, GLuint *fences)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGenFencesNV, "context = %d, n = %d, fences = 0x%016" PRIxPTR "", CID(context),
           n, (uintptr_t)fences);
@@ -10788,6 +11120,7 @@ void GL_APIENTRY GL_GenFencesNV(GLsizei n, GLuint *fences)
 
 void GL_APIENTRY GL_GetFenceivNV(GLuint fence, GLenum pname, GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetFenceivNV,
           "context = %d, fence = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context), fence,
@@ -10815,6 +11148,7 @@ void GL_APIENTRY GL_GetFenceivNV(GLuint fence, GLenum pname, GLint *params)
 
 GLboolean GL_APIENTRY GL_IsFenceNV(GLuint fence)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIsFenceNV, "context = %d, fence = %u", CID(context), fence);
 
@@ -10847,6 +11181,7 @@ GLboolean GL_APIENTRY GL_IsFenceNV(GLuint fence)
 
 void GL_APIENTRY GL_SetFenceNV(GLuint fence, GLenum condition)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_SetFenceNV, fence, condition);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLSetFenceNV, "context = %d, fence = %u, condition = %s", CID(context), fence,
           GLenumToString(GLESEnum::AllEnums, condition));
@@ -10877,6 +11212,7 @@ void GL_APIENTRY GL_SetFenceNV(GLuint fence, GLenum condition)
 
 GLboolean GL_APIENTRY GL_TestFenceNV(GLuint fence)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTestFenceNV, "context = %d, fence = %u", CID(context), fence);
 
@@ -10922,6 +11258,8 @@ void GL_APIENTRY GL_BlitFramebufferNV(GLint srcX0,
                                       GLbitfield mask,
                                       GLenum filter)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_BlitFramebufferNV, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0,
+                                 dstX1, dstY1, mask, filter);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBlitFramebufferNV,
           "context = %d, srcX0 = %d, srcY0 = %d, srcX1 = %d, srcY1 = %d, dstX0 = %d, dstY0 = %d, "
@@ -10961,6 +11299,7 @@ void GL_APIENTRY GL_BlitFramebufferNV(GLint srcX0,
 // GL_NV_polygon_mode
 void GL_APIENTRY GL_PolygonModeNV(GLenum face, GLenum mode)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_PolygonModeNV, face, mode);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPolygonModeNV, "context = %d, face = %s, mode = %s", CID(context),
           GLenumToString(GLESEnum::TriangleFace, face),
@@ -11001,6 +11340,7 @@ void GL_APIENTRY GL_PolygonModeNV(GLenum face, GLenum mode)
 // GL_OES_EGL_image
 void GL_APIENTRY GL_EGLImageTargetRenderbufferStorageOES(GLenum target, GLeglImageOES image)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLEGLImageTargetRenderbufferStorageOES,
           "context = %d, target = %s, image = 0x%016" PRIxPTR "", CID(context),
@@ -11034,6 +11374,7 @@ void GL_APIENTRY GL_EGLImageTargetRenderbufferStorageOES(GLenum target, GLeglIma
 
 void GL_APIENTRY GL_EGLImageTargetTexture2DOES(GLenum target, GLeglImageOES image)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLEGLImageTargetTexture2DOES,
           "context = %d, target = %s, image = 0x%016" PRIxPTR "", CID(context),
@@ -11091,6 +11432,9 @@ void GL_APIENTRY GL_CopyImageSubDataOES(GLuint srcName,
                                         GLsizei srcHeight,
                                         GLsizei srcDepth)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_CopyImageSubDataOES, srcName, srcTarget, srcLevel, srcX, srcY,
+                                 srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth,
+                                 srcHeight, srcDepth);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLCopyImageSubDataOES,
           "context = %d, srcName = %u, srcTarget = %s, srcLevel = %d, srcX = %d, srcY = %d, srcZ = "
@@ -11139,6 +11483,7 @@ void GL_APIENTRY GL_CopyImageSubDataOES(GLuint srcName,
 // GL_OES_draw_buffers_indexed
 void GL_APIENTRY GL_BlendEquationSeparateiOES(GLuint buf, GLenum modeRGB, GLenum modeAlpha)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_BlendEquationSeparateiOES, buf, modeRGB, modeAlpha);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBlendEquationSeparateiOES,
           "context = %d, buf = %u, modeRGB = %s, modeAlpha = %s", CID(context), buf,
@@ -11169,6 +11514,7 @@ void GL_APIENTRY GL_BlendEquationSeparateiOES(GLuint buf, GLenum modeRGB, GLenum
 
 void GL_APIENTRY GL_BlendEquationiOES(GLuint buf, GLenum mode)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_BlendEquationiOES, buf, mode);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBlendEquationiOES, "context = %d, buf = %u, mode = %s", CID(context), buf,
           GLenumToString(GLESEnum::BlendEquationModeEXT, mode));
@@ -11197,6 +11543,7 @@ void GL_APIENTRY GL_BlendEquationiOES(GLuint buf, GLenum mode)
 void GL_APIENTRY
 GL_BlendFuncSeparateiOES(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_BlendFuncSeparateiOES, buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBlendFuncSeparateiOES,
           "context = %d, buf = %u, srcRGB = %s, dstRGB = %s, srcAlpha = %s, dstAlpha = %s",
@@ -11231,6 +11578,7 @@ GL_BlendFuncSeparateiOES(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlp
 
 void GL_APIENTRY GL_BlendFunciOES(GLuint buf, GLenum src, GLenum dst)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_BlendFunciOES, buf, src, dst);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBlendFunciOES, "context = %d, buf = %u, src = %s, dst = %s", CID(context), buf,
           GLenumToString(GLESEnum::BlendingFactor, src),
@@ -11259,6 +11607,7 @@ void GL_APIENTRY GL_BlendFunciOES(GLuint buf, GLenum src, GLenum dst)
 
 void GL_APIENTRY GL_ColorMaskiOES(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_ColorMaskiOES, index, r, g, b, a);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLColorMaskiOES, "context = %d, index = %u, r = %s, g = %s, b = %s, a = %s",
           CID(context), index, GLbooleanToString(r), GLbooleanToString(g), GLbooleanToString(b),
@@ -11287,6 +11636,7 @@ void GL_APIENTRY GL_ColorMaskiOES(GLuint index, GLboolean r, GLboolean g, GLbool
 
 void GL_APIENTRY GL_DisableiOES(GLenum target, GLuint index)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_DisableiOES, target, index);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDisableiOES, "context = %d, target = %s, index = %u", CID(context),
           GLenumToString(GLESEnum::EnableCap, target), index);
@@ -11313,6 +11663,7 @@ void GL_APIENTRY GL_DisableiOES(GLenum target, GLuint index)
 
 void GL_APIENTRY GL_EnableiOES(GLenum target, GLuint index)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_EnableiOES, target, index);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLEnableiOES, "context = %d, target = %s, index = %u", CID(context),
           GLenumToString(GLESEnum::EnableCap, target), index);
@@ -11339,6 +11690,7 @@ void GL_APIENTRY GL_EnableiOES(GLenum target, GLuint index)
 
 GLboolean GL_APIENTRY GL_IsEnablediOES(GLenum target, GLuint index)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIsEnablediOES, "context = %d, target = %s, index = %u", CID(context),
           GLenumToString(GLESEnum::EnableCap, target), index);
@@ -11379,6 +11731,7 @@ void GL_APIENTRY GL_DrawElementsBaseVertexOES(GLenum mode,
                                               const void *indices,
                                               GLint basevertex)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDrawElementsBaseVertexOES,
           "context = %d, mode = %s, count = %d, type = %s, indices = 0x%016" PRIxPTR
@@ -11416,6 +11769,7 @@ void GL_APIENTRY GL_DrawElementsInstancedBaseVertexOES(GLenum mode,
                                                        GLsizei instancecount,
                                                        GLint basevertex)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDrawElementsInstancedBaseVertexOES,
           "context = %d, mode = %s, count = %d, type = %s, indices = 0x%016" PRIxPTR
@@ -11456,6 +11810,7 @@ void GL_APIENTRY GL_DrawRangeElementsBaseVertexOES(GLenum mode,
                                                    const void *indices,
                                                    GLint basevertex)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDrawRangeElementsBaseVertexOES,
           "context = %d, mode = %s, start = %u, end = %u, count = %d, type = %s, indices = "
@@ -11492,6 +11847,7 @@ void GL_APIENTRY GL_DrawRangeElementsBaseVertexOES(GLenum mode,
 // GL_OES_draw_texture
 void GL_APIENTRY GL_DrawTexfOES(GLfloat x, GLfloat y, GLfloat z, GLfloat width, GLfloat height)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_DrawTexfOES, x, y, z, width, height);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDrawTexfOES, "context = %d, x = %f, y = %f, z = %f, width = %f, height = %f",
           CID(context), x, y, z, width, height);
@@ -11517,6 +11873,7 @@ void GL_APIENTRY GL_DrawTexfOES(GLfloat x, GLfloat y, GLfloat z, GLfloat width,
 
 void GL_APIENTRY GL_DrawTexfvOES(const GLfloat *coords)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDrawTexfvOES, "context = %d, coords = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)coords);
@@ -11542,6 +11899,7 @@ void GL_APIENTRY GL_DrawTexfvOES(const GLfloat *coords)
 
 void GL_APIENTRY GL_DrawTexiOES(GLint x, GLint y, GLint z, GLint width, GLint height)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_DrawTexiOES, x, y, z, width, height);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDrawTexiOES, "context = %d, x = %d, y = %d, z = %d, width = %d, height = %d",
           CID(context), x, y, z, width, height);
@@ -11567,6 +11925,7 @@ void GL_APIENTRY GL_DrawTexiOES(GLint x, GLint y, GLint z, GLint width, GLint he
 
 void GL_APIENTRY GL_DrawTexivOES(const GLint *coords)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDrawTexivOES, "context = %d, coords = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)coords);
@@ -11592,6 +11951,7 @@ void GL_APIENTRY GL_DrawTexivOES(const GLint *coords)
 
 void GL_APIENTRY GL_DrawTexsOES(GLshort x, GLshort y, GLshort z, GLshort width, GLshort height)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_DrawTexsOES, x, y, z, width, height);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDrawTexsOES, "context = %d, x = %d, y = %d, z = %d, width = %d, height = %d",
           CID(context), x, y, z, width, height);
@@ -11617,6 +11977,7 @@ void GL_APIENTRY GL_DrawTexsOES(GLshort x, GLshort y, GLshort z, GLshort width,
 
 void GL_APIENTRY GL_DrawTexsvOES(const GLshort *coords)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDrawTexsvOES, "context = %d, coords = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)coords);
@@ -11642,6 +12003,7 @@ void GL_APIENTRY GL_DrawTexsvOES(const GLshort *coords)
 
 void GL_APIENTRY GL_DrawTexxOES(GLfixed x, GLfixed y, GLfixed z, GLfixed width, GLfixed height)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_DrawTexxOES, x, y, z, width, height);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDrawTexxOES,
           "context = %d, x = 0x%X, y = 0x%X, z = 0x%X, width = 0x%X, height = 0x%X", CID(context),
@@ -11668,6 +12030,7 @@ void GL_APIENTRY GL_DrawTexxOES(GLfixed x, GLfixed y, GLfixed z, GLfixed width,
 
 void GL_APIENTRY GL_DrawTexxvOES(const GLfixed *coords)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDrawTexxvOES, "context = %d, coords = 0x%016" PRIxPTR "", CID(context),
           (uintptr_t)coords);
@@ -11698,6 +12061,7 @@ void GL_APIENTRY GL_DrawTexxvOES(const GLfixed *coords)
 // GL_OES_framebuffer_object
 void GL_APIENTRY GL_BindFramebufferOES(GLenum target, GLuint framebuffer)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_BindFramebufferOES, target, framebuffer);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBindFramebufferOES, "context = %d, target = %s, framebuffer = %u",
           CID(context), GLenumToString(GLESEnum::FramebufferTarget, target), framebuffer);
@@ -11725,6 +12089,7 @@ void GL_APIENTRY GL_BindFramebufferOES(GLenum target, GLuint framebuffer)
 
 void GL_APIENTRY GL_BindRenderbufferOES(GLenum target, GLuint renderbuffer)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_BindRenderbufferOES, target, renderbuffer);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBindRenderbufferOES, "context = %d, target = %s, renderbuffer = %u",
           CID(context), GLenumToString(GLESEnum::RenderbufferTarget, target), renderbuffer);
@@ -11752,6 +12117,7 @@ void GL_APIENTRY GL_BindRenderbufferOES(GLenum target, GLuint renderbuffer)
 
 GLenum GL_APIENTRY GL_CheckFramebufferStatusOES(GLenum target)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLCheckFramebufferStatusOES, "context = %d, target = %s", CID(context),
           GLenumToString(GLESEnum::FramebufferTarget, target));
@@ -11786,6 +12152,7 @@ GLenum GL_APIENTRY GL_CheckFramebufferStatusOES(GLenum target)
 
 void GL_APIENTRY GL_DeleteFramebuffersOES(GLsizei n, const GLuint *framebuffers)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDeleteFramebuffersOES,
           "context = %d, n = %d, framebuffers = 0x%016" PRIxPTR "", CID(context), n,
@@ -11814,6 +12181,7 @@ void GL_APIENTRY GL_DeleteFramebuffersOES(GLsizei n, const GLuint *framebuffers)
 
 void GL_APIENTRY GL_DeleteRenderbuffersOES(GLsizei n, const GLuint *renderbuffers)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDeleteRenderbuffersOES,
           "context = %d, n = %d, renderbuffers = 0x%016" PRIxPTR "", CID(context), n,
@@ -11846,6 +12214,8 @@ void GL_APIENTRY GL_FramebufferRenderbufferOES(GLenum target,
                                                GLenum renderbuffertarget,
                                                GLuint renderbuffer)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_FramebufferRenderbufferOES, target, attachment,
+                                 renderbuffertarget, renderbuffer);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLFramebufferRenderbufferOES,
           "context = %d, target = %s, attachment = %s, renderbuffertarget = %s, renderbuffer = %u",
@@ -11882,6 +12252,8 @@ void GL_APIENTRY GL_FramebufferTexture2DOES(GLenum target,
                                             GLuint texture,
                                             GLint level)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_FramebufferTexture2DOES, target, attachment, textarget, texture,
+                                 level);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLFramebufferTexture2DOES,
           "context = %d, target = %s, attachment = %s, textarget = %s, texture = %u, level = %d",
@@ -11915,6 +12287,7 @@ void GL_APIENTRY GL_FramebufferTexture2DOES(GLenum target,
 
 void GL_APIENTRY GL_GenFramebuffersOES(GLsizei n, GLuint *framebuffers)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGenFramebuffersOES, "context = %d, n = %d, framebuffers = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)framebuffers);
@@ -11942,6 +12315,7 @@ void GL_APIENTRY GL_GenFramebuffersOES(GLsizei n, GLuint *framebuffers)
 
 void GL_APIENTRY GL_GenRenderbuffersOES(GLsizei n, GLuint *renderbuffers)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGenRenderbuffersOES, "context = %d, n = %d, renderbuffers = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)renderbuffers);
@@ -11969,6 +12343,7 @@ void GL_APIENTRY GL_GenRenderbuffersOES(GLsizei n, GLuint *renderbuffers)
 
 void GL_APIENTRY GL_GenerateMipmapOES(GLenum target)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_GenerateMipmapOES, target);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGenerateMipmapOES, "context = %d, target = %s", CID(context),
           GLenumToString(GLESEnum::TextureTarget, target));
@@ -11998,6 +12373,7 @@ void GL_APIENTRY GL_GetFramebufferAttachmentParameterivOES(GLenum target,
                                                            GLenum pname,
                                                            GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetFramebufferAttachmentParameterivOES,
           "context = %d, target = %s, attachment = %s, pname = %s, params = 0x%016" PRIxPTR "",
@@ -12029,6 +12405,7 @@ void GL_APIENTRY GL_GetFramebufferAttachmentParameterivOES(GLenum target,
 
 void GL_APIENTRY GL_GetRenderbufferParameterivOES(GLenum target, GLenum pname, GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetRenderbufferParameterivOES,
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
@@ -12058,6 +12435,7 @@ void GL_APIENTRY GL_GetRenderbufferParameterivOES(GLenum target, GLenum pname, G
 
 GLboolean GL_APIENTRY GL_IsFramebufferOES(GLuint framebuffer)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIsFramebufferOES, "context = %d, framebuffer = %u", CID(context), framebuffer);
 
@@ -12090,6 +12468,7 @@ GLboolean GL_APIENTRY GL_IsFramebufferOES(GLuint framebuffer)
 
 GLboolean GL_APIENTRY GL_IsRenderbufferOES(GLuint renderbuffer)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIsRenderbufferOES, "context = %d, renderbuffer = %u", CID(context),
           renderbuffer);
@@ -12128,6 +12507,7 @@ void GL_APIENTRY GL_RenderbufferStorageOES(GLenum target,
                                            GLsizei width,
                                            GLsizei height)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_RenderbufferStorageOES, target, internalformat, width, height);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLRenderbufferStorageOES,
           "context = %d, target = %s, internalformat = %s, width = %d, height = %d", CID(context),
@@ -12161,6 +12541,7 @@ void GL_APIENTRY GL_FramebufferTextureOES(GLenum target,
                                           GLuint texture,
                                           GLint level)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_FramebufferTextureOES, target, attachment, texture, level);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLFramebufferTextureOES,
           "context = %d, target = %s, attachment = %s, texture = %u, level = %d", CID(context),
@@ -12199,6 +12580,7 @@ void GL_APIENTRY GL_GetProgramBinaryOES(GLuint program,
                                         GLenum *binaryFormat,
                                         void *binary)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetProgramBinaryOES,
           "context = %d, program = %u, bufSize = %d, length = 0x%016" PRIxPTR
@@ -12233,6 +12615,7 @@ void GL_APIENTRY GL_ProgramBinaryOES(GLuint program,
                                      const void *binary,
                                      GLint length)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLProgramBinaryOES,
           "context = %d, program = %u, binaryFormat = %s, binary = 0x%016" PRIxPTR ", length = %d",
@@ -12269,6 +12652,7 @@ void GL_APIENTRY GL_ProgramBinaryOES(GLuint program,
 // GL_OES_mapbuffer
 void GL_APIENTRY GL_GetBufferPointervOES(GLenum target, GLenum pname, void **params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetBufferPointervOES,
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
@@ -12298,6 +12682,7 @@ void GL_APIENTRY GL_GetBufferPointervOES(GLenum target, GLenum pname, void **par
 
 void *GL_APIENTRY GL_MapBufferOES(GLenum target, GLenum access)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLMapBufferOES, "context = %d, target = %s, access = %s", CID(context),
           GLenumToString(GLESEnum::BufferTargetARB, target),
@@ -12336,6 +12721,7 @@ void *GL_APIENTRY GL_MapBufferOES(GLenum target, GLenum access)
 
 GLboolean GL_APIENTRY GL_UnmapBufferOES(GLenum target)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLUnmapBufferOES, "context = %d, target = %s", CID(context),
           GLenumToString(GLESEnum::AllEnums, target));
@@ -12373,6 +12759,7 @@ GLboolean GL_APIENTRY GL_UnmapBufferOES(GLenum target)
 // GL_OES_matrix_palette
 void GL_APIENTRY GL_CurrentPaletteMatrixOES(GLuint matrixpaletteindex)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_CurrentPaletteMatrixOES, matrixpaletteindex);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLCurrentPaletteMatrixOES, "context = %d, matrixpaletteindex = %u", CID(context),
           matrixpaletteindex);
@@ -12399,6 +12786,7 @@ void GL_APIENTRY GL_CurrentPaletteMatrixOES(GLuint matrixpaletteindex)
 
 void GL_APIENTRY GL_LoadPaletteFromModelViewMatrixOES()
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_LoadPaletteFromModelViewMatrixOES);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLLoadPaletteFromModelViewMatrixOES, "context = %d", CID(context));
 
@@ -12426,6 +12814,7 @@ void GL_APIENTRY GL_MatrixIndexPointerOES(GLint size,
                                           GLsizei stride,
                                           const void *pointer)
 {
+    ANGLE_COMMAND_STREAM_SYNC_CLIENT_ARRAYS();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLMatrixIndexPointerOES,
           "context = %d, size = %d, type = %s, stride = %d, pointer = 0x%016" PRIxPTR "",
@@ -12453,6 +12842,7 @@ void GL_APIENTRY GL_MatrixIndexPointerOES(GLint size,
 
 void GL_APIENTRY GL_WeightPointerOES(GLint size, GLenum type, GLsizei stride, const void *pointer)
 {
+    ANGLE_COMMAND_STREAM_SYNC_CLIENT_ARRAYS();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLWeightPointerOES,
           "context = %d, size = %d, type = %s, stride = %d, pointer = 0x%016" PRIxPTR "",
@@ -12482,6 +12872,7 @@ void GL_APIENTRY GL_WeightPointerOES(GLint size, GLenum type, GLsizei stride, co
 // GL_OES_point_size_array
 void GL_APIENTRY GL_PointSizePointerOES(GLenum type, GLsizei stride, const void *pointer)
 {
+    ANGLE_COMMAND_STREAM_SYNC_CLIENT_ARRAYS();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPointSizePointerOES,
           "context = %d, type = %s, stride = %d, pointer = 0x%016" PRIxPTR "", CID(context),
@@ -12520,6 +12911,8 @@ void GL_APIENTRY GL_PrimitiveBoundingBoxOES(GLfloat minX,
                                             GLfloat maxZ,
                                             GLfloat maxW)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_PrimitiveBoundingBoxOES, minX, minY, minZ, minW, maxX, maxY,
+                                 maxZ, maxW);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPrimitiveBoundingBoxOES,
           "context = %d, minX = %f, minY = %f, minZ = %f, minW = %f, maxX = %f, maxY = %f, maxZ = "
@@ -12556,6 +12949,7 @@ void GL_APIENTRY GL_PrimitiveBoundingBoxOES(GLfloat minX,
 // GL_OES_query_matrix
 GLbitfield GL_APIENTRY GL_QueryMatrixxOES(GLfixed *mantissa, GLint *exponent)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLQueryMatrixxOES,
           "context = %d, mantissa = 0x%016" PRIxPTR ", exponent = 0x%016" PRIxPTR "", CID(context),
@@ -12592,6 +12986,7 @@ GLbitfield GL_APIENTRY GL_QueryMatrixxOES(GLfixed *mantissa, GLint *exponent)
 // GL_OES_sample_shading
 void GL_APIENTRY GL_MinSampleShadingOES(GLfloat value)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_MinSampleShadingOES, value);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLMinSampleShadingOES, "context = %d, value = %f", CID(context), value);
 
@@ -12634,6 +13029,7 @@ void GL_APIENTRY GL_MinSampleShadingOES(GLfloat value)
 // GL_OES_tessellation_shader
 void GL_APIENTRY GL_PatchParameteriOES(GLenum pname, GLint value)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_PatchParameteriOES, pname, value);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLPatchParameteriOES, "context = %d, pname = %s, value = %d", CID(context),
           GLenumToString(GLESEnum::PatchParameterName, pname), value);
@@ -12673,6 +13069,7 @@ void GL_APIENTRY GL_CompressedTexImage3DOES(GLenum target,
                                             GLsizei imageSize,
                                             const void *data)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLCompressedTexImage3DOES,
           "context = %d, target = %s, level = %d, internalformat = %s, width = %d, height = %d, "
@@ -12720,6 +13117,7 @@ void GL_APIENTRY GL_CompressedTexSubImage3DOES(GLenum target,
                                                GLsizei imageSize,
                                                const void *data)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLCompressedTexSubImage3DOES,
           "context = %d, target = %s, level = %d, xoffset = %d, yoffset = %d, zoffset = %d, width "
@@ -12765,6 +13163,8 @@ void GL_APIENTRY GL_CopyTexSubImage3DOES(GLenum target,
                                          GLsizei width,
                                          GLsizei height)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_CopyTexSubImage3DOES, target, level, xoffset, yoffset, zoffset,
+                                 x, y, width, height);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLCopyTexSubImage3DOES,
           "context = %d, target = %s, level = %d, xoffset = %d, yoffset = %d, zoffset = %d, x = "
@@ -12806,6 +13206,8 @@ void GL_APIENTRY GL_FramebufferTexture3DOES(GLenum target,
                                             GLint level,
                                             GLint zoffset)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_FramebufferTexture3DOES, target, attachment, textarget, texture,
+                                 level, zoffset);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLFramebufferTexture3DOES,
           "context = %d, target = %s, attachment = %s, textarget = %s, texture = %u, level = %d, "
@@ -12853,6 +13255,7 @@ void GL_APIENTRY GL_TexImage3DOES(GLenum target,
                                   GLenum type,
                                   const void *pixels)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexImage3DOES,
           "context = %d, target = %s, level = %d, internalformat = %s, width = %d, height = %d, "
@@ -12901,6 +13304,7 @@ void GL_APIENTRY GL_TexSubImage3DOES(GLenum target,
                                      GLenum type,
                                      const void *pixels)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexSubImage3DOES,
           "context = %d, target = %s, level = %d, xoffset = %d, yoffset = %d, zoffset = %d, width "
@@ -12939,6 +13343,7 @@ void GL_APIENTRY GL_TexSubImage3DOES(GLenum target,
 // GL_OES_texture_border_clamp
 void GL_APIENTRY GL_GetSamplerParameterIivOES(GLuint sampler, GLenum pname, GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetSamplerParameterIivOES,
           "context = %d, sampler = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
@@ -12968,6 +13373,7 @@ void GL_APIENTRY GL_GetSamplerParameterIivOES(GLuint sampler, GLenum pname, GLin
 
 void GL_APIENTRY GL_GetSamplerParameterIuivOES(GLuint sampler, GLenum pname, GLuint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetSamplerParameterIuivOES,
           "context = %d, sampler = %u, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
@@ -12997,6 +13403,7 @@ void GL_APIENTRY GL_GetSamplerParameterIuivOES(GLuint sampler, GLenum pname, GLu
 
 void GL_APIENTRY GL_GetTexParameterIivOES(GLenum target, GLenum pname, GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetTexParameterIivOES,
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
@@ -13026,6 +13433,7 @@ void GL_APIENTRY GL_GetTexParameterIivOES(GLenum target, GLenum pname, GLint *pa
 
 void GL_APIENTRY GL_GetTexParameterIuivOES(GLenum target, GLenum pname, GLuint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetTexParameterIuivOES,
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
@@ -13055,6 +13463,7 @@ void GL_APIENTRY GL_GetTexParameterIuivOES(GLenum target, GLenum pname, GLuint *
 
 void GL_APIENTRY GL_SamplerParameterIivOES(GLuint sampler, GLenum pname, const GLint *param)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLSamplerParameterIivOES,
           "context = %d, sampler = %u, pname = %s, param = 0x%016" PRIxPTR "", CID(context),
@@ -13083,6 +13492,7 @@ void GL_APIENTRY GL_SamplerParameterIivOES(GLuint sampler, GLenum pname, const G
 
 void GL_APIENTRY GL_SamplerParameterIuivOES(GLuint sampler, GLenum pname, const GLuint *param)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLSamplerParameterIuivOES,
           "context = %d, sampler = %u, pname = %s, param = 0x%016" PRIxPTR "", CID(context),
@@ -13112,6 +13522,7 @@ void GL_APIENTRY GL_SamplerParameterIuivOES(GLuint sampler, GLenum pname, const
 
 void GL_APIENTRY GL_TexParameterIivOES(GLenum target, GLenum pname, const GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexParameterIivOES,
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
@@ -13141,6 +13552,7 @@ void GL_APIENTRY GL_TexParameterIivOES(GLenum target, GLenum pname, const GLint
 
 void GL_APIENTRY GL_TexParameterIuivOES(GLenum target, GLenum pname, const GLuint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexParameterIuivOES,
           "context = %d, target = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
@@ -13171,6 +13583,7 @@ void GL_APIENTRY GL_TexParameterIuivOES(GLenum target, GLenum pname, const GLuin
 // GL_OES_texture_buffer
 void GL_APIENTRY GL_TexBufferOES(GLenum target, GLenum internalformat, GLuint buffer)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_TexBufferOES, target, internalformat, buffer);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexBufferOES, "context = %d, target = %s, internalformat = %s, buffer = %u",
           CID(context), GLenumToString(GLESEnum::TextureTarget, target),
@@ -13208,6 +13621,8 @@ void GL_APIENTRY GL_TexBufferRangeOES(GLenum target,
                                       GLintptr offset,
                                       GLsizeiptr size)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_TexBufferRangeOES, target, internalformat, buffer, offset,
+                                 size);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexBufferRangeOES,
           "context = %d, target = %s, internalformat = %s, buffer = %u, offset = %llu, size = %llu",
@@ -13246,6 +13661,7 @@ void GL_APIENTRY GL_TexBufferRangeOES(GLenum target,
 // GL_OES_texture_cube_map
 void GL_APIENTRY GL_GetTexGenfvOES(GLenum coord, GLenum pname, GLfloat *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetTexGenfvOES,
           "context = %d, coord = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
@@ -13273,6 +13689,7 @@ void GL_APIENTRY GL_GetTexGenfvOES(GLenum coord, GLenum pname, GLfloat *params)
 
 void GL_APIENTRY GL_GetTexGenivOES(GLenum coord, GLenum pname, GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetTexGenivOES,
           "context = %d, coord = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
@@ -13300,6 +13717,7 @@ void GL_APIENTRY GL_GetTexGenivOES(GLenum coord, GLenum pname, GLint *params)
 
 void GL_APIENTRY GL_GetTexGenxvOES(GLenum coord, GLenum pname, GLfixed *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGetTexGenxvOES,
           "context = %d, coord = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
@@ -13327,6 +13745,7 @@ void GL_APIENTRY GL_GetTexGenxvOES(GLenum coord, GLenum pname, GLfixed *params)
 
 void GL_APIENTRY GL_TexGenfOES(GLenum coord, GLenum pname, GLfloat param)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_TexGenfOES, coord, pname, param);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexGenfOES, "context = %d, coord = %s, pname = %s, param = %f", CID(context),
           GLenumToString(GLESEnum::TextureCoordName, coord),
@@ -13353,6 +13772,7 @@ void GL_APIENTRY GL_TexGenfOES(GLenum coord, GLenum pname, GLfloat param)
 
 void GL_APIENTRY GL_TexGenfvOES(GLenum coord, GLenum pname, const GLfloat *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexGenfvOES,
           "context = %d, coord = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
@@ -13380,6 +13800,7 @@ void GL_APIENTRY GL_TexGenfvOES(GLenum coord, GLenum pname, const GLfloat *param
 
 void GL_APIENTRY GL_TexGeniOES(GLenum coord, GLenum pname, GLint param)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_TexGeniOES, coord, pname, param);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexGeniOES, "context = %d, coord = %s, pname = %s, param = %d", CID(context),
           GLenumToString(GLESEnum::TextureCoordName, coord),
@@ -13406,6 +13827,7 @@ void GL_APIENTRY GL_TexGeniOES(GLenum coord, GLenum pname, GLint param)
 
 void GL_APIENTRY GL_TexGenivOES(GLenum coord, GLenum pname, const GLint *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexGenivOES,
           "context = %d, coord = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
@@ -13433,6 +13855,7 @@ void GL_APIENTRY GL_TexGenivOES(GLenum coord, GLenum pname, const GLint *params)
 
 void GL_APIENTRY GL_TexGenxOES(GLenum coord, GLenum pname, GLfixed param)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_TexGenxOES, coord, pname, param);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexGenxOES, "context = %d, coord = %s, pname = %s, param = 0x%X", CID(context),
           GLenumToString(GLESEnum::TextureCoordName, coord),
@@ -13459,6 +13882,7 @@ void GL_APIENTRY GL_TexGenxOES(GLenum coord, GLenum pname, GLfixed param)
 
 void GL_APIENTRY GL_TexGenxvOES(GLenum coord, GLenum pname, const GLfixed *params)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexGenxvOES,
           "context = %d, coord = %s, pname = %s, params = 0x%016" PRIxPTR "", CID(context),
@@ -13507,6 +13931,8 @@ void GL_APIENTRY GL_TexStorage3DMultisampleOES(GLenum target,
                                                GLsizei depth,
                                                GLboolean fixedsamplelocations)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_TexStorage3DMultisampleOES, target, samples, internalformat,
+                                 width, height, depth, fixedsamplelocations);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTexStorage3DMultisampleOES,
           "context = %d, target = %s, samples = %d, internalformat = %s, width = %d, height = %d, "
@@ -13545,6 +13971,7 @@ void GL_APIENTRY GL_TexStorage3DMultisampleOES(GLenum target,
 // GL_OES_vertex_array_object
 void GL_APIENTRY GL_BindVertexArrayOES(GLuint array)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_BindVertexArrayOES, array);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLBindVertexArrayOES, "context = %d, array = %u", CID(context), array);
 
@@ -13574,6 +14001,7 @@ void GL_APIENTRY GL_BindVertexArrayOES(GLuint array)
 
 void GL_APIENTRY GL_DeleteVertexArraysOES(GLsizei n, const GLuint *arrays)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLDeleteVertexArraysOES, "context = %d, n = %d, arrays = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)arrays);
@@ -13601,6 +14029,7 @@ void GL_APIENTRY GL_DeleteVertexArraysOES(GLsizei n, const GLuint *arrays)
 
 void GL_APIENTRY GL_GenVertexArraysOES(GLsizei n, GLuint *arrays)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLGenVertexArraysOES, "context = %d, n = %d, arrays = 0x%016" PRIxPTR "",
           CID(context), n, (uintptr_t)arrays);
@@ -13627,6 +14056,7 @@ void GL_APIENTRY GL_GenVertexArraysOES(GLsizei n, GLuint *arrays)
 
 GLboolean GL_APIENTRY GL_IsVertexArrayOES(GLuint array)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLIsVertexArrayOES, "context = %d, array = %u", CID(context), array);
 
@@ -13669,6 +14099,8 @@ void GL_APIENTRY GL_FramebufferTextureMultiviewOVR(GLenum target,
                                                    GLint baseViewIndex,
                                                    GLsizei numViews)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_FramebufferTextureMultiviewOVR, target, attachment, texture,
+                                 level, baseViewIndex, numViews);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLFramebufferTextureMultiviewOVR,
           "context = %d, target = %s, attachment = %s, texture = %u, level = %d, baseViewIndex = "
@@ -13713,6 +14145,7 @@ void GL_APIENTRY GL_FramebufferFoveationConfigQCOM(GLuint framebuffer,
                                                    GLuint requestedFeatures,
                                                    GLuint *providedFeatures)
 {
+    ANGLE_COMMAND_STREAM_SYNC();
     Context *context = GetValidGlobalContext();
     EVENT(context, GLFramebufferFoveationConfigQCOM,
           "context = %d, framebuffer = %u, numLayers = %u, focalPointsPerLayer = %u, "
@@ -13756,6 +14189,8 @@ void GL_APIENTRY GL_FramebufferFoveationParametersQCOM(GLuint framebuffer,
                                                        GLfloat gainY,
                                                        GLfloat foveaArea)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_FramebufferFoveationParametersQCOM, framebuffer, layer,
+                                 focalPoint, focalX, focalY, gainX, gainY, foveaArea);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLFramebufferFoveationParametersQCOM,
           "context = %d, framebuffer = %u, layer = %u, focalPoint = %u, focalX = %f, focalY = %f, "
@@ -13795,6 +14230,7 @@ void GL_APIENTRY GL_FramebufferFoveationParametersQCOM(GLuint framebuffer,
 // GL_QCOM_shading_rate
 void GL_APIENTRY GL_ShadingRateQCOM(GLenum rate)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_ShadingRateQCOM, rate);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLShadingRateQCOM, "context = %d, rate = %s", CID(context),
           GLenumToString(GLESEnum::ShadingRateQCOM, rate));
@@ -13833,6 +14269,8 @@ void GL_APIENTRY GL_TextureFoveationParametersQCOM(GLuint texture,
                                                    GLfloat gainY,
                                                    GLfloat foveaArea)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_TextureFoveationParametersQCOM, texture, layer, focalPoint,
+                                 focalX, focalY, gainX, gainY, foveaArea);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLTextureFoveationParametersQCOM,
           "context = %d, texture = %u, layer = %u, focalPoint = %u, focalX = %f, focalY = %f, "
@@ -13869,6 +14307,7 @@ void GL_APIENTRY GL_TextureFoveationParametersQCOM(GLuint texture,
 // GL_QCOM_tiled_rendering
 void GL_APIENTRY GL_EndTilingQCOM(GLbitfield preserveMask)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_EndTilingQCOM, preserveMask);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLEndTilingQCOM, "context = %d, preserveMask = %s", CID(context),
           GLbitfieldToString(GLESEnum::BufferBitQCOM, preserveMask).c_str());
@@ -13898,6 +14337,7 @@ void GL_APIENTRY GL_EndTilingQCOM(GLbitfield preserveMask)
 void GL_APIENTRY
 GL_StartTilingQCOM(GLuint x, GLuint y, GLuint width, GLuint height, GLbitfield preserveMask)
 {
+    ANGLE_COMMAND_STREAM_ENQUEUE(GL_StartTilingQCOM, x, y, width, height, preserveMask);
     Context *context = GetValidGlobalContext();
     EVENT(context, GLStartTilingQCOM,
           "context = %d, x = %u, y = %u, width = %u, height = %u, preserveMask = %s", CID(context),
@@ -35,6 +35,8 @@ bool g_EGLValidationEnabled = true;
 {
     egl::Thread *thread = static_cast<egl::Thread *>(ptr);
     ASSERT(thread);
+    // The recorded calls may need the global lock.
+    ANGLE_COMMAND_STREAM_SYNC();
     ANGLE_SCOPED_GLOBAL_LOCK();
     // ReleaseThread() and makeCurrent() inside will perform:
     // - destroy Context if it was already marked for destruction;
@@ -161,6 +163,10 @@ void SetContextCurrent(Thread *thread, gl::Context *context)
 
     gl::SetCurrentValidContext(context);
 
+#if defined(ANGLE_ENABLE_COMMAND_STREAM)
+    gl::SetCurrentCommandStreamContext(context);
+#endif
+
 #if defined(ANGLE_FORCE_CONTEXT_CHECK_EVERY_CALL)
     DirtyContextIfNeeded(context);
 #endif
@@ -16,6 +16,7 @@
 #include "libANGLE/Thread.h"
 #include "libANGLE/features.h"
 #include "libANGLE/validationEGL.h"
+#include "libGLESv2/command_stream.h"
 
 #if defined(ANGLE_PLATFORM_APPLE) || (ANGLE_PLATFORM_ANDROID) || defined(ANGLE_USE_ANDROID_TLS_SLOT)
 #    include "common/tls.h"
@@ -8,6 +8,7 @@
 import argparse
 import contextlib
 import difflib
+import gzip
 import json
 import logging
 import os
@@ -76,21 +77,56 @@ def diff_files(path, expected_path):
     return True
 
 
+def run_capture(test_name, out_dir, extra_env):
+    cmd = [angle_test_util.ExecutablePathInCurrentDir('angle_end2end_tests')]
+    if angle_test_util.IsAndroid():
+        cmd.append('--angle-test-runner')
+
+    test_args = ['--gtest_filter=%s' % test_name, '--angle-per-test-capture-label']
+    capture_env = {
+        'ANGLE_CAPTURE_ENABLED': '1',
+        'ANGLE_CAPTURE_FRAME_START': '2',
+        'ANGLE_CAPTURE_FRAME_END': '5',
+        'ANGLE_CAPTURE_OUT_DIR': out_dir,
+        **extra_env,
+    }
+    subprocess.check_call(cmd + test_args, env={**os.environ.copy(), **capture_env})
+
+
+# The compressed binary data must decompress to the expected binary data.  The write queue is kept
+# small so the writer also has to block while the capture runs.
+def run_compressed_test(test_name):
+    with temporary_dir() as temp_dir:
+        run_capture(test_name, temp_dir, {
+            'ANGLE_CAPTURE_COMPRESSION': '1',
+            'ANGLE_CAPTURE_WRITE_QUEUE_MB': '1',
+        })
+        logging.info('Compressed capture finished, comparing binary data')
+        files = sorted(fn for fn in os.listdir(temp_dir) if fn.endswith('.angledata.gz'))
+        expected_dir = os.path.join(SCRIPT_DIR, 'expected')
+        expected_files = sorted(
+            fn + '.gz' for fn in os.listdir(expected_dir) if fn.endswith('.angledata'))
+
+        if files != expected_files:
+            logging.error(
+                'Checks failed. Compressed capture produced a different set of binary data files:'
+                ' %s\nDiff:\n%s\n', files, '\n'.join(difflib.unified_diff(expected_files, files)))
+            return False
+
+        has_diffs = False
+        for fn in files:
+            with gzip.open(os.path.join(temp_dir, fn), 'rb') as f:
+                content = f.read()
+            if content != file_content(os.path.join(expected_dir, fn[:-len('.gz')])):
+                logging.error('Checks failed. Decompressed binary file contents mismatch: %s', fn)
+                has_diffs = True
+
+        return not has_diffs
+
+
 def run_test(test_name, overwrite_expected):
     with temporary_dir() as temp_dir:
-        cmd = [angle_test_util.ExecutablePathInCurrentDir('angle_end2end_tests')]
-        if angle_test_util.IsAndroid():
-            cmd.append('--angle-test-runner')
-
-        test_args = ['--gtest_filter=%s' % test_name, '--angle-per-test-capture-label']
-        extra_env = {
-            'ANGLE_CAPTURE_ENABLED': '1',
-            'ANGLE_CAPTURE_FRAME_START': '2',
-            'ANGLE_CAPTURE_FRAME_END': '5',
-            'ANGLE_CAPTURE_OUT_DIR': temp_dir,
-            'ANGLE_CAPTURE_COMPRESSION': '0',
-        }
-        subprocess.check_call(cmd + test_args, env={**os.environ.copy(), **extra_env})
+        run_capture(test_name, temp_dir, {'ANGLE_CAPTURE_COMPRESSION': '0'})
         logging.info('Capture finished, comparing files')
         files = sorted(fn for fn in os.listdir(temp_dir))
         expected_dir = os.path.join(SCRIPT_DIR, 'expected')
@@ -136,6 +172,8 @@ def main():
                 'Found capture diffs. If diffs are expected, build angle_end2end_tests and run '
                 '(cd out/<build>; ../../src/tests/capture_tests/capture_tests.py --overwrite-expected)'
             )
+        elif not args.overwrite_expected and not run_compressed_test(test_name):
+            had_error = True
     except Exception as e:
         logging.exception(e)
         had_error = True
@@ -7,10 +7,23 @@
 //   Test the sh::ConstructCompiler interface with different parameters.
 //
 
+#include <thread>
+#include <vector>
+
 #include "GLSLANG/ShaderLang.h"
 #include "angle_gl.h"
+#include "compiler/translator/Compiler.h"
 #include "gtest/gtest.h"
 
+namespace
+{
+const sh::TSymbol *FindBuiltIn(ShHandle handle, const char *name)
+{
+    sh::TCompiler *compiler = static_cast<sh::TShHandleBase *>(handle)->getAsCompiler();
+    return compiler->getSymbolTable().findBuiltIn(sh::ImmutableString(name), 300);
+}
+}  // anonymous namespace
+
 // Test default parameters.
 TEST(ConstructCompilerTest, DefaultParameters)
 {
@@ -44,3 +57,73 @@ TEST(ConstructCompilerTest, InvalidMaxDualSourceDrawBuffers)
                                               SH_GLSL_COMPATIBILITY_OUTPUT, &resources);
     ASSERT_EQ(nullptr, compiler);
 }
+
+// Test that compilers created with the same parameters share their built-ins, and that compilers
+// created with different resources don't.
+TEST(ConstructCompilerTest, SharedBuiltIns)
+{
+    ShBuiltInResources resources;
+    sh::InitBuiltInResources(&resources);
+    ShHandle compiler1 = sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_GLES3_SPEC,
+                                               SH_ESSL_OUTPUT, &resources);
+    ShHandle compiler2 = sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_GLES3_SPEC,
+                                               SH_GLSL_COMPATIBILITY_OUTPUT, &resources);
+    resources.MaxDrawBuffers = 4;
+    ShHandle compiler3 = sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_GLES3_SPEC,
+                                               SH_ESSL_OUTPUT, &resources);
+    ASSERT_NE(nullptr, compiler1);
+    ASSERT_NE(nullptr, compiler2);
+    ASSERT_NE(nullptr, compiler3);
+
+    const sh::TSymbol *maxDrawBuffers = FindBuiltIn(compiler1, "gl_MaxDrawBuffers");
+    ASSERT_NE(nullptr, maxDrawBuffers);
+    EXPECT_EQ(maxDrawBuffers, FindBuiltIn(compiler2, "gl_MaxDrawBuffers"));
+    EXPECT_NE(maxDrawBuffers, FindBuiltIn(compiler3, "gl_MaxDrawBuffers"));
+
+    // The built-ins outlive the compiler that created them.
+    sh::Destruct(compiler1);
+    EXPECT_EQ(maxDrawBuffers, FindBuiltIn(compiler2, "gl_MaxDrawBuffers"));
+
+    sh::Destruct(compiler2);
+    sh::Destruct(compiler3);
+}
+
+// Test compiling with compilers that share their built-ins on several threads at once.
+TEST(ConstructCompilerTest, SharedBuiltInsMultithreaded)
+{
+    constexpr char kShader[] = R"(#version 300 es
+precision mediump float;
+out vec4 color[gl_MaxDrawBuffers];
+void main()
+{
+    color[0] = vec4(gl_FragCoord.xy, gl_DepthRange.near, float(gl_MaxDrawBuffers));
+})";
+
+    ShBuiltInResources resources;
+    sh::InitBuiltInResources(&resources);
+    resources.MaxDrawBuffers = 4;
+
+    std::vector<std::thread> threads;
+    for (int threadIndex = 0; threadIndex < 4; ++threadIndex)
+    {
+        threads.emplace_back([&]() {
+            for (int iteration = 0; iteration < 10; ++iteration)
+            {
+                ShHandle compiler = sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_GLES3_SPEC,
+                                                          SH_ESSL_OUTPUT, &resources);
+                ASSERT_NE(nullptr, compiler);
+
+                const char *shaderStrings[] = {kShader};
+                ShCompileOptions options    = {};
+                options.objectCode          = true;
+                EXPECT_TRUE(sh::Compile(compiler, shaderStrings, 1, options))
+                    << sh::GetInfoLog(compiler);
+                sh::Destruct(compiler);
+            }
+        });
+    }
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+}
@@ -111,6 +111,31 @@ TEST_F(EmulateGLDrawIDTest, EmulatesUniform)
 #endif
 }
 
+// Check that the draw index is added to the emulated gl_DrawID only in SPIR-V, where it maps to the
+// DrawIndex built-in
+TEST_F(EmulateGLDrawIDTest, AddsDrawIndex)
+{
+    addOutputType(SH_ESSL_OUTPUT);
+#ifdef ANGLE_ENABLE_VULKAN
+    addOutputType(SH_SPIRV_VULKAN_OUTPUT);
+#endif
+
+    const std::string &shaderString =
+        "#extension GL_ANGLE_multi_draw : require\n"
+        "void main() {\n"
+        "   gl_Position = vec4(float(gl_DrawID), 0.0, 0.0, 1.0);\n"
+        "}\n";
+
+    ShCompileOptions compileOptions       = {};
+    compileOptions.objectCode             = true;
+    compileOptions.emulateGLDrawID        = true;
+    compileOptions.addDrawIndexToGLDrawID = true;
+    compile(shaderString, compileOptions);
+
+    EXPECT_TRUE(foundInCode(SH_ESSL_OUTPUT, "uniform highp int angle_DrawID"));
+    EXPECT_FALSE(foundInCode(SH_ESSL_OUTPUT, "gl_DrawID"));
+}
+
 // Check that a user-defined "gl_DrawID" is not permitted
 TEST_F(EmulateGLDrawIDTest, DisallowsUserDefinedGLDrawID)
 {
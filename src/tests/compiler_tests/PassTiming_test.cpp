@@ -0,0 +1,80 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// PassTiming_test.cpp:
+//   Tests that the translator times each of its passes under its own name.
+//
+
+#include <set>
+
+#include "angle_gl.h"
+#include "compiler/translator/Compiler.h"
+#include "gtest/gtest.h"
+#include "tests/test_utils/ShaderCompileTreeTest.h"
+
+using namespace sh;
+
+namespace
+{
+
+class PassTimingTest : public ShaderCompileTreeTest
+{
+  public:
+    PassTimingTest() {}
+
+  protected:
+    ::GLenum getShaderType() const override { return GL_FRAGMENT_SHADER; }
+    ShShaderSpec getShaderSpec() const override { return SH_GLES3_SPEC; }
+};
+
+// Tests that each pass of a compile is timed under its own name.
+TEST_F(PassTimingTest, Names)
+{
+    constexpr char kShader[] = R"(#version 300 es
+precision mediump float;
+uniform int u;
+out vec4 color;
+void main()
+{
+    float a = float(u);
+    switch (u)
+    {
+        case 0:
+            a += 1.0;
+            break;
+        default:
+            a = -a;
+    }
+    color = vec4(a);
+})";
+
+    getCompiler()->enablePassTiming();
+    compileAssumeSuccess(kShader);
+
+    std::set<std::string> names;
+    for (const PassTiming &timing : getCompiler()->getPassTimings())
+    {
+        EXPECT_TRUE(names.insert(timing.name).second) << timing.name;
+        EXPECT_GE(timing.seconds, 0.0) << timing.name;
+    }
+
+    EXPECT_EQ(1u, names.count("PreprocessAndParse"));
+    EXPECT_EQ(1u, names.count("ValidateOutputs"));
+    EXPECT_EQ(1u, names.count("PruneEmptyCases"));
+
+    // Passes that run more than once are named apart.
+    EXPECT_EQ(1u, names.count("FoldExpressions"));
+    EXPECT_EQ(1u, names.count("FoldExpressionsAfterRemoveArrayLengthMethod"));
+    EXPECT_EQ(1u, names.count("DeferGlobalInitializers"));
+}
+
+// Tests that passes are not timed unless asked to.
+TEST_F(PassTimingTest, DisabledByDefault)
+{
+    compileAssumeSuccess("#version 300 es\nvoid main() {}");
+    EXPECT_TRUE(getCompiler()->getPassTimings().empty());
+}
+
+}  // anonymous namespace
@@ -397,6 +397,32 @@ void main()
             baseVertices.data(), baseInstances.data(), drawCount);
     }
 
+    // Draws every quad as a multi-draw of its two triangles, which share their base vertex and base
+    // instance.
+    void doMultiDrawElementsInstancedSharedBaseVertexBaseInstance()
+    {
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+        const GLsizei drawCount = 2;
+        const std::vector<GLsizei> counts(drawCount, 3);
+        const std::vector<GLsizei> instanceCounts(drawCount, 2);
+        const std::vector<GLvoid *> indices = {
+            reinterpret_cast<GLvoid *>(static_cast<uintptr_t>(0)),
+            reinterpret_cast<GLvoid *>(static_cast<uintptr_t>(3 * sizeof(GLushort)))};
+
+        for (uint32_t v = 0; v < kCountY; v++)
+        {
+            for (uint32_t i = 0; i < kCountX; i += 2)
+            {
+                const std::vector<GLint> baseVertices(drawCount, v * 4);
+                const std::vector<GLuint> baseInstances(drawCount, i);
+                glMultiDrawElementsInstancedBaseVertexBaseInstanceANGLE(
+                    GL_TRIANGLES, counts.data(), GL_UNSIGNED_SHORT, indices.data(),
+                    instanceCounts.data(), baseVertices.data(), baseInstances.data(), drawCount);
+            }
+        }
+    }
+
     void checkDrawResult(bool hasBaseVertex, bool oneColumn = false)
     {
         uint32_t numColums = oneColumn ? 1 : kCountX;
@@ -1025,6 +1051,38 @@ TEST_P(DrawBaseVertexBaseInstanceTest, MultiDrawElementsInstancedBaseVertexBaseI
     checkDrawResult(true, true);
 }
 
+// Tests glMultiDrawElementsInstancedBaseVertexBaseInstance with draws that share their base vertex
+// and base instance, which backends can record as a single draw even when the program reads
+// gl_BaseVertex and gl_BaseInstance.
+TEST_P(DrawBaseVertexBaseInstanceTest, MultiDrawElementsInstancedSharedBaseVertexBaseInstance)
+{
+    ANGLE_SKIP_TEST_IF(!requestExtensions());
+
+    GLProgram program;
+    setupProgram(program, false, true);
+
+    GLBuffer indexBuffer;
+    GLBuffer vertexBuffer;
+    setupIndexedBuffers(vertexBuffer, indexBuffer);
+    setupPositionVertexAttribPointer();
+
+    GLBuffer instanceIDBuffer;
+    if (!useBaseInstanceBuiltin())
+    {
+        setupInstanceIDBuffer(instanceIDBuffer);
+        setupInstanceIDVertexAttribPointer(mInstanceIDLoc);
+    }
+
+    doMultiDrawElementsInstancedSharedBaseVertexBaseInstance();
+    EXPECT_GL_NO_ERROR();
+    checkDrawResult(true);
+
+    setupRegularIndexedBuffer(indexBuffer);
+    doDrawElementsBaseVertexBaseInstanceReset();
+    EXPECT_GL_NO_ERROR();
+    checkDrawResult(true, true);
+}
+
 // Tests if baseInstance works properly with instanced array with non-zero divisor
 TEST_P(DrawBaseInstanceTest, BaseInstanceDivisor)
 {
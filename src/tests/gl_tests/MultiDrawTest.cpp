@@ -680,6 +680,228 @@ TEST_P(MultiDrawTest, MultiDrawArraysThenDrawArrays)
     CheckDrawResult(DrawIDOptionOverride::NoDrawID);
 }
 
+// Tests that glMultiDrawElementsANGLE followed by glDrawElements at non-zero offsets works.
+// Backends may bind the index buffer differently for a multi-draw recorded as a single draw.
+TEST_P(MultiDrawTest, MultiDrawElementsThenDrawElementsWithOffset)
+{
+    ANGLE_SKIP_TEST_IF(!requestExtensions());
+    ANGLE_SKIP_TEST_IF(IsInstancedTest());
+
+    SetupBuffers();
+    SetupProgram();
+    DoDrawElements();
+    EXPECT_GL_NO_ERROR();
+    CheckDrawResult(DrawIDOptionOverride::Default);
+
+    // Draw the same triangles in two halves, the second one at an offset into the index buffer.
+    constexpr GLsizei kHalfIndexCount = 3 * kTriCount / 2;
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    glDrawElements(GL_TRIANGLES, kHalfIndexCount, GL_UNSIGNED_SHORT, nullptr);
+    glDrawElements(GL_TRIANGLES, kHalfIndexCount, GL_UNSIGNED_SHORT,
+                   reinterpret_cast<const void *>(kHalfIndexCount * sizeof(GLushort)));
+    ASSERT_GL_NO_ERROR();
+    CheckDrawResult(DrawIDOptionOverride::NoDrawID);
+}
+
+// The following tests cover the multi-draw calls that backends may not be able to record as a
+// single draw and handle one draw at a time instead.  Calls with gl_DrawID, gl_BaseVertex or
+// gl_BaseInstance are covered by the DrawID variants and by DrawBaseVertexBaseInstanceTest.
+
+// Tests glMultiDrawArraysANGLE with vertices in client memory.
+TEST_P(MultiDrawTest, MultiDrawArraysClientMemory)
+{
+    ANGLE_SKIP_TEST_IF(!requestExtensions());
+    ANGLE_SKIP_TEST_IF(IsInstancedTest());
+
+    SetupBuffers();
+    SetupProgram();
+
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glEnableVertexAttribArray(mPositionLoc);
+    glVertexAttribPointer(mPositionLoc, 3, GL_FLOAT, GL_FALSE, 0, mNonIndexedVertices.data());
+
+    std::vector<GLint> firsts(kTriCount);
+    std::vector<GLsizei> counts(kTriCount, 3);
+    for (uint32_t i = 0; i < kTriCount; ++i)
+    {
+        firsts[i] = i * 3;
+    }
+    glMultiDrawArraysANGLE(GL_TRIANGLES, firsts.data(), counts.data(), kTriCount);
+    EXPECT_GL_NO_ERROR();
+    CheckDrawResult(DrawIDOptionOverride::Default);
+}
+
+// Tests glMultiDrawElementsANGLE with indices in client memory.
+TEST_P(MultiDrawTest, MultiDrawElementsClientMemoryIndices)
+{
+    ANGLE_SKIP_TEST_IF(!requestExtensions());
+    ANGLE_SKIP_TEST_IF(IsInstancedTest());
+
+    SetupBuffers();
+    SetupProgram();
+
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
+    glEnableVertexAttribArray(mPositionLoc);
+    glVertexAttribPointer(mPositionLoc, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
+
+    std::vector<GLsizei> counts(kTriCount, 3);
+    std::vector<const GLvoid *> indices(kTriCount);
+    for (uint32_t i = 0; i < kTriCount; ++i)
+    {
+        indices[i] = mIndices.data() + i * 3;
+    }
+    glMultiDrawElementsANGLE(GL_TRIANGLES, counts.data(), GL_UNSIGNED_SHORT, indices.data(),
+                             kTriCount);
+    EXPECT_GL_NO_ERROR();
+    CheckDrawResult(DrawIDOptionOverride::Default);
+}
+
+// Tests glMultiDrawElementsANGLE with unsigned byte indices, which some backends convert.
+TEST_P(MultiDrawTest, MultiDrawElementsUnsignedByte)
+{
+    ANGLE_SKIP_TEST_IF(!requestExtensions());
+    ANGLE_SKIP_TEST_IF(IsInstancedTest());
+
+    SetupBuffers();
+    SetupProgram();
+
+    static_assert(kQuadCount * 4 <= 256, "Vertices must be addressable with unsigned bytes");
+    std::vector<GLubyte> byteIndices(mIndices.begin(), mIndices.end());
+    GLBuffer byteIndexBuffer;
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, byteIndexBuffer);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, byteIndices.size(), byteIndices.data(),
+                 getBufferDataUsage());
+
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
+    glEnableVertexAttribArray(mPositionLoc);
+    glVertexAttribPointer(mPositionLoc, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
+
+    std::vector<GLsizei> counts(kTriCount, 3);
+    std::vector<const GLvoid *> indices(kTriCount);
+    for (uint32_t i = 0; i < kTriCount; ++i)
+    {
+        indices[i] = reinterpret_cast<GLvoid *>(static_cast<uintptr_t>(i * 3));
+    }
+    glMultiDrawElementsANGLE(GL_TRIANGLES, counts.data(), GL_UNSIGNED_BYTE, indices.data(),
+                             kTriCount);
+    EXPECT_GL_NO_ERROR();
+    CheckDrawResult(DrawIDOptionOverride::Default);
+}
+
+// Tests glMultiDrawArraysANGLE with line loops against the same loops drawn one at a time.
+TEST_P(MultiDrawTest, MultiDrawArraysLineLoop)
+{
+    ANGLE_SKIP_TEST_IF(!requestExtensions());
+    ANGLE_SKIP_TEST_IF(IsInstancedTest() || IsDrawIDTest());
+
+    SetupBuffers();
+    SetupProgram();
+
+    glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
+    glEnableVertexAttribArray(mPositionLoc);
+    glVertexAttribPointer(mPositionLoc, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
+
+    std::vector<GLint> firsts(kQuadCount);
+    std::vector<GLsizei> counts(kQuadCount, 4);
+    for (uint32_t i = 0; i < kQuadCount; ++i)
+    {
+        firsts[i] = i * 4;
+    }
+
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    glMultiDrawArraysANGLE(GL_LINE_LOOP, firsts.data(), counts.data(), kQuadCount);
+    EXPECT_GL_NO_ERROR();
+
+    std::vector<GLColor> multiDrawResult(kWidth * kHeight);
+    glReadPixels(0, 0, kWidth, kHeight, GL_RGBA, GL_UNSIGNED_BYTE, multiDrawResult.data());
+    EXPECT_NE(std::count(multiDrawResult.begin(), multiDrawResult.end(), GLColor::red), 0);
+
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    for (uint32_t i = 0; i < kQuadCount; ++i)
+    {
+        glDrawArrays(GL_LINE_LOOP, firsts[i], counts[i]);
+    }
+    EXPECT_GL_NO_ERROR();
+
+    std::vector<GLColor> drawResult(kWidth * kHeight);
+    glReadPixels(0, 0, kWidth, kHeight, GL_RGBA, GL_UNSIGNED_BYTE, drawResult.data());
+    EXPECT_EQ(drawResult, multiDrawResult);
+}
+
+// Tests glMultiDrawArraysANGLE while transform feedback is active.  Every draw must capture its
+// own vertices.
+TEST_P(MultiDrawTestES3, MultiDrawArraysWithTransformFeedback)
+{
+    ANGLE_SKIP_TEST_IF(!requestExtensions());
+    ANGLE_SKIP_TEST_IF(IsInstancedTest() || IsDrawIDTest());
+
+    constexpr char kVS[] = R"(#version 300 es
+in vec2 vPosition;
+out vec2 captured;
+void main()
+{
+    captured = vPosition;
+    gl_Position = vec4(vPosition * 2.0 - 1.0, 0, 1);
+})";
+
+    constexpr char kFS[] = R"(#version 300 es
+precision mediump float;
+out vec4 color;
+void main()
+{
+    color = vec4(1, 0, 0, 1);
+})";
+
+    SetupBuffers();
+    ANGLE_GL_PROGRAM_TRANSFORM_FEEDBACK(program, kVS, kFS, {"captured"}, GL_INTERLEAVED_ATTRIBS);
+    glUseProgram(program);
+    GLint positionLoc = glGetAttribLocation(program, "vPosition");
+
+    glBindBuffer(GL_ARRAY_BUFFER, mNonIndexedVertexBuffer);
+    glEnableVertexAttribArray(positionLoc);
+    glVertexAttribPointer(positionLoc, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
+
+    // Draw the first triangle of every quad, so the draws aren't contiguous.
+    std::vector<GLint> firsts(kQuadCount);
+    std::vector<GLsizei> counts(kQuadCount, 3);
+    for (uint32_t i = 0; i < kQuadCount; ++i)
+    {
+        firsts[i] = i * 6;
+    }
+
+    constexpr size_t kCapturedSize = kQuadCount * 3 * 2 * sizeof(GLfloat);
+    GLBuffer xfbBuffer;
+    glBindBuffer(GL_TRANSFORM_FEEDBACK_BUFFER, xfbBuffer);
+    glBufferData(GL_TRANSFORM_FEEDBACK_BUFFER, kCapturedSize, nullptr, GL_STATIC_READ);
+    GLTransformFeedback xfb;
+    glBindTransformFeedback(GL_TRANSFORM_FEEDBACK, xfb);
+    glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, xfbBuffer);
+
+    glBeginTransformFeedback(GL_TRIANGLES);
+    glMultiDrawArraysANGLE(GL_TRIANGLES, firsts.data(), counts.data(), kQuadCount);
+    glEndTransformFeedback();
+    ASSERT_GL_NO_ERROR();
+
+    const GLfloat *captured = static_cast<const GLfloat *>(
+        glMapBufferRange(GL_TRANSFORM_FEEDBACK_BUFFER, 0, kCapturedSize, GL_MAP_READ_BIT));
+    ASSERT_NE(captured, nullptr);
+    for (uint32_t quad = 0; quad < kQuadCount; ++quad)
+    {
+        for (uint32_t vertex = 0; vertex < 3; ++vertex)
+        {
+            const size_t source      = (quad * 6 + vertex) * 3;
+            const size_t destination = (quad * 3 + vertex) * 2;
+            EXPECT_EQ(mNonIndexedVertices[source], captured[destination]) << quad;
+            EXPECT_EQ(mNonIndexedVertices[source + 1], captured[destination + 1]) << quad;
+        }
+    }
+    glUnmapBuffer(GL_TRANSFORM_FEEDBACK_BUFFER);
+}
+
 // Tests basic functionality of glMultiDrawArraysIndirectEXT
 TEST_P(MultiDrawIndirectTest, MultiDrawArraysIndirect)
 {
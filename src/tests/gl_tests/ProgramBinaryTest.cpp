@@ -8,6 +8,7 @@
 
 #include <stdint.h>
 #include <memory>
+#include <set>
 
 #include "common/string_utils.h"
 #include "test_utils/angle_test_configs.h"
@@ -1173,6 +1174,90 @@ TEST_P(ProgramBinaryES3Test, ArrayOfStructContainingArrayOfSamplers)
     EXPECT_PIXEL_COLOR_EQ(0, 0, expected);
 }
 
+// Tests that the attributes and uniforms of a loaded program can be queried and used, including
+// after the loaded program is saved again before its attributes were ever queried.
+TEST_P(ProgramBinaryES3Test, AttributesAfterReload)
+{
+    ANGLE_SKIP_TEST_IF(getAvailableProgramBinaryFormatCount() == 0);
+
+    constexpr char kVS[] = R"(#version 300 es
+in vec4 position;
+in vec4 vertexColor;
+out vec4 color;
+void main()
+{
+    color = vertexColor;
+    gl_Position = position;
+})";
+
+    constexpr char kFS[] = R"(#version 300 es
+precision mediump float;
+uniform vec4 colorScale;
+in vec4 color;
+out vec4 fragColor;
+void main()
+{
+    fragColor = color * colorScale;
+})";
+
+    auto getBinary = [](GLuint program, std::vector<uint8_t> *binary, GLenum *binaryFormat) {
+        GLint programLength = 0;
+        glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &programLength);
+        binary->resize(programLength);
+        GLsizei readLength = 0;
+        glGetProgramBinary(program, programLength, &readLength, binaryFormat, binary->data());
+        EXPECT_EQ(static_cast<GLsizei>(programLength), readLength);
+    };
+
+    auto expectAttributesAndDraw = [this](GLuint program) {
+        GLint activeAttributes = 0;
+        glGetProgramiv(program, GL_ACTIVE_ATTRIBUTES, &activeAttributes);
+        EXPECT_EQ(2, activeAttributes);
+
+        GLint colorLocation = glGetAttribLocation(program, "vertexColor");
+        ASSERT_NE(-1, colorLocation);
+        EXPECT_NE(glGetAttribLocation(program, "position"), colorLocation);
+
+        std::set<std::string> names;
+        for (GLint index = 0; index < activeAttributes; ++index)
+        {
+            GLchar name[16] = {};
+            GLsizei length  = 0;
+            GLint size      = 0;
+            GLenum type     = GL_NONE;
+            glGetActiveAttrib(program, index, sizeof(name), &length, &size, &type, name);
+            EXPECT_GLENUM_EQ(GL_FLOAT_VEC4, type);
+            names.insert(std::string(name, length));
+        }
+        EXPECT_EQ((std::set<std::string>{"position", "vertexColor"}), names);
+
+        glUseProgram(program);
+        glUniform4f(glGetUniformLocation(program, "colorScale"), 1.0f, 0.0f, 1.0f, 1.0f);
+        glVertexAttrib4f(colorLocation, 1.0f, 1.0f, 0.0f, 1.0f);
+        drawQuad(program, "position", 0.5f);
+        EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+        EXPECT_GL_NO_ERROR();
+    };
+
+    ANGLE_GL_PROGRAM(program, kVS, kFS);
+    expectAttributesAndDraw(program);
+
+    std::vector<uint8_t> binary;
+    GLenum binaryFormat = GL_NONE;
+    getBinary(program, &binary, &binaryFormat);
+    ASSERT_GL_NO_ERROR();
+
+    // Save the loaded program again without querying its attributes.
+    ANGLE_GL_BINARY_ES3_PROGRAM(binaryProgram, binary, binaryFormat);
+    std::vector<uint8_t> reloadedBinary;
+    getBinary(binaryProgram, &reloadedBinary, &binaryFormat);
+    ASSERT_GL_NO_ERROR();
+
+    ANGLE_GL_BINARY_ES3_PROGRAM(reloadedProgram, reloadedBinary, binaryFormat);
+    expectAttributesAndDraw(reloadedProgram);
+    expectAttributesAndDraw(binaryProgram);
+}
+
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(ProgramBinaryES3Test);
 ANGLE_INSTANTIATE_TEST_ES3(ProgramBinaryES3Test);
 
@@ -1260,6 +1345,66 @@ void main() {
     ASSERT_GL_NO_ERROR();
 }
 
+// Tests that the buffer variables of a loaded program can be queried, including after the loaded
+// program is saved again before they were ever queried.
+TEST_P(ProgramBinaryES31Test, BufferVariablesAfterReload)
+{
+    ANGLE_SKIP_TEST_IF(getAvailableProgramBinaryFormatCount() == 0);
+
+    constexpr char kCS[] = R"(#version 310 es
+layout(local_size_x=1, local_size_y=1, local_size_z=1) in;
+layout(std430, binding = 0) buffer Block
+{
+    uint a;
+    vec4 b[2];
+} block;
+void main() {
+    block.b[1] = vec4(block.a);
+})";
+
+    auto getBinary = [](GLuint program, std::vector<uint8_t> *binary, GLenum *binaryFormat) {
+        GLint programLength = 0;
+        glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &programLength);
+        binary->resize(programLength);
+        GLsizei readLength = 0;
+        glGetProgramBinary(program, programLength, &readLength, binaryFormat, binary->data());
+        EXPECT_EQ(static_cast<GLsizei>(programLength), readLength);
+    };
+
+    auto expectBufferVariables = [](GLuint program) {
+        GLint activeResources = 0;
+        glGetProgramInterfaceiv(program, GL_BUFFER_VARIABLE, GL_ACTIVE_RESOURCES, &activeResources);
+        EXPECT_EQ(2, activeResources);
+
+        GLuint index = glGetProgramResourceIndex(program, GL_BUFFER_VARIABLE, "Block.b[0]");
+        EXPECT_NE(GL_INVALID_INDEX, index);
+
+        GLchar name[16] = {};
+        GLsizei length  = 0;
+        glGetProgramResourceName(program, GL_BUFFER_VARIABLE, index, sizeof(name), &length, name);
+        EXPECT_EQ("Block.b[0]", std::string(name, length));
+        EXPECT_GL_NO_ERROR();
+    };
+
+    ANGLE_GL_COMPUTE_PROGRAM(program, kCS);
+    expectBufferVariables(program);
+
+    std::vector<uint8_t> binary;
+    GLenum binaryFormat = GL_NONE;
+    getBinary(program, &binary, &binaryFormat);
+    ASSERT_GL_NO_ERROR();
+
+    // Save the loaded program again without querying its buffer variables.
+    ANGLE_GL_BINARY_ES3_PROGRAM(binaryProgram, binary, binaryFormat);
+    std::vector<uint8_t> reloadedBinary;
+    getBinary(binaryProgram, &reloadedBinary, &binaryFormat);
+    ASSERT_GL_NO_ERROR();
+
+    ANGLE_GL_BINARY_ES3_PROGRAM(reloadedProgram, reloadedBinary, binaryFormat);
+    expectBufferVariables(reloadedProgram);
+    expectBufferVariables(binaryProgram);
+}
+
 // Tests that saving and loading a program attached with computer shader.
 TEST_P(ProgramBinaryES31Test, ProgramBinaryWithAtomicCounterComputeShader)
 {
@@ -0,0 +1,205 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ThreadedCommandStreamTest:
+//   Tests that GL calls recorded by the command stream are executed in order with the calls that
+//   wait for it.  The tests are skipped without a build with angle_enable_command_stream.
+//
+
+#include "test_utils/ANGLETest.h"
+#include "test_utils/gl_raii.h"
+
+#include <thread>
+
+using namespace angle;
+
+namespace
+{
+
+class ThreadedCommandStreamTest : public ANGLETest<>
+{
+  protected:
+    ThreadedCommandStreamTest()
+    {
+        setWindowWidth(32);
+        setWindowHeight(32);
+        setConfigRedBits(8);
+        setConfigGreenBits(8);
+        setConfigBlueBits(8);
+        setConfigAlphaBits(8);
+    }
+
+    bool isCommandStreamEnabled()
+    {
+        return getEGLWindow()->isFeatureEnabled(Feature::ThreadedCommandStream);
+    }
+};
+
+void GL_APIENTRY RecordCallbackThread(GLenum source,
+                                      GLenum type,
+                                      GLuint id,
+                                      GLenum severity,
+                                      GLsizei length,
+                                      const GLchar *message,
+                                      const void *userParam)
+{
+    std::vector<std::thread::id> *threads =
+        static_cast<std::vector<std::thread::id> *>(const_cast<void *>(userParam));
+    threads->push_back(std::this_thread::get_id());
+}
+
+// Tests that recorded clears are visible to glReadPixels.
+TEST_P(ThreadedCommandStreamTest, ClearThenRead)
+{
+    ANGLE_SKIP_TEST_IF(!isCommandStreamEnabled());
+
+    glClearColor(1.0f, 0.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    glEnable(GL_SCISSOR_TEST);
+    glScissor(0, 0, 16, 32);
+    glClearColor(0.0f, 1.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glDisable(GL_SCISSOR_TEST);
+
+    EXPECT_PIXEL_RECT_EQ(0, 0, 16, 32, GLColor::green);
+    EXPECT_PIXEL_RECT_EQ(16, 0, 16, 32, GLColor::red);
+    ASSERT_GL_NO_ERROR();
+}
+
+// Tests that errors generated by recorded calls are returned by glGetError.
+TEST_P(ThreadedCommandStreamTest, RecordedCallError)
+{
+    ANGLE_SKIP_TEST_IF(!isCommandStreamEnabled());
+
+    glEnable(GL_TEXTURE_2D);
+    EXPECT_GL_ERROR(GL_INVALID_ENUM);
+
+    glLineWidth(-1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    EXPECT_GL_ERROR(GL_INVALID_VALUE);
+    EXPECT_GL_NO_ERROR();
+}
+
+// Tests that calls that take pointers see the state set by the recorded calls before them.
+TEST_P(ThreadedCommandStreamTest, DrawAfterRecordedState)
+{
+    ANGLE_SKIP_TEST_IF(!isCommandStreamEnabled());
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::UniformColor());
+    GLint colorLocation = glGetUniformLocation(program, essl1_shaders::ColorUniform());
+    ASSERT_NE(-1, colorLocation);
+
+    glUseProgram(program);
+    glUniform4f(colorLocation, 0.0f, 0.0f, 1.0f, 1.0f);
+    glViewport(0, 0, 16, 16);
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f, 1.0f, true);
+    glViewport(0, 0, getWindowWidth(), getWindowHeight());
+
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::blue);
+    ASSERT_GL_NO_ERROR();
+}
+
+// Tests recording more calls than fit in the stream at once.
+TEST_P(ThreadedCommandStreamTest, ManyCalls)
+{
+    ANGLE_SKIP_TEST_IF(!isCommandStreamEnabled());
+
+    constexpr int kIterations = 100000;
+    for (int iteration = 0; iteration < kIterations; ++iteration)
+    {
+        const float value = static_cast<float>(iteration % 256) / 255.0f;
+        glClearColor(value, 1.0f - value, 0.0f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        glFlush();
+    }
+
+    const GLubyte lastValue = static_cast<GLubyte>((kIterations - 1) % 256);
+    EXPECT_PIXEL_COLOR_NEAR(0, 0, GLColor(lastValue, 255 - lastValue, 0, 255), 1);
+    ASSERT_GL_NO_ERROR();
+}
+
+// Tests that draws from client arrays read the arrays before the application overwrites them.
+TEST_P(ThreadedCommandStreamTest, ClientArrayOverwrittenAfterDraw)
+{
+    ANGLE_SKIP_TEST_IF(!isCommandStreamEnabled());
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::UniformColor());
+    GLint colorLocation = glGetUniformLocation(program, essl1_shaders::ColorUniform());
+    ASSERT_NE(-1, colorLocation);
+    GLint positionLocation = glGetAttribLocation(program, essl1_shaders::PositionAttrib());
+    ASSERT_NE(-1, positionLocation);
+
+    // A quad that covers the left half of the window, then the right half.
+    constexpr std::array<GLfloat, 12> kLeftQuad = {
+        -1.0f, -1.0f, 0.0f, -1.0f, 0.0f, 1.0f, -1.0f, -1.0f, 0.0f, 1.0f, -1.0f, 1.0f,
+    };
+    constexpr std::array<GLfloat, 12> kRightQuad = {
+        0.0f, -1.0f, 1.0f, -1.0f, 1.0f, 1.0f, 0.0f, -1.0f, 1.0f, 1.0f, 0.0f, 1.0f,
+    };
+    std::array<GLfloat, 12> positions = kLeftQuad;
+
+    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    glUseProgram(program);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glVertexAttribPointer(positionLocation, 2, GL_FLOAT, GL_FALSE, 0, positions.data());
+    glEnableVertexAttribArray(positionLocation);
+
+    glUniform4f(colorLocation, 1.0f, 0.0f, 0.0f, 1.0f);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    positions = kRightQuad;
+
+    glUniform4f(colorLocation, 0.0f, 1.0f, 0.0f, 1.0f);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    positions.fill(0.0f);
+
+    EXPECT_PIXEL_RECT_EQ(0, 0, 16, 32, GLColor::red);
+    EXPECT_PIXEL_RECT_EQ(16, 0, 16, 32, GLColor::green);
+    ASSERT_GL_NO_ERROR();
+
+    // Draws are recorded again once the attributes are back in buffers.
+    GLBuffer buffer;
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(kLeftQuad), kLeftQuad.data(), GL_STATIC_DRAW);
+    glVertexAttribPointer(positionLocation, 2, GL_FLOAT, GL_FALSE, 0, nullptr);
+
+    glUniform4f(colorLocation, 0.0f, 0.0f, 1.0f, 1.0f);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+
+    EXPECT_PIXEL_RECT_EQ(0, 0, 16, 32, GLColor::blue);
+    EXPECT_PIXEL_RECT_EQ(16, 0, 16, 32, GLColor::green);
+    ASSERT_GL_NO_ERROR();
+}
+
+// Tests that the KHR_debug callback is called on the application thread, before the call that
+// triggers it returns.
+TEST_P(ThreadedCommandStreamTest, DebugCallbackOnApplicationThread)
+{
+    ANGLE_SKIP_TEST_IF(!isCommandStreamEnabled());
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled("GL_KHR_debug"));
+
+    std::vector<std::thread::id> threads;
+    glEnable(GL_DEBUG_OUTPUT_KHR);
+    glDebugMessageCallbackKHR(RecordCallbackThread, &threads);
+
+    glEnable(GL_TEXTURE_2D);
+    ASSERT_EQ(1u, threads.size());
+    EXPECT_EQ(std::this_thread::get_id(), threads[0]);
+    EXPECT_GL_ERROR(GL_INVALID_ENUM);
+
+    // Calls are recorded again once the callback is removed.
+    glDebugMessageCallbackKHR(nullptr, nullptr);
+    glEnable(GL_TEXTURE_2D);
+    EXPECT_GL_ERROR(GL_INVALID_ENUM);
+    EXPECT_EQ(1u, threads.size());
+}
+
+}  // anonymous namespace
+
+ANGLE_INSTANTIATE_TEST(ThreadedCommandStreamTest,
+                       ES2_VULKAN().enable(Feature::ThreadedCommandStream),
+                       ES3_VULKAN().enable(Feature::ThreadedCommandStream));
@@ -5577,6 +5577,69 @@ void main()
     }
 }
 
+// Test that glReadPixels into a pixel pack buffer with reversed row order is done on the GPU,
+// without submitting and waiting for the commands.  An integer format is used so that the copy is
+// done with a transfer command instead of a compute shader.
+TEST_P(VulkanPerformanceCounterTest, FlippedReadPixelsIntoPackBufferDoesNotWait)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled("GL_ANGLE_pack_reverse_row_order"));
+
+    constexpr GLsizei kWidth          = 4;
+    constexpr GLsizei kHeight         = 8;
+    constexpr GLsizei kPixelCount     = kWidth * kHeight;
+    constexpr GLsizei kPackBufferSize = sizeof(GLColor) * kPixelCount;
+
+    // Give every row its own value, so the order of the rows can be verified.
+    std::vector<GLColor> textureData(kPixelCount);
+    for (GLsizei y = 0; y < kHeight; ++y)
+    {
+        for (GLsizei x = 0; x < kWidth; ++x)
+        {
+            textureData[y * kWidth + x] = GLColor(y, x, 0, 1);
+        }
+    }
+
+    GLTexture texture;
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8UI, kWidth, kHeight);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, kWidth, kHeight, GL_RGBA_INTEGER, GL_UNSIGNED_BYTE,
+                    textureData.data());
+
+    GLFramebuffer framebuffer;
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture, 0);
+    ASSERT_GL_FRAMEBUFFER_COMPLETE(GL_FRAMEBUFFER);
+
+    GLBuffer packBuffer;
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, packBuffer);
+    glBufferData(GL_PIXEL_PACK_BUFFER, kPackBufferSize, nullptr, GL_STREAM_READ);
+    glPixelStorei(GL_PACK_REVERSE_ROW_ORDER_ANGLE, GL_TRUE);
+    ASSERT_GL_NO_ERROR();
+
+    const uint64_t expectedSubmitCallsTotal = getPerfCounters().vkQueueSubmitCallsTotal;
+
+    glReadPixels(0, 0, kWidth, kHeight, GL_RGBA_INTEGER, GL_UNSIGNED_BYTE, 0);
+    ASSERT_GL_NO_ERROR();
+
+    EXPECT_EQ(expectedSubmitCallsTotal, getPerfCounters().vkQueueSubmitCallsTotal);
+
+    // Verify that the rows are reversed.
+    std::vector<GLColor> actualData(kPixelCount);
+    void *mapPtr = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, kPackBufferSize, GL_MAP_READ_BIT);
+    ASSERT_NE(nullptr, mapPtr);
+    memcpy(actualData.data(), mapPtr, kPackBufferSize);
+    glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+
+    for (GLsizei y = 0; y < kHeight; ++y)
+    {
+        for (GLsizei x = 0; x < kWidth; ++x)
+        {
+            EXPECT_EQ(textureData[(kHeight - 1 - y) * kWidth + x], actualData[y * kWidth + x])
+                << "x: " << x << ", y: " << y;
+        }
+    }
+}
+
 // Test that mapping a buffer that the GPU is using as read-only ghosts the buffer, rather than
 // waiting for the GPU access to complete before returning a pointer to the buffer.
 void VulkanPerformanceCounterTest::mappingGpuReadOnlyBufferGhostsBuffer(BufferUpdate update)
@@ -5690,6 +5753,103 @@ TEST_P(VulkanPerformanceCounterTest, MappingGpuReadOnlyBufferGhostsBuffer_Copy)
     mappingGpuReadOnlyBufferGhostsBuffer(BufferUpdate::Copy);
 }
 
+// Test that when a ghosted buffer is rewritten in pieces before it's used, only the parts of the
+// previous contents that weren't overwritten are carried over.
+TEST_P(VulkanPerformanceCounterTest, GhostedBufferCopiesOnlyUntouchedRanges)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled(kPerfMonitorExtensionName));
+
+    constexpr size_t kColorsPerVector = 4;
+    constexpr size_t kVectorCount     = 3;
+    constexpr size_t kVectorSize      = kColorsPerVector * sizeof(GLColor);
+
+    std::array<GLColor, kColorsPerVector * kVectorCount> initialData;
+    initialData.fill(GLColor::red);
+    std::array<GLColor, kColorsPerVector * kVectorCount> updateData;
+    updateData.fill(GLColor::white);
+
+    GLBuffer buffer;
+    glBindBuffer(GL_UNIFORM_BUFFER, buffer);
+    glBufferData(GL_UNIFORM_BUFFER, sizeof(initialData), initialData.data(), GL_DYNAMIC_DRAW);
+    glBindBufferBase(GL_UNIFORM_BUFFER, 0, buffer);
+    ASSERT_GL_NO_ERROR();
+
+    constexpr char kVerifyUBO[] = R"(#version 300 es
+precision mediump float;
+uniform block {
+    uvec4 data[3];
+} ubo;
+uniform uint expectUpdated;
+uniform uint expectLast;
+out vec4 colorOut;
+void main()
+{
+    if (all(equal(ubo.data[0], uvec4(expectUpdated))) &&
+        all(equal(ubo.data[1], uvec4(expectUpdated))) &&
+        all(equal(ubo.data[2], uvec4(expectLast))))
+        colorOut = vec4(0, 1.0, 0, 1.0);
+    else
+        colorOut = vec4(1.0, 0, 0, 1.0);
+})";
+
+    ANGLE_GL_PROGRAM(verifyUbo, essl3_shaders::vs::Simple(), kVerifyUBO);
+    glUseProgram(verifyUbo);
+
+    GLint expectUpdatedLoc = glGetUniformLocation(verifyUbo, "expectUpdated");
+    ASSERT_NE(-1, expectUpdatedLoc);
+    GLint expectLastLoc = glGetUniformLocation(verifyUbo, "expectLast");
+    ASSERT_NE(-1, expectLastLoc);
+
+    // Every draw outputs green on success and red on failure.  Blending with GL_MIN leaves green
+    // only if all draws succeed, without reading back in between, which would wait for the GPU.
+    glClearColor(1, 1, 1, 1);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glEnable(GL_BLEND);
+    glBlendEquation(GL_MIN);
+
+    glUniform1ui(expectUpdatedLoc, GLColor::red.asUint());
+    glUniform1ui(expectLastLoc, GLColor::red.asUint());
+    drawQuad(verifyUbo, essl3_shaders::PositionAttrib(), 0.5);
+    ASSERT_GL_NO_ERROR();
+
+    const uint64_t expectedBuffersGhosted = getPerfCounters().buffersGhosted + 1;
+    const uint64_t expectedBytesSkipped   = getPerfCounters().ghostedBufferBytesSkipped;
+
+    // Overwrite the first two vectors while the GPU is reading the buffer.  This ghosts the buffer,
+    // and the last vector must be carried over.
+    void *mappedBuffer = glMapBufferRange(GL_UNIFORM_BUFFER, 0, 2 * kVectorSize,
+                                          GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT);
+    ASSERT_NE(nullptr, mappedBuffer);
+    memcpy(mappedBuffer, updateData.data(), 2 * kVectorSize);
+    glUnmapBuffer(GL_UNIFORM_BUFFER);
+    ASSERT_GL_NO_ERROR();
+    EXPECT_EQ(getPerfCounters().buffersGhosted, expectedBuffersGhosted);
+
+    glUniform1ui(expectUpdatedLoc, GLColor::white.asUint());
+    drawQuad(verifyUbo, essl3_shaders::PositionAttrib(), 0.5);
+    ASSERT_GL_NO_ERROR();
+    EXPECT_EQ(getPerfCounters().ghostedBufferBytesSkipped, expectedBytesSkipped);
+
+    // Do the same, but overwrite the last vector with glBufferSubData before the buffer is used.
+    // Nothing needs to be carried over.
+    mappedBuffer = glMapBufferRange(GL_UNIFORM_BUFFER, 0, 2 * kVectorSize,
+                                    GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT);
+    ASSERT_NE(nullptr, mappedBuffer);
+    memcpy(mappedBuffer, initialData.data(), 2 * kVectorSize);
+    glUnmapBuffer(GL_UNIFORM_BUFFER);
+    glBufferSubData(GL_UNIFORM_BUFFER, 2 * kVectorSize, kVectorSize, updateData.data());
+    ASSERT_GL_NO_ERROR();
+    EXPECT_EQ(getPerfCounters().buffersGhosted, expectedBuffersGhosted + 1);
+    EXPECT_EQ(getPerfCounters().ghostedBufferBytesSkipped, expectedBytesSkipped + kVectorSize);
+
+    glUniform1ui(expectUpdatedLoc, GLColor::red.asUint());
+    glUniform1ui(expectLastLoc, GLColor::white.asUint());
+    drawQuad(verifyUbo, essl3_shaders::PositionAttrib(), 0.5);
+    ASSERT_GL_NO_ERROR();
+
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+}
+
 void VulkanPerformanceCounterTest::partialBufferUpdateShouldNotBreakRenderPass(BufferUpdate update)
 {
     ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled(kPerfMonitorExtensionName));
@@ -7317,6 +7477,53 @@ TEST_P(VulkanPerformanceCounterTest, TextureDescriptorsAreShared)
     }
 }
 
+// Verifies that switching back and forth between programs that sample the same textures reuses
+// the programs' texture descriptor sets, and that this counts as cache hits.
+TEST_P(VulkanPerformanceCounterTest, TextureDescriptorsReusedWhenSwitchingPrograms)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled(kPerfMonitorExtensionName));
+
+    ANGLE_GL_PROGRAM(testProgram1, essl1_shaders::vs::Texture2D(), essl1_shaders::fs::Texture2D());
+    ANGLE_GL_PROGRAM(testProgram2, essl1_shaders::vs::Texture2D(), essl1_shaders::fs::Texture2D());
+
+    GLTexture texture;
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, &GLColor::red);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+    setupQuadVertexBuffer(0.5f, 1.0f);
+
+    // Warm up both programs.
+    glUseProgram(testProgram1);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    glUseProgram(testProgram2);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    ASSERT_GL_NO_ERROR();
+
+    ANGLE_SKIP_TEST_IF(getPerfCounters().descriptorSetCacheTotalSize == 0);
+
+    const angle::VulkanPerfCounters expected = getPerfCounters();
+
+    constexpr uint32_t kIterations = 10;
+    for (uint32_t iteration = 0; iteration < kIterations; ++iteration)
+    {
+        glUseProgram(testProgram1);
+        glDrawArrays(GL_TRIANGLES, 0, 6);
+        glUseProgram(testProgram2);
+        glDrawArrays(GL_TRIANGLES, 0, 6);
+    }
+    ASSERT_GL_NO_ERROR();
+
+    const angle::VulkanPerfCounters actual = getPerfCounters();
+    EXPECT_EQ(expected.descriptorSetAllocations, actual.descriptorSetAllocations);
+    EXPECT_EQ(expected.textureDescriptorSetCacheMisses, actual.textureDescriptorSetCacheMisses);
+    EXPECT_GE(actual.textureDescriptorSetCacheHits,
+              expected.textureDescriptorSetCacheHits + 2 * kIterations);
+
+    EXPECT_PIXEL_COLOR_EQ(getWindowWidth() / 2, getWindowHeight() / 2, GLColor::red);
+}
+
 // Verifies that we share Uniform Buffer descriptor sets between programs.
 TEST_P(VulkanPerformanceCounterTest, UniformBufferDescriptorsAreShared)
 {
@@ -8176,6 +8383,56 @@ TEST_P(VulkanPerformanceCounterTest,
     ASSERT_GL_NO_ERROR();
 }
 
+// Tests that updating part of a vertex buffer that is converted on the CPU converts only the
+// updated vertices again.
+TEST_P(VulkanPerformanceCounterTest, PartialBufferUpdateConvertsOnlyDirtyVertices)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled(kPerfMonitorExtensionName));
+
+    // GL_FIXED has no Vulkan equivalent, and the unaligned offset makes the conversion happen on
+    // the CPU.
+    constexpr GLsizei kVertexCount = 1024;
+    constexpr GLsizei kStride      = 2 * sizeof(GLfixed);
+    constexpr GLintptr kOffset     = 2;
+
+    std::vector<GLfixed> vertices(2 * kVertexCount + 1, 0);
+    GLBuffer buffer;
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(GLfixed), vertices.data(),
+                 GL_STATIC_DRAW);
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::Red());
+    glUseProgram(program);
+    GLint positionLocation = glGetAttribLocation(program, essl1_shaders::PositionAttrib());
+    ASSERT_NE(-1, positionLocation);
+    glVertexAttribPointer(positionLocation, 2, GL_FIXED, GL_FALSE, kStride,
+                          reinterpret_cast<const void *>(kOffset));
+    glEnableVertexAttribArray(positionLocation);
+
+    uint64_t convertedBytes = getPerfCounters().vertexBytesConvertedOnCPU;
+    glDrawArrays(GL_POINTS, 0, kVertexCount);
+    ASSERT_GL_NO_ERROR();
+    const uint64_t fullConversionBytes =
+        getPerfCounters().vertexBytesConvertedOnCPU - convertedBytes;
+    ANGLE_SKIP_TEST_IF(fullConversionBytes == 0);
+
+    // Update a single vertex in the middle of the buffer.
+    const GLfixed vertex[2] = {1 << 16, 1 << 16};
+    glBufferSubData(GL_ARRAY_BUFFER, kOffset + (kVertexCount / 2) * kStride, sizeof(vertex),
+                    vertex);
+
+    convertedBytes = getPerfCounters().vertexBytesConvertedOnCPU;
+    glDrawArrays(GL_POINTS, 0, kVertexCount);
+    ASSERT_GL_NO_ERROR();
+    const uint64_t partialConversionBytes =
+        getPerfCounters().vertexBytesConvertedOnCPU - convertedBytes;
+
+    // The dirty range may be widened to a few vertices to keep the conversion aligned.
+    EXPECT_GT(partialConversionBytes, 0u);
+    EXPECT_LE(partialConversionBytes, 4 * 2 * sizeof(float));
+    EXPECT_LT(partialConversionBytes, fullConversionBytes);
+}
+
 class VulkanPerformanceCounterTest_AsyncCQ : public VulkanPerformanceCounterTest
 {};
 
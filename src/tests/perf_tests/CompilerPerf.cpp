@@ -162,6 +162,82 @@ void main()
 
 const char *kTrickyESSL300Id = "TrickyESSL300";
 
+// Generated shaders often wrap most of their code in macros.  This shader spends a large share of
+// its compile time in the preprocessor.
+const char *kMacroHeavyESSL300FragSource = R"(#version 300 es
+precision highp float;
+
+#define SATURATE(x) clamp((x), 0.0, 1.0)
+#define LUMA(c) dot((c).rgb, vec3(0.299, 0.587, 0.114))
+#define MIX3(a, b, c, t) mix(mix((a), (b), SATURATE(t)), (c), SATURATE((t) - 1.0))
+#define TAP(i) texture(uTex, vUV + uOffsets[i] * uScale)
+#define WEIGHT(i) (uWeights[i] * SATURATE(LUMA(TAP(i)) + uBias))
+#define ACCUM(i) sum += TAP(i) * WEIGHT(i); total += WEIGHT(i);
+#define ACCUM4(i) ACCUM(i) ACCUM(i + 1) ACCUM(i + 2) ACCUM(i + 3)
+#define ACCUM16(i) ACCUM4(i) ACCUM4(i + 4) ACCUM4(i + 8) ACCUM4(i + 12)
+
+uniform sampler2D uTex;
+uniform vec2 uOffsets[16];
+uniform float uWeights[16];
+uniform float uScale;
+uniform float uBias;
+in vec2 vUV;
+out vec4 my_FragColor;
+
+void main()
+{
+    vec4 sum    = vec4(0.0);
+    float total = 0.0;
+    ACCUM16(0)
+    vec4 color = sum / max(total, 0.0001);
+    my_FragColor = MIX3(color, color.bgra, color.gbra, LUMA(color) * 2.0);
+})";
+
+const char *kMacroHeavyESSL300Id = "MacroHeavyESSL300";
+
+// Object-like macros are expanded from the macro's own replacement list, without copying it.
+// Their replacement lists use identifiers too long for the small-string buffer.
+const char *kObjectMacroESSL300FragSource = R"(#version 300 es
+precision highp float;
+
+#define MATERIAL_BASE_COLOR (u_materialParameters.baseColorFactor.rgb * u_materialParameters.occlusionStrength)
+#define AMBIENT_LIGHT (u_lightingEnvironment.ambientIntensity * u_lightingEnvironment.ambientColor)
+#define DIRECTIONAL_LIGHT (u_lightingEnvironment.directionalColor * max(dot(v_worldNormal, u_lightingEnvironment.directionalDirection), 0.0))
+#define SAMPLE_MATERIAL (texture(u_baseColorTexture, v_textureCoordinates).rgb * MATERIAL_BASE_COLOR)
+#define LIGHT_FACTOR (AMBIENT_LIGHT + DIRECTIONAL_LIGHT)
+#define ACCUMULATE_LIGHTING color += SAMPLE_MATERIAL * LIGHT_FACTOR;
+
+struct MaterialParameters
+{
+    vec4 baseColorFactor;
+    float occlusionStrength;
+};
+struct LightingEnvironment
+{
+    vec3 ambientColor;
+    float ambientIntensity;
+    vec3 directionalColor;
+    vec3 directionalDirection;
+};
+uniform MaterialParameters u_materialParameters;
+uniform LightingEnvironment u_lightingEnvironment;
+uniform sampler2D u_baseColorTexture;
+in vec2 v_textureCoordinates;
+in vec3 v_worldNormal;
+out vec4 my_FragColor;
+
+void main()
+{
+    vec3 color = vec3(0.0);
+    ACCUMULATE_LIGHTING ACCUMULATE_LIGHTING ACCUMULATE_LIGHTING ACCUMULATE_LIGHTING
+    ACCUMULATE_LIGHTING ACCUMULATE_LIGHTING ACCUMULATE_LIGHTING ACCUMULATE_LIGHTING
+    ACCUMULATE_LIGHTING ACCUMULATE_LIGHTING ACCUMULATE_LIGHTING ACCUMULATE_LIGHTING
+    ACCUMULATE_LIGHTING ACCUMULATE_LIGHTING ACCUMULATE_LIGHTING ACCUMULATE_LIGHTING
+    my_FragColor = vec4(color, 1.0);
+})";
+
+const char *kObjectMacroESSL300Id = "ObjectMacroESSL300";
+
 constexpr int kNumIterationsPerStep = 4;
 
 struct CompilerParameters
@@ -222,15 +298,23 @@ struct CompilerPerfParameters final : public CompilerParameters
 {
     CompilerPerfParameters(ShShaderOutput output,
                            const char *shaderSource,
-                           const char *shaderSourceId)
-        : CompilerParameters(output), shaderSource(shaderSource)
+                           const char *shaderSourceId,
+                           bool passTiming = false)
+        : CompilerParameters(output), shaderSource(shaderSource), passTiming(passTiming)
     {
         testId = shaderSourceId;
         testId += "_";
         testId += CompilerParameters::str();
+        if (passTiming)
+        {
+            testId += "_pass_timing";
+        }
     }
 
     const char *shaderSource;
+    // Also reports the time spent in each translator pass.  Measuring it slightly slows down
+    // compilation, so it's done in separate tests.
+    bool passTiming;
     std::string testId;
 };
 
@@ -251,11 +335,14 @@ class CompilerPerfTest : public ANGLEPerfTest,
     void SetUp() override;
     void TearDown() override;
 
+    void recordPassTimings();
+
   protected:
     void setTestShader(const char *str) { mTestShader = str; }
 
   private:
     const char *mTestShader;
+    size_t mCompileCount;
 
     ShBuiltInResources mResources;
     angle::PoolAllocator mAllocator;
@@ -263,7 +350,8 @@ class CompilerPerfTest : public ANGLEPerfTest,
 };
 
 CompilerPerfTest::CompilerPerfTest()
-    : ANGLEPerfTest("CompilerPerf", "", GetParam().testId, kNumIterationsPerStep)
+    : ANGLEPerfTest("CompilerPerf", "", GetParam().testId, kNumIterationsPerStep),
+      mCompileCount(0)
 {}
 
 void CompilerPerfTest::SetUp()
@@ -283,6 +371,10 @@ void CompilerPerfTest::SetUp()
     {
         SafeDelete(mTranslator);
     }
+    else if (params.passTiming)
+    {
+        mTranslator->enablePassTiming();
+    }
 
     setTestShader(params.shaderSource);
 }
@@ -315,17 +407,39 @@ void CompilerPerfTest::step()
         std::cout << "Compiling perf test shader failed with log:\n"
                   << mTranslator->getInfoSink().info.c_str();
     }
+    ++mCompileCount;
 #endif
 
     for (unsigned int iteration = 0; iteration < kNumIterationsPerStep; ++iteration)
     {
         mTranslator->compile(shaderStrings, 1, compileOptions);
     }
+    mCompileCount += kNumIterationsPerStep;
+}
+
+// Reports the average time per compile of each pass that ran.
+void CompilerPerfTest::recordPassTimings()
+{
+    if (mTranslator == nullptr || mCompileCount == 0)
+    {
+        return;
+    }
+
+    for (const sh::PassTiming &timing : mTranslator->getPassTimings())
+    {
+        const std::string metric = ".pass_" + timing.name;
+        recordDoubleMetric(metric.c_str(), timing.seconds * 1e6 / mCompileCount, "us");
+    }
 }
 
 TEST_P(CompilerPerfTest, Run)
 {
     run();
+
+    if (GetParam().passTiming)
+    {
+        recordPassTimings();
+    }
 }
 
 ANGLE_INSTANTIATE_TEST(
@@ -334,15 +448,35 @@ ANGLE_INSTANTIATE_TEST(
     CompilerPerfParameters(SH_HLSL_4_1_OUTPUT, kSimpleESSL300FragSource, kSimpleESSL300Id),
     CompilerPerfParameters(SH_HLSL_4_1_OUTPUT, kRealWorldESSL100FragSource, kRealWorldESSL100Id),
     CompilerPerfParameters(SH_HLSL_4_1_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id),
+    CompilerPerfParameters(SH_HLSL_4_1_OUTPUT, kMacroHeavyESSL300FragSource, kMacroHeavyESSL300Id),
     CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT, kSimpleESSL100FragSource, kSimpleESSL100Id),
     CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT, kSimpleESSL300FragSource, kSimpleESSL300Id),
     CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT,
                            kRealWorldESSL100FragSource,
                            kRealWorldESSL100Id),
     CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id),
+    CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT,
+                           kMacroHeavyESSL300FragSource,
+                           kMacroHeavyESSL300Id),
     CompilerPerfParameters(SH_ESSL_OUTPUT, kSimpleESSL100FragSource, kSimpleESSL100Id),
     CompilerPerfParameters(SH_ESSL_OUTPUT, kSimpleESSL300FragSource, kSimpleESSL300Id),
     CompilerPerfParameters(SH_ESSL_OUTPUT, kRealWorldESSL100FragSource, kRealWorldESSL100Id),
-    CompilerPerfParameters(SH_ESSL_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id));
+    CompilerPerfParameters(SH_ESSL_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id),
+    CompilerPerfParameters(SH_ESSL_OUTPUT, kMacroHeavyESSL300FragSource, kMacroHeavyESSL300Id),
+    CompilerPerfParameters(SH_ESSL_OUTPUT, kObjectMacroESSL300FragSource, kObjectMacroESSL300Id),
+    CompilerPerfParameters(SH_HLSL_4_1_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id, true),
+    CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT,
+                           kTrickyESSL300FragSource,
+                           kTrickyESSL300Id,
+                           true),
+    CompilerPerfParameters(SH_ESSL_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id, true),
+    CompilerPerfParameters(SH_ESSL_OUTPUT,
+                           kMacroHeavyESSL300FragSource,
+                           kMacroHeavyESSL300Id,
+                           true),
+    CompilerPerfParameters(SH_ESSL_OUTPUT,
+                           kObjectMacroESSL300FragSource,
+                           kObjectMacroESSL300Id,
+                           true));
 
 }  // anonymous namespace
@@ -29,6 +29,7 @@ enum class StateChange
     Scissor,
     ManyTextureDraw,
     Uniform,
+    RedundantState,
     InvalidEnum,
     EnumCount = InvalidEnum,
 };
@@ -81,6 +82,9 @@ std::string DrawArraysPerfParams::story() const
         case StateChange::Uniform:
             strstr << "_uniform";
             break;
+        case StateChange::RedundantState:
+            strstr << "_redundant_state";
+            break;
         default:
             break;
     }
@@ -569,6 +573,33 @@ void UpdateUniformThenDraw(unsigned int iterations, GLsizei numElements)
     }
 }
 
+// Changes the state and changes it back before every draw.  The draws don't change, but the
+// backend may see the state as dirty and record the commands to set it again.
+void ChangeStateBackThenDraw(unsigned int iterations,
+                             GLsizei numElements,
+                             GLuint buffer1,
+                             GLuint buffer2,
+                             unsigned int windowWidth,
+                             unsigned int windowHeight)
+{
+    glEnable(GL_SCISSOR_TEST);
+
+    for (unsigned int it = 0; it < iterations; it++)
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, buffer2);
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, 0);
+        glBindBuffer(GL_ARRAY_BUFFER, buffer1);
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, 0);
+
+        glViewport(0, 0, windowWidth / 2, windowHeight / 2);
+        glViewport(0, 0, windowWidth, windowHeight);
+        glScissor(0, 0, windowWidth / 2, windowHeight / 2);
+        glScissor(0, 0, windowWidth, windowHeight);
+
+        glDrawArrays(GL_TRIANGLES, 0, numElements);
+    }
+}
+
 void DrawCallPerfBenchmark::drawBenchmark()
 {
     // This workaround fixes a huge queue of graphics commands accumulating on the GL
@@ -625,6 +656,10 @@ void DrawCallPerfBenchmark::drawBenchmark()
         case StateChange::Uniform:
             UpdateUniformThenDraw(params.iterationsPerStep, numElements);
             break;
+        case StateChange::RedundantState:
+            ChangeStateBackThenDraw(params.iterationsPerStep, numElements, mBuffer1, mBuffer2,
+                                    getWindow()->getWidth(), getWindow()->getHeight());
+            break;
         case StateChange::InvalidEnum:
             ADD_FAILURE() << "Invalid state change.";
             break;
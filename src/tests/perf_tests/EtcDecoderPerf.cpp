@@ -0,0 +1,174 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// EtcDecoderPerf:
+//   Performance test for the software ETC and EAC decoders, used when the device doesn't support
+//   the compressed formats.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <gmock/gmock.h>
+
+#include "common/WorkerThread.h"
+#include "image_util/loadimage.h"
+
+using namespace testing;
+
+namespace
+{
+using angle::ImageLoadContext;
+using angle::WorkerThreadPool;
+
+enum class EtcLoad
+{
+    ETC2RGBA8ToRGBA8,
+    ETC2RGB8ToBC1,
+    EACRG11ToRG16F,
+};
+
+struct EtcDecoderParams
+{
+    EtcLoad load;
+    uint32_t size;
+    bool multiThreaded;
+};
+
+std::ostream &operator<<(std::ostream &os, const EtcDecoderParams &params)
+{
+    constexpr const char *kLoadNames[] = {"ETC2RGBA8ToRGBA8", "ETC2RGB8ToBC1", "EACRG11ToRG16F"};
+
+    os << kLoadNames[static_cast<size_t>(params.load)] << "_" << params.size << "x"
+       << params.size << (params.multiThreaded ? "_multithreaded" : "_singlethreaded");
+    return os;
+}
+
+// Returns the bytes per source block and per destination block (or pixel, if |isPixel|).
+void GetLoadSizes(EtcLoad load, size_t *sourceBlockBytes, size_t *destBytes, bool *isPixel)
+{
+    switch (load)
+    {
+        case EtcLoad::ETC2RGBA8ToRGBA8:
+            *sourceBlockBytes = 16;
+            *destBytes        = 4;
+            *isPixel          = true;
+            break;
+        case EtcLoad::ETC2RGB8ToBC1:
+            *sourceBlockBytes = 8;
+            *destBytes        = 8;
+            *isPixel          = false;
+            break;
+        case EtcLoad::EACRG11ToRG16F:
+            *sourceBlockBytes = 16;
+            *destBytes        = 4;
+            *isPixel          = true;
+            break;
+    }
+}
+
+class EtcDecoderPerfTest : public ANGLEPerfTest, public WithParamInterface<EtcDecoderParams>
+{
+  public:
+    EtcDecoderPerfTest();
+
+    void step() override;
+
+    std::string getName();
+
+    ImageLoadContext mLoadContext;
+    size_t mInputRowPitch;
+    size_t mOutputRowPitch;
+    std::vector<uint8_t> mInput;
+    std::vector<uint8_t> mOutput;
+};
+
+EtcDecoderPerfTest::EtcDecoderPerfTest() : ANGLEPerfTest(getName(), "", "_run", 1, "us")
+{
+    const size_t size       = GetParam().size;
+    const size_t blockCount = (size + 3) / 4;
+
+    size_t sourceBlockBytes = 0;
+    size_t destBytes        = 0;
+    bool isPixel            = false;
+    GetLoadSizes(GetParam().load, &sourceBlockBytes, &destBytes, &isPixel);
+
+    mInputRowPitch  = blockCount * sourceBlockBytes;
+    mOutputRowPitch = isPixel ? size * destBytes : blockCount * destBytes;
+    mInput.resize(mInputRowPitch * blockCount);
+    mOutput.resize(mOutputRowPitch * (isPixel ? size : blockCount));
+
+    // Arbitrary bits exercise all the block modes.
+    for (size_t i = 0; i < mInput.size(); ++i)
+    {
+        mInput[i] = static_cast<uint8_t>((i * 2654435761u) >> 13);
+    }
+
+    mLoadContext.singleThreadPool = WorkerThreadPool::Create(1, ANGLEPlatformCurrent());
+    if (GetParam().multiThreaded)
+    {
+        mLoadContext.multiThreadPool = WorkerThreadPool::Create(0, ANGLEPlatformCurrent());
+    }
+}
+
+void EtcDecoderPerfTest::step()
+{
+    const size_t size        = GetParam().size;
+    const size_t inputDepth  = mInputRowPitch * ((size + 3) / 4);
+    const size_t outputDepth = mOutput.size();
+    const uint8_t *input     = mInput.data();
+    uint8_t *output          = mOutput.data();
+
+    switch (GetParam().load)
+    {
+        case EtcLoad::ETC2RGBA8ToRGBA8:
+            angle::LoadETC2RGBA8ToRGBA8(mLoadContext, size, size, 1, input, mInputRowPitch,
+                                        inputDepth, output, mOutputRowPitch, outputDepth);
+            break;
+        case EtcLoad::ETC2RGB8ToBC1:
+            angle::LoadETC2RGB8ToBC1(mLoadContext, size, size, 1, input, mInputRowPitch,
+                                     inputDepth, output, mOutputRowPitch, outputDepth);
+            break;
+        case EtcLoad::EACRG11ToRG16F:
+            angle::LoadEACRG11ToRG16F(mLoadContext, size, size, 1, input, mInputRowPitch,
+                                      inputDepth, output, mOutputRowPitch, outputDepth);
+            break;
+    }
+}
+
+std::string EtcDecoderPerfTest::getName()
+{
+    std::stringstream ss;
+    ss << UnitTest::GetInstance()->current_test_suite()->name() << "/" << GetParam();
+    return ss.str();
+}
+
+// Measures the speed of decoding ETC and EAC textures on the CPU.
+TEST_P(EtcDecoderPerfTest, Run)
+{
+    this->run();
+}
+
+std::vector<EtcDecoderParams> GetAllParams()
+{
+    std::vector<EtcDecoderParams> params;
+    for (EtcLoad load :
+         {EtcLoad::ETC2RGBA8ToRGBA8, EtcLoad::ETC2RGB8ToBC1, EtcLoad::EACRG11ToRG16F})
+    {
+        // Both sizes have more than the 16K blocks that the decoders need to use the worker
+        // threads, so the multi-threaded variants do run in parallel.
+        for (uint32_t size : {1024u, 2048u})
+        {
+            for (bool multiThreaded : {false, true})
+            {
+                params.push_back({load, size, multiThreaded});
+            }
+        }
+    }
+    return params;
+}
+
+INSTANTIATE_TEST_SUITE_P(, EtcDecoderPerfTest, ValuesIn(GetAllParams()), PrintToStringParamName());
+
+}  // anonymous namespace
@@ -21,6 +21,8 @@ using namespace angle;
 namespace
 {
 constexpr unsigned int kIterationsPerStep = 5;
+// Large texture atlases are where mipmap generation on the CPU is most costly.
+constexpr GLsizei kAtlasSize = 4096;
 
 struct GenerateMipmapParams final : public RenderTestParams
 {
@@ -68,6 +70,11 @@ std::string GenerateMipmapParams::story() const
         strstr << "_rgb";
     }
 
+    if (textureWidth >= kAtlasSize)
+    {
+        strstr << "_atlas";
+    }
+
     return strstr.str();
 }
 
@@ -332,6 +339,13 @@ GenerateMipmapParams VulkanParams(bool webglCompat, bool singleIteration, bool e
     return params;
 }
 
+GenerateMipmapParams Atlas(GenerateMipmapParams params)
+{
+    params.textureWidth  = kAtlasSize;
+    params.textureHeight = kAtlasSize;
+    return params;
+}
+
 }  // anonymous namespace
 
 TEST_P(GenerateMipmapBenchmark, Run)
@@ -356,7 +370,10 @@ ANGLE_INSTANTIATE_TEST(GenerateMipmapBenchmark,
                        VulkanParams(false, false, false),
                        VulkanParams(true, false, false),
                        VulkanParams(false, false, true),
-                       VulkanParams(true, false, true));
+                       VulkanParams(true, false, true),
+                       Atlas(OpenGLOrGLESParams(false, false)),
+                       Atlas(VulkanParams(false, false, false)),
+                       Atlas(VulkanParams(false, false, true)));
 
 ANGLE_INSTANTIATE_TEST(GenerateMipmapWithRedefineBenchmark,
                        D3D11Params(false, true),
@@ -368,4 +385,7 @@ ANGLE_INSTANTIATE_TEST(GenerateMipmapWithRedefineBenchmark,
                        VulkanParams(false, true, false),
                        VulkanParams(true, true, false),
                        VulkanParams(false, true, true),
-                       VulkanParams(true, true, true));
+                       VulkanParams(true, true, true),
+                       Atlas(OpenGLOrGLESParams(false, true)),
+                       Atlas(VulkanParams(false, true, false)),
+                       Atlas(VulkanParams(false, true, true)));
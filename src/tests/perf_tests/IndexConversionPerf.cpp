@@ -4,7 +4,7 @@
 // found in the LICENSE file.
 //
 // IndexConversionPerf:
-//   Performance tests for ANGLE index conversion in D3D11.
+//   Performance tests for ANGLE index conversion and index range computation.
 //
 
 #include "ANGLEPerfTest.h"
@@ -27,6 +27,11 @@ struct IndexConversionPerfParams final : public RenderTestParams
             strstr << "_index_range";
         }
 
+        if (partialUpdate)
+        {
+            strstr << "_partial_update";
+        }
+
         strstr << RenderTestParams::story();
 
         return strstr.str();
@@ -36,6 +41,9 @@ struct IndexConversionPerfParams final : public RenderTestParams
 
     // A second test, which covers using index ranges with an offset.
     unsigned int indexRangeOffset;
+
+    // A third test, which updates a few indices each step and draws ranges that weren't updated.
+    bool partialUpdate = false;
 };
 
 // Provide a custom gtest parameter name function for IndexConversionPerfParams.
@@ -59,6 +67,7 @@ class IndexConversionPerfTest : public ANGLERenderTest,
     void updateBufferData();
     void drawConversion();
     void drawIndexRange();
+    void drawPartialUpdate();
 
     GLuint mProgram;
     GLuint mVertexBuffer;
@@ -95,8 +104,8 @@ void IndexConversionPerfTest::initializeBenchmark()
     // Initialize the index buffer
     for (unsigned int triIndex = 0; triIndex < params.numIndexTris; ++triIndex)
     {
-        // Handle two different types of tests, one with index conversion triggered by a -1 index.
-        if (params.indexRangeOffset == 0)
+        // Only the conversion test triggers index conversion with a -1 index.
+        if (params.indexRangeOffset == 0 && !params.partialUpdate)
         {
             mIndexData.push_back(std::numeric_limits<GLushort>::max());
         }
@@ -136,7 +145,11 @@ void IndexConversionPerfTest::drawBenchmark()
 {
     const auto &params = GetParam();
 
-    if (params.indexRangeOffset == 0)
+    if (params.partialUpdate)
+    {
+        drawPartialUpdate();
+    }
+    else if (params.indexRangeOffset == 0)
     {
         drawConversion();
     }
@@ -183,6 +196,29 @@ void IndexConversionPerfTest::drawIndexRange()
     ASSERT_GL_NO_ERROR();
 }
 
+void IndexConversionPerfTest::drawPartialUpdate()
+{
+    const auto &params = GetParam();
+
+    // The first triangle is rewritten every step.  The rest of the buffer is drawn in a few large
+    // ranges whose index ranges stay cached.
+    constexpr unsigned int kRangeCount = 8;
+    const unsigned int rangeTris       = (params.numIndexTris - 1) / kRangeCount;
+
+    const GLushort firstIndex = static_cast<GLushort>(getNumStepsPerformed() % 3);
+    const GLushort triangle[] = {firstIndex, 1, 2};
+    glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, sizeof(triangle), triangle);
+
+    for (unsigned int it = 0; it < params.iterationsPerStep; it++)
+    {
+        const size_t offset = (1 + (it % kRangeCount) * rangeTris) * 3 * sizeof(GLushort);
+        glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(rangeTris * 3), GL_UNSIGNED_SHORT,
+                       reinterpret_cast<void *>(offset));
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
 IndexConversionPerfParams IndexConversionPerfD3D11Params()
 {
     IndexConversionPerfParams params;
@@ -211,6 +247,21 @@ IndexConversionPerfParams IndexRangeOffsetPerfD3D11Params()
     return params;
 }
 
+IndexConversionPerfParams PartialUpdatePerfParams(const EGLPlatformParameters &eglParameters)
+{
+    IndexConversionPerfParams params;
+    params.eglParameters     = eglParameters;
+    params.majorVersion      = 2;
+    params.minorVersion      = 0;
+    params.windowWidth       = 256;
+    params.windowHeight      = 256;
+    params.iterationsPerStep = 64;
+    params.numIndexTris      = 50000;
+    params.indexRangeOffset  = 0;
+    params.partialUpdate     = true;
+    return params;
+}
+
 TEST_P(IndexConversionPerfTest, Run)
 {
     run();
@@ -218,7 +269,10 @@ TEST_P(IndexConversionPerfTest, Run)
 
 ANGLE_INSTANTIATE_TEST(IndexConversionPerfTest,
                        IndexConversionPerfD3D11Params(),
-                       IndexRangeOffsetPerfD3D11Params());
+                       IndexRangeOffsetPerfD3D11Params(),
+                       PartialUpdatePerfParams(egl_platform::D3D11_NULL()),
+                       PartialUpdatePerfParams(egl_platform::OPENGL_OR_GLES_NULL()),
+                       PartialUpdatePerfParams(egl_platform::VULKAN_NULL()));
 
 // This test suite is not instantiated on some OSes.
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(IndexConversionPerfTest);
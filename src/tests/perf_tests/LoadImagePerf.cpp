@@ -0,0 +1,173 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// LoadImagePerf:
+//   Performance test for the image loading kernels used by texture uploads that need a format
+//   conversion.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <gmock/gmock.h>
+
+#include "image_util/loadimage_kernels.h"
+
+using namespace testing;
+
+namespace
+{
+using angle::priv::LoadImageKernelLevel;
+using angle::priv::LoadImageKernels;
+
+constexpr size_t kImageWidth  = 1024;
+constexpr size_t kImageHeight = 1024;
+
+enum class LoadKernel
+{
+    RGB8ToRGBA8,
+    RGB8ToBGRX8,
+    RGBA8ToBGRA8,
+    LA8ToRGBA8,
+    RGB16FToRG11B10F,
+    D24S8ToD32FS8X24,
+};
+
+struct LoadImageParams
+{
+    LoadKernel kernel;
+    LoadImageKernelLevel level;
+};
+
+std::ostream &operator<<(std::ostream &os, const LoadImageParams &params)
+{
+    constexpr const char *kKernelNames[] = {
+        "RGB8ToRGBA8", "RGB8ToBGRX8",      "RGBA8ToBGRA8",
+        "LA8ToRGBA8",  "RGB16FToRG11B10F", "D24S8ToD32FS8X24",
+    };
+    constexpr const char *kLevelNames[] = {"scalar", "sse2", "ssse3", "avx2", "neon"};
+
+    os << kKernelNames[static_cast<size_t>(params.kernel)] << "_"
+       << kLevelNames[static_cast<size_t>(params.level)];
+    return os;
+}
+
+// Returns the source and destination bytes per pixel of the kernel.
+std::pair<size_t, size_t> GetPixelBytes(LoadKernel kernel)
+{
+    switch (kernel)
+    {
+        case LoadKernel::RGB8ToRGBA8:
+        case LoadKernel::RGB8ToBGRX8:
+            return {3, 4};
+        case LoadKernel::RGBA8ToBGRA8:
+            return {4, 4};
+        case LoadKernel::LA8ToRGBA8:
+            return {2, 4};
+        case LoadKernel::RGB16FToRG11B10F:
+            return {6, 4};
+        case LoadKernel::D24S8ToD32FS8X24:
+            return {4, 8};
+    }
+    return {0, 0};
+}
+
+class LoadImagePerfTest : public ANGLEPerfTest, public WithParamInterface<LoadImageParams>
+{
+  public:
+    LoadImagePerfTest();
+
+    void step() override;
+
+    std::string getName();
+
+    const LoadImageKernels *mKernels;
+    size_t mSourcePixelBytes;
+    size_t mDestPixelBytes;
+    std::vector<uint8_t> mInput;
+    std::vector<uint8_t> mOutput;
+};
+
+LoadImagePerfTest::LoadImagePerfTest()
+    : ANGLEPerfTest(getName(), "", "_run", 1, "us"),
+      mKernels(angle::priv::GetLoadImageKernels(GetParam().level)),
+      mSourcePixelBytes(GetPixelBytes(GetParam().kernel).first),
+      mDestPixelBytes(GetPixelBytes(GetParam().kernel).second),
+      mInput(kImageWidth * kImageHeight * mSourcePixelBytes),
+      mOutput(kImageWidth * kImageHeight * mDestPixelBytes)
+{
+    for (size_t i = 0; i < mInput.size(); ++i)
+    {
+        mInput[i] = static_cast<uint8_t>(i * 31);
+    }
+}
+
+void LoadImagePerfTest::step()
+{
+    for (size_t y = 0; y < kImageHeight; ++y)
+    {
+        const uint8_t *source = mInput.data() + y * kImageWidth * mSourcePixelBytes;
+        uint8_t *dest         = mOutput.data() + y * kImageWidth * mDestPixelBytes;
+
+        switch (GetParam().kernel)
+        {
+            case LoadKernel::RGB8ToRGBA8:
+                mKernels->rgb8ToRGBA8(source, dest, kImageWidth, 0xFF);
+                break;
+            case LoadKernel::RGB8ToBGRX8:
+                mKernels->rgb8ToBGRX8(source, dest, kImageWidth);
+                break;
+            case LoadKernel::RGBA8ToBGRA8:
+                mKernels->rgba8ToBGRA8(source, dest, kImageWidth);
+                break;
+            case LoadKernel::LA8ToRGBA8:
+                mKernels->la8ToRGBA8(source, dest, kImageWidth);
+                break;
+            case LoadKernel::RGB16FToRG11B10F:
+                mKernels->rgb16FToRG11B10F(source, dest, kImageWidth);
+                break;
+            case LoadKernel::D24S8ToD32FS8X24:
+                mKernels->d24s8ToD32FS8X24(source, dest, kImageWidth);
+                break;
+        }
+    }
+}
+
+std::string LoadImagePerfTest::getName()
+{
+    std::stringstream ss;
+    ss << UnitTest::GetInstance()->current_test_suite()->name() << "/" << GetParam();
+    return ss.str();
+}
+
+// Measures the speed of converting a 1024x1024 image on the CPU.
+TEST_P(LoadImagePerfTest, Run)
+{
+    if (mKernels == nullptr)
+    {
+        skipTest("Kernels not supported on this CPU");
+    }
+
+    this->run();
+}
+
+std::vector<LoadImageParams> GetAllParams()
+{
+    std::vector<LoadImageParams> params;
+    for (LoadKernel kernel :
+         {LoadKernel::RGB8ToRGBA8, LoadKernel::RGB8ToBGRX8, LoadKernel::RGBA8ToBGRA8,
+          LoadKernel::LA8ToRGBA8, LoadKernel::RGB16FToRG11B10F, LoadKernel::D24S8ToD32FS8X24})
+    {
+        for (size_t level = 0; level < static_cast<size_t>(LoadImageKernelLevel::EnumCount);
+             ++level)
+        {
+            params.push_back({kernel, static_cast<LoadImageKernelLevel>(level)});
+        }
+    }
+    return params;
+}
+
+INSTANTIATE_TEST_SUITE_P(, LoadImagePerfTest, ValuesIn(GetAllParams()), PrintToStringParamName());
+
+}  // anonymous namespace
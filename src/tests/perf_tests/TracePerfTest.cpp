@@ -1897,7 +1897,7 @@ void TracePerfTest::startTest()
     ANGLERenderTest::startTest();
 }
 
-std::string FindTraceGzPath(const std::string &traceName)
+std::string FindTraceGenPath(const std::string &fileName)
 {
     std::stringstream pathStream;
 
@@ -1906,11 +1906,22 @@ std::string FindTraceGzPath(const std::string &traceName)
     {
         return "";
     }
-    pathStream << genDir << angle::GetPathSeparator() << "tracegz_" << traceName << ".gz";
+    pathStream << genDir << angle::GetPathSeparator() << fileName;
 
     return pathStream.str();
 }
 
+std::string FindTraceGzPath(const std::string &traceName)
+{
+    return FindTraceGenPath("tracegz_" + traceName + ".gz");
+}
+
+// The binary trace is created from the C sources on the first run, and again when they change.
+std::string FindTraceBinaryPath(const std::string &traceName)
+{
+    return FindTraceGenPath("tracebin_" + traceName + ".angletrace");
+}
+
 void TracePerfTest::initializeBenchmark()
 {
     const TraceInfo &traceInfo = mParams->traceInfo;
@@ -1940,6 +1951,16 @@ void TracePerfTest::initializeBenchmark()
             }
             mTraceReplay->setTraceGzPath(traceGzPath);
         }
+        else if (strcmp(gTraceInterpreter, "bin") == 0)
+        {
+            std::string traceBinaryPath = FindTraceBinaryPath(traceInfo.name);
+            if (traceBinaryPath.empty())
+            {
+                failTest("Could not find the gen folder for the binary trace.");
+                return;
+            }
+            mTraceReplay->setTraceBinaryPath(traceBinaryPath);
+        }
     }
     else
     {
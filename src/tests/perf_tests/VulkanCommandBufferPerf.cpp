@@ -10,6 +10,7 @@
 
 #include "ANGLEPerfTest.h"
 #include "common/platform.h"
+#include "libANGLE/renderer/vulkan/SecondaryCommandBuffer.h"
 #include "test_utils/third_party/vulkan_command_buffer_utils.h"
 
 #if defined(ANDROID)
@@ -357,6 +358,138 @@ void PrimaryCommandBufferBenchmarkOneWithOneHundred(sample_info &info,
     Present(info, drawFence);
 }
 
+// 100 Draws recorded in ANGLE's SecondaryCommandBuffer and replayed in one render pass of a
+// primary command buffer.  With |rebindStatePerDraw|, the same pipeline, descriptor set, vertex
+// buffer and dynamic state are set again before each draw, as a GL application that doesn't filter
+// its state changes would cause.  SecondaryCommandBuffer drops these redundant commands at record
+// time, so the two cases are expected to replay at the same cost.
+void SecondaryCommandBufferReplayBenchmark(sample_info &info,
+                                           VkClearValue *clear_values,
+                                           VkFence drawFence,
+                                           VkSemaphore imageAcquiredSemaphore,
+                                           int numBuffers,
+                                           bool rebindStatePerDraw)
+{
+    VkResult res;
+
+    rx::vk::SecondaryCommandMemoryAllocator memoryAllocator;
+    rx::vk::SecondaryCommandBlockAllocator blockAllocator;
+    rx::vk::priv::SecondaryCommandBuffer secondary;
+    blockAllocator.init();
+    blockAllocator.attachAllocator(&memoryAllocator);
+    ASSERT_EQ(angle::Result::Continue,
+              secondary.initialize(nullptr, nullptr, true, blockAllocator.getAllocator()));
+    secondary.attachAllocator(blockAllocator.getAllocator());
+    secondary.open();
+
+    rx::vk::Pipeline pipeline;
+    rx::vk::PipelineLayout pipelineLayout;
+    pipeline.setHandle(info.pipeline);
+    pipelineLayout.setHandle(info.pipeline_layout);
+
+    const VkDeviceSize offsets[1] = {0};
+    const VkViewport viewport     = {0, 0, static_cast<float>(info.width),
+                                     static_cast<float>(info.height), 0.0f, 1.0f};
+    const VkRect2D scissor        = {{0, 0}, {static_cast<uint32_t>(info.width),
+                                              static_cast<uint32_t>(info.height)}};
+
+    for (int x = 0; x < numBuffers; x++)
+    {
+        if (x == 0 || rebindStatePerDraw)
+        {
+            secondary.bindGraphicsPipeline(pipeline);
+            secondary.bindDescriptorSets(pipelineLayout, VK_PIPELINE_BIND_POINT_GRAPHICS,
+                                         rx::DescriptorSetIndex::Internal, NUM_DESCRIPTOR_SETS,
+                                         info.desc_set.data(), 0, nullptr);
+            secondary.bindVertexBuffers(0, 1, &info.vertex_buffer.buf, offsets);
+#if !defined(__ANDROID__)
+            // Matches init_viewports() and init_scissors(), which leave out dynamic viewport and
+            // scissors on Android.
+            secondary.setViewport(0, 1, &viewport);
+            secondary.setScissor(0, 1, &scissor);
+#endif
+        }
+
+        secondary.draw(0, 0);
+    }
+    secondary.close();
+
+    VkRenderPassBeginInfo rpBegin;
+    rpBegin.sType                    = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+    rpBegin.pNext                    = NULL;
+    rpBegin.renderPass               = info.render_pass;
+    rpBegin.framebuffer              = info.framebuffers[info.current_buffer];
+    rpBegin.renderArea.offset.x      = 0;
+    rpBegin.renderArea.offset.y      = 0;
+    rpBegin.renderArea.extent.width  = info.width;
+    rpBegin.renderArea.extent.height = info.height;
+    rpBegin.clearValueCount          = 2;
+    rpBegin.pClearValues             = clear_values;
+
+    VkCommandBufferBeginInfo cmdBufferInfo = {};
+    cmdBufferInfo.sType                    = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    cmdBufferInfo.pNext                    = NULL;
+    cmdBufferInfo.flags                    = 0;
+    cmdBufferInfo.pInheritanceInfo         = NULL;
+
+    rx::vk::PrimaryCommandBuffer primary;
+    primary.setHandle(info.cmd);
+
+    vkBeginCommandBuffer(info.cmd, &cmdBufferInfo);
+    vkCmdBeginRenderPass(info.cmd, &rpBegin, VK_SUBPASS_CONTENTS_INLINE);
+    secondary.executeCommands(&primary);
+    vkCmdEndRenderPass(info.cmd);
+    res = vkEndCommandBuffer(info.cmd);
+    ASSERT_EQ(VK_SUCCESS, res);
+
+    primary.release();
+    pipeline.release();
+    pipelineLayout.release();
+    secondary.detachAllocator(blockAllocator.getAllocator());
+    blockAllocator.detachAllocator(secondary.empty());
+    secondary.reset();
+    blockAllocator.resetAllocator();
+
+    const VkCommandBuffer cmd_bufs[]      = {info.cmd};
+    VkPipelineStageFlags pipe_stage_flags = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    VkSubmitInfo submitInfo[1]            = {};
+    submitInfo[0].pNext                   = NULL;
+    submitInfo[0].sType                   = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submitInfo[0].waitSemaphoreCount      = 1;
+    submitInfo[0].pWaitSemaphores         = &imageAcquiredSemaphore;
+    submitInfo[0].pWaitDstStageMask       = &pipe_stage_flags;
+    submitInfo[0].commandBufferCount      = 1;
+    submitInfo[0].pCommandBuffers         = cmd_bufs;
+    submitInfo[0].signalSemaphoreCount    = 0;
+    submitInfo[0].pSignalSemaphores       = NULL;
+
+    // Queue the command buffer for execution
+    res = vkQueueSubmit(info.graphics_queue, 1, submitInfo, drawFence);
+    ASSERT_EQ(VK_SUCCESS, res);
+
+    Present(info, drawFence);
+}
+
+void SecondaryCommandBufferReplayRedundantStateBenchmark(sample_info &info,
+                                                         VkClearValue *clear_values,
+                                                         VkFence drawFence,
+                                                         VkSemaphore imageAcquiredSemaphore,
+                                                         int numBuffers)
+{
+    SecondaryCommandBufferReplayBenchmark(info, clear_values, drawFence, imageAcquiredSemaphore,
+                                          numBuffers, true);
+}
+
+void SecondaryCommandBufferReplayUniqueStateBenchmark(sample_info &info,
+                                                      VkClearValue *clear_values,
+                                                      VkFence drawFence,
+                                                      VkSemaphore imageAcquiredSemaphore,
+                                                      int numBuffers)
+{
+    SecondaryCommandBufferReplayBenchmark(info, clear_values, drawFence, imageAcquiredSemaphore,
+                                          numBuffers, false);
+}
+
 // 100 separate secondary cmd buffers, each with 1 Draw
 void SecondaryCommandBufferBenchmark(sample_info &info,
                                      VkClearValue *clear_values,
@@ -563,6 +696,22 @@ CommandBufferTestParams PrimaryCBOneWithOneHundredParams()
     return params;
 }
 
+CommandBufferTestParams SecondaryCBReplayRedundantStateParams()
+{
+    CommandBufferTestParams params;
+    params.CBImplementation = SecondaryCommandBufferReplayRedundantStateBenchmark;
+    params.story            = "_ANGLESecondaryCB_Replay_100_Draw_Redundant_State";
+    return params;
+}
+
+CommandBufferTestParams SecondaryCBReplayUniqueStateParams()
+{
+    CommandBufferTestParams params;
+    params.CBImplementation = SecondaryCommandBufferReplayUniqueStateBenchmark;
+    params.story            = "_ANGLESecondaryCB_Replay_100_Draw_Unique_State";
+    return params;
+}
+
 CommandBufferTestParams SecondaryCBParams()
 {
     CommandBufferTestParams params;
@@ -628,6 +777,8 @@ INSTANTIATE_TEST_SUITE_P(,
                          VulkanCommandBufferPerfTest,
                          ::testing::Values(PrimaryCBHundredIndividualParams(),
                                            PrimaryCBOneWithOneHundredParams(),
+                                           SecondaryCBReplayRedundantStateParams(),
+                                           SecondaryCBReplayUniqueStateParams(),
                                            SecondaryCBParams(),
                                            CommandPoolDestroyParams(),
                                            CommandPoolHardResetParams(),
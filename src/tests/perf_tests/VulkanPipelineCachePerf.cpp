@@ -22,6 +22,8 @@ constexpr unsigned int kIterationsPerStep = 100;
 struct Params
 {
     bool withDynamicState = false;
+    // Derive the hash of each looked up desc from the previous one, as ContextVk does.
+    bool withIncrementalHash = false;
 };
 
 class VulkanPipelineCachePerfTest : public ANGLEPerfTest,
@@ -37,12 +39,15 @@ class VulkanPipelineCachePerfTest : public ANGLEPerfTest,
     GraphicsPipelineCache<GraphicsPipelineDescCompleteHash> mCache;
     angle::RNG mRNG;
 
+    // Each hit differs from the previous one in a few chunks, marked in its transition bits.
     std::vector<vk::GraphicsPipelineDesc> mCacheHits;
+    std::vector<vk::GraphicsPipelineTransitionBits> mCacheHitTransitions;
     std::vector<vk::GraphicsPipelineDesc> mCacheMisses;
     size_t mMissIndex = 0;
 
   private:
     void randomizeDesc(vk::GraphicsPipelineDesc *desc);
+    void randomizeDescChunks(vk::GraphicsPipelineDesc *desc);
 };
 
 VulkanPipelineCachePerfTest::VulkanPipelineCachePerfTest()
@@ -58,20 +63,41 @@ void VulkanPipelineCachePerfTest::SetUp()
 {
     ANGLEPerfTest::SetUp();
 
-    // Insert a number of random pipeline states.
+    // Insert a number of random pipeline states.  The ones that are hit are variations of each
+    // other, like the states an application switches between.
+    vk::GraphicsPipelineDesc hitDesc;
+    randomizeDesc(&hitDesc);
     for (int pipelineCount = 0; pipelineCount < 100; ++pipelineCount)
     {
         vk::Pipeline pipeline;
         vk::GraphicsPipelineDesc desc;
-        randomizeDesc(&desc);
-
         if (pipelineCount < 10)
         {
+            randomizeDescChunks(&hitDesc);
+            desc = hitDesc;
             mCacheHits.push_back(desc);
         }
+        else
+        {
+            randomizeDesc(&desc);
+        }
         mCache.populate(desc, std::move(pipeline), nullptr);
     }
 
+    for (size_t hitIndex = 0; hitIndex < mCacheHits.size(); ++hitIndex)
+    {
+        const uint32_t *chunks = mCacheHits[hitIndex].getPtr<uint32_t>();
+        const uint32_t *previousChunks =
+            mCacheHits[(hitIndex + mCacheHits.size() - 1) % mCacheHits.size()].getPtr<uint32_t>();
+
+        vk::GraphicsPipelineTransitionBits transition;
+        for (size_t chunkIndex = 0; chunkIndex < vk::kNumGraphicsPipelineDirtyBits; ++chunkIndex)
+        {
+            transition.set(chunkIndex, chunks[chunkIndex] != previousChunks[chunkIndex]);
+        }
+        mCacheHitTransitions.push_back(transition);
+    }
+
     for (int missCount = 0; missCount < 10000; ++missCount)
     {
         vk::GraphicsPipelineDesc desc;
@@ -89,6 +115,22 @@ void VulkanPipelineCachePerfTest::randomizeDesc(vk::GraphicsPipelineDesc *desc)
     desc->setSupportsDynamicStateForTest(GetParam().withDynamicState);
 }
 
+void VulkanPipelineCachePerfTest::randomizeDescChunks(vk::GraphicsPipelineDesc *desc)
+{
+    // Only change bytes of the fragment output state, so the dynamic state bits are untouched.
+    constexpr size_t kFragmentOutputOffset =
+        vk::kGraphicsPipelineShadersStateSize + vk::kGraphicsPipelineSharedNonVertexInputStateSize;
+    constexpr int kFragmentOutputSize =
+        static_cast<int>(vk::kGraphicsPipelineFragmentOutputStateSize);
+
+    uint8_t *bytes = reinterpret_cast<uint8_t *>(desc);
+    for (int change = 0; change < 3; ++change)
+    {
+        bytes[kFragmentOutputOffset + mRNG.randomIntBetween(0, kFragmentOutputSize - 1)] =
+            static_cast<uint8_t>(mRNG.randomIntBetween(0, 255));
+    }
+}
+
 void VulkanPipelineCachePerfTest::step()
 {
     vk::RenderPass rp;
@@ -115,14 +157,34 @@ void VulkanPipelineCachePerfTest::step()
 
     vk::SpecializationConstants defaultSpecConsts{};
 
+    size_t previousHitIndex = mCacheHits.size() - 1;
+    size_t previousHitHash =
+        mCacheHits[previousHitIndex].hash(vk::GraphicsPipelineSubset::Complete);
+
     for (unsigned int iteration = 0; iteration < kIterationsPerStep; ++iteration)
     {
-        for (const auto &hit : mCacheHits)
+        for (size_t hitIndex = 0; hitIndex < mCacheHits.size(); ++hitIndex)
         {
-            if (!mCache.getPipeline(hit, &desc, &result))
+            const vk::GraphicsPipelineDesc &hit = mCacheHits[hitIndex];
+
+            size_t hitHash = 0;
+            if (GetParam().withIncrementalHash)
+            {
+                hitHash = hit.updateHash(vk::GraphicsPipelineSubset::Complete, previousHitHash,
+                                         mCacheHits[previousHitIndex],
+                                         mCacheHitTransitions[hitIndex]);
+            }
+            else
+            {
+                hitHash = hit.hash(vk::GraphicsPipelineSubset::Complete);
+            }
+            previousHitIndex = hitIndex;
+            previousHitHash  = hitHash;
+
+            if (!mCache.getPipeline(hit, hitHash, &desc, &result))
             {
                 (void)mCache.createPipeline(VK_NULL_HANDLE, &spc, rp, pl, ssm, defaultSpecConsts,
-                                            PipelineSource::Draw, hit, &desc, &result);
+                                            PipelineSource::Draw, hit, hitHash, &desc, &result);
             }
         }
     }
@@ -130,11 +192,12 @@ void VulkanPipelineCachePerfTest::step()
     for (int missCount = 0; missCount < 20 && mMissIndex < mCacheMisses.size();
          ++missCount, ++mMissIndex)
     {
-        const auto &miss = mCacheMisses[mMissIndex];
-        if (!mCache.getPipeline(miss, &desc, &result))
+        const auto &miss      = mCacheMisses[mMissIndex];
+        const size_t missHash = miss.hash(vk::GraphicsPipelineSubset::Complete);
+        if (!mCache.getPipeline(miss, missHash, &desc, &result))
         {
             (void)mCache.createPipeline(VK_NULL_HANDLE, &spc, rp, pl, ssm, defaultSpecConsts,
-                                        PipelineSource::Draw, miss, &desc, &result);
+                                        PipelineSource::Draw, miss, missHash, &desc, &result);
         }
     }
 
@@ -152,4 +215,6 @@ TEST_P(VulkanPipelineCachePerfTest, Run)
 
 INSTANTIATE_TEST_SUITE_P(,
                          VulkanPipelineCachePerfTest,
-                         ::testing::ValuesIn(std::vector<Params>{{Params{false}, Params{true}}}));
+                         ::testing::ValuesIn(std::vector<Params>{
+                             {Params{false, false}, Params{true, false}, Params{false, true},
+                              Params{true, true}}}));
@@ -310,6 +310,28 @@ def validate_traces(args, traces):
     return EXIT_SUCCESS
 
 
+# Replays a trace twice with the binary interpreter: the first run converts the C sources to a
+# binary trace, the second replays the binary trace.
+def validate_binary_trace(args, trace_binary, trace):
+    binary_trace_path = os.path.join(
+        os.path.dirname(trace_binary), 'gen', 'tracebin_%s.angletrace' % trace)
+    if os.path.exists(binary_trace_path):
+        os.remove(binary_trace_path)
+
+    validate_args = ['--trace-interpreter=bin']
+    if args.verbose:
+        validate_args += ['--verbose-logging']
+    for _ in range(2):
+        if not validate_single_trace(args, trace_binary, trace, validate_args, {}):
+            return False
+
+    if not os.path.exists(binary_trace_path):
+        logging.error('The binary trace for "%s" was not written to %s' %
+                      (trace, binary_trace_path))
+        return False
+    return True
+
+
 def interpret_traces(args, traces):
     test_name = 'angle_trace_interpreter_tests'
     results = {
@@ -345,8 +367,9 @@ def interpret_traces(args, traces):
                             if args.verbose:
                                 validate_args += ['--verbose-logging']
                             if validate_single_trace(args, trace_binary, trace, validate_args, {}):
-                                logging.info('%s passed!' % trace)
-                                result = PASS
+                                if validate_binary_trace(args, trace_binary, trace):
+                                    logging.info('%s passed!' % trace)
+                                    result = PASS
             finally:
                 restore_single_trace(trace, backup_path)
             results['num_failures_by_type'][result] += 1
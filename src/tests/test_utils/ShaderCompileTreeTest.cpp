@@ -163,6 +163,11 @@ const std::vector<sh::ShaderVariable> &ShaderCompileTreeTest::getAttributes() co
     return mTranslator->getAttributes();
 }
 
+TCompiler *ShaderCompileTreeTest::getCompiler() const
+{
+    return mTranslator;
+}
+
 bool IsZero(TIntermNode *node)
 {
     if (!node->getAsTyped())
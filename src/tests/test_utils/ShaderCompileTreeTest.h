@@ -18,6 +18,7 @@
 namespace sh
 {
 
+class TCompiler;
 class TIntermBlock;
 class TIntermNode;
 class TranslatorESSL;
@@ -41,6 +42,8 @@ class ShaderCompileTreeTest : public testing::Test
     const std::vector<sh::ShaderVariable> &getUniforms() const;
     const std::vector<sh::ShaderVariable> &getAttributes() const;
 
+    TCompiler *getCompiler() const;
+
     virtual void initResources(ShBuiltInResources *resources) {}
     virtual ::GLenum getShaderType() const     = 0;
     virtual ShShaderSpec getShaderSpec() const = 0;
@@ -162,6 +162,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::ExplicitFragmentLocations, "explicitFragmentLocations"},
     {Feature::ExplicitlyCastMediumpFloatTo16Bit, "explicitlyCastMediumpFloatTo16Bit"},
     {Feature::ExplicitlyEnablePerSampleShading, "explicitlyEnablePerSampleShading"},
+    {Feature::ExportPerformanceCounters, "exportPerformanceCounters"},
     {Feature::ExposeNonConformantExtensionsAndVersions, "exposeNonConformantExtensionsAndVersions"},
     {Feature::FinishDoesNotCauseQueriesToBeAvailable, "finishDoesNotCauseQueriesToBeAvailable"},
     {Feature::FlushAfterEndingTransformFeedback, "flushAfterEndingTransformFeedback"},
@@ -288,6 +289,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::SetZeroLevelBeforeGenerateMipmap, "setZeroLevelBeforeGenerateMipmap"},
     {Feature::ShiftInstancedArrayDataWithOffset, "shiftInstancedArrayDataWithOffset"},
     {Feature::SingleThreadedTextureDecompression, "singleThreadedTextureDecompression"},
+    {Feature::SingleThreadedVertexConversion, "singleThreadedVertexConversion"},
     {Feature::SkipVSConstantRegisterZero, "skipVSConstantRegisterZero"},
     {Feature::SlowAsyncCommandQueueForTesting, "slowAsyncCommandQueueForTesting"},
     {Feature::SlowDownMonolithicPipelineCreationForTesting, "slowDownMonolithicPipelineCreationForTesting"},
@@ -382,6 +384,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::SupportsRoundingModeRtzFp64, "supportsRoundingModeRtzFp64"},
     {Feature::SupportsSampler2dViewOf3d, "supportsSampler2dViewOf3d"},
     {Feature::SupportsSamplerMirrorClampToEdge, "supportsSamplerMirrorClampToEdge"},
+    {Feature::SupportsShaderDrawParameters, "supportsShaderDrawParameters"},
     {Feature::SupportsShaderFloat16, "supportsShaderFloat16"},
     {Feature::SupportsShaderFloat64, "supportsShaderFloat64"},
     {Feature::SupportsShaderFramebufferFetch, "supportsShaderFramebufferFetch"},
@@ -414,6 +417,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::SyncAllVertexArraysToDefault, "syncAllVertexArraysToDefault"},
     {Feature::SyncDefaultVertexArraysToDefault, "syncDefaultVertexArraysToDefault"},
     {Feature::SyncMonolithicPipelinesToBlobCache, "syncMonolithicPipelinesToBlobCache"},
+    {Feature::ThreadedCommandStream, "threadedCommandStream"},
     {Feature::UnbindFBOBeforeSwitchingContext, "unbindFBOBeforeSwitchingContext"},
     {Feature::UncurrentEglSurfaceUponSurfaceDestroy, "uncurrentEglSurfaceUponSurfaceDestroy"},
     {Feature::UnfoldShortCircuits, "unfoldShortCircuits"},
@@ -429,6 +433,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::UseDepthWriteEnableDynamicState, "useDepthWriteEnableDynamicState"},
     {Feature::UseDualPipelineBlobCacheSlots, "useDualPipelineBlobCacheSlots"},
     {Feature::UseEmptyBlobsToEraseOldPipelineCacheFromBlobCache, "useEmptyBlobsToEraseOldPipelineCacheFromBlobCache"},
+    {Feature::UseFastBlobCompression, "useFastBlobCompression"},
     {Feature::UseFrontFaceDynamicState, "useFrontFaceDynamicState"},
     {Feature::UseIntermediateTextureForGenerateMipmap, "useIntermediateTextureForGenerateMipmap"},
     {Feature::UseMultipleDescriptorsForExternalFormats, "useMultipleDescriptorsForExternalFormats"},
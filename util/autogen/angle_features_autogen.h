@@ -162,6 +162,7 @@ enum class Feature
     ExplicitFragmentLocations,
     ExplicitlyCastMediumpFloatTo16Bit,
     ExplicitlyEnablePerSampleShading,
+    ExportPerformanceCounters,
     ExposeNonConformantExtensionsAndVersions,
     FinishDoesNotCauseQueriesToBeAvailable,
     FlushAfterEndingTransformFeedback,
@@ -288,6 +289,7 @@ enum class Feature
     SetZeroLevelBeforeGenerateMipmap,
     ShiftInstancedArrayDataWithOffset,
     SingleThreadedTextureDecompression,
+    SingleThreadedVertexConversion,
     SkipVSConstantRegisterZero,
     SlowAsyncCommandQueueForTesting,
     SlowDownMonolithicPipelineCreationForTesting,
@@ -382,6 +384,7 @@ enum class Feature
     SupportsRoundingModeRtzFp64,
     SupportsSampler2dViewOf3d,
     SupportsSamplerMirrorClampToEdge,
+    SupportsShaderDrawParameters,
     SupportsShaderFloat16,
     SupportsShaderFloat64,
     SupportsShaderFramebufferFetch,
@@ -414,6 +417,7 @@ enum class Feature
     SyncAllVertexArraysToDefault,
     SyncDefaultVertexArraysToDefault,
     SyncMonolithicPipelinesToBlobCache,
+    ThreadedCommandStream,
     UnbindFBOBeforeSwitchingContext,
     UncurrentEglSurfaceUponSurfaceDestroy,
     UnfoldShortCircuits,
@@ -429,6 +433,7 @@ enum class Feature
     UseDepthWriteEnableDynamicState,
     UseDualPipelineBlobCacheSlots,
     UseEmptyBlobsToEraseOldPipelineCacheFromBlobCache,
+    UseFastBlobCompression,
     UseFrontFaceDynamicState,
     UseIntermediateTextureForGenerateMipmap,
     UseMultipleDescriptorsForExternalFormats,
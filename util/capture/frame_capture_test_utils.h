@@ -94,6 +94,11 @@ class TraceLibrary : angle::NonCopyable, angle::TraceCallbacks
         mTraceFunctions->SetTraceGzPath(traceGzPath);
     }
 
+    void setTraceBinaryPath(const std::string &traceBinaryPath)
+    {
+        mTraceFunctions->SetTraceBinaryPath(traceBinaryPath);
+    }
+
   private:
     template <typename FuncT, typename... ArgsT>
     typename std::invoke_result<FuncT, ArgsT...>::type callFunc(const char *funcName, ArgsT... args)
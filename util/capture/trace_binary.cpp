@@ -0,0 +1,703 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// trace_binary.cpp:
+//   Pre-tokenized binary form of the C-based replays, which the trace interpreter loads without
+//   parsing any text.
+//
+
+#include "trace_binary.h"
+
+#include <cstring>
+#include <limits>
+#include <string_view>
+#include <type_traits>
+#include <unordered_set>
+
+#include "common/string_utils.h"
+#include "trace_fixture.h"
+
+namespace angle
+{
+namespace
+{
+constexpr char kMagic[8]           = {'A', 'N', 'G', 'L', 'E', 'T', 'R', 'B'};
+constexpr uint32_t kVersion        = 2;
+constexpr uint16_t kCustomFunction = 0xFFFF;
+
+// The parameter types the trace interpreter produces.  These match the ParamType enumerators
+// (with a T prefix) and the ParamValue members (with a Val suffix).
+#define ANGLE_FOR_EACH_BINARY_TRACE_PARAM_TYPE(OP) \
+    OP(GLuint)                                     \
+    OP(GLint)                                      \
+    OP(GLuint64)                                   \
+    OP(GLint64)                                    \
+    OP(GLfloat)                                    \
+    OP(GLubyte)                                    \
+    OP(GLshort)                                    \
+    OP(ShaderProgramID)                            \
+    OP(BufferID)                                   \
+    OP(TextureID)                                  \
+    OP(RenderbufferID)                             \
+    OP(FramebufferID)                              \
+    OP(SyncID)                                     \
+    OP(TransformFeedbackID)                        \
+    OP(VertexArrayID)                              \
+    OP(QueryID)                                    \
+    OP(SamplerID)                                  \
+    OP(UniformLocation)                            \
+    OP(voidPointer)                                \
+    OP(voidConstPointer)                           \
+    OP(GLintPointer)                               \
+    OP(GLintConstPointer)                          \
+    OP(GLuintPointer)                              \
+    OP(GLuintConstPointer)                         \
+    OP(GLfloatPointer)                             \
+    OP(GLfloatConstPointer)                        \
+    OP(GLcharConstPointer)                         \
+    OP(GLshortConstPointer)                        \
+    OP(GLubytePointer)                             \
+    OP(GLuint64ConstPointer)                       \
+    OP(GLint64Pointer)
+
+// Values are stored as 64 bits.  Signed integers are sign-extended, floats are stored as their
+// bits and resource IDs as their value.
+template <typename T>
+uint64_t ToBits(T value)
+{
+    if constexpr (std::is_pointer<T>::value)
+    {
+        return static_cast<uint64_t>(reinterpret_cast<uintptr_t>(value));
+    }
+    else if constexpr (std::is_floating_point<T>::value)
+    {
+        static_assert(sizeof(T) == sizeof(uint32_t), "Only float is supported");
+        uint32_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+    else if constexpr (std::is_signed<T>::value)
+    {
+        return static_cast<uint64_t>(static_cast<int64_t>(value));
+    }
+    else if constexpr (std::is_integral<T>::value)
+    {
+        return static_cast<uint64_t>(value);
+    }
+    else
+    {
+        return ToBits(value.value);
+    }
+}
+
+template <typename T>
+void FromBits(uint64_t bits, T *valueOut)
+{
+    if constexpr (std::is_pointer<T>::value)
+    {
+        *valueOut = reinterpret_cast<T>(static_cast<uintptr_t>(bits));
+    }
+    else if constexpr (std::is_floating_point<T>::value)
+    {
+        uint32_t floatBits = static_cast<uint32_t>(bits);
+        memcpy(valueOut, &floatBits, sizeof(floatBits));
+    }
+    else if constexpr (std::is_integral<T>::value)
+    {
+        *valueOut = static_cast<T>(bits);
+    }
+    else
+    {
+        FromBits(bits, &valueOut->value);
+    }
+}
+
+bool GetValueBits(const ParamCapture &param, uint64_t *bitsOut)
+{
+    switch (param.type)
+    {
+#define ANGLE_GET_VALUE_BITS(NAME)                \
+    case ParamType::T##NAME:                      \
+        *bitsOut = ToBits(param.value.NAME##Val); \
+        return true;
+        ANGLE_FOR_EACH_BINARY_TRACE_PARAM_TYPE(ANGLE_GET_VALUE_BITS)
+#undef ANGLE_GET_VALUE_BITS
+        default:
+            return false;
+    }
+}
+
+bool SetValueBits(ParamType type, uint64_t bits, ParamValue *valueOut)
+{
+    switch (type)
+    {
+#define ANGLE_SET_VALUE_BITS(NAME)            \
+    case ParamType::T##NAME:                  \
+        FromBits(bits, &valueOut->NAME##Val); \
+        return true;
+        ANGLE_FOR_EACH_BINARY_TRACE_PARAM_TYPE(ANGLE_SET_VALUE_BITS)
+#undef ANGLE_SET_VALUE_BITS
+        default:
+            return false;
+    }
+}
+
+uint64_t GetTokenIndex(const Token &token)
+{
+    const char *start = strchr(token, '[');
+    ASSERT(start != nullptr && EndsWith(token, "]"));
+    return std::strtoull(start + 1, nullptr, 10);
+}
+
+template <typename T>
+void Append(std::vector<uint8_t> *out, T value)
+{
+    const uint8_t *bytes = reinterpret_cast<const uint8_t *>(&value);
+    out->insert(out->end(), bytes, bytes + sizeof(T));
+}
+
+void AppendString(std::vector<uint8_t> *out, const void *data, size_t size)
+{
+    ASSERT(size <= std::numeric_limits<uint32_t>::max());
+    Append<uint32_t>(out, static_cast<uint32_t>(size));
+    const uint8_t *bytes = static_cast<const uint8_t *>(data);
+    out->insert(out->end(), bytes, bytes + size);
+}
+
+struct BinaryParam
+{
+    ParamType type;
+    BinaryParamKind kind;
+    uint64_t value;
+    // The string literal, or the name of the string array.
+    std::string_view string;
+};
+
+struct BinaryCall
+{
+    EntryPoint entryPoint;
+    std::string_view customFunctionName;
+    size_t paramCount;
+    BinaryParam params[kMaxParameters];
+};
+
+// Reads a binary trace in place.  Reads past the end or of out-of-range indices put the reader in
+// an error state in which it only returns zeros.
+class BinaryTraceReader : angle::NonCopyable
+{
+  public:
+    BinaryTraceReader(const uint8_t *data, size_t size) : mCurrent(data), mEnd(data + size) {}
+
+    bool ok() const { return mOk; }
+    bool atEnd() const { return mCurrent == mEnd; }
+
+    template <typename T>
+    T read()
+    {
+        T value = {};
+        if (!mOk || static_cast<size_t>(mEnd - mCurrent) < sizeof(T))
+        {
+            mOk = false;
+            return value;
+        }
+        memcpy(&value, mCurrent, sizeof(T));
+        mCurrent += sizeof(T);
+        return value;
+    }
+
+    std::string_view readString()
+    {
+        uint32_t size = read<uint32_t>();
+        if (!mOk || static_cast<size_t>(mEnd - mCurrent) < size)
+        {
+            mOk = false;
+            return {};
+        }
+        std::string_view string(reinterpret_cast<const char *>(mCurrent), size);
+        mCurrent += size;
+        return string;
+    }
+
+    std::string_view readName()
+    {
+        uint32_t index = read<uint32_t>();
+        return getName(index);
+    }
+
+    // Reads everything up to the string arrays.  Fails if the trace was written from sources other
+    // than the ones |sourceHash| was computed from.
+    bool readHeader(uint64_t sourceHash);
+    bool readCall(BinaryCall *callOut);
+
+  private:
+    std::string_view getName(uint64_t index)
+    {
+        if (index >= mNames.size())
+        {
+            mOk = false;
+            return {};
+        }
+        return mNames[index];
+    }
+
+    const uint8_t *mCurrent;
+    const uint8_t *mEnd;
+    bool mOk = true;
+
+    std::vector<std::string_view> mNames;
+    std::vector<EntryPoint> mEntryPoints;
+};
+
+bool BinaryTraceReader::readHeader(uint64_t sourceHash)
+{
+    char magic[sizeof(kMagic)];
+    for (char &c : magic)
+    {
+        c = read<char>();
+    }
+    if (memcmp(magic, kMagic, sizeof(kMagic)) != 0 || read<uint32_t>() != kVersion ||
+        read<uint64_t>() != sourceHash)
+    {
+        return false;
+    }
+
+    uint32_t nameCount = read<uint32_t>();
+    for (uint32_t nameIndex = 0; nameIndex < nameCount && mOk; ++nameIndex)
+    {
+        mNames.push_back(readString());
+    }
+
+    uint32_t entryPointCount = read<uint32_t>();
+    for (uint32_t entryPointIndex = 0; entryPointIndex < entryPointCount && mOk; ++entryPointIndex)
+    {
+        EntryPoint entryPoint = static_cast<EntryPoint>(read<uint16_t>());
+        std::string_view name = readName();
+        if (mOk && (entryPoint == EntryPoint::Invalid || GetEntryPointName(entryPoint) != name))
+        {
+            mOk = false;
+        }
+        mEntryPoints.push_back(entryPoint);
+    }
+
+    return mOk;
+}
+
+bool BinaryTraceReader::readCall(BinaryCall *callOut)
+{
+    uint16_t entryPointIndex = read<uint16_t>();
+    if (entryPointIndex == kCustomFunction)
+    {
+        callOut->entryPoint         = EntryPoint::Invalid;
+        callOut->customFunctionName = readName();
+    }
+    else if (entryPointIndex < mEntryPoints.size())
+    {
+        callOut->entryPoint = mEntryPoints[entryPointIndex];
+    }
+    else
+    {
+        mOk = false;
+    }
+
+    callOut->paramCount = read<uint8_t>();
+    if (callOut->paramCount > kMaxParameters)
+    {
+        mOk = false;
+    }
+
+    for (size_t paramIndex = 0; paramIndex < callOut->paramCount && mOk; ++paramIndex)
+    {
+        BinaryParam &param = callOut->params[paramIndex];
+        param.type         = static_cast<ParamType>(read<uint16_t>());
+        param.kind         = static_cast<BinaryParamKind>(read<uint8_t>());
+        param.value        = 0;
+        param.string       = {};
+        if (param.kind == BinaryParamKind::String)
+        {
+            param.string = readString();
+        }
+        else
+        {
+            param.value = read<uint64_t>();
+            if (param.kind == BinaryParamKind::StringArray)
+            {
+                param.string = getName(param.value);
+            }
+        }
+    }
+
+    return mOk;
+}
+
+bool ValidateParam(const BinaryParam &param, const std::unordered_set<std::string_view> &arrays)
+{
+    ParamValue value;
+    switch (param.kind)
+    {
+        case BinaryParamKind::Value:
+        case BinaryParamKind::BinaryData:
+        case BinaryParamKind::ReadBuffer:
+        case BinaryParamKind::ResourceIDBuffer:
+            return SetValueBits(param.type, 0, &value);
+        case BinaryParamKind::ClientArray:
+            return SetValueBits(param.type, 0, &value) && param.value < kMaxClientArrays;
+        case BinaryParamKind::String:
+            return param.type == ParamType::TGLcharConstPointer;
+        case BinaryParamKind::StringArray:
+            return param.type == ParamType::TGLcharConstPointerPointer &&
+                   arrays.count(param.string) > 0;
+        default:
+            return false;
+    }
+}
+
+// Walks the whole trace so loading it can't fail half-way, after InitReplay already ran.
+bool ValidateBinaryTrace(const uint8_t *data, size_t size, uint64_t sourceHash)
+{
+    BinaryTraceReader reader(data, size);
+    if (!reader.readHeader(sourceHash))
+    {
+        return false;
+    }
+
+    std::unordered_set<std::string_view> arrays;
+    uint32_t arrayCount = reader.read<uint32_t>();
+    for (uint32_t arrayIndex = 0; arrayIndex < arrayCount && reader.ok(); ++arrayIndex)
+    {
+        arrays.insert(reader.readName());
+        uint32_t stringCount = reader.read<uint32_t>();
+        for (uint32_t stringIndex = 0; stringIndex < stringCount && reader.ok(); ++stringIndex)
+        {
+            reader.readString();
+        }
+    }
+
+    BinaryCall call;
+    uint32_t functionCount = reader.read<uint32_t>();
+    for (uint32_t functionIndex = 0; functionIndex < functionCount && reader.ok(); ++functionIndex)
+    {
+        reader.readName();
+        uint32_t callCount = reader.read<uint32_t>();
+        for (uint32_t callIndex = 0; callIndex < callCount && reader.ok(); ++callIndex)
+        {
+            if (!reader.readCall(&call))
+            {
+                return false;
+            }
+            for (size_t paramIndex = 0; paramIndex < call.paramCount; ++paramIndex)
+            {
+                if (!ValidateParam(call.params[paramIndex], arrays))
+                {
+                    return false;
+                }
+            }
+        }
+    }
+
+    return reader.ok() && reader.atEnd();
+}
+
+CallCapture MakeCallCapture(const BinaryCall &call, const TraceStringMap &strings)
+{
+    ParamBuffer params;
+    for (size_t paramIndex = 0; paramIndex < call.paramCount; ++paramIndex)
+    {
+        const BinaryParam &binaryParam = call.params[paramIndex];
+        ParamCapture param(params.getNextParamName(), binaryParam.type);
+
+        const void *pointer = nullptr;
+        switch (binaryParam.kind)
+        {
+            case BinaryParamKind::Value:
+                SetValueBits(binaryParam.type, binaryParam.value, &param.value);
+                break;
+            case BinaryParamKind::BinaryData:
+                ASSERT(gBinaryData);
+                pointer = &gBinaryData[binaryParam.value];
+                break;
+            case BinaryParamKind::ReadBuffer:
+                pointer = &gReadBuffer[binaryParam.value];
+                break;
+            case BinaryParamKind::ClientArray:
+                pointer = gClientArrays[binaryParam.value];
+                break;
+            case BinaryParamKind::ResourceIDBuffer:
+                pointer = gResourceIDBuffer;
+                break;
+            case BinaryParamKind::String:
+            {
+                std::vector<uint8_t> data(binaryParam.string.begin(), binaryParam.string.end());
+                data.push_back(0);
+                param.data.push_back(std::move(data));
+                param.value.GLcharConstPointerVal =
+                    reinterpret_cast<const char *>(param.data[0].data());
+                break;
+            }
+            case BinaryParamKind::StringArray:
+            {
+                const TraceString &traceStr = strings.at(std::string(binaryParam.string));
+                param.value.GLcharConstPointerPointerVal = traceStr.pointers.data();
+                break;
+            }
+            default:
+                UNREACHABLE();
+                break;
+        }
+
+        if (pointer != nullptr)
+        {
+            SetValueBits(binaryParam.type, ToBits(pointer), &param.value);
+        }
+        params.addParam(std::move(param));
+    }
+
+    if (call.entryPoint == EntryPoint::Invalid)
+    {
+        return CallCapture(std::string(call.customFunctionName), std::move(params));
+    }
+    return CallCapture(call.entryPoint, std::move(params));
+}
+}  // anonymous namespace
+
+BinaryTraceWriter::BinaryTraceWriter() = default;
+
+BinaryTraceWriter::~BinaryTraceWriter() = default;
+
+uint32_t BinaryTraceWriter::getNameIndex(const std::string &name)
+{
+    auto iter = mNameIndices.find(name);
+    if (iter != mNameIndices.end())
+    {
+        return iter->second;
+    }
+
+    uint32_t index = static_cast<uint32_t>(mNames.size());
+    mNames.push_back(name);
+    mNameIndices[name] = index;
+    return index;
+}
+
+uint16_t BinaryTraceWriter::getEntryPointIndex(EntryPoint entryPoint)
+{
+    auto iter = mEntryPointIndices.find(entryPoint);
+    if (iter != mEntryPointIndices.end())
+    {
+        return iter->second;
+    }
+
+    ASSERT(mEntryPoints.size() < kCustomFunction);
+    uint16_t index = static_cast<uint16_t>(mEntryPoints.size());
+    getNameIndex(GetEntryPointName(entryPoint));
+    mEntryPoints.push_back(entryPoint);
+    mEntryPointIndices[entryPoint] = index;
+    return index;
+}
+
+void BinaryTraceWriter::addStringArray(const std::string &name, const TraceString &traceString)
+{
+    Append<uint32_t>(&mStringArrayData, getNameIndex(name));
+    Append<uint32_t>(&mStringArrayData, static_cast<uint32_t>(traceString.strings.size()));
+    for (const std::string &string : traceString.strings)
+    {
+        AppendString(&mStringArrayData, string.data(), string.size());
+    }
+    mStringArrayCount++;
+}
+
+void BinaryTraceWriter::addCall(const CallCapture &call,
+                                size_t numParamTokens,
+                                const Token *paramTokens)
+{
+    const std::vector<ParamCapture> &params = call.params.getParamCaptures();
+    ASSERT(params.size() == numParamTokens && params.size() <= kMaxParameters);
+
+    std::vector<uint8_t> *out = &mCurrentFunctionData;
+    if (call.entryPoint == EntryPoint::Invalid)
+    {
+        Append<uint16_t>(out, kCustomFunction);
+        Append<uint32_t>(out, getNameIndex(call.customFunctionName));
+    }
+    else
+    {
+        Append<uint16_t>(out, getEntryPointIndex(call.entryPoint));
+    }
+    Append<uint8_t>(out, static_cast<uint8_t>(params.size()));
+
+    // The parameter values are taken from the parsed call, except for pointers into the replay's
+    // buffers, which are only known once the replay runs.  Those are recognized by their token.
+    for (size_t paramIndex = 0; paramIndex < params.size(); ++paramIndex)
+    {
+        const ParamCapture &param = params[paramIndex];
+        const Token &token        = paramTokens[paramIndex];
+
+        BinaryParamKind kind = BinaryParamKind::Value;
+        uint64_t value       = 0;
+        if (param.type == ParamType::TGLcharConstPointerPointer)
+        {
+            kind  = BinaryParamKind::StringArray;
+            value = getNameIndex(token);
+        }
+        else if (token[0] == '"')
+        {
+            kind = BinaryParamKind::String;
+        }
+        else if (BeginsWith(token, "&gBinaryData["))
+        {
+            kind  = BinaryParamKind::BinaryData;
+            value = GetTokenIndex(token);
+        }
+        else if (BeginsWith(token, "&gReadBuffer["))
+        {
+            kind  = BinaryParamKind::ReadBuffer;
+            value = GetTokenIndex(token);
+        }
+        else if (strcmp(token, "gReadBuffer") == 0)
+        {
+            kind = BinaryParamKind::ReadBuffer;
+        }
+        else if (BeginsWith(token, "gClientArrays["))
+        {
+            kind  = BinaryParamKind::ClientArray;
+            value = GetTokenIndex(token);
+        }
+        else if (strcmp(token, "gResourceIDBuffer") == 0)
+        {
+            kind = BinaryParamKind::ResourceIDBuffer;
+        }
+        else if (!GetValueBits(param, &value))
+        {
+            printf("Unsupported parameter type for binary traces: %d (%s)\n",
+                   static_cast<int>(param.type), token);
+            UNREACHABLE();
+        }
+
+        ASSERT(static_cast<size_t>(param.type) < kCustomFunction);
+        Append<uint16_t>(out, static_cast<uint16_t>(param.type));
+        Append<uint8_t>(out, static_cast<uint8_t>(kind));
+        if (kind == BinaryParamKind::String)
+        {
+            const std::vector<uint8_t> &data = param.data[0];
+            ASSERT(!data.empty() && data.back() == 0);
+            AppendString(out, data.data(), data.size() - 1);
+        }
+        else
+        {
+            Append<uint64_t>(out, value);
+        }
+    }
+
+    mCurrentCallCount++;
+}
+
+void BinaryTraceWriter::endFunction(const std::string &name)
+{
+    std::vector<uint8_t> *out = &mFunctionData;
+    if (name == "InitReplay")
+    {
+        ASSERT(mInitReplayData.empty());
+        out = &mInitReplayData;
+    }
+
+    Append<uint32_t>(out, getNameIndex(name));
+    Append<uint32_t>(out, mCurrentCallCount);
+    out->insert(out->end(), mCurrentFunctionData.begin(), mCurrentFunctionData.end());
+
+    mCurrentFunctionData.clear();
+    mCurrentCallCount = 0;
+    mFunctionCount++;
+}
+
+bool BinaryTraceWriter::save(const std::string &path, uint64_t sourceHash) const
+{
+    ASSERT(mCurrentFunctionData.empty());
+
+    std::vector<uint8_t> data(std::begin(kMagic), std::end(kMagic));
+    Append<uint32_t>(&data, kVersion);
+    Append<uint64_t>(&data, sourceHash);
+
+    Append<uint32_t>(&data, static_cast<uint32_t>(mNames.size()));
+    for (const std::string &name : mNames)
+    {
+        AppendString(&data, name.data(), name.size());
+    }
+
+    Append<uint32_t>(&data, static_cast<uint32_t>(mEntryPoints.size()));
+    for (EntryPoint entryPoint : mEntryPoints)
+    {
+        Append<uint16_t>(&data, static_cast<uint16_t>(entryPoint));
+        Append<uint32_t>(&data, mNameIndices.at(GetEntryPointName(entryPoint)));
+    }
+
+    Append<uint32_t>(&data, mStringArrayCount);
+    data.insert(data.end(), mStringArrayData.begin(), mStringArrayData.end());
+
+    Append<uint32_t>(&data, mFunctionCount);
+    data.insert(data.end(), mInitReplayData.begin(), mInitReplayData.end());
+    data.insert(data.end(), mFunctionData.begin(), mFunctionData.end());
+
+    FILE *fp = fopen(path.c_str(), "wb");
+    if (fp == nullptr)
+    {
+        return false;
+    }
+    bool success = fwrite(data.data(), 1, data.size(), fp) == data.size();
+    success      = fclose(fp) == 0 && success;
+    return success;
+}
+
+bool LoadBinaryTrace(const uint8_t *data,
+                     size_t size,
+                     uint64_t sourceHash,
+                     TraceStringMap *stringsOut,
+                     const BinaryTraceFunctionCallback &addFunction)
+{
+    if (!ValidateBinaryTrace(data, size, sourceHash))
+    {
+        return false;
+    }
+
+    BinaryTraceReader reader(data, size);
+    reader.readHeader(sourceHash);
+
+    uint32_t arrayCount = reader.read<uint32_t>();
+    for (uint32_t arrayIndex = 0; arrayIndex < arrayCount; ++arrayIndex)
+    {
+        std::string name     = std::string(reader.readName());
+        uint32_t stringCount = reader.read<uint32_t>();
+
+        TraceString traceStr;
+        for (uint32_t stringIndex = 0; stringIndex < stringCount; ++stringIndex)
+        {
+            traceStr.strings.emplace_back(reader.readString());
+        }
+        for (const std::string &string : traceStr.strings)
+        {
+            traceStr.pointers.push_back(string.c_str());
+        }
+        (*stringsOut)[name] = std::move(traceStr);
+    }
+
+    BinaryCall call;
+    uint32_t functionCount = reader.read<uint32_t>();
+    for (uint32_t functionIndex = 0; functionIndex < functionCount; ++functionIndex)
+    {
+        std::string name   = std::string(reader.readName());
+        uint32_t callCount = reader.read<uint32_t>();
+
+        TraceFunction func;
+        func.reserve(callCount);
+        for (uint32_t callIndex = 0; callIndex < callCount; ++callIndex)
+        {
+            reader.readCall(&call);
+            func.push_back(MakeCallCapture(call, *stringsOut));
+        }
+        addFunction(name, std::move(func));
+    }
+
+    ASSERT(reader.ok() && reader.atEnd());
+    return true;
+}
+
+}  // namespace angle
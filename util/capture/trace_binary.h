@@ -0,0 +1,109 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// trace_binary.h:
+//   Pre-tokenized binary form of the C-based replays, which the trace interpreter loads without
+//   parsing any text.
+//
+
+#ifndef ANGLE_TRACE_BINARY_H_
+#define ANGLE_TRACE_BINARY_H_
+
+#include <functional>
+#include <unordered_map>
+
+#include "trace_interpreter.h"
+
+namespace angle
+{
+// A binary trace holds the string arrays and functions of a replay as a stream of calls with typed
+// parameter values.  Pointer parameters are stored as offsets into the replay's buffers
+// (gBinaryData, gReadBuffer, ...) and are resolved once InitReplay has allocated them.  All
+// integers are stored in native byte order:
+//
+//   Header        "ANGLETRB", uint32 version, uint64 source hash
+//   Names         uint32 count, count * String
+//   Entry points  uint32 count, count * (uint16 EntryPoint, uint32 name)
+//   String arrays uint32 count, count * (uint32 name, uint32 string count, strings * String)
+//   Functions     uint32 count, count * (uint32 name, uint32 call count, calls * Call)
+//   Call          uint16 entry point index, or 0xFFFF followed by the uint32 name of a custom
+//                 function, uint8 parameter count, parameters * Parameter
+//   Parameter     uint16 ParamType, uint8 BinaryParamKind, then a String for string literals or a
+//                 uint64 value for everything else
+//   String        uint32 size, size bytes
+//
+// InitReplay is always the first function.  The source hash identifies the C sources the trace was
+// written from, so a binary trace is rebuilt when they change.  The entry points are stored by
+// name as well so a binary trace written by a build with different entry points is rejected rather
+// than misread.
+enum class BinaryParamKind : uint8_t
+{
+    // The value itself: an integer, the bits of a float, a resource ID or a literal pointer.
+    Value,
+    // A pointer into gBinaryData, gReadBuffer or gClientArrays, or gResourceIDBuffer.  The value
+    // is the offset or the client array index.
+    BinaryData,
+    ReadBuffer,
+    ClientArray,
+    ResourceIDBuffer,
+    // A string literal, as written in the C source.
+    String,
+    // One of the string arrays.  The value is the index of its name.
+    StringArray,
+
+    InvalidEnum,
+};
+
+// Records the string arrays and functions the trace interpreter parses from the C sources of a
+// replay, and saves them as a binary trace.
+class BinaryTraceWriter : angle::NonCopyable
+{
+  public:
+    BinaryTraceWriter();
+    ~BinaryTraceWriter();
+
+    void addStringArray(const std::string &name, const TraceString &traceString);
+
+    // |paramTokens| are the tokens |call| was parsed from, one for each parameter.
+    void addCall(const CallCapture &call, size_t numParamTokens, const Token *paramTokens);
+    void endFunction(const std::string &name);
+
+    bool save(const std::string &path, uint64_t sourceHash) const;
+
+  private:
+    uint32_t getNameIndex(const std::string &name);
+    uint16_t getEntryPointIndex(EntryPoint entryPoint);
+
+    std::vector<std::string> mNames;
+    std::unordered_map<std::string, uint32_t> mNameIndices;
+    std::vector<EntryPoint> mEntryPoints;
+    std::unordered_map<EntryPoint, uint16_t> mEntryPointIndices;
+
+    uint32_t mStringArrayCount = 0;
+    std::vector<uint8_t> mStringArrayData;
+
+    // InitReplay is kept apart so it can be written first.
+    uint32_t mFunctionCount = 0;
+    std::vector<uint8_t> mInitReplayData;
+    std::vector<uint8_t> mFunctionData;
+    uint32_t mCurrentCallCount = 0;
+    std::vector<uint8_t> mCurrentFunctionData;
+};
+
+using BinaryTraceFunctionCallback =
+    std::function<void(const std::string &name, TraceFunction &&func)>;
+
+// Loads a binary trace.  The whole trace is validated before anything is loaded.  Functions are
+// passed to |addFunction| in order, and the pointer parameters of a function are only resolved
+// after the previous ones were added, so InitReplay can allocate the buffers they point into.
+// Fails if the trace wasn't written with |sourceHash|.
+bool LoadBinaryTrace(const uint8_t *data,
+                     size_t size,
+                     uint64_t sourceHash,
+                     TraceStringMap *stringsOut,
+                     const BinaryTraceFunctionCallback &addFunction);
+}  // namespace angle
+
+#endif  // ANGLE_TRACE_BINARY_H_
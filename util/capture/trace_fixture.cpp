@@ -55,8 +55,6 @@ EGLClientBuffer GetClientBuffer(EGLenum target, uintptr_t key)
 
 ValidateSerializedStateCallback gValidateSerializedStateCallback;
 std::unordered_map<GLuint, std::vector<GLint>> gInternalUniformLocationsMap;
-
-constexpr size_t kMaxClientArrays = 16;
 }  // namespace
 
 GLint **gUniformLocations;
@@ -339,6 +337,7 @@ void SetValidateSerializedStateCallback(ValidateSerializedStateCallback callback
 
 angle::TraceInfo gTraceInfo;
 std::string gTraceGzPath;
+std::string gTraceBinaryPath;
 
 struct TraceFunctionsImpl : angle::TraceFunctions
 {
@@ -360,6 +359,11 @@ struct TraceFunctionsImpl : angle::TraceFunctions
     void SetTraceInfo(const angle::TraceInfo &traceInfo) override { gTraceInfo = traceInfo; }
 
     void SetTraceGzPath(const std::string &traceGzPath) override { gTraceGzPath = traceGzPath; }
+
+    void SetTraceBinaryPath(const std::string &traceBinaryPath) override
+    {
+        gTraceBinaryPath = traceBinaryPath;
+    }
 };
 
 TraceFunctionsImpl gTraceFunctionsImpl;
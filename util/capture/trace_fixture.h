@@ -46,6 +46,7 @@ extern ContextMap gContextMap;
 extern std::string gBinaryDataDir;
 extern angle::TraceInfo gTraceInfo;
 extern std::string gTraceGzPath;
+extern std::string gTraceBinaryPath;
 
 using ValidateSerializedStateCallback = void (*)(const char *, const char *, uint32_t);
 
@@ -82,7 +83,8 @@ void UpdateCurrentProgram(GLuint program);
 
 extern uint8_t *gBinaryData;
 extern uint8_t *gReadBuffer;
-extern uint8_t *gClientArrays[];
+constexpr size_t kMaxClientArrays = 16;
+extern uint8_t *gClientArrays[kMaxClientArrays];
 extern GLuint *gResourceIDBuffer;
 
 extern GLuint *gBufferMap;
@@ -65,6 +65,7 @@ struct TraceFunctions
     virtual void SetBinaryDataDir(const char *dataDir)                        = 0;
     virtual void SetReplayResourceMode(const ReplayResourceMode resourceMode) = 0;
     virtual void SetTraceGzPath(const std::string &traceGzPath)               = 0;
+    virtual void SetTraceBinaryPath(const std::string &traceBinaryPath)       = 0;
     virtual void SetTraceInfo(const TraceInfo &traceInfo)                     = 0;
 
     virtual ~TraceFunctions() {}
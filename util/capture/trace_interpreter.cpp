@@ -12,7 +12,10 @@
 #include "anglebase/no_destructor.h"
 #include "common/gl_enum_utils.h"
 #include "common/string_utils.h"
+#include "common/system_utils.h"
+#include "trace_binary.h"
 #include "trace_fixture.h"
+#include "xxhash.h"
 
 #define USE_SYSTEM_ZLIB
 #include "compression_utils_portable.h"
@@ -34,16 +37,31 @@ void ReplayTraceFunction(const TraceFunction &func, const TraceFunctionMap &cust
     }
 }
 
+void AddTraceFunction(TraceFunctionMap &functions,
+                      const std::string &funcName,
+                      TraceFunction &&func)
+{
+    // Run initialize immediately so we can load the binary data.
+    if (funcName == "InitReplay")
+    {
+        ReplayTraceFunction(func, {});
+        func.clear();
+    }
+    functions[funcName] = std::move(func);
+}
+
 class Parser : angle::NonCopyable
 {
   public:
     Parser(const std::string &stream,
            TraceFunctionMap &functionsIn,
            TraceStringMap &stringsIn,
+           BinaryTraceWriter *binaryWriter,
            bool verboseLogging)
         : mStream(stream),
           mFunctions(functionsIn),
           mStrings(stringsIn),
+          mBinaryWriter(binaryWriter),
           mIndex(0),
           mVerboseLogging(verboseLogging)
     {}
@@ -265,6 +283,10 @@ class Parser : angle::NonCopyable
 
             // We pass in the strings for specific use with C string array parameters.
             CallCapture call = ParseCallCapture(nameToken, numParams, paramTokens, mStrings);
+            if (mBinaryWriter)
+            {
+                mBinaryWriter->addCall(call, numParams, paramTokens);
+            }
             func.push_back(std::move(call));
             skipLine();
         }
@@ -309,23 +331,26 @@ class Parser : angle::NonCopyable
             traceStr.pointers.push_back(cppstr.c_str());
         }
 
+        if (mBinaryWriter)
+        {
+            mBinaryWriter->addStringArray(name, traceStr);
+        }
         mStrings[name] = std::move(traceStr);
     }
 
     void addFunction(const std::string &funcName, TraceFunction &func)
     {
-        // Run initialize immediately so we can load the binary data.
-        if (funcName == "InitReplay")
+        if (mBinaryWriter)
         {
-            ReplayTraceFunction(func, {});
-            func.clear();
+            mBinaryWriter->endFunction(funcName);
         }
-        mFunctions[funcName] = std::move(func);
+        AddTraceFunction(mFunctions, funcName, std::move(func));
     }
 
     const std::string &mStream;
     TraceFunctionMap &mFunctions;
     TraceStringMap &mStrings;
+    BinaryTraceWriter *mBinaryWriter;
     size_t mIndex;
     bool mVerboseLogging = false;
 };
@@ -520,8 +545,10 @@ class TraceInterpreter : angle::NonCopyable
 
   private:
     void runTraceFunction(const char *name) const;
-    void parseTraceUncompressed();
-    void parseTraceGz();
+    void parseTraceUncompressed(BinaryTraceWriter *binaryWriter);
+    void parseTraceGz(BinaryTraceWriter *binaryWriter);
+    bool computeTraceSourceHash(uint64_t *hashOut) const;
+    bool loadTraceBinary(uint64_t sourceHash);
 
     TraceFunctionMap mTraceFunctions;
     TraceStringMap mTraceStrings;
@@ -535,7 +562,7 @@ void TraceInterpreter::replayFrame(uint32_t frameIndex)
     runTraceFunction(funcName);
 }
 
-void TraceInterpreter::parseTraceUncompressed()
+void TraceInterpreter::parseTraceUncompressed(BinaryTraceWriter *binaryWriter)
 {
     for (const std::string &file : gTraceInfo.traceFiles)
     {
@@ -562,12 +589,12 @@ void TraceInterpreter::parseTraceUncompressed()
             UNREACHABLE();
         }
 
-        Parser parser(fileData, mTraceFunctions, mTraceStrings, mVerboseLogging);
+        Parser parser(fileData, mTraceFunctions, mTraceStrings, binaryWriter, mVerboseLogging);
         parser.parse();
     }
 }
 
-void TraceInterpreter::parseTraceGz()
+void TraceInterpreter::parseTraceGz(BinaryTraceWriter *binaryWriter)
 {
     if (mVerboseLogging)
     {
@@ -603,19 +630,101 @@ void TraceInterpreter::parseTraceGz()
         exit(1);
     }
 
-    Parser parser(uncompressedData, mTraceFunctions, mTraceStrings, mVerboseLogging);
+    Parser parser(uncompressedData, mTraceFunctions, mTraceStrings, binaryWriter,
+                  mVerboseLogging);
     parser.parse();
 }
 
-void TraceInterpreter::setupReplay()
+// Hashes the contents of the files the trace is parsed from.  Hashing is much cheaper than parsing,
+// and unlike timestamps doesn't depend on how the files were copied or checked out.
+bool TraceInterpreter::computeTraceSourceHash(uint64_t *hashOut) const
 {
+    std::vector<std::string> paths;
     if (!gTraceGzPath.empty())
     {
-        parseTraceGz();
+        paths.push_back(gTraceGzPath);
     }
     else
     {
-        parseTraceUncompressed();
+        for (const std::string &file : gTraceInfo.traceFiles)
+        {
+            if (ShouldParseFile(file))
+            {
+                std::stringstream pathStream;
+                pathStream << gBinaryDataDir << GetPathSeparator() << file;
+                paths.push_back(pathStream.str());
+            }
+        }
+    }
+
+    uint64_t hash = 0;
+    for (const std::string &path : paths)
+    {
+        MemoryMappedFile file;
+        if (!file.openReadOnly(path))
+        {
+            return false;
+        }
+        hash = XXH64(file.data(), file.size(), hash);
+    }
+
+    *hashOut = hash;
+    return true;
+}
+
+bool TraceInterpreter::loadTraceBinary(uint64_t sourceHash)
+{
+    MemoryMappedFile file;
+    if (!file.openReadOnly(gTraceBinaryPath))
+    {
+        return false;
+    }
+
+    if (mVerboseLogging)
+    {
+        printf("Loading functions from %s\n", gTraceBinaryPath.c_str());
+    }
+
+    return LoadBinaryTrace(file.data(), file.size(), sourceHash, &mTraceStrings,
+                           [this](const std::string &funcName, TraceFunction &&func) {
+                               AddTraceFunction(mTraceFunctions, funcName, std::move(func));
+                           });
+}
+
+void TraceInterpreter::setupReplay()
+{
+    // The binary trace is created from the C sources the first time the trace is replayed, and
+    // recreated whenever they change.
+    uint64_t sourceHash = 0;
+    bool useBinary      = !gTraceBinaryPath.empty() && computeTraceSourceHash(&sourceHash);
+    if (!useBinary || !loadTraceBinary(sourceHash))
+    {
+        std::unique_ptr<BinaryTraceWriter> binaryWriter;
+        if (useBinary)
+        {
+            binaryWriter = std::make_unique<BinaryTraceWriter>();
+        }
+
+        if (!gTraceGzPath.empty())
+        {
+            parseTraceGz(binaryWriter.get());
+        }
+        else
+        {
+            parseTraceUncompressed(binaryWriter.get());
+        }
+
+        if (binaryWriter)
+        {
+            if (binaryWriter->save(gTraceBinaryPath, sourceHash))
+            {
+                printf("Saved binary trace to %s\n", gTraceBinaryPath.c_str());
+            }
+            else
+            {
+                printf("Failed to save binary trace to %s\n", gTraceBinaryPath.c_str());
+            }
+        }
     }
 
     if (mTraceFunctions.count("SetupReplay") == 0)